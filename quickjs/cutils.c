@@ -326,6 +326,145 @@ int unicode_from_utf8(const uint8_t *p, int max_len, const uint8_t **pp)
     return c;
 }
 
+/* LZ77 block compression. The block is a sequence of literal runs
+   and back references in the LZ4 style: a token byte holds the
+   literal length (high 4 bits) and the match length minus 4 (low 4
+   bits), the value 15 is followed by extra length bytes. The literals
+   follow, then the match distance on 2 bytes (little endian). The
+   last sequence only contains literals. */
+
+#define LZ_HASH_BITS 12
+#define LZ_MATCH_MIN 4
+#define LZ_DIST_MAX 65535
+
+static inline uint32_t lz_hash(const uint8_t *p)
+{
+    return (get_u32(p) * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static void lz_put_len(DynBuf *s, size_t len)
+{
+    while (len >= 255) {
+        dbuf_putc(s, 255);
+        len -= 255;
+    }
+    dbuf_putc(s, len);
+}
+
+/* 'match_len' = 0 for the last sequence */
+static void lz_put_seq(DynBuf *s, const uint8_t *lit, size_t lit_len,
+                       size_t dist, size_t match_len)
+{
+    int token;
+
+    token = min_int(lit_len, 15) << 4;
+    if (match_len != 0)
+        token |= min_int(match_len - LZ_MATCH_MIN, 15);
+    dbuf_putc(s, token);
+    if (lit_len >= 15)
+        lz_put_len(s, lit_len - 15);
+    dbuf_put(s, lit, lit_len);
+    if (match_len != 0) {
+        dbuf_putc(s, dist);
+        dbuf_putc(s, dist >> 8);
+        if (match_len - LZ_MATCH_MIN >= 15)
+            lz_put_len(s, match_len - LZ_MATCH_MIN - 15);
+    }
+}
+
+/* append the compressed block to 's'. Return -1 if memory error. */
+int lz_block_compress(DynBuf *s, const uint8_t *src, size_t src_len)
+{
+    uint32_t hash_table[1 << LZ_HASH_BITS]; /* position + 1, 0 if none */
+    const uint8_t *ip, *anchor, *ref, *end;
+    uint32_t h, pos;
+    size_t len;
+
+    memset(hash_table, 0, sizeof(hash_table));
+    ip = anchor = src;
+    end = src + src_len;
+    while (end - ip >= LZ_MATCH_MIN) {
+        h = lz_hash(ip);
+        pos = hash_table[h];
+        hash_table[h] = ip - src + 1;
+        if (pos != 0) {
+            ref = src + pos - 1;
+            if (ip - ref <= LZ_DIST_MAX && get_u32(ref) == get_u32(ip)) {
+                len = LZ_MATCH_MIN;
+                while (ip + len < end && ref[len] == ip[len])
+                    len++;
+                lz_put_seq(s, anchor, ip - anchor, ip - ref, len);
+                ip += len;
+                anchor = ip;
+                continue;
+            }
+        }
+        ip++;
+    }
+    lz_put_seq(s, anchor, end - anchor, 0, 0);
+    return dbuf_error(s) ? -1 : 0;
+}
+
+static int lz_get_len(const uint8_t **pp, const uint8_t *end, size_t *plen)
+{
+    const uint8_t *p = *pp;
+    int c;
+
+    do {
+        if (p >= end)
+            return -1;
+        c = *p++;
+        *plen += c;
+    } while (c == 255);
+    *pp = p;
+    return 0;
+}
+
+/* decompress the block 'src' into exactly 'dst_len' bytes. Return -1
+   if the block is invalid. */
+int lz_block_decompress(uint8_t *dst, size_t dst_len,
+                        const uint8_t *src, size_t src_len)
+{
+    const uint8_t *ip, *ip_end;
+    uint8_t *op, *op_end;
+    size_t len, dist;
+    int token;
+
+    ip = src;
+    ip_end = src + src_len;
+    op = dst;
+    op_end = dst + dst_len;
+    while (ip < ip_end) {
+        token = *ip++;
+        len = token >> 4;
+        if (len == 15 && lz_get_len(&ip, ip_end, &len))
+            return -1;
+        if (len > (size_t)(ip_end - ip) || len > (size_t)(op_end - op))
+            return -1;
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+        if (ip == ip_end)
+            break; /* last sequence */
+        if (ip_end - ip < 2)
+            return -1;
+        dist = ip[0] | (ip[1] << 8);
+        ip += 2;
+        len = (token & 15) + LZ_MATCH_MIN;
+        if ((token & 15) == 15 && lz_get_len(&ip, ip_end, &len))
+            return -1;
+        if (dist == 0 || dist > (size_t)(op - dst) ||
+            len > (size_t)(op_end - op))
+            return -1;
+        /* the match may overlap the output */
+        while (len-- != 0) {
+            *op = op[-dist];
+            op++;
+        }
+    }
+    return (op == op_end) ? 0 : -1;
+}
+
 #if 0
 
 #if defined(EMSCRIPTEN) || defined(__ANDROID__)
@@ -379,6 +379,11 @@ static inline int from_hex(int c)
         return -1;
 }
 
+/* LZ77 block compression (LZ4 like format) */
+int lz_block_compress(DynBuf *s, const uint8_t *src, size_t src_len);
+int lz_block_decompress(uint8_t *dst, size_t dst_len,
+                        const uint8_t *src, size_t src_len);
+
 void rqsort(void *base, size_t nmemb, size_t size,
             int (*cmp)(const void *, const void *, void *),
             void *arg);
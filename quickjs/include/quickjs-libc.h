@@ -51,6 +51,10 @@ void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
                                       JSValueConst reason,
                                       JS_BOOL is_handled, void *opaque);
 void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt));
+int js_std_preload_modules(JSContext *ctx, const char *filename, int n_threads);
+void js_std_set_module_cache(const char *dir);
+int js_std_warm_module_cache(JSContext *ctx, const char *filename,
+                             int n_threads);
                                         
 #ifdef __cplusplus
 } /* extern "C" { */
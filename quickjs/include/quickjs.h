@@ -442,6 +442,9 @@ static inline JS_BOOL JS_VALUE_IS_NAN(JSValue v)
 #define JS_EVAL_FLAG_COMPILE_ONLY (1 << 5)
 /* don't include the stack frames before this eval in the Error() backtraces */
 #define JS_EVAL_FLAG_BACKTRACE_BARRIER (1 << 6)
+/* with JS_EVAL_FLAG_COMPILE_ONLY: do not load the modules imported by
+   a module. JS_ResolveModule() loads them. */
+#define JS_EVAL_FLAG_NO_RESOLVE (1 << 7)
 
 typedef JSValue JSCFunction(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 typedef JSValue JSCFunctionMagic(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv, int magic);
@@ -552,6 +555,46 @@ typedef struct JSMemoryUsage {
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
+/* counters maintained by the runtime, cheap enough to be read
+   periodically. The allocation counters are cumulative since the
+   runtime creation, times are in microseconds. They are plain fields
+   updated by the thread running the runtime: JS_GetRuntimeStats() and
+   JS_EnumClassStats() must be called from that thread (e.g. from a
+   timer or a job), the copy can then be used by any thread. */
+typedef struct JSRuntimeStats {
+    int64_t malloc_count, malloc_size; /* current heap usage */
+    int64_t alloc_count, alloc_size; /* all the allocations */
+    int64_t obj_alloc_count, obj_alloc_size;
+    int64_t str_alloc_count, str_alloc_size;
+    int64_t shape_alloc_count, shape_alloc_size;
+    int64_t js_func_alloc_count, js_func_alloc_size;
+    int64_t binary_alloc_count, binary_alloc_size; /* ArrayBuffer data */
+    int64_t obj_count; /* live objects */
+    int64_t gc_count, gc_time, gc_max_time; /* cycle collections */
+    int64_t job_count; /* executed jobs */
+    int64_t c_call_count; /* calls of C functions */
+    int64_t exception_count; /* thrown exceptions */
+} JSRuntimeStats;
+
+typedef void JSClassStatsFunc(void *opaque, JSClassID class_id,
+                              const char *class_name, int64_t obj_count);
+
+void JS_GetRuntimeStats(JSRuntime *rt, JSRuntimeStats *s);
+/* call 'func' with the number of live objects of each registered class */
+void JS_EnumClassStats(JSRuntime *rt, JSClassStatsFunc *func, void *opaque);
+
+/* compiled RegExp cache, shared by all the contexts of a runtime */
+typedef struct JSRegExpCacheStats {
+    int64_t count, size;
+    int64_t max_count, max_size;
+    int64_t hits, misses;
+} JSRegExpCacheStats;
+
+/* use max_count = 0 to disable the cache */
+void JS_SetRegExpCacheLimits(JSRuntime *rt, int max_count, size_t max_size);
+void JS_GetRegExpCacheStats(JSRuntime *rt, JSRegExpCacheStats *s);
+void JS_ClearRegExpCache(JSRuntime *rt);
+
 /* atom support */
 #define JS_ATOM_NULL 0
 
@@ -1019,6 +1062,9 @@ typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
 /* if can_block is TRUE, Atomics.wait() can be used */
 void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
+/* if enable is TRUE, the nested functions of the code compiled
+   afterwards are only parsed and are compiled when first called */
+void JS_SetLazyCompilation(JSRuntime *rt, JS_BOOL enable);
 /* set the [IsHTMLDDA] internal slot */
 void JS_SetIsHTMLDDA(JSContext *ctx, JSValueConst obj);
 
@@ -1037,6 +1083,9 @@ typedef JSModuleDef *JSModuleLoaderFunc(JSContext *ctx,
 void JS_SetModuleLoaderFunc(JSRuntime *rt,
                             JSModuleNormalizeFunc *module_normalize,
                             JSModuleLoaderFunc *module_loader, void *opaque);
+/* the default module filename normalizer */
+char *JS_NormalizeModuleName(JSContext *ctx, const char *base_name,
+                             const char *name);
 /* return the import.meta object of a module */
 JSValue JS_GetImportMeta(JSContext *ctx, JSModuleDef *m);
 JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m);
@@ -1048,6 +1097,11 @@ int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func, int argc, JSValueConst *a
 
 JS_BOOL JS_IsJobPending(JSRuntime *rt);
 int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx);
+/* run up to max_jobs jobs (max_jobs < 0: no limit) or until time_budget_ms
+   (if > 0) is elapsed. Return the number of executed jobs. '*pctx' is the
+   context of the job which raised an exception (it stops the batch) or NULL */
+int JS_ExecutePendingJobs(JSRuntime *rt, int max_jobs, int time_budget_ms,
+                          JSContext **pctx);
 
 /* Object Writer/Reader (currently only used to handle precompiled code) */
 #define JS_WRITE_OBJ_BYTECODE  (1 << 0) /* allow function/module */
@@ -1056,17 +1110,58 @@ int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx);
 #define JS_WRITE_OBJ_REFERENCE (1 << 3) /* allow object references to
                                            encode arbitrary object
                                            graph */
+#define JS_WRITE_OBJ_MALLOC    (1 << 4) /* the output buffer is allocated
+                                           with malloc() */
+#define JS_WRITE_OBJ_STRIP_DEBUG (1 << 5) /* do not output the line
+                                             number tables of the
+                                             functions */
+#define JS_WRITE_OBJ_COMPRESS  (1 << 6) /* compress the output. It is
+                                           uncompressed by
+                                           JS_ReadObject() */
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
                          int flags, uint8_t ***psab_tab, size_t *psab_tab_len);
 
+/* contents of a transferred ArrayBuffer */
+typedef struct JSArrayBufferTransfer {
+    uint8_t *data; /* allocated with malloc() */
+    size_t byte_length;
+} JSArrayBufferTransfer;
+
+/* Same as JS_WriteObject2() but the ArrayBuffers of 'transfer_list'
+   are moved instead of copied: on success they are detached and their
+   contents are stored in 'transfer_tab' (of 'transfer_len'
+   entries). */
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list, int transfer_len,
+                         JSArrayBufferTransfer *transfer_tab);
+
 #define JS_READ_OBJ_BYTECODE  (1 << 0) /* allow function/module */
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
+/* the bytecode can only be read by an engine with the same build id. It
+   is made of the version, BC_VERSION and a hash of the opcode and atom
+   tables, so it does not change when the same sources are rebuilt. */
+const char *JS_GetBuildId(void);
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len, int flags);
 JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len, int flags, size_t* remnants_len);
+/* The ArrayBuffers found in 'transfer_tab' take ownership of their data
+   (the 'data' field is then set to NULL). */
+JSValue JS_ReadObject3(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, size_t *remnants_len,
+                       JSArrayBufferTransfer *transfer_tab, int transfer_len);
+/* Same as JS_ReadObject() with JS_READ_OBJ_ROM_DATA: the bytecode and
+   the debug information of the functions are not copied and reference
+   'buf', which must not be modified (e.g. a read only mmap() of a
+   file). The atoms of the bytecode are relocated when a function is
+   first called. 'free_func(rt, opaque, buf)' is called when no object
+   references 'buf' anymore (it can be NULL if 'buf' is never freed). */
+JSValue JS_ReadObjectROM(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                         int flags, JSFreeArrayBufferDataFunc *free_func,
+                         void *opaque);
 
 /* load the dependencies of the module 'obj'. Useful when JS_ReadObject()
    returns a module. */
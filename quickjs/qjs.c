@@ -301,6 +301,10 @@ void help(void)
            "-d  --dump         dump the memory usage stats\n"
            "    --memory-limit n       limit the memory usage to 'n' bytes\n"
            "    --stack-size n         limit the stack size to 'n' bytes\n"
+           "    --load-threads n       compile the imported modules on 'n' threads\n"
+           "    --module-cache dir     cache the bytecode of the modules in 'dir'\n"
+           "    --warm-cache           compile the modules of the files into the cache\n"
+           "    --lazy-compile         compile the nested functions when first called\n"
            "    --unhandled-rejection  dump unhandled promise rejections\n"
            "-q  --quit         just instantiate the interpreter and quit\n");
     exit(1);
@@ -327,6 +331,9 @@ int main(int argc, char **argv)
     int load_jscalc;
 #endif
     size_t stack_size = 0;
+    int load_threads = 0;
+    int warm_cache = 0;
+    int lazy_compile = 0;
     
 #ifdef CONFIG_BIGNUM
     /* load jscalc runtime if invoked as 'qjscalc' */
@@ -447,6 +454,30 @@ int main(int argc, char **argv)
                 stack_size = (size_t)strtod(argv[optind++], NULL);
                 continue;
             }
+            if (!strcmp(longopt, "load-threads")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting number of threads");
+                    exit(1);
+                }
+                load_threads = atoi(argv[optind++]);
+                continue;
+            }
+            if (!strcmp(longopt, "module-cache")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting cache directory");
+                    exit(1);
+                }
+                js_std_set_module_cache(argv[optind++]);
+                continue;
+            }
+            if (!strcmp(longopt, "warm-cache")) {
+                warm_cache = 1;
+                continue;
+            }
+            if (!strcmp(longopt, "lazy-compile")) {
+                lazy_compile = 1;
+                continue;
+            }
             if (opt) {
                 fprintf(stderr, "qjs: unknown option '-%c'\n", opt);
             } else {
@@ -473,6 +504,8 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (lazy_compile)
+        JS_SetLazyCompilation(rt, TRUE);
     js_std_set_worker_new_context_func(JS_NewCustomContext);
     js_std_init_handlers(rt);
     ctx = JS_NewCustomContext(rt);
@@ -511,6 +544,15 @@ int main(int argc, char **argv)
                 goto fail;
         }
 
+        if (warm_cache) {
+            /* all the arguments are modules to compile */
+            for(i = optind; i < argc; i++) {
+                if (js_std_warm_module_cache(ctx, argv[i], load_threads)) {
+                    js_std_dump_error(ctx);
+                    goto fail;
+                }
+            }
+        } else
         if (expr) {
             if (eval_buf(ctx, expr, strlen(expr), "<cmdline>", 0))
                 goto fail;
@@ -521,6 +563,8 @@ int main(int argc, char **argv)
         } else {
             const char *filename;
             filename = argv[optind];
+            if (load_threads > 0)
+                js_std_preload_modules(ctx, filename, load_threads);
             if (eval_file(ctx, filename, module))
                 goto fail;
         }
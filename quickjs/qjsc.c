@@ -66,6 +66,8 @@ static namelist_t init_module_list;
 static uint64_t feature_bitmap;
 static FILE *outfile;
 static BOOL byte_swap;
+static BOOL strip_debug;
+static BOOL compress_output;
 static BOOL dynamic_export;
 static const char *c_ident_prefix = "qjsc_";
 
@@ -189,6 +191,10 @@ static void output_object_code(JSContext *ctx,
     flags = JS_WRITE_OBJ_BYTECODE;
     if (byte_swap)
         flags |= JS_WRITE_OBJ_BSWAP;
+    if (strip_debug)
+        flags |= JS_WRITE_OBJ_STRIP_DEBUG;
+    if (compress_output)
+        flags |= JS_WRITE_OBJ_COMPRESS;
     out_buf = JS_WriteObject(ctx, &out_buf_len, obj, flags);
     if (!out_buf) {
         js_std_dump_error(ctx);
@@ -360,6 +366,8 @@ void help(void)
            "-D module_name         compile a dynamically loaded module or worker\n"
            "-M module_name[,cname] add initialization code for an external C module\n"
            "-x          byte swapped output\n"
+           "-s          strip the line number information\n"
+           "-z          compress the bytecode\n"
            "-p prefix   set the prefix of the generated C names\n"
            "-S n        set the maximum stack size to 'n' bytes (default=%d)\n",
            JS_DEFAULT_STACK_SIZE);
@@ -521,7 +529,7 @@ int main(int argc, char **argv)
     namelist_add(&cmodule_list, "os", "os", 0);
 
     for(;;) {
-        c = getopt(argc, argv, "ho:cN:f:mxevM:p:S:D:");
+        c = getopt(argc, argv, "ho:cN:f:mxszevM:p:S:D:");
         if (c == -1)
             break;
         switch(c) {
@@ -593,6 +601,12 @@ int main(int argc, char **argv)
         case 'x':
             byte_swap = TRUE;
             break;
+        case 's':
+            strip_debug = TRUE;
+            break;
+        case 'z':
+            compress_output = TRUE;
+            break;
         case 'v':
             verbose++;
             break;
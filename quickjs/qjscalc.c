@@ -2,10 +2,10 @@
 
 #include <inttypes.h>
 
-const uint32_t qjsc_qjscalc_size = 30445;
+const uint32_t qjsc_qjscalc_size = 31970;
 
-const uint8_t qjsc_qjscalc[30445] = {
- 0x02, 0xb8, 0x02, 0x1a, 0x2e, 0x2e, 0x2f, 0x71,
+const uint8_t qjsc_qjscalc[31970] = {
+ 0x04, 0xba, 0x02, 0x1a, 0x2e, 0x2e, 0x2f, 0x71,
  0x6a, 0x73, 0x63, 0x61, 0x6c, 0x63, 0x2e, 0x6a,
  0x73, 0x0e, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65,
  0x72, 0x0a, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x10,
@@ -58,3758 +58,3949 @@ const uint8_t qjsc_qjscalc[30445] = {
  0x65, 0x72, 0x04, 0x63, 0x70, 0x04, 0x64, 0x70,
  0x10, 0x70, 0x6f, 0x6c, 0x72, 0x6f, 0x6f, 0x74,
  0x73, 0x10, 0x62, 0x65, 0x73, 0x74, 0x61, 0x70,
- 0x70, 0x72, 0x04, 0x50, 0x49, 0x0e, 0x69, 0x73,
- 0x50, 0x72, 0x69, 0x6d, 0x65, 0x12, 0x6e, 0x65,
- 0x78, 0x74, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x0a,
- 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x12, 0x61, 0x64,
- 0x64, 0x5f, 0x70, 0x72, 0x6f, 0x70, 0x73, 0x1a,
- 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
- 0x73, 0x5f, 0x73, 0x65, 0x74, 0x16, 0x67, 0x65,
- 0x6e, 0x65, 0x72, 0x69, 0x63, 0x5f, 0x70, 0x6f,
- 0x77, 0x18, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x5f,
- 0x70, 0x72, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x6d,
- 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x5f, 0x72, 0x61,
- 0x62, 0x69, 0x6e, 0x5f, 0x74, 0x65, 0x73, 0x74,
- 0x10, 0x66, 0x61, 0x63, 0x74, 0x5f, 0x72, 0x65,
- 0x63, 0x18, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69,
- 0x6f, 0x6e, 0x5f, 0x61, 0x64, 0x64, 0x18, 0x66,
+ 0x70, 0x72, 0x14, 0x75, 0x73, 0x65, 0x20, 0x73,
+ 0x74, 0x72, 0x69, 0x63, 0x74, 0x10, 0x75, 0x73,
+ 0x65, 0x20, 0x6d, 0x61, 0x74, 0x68, 0x04, 0x50,
+ 0x49, 0x0e, 0x69, 0x73, 0x50, 0x72, 0x69, 0x6d,
+ 0x65, 0x12, 0x6e, 0x65, 0x78, 0x74, 0x50, 0x72,
+ 0x69, 0x6d, 0x65, 0x0a, 0x72, 0x6f, 0x6f, 0x74,
+ 0x73, 0x12, 0x61, 0x64, 0x64, 0x5f, 0x70, 0x72,
+ 0x6f, 0x70, 0x73, 0x1a, 0x6f, 0x70, 0x65, 0x72,
+ 0x61, 0x74, 0x6f, 0x72, 0x73, 0x5f, 0x73, 0x65,
+ 0x74, 0x16, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69,
+ 0x63, 0x5f, 0x70, 0x6f, 0x77, 0x18, 0x73, 0x6d,
+ 0x61, 0x6c, 0x6c, 0x5f, 0x70, 0x72, 0x69, 0x6d,
+ 0x65, 0x73, 0x22, 0x6d, 0x69, 0x6c, 0x6c, 0x65,
+ 0x72, 0x5f, 0x72, 0x61, 0x62, 0x69, 0x6e, 0x5f,
+ 0x74, 0x65, 0x73, 0x74, 0x10, 0x66, 0x61, 0x63,
+ 0x74, 0x5f, 0x72, 0x65, 0x63, 0x18, 0x66, 0x72,
+ 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x61,
+ 0x64, 0x64, 0x18, 0x66, 0x72, 0x61, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x75, 0x62, 0x18,
+ 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x18, 0x66, 0x72, 0x61,
+ 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x64, 0x69,
+ 0x76, 0x18, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x5f, 0x6d, 0x6f, 0x64, 0x16, 0x66,
  0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
- 0x73, 0x75, 0x62, 0x18, 0x66, 0x72, 0x61, 0x63,
- 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d, 0x75, 0x6c,
- 0x18, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f,
- 0x6e, 0x5f, 0x64, 0x69, 0x76, 0x18, 0x66, 0x72,
- 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d,
- 0x6f, 0x64, 0x16, 0x66, 0x72, 0x61, 0x63, 0x74,
- 0x69, 0x6f, 0x6e, 0x5f, 0x65, 0x71, 0x16, 0x66,
- 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
- 0x6c, 0x74, 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74,
- 0x5f, 0x61, 0x64, 0x64, 0x12, 0x66, 0x6c, 0x6f,
- 0x61, 0x74, 0x5f, 0x73, 0x75, 0x62, 0x12, 0x66,
- 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x6d, 0x75, 0x6c,
- 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x64,
- 0x69, 0x76, 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74,
- 0x5f, 0x6d, 0x6f, 0x64, 0x12, 0x66, 0x6c, 0x6f,
- 0x61, 0x74, 0x5f, 0x70, 0x6f, 0x77, 0x10, 0x66,
- 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x65, 0x71, 0x10,
- 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x6c, 0x74,
- 0x12, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x74,
- 0x61, 0x62, 0x12, 0x67, 0x65, 0x74, 0x5f, 0x63,
- 0x6f, 0x6e, 0x73, 0x74, 0x16, 0x63, 0x6f, 0x6d,
- 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x61, 0x64, 0x64,
+ 0x65, 0x71, 0x16, 0x66, 0x72, 0x61, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x74, 0x12, 0x66,
+ 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x61, 0x64, 0x64,
+ 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x73,
+ 0x75, 0x62, 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x12, 0x66, 0x6c, 0x6f,
+ 0x61, 0x74, 0x5f, 0x64, 0x69, 0x76, 0x12, 0x66,
+ 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x6d, 0x6f, 0x64,
+ 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x70,
+ 0x6f, 0x77, 0x10, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+ 0x5f, 0x65, 0x71, 0x10, 0x66, 0x6c, 0x6f, 0x61,
+ 0x74, 0x5f, 0x6c, 0x74, 0x12, 0x63, 0x6f, 0x6e,
+ 0x73, 0x74, 0x5f, 0x74, 0x61, 0x62, 0x12, 0x67,
+ 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
  0x16, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
- 0x5f, 0x73, 0x75, 0x62, 0x16, 0x63, 0x6f, 0x6d,
- 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x6d, 0x75, 0x6c,
+ 0x5f, 0x61, 0x64, 0x64, 0x16, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x73, 0x75, 0x62,
  0x16, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
- 0x5f, 0x64, 0x69, 0x76, 0x14, 0x63, 0x6f, 0x6d,
- 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x65, 0x71, 0x0e,
- 0x6d, 0x6f, 0x64, 0x5f, 0x61, 0x64, 0x64, 0x0e,
- 0x6d, 0x6f, 0x64, 0x5f, 0x73, 0x75, 0x62, 0x0e,
- 0x6d, 0x6f, 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x0e,
- 0x6d, 0x6f, 0x64, 0x5f, 0x64, 0x69, 0x76, 0x0c,
- 0x6d, 0x6f, 0x64, 0x5f, 0x65, 0x71, 0x28, 0x70,
- 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61,
- 0x6c, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x63, 0x61,
- 0x6c, 0x61, 0x72, 0x22, 0x6e, 0x75, 0x6d, 0x62,
- 0x65, 0x72, 0x5f, 0x6e, 0x65, 0x65, 0x64, 0x5f,
- 0x70, 0x61, 0x72, 0x65, 0x6e, 0x22, 0x6d, 0x6f,
- 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x74,
- 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x26,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x16, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x64, 0x69, 0x76,
+ 0x14, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
+ 0x5f, 0x65, 0x71, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x61, 0x64, 0x64, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x73, 0x75, 0x62, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x6d, 0x75, 0x6c, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x64, 0x69, 0x76, 0x0c, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x65, 0x71, 0x28, 0x70, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x69, 0x73,
+ 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x72, 0x22,
+ 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6e,
+ 0x65, 0x65, 0x64, 0x5f, 0x70, 0x61, 0x72, 0x65,
+ 0x6e, 0x22, 0x6d, 0x6f, 0x6e, 0x6f, 0x6d, 0x69,
+ 0x61, 0x6c, 0x5f, 0x74, 0x6f, 0x53, 0x74, 0x72,
+ 0x69, 0x6e, 0x67, 0x26, 0x70, 0x6f, 0x6c, 0x79,
+ 0x5f, 0x72, 0x6f, 0x6f, 0x74, 0x5f, 0x6c, 0x61,
+ 0x67, 0x75, 0x65, 0x72, 0x72, 0x65, 0x31, 0x14,
  0x70, 0x6f, 0x6c, 0x79, 0x5f, 0x72, 0x6f, 0x6f,
- 0x74, 0x5f, 0x6c, 0x61, 0x67, 0x75, 0x65, 0x72,
- 0x72, 0x65, 0x31, 0x14, 0x70, 0x6f, 0x6c, 0x79,
- 0x5f, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x1c, 0x70,
- 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61,
- 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x1c, 0x70, 0x6f,
- 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c,
- 0x5f, 0x73, 0x75, 0x62, 0x1c, 0x70, 0x6f, 0x6c,
- 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f,
- 0x6d, 0x75, 0x6c, 0x2a, 0x70, 0x6f, 0x6c, 0x79,
- 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x64,
- 0x69, 0x76, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61,
- 0x72, 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f,
- 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x76,
+ 0x74, 0x73, 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x61, 0x64,
+ 0x64, 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f,
+ 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x73, 0x75, 0x62,
  0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d,
- 0x69, 0x61, 0x6c, 0x5f, 0x6d, 0x6f, 0x64, 0x1a,
+ 0x69, 0x61, 0x6c, 0x5f, 0x6d, 0x75, 0x6c, 0x2a,
  0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69,
- 0x61, 0x6c, 0x5f, 0x65, 0x71, 0x16, 0x70, 0x6f,
- 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x61, 0x64,
- 0x64, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
- 0x64, 0x5f, 0x73, 0x75, 0x62, 0x16, 0x70, 0x6f,
- 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x6d, 0x75,
- 0x6c, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
- 0x64, 0x5f, 0x64, 0x69, 0x76, 0x14, 0x70, 0x6f,
- 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x65, 0x71,
+ 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x76, 0x5f, 0x73,
+ 0x63, 0x61, 0x6c, 0x61, 0x72, 0x1c, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c,
+ 0x5f, 0x64, 0x69, 0x76, 0x1c, 0x70, 0x6f, 0x6c,
+ 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f,
+ 0x6d, 0x6f, 0x64, 0x1a, 0x70, 0x6f, 0x6c, 0x79,
+ 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x65,
+ 0x71, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x61, 0x64, 0x64, 0x16, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x73, 0x75,
+ 0x62, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x16, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x64, 0x69,
+ 0x76, 0x14, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x65, 0x71, 0x16, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x61, 0x64, 0x64,
  0x16, 0x72, 0x61, 0x74, 0x66, 0x75, 0x6e, 0x63,
- 0x5f, 0x61, 0x64, 0x64, 0x16, 0x72, 0x61, 0x74,
- 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x73, 0x75, 0x62,
+ 0x5f, 0x73, 0x75, 0x62, 0x16, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x6d, 0x75, 0x6c,
  0x16, 0x72, 0x61, 0x74, 0x66, 0x75, 0x6e, 0x63,
- 0x5f, 0x6d, 0x75, 0x6c, 0x16, 0x72, 0x61, 0x74,
- 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x64, 0x69, 0x76,
- 0x14, 0x72, 0x61, 0x74, 0x66, 0x75, 0x6e, 0x63,
- 0x5f, 0x65, 0x71, 0x10, 0x67, 0x65, 0x74, 0x5f,
- 0x65, 0x6d, 0x69, 0x6e, 0x3c, 0x73, 0x65, 0x72,
- 0x69, 0x65, 0x73, 0x5f, 0x69, 0x73, 0x5f, 0x73,
- 0x63, 0x61, 0x6c, 0x61, 0x72, 0x5f, 0x6f, 0x72,
- 0x5f, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d,
- 0x69, 0x61, 0x6c, 0x14, 0x73, 0x65, 0x72, 0x69,
- 0x65, 0x73, 0x5f, 0x61, 0x64, 0x64, 0x14, 0x73,
- 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x73, 0x75,
- 0x62, 0x14, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73,
- 0x5f, 0x6d, 0x75, 0x6c, 0x14, 0x73, 0x65, 0x72,
- 0x69, 0x65, 0x73, 0x5f, 0x64, 0x69, 0x76, 0x14,
- 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x70,
- 0x6f, 0x77, 0x12, 0x73, 0x65, 0x72, 0x69, 0x65,
- 0x73, 0x5f, 0x65, 0x71, 0x12, 0x61, 0x72, 0x72,
- 0x61, 0x79, 0x5f, 0x61, 0x64, 0x64, 0x12, 0x61,
- 0x72, 0x72, 0x61, 0x79, 0x5f, 0x73, 0x75, 0x62,
- 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x73,
- 0x63, 0x61, 0x6c, 0x61, 0x72, 0x5f, 0x6d, 0x75,
- 0x6c, 0x12, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f,
- 0x6d, 0x75, 0x6c, 0x12, 0x61, 0x72, 0x72, 0x61,
- 0x79, 0x5f, 0x64, 0x69, 0x76, 0x34, 0x61, 0x72,
- 0x72, 0x61, 0x79, 0x5f, 0x65, 0x6c, 0x65, 0x6d,
- 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x69, 0x73, 0x65,
- 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65,
- 0x10, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x65,
- 0x71, 0x1a, 0x61, 0x6c, 0x67, 0x65, 0x62, 0x72,
- 0x61, 0x69, 0x63, 0x4d, 0x6f, 0x64, 0x65, 0x2a,
- 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42, 0x69,
- 0x67, 0x49, 0x6e, 0x74, 0x4f, 0x70, 0x65, 0x72,
- 0x61, 0x74, 0x6f, 0x72, 0x73, 0x02, 0x2f, 0x04,
- 0x2a, 0x2a, 0x12, 0x69, 0x73, 0x49, 0x6e, 0x74,
- 0x65, 0x67, 0x65, 0x72, 0x02, 0x2b, 0x02, 0x2d,
- 0x02, 0x25, 0x04, 0x3d, 0x3d, 0x02, 0x3c, 0x06,
- 0x70, 0x6f, 0x73, 0x06, 0x6e, 0x65, 0x67, 0x08,
- 0x6c, 0x65, 0x66, 0x74, 0x0a, 0x72, 0x69, 0x67,
- 0x68, 0x74, 0x14, 0x74, 0x6f, 0x46, 0x72, 0x61,
- 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x16, 0x74, 0x6f,
- 0x50, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69, 0x76,
- 0x65, 0x0e, 0x69, 0x73, 0x46, 0x6c, 0x6f, 0x61,
- 0x74, 0x02, 0x45, 0x08, 0x4c, 0x4e, 0x31, 0x30,
- 0x0a, 0x4c, 0x4f, 0x47, 0x32, 0x45, 0x0c, 0x4c,
- 0x4f, 0x47, 0x31, 0x30, 0x45, 0x0e, 0x53, 0x51,
- 0x52, 0x54, 0x31, 0x5f, 0x32, 0x0a, 0x53, 0x51,
- 0x52, 0x54, 0x32, 0x12, 0x74, 0x6f, 0x43, 0x6f,
- 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x08, 0x74, 0x72,
- 0x69, 0x6d, 0x06, 0x64, 0x65, 0x67, 0x0c, 0x64,
- 0x69, 0x76, 0x72, 0x65, 0x6d, 0x24, 0x74, 0x6f,
- 0x52, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c,
- 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
- 0x08, 0x7a, 0x65, 0x72, 0x6f, 0x0e, 0x68, 0x69,
- 0x6c, 0x62, 0x65, 0x72, 0x74, 0x18, 0x63, 0x68,
- 0x65, 0x63, 0x6b, 0x5f, 0x73, 0x71, 0x75, 0x61,
- 0x72, 0x65, 0x06, 0x64, 0x75, 0x70, 0x06, 0x6f,
- 0x62, 0x6a, 0x0a, 0x70, 0x72, 0x6f, 0x70, 0x73,
- 0x02, 0x69, 0x06, 0x76, 0x61, 0x6c, 0x08, 0x70,
- 0x72, 0x6f, 0x70, 0x06, 0x74, 0x61, 0x62, 0x08,
- 0x64, 0x65, 0x73, 0x63, 0x0e, 0x52, 0x65, 0x66,
- 0x6c, 0x65, 0x63, 0x74, 0x0a, 0x70, 0x72, 0x6f,
- 0x74, 0x6f, 0x0e, 0x6f, 0x70, 0x5f, 0x6c, 0x69,
- 0x73, 0x74, 0x16, 0x6e, 0x65, 0x77, 0x5f, 0x6f,
- 0x70, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x02, 0x61,
- 0x02, 0x6a, 0x02, 0x62, 0x02, 0x6b, 0x0c, 0x66,
- 0x69, 0x65, 0x6c, 0x64, 0x73, 0x0e, 0x69, 0x73,
- 0x41, 0x72, 0x72, 0x61, 0x79, 0x0c, 0x61, 0x73,
- 0x73, 0x69, 0x67, 0x6e, 0x08, 0x70, 0x75, 0x73,
- 0x68, 0x16, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
- 0x6f, 0x72, 0x53, 0x65, 0x74, 0x0c, 0x63, 0x72,
- 0x65, 0x61, 0x74, 0x65, 0x08, 0x63, 0x61, 0x6c,
- 0x6c, 0x02, 0x72, 0x0c, 0x69, 0x73, 0x5f, 0x6e,
- 0x65, 0x67, 0x12, 0x66, 0x6c, 0x6f, 0x6f, 0x72,
- 0x4c, 0x6f, 0x67, 0x32, 0x5e, 0x6e, 0x65, 0x67,
- 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x6f,
- 0x77, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65,
- 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70,
- 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66,
- 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
- 0x74, 0x79, 0x70, 0x65, 0x02, 0x6e, 0x02, 0x74,
- 0x02, 0x64, 0x02, 0x73, 0x1a, 0x69, 0x73, 0x53,
- 0x61, 0x66, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x67,
- 0x65, 0x72, 0x08, 0x74, 0x64, 0x69, 0x76, 0x02,
- 0x78, 0x02, 0x79, 0x02, 0x71, 0x02, 0x75, 0x02,
- 0x76, 0x02, 0x63, 0x0e, 0x66, 0x64, 0x69, 0x76,
- 0x72, 0x65, 0x6d, 0x1c, 0x6e, 0x6f, 0x74, 0x20,
- 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x69, 0x62,
- 0x6c, 0x65, 0x02, 0x6d, 0x04, 0x6e, 0x31, 0x18,
- 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20,
- 0x74, 0x79, 0x70, 0x65, 0x22, 0x6e, 0x6f, 0x74,
- 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
- 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x69,
- 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x65,
- 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
- 0x64, 0x69, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
- 0x20, 0x62, 0x79, 0x20, 0x7a, 0x65, 0x72, 0x6f,
- 0x06, 0x6e, 0x75, 0x6d, 0x06, 0x64, 0x65, 0x6e,
- 0x04, 0x61, 0x31, 0x04, 0x62, 0x31, 0x08, 0x65,
- 0x64, 0x69, 0x76, 0x0a, 0x69, 0x73, 0x4e, 0x61,
- 0x4e, 0x08, 0x68, 0x69, 0x6e, 0x74, 0x02, 0x70,
- 0x08, 0x70, 0x72, 0x65, 0x63, 0x08, 0x6e, 0x75,
- 0x6d, 0x31, 0x08, 0x6e, 0x75, 0x6d, 0x30, 0x08,
- 0x64, 0x65, 0x6e, 0x31, 0x08, 0x64, 0x65, 0x6e,
- 0x30, 0x30, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64,
- 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
- 0x74, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74,
- 0x65, 0x64, 0x04, 0x72, 0x65, 0x04, 0x69, 0x6d,
- 0x04, 0x2d, 0x49, 0x04, 0x2a, 0x49, 0x32, 0x74,
- 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
- 0x6f, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74,
- 0x20, 0x62, 0x65, 0x20, 0x3c, 0x3d, 0x20, 0x30,
- 0x1a, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64,
- 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x06, 0x72,
- 0x65, 0x73, 0x06, 0x6d, 0x6f, 0x64, 0x48, 0x64,
- 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74,
- 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x6f, 0x20,
- 0x66, 0x6f, 0x72, 0x20, 0x62, 0x69, 0x6e, 0x61,
- 0x72, 0x79, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
- 0x74, 0x6f, 0x72, 0x20, 0x75, 0x6e, 0x73, 0x75,
- 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20,
- 0x74, 0x79, 0x70, 0x65, 0x08, 0x4d, 0x6f, 0x64,
- 0x28, 0x02, 0x2c, 0x02, 0x29, 0x08, 0x73, 0x74,
- 0x72, 0x31, 0x02, 0x28, 0x02, 0x5e, 0x02, 0x7a,
- 0x0c, 0x6d, 0x61, 0x78, 0x5f, 0x69, 0x74, 0x04,
- 0x70, 0x31, 0x04, 0x70, 0x32, 0x04, 0x7a, 0x30,
- 0x04, 0x7a, 0x31, 0x04, 0x7a, 0x32, 0x04, 0x74,
- 0x30, 0x04, 0x74, 0x31, 0x04, 0x64, 0x31, 0x04,
- 0x64, 0x32, 0x02, 0x65, 0x04, 0x65, 0x6c, 0x04,
- 0x7a, 0x6c, 0x06, 0x65, 0x70, 0x73, 0x18, 0x73,
- 0x74, 0x61, 0x72, 0x74, 0x5f, 0x70, 0x6f, 0x69,
- 0x6e, 0x74, 0x73, 0x26, 0x70, 0x6f, 0x6c, 0x79,
- 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x20, 0x65,
- 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3e,
- 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x69, 0x6e,
- 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x66, 0x69,
- 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c,
- 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x06,
- 0x73, 0x74, 0x72, 0x10, 0x49, 0x6e, 0x66, 0x69,
- 0x6e, 0x69, 0x74, 0x79, 0x06, 0x74, 0x6d, 0x70,
- 0x04, 0x6e, 0x32, 0x48, 0x74, 0x68, 0x65, 0x20,
- 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x6f, 0x20, 0x63,
- 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61,
- 0x76, 0x65, 0x20, 0x61, 0x20, 0x64, 0x65, 0x67,
- 0x72, 0x65, 0x65, 0x20, 0x3c, 0x3d, 0x20, 0x30,
- 0x10, 0x50, 0x6f, 0x6c, 0x79, 0x4d, 0x6f, 0x64,
- 0x28, 0x04, 0x2f, 0x28, 0x08, 0x65, 0x6d, 0x69,
- 0x6e, 0x06, 0x6d, 0x69, 0x6e, 0x04, 0x76, 0x31,
- 0x04, 0x76, 0x32, 0x0e, 0x76, 0x32, 0x5f, 0x65,
- 0x6d, 0x69, 0x6e, 0x04, 0x63, 0x31, 0x04, 0x63,
- 0x32, 0x06, 0x73, 0x75, 0x6d, 0x04, 0x4f, 0x28,
- 0x36, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20,
- 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
- 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x28,
- 0x31, 0x2f, 0x58, 0x29, 0x30, 0x6e, 0x65, 0x67,
- 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x65, 0x78,
- 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x69,
- 0x6e, 0x20, 0x65, 0x78, 0x70, 0x5e, 0x6c, 0x6f,
- 0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
- 0x6e, 0x74, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20,
- 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x6e,
- 0x6f, 0x6e, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20,
- 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
- 0x20, 0x74, 0x65, 0x72, 0x6d, 0x0c, 0x45, 0x72,
- 0x72, 0x6f, 0x72, 0x4f, 0x28, 0x69, 0x6e, 0x76,
- 0x61, 0x6c, 0x69, 0x64, 0x20, 0x4f, 0x28, 0x29,
- 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
- 0x74, 0x02, 0x68, 0x02, 0x77, 0x04, 0x72, 0x6c,
- 0x1e, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20,
- 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64,
- 0x1c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x65,
- 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2c,
- 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x6d,
- 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x65, 0x78,
- 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x08, 0x63,
- 0x6f, 0x65, 0x66, 0x06, 0x73, 0x72, 0x63, 0x06,
- 0x64, 0x73, 0x74, 0x30, 0x6d, 0x61, 0x74, 0x72,
- 0x69, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f,
- 0x74, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74,
- 0x69, 0x62, 0x6c, 0x65, 0x02, 0x6c, 0x0e, 0x69,
- 0x6d, 0x5f, 0x63, 0x6f, 0x6c, 0x73, 0x0e, 0x6b,
- 0x65, 0x72, 0x5f, 0x64, 0x69, 0x6d, 0x32, 0x69,
- 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69,
- 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
- 0x79, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
- 0x38, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x73,
- 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x68, 0x61,
- 0x76, 0x65, 0x20, 0x33, 0x20, 0x65, 0x6c, 0x65,
- 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x69, 0x6e,
+ 0x5f, 0x64, 0x69, 0x76, 0x14, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x65, 0x71, 0x10,
+ 0x67, 0x65, 0x74, 0x5f, 0x65, 0x6d, 0x69, 0x6e,
+ 0x3c, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f,
+ 0x69, 0x73, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61,
+ 0x72, 0x5f, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x6c,
+ 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x14,
+ 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x61,
+ 0x64, 0x64, 0x14, 0x73, 0x65, 0x72, 0x69, 0x65,
+ 0x73, 0x5f, 0x73, 0x75, 0x62, 0x14, 0x73, 0x65,
+ 0x72, 0x69, 0x65, 0x73, 0x5f, 0x6d, 0x75, 0x6c,
+ 0x14, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f,
+ 0x64, 0x69, 0x76, 0x14, 0x73, 0x65, 0x72, 0x69,
+ 0x65, 0x73, 0x5f, 0x70, 0x6f, 0x77, 0x12, 0x73,
+ 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x65, 0x71,
+ 0x12, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61,
+ 0x64, 0x64, 0x12, 0x61, 0x72, 0x72, 0x61, 0x79,
+ 0x5f, 0x73, 0x75, 0x62, 0x20, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61,
+ 0x72, 0x5f, 0x6d, 0x75, 0x6c, 0x12, 0x61, 0x72,
+ 0x72, 0x61, 0x79, 0x5f, 0x6d, 0x75, 0x6c, 0x12,
+ 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x69,
+ 0x76, 0x34, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f,
+ 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x5f,
+ 0x77, 0x69, 0x73, 0x65, 0x5f, 0x69, 0x6e, 0x76,
+ 0x65, 0x72, 0x73, 0x65, 0x10, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x5f, 0x65, 0x71, 0x1a, 0x61, 0x6c,
+ 0x67, 0x65, 0x62, 0x72, 0x61, 0x69, 0x63, 0x4d,
+ 0x6f, 0x64, 0x65, 0x2a, 0x75, 0x70, 0x64, 0x61,
+ 0x74, 0x65, 0x42, 0x69, 0x67, 0x49, 0x6e, 0x74,
+ 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
+ 0x73, 0x02, 0x2f, 0x04, 0x2a, 0x2a, 0x12, 0x69,
+ 0x73, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+ 0x02, 0x2b, 0x02, 0x2d, 0x02, 0x25, 0x04, 0x3d,
+ 0x3d, 0x02, 0x3c, 0x06, 0x70, 0x6f, 0x73, 0x06,
+ 0x6e, 0x65, 0x67, 0x08, 0x6c, 0x65, 0x66, 0x74,
+ 0x0a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x14, 0x74,
+ 0x6f, 0x46, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f,
+ 0x6e, 0x16, 0x74, 0x6f, 0x50, 0x72, 0x69, 0x6d,
+ 0x69, 0x74, 0x69, 0x76, 0x65, 0x0e, 0x69, 0x73,
+ 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x02, 0x45, 0x08,
+ 0x4c, 0x4e, 0x31, 0x30, 0x0a, 0x4c, 0x4f, 0x47,
+ 0x32, 0x45, 0x0c, 0x4c, 0x4f, 0x47, 0x31, 0x30,
+ 0x45, 0x0e, 0x53, 0x51, 0x52, 0x54, 0x31, 0x5f,
+ 0x32, 0x0a, 0x53, 0x51, 0x52, 0x54, 0x32, 0x12,
+ 0x74, 0x6f, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65,
+ 0x78, 0x08, 0x74, 0x72, 0x69, 0x6d, 0x06, 0x64,
+ 0x65, 0x67, 0x0c, 0x64, 0x69, 0x76, 0x72, 0x65,
+ 0x6d, 0x24, 0x74, 0x6f, 0x52, 0x61, 0x74, 0x69,
+ 0x6f, 0x6e, 0x61, 0x6c, 0x46, 0x75, 0x6e, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x7a, 0x65, 0x72,
+ 0x6f, 0x0e, 0x68, 0x69, 0x6c, 0x62, 0x65, 0x72,
+ 0x74, 0x18, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f,
+ 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x06, 0x64,
+ 0x75, 0x70, 0x06, 0x6f, 0x62, 0x6a, 0x0a, 0x70,
+ 0x72, 0x6f, 0x70, 0x73, 0x02, 0x69, 0x06, 0x76,
+ 0x61, 0x6c, 0x08, 0x70, 0x72, 0x6f, 0x70, 0x06,
+ 0x74, 0x61, 0x62, 0x08, 0x64, 0x65, 0x73, 0x63,
+ 0x0e, 0x52, 0x65, 0x66, 0x6c, 0x65, 0x63, 0x74,
+ 0x0a, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x0e, 0x6f,
+ 0x70, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x16, 0x6e,
+ 0x65, 0x77, 0x5f, 0x6f, 0x70, 0x5f, 0x6c, 0x69,
+ 0x73, 0x74, 0x02, 0x61, 0x02, 0x6a, 0x02, 0x62,
+ 0x02, 0x6b, 0x0c, 0x66, 0x69, 0x65, 0x6c, 0x64,
+ 0x73, 0x0e, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61,
+ 0x79, 0x0c, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e,
+ 0x08, 0x70, 0x75, 0x73, 0x68, 0x16, 0x6f, 0x70,
+ 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x53, 0x65,
+ 0x74, 0x0c, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+ 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x02, 0x72, 0x0c,
+ 0x69, 0x73, 0x5f, 0x6e, 0x65, 0x67, 0x12, 0x66,
+ 0x6c, 0x6f, 0x6f, 0x72, 0x4c, 0x6f, 0x67, 0x32,
+ 0x5e, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76,
+ 0x65, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73,
+ 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74,
+ 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74,
+ 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74,
+ 0x68, 0x69, 0x73, 0x20, 0x74, 0x79, 0x70, 0x65,
+ 0x02, 0x6e, 0x02, 0x74, 0x02, 0x64, 0x02, 0x73,
+ 0x1a, 0x69, 0x73, 0x53, 0x61, 0x66, 0x65, 0x49,
+ 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x08, 0x74,
+ 0x64, 0x69, 0x76, 0x02, 0x78, 0x02, 0x79, 0x02,
+ 0x71, 0x02, 0x75, 0x02, 0x76, 0x02, 0x63, 0x0e,
+ 0x66, 0x64, 0x69, 0x76, 0x72, 0x65, 0x6d, 0x1c,
+ 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x76, 0x65,
+ 0x72, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x02, 0x6d,
+ 0x04, 0x6e, 0x31, 0x18, 0x69, 0x6e, 0x76, 0x61,
+ 0x6c, 0x69, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65,
+ 0x22, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x63,
+ 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+ 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67,
+ 0x65, 0x72, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63,
+ 0x74, 0x65, 0x64, 0x20, 0x64, 0x69, 0x76, 0x69,
+ 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x79, 0x20,
+ 0x7a, 0x65, 0x72, 0x6f, 0x06, 0x6e, 0x75, 0x6d,
+ 0x06, 0x64, 0x65, 0x6e, 0x04, 0x61, 0x31, 0x04,
+ 0x62, 0x31, 0x08, 0x65, 0x64, 0x69, 0x76, 0x0a,
+ 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x08, 0x68, 0x69,
+ 0x6e, 0x74, 0x02, 0x70, 0x08, 0x70, 0x72, 0x65,
+ 0x63, 0x08, 0x6e, 0x75, 0x6d, 0x31, 0x08, 0x6e,
+ 0x75, 0x6d, 0x30, 0x08, 0x64, 0x65, 0x6e, 0x31,
+ 0x08, 0x64, 0x65, 0x6e, 0x30, 0x30, 0x73, 0x65,
+ 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x67,
+ 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x65, 0x78,
+ 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x04, 0x72,
+ 0x65, 0x04, 0x69, 0x6d, 0x04, 0x2d, 0x49, 0x04,
+ 0x2a, 0x49, 0x32, 0x74, 0x68, 0x65, 0x20, 0x6d,
+ 0x6f, 0x64, 0x75, 0x6c, 0x6f, 0x20, 0x63, 0x61,
+ 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20,
+ 0x3c, 0x3d, 0x20, 0x30, 0x1a, 0x69, 0x6e, 0x76,
+ 0x61, 0x6c, 0x69, 0x64, 0x20, 0x74, 0x79, 0x70,
+ 0x65, 0x73, 0x06, 0x72, 0x65, 0x73, 0x06, 0x6d,
+ 0x6f, 0x64, 0x48, 0x64, 0x69, 0x66, 0x66, 0x65,
+ 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x64,
+ 0x75, 0x6c, 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x20,
+ 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x6f,
+ 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20,
+ 0x75, 0x6e, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+ 0x74, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65,
+ 0x08, 0x4d, 0x6f, 0x64, 0x28, 0x02, 0x2c, 0x02,
+ 0x29, 0x08, 0x73, 0x74, 0x72, 0x31, 0x02, 0x28,
+ 0x02, 0x5e, 0x02, 0x7a, 0x0c, 0x6d, 0x61, 0x78,
+ 0x5f, 0x69, 0x74, 0x04, 0x70, 0x31, 0x04, 0x70,
+ 0x32, 0x04, 0x7a, 0x30, 0x04, 0x7a, 0x31, 0x04,
+ 0x7a, 0x32, 0x04, 0x74, 0x30, 0x04, 0x74, 0x31,
+ 0x04, 0x64, 0x31, 0x04, 0x64, 0x32, 0x02, 0x65,
+ 0x04, 0x65, 0x6c, 0x04, 0x7a, 0x6c, 0x06, 0x65,
+ 0x70, 0x73, 0x18, 0x73, 0x74, 0x61, 0x72, 0x74,
+ 0x5f, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x26,
+ 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69,
+ 0x61, 0x6c, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63,
+ 0x74, 0x65, 0x64, 0x3e, 0x65, 0x72, 0x72, 0x6f,
+ 0x72, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x6f, 0x6f,
+ 0x74, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x69, 0x6e,
+ 0x67, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69,
+ 0x74, 0x68, 0x6d, 0x06, 0x73, 0x74, 0x72, 0x10,
+ 0x49, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79,
+ 0x06, 0x74, 0x6d, 0x70, 0x04, 0x6e, 0x32, 0x48,
+ 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+ 0x6c, 0x6f, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f,
+ 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61,
+ 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20,
+ 0x3c, 0x3d, 0x20, 0x30, 0x10, 0x50, 0x6f, 0x6c,
+ 0x79, 0x4d, 0x6f, 0x64, 0x28, 0x04, 0x2f, 0x28,
+ 0x08, 0x65, 0x6d, 0x69, 0x6e, 0x06, 0x6d, 0x69,
+ 0x6e, 0x04, 0x76, 0x31, 0x04, 0x76, 0x32, 0x0e,
+ 0x76, 0x32, 0x5f, 0x65, 0x6d, 0x69, 0x6e, 0x04,
+ 0x63, 0x31, 0x04, 0x63, 0x32, 0x06, 0x73, 0x75,
+ 0x6d, 0x04, 0x4f, 0x28, 0x36, 0x63, 0x61, 0x6e,
+ 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x70, 0x72,
+ 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e,
+ 0x74, 0x65, 0x67, 0x28, 0x31, 0x2f, 0x58, 0x29,
+ 0x30, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76,
+ 0x65, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+ 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x78,
+ 0x70, 0x5e, 0x6c, 0x6f, 0x67, 0x20, 0x61, 0x72,
+ 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6d,
+ 0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65,
+ 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x7a,
+ 0x65, 0x72, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+ 0x74, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x72,
+ 0x6d, 0x0c, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x4f,
+ 0x28, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64,
+ 0x20, 0x4f, 0x28, 0x29, 0x20, 0x61, 0x72, 0x67,
+ 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x02, 0x68, 0x02,
+ 0x77, 0x04, 0x72, 0x6c, 0x1e, 0x6d, 0x61, 0x74,
+ 0x72, 0x69, 0x78, 0x20, 0x65, 0x78, 0x70, 0x65,
+ 0x63, 0x74, 0x65, 0x64, 0x1c, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63,
+ 0x74, 0x65, 0x64, 0x2c, 0x73, 0x71, 0x75, 0x61,
+ 0x72, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69,
+ 0x78, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74,
+ 0x65, 0x64, 0x08, 0x63, 0x6f, 0x65, 0x66, 0x06,
+ 0x73, 0x72, 0x63, 0x06, 0x64, 0x73, 0x74, 0x30,
+ 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x69,
+ 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e,
+ 0x76, 0x65, 0x72, 0x74, 0x69, 0x62, 0x6c, 0x65,
+ 0x02, 0x6c, 0x0e, 0x69, 0x6d, 0x5f, 0x63, 0x6f,
+ 0x6c, 0x73, 0x0e, 0x6b, 0x65, 0x72, 0x5f, 0x64,
+ 0x69, 0x6d, 0x32, 0x69, 0x6e, 0x63, 0x6f, 0x6d,
+ 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20,
+ 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65,
+ 0x6e, 0x67, 0x74, 0x68, 0x38, 0x76, 0x65, 0x63,
+ 0x74, 0x6f, 0x72, 0x73, 0x20, 0x6d, 0x75, 0x73,
+ 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x33,
+ 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+ 0x73, 0x2e, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x70,
+ 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x61,
+ 0x72, 0x72, 0x61, 0x79, 0x20, 0x73, 0x69, 0x7a,
+ 0x65, 0x0a, 0x61, 0x5f, 0x6d, 0x61, 0x74, 0x0a,
+ 0x62, 0x5f, 0x6d, 0x61, 0x74, 0x30, 0x69, 0x6e,
  0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62,
- 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
- 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x61, 0x5f,
- 0x6d, 0x61, 0x74, 0x0a, 0x62, 0x5f, 0x6d, 0x61,
- 0x74, 0x30, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x70,
- 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x6d,
- 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x73, 0x69,
- 0x7a, 0x65, 0x08, 0x66, 0x64, 0x69, 0x76, 0x08,
- 0x63, 0x64, 0x69, 0x76, 0x0f, 0xc4, 0x03, 0x00,
- 0x00, 0x00, 0x00, 0x0e, 0x00, 0x06, 0x01, 0xa6,
- 0x01, 0x00, 0x01, 0x00, 0x06, 0x45, 0x25, 0xd2,
- 0x03, 0x01, 0x10, 0x00, 0x01, 0x00, 0xc6, 0x03,
- 0x00, 0x01, 0xc8, 0x03, 0x01, 0x01, 0xca, 0x03,
- 0x02, 0x01, 0xcc, 0x03, 0x03, 0x01, 0xce, 0x03,
- 0x04, 0x01, 0xd0, 0x03, 0x05, 0x01, 0xd2, 0x03,
- 0x06, 0x01, 0xd4, 0x03, 0x07, 0x01, 0xd6, 0x03,
- 0x08, 0x01, 0xd8, 0x03, 0x09, 0x01, 0xda, 0x03,
- 0x0a, 0x01, 0xdc, 0x03, 0x0b, 0x01, 0xde, 0x03,
- 0x0c, 0x01, 0xe0, 0x03, 0x0d, 0x01, 0xe2, 0x03,
- 0x0e, 0x01, 0xe4, 0x03, 0x0f, 0x01, 0xe6, 0x03,
- 0x10, 0x01, 0xe8, 0x03, 0x11, 0x01, 0xea, 0x03,
- 0x12, 0x01, 0xec, 0x03, 0x13, 0x01, 0xee, 0x03,
- 0x14, 0x01, 0xf0, 0x03, 0x15, 0x01, 0xf2, 0x03,
- 0x16, 0x01, 0xf4, 0x03, 0x17, 0x01, 0xf6, 0x03,
- 0x18, 0x01, 0xf8, 0x03, 0x19, 0x01, 0xfa, 0x03,
- 0x1a, 0x01, 0xfc, 0x03, 0x1b, 0x01, 0xfe, 0x03,
- 0x1c, 0x01, 0x80, 0x04, 0x1d, 0x01, 0x82, 0x04,
- 0x1e, 0x01, 0x84, 0x04, 0x1f, 0x01, 0x86, 0x04,
- 0x20, 0x01, 0x88, 0x04, 0x21, 0x01, 0x8a, 0x04,
- 0x22, 0x01, 0x8c, 0x04, 0x23, 0x01, 0x8e, 0x04,
- 0x24, 0x01, 0x90, 0x04, 0x25, 0x01, 0x92, 0x04,
- 0x26, 0x01, 0x94, 0x04, 0x27, 0x01, 0x96, 0x04,
- 0x28, 0x01, 0x98, 0x04, 0x29, 0x01, 0x9a, 0x04,
- 0x2a, 0x01, 0x9c, 0x04, 0x2b, 0x01, 0x9e, 0x04,
- 0x2c, 0x01, 0xa0, 0x04, 0x2d, 0x01, 0xa2, 0x04,
- 0x2e, 0x01, 0xa4, 0x04, 0x2f, 0x01, 0xa6, 0x04,
- 0x30, 0x01, 0xa8, 0x04, 0x31, 0x01, 0xaa, 0x04,
- 0x32, 0x01, 0xac, 0x04, 0x33, 0x01, 0xae, 0x04,
- 0x34, 0x01, 0xb0, 0x04, 0x35, 0x01, 0xb2, 0x04,
- 0x36, 0x01, 0xb4, 0x04, 0x37, 0x01, 0xb6, 0x04,
- 0x38, 0x01, 0xb8, 0x04, 0x39, 0x01, 0xba, 0x04,
- 0x3a, 0x01, 0xbc, 0x04, 0x3b, 0x01, 0xbe, 0x04,
- 0x3c, 0x01, 0xc0, 0x04, 0x3d, 0x01, 0xc2, 0x04,
- 0x3e, 0x01, 0xc4, 0x04, 0x3f, 0x01, 0xc6, 0x04,
- 0x40, 0x01, 0xc8, 0x04, 0x41, 0x01, 0xca, 0x04,
- 0x42, 0x01, 0xcc, 0x04, 0x43, 0x01, 0xce, 0x04,
- 0x44, 0x01, 0x08, 0xc9, 0x08, 0x69, 0xb4, 0x00,
- 0x00, 0x00, 0xc0, 0x02, 0x5f, 0x15, 0x00, 0xc0,
- 0x03, 0x5f, 0x16, 0x00, 0xc0, 0x04, 0x5f, 0x17,
- 0x00, 0xc0, 0x05, 0x5f, 0x18, 0x00, 0xc0, 0x06,
- 0x5f, 0x19, 0x00, 0xc0, 0x07, 0x5f, 0x1a, 0x00,
- 0xc0, 0x08, 0x5f, 0x1b, 0x00, 0xc0, 0x09, 0x5f,
- 0x1c, 0x00, 0xc0, 0x0a, 0x5f, 0x1d, 0x00, 0xc0,
- 0x0b, 0x5f, 0x1e, 0x00, 0xc0, 0x0c, 0x5f, 0x1f,
- 0x00, 0xc0, 0x0d, 0x5f, 0x20, 0x00, 0xc0, 0x0e,
- 0x5f, 0x21, 0x00, 0xc0, 0x0f, 0x5f, 0x22, 0x00,
- 0xc0, 0x10, 0x5f, 0x23, 0x00, 0xc0, 0x11, 0x5f,
- 0x24, 0x00, 0xc0, 0x12, 0x5f, 0x25, 0x00, 0xc0,
- 0x13, 0x5f, 0x26, 0x00, 0xc0, 0x14, 0x5f, 0x27,
- 0x00, 0xc0, 0x15, 0x5f, 0x28, 0x00, 0xc0, 0x16,
- 0x5f, 0x29, 0x00, 0xc0, 0x17, 0x5f, 0x2a, 0x00,
- 0xc0, 0x18, 0x5f, 0x2b, 0x00, 0xc0, 0x19, 0x5f,
- 0x2c, 0x00, 0xc0, 0x1a, 0x5f, 0x2d, 0x00, 0xc0,
- 0x1b, 0x5f, 0x2e, 0x00, 0xc0, 0x1c, 0x5f, 0x2f,
- 0x00, 0xc0, 0x1d, 0x5f, 0x30, 0x00, 0xc0, 0x1e,
- 0x5f, 0x31, 0x00, 0xc0, 0x1f, 0x5f, 0x32, 0x00,
- 0xc0, 0x20, 0x5f, 0x33, 0x00, 0xc0, 0x21, 0x5f,
- 0x34, 0x00, 0xc0, 0x22, 0x5f, 0x35, 0x00, 0xc0,
- 0x23, 0x5f, 0x36, 0x00, 0xc0, 0x24, 0x5f, 0x37,
- 0x00, 0x29, 0xc0, 0x00, 0xc5, 0xef, 0x0e, 0xe0,
- 0xb5, 0xb6, 0xf0, 0x5f, 0x0a, 0x00, 0x5e, 0x05,
- 0x00, 0xb5, 0xb6, 0x26, 0x02, 0x00, 0xef, 0x5f,
- 0x0b, 0x00, 0x5e, 0x08, 0x00, 0x41, 0xef, 0x00,
- 0x00, 0x00, 0x5f, 0x0c, 0x00, 0x38, 0x95, 0x00,
- 0x00, 0x00, 0x42, 0x68, 0x00, 0x00, 0x00, 0xc5,
- 0x04, 0x28, 0x01, 0x00, 0x00, 0x0b, 0xc0, 0x01,
- 0x4d, 0x44, 0x00, 0x00, 0x00, 0x4c, 0x44, 0x00,
- 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e, 0xdd, 0x41,
- 0xf0, 0x00, 0x00, 0x00, 0x5f, 0x0d, 0x00, 0xdd,
- 0x41, 0xf1, 0x00, 0x00, 0x00, 0x5f, 0x0e, 0x00,
- 0xdd, 0x41, 0xf2, 0x00, 0x00, 0x00, 0x5f, 0x0f,
- 0x00, 0xdd, 0x41, 0xf3, 0x00, 0x00, 0x00, 0x5f,
- 0x10, 0x00, 0xdd, 0x41, 0xf4, 0x00, 0x00, 0x00,
- 0x5f, 0x11, 0x00, 0xdd, 0x41, 0xf5, 0x00, 0x00,
- 0x00, 0x5f, 0x12, 0x00, 0xdd, 0x41, 0x29, 0x01,
- 0x00, 0x00, 0x5f, 0x13, 0x00, 0xdd, 0x41, 0x2a,
- 0x01, 0x00, 0x00, 0x5f, 0x14, 0x00, 0x5e, 0x09,
- 0x00, 0x41, 0x1b, 0x01, 0x00, 0x00, 0x5f, 0x38,
- 0x00, 0x5e, 0x09, 0x00, 0x41, 0x1c, 0x01, 0x00,
- 0x00, 0x5f, 0x39, 0x00, 0x5e, 0x09, 0x00, 0x41,
- 0x1d, 0x01, 0x00, 0x00, 0x5f, 0x3a, 0x00, 0x5e,
- 0x09, 0x00, 0x41, 0x1e, 0x01, 0x00, 0x00, 0x5f,
- 0x3b, 0x00, 0x5e, 0x09, 0x00, 0x41, 0x1f, 0x01,
- 0x00, 0x00, 0x5f, 0x3c, 0x00, 0x5e, 0x09, 0x00,
- 0x41, 0x20, 0x01, 0x00, 0x00, 0x5f, 0x3d, 0x00,
- 0x5e, 0x09, 0x00, 0x41, 0x21, 0x01, 0x00, 0x00,
- 0x5f, 0x3e, 0x00, 0x5e, 0x09, 0x00, 0x41, 0x22,
- 0x01, 0x00, 0x00, 0x5f, 0x3f, 0x00, 0x5e, 0x09,
- 0x00, 0x41, 0x23, 0x01, 0x00, 0x00, 0x5f, 0x40,
- 0x00, 0x5e, 0x09, 0x00, 0x41, 0x24, 0x01, 0x00,
- 0x00, 0x5f, 0x41, 0x00, 0x5e, 0x09, 0x00, 0x41,
- 0x25, 0x01, 0x00, 0x00, 0x5f, 0x42, 0x00, 0x5e,
- 0x05, 0x00, 0x41, 0x2b, 0x01, 0x00, 0x00, 0x5f,
- 0x43, 0x00, 0xde, 0x41, 0x27, 0x01, 0x00, 0x00,
- 0x5f, 0x44, 0x00, 0x29, 0xc4, 0x03, 0x01, 0x22,
- 0x0b, 0x00, 0xb6, 0x01, 0x9c, 0x25, 0x1e, 0x26,
- 0x3f, 0x3b, 0xaa, 0x30, 0x30, 0x30, 0x30, 0x30,
- 0x30, 0x30, 0x00, 0x09, 0xea, 0x03, 0x3a, 0x3a,
- 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
- 0x3b, 0x3a, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01,
- 0x46, 0x01, 0x20, 0x18, 0xcd, 0x01, 0x83, 0x1b,
- 0x47, 0xe2, 0x01, 0x00, 0x01, 0x40, 0xd8, 0x04,
- 0x00, 0x00, 0x00, 0xda, 0x04, 0x00, 0x01, 0x00,
- 0xdc, 0x04, 0x00, 0x02, 0x40, 0xde, 0x04, 0x00,
- 0x03, 0x40, 0xe0, 0x04, 0x00, 0x04, 0x40, 0xe2,
- 0x04, 0x00, 0x05, 0x40, 0xe4, 0x04, 0x00, 0x06,
- 0x00, 0xe6, 0x04, 0x00, 0x07, 0x00, 0xe8, 0x04,
- 0x00, 0x08, 0x00, 0xea, 0x04, 0x00, 0x09, 0x00,
- 0xec, 0x04, 0x00, 0x0a, 0x00, 0xee, 0x04, 0x00,
- 0x0b, 0x00, 0xf0, 0x04, 0x00, 0x0c, 0x00, 0xf2,
- 0x04, 0x00, 0x0d, 0x00, 0xf4, 0x04, 0x00, 0x0e,
- 0x00, 0xf6, 0x04, 0x00, 0x0f, 0x00, 0xf8, 0x04,
- 0x00, 0x10, 0x00, 0xfa, 0x04, 0x00, 0x11, 0x00,
- 0xfc, 0x04, 0x00, 0x12, 0x00, 0xfe, 0x04, 0x00,
- 0x13, 0x00, 0x80, 0x05, 0x00, 0x14, 0x00, 0x82,
- 0x05, 0x00, 0x15, 0x40, 0x84, 0x05, 0x00, 0x16,
- 0x40, 0x86, 0x05, 0x00, 0x17, 0x00, 0x88, 0x05,
- 0x00, 0x18, 0x00, 0x8a, 0x05, 0x00, 0x19, 0x00,
- 0x8c, 0x05, 0x00, 0x1a, 0x00, 0x8e, 0x05, 0x00,
- 0x1b, 0x00, 0x90, 0x05, 0x00, 0x1c, 0x00, 0x92,
- 0x05, 0x00, 0x1d, 0x00, 0x94, 0x05, 0x00, 0x1e,
- 0x40, 0x96, 0x05, 0x00, 0x1f, 0x00, 0x98, 0x05,
- 0x00, 0x20, 0x00, 0x9a, 0x05, 0x00, 0x21, 0x40,
- 0x9c, 0x05, 0x00, 0x22, 0x40, 0x9e, 0x05, 0x00,
- 0x23, 0x40, 0xa0, 0x05, 0x00, 0x24, 0x40, 0xa2,
- 0x05, 0x00, 0x25, 0x40, 0xa4, 0x05, 0x00, 0x26,
- 0x40, 0xa6, 0x05, 0x00, 0x27, 0x00, 0xa8, 0x05,
- 0x00, 0x28, 0x00, 0xaa, 0x05, 0x00, 0x29, 0x00,
- 0xac, 0x05, 0x00, 0x2a, 0x00, 0xae, 0x05, 0x00,
- 0x2b, 0x00, 0xb0, 0x05, 0x00, 0x2c, 0x00, 0xb2,
- 0x05, 0x00, 0x2d, 0x40, 0xb4, 0x05, 0x00, 0x2e,
- 0x00, 0xb6, 0x05, 0x00, 0x2f, 0x40, 0xb8, 0x05,
- 0x00, 0x30, 0x00, 0xba, 0x05, 0x00, 0x31, 0x00,
- 0xbc, 0x05, 0x00, 0x32, 0x00, 0xbe, 0x05, 0x00,
- 0x33, 0x00, 0xc0, 0x05, 0x00, 0x34, 0x00, 0xc2,
- 0x05, 0x00, 0x35, 0x00, 0xc4, 0x05, 0x00, 0x36,
- 0x00, 0xc6, 0x05, 0x00, 0x37, 0x40, 0xc8, 0x05,
- 0x00, 0x38, 0x40, 0xca, 0x05, 0x00, 0x39, 0x40,
- 0xcc, 0x05, 0x00, 0x3a, 0x00, 0xce, 0x05, 0x00,
- 0x3b, 0x40, 0xd0, 0x05, 0x00, 0x3c, 0x00, 0xd2,
- 0x05, 0x00, 0x3d, 0x00, 0xd4, 0x05, 0x00, 0x3e,
- 0x00, 0xd6, 0x05, 0x00, 0x3f, 0x00, 0xd8, 0x05,
- 0x00, 0x40, 0x00, 0xda, 0x05, 0x00, 0x41, 0x40,
- 0xdc, 0x05, 0x00, 0x42, 0x40, 0xde, 0x05, 0x00,
- 0x43, 0x00, 0xe0, 0x05, 0x00, 0x44, 0x40, 0xe2,
- 0x05, 0x00, 0x45, 0x00, 0xc6, 0x03, 0x00, 0x00,
- 0x86, 0x04, 0x20, 0x00, 0x88, 0x04, 0x21, 0x00,
- 0xd0, 0x03, 0x05, 0x00, 0xd6, 0x03, 0x08, 0x00,
- 0xb6, 0x04, 0x38, 0x00, 0xd8, 0x03, 0x09, 0x00,
- 0xca, 0x03, 0x02, 0x00, 0xc8, 0x03, 0x01, 0x00,
- 0xf6, 0x03, 0x18, 0x00, 0xcc, 0x03, 0x03, 0x00,
- 0xf4, 0x03, 0x17, 0x00, 0x94, 0x04, 0x27, 0x00,
- 0x92, 0x04, 0x26, 0x00, 0x9e, 0x04, 0x2c, 0x00,
- 0xce, 0x03, 0x04, 0x00, 0x84, 0x04, 0x1f, 0x00,
- 0xdc, 0x03, 0x0b, 0x00, 0xd4, 0x03, 0x07, 0x00,
- 0xd2, 0x03, 0x06, 0x00, 0xe2, 0x03, 0x0e, 0x00,
- 0xf2, 0x03, 0x16, 0x00, 0xf0, 0x03, 0x15, 0x00,
- 0xbc, 0x04, 0x3b, 0x00, 0xc0, 0x00, 0xc9, 0xc0,
- 0x01, 0xca, 0xc0, 0x02, 0xcb, 0xc0, 0x03, 0xc3,
- 0x04, 0xc0, 0x04, 0xc3, 0x05, 0xc0, 0x18, 0xc3,
- 0x06, 0xc0, 0x19, 0xc3, 0x07, 0xc0, 0x1a, 0xc3,
- 0x08, 0xc0, 0x1b, 0xc3, 0x09, 0xc0, 0x1c, 0xc3,
- 0x0a, 0xc0, 0x1d, 0xc3, 0x0b, 0xc0, 0x1e, 0xc3,
- 0x0c, 0xc0, 0x1f, 0xc3, 0x0d, 0xc0, 0x20, 0xc3,
- 0x0e, 0xc0, 0x21, 0xc3, 0x0f, 0xc0, 0x22, 0xc3,
- 0x10, 0xc0, 0x23, 0xc3, 0x11, 0xc0, 0x24, 0xc3,
- 0x12, 0xc0, 0x25, 0xc3, 0x13, 0xc0, 0x26, 0xc3,
- 0x14, 0xc0, 0x3a, 0xc3, 0x16, 0xc0, 0x4b, 0xc3,
- 0x17, 0xc0, 0x4c, 0xc3, 0x18, 0xc0, 0x4d, 0xc3,
- 0x19, 0xc0, 0x4e, 0xc3, 0x1a, 0xc0, 0x4f, 0xc3,
- 0x1b, 0xc0, 0x5c, 0xc3, 0x1c, 0xc0, 0x5d, 0xc3,
- 0x1d, 0xc0, 0x5e, 0xc3, 0x1e, 0xc0, 0x5f, 0xc3,
- 0x1f, 0xc0, 0x60, 0xc3, 0x20, 0xc0, 0x65, 0xc3,
- 0x21, 0xc0, 0x67, 0xc3, 0x22, 0xc0, 0x68, 0xc3,
- 0x23, 0xc0, 0x69, 0xc3, 0x24, 0xc0, 0x6a, 0xc3,
- 0x25, 0xc0, 0x74, 0xc3, 0x26, 0xc0, 0x75, 0xc3,
- 0x27, 0xc0, 0x76, 0xc3, 0x28, 0xc0, 0x77, 0xc3,
- 0x29, 0xc0, 0x78, 0xc3, 0x2a, 0xc0, 0x79, 0xc3,
- 0x2b, 0xc0, 0x7a, 0xc3, 0x2c, 0xc0, 0x82, 0xc3,
- 0x2d, 0xc0, 0x83, 0xc3, 0x2e, 0xc0, 0x84, 0xc3,
- 0x2f, 0xc0, 0x85, 0xc3, 0x30, 0xc0, 0x86, 0xc3,
- 0x31, 0xc0, 0x91, 0xc3, 0x32, 0xc0, 0x92, 0xc3,
- 0x33, 0xc0, 0x93, 0xc3, 0x34, 0xc0, 0x94, 0xc3,
- 0x35, 0xc0, 0x95, 0xc3, 0x36, 0xc0, 0x99, 0xc3,
- 0x37, 0xc0, 0x9a, 0xc3, 0x38, 0xc0, 0x9c, 0xc3,
- 0x39, 0xc0, 0x9d, 0xc3, 0x3a, 0xc0, 0x9e, 0xc3,
- 0x3b, 0xc0, 0x9f, 0xc3, 0x3c, 0xc0, 0xa0, 0xc3,
- 0x3d, 0xc0, 0xa1, 0xc3, 0x3e, 0xc0, 0xbe, 0xc3,
- 0x3f, 0xc0, 0xbf, 0xc3, 0x40, 0xc0, 0xc0, 0xc3,
- 0x41, 0xc0, 0xc1, 0xc3, 0x42, 0xc0, 0xc2, 0xc3,
- 0x43, 0xc0, 0xc3, 0xc3, 0x44, 0xc0, 0xc4, 0xc3,
- 0x45, 0xd1, 0xd1, 0x41, 0xb2, 0x00, 0x00, 0x00,
- 0x43, 0xe3, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0x41,
- 0xb3, 0x00, 0x00, 0x00, 0x43, 0xe4, 0x00, 0x00,
- 0x00, 0xd1, 0x0a, 0x43, 0x72, 0x01, 0x00, 0x00,
- 0xb7, 0xb8, 0xba, 0xbc, 0xbd, 0x0b, 0xbd, 0x0d,
- 0xbd, 0x11, 0xbd, 0x13, 0xbd, 0x17, 0xbd, 0x1d,
- 0xbd, 0x1f, 0xbd, 0x25, 0xbd, 0x29, 0xbd, 0x2b,
- 0xbd, 0x2f, 0xbd, 0x35, 0xbd, 0x3b, 0xbd, 0x3d,
- 0xbd, 0x43, 0xbd, 0x47, 0xbd, 0x49, 0xbd, 0x4f,
- 0xbd, 0x53, 0xbd, 0x59, 0xbd, 0x61, 0xbd, 0x65,
- 0xbd, 0x67, 0xbd, 0x6b, 0xbd, 0x6d, 0xbd, 0x71,
- 0xbd, 0x7f, 0xbe, 0x83, 0x00, 0x26, 0x20, 0x00,
- 0xbe, 0x89, 0x00, 0x4c, 0x20, 0x00, 0x00, 0x80,
- 0xbe, 0x8b, 0x00, 0x4c, 0x21, 0x00, 0x00, 0x80,
- 0xbe, 0x95, 0x00, 0x4c, 0x22, 0x00, 0x00, 0x80,
- 0xbe, 0x97, 0x00, 0x4c, 0x23, 0x00, 0x00, 0x80,
- 0xbe, 0x9d, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x80,
- 0xbe, 0xa3, 0x00, 0x4c, 0x25, 0x00, 0x00, 0x80,
- 0xbe, 0xa7, 0x00, 0x4c, 0x26, 0x00, 0x00, 0x80,
- 0xbe, 0xad, 0x00, 0x4c, 0x27, 0x00, 0x00, 0x80,
- 0xbe, 0xb3, 0x00, 0x4c, 0x28, 0x00, 0x00, 0x80,
- 0xbe, 0xb5, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x80,
- 0xbe, 0xbf, 0x00, 0x4c, 0x2a, 0x00, 0x00, 0x80,
- 0xbe, 0xc1, 0x00, 0x4c, 0x2b, 0x00, 0x00, 0x80,
- 0xbe, 0xc5, 0x00, 0x4c, 0x2c, 0x00, 0x00, 0x80,
- 0xbe, 0xc7, 0x00, 0x4c, 0x2d, 0x00, 0x00, 0x80,
- 0xbe, 0xd3, 0x00, 0x4c, 0x2e, 0x00, 0x00, 0x80,
- 0xbe, 0xdf, 0x00, 0x4c, 0x2f, 0x00, 0x00, 0x80,
- 0xbe, 0xe3, 0x00, 0x4c, 0x30, 0x00, 0x00, 0x80,
- 0xbe, 0xe5, 0x00, 0x4c, 0x31, 0x00, 0x00, 0x80,
- 0xbe, 0xe9, 0x00, 0x4c, 0x32, 0x00, 0x00, 0x80,
- 0xbe, 0xef, 0x00, 0x4c, 0x33, 0x00, 0x00, 0x80,
- 0xbe, 0xf1, 0x00, 0x4c, 0x34, 0x00, 0x00, 0x80,
- 0xbe, 0xfb, 0x00, 0x4c, 0x35, 0x00, 0x00, 0x80,
- 0xbe, 0x01, 0x01, 0x4c, 0x36, 0x00, 0x00, 0x80,
- 0xbe, 0x07, 0x01, 0x4c, 0x37, 0x00, 0x00, 0x80,
- 0xbe, 0x0d, 0x01, 0x4c, 0x38, 0x00, 0x00, 0x80,
- 0xbe, 0x0f, 0x01, 0x4c, 0x39, 0x00, 0x00, 0x80,
- 0xbe, 0x15, 0x01, 0x4c, 0x3a, 0x00, 0x00, 0x80,
- 0xbe, 0x19, 0x01, 0x4c, 0x3b, 0x00, 0x00, 0x80,
- 0xbe, 0x1b, 0x01, 0x4c, 0x3c, 0x00, 0x00, 0x80,
- 0xbe, 0x25, 0x01, 0x4c, 0x3d, 0x00, 0x00, 0x80,
- 0xbe, 0x33, 0x01, 0x4c, 0x3e, 0x00, 0x00, 0x80,
- 0xbe, 0x37, 0x01, 0x4c, 0x3f, 0x00, 0x00, 0x80,
- 0xbe, 0x39, 0x01, 0x4c, 0x40, 0x00, 0x00, 0x80,
- 0xbe, 0x3d, 0x01, 0x4c, 0x41, 0x00, 0x00, 0x80,
- 0xbe, 0x4b, 0x01, 0x4c, 0x42, 0x00, 0x00, 0x80,
- 0xbe, 0x51, 0x01, 0x4c, 0x43, 0x00, 0x00, 0x80,
- 0xbe, 0x5b, 0x01, 0x4c, 0x44, 0x00, 0x00, 0x80,
- 0xbe, 0x5d, 0x01, 0x4c, 0x45, 0x00, 0x00, 0x80,
- 0xbe, 0x61, 0x01, 0x4c, 0x46, 0x00, 0x00, 0x80,
- 0xbe, 0x67, 0x01, 0x4c, 0x47, 0x00, 0x00, 0x80,
- 0xbe, 0x6f, 0x01, 0x4c, 0x48, 0x00, 0x00, 0x80,
- 0xbe, 0x75, 0x01, 0x4c, 0x49, 0x00, 0x00, 0x80,
- 0xbe, 0x7b, 0x01, 0x4c, 0x4a, 0x00, 0x00, 0x80,
- 0xbe, 0x7f, 0x01, 0x4c, 0x4b, 0x00, 0x00, 0x80,
- 0xbe, 0x85, 0x01, 0x4c, 0x4c, 0x00, 0x00, 0x80,
- 0xbe, 0x8d, 0x01, 0x4c, 0x4d, 0x00, 0x00, 0x80,
- 0xbe, 0x91, 0x01, 0x4c, 0x4e, 0x00, 0x00, 0x80,
- 0xbe, 0x99, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x80,
- 0xbe, 0xa3, 0x01, 0x4c, 0x50, 0x00, 0x00, 0x80,
- 0xbe, 0xa5, 0x01, 0x4c, 0x51, 0x00, 0x00, 0x80,
- 0xbe, 0xaf, 0x01, 0x4c, 0x52, 0x00, 0x00, 0x80,
- 0xbe, 0xb1, 0x01, 0x4c, 0x53, 0x00, 0x00, 0x80,
- 0xbe, 0xb7, 0x01, 0x4c, 0x54, 0x00, 0x00, 0x80,
- 0xbe, 0xbb, 0x01, 0x4c, 0x55, 0x00, 0x00, 0x80,
- 0xbe, 0xc1, 0x01, 0x4c, 0x56, 0x00, 0x00, 0x80,
- 0xbe, 0xc9, 0x01, 0x4c, 0x57, 0x00, 0x00, 0x80,
- 0xbe, 0xcd, 0x01, 0x4c, 0x58, 0x00, 0x00, 0x80,
- 0xbe, 0xcf, 0x01, 0x4c, 0x59, 0x00, 0x00, 0x80,
- 0xbe, 0xd3, 0x01, 0x4c, 0x5a, 0x00, 0x00, 0x80,
- 0xbe, 0xdf, 0x01, 0x4c, 0x5b, 0x00, 0x00, 0x80,
- 0xbe, 0xe7, 0x01, 0x4c, 0x5c, 0x00, 0x00, 0x80,
- 0xbe, 0xeb, 0x01, 0x4c, 0x5d, 0x00, 0x00, 0x80,
- 0xbe, 0xf3, 0x01, 0x4c, 0x5e, 0x00, 0x00, 0x80,
- 0xcc, 0x38, 0xb7, 0x00, 0x00, 0x00, 0x42, 0x73,
- 0x01, 0x00, 0x00, 0x0b, 0xc0, 0x05, 0x54, 0x74,
- 0x01, 0x00, 0x00, 0x04, 0xc0, 0x06, 0x54, 0x75,
- 0x01, 0x00, 0x00, 0x04, 0x24, 0x01, 0x00, 0x0e,
- 0xc5, 0xdd, 0x0b, 0xc0, 0x07, 0x54, 0x76, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x08, 0x54, 0xf0, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x09, 0x54, 0xf1, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x0a, 0x54, 0xf2, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x0b, 0x54, 0xf4, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x0c, 0x54, 0xf3, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x0d, 0x54, 0x29, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x0e, 0x54, 0x2a, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x0f, 0x54, 0xf5, 0x00,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc5, 0xdd, 0x41,
- 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x10, 0x54,
- 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x11, 0x54,
- 0xfa, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x12, 0x54,
- 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x13, 0x54,
- 0xfc, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x14, 0x54,
- 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x15, 0x54,
- 0x03, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x16, 0x54,
- 0x04, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc0,
- 0x17, 0x5f, 0x07, 0x00, 0xc6, 0x5e, 0x07, 0x00,
- 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x06,
- 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc2, 0x07, 0x4c,
- 0x78, 0x01, 0x00, 0x00, 0xc2, 0x08, 0x4c, 0x80,
- 0x00, 0x00, 0x00, 0xc2, 0x09, 0x4c, 0x74, 0x01,
- 0x00, 0x00, 0xc2, 0x0a, 0x4c, 0x79, 0x01, 0x00,
- 0x00, 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc2,
- 0x0b, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x0c,
- 0x4c, 0x7b, 0x01, 0x00, 0x00, 0xc0, 0x27, 0x54,
- 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x28, 0x54,
- 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x98,
- 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00,
- 0x26, 0x02, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00,
- 0x38, 0x98, 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00,
- 0x00, 0x00, 0x26, 0x02, 0x00, 0x4c, 0x7f, 0x01,
- 0x00, 0x00, 0xc2, 0x06, 0x4c, 0x77, 0x01, 0x00,
- 0x00, 0xc2, 0x07, 0x4c, 0x78, 0x01, 0x00, 0x00,
- 0xc2, 0x08, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
- 0x09, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc2, 0x0a,
- 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0x75,
- 0x01, 0x00, 0x00, 0xc2, 0x0b, 0x4c, 0x7a, 0x01,
- 0x00, 0x00, 0xc2, 0x0c, 0x4c, 0x7b, 0x01, 0x00,
- 0x00, 0x0b, 0x5e, 0x08, 0x00, 0x4c, 0x7e, 0x01,
- 0x00, 0x00, 0x5e, 0x08, 0x00, 0x4c, 0x7f, 0x01,
- 0x00, 0x00, 0xc2, 0x0d, 0x4c, 0x77, 0x01, 0x00,
- 0x00, 0xc2, 0x0e, 0x4c, 0x78, 0x01, 0x00, 0x00,
- 0xc2, 0x0f, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
- 0x10, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc2, 0x11,
- 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc2, 0x12, 0x4c,
- 0x75, 0x01, 0x00, 0x00, 0xc2, 0x13, 0x4c, 0x7a,
- 0x01, 0x00, 0x00, 0xc2, 0x14, 0x4c, 0x7b, 0x01,
- 0x00, 0x00, 0x22, 0x04, 0x00, 0x0e, 0xc5, 0x5e,
- 0x07, 0x00, 0x0b, 0xc0, 0x29, 0x54, 0x80, 0x01,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc5, 0x5e, 0x07,
- 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0x38,
- 0x9b, 0x00, 0x00, 0x00, 0x41, 0x81, 0x01, 0x00,
- 0x00, 0xc0, 0x2a, 0x55, 0x04, 0xc0, 0x2b, 0x54,
- 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x2c, 0x54,
- 0x3a, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x2d, 0x54,
- 0xfa, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x2e, 0x54,
- 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x2f, 0x54,
- 0xfc, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x30, 0x54,
- 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x31, 0x54,
- 0x03, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x32, 0x54,
- 0x04, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc5,
- 0x38, 0x98, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc0, 0x33, 0x54, 0xfe, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x34, 0x54, 0xfa, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x35, 0x54, 0xfb, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x36, 0x54, 0xfc, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x37, 0x54, 0xfd, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x38, 0x54, 0x03, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x39, 0x54, 0x04, 0x01,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0x26, 0x00, 0x00,
- 0xc3, 0x15, 0xc5, 0x5e, 0x08, 0x00, 0x0b, 0xc0,
- 0x3b, 0x54, 0x82, 0x01, 0x00, 0x00, 0x04, 0xc0,
- 0x3c, 0x54, 0x27, 0x01, 0x00, 0x00, 0x04, 0xc0,
- 0x3d, 0x54, 0x83, 0x01, 0x00, 0x00, 0x05, 0xc0,
- 0x3e, 0x54, 0x84, 0x01, 0x00, 0x00, 0x05, 0xc0,
- 0x3f, 0x54, 0x85, 0x01, 0x00, 0x00, 0x05, 0xc0,
- 0x40, 0x54, 0x86, 0x01, 0x00, 0x00, 0x05, 0xc0,
- 0x41, 0x54, 0x87, 0x01, 0x00, 0x00, 0x05, 0xc0,
- 0x42, 0x54, 0x88, 0x01, 0x00, 0x00, 0x05, 0xf0,
- 0x0e, 0xc5, 0x5e, 0x08, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc0, 0x43, 0x54, 0xfe, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x44, 0x54, 0xfa, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x45, 0x54, 0xfb, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x46, 0x54, 0xfc, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x47, 0x54, 0xfd, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x48, 0x54, 0x03, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x49, 0x54, 0x04, 0x01,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc0, 0x4a, 0x5f,
- 0x0a, 0x00, 0xc6, 0x5e, 0x0a, 0x00, 0x41, 0x3e,
- 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x17, 0x4c, 0x77,
- 0x01, 0x00, 0x00, 0xc2, 0x18, 0x4c, 0x78, 0x01,
+ 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69,
+ 0x78, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x08, 0x66,
+ 0x64, 0x69, 0x76, 0x08, 0x63, 0x64, 0x69, 0x76,
+ 0x0e, 0x00, 0x06, 0x05, 0xa6, 0x01, 0x00, 0x02,
+ 0x00, 0x06, 0x00, 0x25, 0x97, 0x0b, 0xca, 0x03,
+ 0x01, 0x2c, 0x02, 0xa8, 0x01, 0x00, 0x00, 0x00,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xca, 0x3f, 0xe6,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xe8, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xea,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xeb, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xed, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xee,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xef, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf2,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xf4, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf6,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfa,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfb, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xfd, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xfe,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xff, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0x00, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x01, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x02,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x03, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x04, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x05, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x06,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x07, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x08, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x09, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0a,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0b, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x0c, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x0d, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0e,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0f, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x10, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x11, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x12,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x13, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x14, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x15, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x16,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x17, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x18, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x19, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x1a,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x1b, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x1c, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x1d, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x1e,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x20, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x21, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x22,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x23, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x24, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x25, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x26,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x27, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x28, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x29, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x2a,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0xe6, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xe7, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe9,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xea, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xeb, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xec, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xed,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xef, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf1,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xf3, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf5,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf6, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xf7, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf9,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfa, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x02, 0x40, 0xfb, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x03, 0x40, 0xfc, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x04, 0x40, 0xfd, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x05, 0x40, 0xfe, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x06, 0x40, 0xff, 0x00, 0x00,
+ 0x00, 0x00, 0xc0, 0x07, 0x40, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x08, 0x40, 0x01, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x09, 0x40, 0x02, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0a, 0x40, 0x03, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0b, 0x40, 0x04, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0c, 0x40, 0x05, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0d, 0x40, 0x06, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0e, 0x40, 0x07, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x0f, 0x40, 0x08, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x10, 0x40, 0x09, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x11, 0x40, 0x0a, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x12, 0x40, 0x0b, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x13, 0x40, 0x0c, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x14, 0x40, 0x0d, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x15, 0x40, 0x0e, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x16, 0x40, 0x0f, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x17, 0x40, 0x10, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x18, 0x40, 0x11, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x19, 0x40, 0x12, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1a, 0x40, 0x13, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1b, 0x40, 0x14, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1c, 0x40, 0x15, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1d, 0x40, 0x16, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1e, 0x40, 0x17, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x1f, 0x40, 0x18, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x20, 0x40, 0x19, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x21, 0x40, 0x1a, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x22, 0x40, 0x1b, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x23, 0x40, 0x1c, 0x01, 0x00,
+ 0x00, 0x00, 0xc0, 0x24, 0x40, 0x1d, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x1e, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x20,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x21, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x22, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x23, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x24,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x25, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x26, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x27, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x28,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x29, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x2a, 0x01, 0x00, 0x00, 0x00,
+ 0x04, 0x2b, 0x01, 0x00, 0x00, 0xc9, 0x04, 0x2c,
+ 0x01, 0x00, 0x00, 0xc9, 0xc0, 0x00, 0xc6, 0xef,
+ 0xc9, 0x36, 0xf0, 0x00, 0x00, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0xb5, 0xb6, 0xf0, 0x3b, 0xf0,
+ 0x00, 0x00, 0x00, 0x36, 0xf1, 0x00, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0x26,
+ 0x02, 0x00, 0xef, 0x3b, 0xf1, 0x00, 0x00, 0x00,
+ 0x36, 0xf2, 0x00, 0x00, 0x00, 0x38, 0xee, 0x00,
+ 0x00, 0x00, 0x41, 0xf2, 0x00, 0x00, 0x00, 0x3b,
+ 0xf2, 0x00, 0x00, 0x00, 0x38, 0x98, 0x00, 0x00,
+ 0x00, 0x42, 0x68, 0x00, 0x00, 0x00, 0xc6, 0x04,
+ 0x2d, 0x01, 0x00, 0x00, 0x0b, 0xc0, 0x01, 0x4d,
+ 0x44, 0x00, 0x00, 0x00, 0x4c, 0x44, 0x00, 0x00,
+ 0x00, 0x24, 0x03, 0x00, 0xc9, 0x36, 0xf3, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x41,
+ 0xf3, 0x00, 0x00, 0x00, 0x3b, 0xf3, 0x00, 0x00,
+ 0x00, 0x36, 0xf4, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x41, 0xf4, 0x00, 0x00, 0x00,
+ 0x3b, 0xf4, 0x00, 0x00, 0x00, 0x36, 0xf5, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x41,
+ 0xf5, 0x00, 0x00, 0x00, 0x3b, 0xf5, 0x00, 0x00,
+ 0x00, 0x36, 0xf6, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x41, 0xf6, 0x00, 0x00, 0x00,
+ 0x3b, 0xf6, 0x00, 0x00, 0x00, 0x36, 0xf7, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x41,
+ 0xf7, 0x00, 0x00, 0x00, 0x3b, 0xf7, 0x00, 0x00,
+ 0x00, 0x36, 0xf8, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x41, 0xf8, 0x00, 0x00, 0x00,
+ 0x3b, 0xf8, 0x00, 0x00, 0x00, 0x36, 0xf9, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x41,
+ 0x2e, 0x01, 0x00, 0x00, 0x3b, 0xf9, 0x00, 0x00,
+ 0x00, 0x36, 0xfa, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x41, 0x2f, 0x01, 0x00, 0x00,
+ 0x3b, 0xfa, 0x00, 0x00, 0x00, 0x36, 0x1e, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x1e, 0x01, 0x00, 0x00, 0x3b, 0x1e, 0x01, 0x00,
+ 0x00, 0x36, 0x1f, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x41, 0x1f, 0x01, 0x00, 0x00,
+ 0x3b, 0x1f, 0x01, 0x00, 0x00, 0x36, 0x20, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x20, 0x01, 0x00, 0x00, 0x3b, 0x20, 0x01, 0x00,
+ 0x00, 0x36, 0x21, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x41, 0x21, 0x01, 0x00, 0x00,
+ 0x3b, 0x21, 0x01, 0x00, 0x00, 0x36, 0x22, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x22, 0x01, 0x00, 0x00, 0x3b, 0x22, 0x01, 0x00,
+ 0x00, 0x36, 0x23, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x41, 0x23, 0x01, 0x00, 0x00,
+ 0x3b, 0x23, 0x01, 0x00, 0x00, 0x36, 0x24, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x24, 0x01, 0x00, 0x00, 0x3b, 0x24, 0x01, 0x00,
+ 0x00, 0x36, 0x25, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x41, 0x25, 0x01, 0x00, 0x00,
+ 0x3b, 0x25, 0x01, 0x00, 0x00, 0x36, 0x26, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x26, 0x01, 0x00, 0x00, 0x3b, 0x26, 0x01, 0x00,
+ 0x00, 0x36, 0x27, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x41, 0x27, 0x01, 0x00, 0x00,
+ 0x3b, 0x27, 0x01, 0x00, 0x00, 0x36, 0x28, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x41,
+ 0x28, 0x01, 0x00, 0x00, 0x3b, 0x28, 0x01, 0x00,
+ 0x00, 0x36, 0x29, 0x01, 0x00, 0x00, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0x41, 0x30, 0x01, 0x00, 0x00,
+ 0x3b, 0x29, 0x01, 0x00, 0x00, 0x36, 0x2a, 0x01,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x41,
+ 0x2a, 0x01, 0x00, 0x00, 0x3b, 0x2a, 0x01, 0x00,
+ 0x00, 0xc5, 0x28, 0x00, 0xa0, 0x03, 0x01, 0x00,
+ 0xe4, 0x03, 0x02, 0x00, 0x05, 0x2e, 0x21, 0x00,
+ 0x01, 0xea, 0x24, 0x1e, 0x5d, 0x6c, 0x68, 0xaa,
+ 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x00,
+ 0x14, 0xea, 0x03, 0x67, 0x67, 0x67, 0x67, 0x67,
+ 0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x67, 0x0e,
+ 0x43, 0x26, 0x05, 0x00, 0x01, 0x46, 0x01, 0x20,
+ 0x00, 0xcd, 0x01, 0x8b, 0x1d, 0xca, 0x03, 0x1d,
+ 0xb7, 0x04, 0x47, 0xe2, 0x01, 0x00, 0x01, 0x40,
+ 0xe2, 0x04, 0x00, 0x00, 0x00, 0xe4, 0x04, 0x00,
+ 0x01, 0x00, 0xe6, 0x04, 0x00, 0x02, 0x40, 0xe8,
+ 0x04, 0x00, 0x03, 0x40, 0xea, 0x04, 0x00, 0x04,
+ 0x40, 0xec, 0x04, 0x00, 0x05, 0x40, 0xee, 0x04,
+ 0x00, 0x06, 0x00, 0xf0, 0x04, 0x00, 0x07, 0x00,
+ 0xf2, 0x04, 0x00, 0x08, 0x00, 0xf4, 0x04, 0x00,
+ 0x09, 0x00, 0xf6, 0x04, 0x00, 0x0a, 0x00, 0xf8,
+ 0x04, 0x00, 0x0b, 0x00, 0xfa, 0x04, 0x00, 0x0c,
+ 0x00, 0xfc, 0x04, 0x00, 0x0d, 0x00, 0xfe, 0x04,
+ 0x00, 0x0e, 0x00, 0x80, 0x05, 0x00, 0x0f, 0x00,
+ 0x82, 0x05, 0x00, 0x10, 0x00, 0x84, 0x05, 0x00,
+ 0x11, 0x00, 0x86, 0x05, 0x00, 0x12, 0x00, 0x88,
+ 0x05, 0x00, 0x13, 0x00, 0x8a, 0x05, 0x00, 0x14,
+ 0x00, 0x8c, 0x05, 0x00, 0x15, 0x40, 0x8e, 0x05,
+ 0x00, 0x16, 0x40, 0x90, 0x05, 0x00, 0x17, 0x00,
+ 0x92, 0x05, 0x00, 0x18, 0x00, 0x94, 0x05, 0x00,
+ 0x19, 0x00, 0x96, 0x05, 0x00, 0x1a, 0x00, 0x98,
+ 0x05, 0x00, 0x1b, 0x00, 0x9a, 0x05, 0x00, 0x1c,
+ 0x00, 0x9c, 0x05, 0x00, 0x1d, 0x00, 0x9e, 0x05,
+ 0x00, 0x1e, 0x40, 0xa0, 0x05, 0x00, 0x1f, 0x00,
+ 0xa2, 0x05, 0x00, 0x20, 0x00, 0xa4, 0x05, 0x00,
+ 0x21, 0x40, 0xa6, 0x05, 0x00, 0x22, 0x40, 0xa8,
+ 0x05, 0x00, 0x23, 0x40, 0xaa, 0x05, 0x00, 0x24,
+ 0x40, 0xac, 0x05, 0x00, 0x25, 0x40, 0xae, 0x05,
+ 0x00, 0x26, 0x40, 0xb0, 0x05, 0x00, 0x27, 0x00,
+ 0xb2, 0x05, 0x00, 0x28, 0x00, 0xb4, 0x05, 0x00,
+ 0x29, 0x00, 0xb6, 0x05, 0x00, 0x2a, 0x00, 0xb8,
+ 0x05, 0x00, 0x2b, 0x00, 0xba, 0x05, 0x00, 0x2c,
+ 0x00, 0xbc, 0x05, 0x00, 0x2d, 0x40, 0xbe, 0x05,
+ 0x00, 0x2e, 0x00, 0xc0, 0x05, 0x00, 0x2f, 0x40,
+ 0xc2, 0x05, 0x00, 0x30, 0x00, 0xc4, 0x05, 0x00,
+ 0x31, 0x00, 0xc6, 0x05, 0x00, 0x32, 0x00, 0xc8,
+ 0x05, 0x00, 0x33, 0x00, 0xca, 0x05, 0x00, 0x34,
+ 0x00, 0xcc, 0x05, 0x00, 0x35, 0x00, 0xce, 0x05,
+ 0x00, 0x36, 0x00, 0xd0, 0x05, 0x00, 0x37, 0x40,
+ 0xd2, 0x05, 0x00, 0x38, 0x40, 0xd4, 0x05, 0x00,
+ 0x39, 0x40, 0xd6, 0x05, 0x00, 0x3a, 0x00, 0xd8,
+ 0x05, 0x00, 0x3b, 0x40, 0xda, 0x05, 0x00, 0x3c,
+ 0x00, 0xdc, 0x05, 0x00, 0x3d, 0x00, 0xde, 0x05,
+ 0x00, 0x3e, 0x00, 0xe0, 0x05, 0x00, 0x3f, 0x00,
+ 0xe2, 0x05, 0x00, 0x40, 0x00, 0xe4, 0x05, 0x00,
+ 0x41, 0x40, 0xe6, 0x05, 0x00, 0x42, 0x40, 0xe8,
+ 0x05, 0x00, 0x43, 0x00, 0xea, 0x05, 0x00, 0x44,
+ 0x40, 0xec, 0x05, 0x00, 0x45, 0x00, 0xc0, 0x00,
+ 0xc9, 0xc0, 0x01, 0xca, 0xc0, 0x02, 0xcb, 0xc0,
+ 0x03, 0xc3, 0x04, 0xc0, 0x04, 0xc3, 0x05, 0xc0,
+ 0x18, 0xc3, 0x06, 0xc0, 0x19, 0xc3, 0x07, 0xc0,
+ 0x1a, 0xc3, 0x08, 0xc0, 0x1b, 0xc3, 0x09, 0xc0,
+ 0x1c, 0xc3, 0x0a, 0xc0, 0x1d, 0xc3, 0x0b, 0xc0,
+ 0x1e, 0xc3, 0x0c, 0xc0, 0x1f, 0xc3, 0x0d, 0xc0,
+ 0x20, 0xc3, 0x0e, 0xc0, 0x21, 0xc3, 0x0f, 0xc0,
+ 0x22, 0xc3, 0x10, 0xc0, 0x23, 0xc3, 0x11, 0xc0,
+ 0x24, 0xc3, 0x12, 0xc0, 0x25, 0xc3, 0x13, 0xc0,
+ 0x26, 0xc3, 0x14, 0xc0, 0x3a, 0xc3, 0x16, 0xc0,
+ 0x4b, 0xc3, 0x17, 0xc0, 0x4c, 0xc3, 0x18, 0xc0,
+ 0x4d, 0xc3, 0x19, 0xc0, 0x4e, 0xc3, 0x1a, 0xc0,
+ 0x4f, 0xc3, 0x1b, 0xc0, 0x5c, 0xc3, 0x1c, 0xc0,
+ 0x5d, 0xc3, 0x1d, 0xc0, 0x5e, 0xc3, 0x1e, 0xc0,
+ 0x5f, 0xc3, 0x1f, 0xc0, 0x60, 0xc3, 0x20, 0xc0,
+ 0x65, 0xc3, 0x21, 0xc0, 0x67, 0xc3, 0x22, 0xc0,
+ 0x68, 0xc3, 0x23, 0xc0, 0x69, 0xc3, 0x24, 0xc0,
+ 0x6a, 0xc3, 0x25, 0xc0, 0x74, 0xc3, 0x26, 0xc0,
+ 0x75, 0xc3, 0x27, 0xc0, 0x76, 0xc3, 0x28, 0xc0,
+ 0x77, 0xc3, 0x29, 0xc0, 0x78, 0xc3, 0x2a, 0xc0,
+ 0x79, 0xc3, 0x2b, 0xc0, 0x7a, 0xc3, 0x2c, 0xc0,
+ 0x82, 0xc3, 0x2d, 0xc0, 0x83, 0xc3, 0x2e, 0xc0,
+ 0x84, 0xc3, 0x2f, 0xc0, 0x85, 0xc3, 0x30, 0xc0,
+ 0x86, 0xc3, 0x31, 0xc0, 0x91, 0xc3, 0x32, 0xc0,
+ 0x92, 0xc3, 0x33, 0xc0, 0x93, 0xc3, 0x34, 0xc0,
+ 0x94, 0xc3, 0x35, 0xc0, 0x95, 0xc3, 0x36, 0xc0,
+ 0x99, 0xc3, 0x37, 0xc0, 0x9a, 0xc3, 0x38, 0xc0,
+ 0x9c, 0xc3, 0x39, 0xc0, 0x9d, 0xc3, 0x3a, 0xc0,
+ 0x9e, 0xc3, 0x3b, 0xc0, 0x9f, 0xc3, 0x3c, 0xc0,
+ 0xa0, 0xc3, 0x3d, 0xc0, 0xa1, 0xc3, 0x3e, 0xc0,
+ 0xbe, 0xc3, 0x3f, 0xc0, 0xbf, 0xc3, 0x40, 0xc0,
+ 0xc0, 0xc3, 0x41, 0xc0, 0xc1, 0xc3, 0x42, 0xc0,
+ 0xc2, 0xc3, 0x43, 0xc0, 0xc3, 0xc3, 0x44, 0xc0,
+ 0xc4, 0xc3, 0x45, 0xd1, 0xd1, 0x41, 0xb5, 0x00,
+ 0x00, 0x00, 0x43, 0xe6, 0x00, 0x00, 0x00, 0xd1,
+ 0xd1, 0x41, 0xb6, 0x00, 0x00, 0x00, 0x43, 0xe7,
+ 0x00, 0x00, 0x00, 0xd1, 0x0a, 0x43, 0x77, 0x01,
+ 0x00, 0x00, 0xb7, 0xb8, 0xba, 0xbc, 0xbd, 0x0b,
+ 0xbd, 0x0d, 0xbd, 0x11, 0xbd, 0x13, 0xbd, 0x17,
+ 0xbd, 0x1d, 0xbd, 0x1f, 0xbd, 0x25, 0xbd, 0x29,
+ 0xbd, 0x2b, 0xbd, 0x2f, 0xbd, 0x35, 0xbd, 0x3b,
+ 0xbd, 0x3d, 0xbd, 0x43, 0xbd, 0x47, 0xbd, 0x49,
+ 0xbd, 0x4f, 0xbd, 0x53, 0xbd, 0x59, 0xbd, 0x61,
+ 0xbd, 0x65, 0xbd, 0x67, 0xbd, 0x6b, 0xbd, 0x6d,
+ 0xbd, 0x71, 0xbd, 0x7f, 0xbe, 0x83, 0x00, 0x26,
+ 0x20, 0x00, 0xbe, 0x89, 0x00, 0x4c, 0x20, 0x00,
+ 0x00, 0x80, 0xbe, 0x8b, 0x00, 0x4c, 0x21, 0x00,
+ 0x00, 0x80, 0xbe, 0x95, 0x00, 0x4c, 0x22, 0x00,
+ 0x00, 0x80, 0xbe, 0x97, 0x00, 0x4c, 0x23, 0x00,
+ 0x00, 0x80, 0xbe, 0x9d, 0x00, 0x4c, 0x24, 0x00,
+ 0x00, 0x80, 0xbe, 0xa3, 0x00, 0x4c, 0x25, 0x00,
+ 0x00, 0x80, 0xbe, 0xa7, 0x00, 0x4c, 0x26, 0x00,
+ 0x00, 0x80, 0xbe, 0xad, 0x00, 0x4c, 0x27, 0x00,
+ 0x00, 0x80, 0xbe, 0xb3, 0x00, 0x4c, 0x28, 0x00,
+ 0x00, 0x80, 0xbe, 0xb5, 0x00, 0x4c, 0x29, 0x00,
+ 0x00, 0x80, 0xbe, 0xbf, 0x00, 0x4c, 0x2a, 0x00,
+ 0x00, 0x80, 0xbe, 0xc1, 0x00, 0x4c, 0x2b, 0x00,
+ 0x00, 0x80, 0xbe, 0xc5, 0x00, 0x4c, 0x2c, 0x00,
+ 0x00, 0x80, 0xbe, 0xc7, 0x00, 0x4c, 0x2d, 0x00,
+ 0x00, 0x80, 0xbe, 0xd3, 0x00, 0x4c, 0x2e, 0x00,
+ 0x00, 0x80, 0xbe, 0xdf, 0x00, 0x4c, 0x2f, 0x00,
+ 0x00, 0x80, 0xbe, 0xe3, 0x00, 0x4c, 0x30, 0x00,
+ 0x00, 0x80, 0xbe, 0xe5, 0x00, 0x4c, 0x31, 0x00,
+ 0x00, 0x80, 0xbe, 0xe9, 0x00, 0x4c, 0x32, 0x00,
+ 0x00, 0x80, 0xbe, 0xef, 0x00, 0x4c, 0x33, 0x00,
+ 0x00, 0x80, 0xbe, 0xf1, 0x00, 0x4c, 0x34, 0x00,
+ 0x00, 0x80, 0xbe, 0xfb, 0x00, 0x4c, 0x35, 0x00,
+ 0x00, 0x80, 0xbe, 0x01, 0x01, 0x4c, 0x36, 0x00,
+ 0x00, 0x80, 0xbe, 0x07, 0x01, 0x4c, 0x37, 0x00,
+ 0x00, 0x80, 0xbe, 0x0d, 0x01, 0x4c, 0x38, 0x00,
+ 0x00, 0x80, 0xbe, 0x0f, 0x01, 0x4c, 0x39, 0x00,
+ 0x00, 0x80, 0xbe, 0x15, 0x01, 0x4c, 0x3a, 0x00,
+ 0x00, 0x80, 0xbe, 0x19, 0x01, 0x4c, 0x3b, 0x00,
+ 0x00, 0x80, 0xbe, 0x1b, 0x01, 0x4c, 0x3c, 0x00,
+ 0x00, 0x80, 0xbe, 0x25, 0x01, 0x4c, 0x3d, 0x00,
+ 0x00, 0x80, 0xbe, 0x33, 0x01, 0x4c, 0x3e, 0x00,
+ 0x00, 0x80, 0xbe, 0x37, 0x01, 0x4c, 0x3f, 0x00,
+ 0x00, 0x80, 0xbe, 0x39, 0x01, 0x4c, 0x40, 0x00,
+ 0x00, 0x80, 0xbe, 0x3d, 0x01, 0x4c, 0x41, 0x00,
+ 0x00, 0x80, 0xbe, 0x4b, 0x01, 0x4c, 0x42, 0x00,
+ 0x00, 0x80, 0xbe, 0x51, 0x01, 0x4c, 0x43, 0x00,
+ 0x00, 0x80, 0xbe, 0x5b, 0x01, 0x4c, 0x44, 0x00,
+ 0x00, 0x80, 0xbe, 0x5d, 0x01, 0x4c, 0x45, 0x00,
+ 0x00, 0x80, 0xbe, 0x61, 0x01, 0x4c, 0x46, 0x00,
+ 0x00, 0x80, 0xbe, 0x67, 0x01, 0x4c, 0x47, 0x00,
+ 0x00, 0x80, 0xbe, 0x6f, 0x01, 0x4c, 0x48, 0x00,
+ 0x00, 0x80, 0xbe, 0x75, 0x01, 0x4c, 0x49, 0x00,
+ 0x00, 0x80, 0xbe, 0x7b, 0x01, 0x4c, 0x4a, 0x00,
+ 0x00, 0x80, 0xbe, 0x7f, 0x01, 0x4c, 0x4b, 0x00,
+ 0x00, 0x80, 0xbe, 0x85, 0x01, 0x4c, 0x4c, 0x00,
+ 0x00, 0x80, 0xbe, 0x8d, 0x01, 0x4c, 0x4d, 0x00,
+ 0x00, 0x80, 0xbe, 0x91, 0x01, 0x4c, 0x4e, 0x00,
+ 0x00, 0x80, 0xbe, 0x99, 0x01, 0x4c, 0x4f, 0x00,
+ 0x00, 0x80, 0xbe, 0xa3, 0x01, 0x4c, 0x50, 0x00,
+ 0x00, 0x80, 0xbe, 0xa5, 0x01, 0x4c, 0x51, 0x00,
+ 0x00, 0x80, 0xbe, 0xaf, 0x01, 0x4c, 0x52, 0x00,
+ 0x00, 0x80, 0xbe, 0xb1, 0x01, 0x4c, 0x53, 0x00,
+ 0x00, 0x80, 0xbe, 0xb7, 0x01, 0x4c, 0x54, 0x00,
+ 0x00, 0x80, 0xbe, 0xbb, 0x01, 0x4c, 0x55, 0x00,
+ 0x00, 0x80, 0xbe, 0xc1, 0x01, 0x4c, 0x56, 0x00,
+ 0x00, 0x80, 0xbe, 0xc9, 0x01, 0x4c, 0x57, 0x00,
+ 0x00, 0x80, 0xbe, 0xcd, 0x01, 0x4c, 0x58, 0x00,
+ 0x00, 0x80, 0xbe, 0xcf, 0x01, 0x4c, 0x59, 0x00,
+ 0x00, 0x80, 0xbe, 0xd3, 0x01, 0x4c, 0x5a, 0x00,
+ 0x00, 0x80, 0xbe, 0xdf, 0x01, 0x4c, 0x5b, 0x00,
+ 0x00, 0x80, 0xbe, 0xe7, 0x01, 0x4c, 0x5c, 0x00,
+ 0x00, 0x80, 0xbe, 0xeb, 0x01, 0x4c, 0x5d, 0x00,
+ 0x00, 0x80, 0xbe, 0xf3, 0x01, 0x4c, 0x5e, 0x00,
+ 0x00, 0x80, 0xcc, 0x38, 0xba, 0x00, 0x00, 0x00,
+ 0x42, 0x78, 0x01, 0x00, 0x00, 0x0b, 0xc0, 0x05,
+ 0x54, 0x79, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x06,
+ 0x54, 0x7a, 0x01, 0x00, 0x00, 0x04, 0x24, 0x01,
+ 0x00, 0x0e, 0xc5, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x0b, 0xc0, 0x07, 0x54, 0x7b, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0x08, 0x54, 0xf3, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0x09, 0x54, 0xf4, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0x0a, 0x54, 0xf5, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0x0b, 0x54, 0xf7, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0x0c, 0x54, 0xf6, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0x0d, 0x54, 0x2e, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0x0e, 0x54, 0x2f, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0x0f, 0x54, 0xf8, 0x00, 0x00, 0x00,
+ 0x04, 0xf0, 0x0e, 0xc5, 0x38, 0xe6, 0x00, 0x00,
+ 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc0,
+ 0x10, 0x54, 0x01, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0x11, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc0,
+ 0x12, 0x54, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0,
+ 0x13, 0x54, 0xff, 0x00, 0x00, 0x00, 0x04, 0xc0,
+ 0x14, 0x54, 0x00, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0x15, 0x54, 0x06, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0x16, 0x54, 0x07, 0x01, 0x00, 0x00, 0x04, 0xf0,
+ 0x0e, 0x36, 0xe8, 0x00, 0x00, 0x00, 0xc0, 0x17,
+ 0x3b, 0xe8, 0x00, 0x00, 0x00, 0xc6, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00,
+ 0x0b, 0xc2, 0x06, 0x4c, 0x7c, 0x01, 0x00, 0x00,
+ 0xc2, 0x07, 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc2,
+ 0x08, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x09,
+ 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc2, 0x0a, 0x4c,
+ 0x7e, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0x7a, 0x01,
+ 0x00, 0x00, 0xc2, 0x0b, 0x4c, 0x7f, 0x01, 0x00,
+ 0x00, 0xc2, 0x0c, 0x4c, 0x80, 0x01, 0x00, 0x00,
+ 0xc0, 0x27, 0x54, 0x81, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0x28, 0x54, 0x82, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38, 0xb5,
+ 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x4c, 0x83,
+ 0x01, 0x00, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00,
+ 0x38, 0xb5, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00,
+ 0x4c, 0x84, 0x01, 0x00, 0x00, 0xc2, 0x06, 0x4c,
+ 0x7c, 0x01, 0x00, 0x00, 0xc2, 0x07, 0x4c, 0x7d,
+ 0x01, 0x00, 0x00, 0xc2, 0x08, 0x4c, 0x80, 0x00,
+ 0x00, 0x00, 0xc2, 0x09, 0x4c, 0x79, 0x01, 0x00,
+ 0x00, 0xc2, 0x0a, 0x4c, 0x7e, 0x01, 0x00, 0x00,
+ 0xc7, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x0b,
+ 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc2, 0x0c, 0x4c,
+ 0x80, 0x01, 0x00, 0x00, 0x0b, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x4c, 0x83, 0x01, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x4c, 0x84, 0x01, 0x00,
+ 0x00, 0xc2, 0x0d, 0x4c, 0x7c, 0x01, 0x00, 0x00,
+ 0xc2, 0x0e, 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc2,
+ 0x0f, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x10,
+ 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc2, 0x11, 0x4c,
+ 0x7e, 0x01, 0x00, 0x00, 0xc2, 0x12, 0x4c, 0x7a,
+ 0x01, 0x00, 0x00, 0xc2, 0x13, 0x4c, 0x7f, 0x01,
+ 0x00, 0x00, 0xc2, 0x14, 0x4c, 0x80, 0x01, 0x00,
+ 0x00, 0x22, 0x04, 0x00, 0x0e, 0xc5, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x29, 0x54, 0x85,
+ 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc5, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0x38, 0x9e, 0x00, 0x00, 0x00, 0x41,
+ 0x86, 0x01, 0x00, 0x00, 0xc0, 0x2a, 0x55, 0x04,
+ 0xc0, 0x2b, 0x54, 0x01, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0x2c, 0x54, 0x3a, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x2d, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x2e, 0x54, 0xfe, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x2f, 0x54, 0xff, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x30, 0x54, 0x00, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0x31, 0x54, 0x06, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0x32, 0x54, 0x07, 0x01, 0x00, 0x00, 0x04,
+ 0xf0, 0x0e, 0xc5, 0x38, 0x9b, 0x00, 0x00, 0x00,
+ 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x33,
+ 0x54, 0x01, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x34,
+ 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x35,
+ 0x54, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x36,
+ 0x54, 0xff, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x37,
+ 0x54, 0x00, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x38,
+ 0x54, 0x06, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x39,
+ 0x54, 0x07, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e,
+ 0x26, 0x00, 0x00, 0xc3, 0x15, 0xc5, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x3b, 0x54, 0x87,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x3c, 0x54, 0x2a,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x3d, 0x54, 0x88,
+ 0x01, 0x00, 0x00, 0x05, 0xc0, 0x3e, 0x54, 0x89,
+ 0x01, 0x00, 0x00, 0x05, 0xc0, 0x3f, 0x54, 0x8a,
+ 0x01, 0x00, 0x00, 0x05, 0xc0, 0x40, 0x54, 0x8b,
+ 0x01, 0x00, 0x00, 0x05, 0xc0, 0x41, 0x54, 0x8c,
+ 0x01, 0x00, 0x00, 0x05, 0xc0, 0x42, 0x54, 0x8d,
+ 0x01, 0x00, 0x00, 0x05, 0xf0, 0x0e, 0xc5, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc0, 0x43, 0x54, 0x01, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0x44, 0x54, 0xfd, 0x00, 0x00,
+ 0x00, 0x04, 0xc0, 0x45, 0x54, 0xfe, 0x00, 0x00,
+ 0x00, 0x04, 0xc0, 0x46, 0x54, 0xff, 0x00, 0x00,
+ 0x00, 0x04, 0xc0, 0x47, 0x54, 0x00, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0x48, 0x54, 0x06, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0x49, 0x54, 0x07, 0x01, 0x00,
+ 0x00, 0x04, 0xf0, 0x0e, 0x36, 0xe9, 0x00, 0x00,
+ 0x00, 0xc0, 0x4a, 0x3b, 0xe9, 0x00, 0x00, 0x00,
+ 0xc6, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x41, 0x3e,
+ 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x17, 0x4c, 0x7c,
+ 0x01, 0x00, 0x00, 0xc2, 0x18, 0x4c, 0x7d, 0x01,
  0x00, 0x00, 0xc2, 0x19, 0x4c, 0x80, 0x00, 0x00,
- 0x00, 0xc2, 0x1a, 0x4c, 0x74, 0x01, 0x00, 0x00,
- 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc2, 0x1b,
- 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc0, 0x50, 0x54,
- 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x51, 0x54,
- 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x98,
- 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00,
- 0x5e, 0x08, 0x00, 0x5e, 0x07, 0x00, 0x26, 0x04,
- 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0x38, 0x98,
- 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00,
- 0x5e, 0x08, 0x00, 0x5e, 0x07, 0x00, 0x26, 0x04,
- 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc2, 0x17,
- 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc2, 0x18, 0x4c,
- 0x78, 0x01, 0x00, 0x00, 0xc2, 0x19, 0x4c, 0x80,
- 0x00, 0x00, 0x00, 0xc2, 0x1a, 0x4c, 0x74, 0x01,
- 0x00, 0x00, 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00,
- 0xc2, 0x1b, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xf1,
- 0x0e, 0xc5, 0x5e, 0x0a, 0x00, 0x0b, 0xc0, 0x52,
- 0x54, 0x89, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e,
- 0xc5, 0x5e, 0x0a, 0x00, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x0b, 0xc0, 0x53, 0x54, 0xfe, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x54, 0x54, 0x3a, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x55, 0x54, 0xfa, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x56, 0x54, 0xfb, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x57, 0x54, 0xfc, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x58, 0x54, 0xfd, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0x59, 0x54, 0x03, 0x01, 0x00,
- 0x00, 0x04, 0xc0, 0x5a, 0x54, 0x04, 0x01, 0x00,
- 0x00, 0x04, 0xf0, 0x0e, 0xc0, 0x5b, 0x5f, 0x0f,
- 0x00, 0xc6, 0x5e, 0x0f, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc2, 0x1c, 0x4c, 0x77, 0x01,
- 0x00, 0x00, 0xc2, 0x1d, 0x4c, 0x78, 0x01, 0x00,
- 0x00, 0xc2, 0x1e, 0x4c, 0x80, 0x00, 0x00, 0x00,
- 0xc2, 0x1f, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc7,
- 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc2, 0x20, 0x4c,
- 0x7a, 0x01, 0x00, 0x00, 0xc0, 0x61, 0x54, 0x7c,
- 0x01, 0x00, 0x00, 0x04, 0xc0, 0x62, 0x54, 0x7d,
- 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e,
- 0x08, 0x00, 0x5e, 0x07, 0x00, 0x26, 0x04, 0x00,
- 0x4c, 0x7e, 0x01, 0x00, 0x00, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e,
- 0x08, 0x00, 0x5e, 0x07, 0x00, 0x26, 0x04, 0x00,
- 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc2, 0x1c, 0x4c,
- 0x77, 0x01, 0x00, 0x00, 0xc2, 0x1d, 0x4c, 0x78,
- 0x01, 0x00, 0x00, 0xc2, 0x1e, 0x4c, 0x80, 0x00,
- 0x00, 0x00, 0xc2, 0x1f, 0x4c, 0x74, 0x01, 0x00,
- 0x00, 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xf1,
- 0x0e, 0xc5, 0x5e, 0x0f, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc0, 0x63, 0x54, 0xfe, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x64, 0x54, 0x3a, 0x00,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc0, 0x66, 0xe4,
- 0xc5, 0xe0, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b,
- 0xc0, 0x6b, 0x54, 0x8a, 0x01, 0x00, 0x00, 0x04,
- 0xc0, 0x6c, 0x54, 0xfc, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x6d, 0x54, 0xfe, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x6e, 0x54, 0x3a, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x6f, 0x54, 0x8b, 0x01, 0x00, 0x00, 0x04,
- 0xc0, 0x70, 0x54, 0x5d, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x71, 0x54, 0xf8, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x72, 0x54, 0xf9, 0x00, 0x00, 0x00, 0x04,
- 0xc0, 0x73, 0x54, 0xfa, 0x00, 0x00, 0x00, 0x04,
- 0xf0, 0x0e, 0xc6, 0xe0, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x0b, 0xc2, 0x26, 0x4c, 0x77, 0x01, 0x00,
- 0x00, 0xc2, 0x27, 0x4c, 0x78, 0x01, 0x00, 0x00,
+ 0x00, 0xc2, 0x1a, 0x4c, 0x79, 0x01, 0x00, 0x00,
+ 0xc7, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x1b,
+ 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc0, 0x50, 0x54,
+ 0x81, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x51, 0x54,
+ 0x82, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x9b,
+ 0x00, 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0x26, 0x04, 0x00, 0x4c, 0x83, 0x01,
+ 0x00, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38,
+ 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x26, 0x04,
+ 0x00, 0x4c, 0x84, 0x01, 0x00, 0x00, 0xc2, 0x17,
+ 0x4c, 0x7c, 0x01, 0x00, 0x00, 0xc2, 0x18, 0x4c,
+ 0x7d, 0x01, 0x00, 0x00, 0xc2, 0x19, 0x4c, 0x80,
+ 0x00, 0x00, 0x00, 0xc2, 0x1a, 0x4c, 0x79, 0x01,
+ 0x00, 0x00, 0xc7, 0x4c, 0x7a, 0x01, 0x00, 0x00,
+ 0xc2, 0x1b, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xf1,
+ 0x0e, 0xc5, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x0b,
+ 0xc0, 0x52, 0x54, 0x8e, 0x01, 0x00, 0x00, 0x04,
+ 0xf0, 0x0e, 0xc5, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x53,
+ 0x54, 0x01, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x54,
+ 0x54, 0x3a, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x55,
+ 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x56,
+ 0x54, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x57,
+ 0x54, 0xff, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x58,
+ 0x54, 0x00, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x59,
+ 0x54, 0x06, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x5a,
+ 0x54, 0x07, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e,
+ 0x36, 0xea, 0x00, 0x00, 0x00, 0xc0, 0x5b, 0x3b,
+ 0xea, 0x00, 0x00, 0x00, 0xc6, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b,
+ 0xc2, 0x1c, 0x4c, 0x7c, 0x01, 0x00, 0x00, 0xc2,
+ 0x1d, 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc2, 0x1e,
+ 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x1f, 0x4c,
+ 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0x7a, 0x01,
+ 0x00, 0x00, 0xc2, 0x20, 0x4c, 0x7f, 0x01, 0x00,
+ 0x00, 0xc0, 0x61, 0x54, 0x81, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0x62, 0x54, 0x82, 0x01, 0x00, 0x00,
+ 0x04, 0x0b, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38,
+ 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x26, 0x04,
+ 0x00, 0x4c, 0x83, 0x01, 0x00, 0x00, 0x38, 0x9b,
+ 0x00, 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0x26, 0x04, 0x00, 0x4c, 0x84, 0x01,
+ 0x00, 0x00, 0xc2, 0x1c, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x1d, 0x4c, 0x7d, 0x01, 0x00, 0x00,
+ 0xc2, 0x1e, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
+ 0x1f, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0xc5, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc0, 0x63, 0x54, 0x01, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0x64, 0x54, 0x3a, 0x00, 0x00,
+ 0x00, 0x04, 0xf0, 0x0e, 0x36, 0xeb, 0x00, 0x00,
+ 0x00, 0xc0, 0x66, 0x3b, 0xeb, 0x00, 0x00, 0x00,
+ 0xc5, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x3e,
+ 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x6b, 0x54, 0x8f,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x6c, 0x54, 0xff,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x6d, 0x54, 0x01,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x6e, 0x54, 0x3a,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x6f, 0x54, 0x90,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x70, 0x54, 0x5d,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x71, 0x54, 0xfb,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x72, 0x54, 0xfc,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x73, 0x54, 0xfd,
+ 0x00, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc6, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc2, 0x26, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x27, 0x4c, 0x7d, 0x01, 0x00, 0x00,
  0xc2, 0x28, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
- 0x2a, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc7, 0x4c,
- 0x75, 0x01, 0x00, 0x00, 0xc2, 0x2c, 0x4c, 0x7a,
- 0x01, 0x00, 0x00, 0xc0, 0x7b, 0x54, 0x7c, 0x01,
- 0x00, 0x00, 0x04, 0xc0, 0x7c, 0x54, 0x7d, 0x01,
- 0x00, 0x00, 0x04, 0x0b, 0x38, 0x98, 0x00, 0x00,
- 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e, 0x08,
- 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a, 0x00, 0x5e,
- 0x0f, 0x00, 0x26, 0x06, 0x00, 0x4c, 0x7e, 0x01,
- 0x00, 0x00, 0xc2, 0x26, 0x4c, 0x77, 0x01, 0x00,
- 0x00, 0xc2, 0x27, 0x4c, 0x78, 0x01, 0x00, 0x00,
+ 0x2a, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x2c, 0x4c, 0x7f,
+ 0x01, 0x00, 0x00, 0xc0, 0x7b, 0x54, 0x81, 0x01,
+ 0x00, 0x00, 0x04, 0xc0, 0x7c, 0x54, 0x82, 0x01,
+ 0x00, 0x00, 0x04, 0x0b, 0x38, 0x9b, 0x00, 0x00,
+ 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x26, 0x06, 0x00, 0x4c, 0x83, 0x01,
+ 0x00, 0x00, 0xc2, 0x26, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x27, 0x4c, 0x7d, 0x01, 0x00, 0x00,
  0xc2, 0x28, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
- 0x2a, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc7, 0x4c,
- 0x75, 0x01, 0x00, 0x00, 0x0b, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e,
- 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a, 0x00,
- 0x5e, 0x0f, 0x00, 0x26, 0x06, 0x00, 0x4c, 0x7f,
- 0x01, 0x00, 0x00, 0xc2, 0x26, 0x4c, 0x77, 0x01,
- 0x00, 0x00, 0xc2, 0x27, 0x4c, 0x78, 0x01, 0x00,
+ 0x2a, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0x0b, 0x38, 0x9b, 0x00,
+ 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0x26, 0x06, 0x00, 0x4c, 0x84,
+ 0x01, 0x00, 0x00, 0xc2, 0x26, 0x4c, 0x7c, 0x01,
+ 0x00, 0x00, 0xc2, 0x27, 0x4c, 0x7d, 0x01, 0x00,
  0x00, 0xc2, 0x28, 0x4c, 0x80, 0x00, 0x00, 0x00,
- 0xc2, 0x29, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc7,
- 0x4c, 0x75, 0x01, 0x00, 0x00, 0x22, 0x04, 0x00,
- 0x0e, 0xc5, 0xe0, 0x0b, 0xc0, 0x7d, 0x54, 0x8c,
- 0x01, 0x00, 0x00, 0x04, 0xc0, 0x7e, 0x54, 0xf0,
- 0x00, 0x00, 0x00, 0x04, 0xc0, 0x7f, 0x54, 0xf4,
- 0x00, 0x00, 0x00, 0x04, 0xc0, 0x80, 0x54, 0x2b,
- 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc0, 0x81,
- 0x5f, 0x13, 0x00, 0xc6, 0x5e, 0x13, 0x00, 0x41,
- 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x2d, 0x4c,
- 0x77, 0x01, 0x00, 0x00, 0xc2, 0x2e, 0x4c, 0x78,
- 0x01, 0x00, 0x00, 0xc2, 0x2f, 0x4c, 0x80, 0x00,
- 0x00, 0x00, 0xc2, 0x30, 0x4c, 0x74, 0x01, 0x00,
- 0x00, 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc2,
- 0x31, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc0, 0x87,
- 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc0, 0x88,
- 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38,
- 0x98, 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00,
- 0x00, 0x5e, 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e,
- 0x0a, 0x00, 0x5e, 0x0f, 0x00, 0xe0, 0x26, 0x07,
- 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0x38, 0x98,
- 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00,
- 0x5e, 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a,
- 0x00, 0x5e, 0x0f, 0x00, 0xe0, 0x26, 0x07, 0x00,
- 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc2, 0x2d, 0x4c,
- 0x77, 0x01, 0x00, 0x00, 0xc2, 0x2e, 0x4c, 0x78,
- 0x01, 0x00, 0x00, 0xc2, 0x2f, 0x4c, 0x80, 0x00,
- 0x00, 0x00, 0xc2, 0x30, 0x4c, 0x74, 0x01, 0x00,
- 0x00, 0xc7, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xf1,
- 0x0e, 0xc5, 0x5e, 0x13, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc0, 0x89, 0x54, 0xfe, 0x00,
- 0x00, 0x00, 0x04, 0xc0, 0x8a, 0x54, 0x3a, 0x00,
- 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc0, 0x8b, 0x5f,
- 0x12, 0x00, 0xc5, 0x5e, 0x12, 0x00, 0x41, 0x3e,
- 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x8c, 0x54, 0xfe,
- 0x00, 0x00, 0x00, 0x04, 0xc0, 0x8d, 0x54, 0xfc,
+ 0xc2, 0x29, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7,
+ 0x4c, 0x7a, 0x01, 0x00, 0x00, 0x22, 0x04, 0x00,
+ 0x0e, 0xc5, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x0b,
+ 0xc0, 0x7d, 0x54, 0x91, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0x7e, 0x54, 0xf3, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x7f, 0x54, 0xf7, 0x00, 0x00, 0x00, 0x04,
+ 0xc0, 0x80, 0x54, 0x30, 0x01, 0x00, 0x00, 0x04,
+ 0xf0, 0x0e, 0x36, 0xec, 0x00, 0x00, 0x00, 0xc0,
+ 0x81, 0x3b, 0xec, 0x00, 0x00, 0x00, 0xc6, 0x38,
+ 0xec, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc2, 0x2d, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x2e, 0x4c, 0x7d, 0x01, 0x00, 0x00,
+ 0xc2, 0x2f, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
+ 0x30, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x31, 0x4c, 0x7f,
+ 0x01, 0x00, 0x00, 0xc0, 0x87, 0x54, 0x81, 0x01,
+ 0x00, 0x00, 0x04, 0xc0, 0x88, 0x54, 0x82, 0x01,
+ 0x00, 0x00, 0x04, 0x0b, 0x38, 0x9b, 0x00, 0x00,
+ 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x26,
+ 0x07, 0x00, 0x4c, 0x83, 0x01, 0x00, 0x00, 0x38,
+ 0x9b, 0x00, 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0x38, 0xea, 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0x26, 0x07, 0x00, 0x4c, 0x84, 0x01,
+ 0x00, 0x00, 0xc2, 0x2d, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x2e, 0x4c, 0x7d, 0x01, 0x00, 0x00,
+ 0xc2, 0x2f, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
+ 0x30, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0xc5, 0x38,
+ 0xec, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc0, 0x89, 0x54, 0x01, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0x8a, 0x54, 0x3a, 0x00, 0x00,
+ 0x00, 0x04, 0xf0, 0x0e, 0x36, 0xed, 0x00, 0x00,
+ 0x00, 0xc0, 0x8b, 0x3b, 0xed, 0x00, 0x00, 0x00,
+ 0xc5, 0x38, 0xed, 0x00, 0x00, 0x00, 0x41, 0x3e,
+ 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x8c, 0x54, 0x01,
+ 0x01, 0x00, 0x00, 0x04, 0xc0, 0x8d, 0x54, 0xff,
  0x00, 0x00, 0x00, 0x04, 0xc0, 0x8e, 0x54, 0x3a,
  0x00, 0x00, 0x00, 0x04, 0xc0, 0x8f, 0x54, 0x5d,
- 0x00, 0x00, 0x00, 0x04, 0xc0, 0x90, 0x54, 0xf8,
- 0x00, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc6, 0x5e,
- 0x12, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b,
- 0xc2, 0x32, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc2,
- 0x33, 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc2, 0x34,
- 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x35, 0x4c,
- 0x74, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0x75, 0x01,
- 0x00, 0x00, 0xc2, 0x36, 0x4c, 0x7a, 0x01, 0x00,
- 0x00, 0xc0, 0x96, 0x54, 0x7c, 0x01, 0x00, 0x00,
- 0x04, 0xc0, 0x97, 0x54, 0x7d, 0x01, 0x00, 0x00,
- 0x04, 0x0b, 0x38, 0x98, 0x00, 0x00, 0x00, 0x38,
- 0xb2, 0x00, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x5e,
- 0x07, 0x00, 0x5e, 0x0a, 0x00, 0x5e, 0x0f, 0x00,
- 0xe0, 0x26, 0x07, 0x00, 0x4c, 0x7e, 0x01, 0x00,
- 0x00, 0x38, 0x98, 0x00, 0x00, 0x00, 0x38, 0xb2,
- 0x00, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x5e, 0x07,
- 0x00, 0x5e, 0x0a, 0x00, 0x5e, 0x0f, 0x00, 0xe0,
- 0x26, 0x07, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00,
- 0xc2, 0x32, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc2,
- 0x33, 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc2, 0x34,
- 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x35, 0x4c,
- 0x74, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0x75, 0x01,
- 0x00, 0x00, 0xf1, 0x0e, 0xc5, 0x5e, 0x12, 0x00,
- 0x0b, 0xc0, 0x98, 0x54, 0x8d, 0x01, 0x00, 0x00,
- 0x04, 0xf0, 0x0e, 0xc0, 0x9b, 0x5f, 0x04, 0x00,
- 0xc6, 0x5e, 0x04, 0x00, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x0b, 0xc2, 0x39, 0x4c, 0x77, 0x01, 0x00,
- 0x00, 0xc2, 0x3a, 0x4c, 0x78, 0x01, 0x00, 0x00,
- 0xc2, 0x3b, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
- 0x3c, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc2, 0x3d,
- 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc2, 0x3e, 0x4c,
- 0x7a, 0x01, 0x00, 0x00, 0xc0, 0xa2, 0x54, 0x7c,
- 0x01, 0x00, 0x00, 0x04, 0xc0, 0xa3, 0x54, 0x7d,
- 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e,
- 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a, 0x00,
- 0x5e, 0x0f, 0x00, 0xe0, 0x26, 0x07, 0x00, 0x4c,
- 0x7e, 0x01, 0x00, 0x00, 0x38, 0x98, 0x00, 0x00,
- 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e, 0x08,
- 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a, 0x00, 0x5e,
- 0x0f, 0x00, 0xe0, 0x26, 0x07, 0x00, 0x4c, 0x7f,
- 0x01, 0x00, 0x00, 0xc2, 0x39, 0x4c, 0x77, 0x01,
- 0x00, 0x00, 0xc2, 0x3a, 0x4c, 0x78, 0x01, 0x00,
- 0x00, 0xc2, 0x3b, 0x4c, 0x80, 0x00, 0x00, 0x00,
- 0xc2, 0x3c, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc2,
- 0x3d, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xf1, 0x0e,
- 0xc5, 0x5e, 0x04, 0x00, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x0b, 0xc0, 0xa4, 0x54, 0xfc, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xa5, 0x54, 0xfe, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xa6, 0x54, 0x8a, 0x01, 0x00,
- 0x00, 0x04, 0xc0, 0xa7, 0x54, 0x3a, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xa8, 0x54, 0x5d, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xa9, 0x54, 0xf8, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xaa, 0x54, 0xf9, 0x00, 0x00,
- 0x00, 0x04, 0xc0, 0xab, 0x54, 0x03, 0x01, 0x00,
- 0x00, 0x04, 0xc0, 0xac, 0x54, 0x04, 0x01, 0x00,
- 0x00, 0x04, 0xf0, 0x0e, 0xc5, 0x5e, 0x04, 0x00,
- 0x0b, 0xc0, 0xad, 0x54, 0x8e, 0x01, 0x00, 0x00,
- 0x04, 0xc0, 0xae, 0x54, 0xef, 0x00, 0x00, 0x00,
- 0x04, 0xf0, 0x0e, 0xc0, 0xaf, 0x5f, 0x06, 0x00,
- 0xc5, 0x5e, 0x06, 0x00, 0x0b, 0xc0, 0xb0, 0x54,
- 0x1b, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb1, 0x54,
- 0x1c, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb2, 0x54,
- 0x8f, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb3, 0x54,
- 0x1d, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb4, 0x54,
- 0x90, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb5, 0x54,
- 0x1e, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb6, 0x54,
- 0x1f, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb7, 0x54,
- 0x20, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb8, 0x54,
- 0x21, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xb9, 0x54,
- 0xfe, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xba, 0x54,
- 0x22, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xbb, 0x54,
- 0x23, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xbc, 0x54,
- 0x25, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xbd, 0x54,
- 0x24, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc6,
- 0x38, 0x96, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x0b, 0xc2, 0x3f, 0x4c, 0x77, 0x01,
- 0x00, 0x00, 0xc2, 0x40, 0x4c, 0x78, 0x01, 0x00,
- 0x00, 0xc2, 0x42, 0x4c, 0x80, 0x00, 0x00, 0x00,
- 0xc2, 0x43, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc2,
- 0x45, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc0, 0xc5,
- 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xc6,
- 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38,
- 0x98, 0x00, 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00,
- 0x00, 0x5e, 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e,
- 0x0a, 0x00, 0x5e, 0x0f, 0x00, 0xe0, 0x5e, 0x13,
- 0x00, 0x5e, 0x12, 0x00, 0x5e, 0x04, 0x00, 0x26,
- 0x0a, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc2,
- 0x41, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc0, 0xc7,
- 0x54, 0x74, 0x01, 0x00, 0x00, 0x04, 0xc7, 0x4c,
- 0x75, 0x01, 0x00, 0x00, 0x0b, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x5e,
- 0x08, 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x0a, 0x00,
- 0x5e, 0x0f, 0x00, 0xe0, 0x5e, 0x13, 0x00, 0x5e,
- 0x12, 0x00, 0x5e, 0x04, 0x00, 0x26, 0x0a, 0x00,
- 0x4c, 0x7e, 0x01, 0x00, 0x00, 0xc0, 0xc8, 0x54,
- 0x80, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xc9, 0x54,
- 0x74, 0x01, 0x00, 0x00, 0x04, 0x22, 0x04, 0x00,
- 0x0e, 0xc5, 0x38, 0x96, 0x00, 0x00, 0x00, 0x41,
- 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0xca, 0x54,
- 0xfc, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xcb, 0x54,
- 0x91, 0x01, 0x00, 0x00, 0x04, 0xc0, 0xcc, 0x54,
- 0xfe, 0x00, 0x00, 0x00, 0x04, 0xe0, 0x41, 0x3e,
- 0x00, 0x00, 0x00, 0x41, 0xfa, 0x00, 0x00, 0x00,
- 0x4c, 0xfa, 0x00, 0x00, 0x00, 0xf0, 0x29, 0xc4,
- 0x03, 0x1d, 0x9f, 0x04, 0x00, 0x8d, 0x02, 0x02,
- 0x3f, 0x3f, 0x00, 0x07, 0xba, 0x01, 0x00, 0xb9,
- 0x04, 0x5a, 0x35, 0x00, 0x01, 0x0e, 0x00, 0x08,
- 0x0e, 0x2b, 0x18, 0x00, 0x03, 0x0a, 0x00, 0x08,
- 0x12, 0x2d, 0x00, 0x08, 0x14, 0x00, 0x08, 0x2a,
- 0x00, 0x08, 0x2a, 0x00, 0x08, 0x34, 0x00, 0x08,
- 0x16, 0x00, 0x08, 0x50, 0x2b, 0x0e, 0x2d, 0x2d,
- 0x00, 0x08, 0x0c, 0x2d, 0x00, 0x08, 0x0c, 0x00,
- 0x08, 0x0c, 0x00, 0x08, 0x0c, 0x2b, 0x00, 0x02,
- 0x4a, 0x00, 0x05, 0x90, 0x01, 0x30, 0x08, 0x26,
+ 0x00, 0x00, 0x00, 0x04, 0xc0, 0x90, 0x54, 0xfb,
+ 0x00, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0xc6, 0x38,
+ 0xed, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x0b, 0xc2, 0x32, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x33, 0x4c, 0x7d, 0x01, 0x00, 0x00,
+ 0xc2, 0x34, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
+ 0x35, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xc2, 0x36, 0x4c, 0x7f,
+ 0x01, 0x00, 0x00, 0xc0, 0x96, 0x54, 0x81, 0x01,
+ 0x00, 0x00, 0x04, 0xc0, 0x97, 0x54, 0x82, 0x01,
+ 0x00, 0x00, 0x04, 0x0b, 0x38, 0x9b, 0x00, 0x00,
+ 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x26,
+ 0x07, 0x00, 0x4c, 0x83, 0x01, 0x00, 0x00, 0x38,
+ 0x9b, 0x00, 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0x38, 0xea, 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0x26, 0x07, 0x00, 0x4c, 0x84, 0x01,
+ 0x00, 0x00, 0xc2, 0x32, 0x4c, 0x7c, 0x01, 0x00,
+ 0x00, 0xc2, 0x33, 0x4c, 0x7d, 0x01, 0x00, 0x00,
+ 0xc2, 0x34, 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2,
+ 0x35, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc7, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xf1, 0x0e, 0xc5, 0x38,
+ 0xed, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x98, 0x54,
+ 0x92, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x0e, 0x36,
+ 0xee, 0x00, 0x00, 0x00, 0xc0, 0x9b, 0x3b, 0xee,
+ 0x00, 0x00, 0x00, 0xc6, 0x38, 0xee, 0x00, 0x00,
+ 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc2,
+ 0x39, 0x4c, 0x7c, 0x01, 0x00, 0x00, 0xc2, 0x3a,
+ 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc2, 0x3b, 0x4c,
+ 0x80, 0x00, 0x00, 0x00, 0xc2, 0x3c, 0x4c, 0x79,
+ 0x01, 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x7a, 0x01,
+ 0x00, 0x00, 0xc2, 0x3e, 0x4c, 0x7f, 0x01, 0x00,
+ 0x00, 0xc0, 0xa2, 0x54, 0x81, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0xa3, 0x54, 0x82, 0x01, 0x00, 0x00,
+ 0x04, 0x0b, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38,
+ 0xb5, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00,
+ 0x4c, 0x83, 0x01, 0x00, 0x00, 0x38, 0x9b, 0x00,
+ 0x00, 0x00, 0x38, 0xb5, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0x26, 0x07, 0x00, 0x4c, 0x84, 0x01, 0x00, 0x00,
+ 0xc2, 0x39, 0x4c, 0x7c, 0x01, 0x00, 0x00, 0xc2,
+ 0x3a, 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc2, 0x3b,
+ 0x4c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x3c, 0x4c,
+ 0x79, 0x01, 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x7a,
+ 0x01, 0x00, 0x00, 0xf1, 0x0e, 0xc5, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00,
+ 0x0b, 0xc0, 0xa4, 0x54, 0xff, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0xa5, 0x54, 0x01, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0xa6, 0x54, 0x8f, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0xa7, 0x54, 0x3a, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0xa8, 0x54, 0x5d, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0xa9, 0x54, 0xfb, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0xaa, 0x54, 0xfc, 0x00, 0x00, 0x00,
+ 0x04, 0xc0, 0xab, 0x54, 0x06, 0x01, 0x00, 0x00,
+ 0x04, 0xc0, 0xac, 0x54, 0x07, 0x01, 0x00, 0x00,
+ 0x04, 0xf0, 0x0e, 0xc5, 0x38, 0xee, 0x00, 0x00,
+ 0x00, 0x0b, 0xc0, 0xad, 0x54, 0x93, 0x01, 0x00,
+ 0x00, 0x04, 0xc0, 0xae, 0x54, 0xf2, 0x00, 0x00,
+ 0x00, 0x04, 0xf0, 0x0e, 0x36, 0xef, 0x00, 0x00,
+ 0x00, 0xc0, 0xaf, 0x3b, 0xef, 0x00, 0x00, 0x00,
+ 0xc5, 0x38, 0xef, 0x00, 0x00, 0x00, 0x0b, 0xc0,
+ 0xb0, 0x54, 0x1e, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb1, 0x54, 0x1f, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb2, 0x54, 0x94, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb3, 0x54, 0x20, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb4, 0x54, 0x95, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb5, 0x54, 0x21, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb6, 0x54, 0x22, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb7, 0x54, 0x23, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb8, 0x54, 0x24, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xb9, 0x54, 0x01, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xba, 0x54, 0x25, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xbb, 0x54, 0x26, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xbc, 0x54, 0x28, 0x01, 0x00, 0x00, 0x04, 0xc0,
+ 0xbd, 0x54, 0x27, 0x01, 0x00, 0x00, 0x04, 0xf0,
+ 0x0e, 0xc6, 0x38, 0x99, 0x00, 0x00, 0x00, 0x41,
+ 0x3e, 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x3f, 0x4c,
+ 0x7c, 0x01, 0x00, 0x00, 0xc2, 0x40, 0x4c, 0x7d,
+ 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c, 0x80, 0x00,
+ 0x00, 0x00, 0xc2, 0x43, 0x4c, 0x79, 0x01, 0x00,
+ 0x00, 0xc2, 0x45, 0x4c, 0x7f, 0x01, 0x00, 0x00,
+ 0xc0, 0xc5, 0x54, 0x81, 0x01, 0x00, 0x00, 0x04,
+ 0xc0, 0xc6, 0x54, 0x82, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38, 0xb5,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x38, 0xec, 0x00, 0x00,
+ 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0x26, 0x0a, 0x00, 0x4c, 0x84,
+ 0x01, 0x00, 0x00, 0xc2, 0x41, 0x4c, 0x80, 0x00,
+ 0x00, 0x00, 0xc0, 0xc7, 0x54, 0x79, 0x01, 0x00,
+ 0x00, 0x04, 0xc7, 0x4c, 0x7a, 0x01, 0x00, 0x00,
+ 0x0b, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x38, 0xb5,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x38, 0xec, 0x00, 0x00,
+ 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0x26, 0x0a, 0x00, 0x4c, 0x83,
+ 0x01, 0x00, 0x00, 0xc0, 0xc8, 0x54, 0x80, 0x00,
+ 0x00, 0x00, 0x04, 0xc0, 0xc9, 0x54, 0x79, 0x01,
+ 0x00, 0x00, 0x04, 0x22, 0x04, 0x00, 0x0e, 0xc5,
+ 0x38, 0x99, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00,
+ 0x00, 0x00, 0x0b, 0xc0, 0xca, 0x54, 0xff, 0x00,
+ 0x00, 0x00, 0x04, 0xc0, 0xcb, 0x54, 0x96, 0x01,
+ 0x00, 0x00, 0x04, 0xc0, 0xcc, 0x54, 0x01, 0x01,
+ 0x00, 0x00, 0x04, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0x41, 0x3e, 0x00, 0x00, 0x00, 0x41, 0xfd, 0x00,
+ 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00, 0x00, 0xf0,
+ 0x29, 0x00, 0x8d, 0x02, 0x02, 0x3f, 0x3f, 0x00,
+ 0x07, 0xba, 0x01, 0x00, 0xb9, 0x04, 0x5a, 0x35,
+ 0x00, 0x01, 0x0e, 0x00, 0x08, 0x0e, 0x2b, 0x18,
+ 0x00, 0x07, 0x0a, 0x00, 0x08, 0x12, 0x2d, 0x00,
+ 0x08, 0x14, 0x00, 0x08, 0x2a, 0x00, 0x08, 0x2a,
+ 0x00, 0x08, 0x34, 0x00, 0x08, 0x16, 0x00, 0x08,
+ 0x50, 0x2b, 0x0e, 0x41, 0x2d, 0x00, 0x08, 0x0c,
+ 0x2d, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x0c, 0x00,
+ 0x08, 0x0c, 0x2b, 0x00, 0x02, 0x08, 0x00, 0x05,
+ 0x42, 0x00, 0x07, 0x90, 0x01, 0x3a, 0x08, 0x26,
  0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x28, 0x2d,
  0x2c, 0x08, 0x5d, 0x5d, 0x26, 0x26, 0x26, 0x26,
- 0x26, 0x21, 0x26, 0x27, 0x08, 0x2b, 0x2b, 0x26,
+ 0x26, 0x21, 0x26, 0x27, 0x08, 0x35, 0x35, 0x26,
  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x18,
- 0x00, 0x05, 0x10, 0x2b, 0x0e, 0x35, 0x00, 0x0a,
+ 0x00, 0x07, 0x10, 0x2b, 0x0e, 0x3f, 0x00, 0x0a,
  0x0c, 0x19, 0x2d, 0x2d, 0x00, 0x08, 0x0c, 0x2d,
  0x00, 0x08, 0x0c, 0x2d, 0x2d, 0x2b, 0x00, 0x02,
  0x08, 0x41, 0x2d, 0x2d, 0x2d, 0x00, 0x08, 0x0c,
  0x2d, 0x00, 0x08, 0x0e, 0x2b, 0x00, 0x02, 0x08,
- 0x00, 0x05, 0x36, 0x1e, 0x00, 0x08, 0x2e, 0x2c,
- 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x0e, 0x37,
+ 0x00, 0x05, 0x36, 0x28, 0x00, 0x08, 0x2e, 0x2c,
+ 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x0e, 0x41,
  0x2d, 0x2d, 0x2d, 0x00, 0x08, 0x0c, 0x2d, 0x00,
- 0x08, 0x0e, 0x2b, 0x00, 0x02, 0x24, 0x00, 0x05,
- 0x3c, 0x30, 0x08, 0x26, 0x26, 0x26, 0x26, 0x21,
- 0x28, 0x2d, 0x2c, 0x08, 0x7b, 0x7b, 0x26, 0x26,
- 0x26, 0x26, 0x21, 0x26, 0x0e, 0x00, 0x05, 0x0e,
- 0x2b, 0x0e, 0x00, 0x0a, 0x08, 0x00, 0x08, 0x24,
- 0x2d, 0x2d, 0x2d, 0x2d, 0x00, 0x08, 0x08, 0x2d,
- 0x2b, 0x00, 0x02, 0x32, 0x00, 0x05, 0x58, 0x30,
- 0x08, 0x26, 0x26, 0x26, 0x26, 0x21, 0x28, 0x2d,
- 0x2c, 0x08, 0x7b, 0x7b, 0x26, 0x26, 0x26, 0x26,
- 0x21, 0x0e, 0x00, 0x0a, 0x10, 0x2d, 0x2b, 0x00,
- 0x02, 0x46, 0x00, 0x03, 0xf0, 0x01, 0x00, 0x08,
- 0x10, 0x00, 0x08, 0x12, 0x2d, 0x00, 0x08, 0x28,
- 0x00, 0x08, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x08,
- 0x1a, 0x00, 0x08, 0x12, 0x00, 0x08, 0x12, 0x2b,
- 0x00, 0x02, 0x80, 0x01, 0x26, 0x08, 0x26, 0x26,
- 0x26, 0x26, 0x21, 0x28, 0x00, 0x08, 0x10, 0x2c,
- 0x08, 0x99, 0x26, 0x26, 0x26, 0x26, 0x22, 0x08,
- 0x99, 0x26, 0x26, 0x26, 0x26, 0x21, 0x18, 0x00,
- 0x03, 0x36, 0x00, 0x08, 0x14, 0x00, 0x08, 0x28,
- 0x2d, 0x2b, 0x00, 0x02, 0x32, 0x00, 0x05, 0x48,
- 0x30, 0x08, 0x26, 0x26, 0x26, 0x26, 0x21, 0x28,
- 0x2d, 0x2c, 0x08, 0x9e, 0x9e, 0x26, 0x26, 0x26,
- 0x26, 0x21, 0x0e, 0x00, 0x0a, 0x10, 0x2d, 0x2b,
- 0x00, 0x02, 0x32, 0x1d, 0x37, 0x2d, 0x00, 0x08,
- 0x14, 0x2d, 0x00, 0x08, 0x08, 0x2b, 0x00, 0x02,
- 0x3a, 0x30, 0x08, 0x26, 0x26, 0x26, 0x26, 0x21,
- 0x28, 0x2d, 0x2c, 0x08, 0x9e, 0x9e, 0x26, 0x26,
- 0x26, 0x26, 0x21, 0x0e, 0x00, 0x05, 0x1c, 0x2b,
- 0x00, 0x02, 0x5a, 0x00, 0x05, 0xc0, 0x01, 0x30,
- 0x08, 0x26, 0x26, 0x26, 0x26, 0x26, 0x28, 0x00,
- 0x08, 0x12, 0x2c, 0x08, 0x9e, 0x9e, 0x26, 0x26,
- 0x26, 0x26, 0x26, 0x0e, 0x00, 0x0a, 0x12, 0x00,
- 0x08, 0x20, 0x00, 0x08, 0x1e, 0x00, 0x08, 0x2c,
- 0x00, 0x08, 0x1c, 0x00, 0x08, 0x20, 0x00, 0x08,
- 0x1c, 0x00, 0x08, 0x22, 0x00, 0x08, 0x12, 0x2b,
- 0x0e, 0x00, 0x05, 0x1a, 0x00, 0x08, 0x2a, 0x2b,
- 0x00, 0x02, 0x20, 0x1d, 0x00, 0x05, 0x0e, 0x00,
- 0x08, 0x10, 0x00, 0x08, 0x14, 0x00, 0x08, 0x2c,
- 0x00, 0x08, 0x12, 0x00, 0x08, 0x12, 0x00, 0x08,
- 0x22, 0x2d, 0x00, 0x08, 0x44, 0x00, 0x08, 0x54,
- 0x00, 0x08, 0x52, 0x00, 0x08, 0x94, 0x01, 0x00,
- 0x08, 0x18, 0x00, 0x08, 0x16, 0x2b, 0x00, 0x02,
- 0xd2, 0x01, 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26,
- 0x28, 0x00, 0x08, 0x10, 0x2c, 0x08, 0x71, 0x5d,
- 0x26, 0x2b, 0x22, 0x08, 0x71, 0x5d, 0x2b, 0x2b,
- 0x18, 0x00, 0x0c, 0x10, 0x00, 0x08, 0x18, 0x2d,
- 0x2b, 0x53, 0x09, 0x0e, 0x43, 0x06, 0x01, 0xd8,
- 0x04, 0x02, 0x05, 0x02, 0x05, 0x00, 0x00, 0x77,
- 0x07, 0xa4, 0x06, 0x00, 0x01, 0x00, 0xa6, 0x06,
- 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00,
- 0xaa, 0x06, 0x00, 0x01, 0x00, 0xac, 0x06, 0x00,
- 0x02, 0x00, 0xae, 0x06, 0x00, 0x03, 0x00, 0xb0,
- 0x06, 0x00, 0x04, 0x00, 0x38, 0x99, 0x01, 0x00,
- 0x00, 0x42, 0x6a, 0x00, 0x00, 0x00, 0xd2, 0x24,
- 0x01, 0x00, 0xcc, 0xb5, 0xc9, 0xc5, 0xc8, 0xe9,
- 0xa3, 0xea, 0x60, 0xc8, 0xc5, 0x47, 0xcb, 0x38,
- 0x95, 0x00, 0x00, 0x00, 0x42, 0x69, 0x00, 0x00,
- 0x00, 0xd2, 0xc7, 0x24, 0x02, 0x00, 0xc4, 0x04,
- 0x09, 0x43, 0x42, 0x00, 0x00, 0x00, 0x04, 0x43,
- 0x00, 0x00, 0x00, 0xc2, 0x04, 0xa8, 0xea, 0x1d,
- 0xc2, 0x04, 0x41, 0x43, 0x00, 0x00, 0x00, 0xf5,
- 0xeb, 0x11, 0xc2, 0x04, 0x09, 0x43, 0x41, 0x00,
- 0x00, 0x00, 0xc2, 0x04, 0x09, 0x43, 0x40, 0x00,
- 0x00, 0x00, 0xec, 0x09, 0xc2, 0x04, 0x09, 0x43,
- 0x40, 0x00, 0x00, 0x00, 0x38, 0x95, 0x00, 0x00,
- 0x00, 0x42, 0x68, 0x00, 0x00, 0x00, 0xd1, 0xc7,
- 0xc2, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x93, 0x00,
- 0xec, 0x9c, 0x29, 0xc4, 0x03, 0x23, 0x0e, 0x04,
- 0x4e, 0x2b, 0x17, 0x58, 0x21, 0x35, 0x35, 0x2b,
- 0x2c, 0x0e, 0x2c, 0x5d, 0x17, 0x0e, 0x41, 0x06,
- 0x01, 0xda, 0x04, 0x02, 0x09, 0x01, 0x07, 0x00,
- 0x00, 0xfd, 0x01, 0x0b, 0xb4, 0x06, 0x00, 0x01,
- 0x00, 0xb6, 0x06, 0x00, 0x01, 0x00, 0xb8, 0x06,
- 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
- 0xba, 0x06, 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00,
- 0x03, 0x00, 0xbe, 0x06, 0x00, 0x04, 0x00, 0xc0,
- 0x06, 0x00, 0x05, 0x00, 0xa4, 0x06, 0x00, 0x06,
- 0x00, 0xae, 0x06, 0x00, 0x07, 0x00, 0xc2, 0x06,
- 0x00, 0x08, 0x00, 0x0d, 0x01, 0x00, 0xd6, 0x04,
- 0x7e, 0x01, 0x00, 0x00, 0x04, 0x7f, 0x01, 0x00,
- 0x00, 0x26, 0x02, 0x00, 0xc3, 0x08, 0x26, 0x00,
- 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xd2, 0xe9, 0xa3,
- 0x69, 0xb6, 0x00, 0x00, 0x00, 0xd2, 0xc6, 0x47,
- 0xcf, 0x41, 0x7e, 0x01, 0x00, 0x00, 0x11, 0xeb,
- 0x08, 0x0e, 0xc7, 0x41, 0x7f, 0x01, 0x00, 0x00,
- 0x69, 0x8e, 0x00, 0x00, 0x00, 0xc7, 0x41, 0x7e,
- 0x01, 0x00, 0x00, 0xc7, 0x41, 0x7f, 0x01, 0x00,
- 0x00, 0x26, 0x02, 0x00, 0xc3, 0x07, 0xc7, 0x04,
- 0x7e, 0x01, 0x00, 0x00, 0x98, 0x0e, 0xc7, 0x04,
- 0x7f, 0x01, 0x00, 0x00, 0x98, 0x0e, 0xb5, 0xc3,
- 0x05, 0xc2, 0x05, 0xb7, 0xa3, 0xea, 0x6c, 0xc2,
- 0x07, 0xc2, 0x05, 0x47, 0xc4, 0x06, 0xea, 0x54,
- 0x38, 0x96, 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01,
- 0x00, 0x00, 0xc2, 0x06, 0x24, 0x01, 0x00, 0x96,
- 0xea, 0x08, 0xc2, 0x06, 0x26, 0x01, 0x00, 0xc3,
- 0x06, 0xb5, 0xcc, 0xc8, 0xc2, 0x06, 0xe9, 0xa3,
- 0xea, 0x32, 0x0b, 0xc3, 0x04, 0x38, 0x95, 0x00,
- 0x00, 0x00, 0x42, 0xa3, 0x01, 0x00, 0x00, 0xc2,
- 0x04, 0xc7, 0x24, 0x02, 0x00, 0x0e, 0xc2, 0x04,
- 0xc2, 0x08, 0xc2, 0x05, 0x47, 0x71, 0xc2, 0x06,
- 0xc8, 0x47, 0x49, 0xc5, 0x42, 0xa4, 0x01, 0x00,
- 0x00, 0xc2, 0x04, 0x24, 0x01, 0x00, 0x0e, 0x93,
- 0x03, 0xec, 0xc9, 0x93, 0x05, 0xec, 0x9b, 0xc5,
- 0x42, 0xa4, 0x01, 0x00, 0x00, 0xc7, 0x24, 0x01,
- 0x00, 0x0e, 0x93, 0x01, 0xed, 0x47, 0xff, 0xd1,
- 0x38, 0x9b, 0x00, 0x00, 0x00, 0x41, 0xa5, 0x01,
- 0x00, 0x00, 0x71, 0x38, 0xb7, 0x00, 0x00, 0x00,
- 0x41, 0xa6, 0x01, 0x00, 0x00, 0x42, 0xa7, 0x01,
- 0x00, 0x00, 0x07, 0x26, 0x01, 0x00, 0xb6, 0xc5,
- 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x49, 0x29,
- 0xc4, 0x03, 0x3a, 0x19, 0x19, 0x4e, 0x17, 0x3a,
- 0x17, 0x67, 0x58, 0x2b, 0x2b, 0x30, 0x26, 0x0d,
- 0x5d, 0x27, 0x30, 0x12, 0x58, 0x44, 0x3f, 0x18,
- 0x18, 0x3b, 0x1c, 0x3f, 0x8f, 0x0e, 0x43, 0x06,
- 0x01, 0xdc, 0x04, 0x02, 0x03, 0x02, 0x04, 0x07,
- 0x00, 0xa2, 0x01, 0x05, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
- 0x00, 0x00, 0x00, 0xd2, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x02, 0x00, 0xc6, 0x03, 0x00,
- 0x00, 0x86, 0x04, 0x01, 0x00, 0x88, 0x04, 0x02,
- 0x00, 0xd0, 0x03, 0x03, 0x00, 0xd6, 0x03, 0x04,
- 0x00, 0xb6, 0x04, 0x05, 0x00, 0xd8, 0x03, 0x06,
- 0x00, 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd2,
- 0x24, 0x01, 0x00, 0x96, 0xea, 0x0a, 0xde, 0xdf,
- 0xd1, 0xef, 0xd2, 0x9a, 0x23, 0x01, 0x00, 0x38,
- 0x96, 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00,
- 0x00, 0xd1, 0x24, 0x01, 0x00, 0xea, 0x23, 0xd1,
- 0xe0, 0xa7, 0x11, 0xeb, 0x07, 0x0e, 0xd1, 0x5e,
- 0x04, 0x00, 0xa7, 0x96, 0xea, 0x14, 0x5e, 0x05,
- 0x00, 0x5e, 0x06, 0x00, 0x42, 0x90, 0x01, 0x00,
- 0x00, 0xd1, 0x24, 0x01, 0x00, 0xef, 0xc9, 0xec,
- 0x03, 0xb6, 0xc9, 0xd2, 0xb5, 0xa9, 0xea, 0x03,
- 0xc5, 0x28, 0x09, 0xca, 0xd2, 0xb5, 0xa3, 0xea,
- 0x06, 0x0a, 0xca, 0xd2, 0x8c, 0xd6, 0xd1, 0xc9,
- 0xdd, 0x42, 0xaa, 0x01, 0x00, 0x00, 0xd2, 0x24,
- 0x01, 0x00, 0xb6, 0x9e, 0xcb, 0xc7, 0xb5, 0xa6,
- 0xea, 0x14, 0xc5, 0xc5, 0x9a, 0xc9, 0xd2, 0xc7,
- 0xa1, 0xb6, 0xad, 0xea, 0x05, 0xc5, 0xd1, 0x9a,
- 0xc9, 0x92, 0x02, 0xec, 0xe9, 0xc6, 0xea, 0x1a,
- 0xc5, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xf5, 0xeb,
- 0x07, 0x04, 0xab, 0x01, 0x00, 0x00, 0x2f, 0xc5,
- 0x42, 0xfe, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0x5d, 0x18, 0x04,
- 0x44, 0x31, 0x76, 0x2b, 0x58, 0x0d, 0x0e, 0x1c,
- 0x0d, 0x0d, 0x1c, 0x0d, 0x13, 0x0d, 0x5d, 0x17,
- 0x26, 0x17, 0x17, 0x12, 0x30, 0x21, 0x36, 0x0e,
- 0x43, 0x06, 0x01, 0xe0, 0x04, 0x02, 0x06, 0x02,
- 0x05, 0x02, 0x00, 0x6e, 0x08, 0xd8, 0x06, 0x00,
- 0x01, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xdc,
- 0x06, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01,
- 0x00, 0xde, 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06,
- 0x00, 0x03, 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00,
- 0xba, 0x06, 0x00, 0x05, 0x00, 0xde, 0x04, 0x03,
- 0x01, 0xc6, 0x03, 0x00, 0x00, 0xd1, 0xb6, 0x9e,
- 0xc9, 0xb5, 0xcb, 0xc5, 0xb6, 0xad, 0xb5, 0xa9,
- 0xea, 0x09, 0xc5, 0xb6, 0xa1, 0xc9, 0x93, 0x02,
- 0xec, 0xf2, 0xdd, 0xe9, 0xd2, 0xa3, 0xea, 0x04,
- 0xdd, 0xe9, 0xd6, 0xb5, 0xc3, 0x04, 0xc2, 0x04,
- 0xd2, 0xa3, 0xea, 0x46, 0xdd, 0xc2, 0x04, 0x47,
- 0xc3, 0x05, 0xde, 0x42, 0xf3, 0x00, 0x00, 0x00,
- 0xc2, 0x05, 0xc5, 0xd1, 0x24, 0x03, 0x00, 0xce,
- 0xb6, 0xa9, 0x11, 0xeb, 0x07, 0x0e, 0xc6, 0xd1,
- 0xb6, 0x9e, 0xa9, 0xeb, 0x21, 0xb6, 0xcc, 0xc8,
- 0xc7, 0xa3, 0xea, 0x18, 0xc6, 0xc6, 0x9a, 0xd1,
- 0x9c, 0xce, 0xb6, 0xa9, 0xea, 0x03, 0x09, 0x28,
- 0xc6, 0xd1, 0xb6, 0x9e, 0xa9, 0xeb, 0x07, 0x93,
- 0x03, 0xec, 0xe5, 0x09, 0x28, 0x93, 0x04, 0xec,
- 0xb6, 0x0a, 0x28, 0xc4, 0x03, 0x7f, 0x17, 0x04,
- 0x17, 0x0d, 0x26, 0x17, 0x0d, 0x0d, 0x21, 0x12,
- 0x30, 0x21, 0x49, 0x3a, 0x0d, 0x26, 0x21, 0x17,
- 0x0d, 0x1c, 0x0d, 0x17, 0x08, 0x1c, 0x0e, 0x43,
- 0x06, 0x01, 0xe2, 0x04, 0x02, 0x02, 0x02, 0x04,
- 0x01, 0x00, 0x2e, 0x04, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
- 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00,
- 0xe2, 0x04, 0x05, 0x01, 0xd2, 0xd1, 0x9e, 0xba,
+ 0x08, 0x0e, 0x2b, 0x00, 0x02, 0x08, 0x00, 0x05,
+ 0x1c, 0x00, 0x07, 0x3c, 0x3a, 0x08, 0x26, 0x26,
+ 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c, 0x08, 0x8f,
+ 0x8f, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x0e,
+ 0x00, 0x07, 0x0e, 0x2b, 0x0e, 0x00, 0x0c, 0x08,
+ 0x00, 0x08, 0x24, 0x2d, 0x2d, 0x2d, 0x2d, 0x00,
+ 0x08, 0x08, 0x2d, 0x2b, 0x00, 0x02, 0x08, 0x00,
+ 0x05, 0x2a, 0x00, 0x07, 0x58, 0x3a, 0x08, 0x26,
+ 0x26, 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c, 0x08,
+ 0x8f, 0x8f, 0x26, 0x26, 0x26, 0x26, 0x21, 0x0e,
+ 0x00, 0x0c, 0x10, 0x2d, 0x2b, 0x00, 0x02, 0x22,
+ 0x00, 0x05, 0x24, 0x00, 0x07, 0xf0, 0x01, 0x00,
+ 0x0c, 0x10, 0x00, 0x08, 0x12, 0x2d, 0x00, 0x08,
+ 0x28, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x14, 0x00,
+ 0x08, 0x1a, 0x00, 0x08, 0x12, 0x00, 0x08, 0x12,
+ 0x2b, 0x00, 0x02, 0x80, 0x01, 0x3a, 0x08, 0x26,
+ 0x26, 0x26, 0x26, 0x21, 0x28, 0x00, 0x08, 0x10,
+ 0x2c, 0x08, 0xc1, 0x26, 0x26, 0x26, 0x26, 0x22,
+ 0x08, 0xc1, 0x26, 0x26, 0x26, 0x26, 0x21, 0x18,
+ 0x00, 0x07, 0x36, 0x00, 0x08, 0x14, 0x00, 0x08,
+ 0x28, 0x2d, 0x2b, 0x00, 0x02, 0x08, 0x00, 0x05,
+ 0x2a, 0x00, 0x07, 0x48, 0x3a, 0x08, 0x26, 0x26,
+ 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c, 0x08, 0xda,
+ 0xda, 0x26, 0x26, 0x26, 0x26, 0x21, 0x0e, 0x00,
+ 0x0c, 0x10, 0x2d, 0x2b, 0x00, 0x02, 0x08, 0x00,
+ 0x05, 0x2a, 0x27, 0x41, 0x2d, 0x00, 0x08, 0x14,
+ 0x2d, 0x00, 0x08, 0x08, 0x2b, 0x00, 0x02, 0x3a,
+ 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26, 0x21, 0x28,
+ 0x2d, 0x2c, 0x08, 0xda, 0xda, 0x26, 0x26, 0x26,
+ 0x26, 0x21, 0x0e, 0x00, 0x07, 0x1c, 0x2b, 0x00,
+ 0x02, 0x2c, 0x00, 0x05, 0x2e, 0x00, 0x07, 0xc0,
+ 0x01, 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26, 0x26,
+ 0x28, 0x00, 0x08, 0x12, 0x2c, 0x08, 0xda, 0xda,
+ 0x26, 0x26, 0x26, 0x26, 0x26, 0x0e, 0x00, 0x0c,
+ 0x12, 0x00, 0x08, 0x20, 0x00, 0x08, 0x1e, 0x00,
+ 0x08, 0x2c, 0x00, 0x08, 0x1c, 0x00, 0x08, 0x20,
+ 0x00, 0x08, 0x1c, 0x00, 0x08, 0x22, 0x00, 0x08,
+ 0x12, 0x2b, 0x0e, 0x00, 0x07, 0x1a, 0x00, 0x08,
+ 0x2a, 0x2b, 0x00, 0x02, 0x08, 0x00, 0x05, 0x18,
+ 0x27, 0x00, 0x07, 0x0e, 0x00, 0x08, 0x10, 0x00,
+ 0x08, 0x14, 0x00, 0x08, 0x2c, 0x00, 0x08, 0x12,
+ 0x00, 0x08, 0x12, 0x00, 0x08, 0x22, 0x2d, 0x00,
+ 0x08, 0x44, 0x00, 0x08, 0x54, 0x00, 0x08, 0x52,
+ 0x00, 0x08, 0x94, 0x01, 0x00, 0x08, 0x18, 0x00,
+ 0x08, 0x16, 0x2b, 0x00, 0x02, 0xd2, 0x01, 0x3a,
+ 0x08, 0x26, 0x26, 0x26, 0x26, 0x28, 0x00, 0x08,
+ 0x10, 0x2c, 0x08, 0x99, 0x8f, 0x26, 0x2b, 0x22,
+ 0x08, 0x99, 0x8f, 0x2b, 0x2b, 0x18, 0x00, 0x0c,
+ 0x10, 0x00, 0x08, 0x18, 0x2d, 0x2b, 0x67, 0x09,
+ 0x0e, 0x43, 0x06, 0x05, 0xe2, 0x04, 0x02, 0x05,
+ 0x02, 0x05, 0x00, 0x00, 0x77, 0xca, 0x03, 0x23,
+ 0x0e, 0x07, 0xae, 0x06, 0x00, 0x01, 0x00, 0xb0,
+ 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00, 0x00,
+ 0x00, 0xb4, 0x06, 0x00, 0x01, 0x00, 0xb6, 0x06,
+ 0x00, 0x02, 0x00, 0xb8, 0x06, 0x00, 0x03, 0x00,
+ 0xba, 0x06, 0x00, 0x04, 0x00, 0x38, 0x9e, 0x01,
+ 0x00, 0x00, 0x42, 0x6a, 0x00, 0x00, 0x00, 0xd2,
+ 0x24, 0x01, 0x00, 0xcc, 0xb5, 0xc9, 0xc5, 0xc8,
+ 0xe9, 0xa3, 0xea, 0x60, 0xc8, 0xc5, 0x47, 0xcb,
+ 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0x69, 0x00,
+ 0x00, 0x00, 0xd2, 0xc7, 0x24, 0x02, 0x00, 0xc4,
+ 0x04, 0x09, 0x43, 0x42, 0x00, 0x00, 0x00, 0x04,
+ 0x43, 0x00, 0x00, 0x00, 0xc2, 0x04, 0xa8, 0xea,
+ 0x1d, 0xc2, 0x04, 0x41, 0x43, 0x00, 0x00, 0x00,
+ 0xf5, 0xeb, 0x11, 0xc2, 0x04, 0x09, 0x43, 0x41,
+ 0x00, 0x00, 0x00, 0xc2, 0x04, 0x09, 0x43, 0x40,
+ 0x00, 0x00, 0x00, 0xec, 0x09, 0xc2, 0x04, 0x09,
+ 0x43, 0x40, 0x00, 0x00, 0x00, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0x42, 0x68, 0x00, 0x00, 0x00, 0xd1,
+ 0xc7, 0xc2, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x93,
+ 0x00, 0xec, 0x9c, 0x29, 0x04, 0x4e, 0x2b, 0x17,
+ 0x58, 0x21, 0x35, 0x35, 0x2b, 0x2c, 0x0e, 0x2c,
+ 0x5d, 0x17, 0x0e, 0x41, 0x06, 0x05, 0xe4, 0x04,
+ 0x02, 0x09, 0x01, 0x07, 0x00, 0x00, 0xfd, 0x01,
+ 0xca, 0x03, 0x3a, 0x19, 0x0b, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0xc0, 0x06, 0x00, 0x01, 0x00, 0xc2,
+ 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x01,
+ 0x00, 0xc4, 0x06, 0x00, 0x02, 0x00, 0xc6, 0x06,
+ 0x00, 0x03, 0x00, 0xc8, 0x06, 0x00, 0x04, 0x00,
+ 0xca, 0x06, 0x00, 0x05, 0x00, 0xae, 0x06, 0x00,
+ 0x06, 0x00, 0xb8, 0x06, 0x00, 0x07, 0x00, 0xcc,
+ 0x06, 0x00, 0x08, 0x00, 0x0d, 0x01, 0x00, 0xd6,
+ 0x04, 0x83, 0x01, 0x00, 0x00, 0x04, 0x84, 0x01,
+ 0x00, 0x00, 0x26, 0x02, 0x00, 0xc3, 0x08, 0x26,
+ 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xd2, 0xe9,
+ 0xa3, 0x69, 0xb6, 0x00, 0x00, 0x00, 0xd2, 0xc6,
+ 0x47, 0xcf, 0x41, 0x83, 0x01, 0x00, 0x00, 0x11,
+ 0xeb, 0x08, 0x0e, 0xc7, 0x41, 0x84, 0x01, 0x00,
+ 0x00, 0x69, 0x8e, 0x00, 0x00, 0x00, 0xc7, 0x41,
+ 0x83, 0x01, 0x00, 0x00, 0xc7, 0x41, 0x84, 0x01,
+ 0x00, 0x00, 0x26, 0x02, 0x00, 0xc3, 0x07, 0xc7,
+ 0x04, 0x83, 0x01, 0x00, 0x00, 0x98, 0x0e, 0xc7,
+ 0x04, 0x84, 0x01, 0x00, 0x00, 0x98, 0x0e, 0xb5,
+ 0xc3, 0x05, 0xc2, 0x05, 0xb7, 0xa3, 0xea, 0x6c,
+ 0xc2, 0x07, 0xc2, 0x05, 0x47, 0xc4, 0x06, 0xea,
+ 0x54, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42, 0xa7,
+ 0x01, 0x00, 0x00, 0xc2, 0x06, 0x24, 0x01, 0x00,
+ 0x96, 0xea, 0x08, 0xc2, 0x06, 0x26, 0x01, 0x00,
+ 0xc3, 0x06, 0xb5, 0xcc, 0xc8, 0xc2, 0x06, 0xe9,
+ 0xa3, 0xea, 0x32, 0x0b, 0xc3, 0x04, 0x38, 0x98,
+ 0x00, 0x00, 0x00, 0x42, 0xa8, 0x01, 0x00, 0x00,
+ 0xc2, 0x04, 0xc7, 0x24, 0x02, 0x00, 0x0e, 0xc2,
+ 0x04, 0xc2, 0x08, 0xc2, 0x05, 0x47, 0x71, 0xc2,
+ 0x06, 0xc8, 0x47, 0x49, 0xc5, 0x42, 0xa9, 0x01,
+ 0x00, 0x00, 0xc2, 0x04, 0x24, 0x01, 0x00, 0x0e,
+ 0x93, 0x03, 0xec, 0xc9, 0x93, 0x05, 0xec, 0x9b,
+ 0xc5, 0x42, 0xa9, 0x01, 0x00, 0x00, 0xc7, 0x24,
+ 0x01, 0x00, 0x0e, 0x93, 0x01, 0xed, 0x47, 0xff,
+ 0xd1, 0x38, 0x9e, 0x00, 0x00, 0x00, 0x41, 0xaa,
+ 0x01, 0x00, 0x00, 0x71, 0x38, 0xba, 0x00, 0x00,
+ 0x00, 0x41, 0xab, 0x01, 0x00, 0x00, 0x42, 0xac,
+ 0x01, 0x00, 0x00, 0x07, 0x26, 0x01, 0x00, 0xb6,
+ 0xc5, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x49,
+ 0x29, 0x19, 0x4e, 0x17, 0x3a, 0x17, 0x67, 0x58,
+ 0x2b, 0x2b, 0x30, 0x26, 0x0d, 0x5d, 0x27, 0x30,
+ 0x12, 0x58, 0x44, 0x3f, 0x18, 0x18, 0x3b, 0x1c,
+ 0x3f, 0x8f, 0x0e, 0x43, 0x06, 0x05, 0xe6, 0x04,
+ 0x02, 0x03, 0x02, 0x04, 0x00, 0x00, 0xbc, 0x01,
+ 0xca, 0x03, 0x5d, 0x18, 0x05, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xda,
+ 0x06, 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x01,
+ 0x00, 0xb2, 0x06, 0x00, 0x02, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00,
+ 0xd2, 0x24, 0x01, 0x00, 0x96, 0xea, 0x12, 0x38,
+ 0x06, 0x01, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00,
+ 0x00, 0xd1, 0xef, 0xd2, 0x9a, 0x23, 0x01, 0x00,
+ 0x38, 0x99, 0x00, 0x00, 0x00, 0x42, 0xa7, 0x01,
+ 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xea, 0x2d,
+ 0xd1, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xa7, 0x11,
+ 0xeb, 0x09, 0x0e, 0xd1, 0x38, 0xee, 0x00, 0x00,
+ 0x00, 0xa7, 0x96, 0xea, 0x18, 0x38, 0x1e, 0x01,
+ 0x00, 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x42,
+ 0x95, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xef, 0xc9, 0xec, 0x03, 0xb6, 0xc9, 0xd2, 0xb5,
+ 0xa9, 0xea, 0x03, 0xc5, 0x28, 0x09, 0xca, 0xd2,
+ 0xb5, 0xa3, 0xea, 0x06, 0x0a, 0xca, 0xd2, 0x8c,
+ 0xd6, 0xd1, 0xc9, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x42, 0xaf, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
+ 0x00, 0xb6, 0x9e, 0xcb, 0xc7, 0xb5, 0xa6, 0xea,
+ 0x14, 0xc5, 0xc5, 0x9a, 0xc9, 0xd2, 0xc7, 0xa1,
+ 0xb6, 0xad, 0xea, 0x05, 0xc5, 0xd1, 0x9a, 0xc9,
+ 0x92, 0x02, 0xec, 0xe9, 0xc6, 0xea, 0x1a, 0xc5,
+ 0x41, 0x01, 0x01, 0x00, 0x00, 0xf5, 0xeb, 0x07,
+ 0x04, 0xb0, 0x01, 0x00, 0x00, 0x2f, 0xc5, 0x42,
+ 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc9,
+ 0xc5, 0x28, 0x04, 0x58, 0x59, 0x8a, 0x35, 0x6c,
+ 0x0d, 0x0e, 0x1c, 0x0d, 0x0d, 0x1c, 0x0d, 0x13,
+ 0x0d, 0x71, 0x17, 0x26, 0x17, 0x17, 0x12, 0x30,
+ 0x21, 0x36, 0x0e, 0x43, 0x06, 0x05, 0xea, 0x04,
+ 0x02, 0x06, 0x02, 0x05, 0x01, 0x00, 0x72, 0xca,
+ 0x03, 0x7f, 0x17, 0x08, 0xe2, 0x06, 0x00, 0x01,
+ 0x00, 0xe4, 0x06, 0x00, 0x01, 0x00, 0xe6, 0x06,
+ 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00,
+ 0xe8, 0x06, 0x00, 0x02, 0x00, 0xb2, 0x06, 0x00,
+ 0x03, 0x00, 0xc6, 0x06, 0x00, 0x04, 0x00, 0xc4,
+ 0x06, 0x00, 0x05, 0x00, 0xe8, 0x04, 0x03, 0x01,
+ 0xd1, 0xb6, 0x9e, 0xc9, 0xb5, 0xcb, 0xc5, 0xb6,
+ 0xad, 0xb5, 0xa9, 0xea, 0x09, 0xc5, 0xb6, 0xa1,
+ 0xc9, 0x93, 0x02, 0xec, 0xf2, 0xdd, 0xe9, 0xd2,
+ 0xa3, 0xea, 0x04, 0xdd, 0xe9, 0xd6, 0xb5, 0xc3,
+ 0x04, 0xc2, 0x04, 0xd2, 0xa3, 0xea, 0x4a, 0xdd,
+ 0xc2, 0x04, 0x47, 0xc3, 0x05, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0xf6, 0x00, 0x00, 0x00, 0xc2,
+ 0x05, 0xc5, 0xd1, 0x24, 0x03, 0x00, 0xce, 0xb6,
+ 0xa9, 0x11, 0xeb, 0x07, 0x0e, 0xc6, 0xd1, 0xb6,
+ 0x9e, 0xa9, 0xeb, 0x21, 0xb6, 0xcc, 0xc8, 0xc7,
+ 0xa3, 0xea, 0x18, 0xc6, 0xc6, 0x9a, 0xd1, 0xb2,
+ 0xce, 0xb6, 0xa9, 0xea, 0x03, 0x09, 0x28, 0xc6,
+ 0xd1, 0xb6, 0x9e, 0xa9, 0xeb, 0x07, 0x93, 0x03,
+ 0xec, 0xe5, 0x09, 0x28, 0x93, 0x04, 0xec, 0xb2,
+ 0x0a, 0x28, 0x04, 0x17, 0x0d, 0x26, 0x17, 0x0d,
+ 0x0d, 0x21, 0x12, 0x30, 0x21, 0x5d, 0x3a, 0x0d,
+ 0x26, 0x21, 0x17, 0x0d, 0x1c, 0x0d, 0x17, 0x08,
+ 0x1c, 0x0e, 0x43, 0x06, 0x05, 0xec, 0x04, 0x02,
+ 0x02, 0x02, 0x04, 0x01, 0x00, 0x2e, 0xca, 0x03,
+ 0x9a, 0x01, 0x08, 0x04, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06,
+ 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00,
+ 0xec, 0x04, 0x05, 0x01, 0xd2, 0xd1, 0x9e, 0xba,
  0xa4, 0xea, 0x16, 0xd1, 0xca, 0xd1, 0xb6, 0x9d,
  0xc9, 0xc5, 0xd2, 0xa4, 0xea, 0x09, 0xc6, 0xc5,
  0x9a, 0xca, 0x93, 0x00, 0xec, 0xf4, 0xc6, 0x28,
  0xd1, 0xd2, 0x9d, 0xb6, 0xa1, 0xc9, 0xdd, 0xd1,
  0xc5, 0xf0, 0xdd, 0xc5, 0xb6, 0x9d, 0xd2, 0xf0,
- 0x9a, 0x28, 0xc4, 0x03, 0x9a, 0x01, 0x08, 0x04,
- 0x26, 0x0d, 0x30, 0x2b, 0x08, 0x0a, 0x21, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04,
- 0x02, 0x00, 0x1a, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xca, 0x03,
- 0x07, 0x00, 0xc8, 0x03, 0x08, 0x00, 0x38, 0x72,
- 0x01, 0x00, 0x00, 0xea, 0x0c, 0xdd, 0x42, 0x80,
- 0x01, 0x00, 0x00, 0xd1, 0xd2, 0x25, 0x02, 0x00,
- 0xde, 0xd1, 0xef, 0xde, 0xd2, 0xef, 0x9b, 0x28,
- 0xc4, 0x03, 0xac, 0x01, 0x03, 0x03, 0x26, 0x3b,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x00, 0x02,
- 0x03, 0x02, 0x00, 0x15, 0x02, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xdc,
- 0x04, 0x02, 0x01, 0xc8, 0x03, 0x08, 0x00, 0x38,
- 0x72, 0x01, 0x00, 0x00, 0xea, 0x07, 0xdd, 0xd1,
- 0xd2, 0x23, 0x02, 0x00, 0xde, 0xd1, 0xef, 0xde,
- 0xd2, 0xef, 0x9f, 0x28, 0xc4, 0x03, 0xb3, 0x01,
- 0x03, 0x03, 0x26, 0x22, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x27,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x97,
+ 0x9a, 0x28, 0x04, 0x26, 0x0d, 0x30, 0x2b, 0x08,
+ 0x0a, 0x21, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x02,
+ 0x00, 0x02, 0x04, 0x00, 0x00, 0x26, 0xca, 0x03,
+ 0xac, 0x01, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0x77,
+ 0x01, 0x00, 0x00, 0xea, 0x10, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0x42, 0x85, 0x01, 0x00, 0x00, 0xd1,
+ 0xd2, 0x25, 0x02, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0x9b, 0x28, 0x03, 0x26, 0x4f, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x00, 0x02, 0x03,
+ 0x01, 0x00, 0x1d, 0xca, 0x03, 0xb3, 0x01, 0x03,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xe6, 0x04, 0x02, 0x01, 0x38,
+ 0x77, 0x01, 0x00, 0x00, 0xea, 0x07, 0xdd, 0xd1,
+ 0xd2, 0x23, 0x02, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0x9f, 0x28, 0x03, 0x26, 0x22, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01, 0x03,
+ 0x00, 0x00, 0x27, 0xca, 0x03, 0xbd, 0x01, 0x02,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x97,
  0x04, 0x8e, 0x00, 0x00, 0x00, 0xab, 0x11, 0xeb,
  0x1c, 0x0e, 0xd1, 0x97, 0x04, 0x49, 0x00, 0x00,
- 0x00, 0xab, 0x11, 0xea, 0x10, 0x0e, 0x38, 0x98,
- 0x00, 0x00, 0x00, 0x42, 0xb0, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0x28, 0xc4, 0x03, 0xbd,
- 0x01, 0x02, 0x04, 0x3f, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x01, 0x02, 0x02, 0x00, 0x00, 0x11,
- 0x03, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00,
- 0xd2, 0xb5, 0xaa, 0xea, 0x0b, 0xd1, 0xd2, 0x9c,
+ 0x00, 0xab, 0x11, 0xea, 0x10, 0x0e, 0x38, 0x9b,
+ 0x00, 0x00, 0x00, 0x42, 0xb5, 0x01, 0x00, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0x28, 0x04, 0x3f, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x01, 0x02, 0x02,
+ 0x00, 0x00, 0x11, 0xca, 0x03, 0xc2, 0x01, 0x06,
+ 0x03, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00,
+ 0xd2, 0xb5, 0xaa, 0xea, 0x0b, 0xd1, 0xd2, 0xb2,
  0xc9, 0xd2, 0xd5, 0xc5, 0xd6, 0xec, 0xf2, 0xd1,
- 0x28, 0xc4, 0x03, 0xc2, 0x01, 0x06, 0x04, 0x1c,
- 0x17, 0x0d, 0x0d, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x0c,
- 0x01, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xe2, 0x04,
+ 0x28, 0x04, 0x1c, 0x17, 0x0d, 0x0d, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01, 0x03,
+ 0x01, 0x00, 0x0c, 0xca, 0x03, 0xcb, 0x01, 0x01,
+ 0x01, 0xe2, 0x06, 0x00, 0x01, 0x00, 0xec, 0x04,
  0x05, 0x01, 0xd1, 0xb5, 0xa4, 0xea, 0x03, 0xb6,
- 0x28, 0xdd, 0xb6, 0xd1, 0xf0, 0x28, 0xc4, 0x03,
- 0xcb, 0x01, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x00, 0x02, 0x06, 0x02, 0x00, 0x35,
- 0x02, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xc0, 0x06,
- 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00, 0x00, 0xe2,
- 0x04, 0x05, 0x01, 0xd2, 0xb5, 0xa3, 0x11, 0xeb,
- 0x05, 0x0e, 0xd2, 0xd1, 0xa5, 0xea, 0x03, 0xb5,
- 0x28, 0xd2, 0xd1, 0xd2, 0x9e, 0xa5, 0xea, 0x05,
- 0xd1, 0xd2, 0x9e, 0xd6, 0xd2, 0xb5, 0xa9, 0xea,
- 0x03, 0xb6, 0x28, 0xdd, 0x42, 0xb1, 0x01, 0x00,
- 0x00, 0xde, 0xd1, 0xd2, 0x9e, 0xb6, 0x9d, 0xd1,
- 0xf0, 0xde, 0xb6, 0xd2, 0xf0, 0x25, 0x02, 0x00,
- 0xc4, 0x03, 0xcf, 0x01, 0x07, 0x03, 0x3f, 0x0d,
- 0x26, 0x17, 0x1c, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x06, 0x02, 0x04, 0x01, 0x00, 0x4b,
- 0x08, 0xe4, 0x06, 0x00, 0x01, 0x00, 0xe6, 0x06,
- 0x00, 0x01, 0x00, 0xe8, 0x06, 0x00, 0x00, 0x00,
- 0xea, 0x06, 0x00, 0x01, 0x00, 0xec, 0x06, 0x00,
- 0x02, 0x00, 0xba, 0x06, 0x00, 0x03, 0x00, 0xee,
- 0x06, 0x00, 0x04, 0x00, 0xda, 0x06, 0x00, 0x05,
- 0x00, 0xc6, 0x03, 0x00, 0x00, 0xd1, 0xca, 0xd2,
- 0xcb, 0xb6, 0xc3, 0x04, 0xb5, 0xcc, 0xc6, 0xb5,
- 0xaa, 0xea, 0x29, 0xdd, 0x42, 0xb8, 0x01, 0x00,
+ 0x28, 0xdd, 0xb6, 0xd1, 0xf0, 0x28, 0x03, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x00, 0x02, 0x06,
+ 0x01, 0x00, 0x39, 0xca, 0x03, 0xcf, 0x01, 0x07,
+ 0x02, 0xe2, 0x06, 0x00, 0x01, 0x00, 0xca, 0x06,
+ 0x00, 0x01, 0x00, 0xec, 0x04, 0x05, 0x01, 0xd2,
+ 0xb5, 0xa3, 0x11, 0xeb, 0x05, 0x0e, 0xd2, 0xd1,
+ 0xa5, 0xea, 0x03, 0xb5, 0x28, 0xd2, 0xd1, 0xd2,
+ 0x9e, 0xa5, 0xea, 0x05, 0xd1, 0xd2, 0x9e, 0xd6,
+ 0xd2, 0xb5, 0xa9, 0xea, 0x03, 0xb6, 0x28, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0x42, 0xb6, 0x01, 0x00,
+ 0x00, 0xdd, 0xd1, 0xd2, 0x9e, 0xb6, 0x9d, 0xd1,
+ 0xf0, 0xdd, 0xb6, 0xd2, 0xf0, 0x25, 0x02, 0x00,
+ 0x03, 0x3f, 0x0d, 0x26, 0x17, 0x1c, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x06, 0x02, 0x04,
+ 0x00, 0x00, 0x4f, 0xca, 0x03, 0xd9, 0x01, 0x10,
+ 0x08, 0xee, 0x06, 0x00, 0x01, 0x00, 0xf0, 0x06,
+ 0x00, 0x01, 0x00, 0xf2, 0x06, 0x00, 0x00, 0x00,
+ 0xf4, 0x06, 0x00, 0x01, 0x00, 0xf6, 0x06, 0x00,
+ 0x02, 0x00, 0xc4, 0x06, 0x00, 0x03, 0x00, 0xf8,
+ 0x06, 0x00, 0x04, 0x00, 0xe4, 0x06, 0x00, 0x05,
+ 0x00, 0xd1, 0xca, 0xd2, 0xcb, 0xb6, 0xc3, 0x04,
+ 0xb5, 0xcc, 0xc6, 0xb5, 0xaa, 0xea, 0x2d, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0x42, 0xbd, 0x01, 0x00,
  0x00, 0xc7, 0xc6, 0x24, 0x02, 0x00, 0xc4, 0x05,
  0xb5, 0x47, 0xc9, 0xc6, 0xcb, 0xc2, 0x05, 0xb6,
  0x47, 0xca, 0xc2, 0x04, 0xc3, 0x05, 0xc8, 0xc5,
  0xc2, 0x04, 0x9a, 0x9e, 0xc3, 0x04, 0xc2, 0x05,
- 0xcc, 0xec, 0xd4, 0xc7, 0xb6, 0xaa, 0xea, 0x0d,
- 0x38, 0xcc, 0x00, 0x00, 0x00, 0x04, 0xb9, 0x01,
- 0x00, 0x00, 0xef, 0x2f, 0xc8, 0xd2, 0x9c, 0x28,
- 0xc4, 0x03, 0xd9, 0x01, 0x10, 0x04, 0x0d, 0x0d,
- 0x12, 0x0d, 0x1c, 0x44, 0x12, 0x0d, 0x1c, 0x17,
- 0x2b, 0x12, 0x0e, 0x1c, 0x3f, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x03, 0x01, 0x03, 0x04, 0x01, 0x00,
- 0x3a, 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xf4, 0x06, 0x00, 0x01,
- 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0xc6, 0x03,
- 0x00, 0x00, 0xd2, 0xb5, 0xa9, 0xea, 0x03, 0xb6,
- 0x28, 0xd2, 0xb5, 0xa3, 0xea, 0x10, 0xdd, 0x42,
- 0xf4, 0x00, 0x00, 0x00, 0xd1, 0xd3, 0x24, 0x02,
+ 0xcc, 0xec, 0xd0, 0xc7, 0xb6, 0xaa, 0xea, 0x0d,
+ 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xbe, 0x01,
+ 0x00, 0x00, 0xef, 0x2f, 0xc8, 0xd2, 0xb2, 0x28,
+ 0x04, 0x0d, 0x0d, 0x12, 0x0d, 0x1c, 0x58, 0x12,
+ 0x0d, 0x1c, 0x17, 0x2b, 0x12, 0x0e, 0x1c, 0x3f,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x03, 0x01, 0x03,
+ 0x04, 0x00, 0x00, 0x3e, 0xca, 0x03, 0xee, 0x01,
+ 0x0e, 0x04, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xfe, 0x06, 0x00, 0x01,
+ 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xd2, 0xb5,
+ 0xa9, 0xea, 0x03, 0xb6, 0x28, 0xd2, 0xb5, 0xa3,
+ 0xea, 0x14, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42,
+ 0xf7, 0x00, 0x00, 0x00, 0xd1, 0xd3, 0x24, 0x02,
  0x00, 0xd5, 0xd2, 0x8c, 0xd6, 0xb6, 0xc9, 0xd2,
  0xb6, 0xad, 0xea, 0x07, 0xc5, 0xd1, 0x9a, 0xd3,
- 0x9c, 0xc9, 0xd2, 0xb6, 0xa1, 0xda, 0xb5, 0xa9,
- 0xeb, 0x09, 0xd1, 0xd1, 0x9a, 0xd3, 0x9c, 0xd5,
- 0xec, 0xe6, 0xc5, 0x28, 0xc4, 0x03, 0xee, 0x01,
- 0x0e, 0x04, 0x1c, 0x0d, 0x1c, 0x3f, 0x13, 0x0e,
- 0x1c, 0x22, 0x17, 0x0d, 0x0d, 0x21, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x03, 0x02, 0x03,
- 0x03, 0x00, 0x5e, 0x05, 0xd8, 0x06, 0x00, 0x01,
- 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
- 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x01, 0x00,
- 0xf6, 0x06, 0x00, 0x02, 0x00, 0xc6, 0x03, 0x00,
- 0x00, 0xde, 0x04, 0x03, 0x01, 0xe0, 0x04, 0x04,
- 0x01, 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38, 0xcf,
- 0x00, 0x00, 0x00, 0x04, 0xbc, 0x01, 0x00, 0x00,
+ 0xb2, 0xc9, 0xd2, 0xb6, 0xa1, 0xda, 0xb5, 0xa9,
+ 0xeb, 0x09, 0xd1, 0xd1, 0x9a, 0xd3, 0xb2, 0xd5,
+ 0xec, 0xe6, 0xc5, 0x28, 0x04, 0x1c, 0x0d, 0x1c,
+ 0x53, 0x13, 0x0e, 0x1c, 0x22, 0x17, 0x0d, 0x0d,
+ 0x21, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x02,
+ 0x03, 0x02, 0x03, 0x02, 0x00, 0x62, 0xca, 0x03,
+ 0x85, 0x02, 0x13, 0x05, 0xe2, 0x06, 0x00, 0x01,
+ 0x00, 0xe4, 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06,
+ 0x00, 0x00, 0x00, 0xe6, 0x06, 0x00, 0x01, 0x00,
+ 0x80, 0x07, 0x00, 0x02, 0x00, 0xe8, 0x04, 0x03,
+ 0x01, 0xea, 0x04, 0x04, 0x01, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0xc1, 0x01, 0x00, 0x00,
  0xef, 0x2f, 0xd1, 0xb6, 0xa4, 0xea, 0x03, 0x09,
- 0x28, 0xde, 0xe9, 0xcb, 0xb5, 0xc9, 0xc5, 0xc7,
- 0xa3, 0xea, 0x1f, 0xde, 0xc5, 0x47, 0xce, 0xd1,
+ 0x28, 0xdd, 0xe9, 0xcb, 0xb5, 0xc9, 0xc5, 0xc7,
+ 0xa3, 0xea, 0x1f, 0xdd, 0xc5, 0x47, 0xce, 0xd1,
  0xa9, 0xea, 0x03, 0x0a, 0x28, 0xc6, 0xd1, 0xa5,
- 0xea, 0x03, 0x09, 0x28, 0xd1, 0xc6, 0x9c, 0xb5,
+ 0xea, 0x03, 0x09, 0x28, 0xd1, 0xc6, 0xb2, 0xb5,
  0xa9, 0xea, 0x03, 0x09, 0x28, 0x93, 0x00, 0xec,
  0xde, 0xd1, 0xc6, 0xc6, 0x9a, 0xa3, 0xea, 0x03,
  0x0a, 0x28, 0xd2, 0xf4, 0xea, 0x04, 0xbd, 0x40,
- 0xd6, 0xdf, 0xd1, 0xd2, 0x23, 0x02, 0x00, 0xc4,
- 0x03, 0x85, 0x02, 0x13, 0x04, 0x44, 0x3f, 0x1c,
- 0x0d, 0x13, 0x26, 0x17, 0x17, 0x0d, 0x1c, 0x0d,
- 0x26, 0x0d, 0x17, 0x26, 0x0d, 0x17, 0x12, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03,
- 0x01, 0x00, 0x31, 0x01, 0xd8, 0x06, 0x00, 0x01,
- 0x00, 0xc6, 0x03, 0x00, 0x00, 0xdd, 0x42, 0x76,
+ 0xd6, 0xde, 0xd1, 0xd2, 0x23, 0x02, 0x00, 0x04,
+ 0x58, 0x3f, 0x1c, 0x0d, 0x13, 0x26, 0x17, 0x17,
+ 0x0d, 0x1c, 0x0d, 0x26, 0x0d, 0x17, 0x26, 0x0d,
+ 0x17, 0x12, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x03, 0x00, 0x00, 0x39, 0xca, 0x03,
+ 0x9c, 0x02, 0x08, 0x01, 0xe2, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x7b,
  0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x96,
- 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04,
- 0xbc, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xb6,
+ 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04,
+ 0xc1, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xb6,
  0xa3, 0xea, 0x03, 0xb6, 0xd5, 0xd1, 0x8f, 0xd5,
- 0xdd, 0x42, 0x29, 0x01, 0x00, 0x00, 0xd1, 0x24,
- 0x01, 0x00, 0xea, 0xf2, 0xd1, 0x28, 0xc4, 0x03,
- 0x9c, 0x02, 0x08, 0x03, 0x44, 0x3f, 0x1c, 0x0e,
- 0x12, 0x3f, 0x08, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0xab, 0x01,
- 0x03, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
- 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x01, 0x00,
- 0xc6, 0x03, 0x00, 0x00, 0xf6, 0x03, 0x09, 0x00,
- 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd1, 0x24,
- 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0xbc, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0x26, 0x00, 0x00, 0xc9, 0xde, 0xd1, 0xef,
- 0xb6, 0xa4, 0xea, 0x0e, 0xc5, 0x42, 0xa4, 0x01,
- 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e, 0xc5,
- 0x28, 0xd1, 0xb5, 0xa3, 0xea, 0x0f, 0xc5, 0x42,
- 0xa4, 0x01, 0x00, 0x00, 0xb4, 0x24, 0x01, 0x00,
- 0x0e, 0xd1, 0x8c, 0xd5, 0xd1, 0xb7, 0x9c, 0xb5,
- 0xa9, 0xea, 0x12, 0xd1, 0xb6, 0xa1, 0xd5, 0xc5,
- 0x42, 0xa4, 0x01, 0x00, 0x00, 0xb7, 0x24, 0x01,
- 0x00, 0x0e, 0xec, 0xe9, 0xb8, 0xca, 0xd1, 0xb6,
- 0xaa, 0xea, 0x47, 0xdd, 0x42, 0x29, 0x01, 0x00,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x2e, 0x01,
+ 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xea, 0xee,
+ 0xd1, 0x28, 0x03, 0x58, 0x3f, 0x1c, 0x0e, 0x12,
+ 0x53, 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x02, 0x01, 0x04, 0x00, 0x00, 0xbb, 0x01, 0xca,
+ 0x03, 0xa7, 0x02, 0x20, 0x03, 0xe2, 0x06, 0x00,
+ 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xe6,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe6, 0x00, 0x00,
+ 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38, 0xd2, 0x00,
+ 0x00, 0x00, 0x04, 0xc1, 0x01, 0x00, 0x00, 0xef,
+ 0x2f, 0x26, 0x00, 0x00, 0xc9, 0x38, 0xfe, 0x00,
+ 0x00, 0x00, 0xd1, 0xef, 0xb6, 0xa4, 0xea, 0x0e,
+ 0xc5, 0x42, 0xa9, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x0e, 0xc5, 0x28, 0xd1, 0xb5, 0xa3,
+ 0xea, 0x0f, 0xc5, 0x42, 0xa9, 0x01, 0x00, 0x00,
+ 0xb4, 0x24, 0x01, 0x00, 0x0e, 0xd1, 0x8c, 0xd5,
+ 0xd1, 0xb7, 0xb2, 0xb5, 0xa9, 0xea, 0x12, 0xd1,
+ 0xb6, 0xa1, 0xd5, 0xc5, 0x42, 0xa9, 0x01, 0x00,
+ 0x00, 0xb7, 0x24, 0x01, 0x00, 0x0e, 0xec, 0xe9,
+ 0xb8, 0xca, 0xd1, 0xb6, 0xaa, 0xea, 0x4f, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0x42, 0x2e, 0x01, 0x00,
  0x00, 0xd1, 0x24, 0x01, 0x00, 0xea, 0x0e, 0xc5,
- 0x42, 0xa4, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01,
- 0x00, 0x0e, 0xec, 0x2e, 0xd1, 0xc6, 0x9c, 0xb5,
+ 0x42, 0xa9, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01,
+ 0x00, 0x0e, 0xec, 0x32, 0xd1, 0xc6, 0xb2, 0xb5,
  0xa9, 0xeb, 0x06, 0xb7, 0x94, 0x01, 0xec, 0xf5,
- 0xc5, 0x42, 0xa4, 0x01, 0x00, 0x00, 0xc6, 0x24,
- 0x01, 0x00, 0x0e, 0xdd, 0x42, 0xb1, 0x01, 0x00,
- 0x00, 0xd1, 0xc6, 0x24, 0x02, 0x00, 0xd9, 0xc6,
- 0x9c, 0xb5, 0xaa, 0xeb, 0x03, 0xec, 0xe2, 0xec,
- 0xb6, 0xc5, 0x28, 0xc4, 0x03, 0xa7, 0x02, 0x20,
- 0x04, 0x44, 0x3f, 0x17, 0x26, 0x3a, 0x08, 0x08,
- 0x1c, 0x3a, 0x14, 0x26, 0x17, 0x3a, 0x0e, 0x0d,
- 0x1c, 0x3f, 0x3a, 0x00, 0x02, 0x08, 0x1c, 0x0d,
- 0x12, 0x0e, 0x3a, 0x3f, 0x17, 0x0d, 0x0d, 0x0d,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x02, 0x00, 0x00, 0x06, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0x08, 0xc9, 0xb6, 0xc5, 0x9b, 0x28, 0xc4,
- 0x03, 0xd2, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
- 0x06, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
- 0xc5, 0xc5, 0x9a, 0x28, 0xc4, 0x03, 0xd5, 0x02,
- 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x02, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x02, 0xec,
- 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xca, 0xc6, 0xcd, 0xb5, 0xa3, 0xea, 0x04,
- 0xc5, 0x8c, 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0xd8,
- 0x02, 0x04, 0x0d, 0x08, 0x1c, 0x12, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
- 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
- 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0xde, 0x02, 0x01,
- 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
- 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x10, 0x00,
- 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08, 0xc9,
- 0xc5, 0xb5, 0xa6, 0xea, 0x03, 0xb5, 0x28, 0xdd,
- 0x41, 0x28, 0x01, 0x00, 0x00, 0x28, 0xc4, 0x03,
- 0xe1, 0x02, 0x04, 0x0d, 0x1c, 0x08, 0x08, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
- 0x01, 0x00, 0x13, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0x08, 0xc9, 0xc5, 0xb5,
- 0xa9, 0xea, 0x03, 0xb6, 0x28, 0xdd, 0x42, 0x03,
- 0x01, 0x00, 0x00, 0xc5, 0x25, 0x01, 0x00, 0xc4,
- 0x03, 0xe7, 0x02, 0x04, 0x0d, 0x1c, 0x08, 0x08,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x02, 0x01, 0x00, 0x14, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08, 0xc9, 0xc5,
- 0xb6, 0xa9, 0xea, 0x03, 0xb5, 0x28, 0xdd, 0xc5,
- 0xef, 0x42, 0x04, 0x01, 0x00, 0x00, 0x25, 0x00,
- 0x00, 0xc4, 0x03, 0xed, 0x02, 0x04, 0x0d, 0x1c,
- 0x08, 0x08, 0x0e, 0x43, 0x06, 0x01, 0xca, 0x03,
- 0x02, 0x05, 0x02, 0x04, 0x01, 0x00, 0xc0, 0x01,
- 0x07, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x00,
- 0xd0, 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00,
- 0x02, 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xca,
- 0x03, 0x00, 0x01, 0x14, 0xc6, 0x03, 0x00, 0x00,
+ 0xc5, 0x42, 0xa9, 0x01, 0x00, 0x00, 0xc6, 0x24,
+ 0x01, 0x00, 0x0e, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x42, 0xb6, 0x01, 0x00, 0x00, 0xd1, 0xc6, 0x24,
+ 0x02, 0x00, 0xd9, 0xc6, 0xb2, 0xb5, 0xaa, 0xeb,
+ 0x03, 0xec, 0xde, 0xec, 0xae, 0xc5, 0x28, 0x04,
+ 0x58, 0x3f, 0x17, 0x3a, 0x3a, 0x08, 0x08, 0x1c,
+ 0x3a, 0x14, 0x26, 0x17, 0x3a, 0x0e, 0x0d, 0x1c,
+ 0x53, 0x3a, 0x00, 0x02, 0x08, 0x1c, 0x0d, 0x12,
+ 0x0e, 0x3a, 0x53, 0x17, 0x0d, 0x0d, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x00, 0x06, 0xca, 0x03, 0xd2, 0x02, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xb6,
+ 0xc5, 0x9b, 0x28, 0x0d, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x06,
+ 0xca, 0x03, 0xd5, 0x02, 0x01, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28,
+ 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x02,
+ 0x00, 0x02, 0x00, 0x00, 0x0d, 0xca, 0x03, 0xd8,
+ 0x02, 0x04, 0x02, 0xf6, 0x06, 0x00, 0x00, 0x00,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xca, 0xc6, 0xcd,
+ 0xb5, 0xa3, 0xea, 0x04, 0xc5, 0x8c, 0xc9, 0xc5,
+ 0x28, 0x0d, 0x08, 0x1c, 0x12, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+ 0x04, 0xca, 0x03, 0xde, 0x02, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x28, 0x0d,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x00, 0x14, 0xca, 0x03, 0xe1, 0x02,
+ 0x04, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
+ 0xc5, 0xb5, 0xa6, 0xea, 0x03, 0xb5, 0x28, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x41, 0x2d, 0x01, 0x00,
+ 0x00, 0x28, 0x0d, 0x1c, 0x08, 0x08, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x17, 0xca, 0x03, 0xe7, 0x02, 0x04, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xb5,
+ 0xa9, 0xea, 0x03, 0xb6, 0x28, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x06, 0x01, 0x00, 0x00, 0xc5,
+ 0x25, 0x01, 0x00, 0x0d, 0x1c, 0x08, 0x08, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x00, 0x18, 0xca, 0x03, 0xed, 0x02, 0x04,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5,
+ 0xb6, 0xa9, 0xea, 0x03, 0xb5, 0x28, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xc5, 0xef, 0x42, 0x07, 0x01,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x0d, 0x1c, 0x08,
+ 0x08, 0x0e, 0x43, 0x26, 0x05, 0xd0, 0x03, 0x02,
+ 0x05, 0x02, 0x04, 0x00, 0x00, 0xd4, 0x01, 0xca,
+ 0x03, 0xf7, 0x02, 0x1c, 0x07, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xe6,
+ 0x06, 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x01,
+ 0x00, 0xae, 0x06, 0x00, 0x02, 0x00, 0xe8, 0x01,
+ 0x00, 0x01, 0x00, 0xd0, 0x03, 0x00, 0x01, 0x14,
  0x0c, 0x03, 0xcc, 0x0c, 0x02, 0xc3, 0x04, 0xc8,
- 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04,
- 0xbd, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xc2,
- 0x04, 0xa7, 0xea, 0x03, 0xd1, 0x28, 0xdd, 0x42,
- 0x76, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
- 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0xbe, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd2,
- 0xf4, 0xea, 0x05, 0xb6, 0xd6, 0xec, 0x5e, 0xdd,
- 0x42, 0x76, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
- 0x00, 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00,
- 0x00, 0x04, 0xbe, 0x01, 0x00, 0x00, 0xef, 0x2f,
- 0xd2, 0xb5, 0xa9, 0xea, 0x0d, 0x38, 0xcc, 0x00,
- 0x00, 0x00, 0x04, 0xbf, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0xdd, 0x42, 0xf0, 0x00, 0x00, 0x00, 0xd1,
- 0xd2, 0x24, 0x02, 0x00, 0xcd, 0xb6, 0xaa, 0xea,
- 0x19, 0xdd, 0x42, 0xb1, 0x01, 0x00, 0x00, 0xd1,
- 0xc5, 0x24, 0x02, 0x00, 0xd5, 0xdd, 0x42, 0xb1,
- 0x01, 0x00, 0x00, 0xd2, 0xc5, 0x24, 0x02, 0x00,
- 0xd6, 0xd2, 0xb5, 0xa3, 0xea, 0x07, 0xd1, 0x8c,
- 0xd5, 0xd2, 0x8c, 0xd6, 0x38, 0x95, 0x00, 0x00,
- 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xc2, 0x04,
- 0x41, 0x3e, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
- 0xcf, 0xd1, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xc7,
- 0xd2, 0x43, 0xc1, 0x01, 0x00, 0x00, 0xc7, 0x28,
- 0xc4, 0x03, 0xf7, 0x02, 0x1c, 0x00, 0x07, 0x08,
- 0x12, 0x3f, 0x21, 0x0d, 0x44, 0x3f, 0x17, 0x0d,
- 0x0d, 0x44, 0x3f, 0x1c, 0x3f, 0x3f, 0x17, 0x3f,
- 0x00, 0x0c, 0x08, 0x1c, 0x12, 0x14, 0x6c, 0x21,
- 0x26, 0x0e, 0x43, 0x06, 0x01, 0xe4, 0x04, 0x02,
- 0x00, 0x02, 0x05, 0x01, 0x00, 0x39, 0x02, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
- 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd, 0xd1, 0xef,
- 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd, 0x42, 0x80,
- 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a,
- 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc0, 0x01, 0x00, 0x00, 0x9a, 0x9d, 0xd1, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc1, 0x01,
- 0x00, 0x00, 0x9a, 0x25, 0x02, 0x00, 0xc4, 0x03,
- 0x9a, 0x03, 0x03, 0x03, 0x17, 0x17, 0x0e, 0x43,
- 0x06, 0x01, 0xe6, 0x04, 0x02, 0x00, 0x02, 0x05,
- 0x01, 0x00, 0x39, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xca, 0x03,
- 0x07, 0x00, 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0xd2,
- 0xef, 0xd6, 0xdd, 0x42, 0x80, 0x01, 0x00, 0x00,
- 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0x9a, 0x9e, 0xd1, 0x41, 0xc1, 0x01, 0x00,
- 0x00, 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a,
- 0x25, 0x02, 0x00, 0xc4, 0x03, 0x9f, 0x03, 0x03,
- 0x03, 0x17, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xe8,
- 0x04, 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x2b,
- 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd,
- 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd,
- 0x42, 0x80, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0x9a, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a, 0x25,
- 0x02, 0x00, 0xc4, 0x03, 0xa4, 0x03, 0x03, 0x03,
- 0x17, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xea, 0x04,
- 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x2b, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd, 0xd1,
- 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd, 0x42,
- 0x80, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00,
- 0x9a, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9a, 0x25, 0x02,
- 0x00, 0xc4, 0x03, 0xa9, 0x03, 0x03, 0x03, 0x17,
- 0x17, 0x0e, 0x43, 0x06, 0x01, 0xec, 0x04, 0x02,
- 0x02, 0x02, 0x06, 0x02, 0x00, 0x30, 0x04, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
- 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x86, 0x07,
- 0x00, 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xc6,
- 0x03, 0x00, 0x00, 0xdd, 0xd1, 0xef, 0xc9, 0xdd,
- 0xd2, 0xef, 0xca, 0xd1, 0xde, 0x42, 0xc4, 0x01,
- 0x00, 0x00, 0xc5, 0x41, 0xc0, 0x01, 0x00, 0x00,
- 0xc6, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a, 0xc5,
- 0x41, 0xc1, 0x01, 0x00, 0x00, 0xc6, 0x41, 0xc0,
+ 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04,
+ 0xc2, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xc2,
+ 0x04, 0xa7, 0xea, 0x03, 0xd1, 0x28, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0xc3, 0x01, 0x00,
+ 0x00, 0xef, 0x2f, 0xd2, 0xf4, 0xea, 0x05, 0xb6,
+ 0xd6, 0xec, 0x6e, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x42, 0x7b, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
+ 0x00, 0x96, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00,
+ 0x00, 0x04, 0xc3, 0x01, 0x00, 0x00, 0xef, 0x2f,
+ 0xd2, 0xb5, 0xa9, 0xea, 0x0d, 0x38, 0xcf, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x01, 0x00, 0x00, 0xef,
+ 0x2f, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0xf3,
+ 0x00, 0x00, 0x00, 0xd1, 0xd2, 0x24, 0x02, 0x00,
+ 0xcd, 0xb6, 0xaa, 0xea, 0x21, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0xb6, 0x01, 0x00, 0x00, 0xd1,
+ 0xc5, 0x24, 0x02, 0x00, 0xd5, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0xb6, 0x01, 0x00, 0x00, 0xd2,
+ 0xc5, 0x24, 0x02, 0x00, 0xd6, 0xd2, 0xb5, 0xa3,
+ 0xea, 0x07, 0xd1, 0x8c, 0xd5, 0xd2, 0x8c, 0xd6,
+ 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xab, 0x01,
+ 0x00, 0x00, 0xc2, 0x04, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0xcf, 0xd1, 0x43, 0xc5,
+ 0x01, 0x00, 0x00, 0xc7, 0xd2, 0x43, 0xc6, 0x01,
+ 0x00, 0x00, 0xc7, 0x28, 0x00, 0x07, 0x08, 0x12,
+ 0x3f, 0x21, 0x0d, 0x58, 0x3f, 0x17, 0x0d, 0x0d,
+ 0x58, 0x3f, 0x1c, 0x3f, 0x53, 0x17, 0x53, 0x00,
+ 0x10, 0x08, 0x1c, 0x12, 0x14, 0x6c, 0x21, 0x26,
+ 0x0e, 0x43, 0x06, 0x05, 0xee, 0x04, 0x02, 0x00,
+ 0x02, 0x05, 0x00, 0x00, 0x45, 0xca, 0x03, 0x9a,
+ 0x03, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0xd1, 0xef, 0xd5, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0xd2, 0xef, 0xd6, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0x42, 0x85, 0x01, 0x00, 0x00, 0xd1,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xc6, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0x9a, 0x9d, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0x25,
+ 0x02, 0x00, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06,
+ 0x05, 0xf0, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00,
+ 0x00, 0x45, 0xca, 0x03, 0x9f, 0x03, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0xd5, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd2,
+ 0xef, 0xd6, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x42,
+ 0x85, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc5, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0x9a, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0x9a, 0x9e, 0xd1,
+ 0x41, 0xc6, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x9a, 0x25, 0x02, 0x00, 0x03,
+ 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xf2, 0x04,
+ 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x37, 0xca,
+ 0x03, 0xa4, 0x03, 0x03, 0x02, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd2, 0xef, 0xd6, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0x42, 0x85, 0x01, 0x00,
+ 0x00, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41,
+ 0xc6, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc6, 0x01,
+ 0x00, 0x00, 0x9a, 0x25, 0x02, 0x00, 0x03, 0x2b,
+ 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xf4, 0x04, 0x02,
+ 0x00, 0x02, 0x05, 0x00, 0x00, 0x37, 0xca, 0x03,
+ 0xa9, 0x03, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0xd2, 0xef, 0xd6, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0x42, 0x85, 0x01, 0x00, 0x00,
+ 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xc6, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0x9a, 0x25, 0x02, 0x00, 0x03, 0x2b, 0x2b,
+ 0x0e, 0x43, 0x06, 0x05, 0xf6, 0x04, 0x02, 0x02,
+ 0x02, 0x06, 0x00, 0x00, 0x3c, 0xca, 0x03, 0xae,
+ 0x03, 0x03, 0x04, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0x8e, 0x07, 0x00,
+ 0x00, 0x00, 0x90, 0x07, 0x00, 0x01, 0x00, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xc9, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd2, 0xef, 0xca, 0xd1,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0xc9, 0x01,
+ 0x00, 0x00, 0xc5, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0xc6, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0xc5,
+ 0x41, 0xc6, 0x01, 0x00, 0x00, 0xc6, 0x41, 0xc5,
  0x01, 0x00, 0x00, 0x9a, 0x24, 0x02, 0x00, 0xd2,
- 0x9a, 0x9e, 0x28, 0xc4, 0x03, 0xae, 0x03, 0x03,
- 0x03, 0x17, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xee,
- 0x04, 0x02, 0x00, 0x02, 0x02, 0x01, 0x00, 0x27,
- 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd,
- 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xd1,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f, 0x0e,
- 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xa9, 0x28, 0xc4, 0x03,
- 0xb3, 0x03, 0x03, 0x03, 0x17, 0x18, 0x0e, 0x43,
- 0x06, 0x01, 0xf0, 0x04, 0x02, 0x00, 0x02, 0x03,
- 0x01, 0x00, 0x24, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xca, 0x03,
- 0x07, 0x00, 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0xd2,
- 0xef, 0xd6, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a, 0xd2,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0x9a, 0xa3, 0x28, 0xc4, 0x03,
- 0xb9, 0x03, 0x03, 0x03, 0x17, 0x17, 0x0e, 0x43,
- 0x06, 0x01, 0xf2, 0x04, 0x02, 0x00, 0x02, 0x03,
- 0x01, 0x00, 0x08, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x08, 0x00, 0xdd, 0xd1, 0xef, 0xdd, 0xd2, 0xef,
- 0x9d, 0x28, 0xc4, 0x03, 0xc0, 0x03, 0x01, 0x03,
- 0x0e, 0x43, 0x06, 0x01, 0xf4, 0x04, 0x02, 0x00,
- 0x02, 0x03, 0x01, 0x00, 0x08, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0xdd, 0xd1, 0xef, 0xdd,
- 0xd2, 0xef, 0x9e, 0x28, 0xc4, 0x03, 0xc3, 0x03,
- 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xf6, 0x04,
- 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x08, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0xdd, 0xd1,
- 0xef, 0xdd, 0xd2, 0xef, 0x9a, 0x28, 0xc4, 0x03,
- 0xc6, 0x03, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
- 0xf8, 0x04, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x08, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00,
- 0xdd, 0xd1, 0xef, 0xdd, 0xd2, 0xef, 0x9b, 0x28,
- 0xc4, 0x03, 0xc9, 0x03, 0x01, 0x03, 0x0e, 0x43,
- 0x06, 0x01, 0xfa, 0x04, 0x02, 0x00, 0x02, 0x03,
- 0x01, 0x00, 0x08, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x08, 0x00, 0xdd, 0xd1, 0xef, 0xdd, 0xd2, 0xef,
- 0x9c, 0x28, 0xc4, 0x03, 0xcc, 0x03, 0x01, 0x03,
- 0x0e, 0x43, 0x06, 0x01, 0xfc, 0x04, 0x02, 0x00,
- 0x02, 0x03, 0x01, 0x00, 0x08, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0xdd, 0xd1, 0xef, 0xdd,
- 0xd2, 0xef, 0x9f, 0x28, 0xc4, 0x03, 0xcf, 0x03,
- 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xfe, 0x04,
- 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x08, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0xdd, 0xd1,
- 0xef, 0xdd, 0xd2, 0xef, 0xab, 0x28, 0xc4, 0x03,
- 0xd2, 0x03, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01,
- 0x80, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x2c, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00,
- 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6,
- 0xdd, 0x42, 0xc5, 0x01, 0x00, 0x00, 0xd1, 0x24,
- 0x01, 0x00, 0x11, 0xeb, 0x0c, 0x0e, 0xdd, 0x42,
- 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00,
+ 0x9a, 0x9e, 0x28, 0x03, 0x2b, 0x2b, 0x0e, 0x43,
+ 0x06, 0x05, 0xf8, 0x04, 0x02, 0x00, 0x02, 0x02,
+ 0x00, 0x00, 0x2f, 0xca, 0x03, 0xb3, 0x03, 0x03,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0xd5, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0xd6, 0xd1, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0xd2, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xa9,
+ 0x11, 0xea, 0x0f, 0x0e, 0xd1, 0x41, 0xc6, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xa9, 0x28, 0x03, 0x2b, 0x2c, 0x0e, 0x43, 0x06,
+ 0x05, 0xfa, 0x04, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x2c, 0xca, 0x03, 0xb9, 0x03, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0xd5, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd2,
+ 0xef, 0xd6, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0xd2,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x9a, 0xa3, 0x28, 0x03, 0x2b,
+ 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xfc, 0x04, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x10, 0xca, 0x03,
+ 0xc0, 0x03, 0x01, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xd2, 0xef, 0x9d, 0x28, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0xfe, 0x04, 0x02, 0x00, 0x02,
+ 0x03, 0x00, 0x00, 0x10, 0xca, 0x03, 0xc3, 0x03,
+ 0x01, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0x9e, 0x28, 0x03, 0x0e, 0x43, 0x06,
+ 0x05, 0x80, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x10, 0xca, 0x03, 0xc6, 0x03, 0x01, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd2, 0xef,
+ 0x9a, 0x28, 0x03, 0x0e, 0x43, 0x06, 0x05, 0x82,
+ 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x10,
+ 0xca, 0x03, 0xc9, 0x03, 0x01, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd2, 0xef, 0x9b, 0x28,
+ 0x03, 0x0e, 0x43, 0x06, 0x05, 0x84, 0x05, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x10, 0xca, 0x03,
+ 0xcc, 0x03, 0x01, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xd2, 0xef, 0xb2, 0x28, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0x86, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x00, 0x00, 0x10, 0xca, 0x03, 0xcf, 0x03,
+ 0x01, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0x9f, 0x28, 0x03, 0x0e, 0x43, 0x06,
+ 0x05, 0x88, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x10, 0xca, 0x03, 0xd2, 0x03, 0x01, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd2, 0xef,
+ 0xab, 0x28, 0x04, 0x0e, 0x43, 0x06, 0x05, 0x8a,
+ 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x3c,
+ 0xca, 0x03, 0xd6, 0x03, 0x06, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd2, 0xef, 0xd6,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0xca, 0x01,
+ 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x11, 0xeb,
+ 0x10, 0x0e, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0xca, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00,
  0xea, 0x07, 0x38, 0x48, 0x00, 0x00, 0x00, 0x28,
- 0xd1, 0xd2, 0xa3, 0x28, 0xc4, 0x03, 0xd6, 0x03,
- 0x06, 0x03, 0x17, 0x18, 0x85, 0x1c, 0x08, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
- 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd1, 0x28, 0xc4, 0x03, 0xea, 0x03, 0x01,
- 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x03, 0x01, 0x00, 0x11, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd,
- 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x8c, 0xd1,
- 0x41, 0xc1, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xc4, 0x03, 0xed, 0x03, 0x01, 0x03, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x02, 0x01, 0x02, 0x03, 0x01,
- 0x00, 0x1f, 0x03, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xca, 0x03, 0x07, 0x00, 0xdd, 0xd1,
- 0xd2, 0xf0, 0xc9, 0x38, 0x72, 0x01, 0x00, 0x00,
- 0xea, 0x12, 0xc5, 0x41, 0xc1, 0x01, 0x00, 0x00,
- 0xb6, 0xa9, 0xea, 0x08, 0xc5, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0x28, 0xc5, 0x28, 0xc4, 0x03, 0x8c,
- 0x04, 0x05, 0x03, 0x1c, 0x58, 0x21, 0x08, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02,
- 0x01, 0x00, 0x24, 0x02, 0x8c, 0x07, 0x00, 0x01,
- 0x00, 0x10, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08,
- 0x00, 0x08, 0xc9, 0xd1, 0x04, 0x4b, 0x00, 0x00,
- 0x00, 0xab, 0xea, 0x0a, 0xc5, 0x42, 0x3a, 0x00,
- 0x00, 0x00, 0x25, 0x00, 0x00, 0xdd, 0xc5, 0x41,
- 0xc0, 0x01, 0x00, 0x00, 0xef, 0xc5, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0x9b, 0x28, 0xc4, 0x03, 0x96,
- 0x04, 0x03, 0x0d, 0x30, 0x31, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00,
- 0x12, 0x01, 0x10, 0x00, 0x01, 0x00, 0xca, 0x03,
- 0x07, 0x00, 0x08, 0xc9, 0xdd, 0xc5, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0xc5, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03, 0x9d, 0x04,
- 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x02, 0x00, 0x00, 0x16, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0x04, 0x74, 0x01, 0x00, 0x00,
- 0x9d, 0xc5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9d,
- 0x28, 0xc4, 0x03, 0xa0, 0x04, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02,
- 0x00, 0x00, 0x06, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28, 0xc4, 0x03,
- 0xa3, 0x04, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x11,
+ 0xd1, 0xd2, 0xa3, 0x28, 0x03, 0x2b, 0x2c, 0xad,
+ 0x1c, 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0xca, 0x03,
+ 0xea, 0x03, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0x28, 0x03, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x15,
+ 0xca, 0x03, 0xed, 0x03, 0x01, 0x01, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0x8c, 0xd1,
+ 0x41, 0xc6, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x02, 0x01,
+ 0x02, 0x03, 0x00, 0x00, 0x23, 0xca, 0x03, 0x8c,
+ 0x04, 0x05, 0x03, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x00, 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd1,
+ 0xd2, 0xf0, 0xc9, 0x38, 0x77, 0x01, 0x00, 0x00,
+ 0xea, 0x12, 0xc5, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xb6, 0xa9, 0xea, 0x08, 0xc5, 0x41, 0xc5, 0x01,
+ 0x00, 0x00, 0x28, 0xc5, 0x28, 0x03, 0x30, 0x58,
+ 0x21, 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x01, 0x01, 0x02, 0x00, 0x00, 0x28, 0xca, 0x03,
+ 0x96, 0x04, 0x03, 0x02, 0x96, 0x07, 0x00, 0x01,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xd1,
+ 0x04, 0x4b, 0x00, 0x00, 0x00, 0xab, 0xea, 0x0a,
+ 0xc5, 0x42, 0x3a, 0x00, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xc5, 0x41,
+ 0xc5, 0x01, 0x00, 0x00, 0xef, 0xc5, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x9b, 0x28, 0x0d, 0x30, 0x31,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x16, 0xca, 0x03, 0x9d, 0x04,
+ 0x01, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0xc5, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0xc5, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x16, 0xca, 0x03, 0xa0, 0x04, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xc5,
+ 0x01, 0x00, 0x00, 0x04, 0x79, 0x01, 0x00, 0x00,
+ 0x9d, 0xc5, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9d,
+ 0x28, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0xca, 0x03,
+ 0xa3, 0x04, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x00, 0x11, 0xca, 0x03, 0xa6, 0x04, 0x04,
  0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0xb5, 0xa3, 0xea,
- 0x04, 0xc5, 0x8c, 0x28, 0xc5, 0x28, 0xc4, 0x03,
- 0xa6, 0x04, 0x04, 0x0d, 0x35, 0x0d, 0x08, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
- 0x00, 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0xac, 0x04,
- 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x02, 0x01, 0x00, 0x15, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08,
- 0xc9, 0xc5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xb5,
- 0xa6, 0xea, 0x03, 0xb5, 0x28, 0xdd, 0x41, 0x28,
- 0x01, 0x00, 0x00, 0x28, 0xc4, 0x03, 0xaf, 0x04,
- 0x04, 0x0d, 0x35, 0x08, 0x08, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00,
- 0x0e, 0x01, 0x10, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x08, 0x00, 0x08, 0xc9, 0xdd, 0x42, 0x03, 0x01,
- 0x00, 0x00, 0xdd, 0xc5, 0xef, 0x25, 0x01, 0x00,
- 0xc4, 0x03, 0xb5, 0x04, 0x01, 0x0d, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
- 0x00, 0x0d, 0x01, 0x10, 0x00, 0x01, 0x00, 0xc8,
- 0x03, 0x08, 0x00, 0x08, 0xc9, 0xdd, 0xc5, 0xef,
- 0x42, 0x04, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00,
- 0xc4, 0x03, 0xb8, 0x04, 0x01, 0x0d, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
- 0x00, 0x06, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
- 0xc9, 0xb6, 0xc5, 0x9b, 0x28, 0xc4, 0x03, 0xc0,
- 0x04, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xc5,
- 0x9a, 0x28, 0xc4, 0x03, 0xc3, 0x04, 0x01, 0x0d,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x03, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0x08, 0xc9, 0x38, 0x9d, 0x00, 0x00, 0x00,
- 0x42, 0xfb, 0x00, 0x00, 0x00, 0xc5, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0xc6, 0x04, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
- 0x00, 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0xc9, 0x04,
- 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x02, 0x01, 0x00, 0x10, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xb5, 0xa3, 0xea,
+ 0x04, 0xc5, 0x8c, 0x28, 0xc5, 0x28, 0x0d, 0x35,
+ 0x0d, 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0xca, 0x03,
+ 0xac, 0x04, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0xc5, 0x28, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x19, 0xca, 0x03, 0xaf, 0x04, 0x04, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xc5,
+ 0x01, 0x00, 0x00, 0xb5, 0xa6, 0xea, 0x03, 0xb5,
+ 0x28, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x41, 0x2d,
+ 0x01, 0x00, 0x00, 0x28, 0x0d, 0x35, 0x08, 0x08,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x04, 0x00, 0x00, 0x16, 0xca, 0x03, 0xb5, 0x04,
+ 0x01, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x06, 0x01,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xc5,
+ 0xef, 0x25, 0x01, 0x00, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x11, 0xca, 0x03, 0xb8, 0x04, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xc5, 0xef, 0x42, 0x07, 0x01, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x06, 0xca, 0x03, 0xc0, 0x04, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0xb6, 0xc5, 0x9b,
+ 0x28, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0xca, 0x03,
+ 0xc3, 0x04, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x10, 0xca, 0x03, 0xc6, 0x04, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38,
+ 0xa0, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00,
+ 0x00, 0xc5, 0x25, 0x01, 0x00, 0x0d, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x04, 0xca, 0x03, 0xc9, 0x04, 0x01, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x28,
+ 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x00, 0x00, 0x14, 0xca, 0x03, 0xcc,
+ 0x04, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
  0xc9, 0xc5, 0xb5, 0xa6, 0xea, 0x03, 0xb5, 0x28,
- 0xdd, 0x41, 0x28, 0x01, 0x00, 0x00, 0x28, 0xc4,
- 0x03, 0xcc, 0x04, 0x04, 0x0d, 0x1c, 0x08, 0x08,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x03, 0x01, 0x00, 0x0c, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08, 0xc9, 0xdd,
- 0x42, 0x03, 0x01, 0x00, 0x00, 0xc5, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0xd2, 0x04, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
- 0x02, 0x00, 0x1c, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0xcc, 0x03, 0x0a, 0x00, 0xc8, 0x03, 0x08, 0x00,
- 0x08, 0xc9, 0xc5, 0xb5, 0xa3, 0xea, 0x0c, 0xdd,
- 0xc5, 0xef, 0x42, 0x04, 0x01, 0x00, 0x00, 0x25,
- 0x00, 0x00, 0xde, 0x42, 0x04, 0x01, 0x00, 0x00,
- 0xc5, 0x25, 0x01, 0x00, 0xc4, 0x03, 0xd5, 0x04,
- 0x03, 0x0d, 0x1c, 0x3b, 0x0e, 0x43, 0x06, 0x01,
- 0x84, 0x05, 0x01, 0x03, 0x01, 0x05, 0x02, 0x01,
- 0xb0, 0x01, 0x04, 0xd8, 0x06, 0x00, 0x01, 0x00,
- 0xda, 0x06, 0x00, 0x00, 0x00, 0xee, 0x06, 0x00,
- 0x01, 0x00, 0x8e, 0x07, 0x00, 0x02, 0x00, 0x82,
- 0x05, 0x15, 0x01, 0xc8, 0x03, 0x08, 0x00, 0xdd,
- 0xd1, 0x47, 0xc9, 0x38, 0xb4, 0x00, 0x00, 0x00,
- 0x41, 0xc8, 0x01, 0x00, 0x00, 0xcb, 0xc5, 0xea,
- 0x12, 0xc5, 0x41, 0xc8, 0x01, 0x00, 0x00, 0xc7,
- 0xa9, 0xea, 0x08, 0xc5, 0x41, 0x95, 0x01, 0x00,
- 0x00, 0x28, 0xd1, 0x11, 0xb5, 0xab, 0xea, 0x0e,
- 0xde, 0x42, 0x03, 0x01, 0x00, 0x00, 0xb6, 0x24,
- 0x01, 0x00, 0xca, 0xec, 0x60, 0x11, 0xb6, 0xab,
- 0xea, 0x0f, 0xde, 0x42, 0x04, 0x01, 0x00, 0x00,
- 0xbd, 0x0a, 0x24, 0x01, 0x00, 0xca, 0xec, 0x4d,
- 0x11, 0xb8, 0xab, 0xea, 0x10, 0xb6, 0xde, 0x42,
- 0x04, 0x01, 0x00, 0x00, 0xb7, 0x24, 0x01, 0x00,
- 0x9b, 0xca, 0xec, 0x39, 0x11, 0xb9, 0xab, 0xea,
- 0x11, 0xb6, 0xde, 0x42, 0x04, 0x01, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x41, 0x2d, 0x01,
+ 0x00, 0x00, 0x28, 0x0d, 0x1c, 0x08, 0x08, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x10, 0xca, 0x03, 0xd2, 0x04, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x42, 0x06, 0x01, 0x00,
+ 0x00, 0xc5, 0x25, 0x01, 0x00, 0x0d, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x24, 0xca, 0x03, 0xd5, 0x04, 0x03, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xb5,
+ 0xa3, 0xea, 0x10, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0xc5, 0xef, 0x42, 0x07, 0x01, 0x00, 0x00, 0x25,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x07, 0x01, 0x00, 0x00, 0xc5, 0x25, 0x01, 0x00,
+ 0x0d, 0x1c, 0x4f, 0x0e, 0x43, 0x06, 0x05, 0x8e,
+ 0x05, 0x01, 0x03, 0x01, 0x05, 0x01, 0x01, 0xcb,
+ 0x01, 0xca, 0x03, 0xe3, 0x04, 0x10, 0x04, 0xe2,
+ 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00, 0x00,
+ 0x00, 0xf8, 0x06, 0x00, 0x01, 0x00, 0x98, 0x07,
+ 0x00, 0x02, 0x00, 0x8c, 0x05, 0x15, 0x01, 0xdd,
+ 0xd1, 0x47, 0xc9, 0x38, 0xb7, 0x00, 0x00, 0x00,
+ 0x41, 0xcd, 0x01, 0x00, 0x00, 0xcb, 0xc5, 0xea,
+ 0x12, 0xc5, 0x41, 0xcd, 0x01, 0x00, 0x00, 0xc7,
+ 0xa9, 0xea, 0x08, 0xc5, 0x41, 0x9a, 0x01, 0x00,
+ 0x00, 0x28, 0xd1, 0x11, 0xb5, 0xab, 0xea, 0x12,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x06, 0x01,
+ 0x00, 0x00, 0xb6, 0x24, 0x01, 0x00, 0xca, 0xec,
+ 0x77, 0x11, 0xb6, 0xab, 0xea, 0x13, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x07, 0x01, 0x00, 0x00,
+ 0xbd, 0x0a, 0x24, 0x01, 0x00, 0xca, 0xec, 0x60,
+ 0x11, 0xb8, 0xab, 0xea, 0x14, 0xb6, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x07, 0x01, 0x00, 0x00,
+ 0xb7, 0x24, 0x01, 0x00, 0x9b, 0xca, 0xec, 0x48,
+ 0x11, 0xb9, 0xab, 0xea, 0x15, 0xb6, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x07, 0x01, 0x00, 0x00,
  0xbd, 0x0a, 0x24, 0x01, 0x00, 0x9b, 0xca, 0xec,
- 0x24, 0x11, 0xbb, 0xab, 0xea, 0x0f, 0xde, 0x42,
- 0x02, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x24, 0x01,
- 0x00, 0xca, 0xec, 0x11, 0x11, 0xbc, 0xab, 0xea,
- 0x0c, 0xde, 0x42, 0x02, 0x01, 0x00, 0x00, 0xb7,
- 0x24, 0x01, 0x00, 0xca, 0x0e, 0xc7, 0xbe, 0x00,
- 0x04, 0xa4, 0xea, 0x12, 0xdd, 0xd1, 0x71, 0x0b,
- 0xc7, 0x4c, 0xc8, 0x01, 0x00, 0x00, 0xc6, 0x4c,
- 0x95, 0x01, 0x00, 0x00, 0x49, 0xc6, 0x28, 0xc4,
- 0x03, 0xe3, 0x04, 0x10, 0x04, 0x17, 0x3a, 0x44,
- 0x21, 0x08, 0x08, 0x5d, 0x63, 0x67, 0x6d, 0x62,
- 0x53, 0x08, 0x26, 0x59, 0x06, 0x00, 0x00, 0x00,
- 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x15, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1,
- 0x97, 0x04, 0x49, 0x00, 0x00, 0x00, 0xab, 0x11,
- 0xeb, 0x0a, 0x0e, 0xd1, 0x97, 0x04, 0x8f, 0x00,
- 0x00, 0x00, 0xab, 0x28, 0xc4, 0x03, 0xfc, 0x04,
- 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02,
- 0x07, 0x02, 0x04, 0x03, 0x00, 0x51, 0x09, 0xea,
- 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
- 0x00, 0x92, 0x07, 0x00, 0x00, 0x00, 0x94, 0x07,
- 0x00, 0x01, 0x00, 0x96, 0x07, 0x00, 0x02, 0x00,
- 0x98, 0x07, 0x00, 0x03, 0x00, 0x80, 0x07, 0x00,
- 0x04, 0x00, 0x82, 0x07, 0x00, 0x05, 0x00, 0xd8,
- 0x06, 0x00, 0x06, 0x00, 0xc6, 0x03, 0x00, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0xca, 0x03, 0x07, 0x00,
- 0xd2, 0xf4, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00,
- 0x00, 0x04, 0xcd, 0x01, 0x00, 0x00, 0xef, 0x2f,
+ 0x2f, 0x11, 0xbb, 0xab, 0xea, 0x16, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x05, 0x01, 0x00, 0x00,
+ 0xbf, 0x00, 0xbd, 0xed, 0xb1, 0x24, 0x01, 0x00,
+ 0xca, 0xec, 0x15, 0x11, 0xbc, 0xab, 0xea, 0x10,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x05, 0x01,
+ 0x00, 0x00, 0xb7, 0x24, 0x01, 0x00, 0xca, 0x0e,
+ 0xc7, 0xbe, 0x00, 0x04, 0xa4, 0xea, 0x12, 0xdd,
+ 0xd1, 0x71, 0x0b, 0xc7, 0x4c, 0xcd, 0x01, 0x00,
+ 0x00, 0xc6, 0x4c, 0x9a, 0x01, 0x00, 0x00, 0x49,
+ 0xc6, 0x28, 0x04, 0x17, 0x3a, 0x44, 0x21, 0x08,
+ 0x08, 0x71, 0x77, 0x7b, 0x81, 0x85, 0x67, 0x08,
+ 0x26, 0x59, 0x0b, 0x88, 0x02, 0x06, 0xe8, 0x89,
+ 0x04, 0x23, 0xc7, 0x8a, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x15,
+ 0xca, 0x03, 0xfc, 0x04, 0x01, 0x01, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xd1, 0x97, 0x04, 0x49, 0x00,
+ 0x00, 0x00, 0xab, 0x11, 0xeb, 0x0a, 0x0e, 0xd1,
+ 0x97, 0x04, 0x8f, 0x00, 0x00, 0x00, 0xab, 0x28,
+ 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x02, 0x07,
+ 0x02, 0x04, 0x00, 0x01, 0x61, 0xca, 0x03, 0xff,
+ 0x04, 0x12, 0x09, 0xf4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0x9c, 0x07, 0x00,
+ 0x00, 0x00, 0x9e, 0x07, 0x00, 0x01, 0x00, 0xa0,
+ 0x07, 0x00, 0x02, 0x00, 0xa2, 0x07, 0x00, 0x03,
+ 0x00, 0x8a, 0x07, 0x00, 0x04, 0x00, 0x8c, 0x07,
+ 0x00, 0x05, 0x00, 0xe2, 0x06, 0x00, 0x06, 0x00,
+ 0xd2, 0xf4, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00,
+ 0x00, 0x04, 0xd2, 0x01, 0x00, 0x00, 0xef, 0x2f,
  0xb6, 0xc9, 0xb5, 0xca, 0xb5, 0xcb, 0xb6, 0xcc,
- 0xdd, 0xde, 0x42, 0x00, 0x01, 0x00, 0x00, 0xd1,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x03, 0x01, 0x00, 0x00, 0xd1,
  0x24, 0x01, 0x00, 0xef, 0xc4, 0x06, 0xc5, 0x9a,
  0xc6, 0x9d, 0xc3, 0x04, 0xc2, 0x06, 0xc7, 0x9a,
- 0xc8, 0x9d, 0xc4, 0x05, 0xd2, 0xa5, 0xeb, 0x14,
- 0xb6, 0xd1, 0xc2, 0x06, 0x9e, 0x9b, 0xd5, 0xc5,
- 0xca, 0xc2, 0x04, 0xc9, 0xc7, 0xcc, 0xc2, 0x05,
- 0xcb, 0xec, 0xce, 0xdf, 0xc5, 0xc7, 0x23, 0x02,
- 0x00, 0xc4, 0x03, 0xff, 0x04, 0x12, 0x05, 0x17,
- 0x3f, 0x0d, 0x0d, 0x0d, 0x0e, 0x49, 0x21, 0x2b,
- 0x0d, 0x0d, 0x26, 0x0d, 0x12, 0x0d, 0x12, 0x0d,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
- 0x02, 0x01, 0x00, 0x05, 0x00, 0x84, 0x05, 0x16,
- 0x01, 0xdd, 0xb5, 0x23, 0x01, 0x00, 0xc4, 0x03,
- 0x97, 0x05, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00,
- 0x84, 0x05, 0x16, 0x01, 0xdd, 0xb6, 0x23, 0x01,
- 0x00, 0xc4, 0x03, 0x98, 0x05, 0x00, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
- 0x00, 0x05, 0x00, 0x84, 0x05, 0x16, 0x01, 0xdd,
- 0xb8, 0x23, 0x01, 0x00, 0xc4, 0x03, 0x9a, 0x05,
- 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00,
- 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x84, 0x05,
- 0x16, 0x01, 0xdd, 0xb9, 0x23, 0x01, 0x00, 0xc4,
- 0x03, 0x9b, 0x05, 0x00, 0x0e, 0x42, 0x07, 0x01,
+ 0xc8, 0x9d, 0xc4, 0x05, 0xd2, 0xa5, 0xeb, 0x18,
+ 0xbf, 0x00, 0xbd, 0xee, 0xb1, 0xd1, 0xc2, 0x06,
+ 0x9e, 0x9b, 0xd5, 0xc5, 0xca, 0xc2, 0x04, 0xc9,
+ 0xc7, 0xcc, 0xc2, 0x05, 0xcb, 0xec, 0xc2, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xc5, 0xc7, 0x23, 0x02,
+ 0x00, 0x05, 0x17, 0x3f, 0x0d, 0x0d, 0x0d, 0x0e,
+ 0x71, 0x21, 0x2b, 0x0d, 0x0d, 0x3a, 0x0d, 0x12,
+ 0x0d, 0x12, 0x0d, 0x0b, 0xfc, 0x01, 0x06, 0x40,
+ 0x76, 0x3a, 0x6b, 0x0b, 0xde, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+ 0x05, 0xca, 0x03, 0x97, 0x05, 0x00, 0x00, 0x8e,
+ 0x05, 0x16, 0x01, 0xdd, 0xb5, 0x23, 0x01, 0x00,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00,
+ 0x02, 0x01, 0x00, 0x05, 0xca, 0x03, 0x98, 0x05,
+ 0x00, 0x00, 0x8e, 0x05, 0x16, 0x01, 0xdd, 0xb6,
+ 0x23, 0x01, 0x00, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0xca,
+ 0x03, 0x9a, 0x05, 0x00, 0x00, 0x8e, 0x05, 0x16,
+ 0x01, 0xdd, 0xb8, 0x23, 0x01, 0x00, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
+ 0x00, 0x05, 0xca, 0x03, 0x9b, 0x05, 0x00, 0x00,
+ 0x8e, 0x05, 0x16, 0x01, 0xdd, 0xb9, 0x23, 0x01,
+ 0x00, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0x01, 0x00, 0x05, 0xca, 0x03, 0x9d,
+ 0x05, 0x00, 0x00, 0x8e, 0x05, 0x16, 0x01, 0xdd,
+ 0xbb, 0x23, 0x01, 0x00, 0x0e, 0x42, 0x27, 0x05,
  0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05,
- 0x00, 0x84, 0x05, 0x16, 0x01, 0xdd, 0xbb, 0x23,
- 0x01, 0x00, 0xc4, 0x03, 0x9d, 0x05, 0x00, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
- 0x01, 0x00, 0x05, 0x00, 0x84, 0x05, 0x16, 0x01,
- 0xdd, 0xbc, 0x23, 0x01, 0x00, 0xc4, 0x03, 0x9e,
- 0x05, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0x08, 0xc9, 0xb6, 0xc5, 0x9b,
- 0x28, 0xc4, 0x03, 0xa2, 0x05, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02,
- 0x00, 0x00, 0x06, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28, 0xc4, 0x03,
- 0xa5, 0x05, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0c,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08,
- 0x00, 0x08, 0xc9, 0xdd, 0x42, 0xfb, 0x00, 0x00,
- 0x00, 0xc5, 0x25, 0x01, 0x00, 0xc4, 0x03, 0xa8,
- 0x05, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+ 0xca, 0x03, 0x9e, 0x05, 0x00, 0x00, 0x8e, 0x05,
+ 0x16, 0x01, 0xdd, 0xbc, 0x23, 0x01, 0x00, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x01, 0x0a, 0xca, 0x03, 0xa2, 0x05, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xbf,
+ 0x00, 0xbd, 0xee, 0xb1, 0xc5, 0x9b, 0x28, 0x0d,
+ 0x0b, 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a, 0x6b,
+ 0x0b, 0xde, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0xca, 0x03,
+ 0xa5, 0x05, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0xc5, 0xc5, 0x9a, 0x28, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x10, 0xca, 0x03, 0xa8, 0x05, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00,
+ 0x00, 0xc5, 0x25, 0x01, 0x00, 0x0d, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x04, 0xca, 0x03, 0xab, 0x05, 0x01, 0x01,
  0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x28,
- 0xc4, 0x03, 0xab, 0x05, 0x01, 0x0d, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01,
- 0x00, 0x10, 0x01, 0x10, 0x00, 0x01, 0x00, 0xc8,
- 0x03, 0x08, 0x00, 0x08, 0xc9, 0xc5, 0xb5, 0xa6,
- 0xea, 0x03, 0xb5, 0x28, 0xdd, 0x41, 0x28, 0x01,
- 0x00, 0x00, 0x28, 0xc4, 0x03, 0xae, 0x05, 0x04,
- 0x0d, 0x1c, 0x08, 0x08, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0c,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08,
- 0x00, 0x08, 0xc9, 0xdd, 0x42, 0x03, 0x01, 0x00,
- 0x00, 0xc5, 0x25, 0x01, 0x00, 0xc4, 0x03, 0xb4,
- 0x05, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x03, 0x02, 0x00, 0x1c, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0x08, 0xc9, 0xc5, 0xb5,
- 0xa3, 0xea, 0x0c, 0xdd, 0xc5, 0xef, 0x42, 0x04,
- 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xde, 0x42,
- 0x04, 0x01, 0x00, 0x00, 0xc5, 0x25, 0x01, 0x00,
- 0xc4, 0x03, 0xb7, 0x05, 0x03, 0x0d, 0x1c, 0x3b,
- 0x0e, 0x43, 0x06, 0x01, 0xcc, 0x03, 0x02, 0x03,
- 0x02, 0x03, 0x00, 0x00, 0x45, 0x05, 0x9c, 0x07,
- 0x00, 0x01, 0x00, 0x9e, 0x07, 0x00, 0x01, 0x00,
- 0xa4, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00,
- 0x01, 0x00, 0xcc, 0x03, 0x00, 0x01, 0x14, 0x0c,
+ 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x00, 0x00, 0x14, 0xca, 0x03, 0xae,
+ 0x05, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc9, 0xc5, 0xb5, 0xa6, 0xea, 0x03, 0xb5, 0x28,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x41, 0x2d, 0x01,
+ 0x00, 0x00, 0x28, 0x0d, 0x1c, 0x08, 0x08, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x10, 0xca, 0x03, 0xb4, 0x05, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x42, 0x06, 0x01, 0x00,
+ 0x00, 0xc5, 0x25, 0x01, 0x00, 0x0d, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x24, 0xca, 0x03, 0xb7, 0x05, 0x03, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xb5,
+ 0xa3, 0xea, 0x10, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0xc5, 0xef, 0x42, 0x07, 0x01, 0x00, 0x00, 0x25,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x07, 0x01, 0x00, 0x00, 0xc5, 0x25, 0x01, 0x00,
+ 0x0d, 0x1c, 0x4f, 0x0e, 0x43, 0x26, 0x05, 0xd2,
+ 0x03, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00, 0x45,
+ 0xca, 0x03, 0xc2, 0x05, 0x0a, 0x05, 0xa6, 0x07,
+ 0x00, 0x01, 0x00, 0xa8, 0x07, 0x00, 0x01, 0x00,
+ 0xae, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00,
+ 0x01, 0x00, 0xd2, 0x03, 0x00, 0x01, 0x14, 0x0c,
  0x03, 0xca, 0x0c, 0x02, 0xcb, 0xc6, 0xea, 0x0d,
- 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xbd, 0x01,
+ 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x01,
  0x00, 0x00, 0xef, 0x2f, 0xd1, 0xc7, 0xa7, 0xea,
  0x03, 0xd1, 0x28, 0xd2, 0xf4, 0xea, 0x03, 0xb5,
- 0xd6, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa6,
+ 0xd6, 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xab,
  0x01, 0x00, 0x00, 0xc7, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0xcd, 0xd1, 0x43, 0xce,
- 0x01, 0x00, 0x00, 0xc5, 0xd2, 0x43, 0xcf, 0x01,
- 0x00, 0x00, 0xc5, 0x28, 0xc4, 0x03, 0xc2, 0x05,
- 0x0a, 0x23, 0x12, 0x3f, 0x1c, 0x0d, 0x17, 0x0e,
- 0x67, 0x21, 0x26, 0x0e, 0x43, 0x06, 0x01, 0x86,
- 0x05, 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x2b,
- 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a, 0x00, 0xdd,
- 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd,
- 0x42, 0x89, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xce,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xce, 0x01, 0x00,
- 0x00, 0x9d, 0xd1, 0x41, 0xcf, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xcf, 0x01, 0x00, 0x00, 0x9d, 0x25,
- 0x02, 0x00, 0xc4, 0x03, 0xd3, 0x05, 0x03, 0x03,
- 0x17, 0x17, 0x0e, 0x43, 0x06, 0x01, 0x88, 0x05,
- 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x2b, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xcc, 0x03, 0x0a, 0x00, 0xdd, 0xd1,
- 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd, 0x42,
- 0x89, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xce, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xce, 0x01, 0x00, 0x00,
- 0x9e, 0xd1, 0x41, 0xcf, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xcf, 0x01, 0x00, 0x00, 0x9e, 0x25, 0x02,
- 0x00, 0xc4, 0x03, 0xd8, 0x05, 0x03, 0x03, 0x17,
- 0x17, 0x0e, 0x43, 0x06, 0x01, 0x8a, 0x05, 0x02,
- 0x00, 0x02, 0x06, 0x01, 0x00, 0x47, 0x02, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
- 0x00, 0xcc, 0x03, 0x0a, 0x00, 0xdd, 0xd1, 0xef,
- 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xdd, 0x42, 0x89,
- 0x01, 0x00, 0x00, 0xd1, 0x41, 0xce, 0x01, 0x00,
- 0x00, 0xd2, 0x41, 0xce, 0x01, 0x00, 0x00, 0x9a,
- 0xd1, 0x41, 0xcf, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xcf, 0x01, 0x00, 0x00, 0x9a, 0x9e, 0xd1, 0x41,
- 0xce, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xcf, 0x01,
- 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xcf, 0x01, 0x00,
- 0x00, 0xd2, 0x41, 0xce, 0x01, 0x00, 0x00, 0x9a,
- 0x9d, 0x25, 0x02, 0x00, 0xc4, 0x03, 0xdd, 0x05,
- 0x04, 0x03, 0x17, 0x17, 0xa8, 0x0e, 0x43, 0x06,
- 0x01, 0x8c, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01,
- 0x00, 0x14, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a,
- 0x00, 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef,
- 0xd6, 0xd1, 0xd2, 0x42, 0xfe, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0x9a, 0x28, 0xc4, 0x03, 0xe3,
- 0x05, 0x03, 0x03, 0x17, 0x17, 0x0e, 0x43, 0x06,
- 0x01, 0x8e, 0x05, 0x02, 0x00, 0x02, 0x02, 0x01,
- 0x00, 0x27, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a,
- 0x00, 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef,
- 0xd6, 0xd1, 0x41, 0xce, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xce, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea,
- 0x0f, 0x0e, 0xd1, 0x41, 0xcf, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xcf, 0x01, 0x00, 0x00, 0xa9, 0x28,
- 0xc4, 0x03, 0xe8, 0x05, 0x03, 0x03, 0x17, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01,
- 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xd1, 0x28, 0xc4, 0x03, 0xf6, 0x05,
- 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x00, 0x01, 0x03, 0x01, 0x00, 0x12, 0x01, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a, 0x00,
- 0xdd, 0xd1, 0x41, 0xce, 0x01, 0x00, 0x00, 0x8c,
- 0xd1, 0x41, 0xcf, 0x01, 0x00, 0x00, 0x8c, 0x23,
- 0x02, 0x00, 0xc4, 0x03, 0xf9, 0x05, 0x01, 0x03,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x00, 0x02,
- 0x03, 0x01, 0x00, 0x14, 0x02, 0x9c, 0x07, 0x00,
- 0x01, 0x00, 0x9e, 0x07, 0x00, 0x01, 0x00, 0xcc,
- 0x03, 0x0a, 0x00, 0x38, 0x72, 0x01, 0x00, 0x00,
- 0xea, 0x08, 0xd2, 0xb5, 0xa9, 0xea, 0x03, 0xd1,
- 0x28, 0xdd, 0xd1, 0xd2, 0x23, 0x02, 0x00, 0xc4,
- 0x03, 0x8a, 0x06, 0x04, 0x03, 0x3f, 0x08, 0x08,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x02, 0x00,
- 0x04, 0x01, 0x00, 0x21, 0x02, 0xee, 0x06, 0x00,
- 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xcc, 0x03,
- 0x0a, 0x00, 0x08, 0xca, 0xc6, 0x42, 0xfa, 0x00,
- 0x00, 0x00, 0x24, 0x00, 0x00, 0xc9, 0xdd, 0xc6,
- 0x41, 0xce, 0x01, 0x00, 0x00, 0xc5, 0x9b, 0xc6,
- 0x41, 0xcf, 0x01, 0x00, 0x00, 0x8c, 0xc5, 0x9b,
- 0x23, 0x02, 0x00, 0xc4, 0x03, 0x93, 0x06, 0x02,
- 0x0d, 0x35, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x04, 0x00, 0x03, 0x00, 0x00, 0x83, 0x01, 0x04,
- 0xec, 0x06, 0x00, 0x00, 0x00, 0xde, 0x06, 0x00,
- 0x01, 0x00, 0xba, 0x06, 0x00, 0x02, 0x00, 0x10,
+ 0x00, 0x24, 0x01, 0x00, 0xcd, 0xd1, 0x43, 0xd3,
+ 0x01, 0x00, 0x00, 0xc5, 0xd2, 0x43, 0xd4, 0x01,
+ 0x00, 0x00, 0xc5, 0x28, 0x23, 0x12, 0x3f, 0x1c,
+ 0x0d, 0x17, 0x0e, 0x67, 0x21, 0x26, 0x0e, 0x43,
+ 0x06, 0x05, 0x90, 0x05, 0x02, 0x00, 0x02, 0x05,
+ 0x00, 0x00, 0x37, 0xca, 0x03, 0xd3, 0x05, 0x03,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0xd5, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0xd6, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0x42, 0x8e, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xd3,
+ 0x01, 0x00, 0x00, 0xd2, 0x41, 0xd3, 0x01, 0x00,
+ 0x00, 0x9d, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9d, 0x25,
+ 0x02, 0x00, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06,
+ 0x05, 0x92, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00,
+ 0x00, 0x37, 0xca, 0x03, 0xd8, 0x05, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0xd5, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd2,
+ 0xef, 0xd6, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x42,
+ 0x8e, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xd3, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xd3, 0x01, 0x00, 0x00,
+ 0x9e, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9e, 0x25, 0x02,
+ 0x00, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05,
+ 0x94, 0x05, 0x02, 0x00, 0x02, 0x06, 0x00, 0x00,
+ 0x53, 0xca, 0x03, 0xdd, 0x05, 0x04, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xd5, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd2, 0xef,
+ 0xd6, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x42, 0x8e,
+ 0x01, 0x00, 0x00, 0xd1, 0x41, 0xd3, 0x01, 0x00,
+ 0x00, 0xd2, 0x41, 0xd3, 0x01, 0x00, 0x00, 0x9a,
+ 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xd4, 0x01, 0x00, 0x00, 0x9a, 0x9e, 0xd1, 0x41,
+ 0xd3, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xd4, 0x01, 0x00,
+ 0x00, 0xd2, 0x41, 0xd3, 0x01, 0x00, 0x00, 0x9a,
+ 0x9d, 0x25, 0x02, 0x00, 0x03, 0x2b, 0x2b, 0xbc,
+ 0x0e, 0x43, 0x06, 0x05, 0x96, 0x05, 0x02, 0x00,
+ 0x02, 0x03, 0x00, 0x00, 0x1c, 0xca, 0x03, 0xe3,
+ 0x05, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xd1, 0xef, 0xd5, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xd2, 0xef, 0xd6, 0xd1, 0xd2, 0x42,
+ 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9a,
+ 0x28, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05,
+ 0x98, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
+ 0x2f, 0xca, 0x03, 0xe8, 0x05, 0x03, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xd5, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd2, 0xef,
+ 0xd6, 0xd1, 0x41, 0xd3, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xd3, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea,
+ 0x0f, 0x0e, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xa9, 0x28,
+ 0x03, 0x2b, 0x2b, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0xca,
+ 0x03, 0xf6, 0x05, 0x01, 0x01, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xd1, 0x28, 0x03, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00,
+ 0x16, 0xca, 0x03, 0xf9, 0x05, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xd1, 0x41, 0xd3, 0x01, 0x00, 0x00, 0x8c,
+ 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x8c, 0x23,
+ 0x02, 0x00, 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x18, 0xca,
+ 0x03, 0x8a, 0x06, 0x04, 0x02, 0xa6, 0x07, 0x00,
+ 0x01, 0x00, 0xa8, 0x07, 0x00, 0x01, 0x00, 0x38,
+ 0x77, 0x01, 0x00, 0x00, 0xea, 0x08, 0xd2, 0xb5,
+ 0xa9, 0xea, 0x03, 0xd1, 0x28, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xd1, 0xd2, 0x23, 0x02, 0x00, 0x03,
+ 0x3f, 0x08, 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x25, 0xca,
+ 0x03, 0x93, 0x06, 0x02, 0x02, 0xf8, 0x06, 0x00,
+ 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xca,
+ 0xc6, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xc9, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xc6,
+ 0x41, 0xd3, 0x01, 0x00, 0x00, 0xc5, 0x9b, 0xc6,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0x8c, 0xc5, 0x9b,
+ 0x23, 0x02, 0x00, 0x0d, 0x35, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+ 0x83, 0x01, 0xca, 0x03, 0x97, 0x06, 0x0f, 0x04,
+ 0xf6, 0x06, 0x00, 0x00, 0x00, 0xe8, 0x06, 0x00,
+ 0x01, 0x00, 0xc4, 0x06, 0x00, 0x02, 0x00, 0x10,
  0x00, 0x01, 0x00, 0x08, 0xcc, 0xc1, 0xca, 0xc8,
- 0xcf, 0x41, 0xce, 0x01, 0x00, 0x00, 0xb5, 0xaa,
- 0xea, 0x12, 0xc6, 0xc7, 0x41, 0xce, 0x01, 0x00,
+ 0xcf, 0x41, 0xd3, 0x01, 0x00, 0x00, 0xb5, 0xaa,
+ 0xea, 0x12, 0xc6, 0xc7, 0x41, 0xd3, 0x01, 0x00,
  0x00, 0x42, 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00,
- 0x00, 0x9d, 0xca, 0xc7, 0x41, 0xcf, 0x01, 0x00,
+ 0x00, 0x9d, 0xca, 0xc7, 0x41, 0xd4, 0x01, 0x00,
  0x00, 0xb6, 0xa9, 0xea, 0x16, 0xc6, 0xc1, 0xaa,
- 0xea, 0x08, 0x04, 0x77, 0x01, 0x00, 0x00, 0x94,
- 0x01, 0x04, 0xed, 0x00, 0x00, 0x00, 0x94, 0x01,
- 0xec, 0x43, 0xc7, 0x41, 0xcf, 0x01, 0x00, 0x00,
- 0xb4, 0xa9, 0xea, 0x0a, 0x04, 0xd0, 0x01, 0x00,
- 0x00, 0x94, 0x01, 0xec, 0x30, 0xc7, 0x41, 0xcf,
+ 0xea, 0x08, 0x04, 0x7c, 0x01, 0x00, 0x00, 0x94,
+ 0x01, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x94, 0x01,
+ 0xec, 0x43, 0xc7, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xb4, 0xa9, 0xea, 0x0a, 0x04, 0xd5, 0x01, 0x00,
+ 0x00, 0x94, 0x01, 0xec, 0x30, 0xc7, 0x41, 0xd4,
  0x01, 0x00, 0x00, 0x42, 0x3a, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xcd, 0xb5, 0x47, 0x04, 0x78,
+ 0x24, 0x00, 0x00, 0xcd, 0xb5, 0x47, 0x04, 0x7d,
  0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d, 0xc6, 0xc1,
- 0xaa, 0xea, 0x08, 0x04, 0x77, 0x01, 0x00, 0x00,
- 0x94, 0x01, 0xc6, 0xc5, 0x04, 0xd1, 0x01, 0x00,
- 0x00, 0x9d, 0x9d, 0xca, 0xc6, 0x28, 0xc4, 0x03,
- 0x97, 0x06, 0x0f, 0x0d, 0x12, 0x35, 0x58, 0x35,
- 0x1c, 0x26, 0x26, 0x3f, 0x26, 0x0d, 0x4e, 0x4e,
- 0x26, 0x36, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x03, 0x00, 0x00, 0x1e, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xce,
- 0x01, 0x00, 0x00, 0xc5, 0x41, 0xce, 0x01, 0x00,
- 0x00, 0x9a, 0xc5, 0x41, 0xcf, 0x01, 0x00, 0x00,
- 0xc5, 0x41, 0xcf, 0x01, 0x00, 0x00, 0x9a, 0x9d,
- 0x28, 0xc4, 0x03, 0xa9, 0x06, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04,
- 0x02, 0x00, 0x0e, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x08, 0x00, 0xf4, 0x03, 0x0b, 0x00,
- 0x08, 0xc9, 0xdd, 0x42, 0x02, 0x01, 0x00, 0x00,
- 0xde, 0xc5, 0xef, 0x25, 0x01, 0x00, 0xc4, 0x03,
- 0xac, 0x06, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x13,
- 0x01, 0x10, 0x00, 0x01, 0x00, 0xcc, 0x03, 0x0a,
- 0x00, 0x08, 0xc9, 0xdd, 0xc5, 0x41, 0xce, 0x01,
- 0x00, 0x00, 0xc5, 0x41, 0xcf, 0x01, 0x00, 0x00,
- 0x8c, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xaf, 0x06,
- 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x04, 0x01, 0x00, 0x17, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xc8, 0x03, 0x08, 0x00, 0x08,
- 0xc9, 0xdd, 0x42, 0x0f, 0x01, 0x00, 0x00, 0xc5,
- 0x41, 0xcf, 0x01, 0x00, 0x00, 0xc5, 0x41, 0xce,
- 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0xc4, 0x03,
- 0xb2, 0x06, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x03, 0x00, 0x05, 0x03, 0x00, 0x26,
- 0x03, 0xfa, 0x03, 0x00, 0x00, 0x00, 0xd0, 0x06,
- 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xcc,
- 0x03, 0x0a, 0x00, 0x94, 0x04, 0x0c, 0x00, 0x92,
- 0x04, 0x0d, 0x00, 0x08, 0xcb, 0xc7, 0x41, 0xcf,
- 0x01, 0x00, 0x00, 0xc9, 0xc7, 0x41, 0xce, 0x01,
- 0x00, 0x00, 0x42, 0x03, 0x01, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xca, 0xdd, 0xc6, 0xde, 0xc5, 0xef,
- 0x9a, 0xc6, 0xdf, 0xc5, 0xef, 0x9a, 0x23, 0x02,
- 0x00, 0xc4, 0x03, 0xb5, 0x06, 0x02, 0x0d, 0x71,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x05, 0x03, 0x00, 0x1f, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0xcc, 0x03, 0x0a, 0x00, 0xf6, 0x03, 0x09,
- 0x00, 0x9e, 0x04, 0x0e, 0x00, 0x08, 0xc9, 0xdd,
- 0xde, 0xc5, 0xef, 0x42, 0x04, 0x01, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xdf, 0xc5, 0x41, 0xcf, 0x01,
- 0x00, 0x00, 0xc5, 0x41, 0xce, 0x01, 0x00, 0x00,
- 0xf0, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xb9, 0x06,
- 0x01, 0x0d, 0x0e, 0x43, 0x06, 0x01, 0xce, 0x03,
- 0x02, 0x04, 0x02, 0x03, 0x02, 0x00, 0x96, 0x01,
- 0x06, 0xba, 0x06, 0x00, 0x01, 0x00, 0xf4, 0x06,
- 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x00,
- 0xda, 0x06, 0x00, 0x01, 0x00, 0xe8, 0x01, 0x00,
- 0x01, 0x00, 0xce, 0x03, 0x00, 0x01, 0x14, 0xc6,
- 0x03, 0x00, 0x00, 0xca, 0x03, 0x07, 0x00, 0x0c,
+ 0xaa, 0xea, 0x08, 0x04, 0x7c, 0x01, 0x00, 0x00,
+ 0x94, 0x01, 0xc6, 0xc5, 0x04, 0xd6, 0x01, 0x00,
+ 0x00, 0x9d, 0x9d, 0xca, 0xc6, 0x28, 0x0d, 0x12,
+ 0x35, 0x58, 0x35, 0x1c, 0x26, 0x26, 0x3f, 0x26,
+ 0x0d, 0x4e, 0x4e, 0x26, 0x36, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00,
+ 0x1e, 0xca, 0x03, 0xa9, 0x06, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xd3,
+ 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd3, 0x01, 0x00,
+ 0x00, 0x9a, 0xc5, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xc5, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9a, 0x9d,
+ 0x28, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x04, 0x00, 0x00, 0x16, 0xca, 0x03,
+ 0xac, 0x06, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x05, 0x01, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00,
+ 0x00, 0xc5, 0xef, 0x25, 0x01, 0x00, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x17, 0xca, 0x03, 0xaf, 0x06, 0x01,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38,
+ 0xe9, 0x00, 0x00, 0x00, 0xc5, 0x41, 0xd3, 0x01,
+ 0x00, 0x00, 0xc5, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0x8c, 0x23, 0x02, 0x00, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
+ 0x1b, 0xca, 0x03, 0xb2, 0x06, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x12, 0x01, 0x00, 0x00, 0xc5,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd3,
+ 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x03, 0x00, 0x05,
+ 0x00, 0x00, 0x32, 0xca, 0x03, 0xb5, 0x06, 0x02,
+ 0x03, 0x80, 0x04, 0x00, 0x00, 0x00, 0xda, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcb, 0xc7, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xc9,
+ 0xc7, 0x41, 0xd3, 0x01, 0x00, 0x00, 0x42, 0x06,
+ 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xca, 0x38,
+ 0xe9, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x0d, 0x01,
+ 0x00, 0x00, 0xc5, 0xef, 0x9a, 0xc6, 0x38, 0x0c,
+ 0x01, 0x00, 0x00, 0xc5, 0xef, 0x9a, 0x23, 0x02,
+ 0x00, 0x0d, 0x71, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x2b, 0xca,
+ 0x03, 0xb9, 0x06, 0x01, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xc9, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0x38, 0xfe, 0x00, 0x00, 0x00, 0xc5, 0xef, 0x42,
+ 0x07, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x38,
+ 0x12, 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xc5, 0x41, 0xd3, 0x01, 0x00, 0x00,
+ 0xf0, 0x23, 0x02, 0x00, 0x0d, 0x0e, 0x43, 0x26,
+ 0x05, 0xd4, 0x03, 0x02, 0x04, 0x02, 0x03, 0x00,
+ 0x00, 0xa2, 0x01, 0xca, 0x03, 0xc0, 0x06, 0x12,
+ 0x06, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xfe, 0x06,
+ 0x00, 0x01, 0x00, 0xae, 0x06, 0x00, 0x00, 0x00,
+ 0xe4, 0x06, 0x00, 0x01, 0x00, 0xe8, 0x01, 0x00,
+ 0x01, 0x00, 0xd4, 0x03, 0x00, 0x01, 0x14, 0x0c,
  0x03, 0xcb, 0x0c, 0x02, 0xcc, 0xc7, 0xea, 0x0d,
- 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xbd, 0x01,
- 0x00, 0x00, 0xef, 0x2f, 0x38, 0x95, 0x00, 0x00,
- 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xc8, 0x41,
+ 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x01,
+ 0x00, 0x00, 0xef, 0x2f, 0x38, 0x98, 0x00, 0x00,
+ 0x00, 0x42, 0xab, 0x01, 0x00, 0x00, 0xc8, 0x41,
  0x3e, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc9,
- 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd2, 0x24,
- 0x01, 0x00, 0xea, 0x46, 0xd2, 0xb5, 0xa4, 0xea,
- 0x0d, 0x38, 0xcc, 0x00, 0x00, 0x00, 0x04, 0xd2,
- 0x01, 0x00, 0x00, 0xef, 0x2f, 0xdd, 0x42, 0x76,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x7b, 0x01,
+ 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xea, 0x4e,
+ 0xd2, 0xb5, 0xa4, 0xea, 0x0d, 0x38, 0xcf, 0x00,
+ 0x00, 0x00, 0x04, 0xd7, 0x01, 0x00, 0x00, 0xef,
+ 0x2f, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x7b,
  0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xea,
- 0x07, 0xd1, 0xd2, 0x9c, 0xd5, 0xec, 0x2f, 0xd1,
- 0xde, 0xa7, 0xea, 0x12, 0xc8, 0xd1, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0xd2, 0xf0, 0xd1, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0x9b, 0x28, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0xd3, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xd3,
- 0x01, 0x00, 0x00, 0xef, 0x2f, 0xc5, 0xd1, 0x43,
- 0xd4, 0x01, 0x00, 0x00, 0xc5, 0xd2, 0x43, 0xd5,
- 0x01, 0x00, 0x00, 0xc5, 0x28, 0xc4, 0x03, 0xc0,
- 0x06, 0x12, 0x22, 0x12, 0x3f, 0x67, 0x3f, 0x1c,
- 0x3f, 0x3f, 0x17, 0x26, 0x53, 0x08, 0x3b, 0x08,
- 0x3a, 0x08, 0x26, 0x26, 0x0e, 0x43, 0x06, 0x01,
- 0x90, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x62, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xce, 0x03, 0x0f, 0x00,
- 0xd1, 0xdd, 0xa7, 0x96, 0xea, 0x13, 0xdd, 0xd1,
- 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9d, 0xd2,
- 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xd2, 0xdd, 0xa7, 0x96, 0xea, 0x13, 0xdd, 0xd1,
- 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2, 0x9d, 0xd1,
- 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d, 0x38,
- 0xcf, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x01, 0x00,
- 0x00, 0xef, 0x2f, 0xdd, 0xd1, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00,
- 0x9d, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xc4, 0x03, 0xd7, 0x06, 0x07, 0x03,
- 0x21, 0x5d, 0x21, 0x5e, 0x4e, 0x3f, 0x0e, 0x43,
- 0x06, 0x01, 0x92, 0x05, 0x02, 0x00, 0x02, 0x03,
- 0x01, 0x00, 0x62, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xce, 0x03,
- 0x0f, 0x00, 0xd1, 0xdd, 0xa7, 0x96, 0xea, 0x13,
- 0xdd, 0xd1, 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00,
- 0x9e, 0xd2, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xd2, 0xdd, 0xa7, 0x96, 0xea, 0x13,
- 0xdd, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2,
- 0x9e, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xaa, 0xea,
- 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xd6,
- 0x01, 0x00, 0x00, 0xef, 0x2f, 0xdd, 0xd1, 0x41,
- 0xd4, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0x9e, 0xd1, 0x41, 0xd5, 0x01, 0x00,
- 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xe2, 0x06,
- 0x07, 0x03, 0x21, 0x5d, 0x21, 0x5e, 0x4e, 0x3f,
- 0x0e, 0x43, 0x06, 0x01, 0x94, 0x05, 0x02, 0x00,
- 0x02, 0x03, 0x01, 0x00, 0x62, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xce, 0x03, 0x0f, 0x00, 0xd1, 0xdd, 0xa7, 0x96,
- 0xea, 0x13, 0xdd, 0xd1, 0xd2, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0x9a, 0xd2, 0x41, 0xd5, 0x01, 0x00,
- 0x00, 0x23, 0x02, 0x00, 0xd2, 0xdd, 0xa7, 0x96,
- 0xea, 0x13, 0xdd, 0xd1, 0x41, 0xd4, 0x01, 0x00,
- 0x00, 0xd2, 0x9a, 0xd1, 0x41, 0xd5, 0x01, 0x00,
- 0x00, 0x23, 0x02, 0x00, 0xd1, 0x41, 0xd5, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xd5, 0x01, 0x00, 0x00,
- 0xaa, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0xd6, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xdd,
- 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xd4, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xd5,
- 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xed, 0x06, 0x07, 0x03, 0x21, 0x5d, 0x21, 0x5e,
- 0x4e, 0x3f, 0x0e, 0x43, 0x06, 0x01, 0x96, 0x05,
- 0x02, 0x00, 0x02, 0x04, 0x02, 0x00, 0x1e, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xce, 0x03, 0x0f, 0x00, 0x94, 0x05,
- 0x1e, 0x01, 0xd2, 0xdd, 0xa7, 0x96, 0xea, 0x0b,
- 0xdd, 0xd2, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00,
- 0xf0, 0xd6, 0xde, 0xd1, 0xd2, 0x42, 0xfe, 0x00,
+ 0x07, 0xd1, 0xd2, 0xb2, 0xd5, 0xec, 0x33, 0xd1,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0xa7, 0xea, 0x12,
+ 0xc8, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2,
+ 0xf0, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9b,
+ 0x28, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xd8,
+ 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38, 0xd2, 0x00,
+ 0x00, 0x00, 0x04, 0xd8, 0x01, 0x00, 0x00, 0xef,
+ 0x2f, 0xc5, 0xd1, 0x43, 0xd9, 0x01, 0x00, 0x00,
+ 0xc5, 0xd2, 0x43, 0xda, 0x01, 0x00, 0x00, 0xc5,
+ 0x28, 0x22, 0x12, 0x3f, 0x67, 0x53, 0x1c, 0x3f,
+ 0x53, 0x17, 0x3a, 0x53, 0x08, 0x3b, 0x08, 0x3a,
+ 0x08, 0x26, 0x26, 0x0e, 0x43, 0x06, 0x05, 0x9a,
+ 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x76,
+ 0xca, 0x03, 0xd7, 0x06, 0x07, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0x38, 0xea, 0x00, 0x00, 0x00, 0xa7, 0x96,
+ 0xea, 0x17, 0x38, 0xea, 0x00, 0x00, 0x00, 0xd1,
+ 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00, 0x9d, 0xd2,
+ 0x41, 0xda, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd2, 0x38, 0xea, 0x00, 0x00, 0x00, 0xa7, 0x96,
+ 0xea, 0x17, 0x38, 0xea, 0x00, 0x00, 0x00, 0xd1,
+ 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2, 0x9d, 0xd1,
+ 0x41, 0xda, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xda, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0xdb, 0x01, 0x00,
+ 0x00, 0xef, 0x2f, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xd9, 0x01, 0x00, 0x00, 0x9d, 0xd1, 0x41, 0xda,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x03, 0x35,
+ 0x71, 0x35, 0x72, 0x4e, 0x3f, 0x0e, 0x43, 0x06,
+ 0x05, 0x9c, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x76, 0xca, 0x03, 0xe2, 0x06, 0x07, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0xd1, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x17, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0xd1, 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00,
+ 0x9e, 0xd2, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd2, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x17, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2,
+ 0x9e, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xda, 0x01, 0x00, 0x00, 0xaa, 0xea,
+ 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xdb,
+ 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00, 0x9e, 0xd1,
+ 0x41, 0xda, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0x03, 0x35, 0x71, 0x35, 0x72, 0x4e, 0x3f, 0x0e,
+ 0x43, 0x06, 0x05, 0x9e, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x00, 0x00, 0x76, 0xca, 0x03, 0xed, 0x06,
+ 0x07, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xd1, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0xa7, 0x96, 0xea, 0x17, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0xd1, 0xd2, 0x41, 0xd9, 0x01,
+ 0x00, 0x00, 0x9a, 0xd2, 0x41, 0xda, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd2, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0xa7, 0x96, 0xea, 0x17, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0xd1, 0x41, 0xd9, 0x01, 0x00,
+ 0x00, 0xd2, 0x9a, 0xd1, 0x41, 0xda, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd1, 0x41, 0xda, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xaa, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00,
+ 0x04, 0xdb, 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0xd1, 0x41, 0xd9, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00,
+ 0x9a, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0x03, 0x35, 0x71, 0x35, 0x72, 0x4e,
+ 0x3f, 0x0e, 0x43, 0x06, 0x05, 0xa0, 0x05, 0x02,
+ 0x00, 0x02, 0x04, 0x01, 0x00, 0x26, 0xca, 0x03,
+ 0xf8, 0x06, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x9e, 0x05,
+ 0x1e, 0x01, 0xd2, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x0f, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0xd2, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xf0, 0xd6, 0xdd, 0xd1, 0xd2, 0x42, 0x01, 0x01,
  0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xc4, 0x03, 0xf8, 0x06, 0x03, 0x03, 0x21, 0x35,
- 0x0e, 0x43, 0x06, 0x01, 0x98, 0x05, 0x02, 0x00,
- 0x02, 0x02, 0x00, 0x00, 0x1f, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f,
- 0x0e, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xd4, 0x01, 0x00, 0x00, 0xa9, 0x28, 0xc4,
- 0x03, 0xfd, 0x06, 0x01, 0x03, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
- 0x02, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1,
- 0x28, 0xc4, 0x03, 0x89, 0x07, 0x01, 0x03, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03,
- 0x01, 0x00, 0x11, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xce, 0x03, 0x0f, 0x00, 0xdd, 0xd1, 0x41,
- 0xd4, 0x01, 0x00, 0x00, 0x8c, 0xd1, 0x41, 0xd5,
- 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0x8c, 0x07, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x03, 0x00, 0x05, 0x02, 0x00, 0x37,
- 0x03, 0xba, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x06,
- 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xc6,
- 0x03, 0x00, 0x00, 0xce, 0x03, 0x0f, 0x00, 0x08,
- 0xcb, 0xc7, 0xcd, 0x41, 0xd5, 0x01, 0x00, 0x00,
- 0xca, 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xc6,
- 0x24, 0x01, 0x00, 0xea, 0x16, 0xde, 0xdd, 0x42,
- 0xf4, 0x00, 0x00, 0x00, 0xc5, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0xc6, 0x24, 0x02, 0x00, 0xc6, 0x23,
- 0x02, 0x00, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04,
- 0xd7, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xc4, 0x03,
- 0x9b, 0x07, 0x04, 0x0d, 0x2b, 0x3f, 0x6d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02,
- 0x00, 0x00, 0x22, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc9, 0x04, 0xd8, 0x01, 0x00, 0x00, 0xc5,
- 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9d, 0x04, 0xd9,
- 0x01, 0x00, 0x00, 0x9d, 0xc5, 0x41, 0xd5, 0x01,
- 0x00, 0x00, 0x9d, 0x04, 0xda, 0x01, 0x00, 0x00,
- 0x9d, 0x28, 0xc4, 0x03, 0xa3, 0x07, 0x01, 0x0d,
- 0x0e, 0x43, 0x06, 0x01, 0x9a, 0x05, 0x01, 0x00,
- 0x01, 0x02, 0x03, 0x00, 0x3b, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xca, 0x03, 0x07, 0x00, 0xcc,
- 0x03, 0x0a, 0x00, 0xce, 0x03, 0x0f, 0x00, 0xd1,
+ 0x03, 0x35, 0x49, 0x0e, 0x43, 0x06, 0x05, 0xa2,
+ 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x1f,
+ 0xca, 0x03, 0xfd, 0x06, 0x01, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xda, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f,
+ 0x0e, 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xd9, 0x01, 0x00, 0x00, 0xa9, 0x28, 0x03,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x02, 0xca, 0x03, 0x89, 0x07,
+ 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1,
+ 0x28, 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x03, 0x00, 0x00, 0x15, 0xca, 0x03,
+ 0x8c, 0x07, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0xd1, 0x41,
+ 0xd9, 0x01, 0x00, 0x00, 0x8c, 0xd1, 0x41, 0xda,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x03, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x03, 0x00, 0x05,
+ 0x00, 0x00, 0x43, 0xca, 0x03, 0x9b, 0x07, 0x04,
+ 0x03, 0xc4, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcb, 0xc7, 0xcd, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xca, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x7b,
+ 0x01, 0x00, 0x00, 0xc6, 0x24, 0x01, 0x00, 0xea,
+ 0x1e, 0x38, 0xea, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x42, 0xf7, 0x00, 0x00, 0x00,
+ 0xc5, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xc6, 0x24,
+ 0x02, 0x00, 0xc6, 0x23, 0x02, 0x00, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0xdc, 0x01, 0x00, 0x00,
+ 0xef, 0x2f, 0x0d, 0x2b, 0x53, 0x95, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x22, 0xca, 0x03, 0xa3, 0x07, 0x01, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x04, 0xdd,
+ 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd9, 0x01, 0x00,
+ 0x00, 0x9d, 0x04, 0xde, 0x01, 0x00, 0x00, 0x9d,
+ 0xc5, 0x41, 0xda, 0x01, 0x00, 0x00, 0x9d, 0x04,
+ 0xdf, 0x01, 0x00, 0x00, 0x9d, 0x28, 0x0d, 0x0e,
+ 0x43, 0x06, 0x05, 0xa4, 0x05, 0x01, 0x00, 0x01,
+ 0x02, 0x00, 0x00, 0x47, 0xca, 0x03, 0xaa, 0x07,
+ 0x09, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1,
  0x97, 0x04, 0x49, 0x00, 0x00, 0x00, 0xab, 0x11,
  0xeb, 0x16, 0x0e, 0xd1, 0x97, 0x04, 0x8e, 0x00,
  0x00, 0x00, 0xab, 0x11, 0xeb, 0x0a, 0x0e, 0xd1,
  0x97, 0x04, 0x8f, 0x00, 0x00, 0x00, 0xab, 0xea,
- 0x03, 0x0a, 0x28, 0xd1, 0xdd, 0xa7, 0x11, 0xeb,
- 0x0c, 0x0e, 0xd1, 0xde, 0xa7, 0x11, 0xeb, 0x05,
- 0x0e, 0xd1, 0xdf, 0xa7, 0xea, 0x03, 0x0a, 0x28,
- 0x09, 0x28, 0xc4, 0x03, 0xaa, 0x07, 0x09, 0x04,
- 0x3f, 0x3f, 0x35, 0x0d, 0x26, 0x26, 0x1c, 0x0d,
- 0x0e, 0x43, 0x06, 0x01, 0xd0, 0x03, 0x01, 0x02,
- 0x01, 0x04, 0x01, 0x00, 0x82, 0x01, 0x03, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x01,
- 0x00, 0xd0, 0x03, 0x00, 0x01, 0x14, 0x9a, 0x05,
- 0x21, 0x01, 0x0c, 0x03, 0xc9, 0x0c, 0x02, 0xca,
- 0xc5, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0xbd, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1,
- 0xc6, 0xa7, 0xea, 0x03, 0xd1, 0x28, 0x38, 0x96,
- 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0xea, 0x2a, 0xd1, 0xe9,
- 0xb5, 0xa9, 0xea, 0x06, 0xb5, 0x26, 0x01, 0x00,
- 0xd5, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0x63,
- 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd1, 0x42,
- 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xdd,
- 0xd1, 0xef, 0xea, 0x1d, 0xd1, 0x26, 0x01, 0x00,
- 0xd5, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0x63,
- 0x00, 0x00, 0x00, 0xd1, 0xc6, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd1, 0x28,
- 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xbc, 0x01,
- 0x00, 0x00, 0xef, 0x2f, 0xc4, 0x03, 0xb7, 0x07,
- 0x0f, 0x22, 0x12, 0x3f, 0x1c, 0x08, 0x58, 0x21,
- 0x1c, 0x6c, 0x30, 0x1c, 0x1c, 0x6c, 0x08, 0x08,
- 0x0e, 0x43, 0x06, 0x01, 0x9c, 0x05, 0x01, 0x00,
- 0x01, 0x03, 0x04, 0x00, 0x34, 0x01, 0xee, 0x06,
- 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00, 0x00, 0xc8,
- 0x03, 0x08, 0x00, 0xca, 0x03, 0x07, 0x00, 0xcc,
- 0x03, 0x0a, 0x00, 0xdd, 0x42, 0x76, 0x01, 0x00,
- 0x00, 0xd1, 0x24, 0x01, 0x00, 0x11, 0xeb, 0x26,
- 0x0e, 0xde, 0x42, 0x82, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0x11, 0xeb, 0x18, 0x0e, 0xd1,
- 0xdf, 0xa7, 0x11, 0xeb, 0x11, 0x0e, 0xd1, 0xe0,
- 0xa7, 0x11, 0xea, 0x0a, 0x0e, 0xd1, 0x41, 0xce,
- 0x01, 0x00, 0x00, 0xb5, 0xa9, 0x96, 0x28, 0xc4,
- 0x03, 0xcb, 0x07, 0x04, 0x04, 0x49, 0x49, 0x26,
- 0x0e, 0x43, 0x06, 0x01, 0x9e, 0x05, 0x02, 0x01,
- 0x02, 0x03, 0x01, 0x00, 0x63, 0x03, 0xee, 0x06,
- 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
- 0xb6, 0x07, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x22,
- 0x01, 0xd2, 0xb5, 0xa9, 0xea, 0x0d, 0xd1, 0x42,
- 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc9,
- 0xec, 0x51, 0xd1, 0xb6, 0xa9, 0xea, 0x05, 0xc1,
- 0xc9, 0xec, 0x32, 0xd1, 0xb4, 0xa9, 0xea, 0x09,
- 0x04, 0x78, 0x01, 0x00, 0x00, 0xc9, 0xec, 0x25,
- 0xdd, 0xd1, 0xef, 0xea, 0x11, 0x04, 0xdc, 0x01,
- 0x00, 0x00, 0xd1, 0x9d, 0x04, 0xda, 0x01, 0x00,
- 0x00, 0x9d, 0xc9, 0xec, 0x09, 0x38, 0x99, 0x00,
- 0x00, 0x00, 0xd1, 0xef, 0xc9, 0x04, 0x80, 0x00,
- 0x00, 0x00, 0x94, 0x00, 0x04, 0xee, 0x00, 0x00,
- 0x00, 0x94, 0x00, 0xd2, 0xb6, 0xaa, 0xea, 0x0b,
- 0xc5, 0x04, 0xdd, 0x01, 0x00, 0x00, 0xd2, 0x9d,
- 0x9d, 0xc9, 0xc5, 0x28, 0xc4, 0x03, 0xd4, 0x07,
- 0x11, 0x05, 0x1c, 0x35, 0x0d, 0x1c, 0x0d, 0x26,
- 0x21, 0x0d, 0x1c, 0x49, 0x0d, 0x2c, 0x27, 0x26,
- 0x1c, 0x37, 0x0e, 0x43, 0x06, 0x01, 0xa0, 0x05,
- 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x85, 0x02,
- 0x11, 0x8e, 0x07, 0x00, 0x01, 0x00, 0xbc, 0x07,
- 0x00, 0x01, 0x00, 0xbe, 0x07, 0x00, 0x01, 0x00,
- 0xc0, 0x07, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x00,
- 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02, 0x00, 0xc4,
- 0x07, 0x00, 0x03, 0x00, 0xc6, 0x07, 0x00, 0x04,
- 0x00, 0xc8, 0x07, 0x00, 0x05, 0x00, 0xdc, 0x06,
- 0x00, 0x06, 0x00, 0xca, 0x07, 0x00, 0x07, 0x00,
- 0xcc, 0x07, 0x00, 0x08, 0x00, 0xce, 0x07, 0x00,
- 0x09, 0x00, 0xd0, 0x07, 0x00, 0x0a, 0x00, 0xd2,
- 0x07, 0x00, 0x0b, 0x00, 0xd4, 0x07, 0x00, 0x0c,
- 0x00, 0xd6, 0x07, 0x00, 0x0d, 0x00, 0xf6, 0x03,
- 0x09, 0x00, 0x84, 0x04, 0x10, 0x00, 0xf4, 0x03,
- 0x0b, 0x00, 0xd1, 0x42, 0x8b, 0x01, 0x00, 0x00,
+ 0x03, 0x0a, 0x28, 0xd1, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0xa7, 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x38,
+ 0xe9, 0x00, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x09,
+ 0x0e, 0xd1, 0x38, 0xea, 0x00, 0x00, 0x00, 0xa7,
+ 0xea, 0x03, 0x0a, 0x28, 0x09, 0x28, 0x04, 0x3f,
+ 0x3f, 0x35, 0x0d, 0x3a, 0x3a, 0x30, 0x0d, 0x0e,
+ 0x43, 0x26, 0x05, 0xd6, 0x03, 0x01, 0x02, 0x01,
+ 0x04, 0x01, 0x00, 0x82, 0x01, 0xca, 0x03, 0xb7,
+ 0x07, 0x0f, 0x03, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xe8, 0x01, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x00,
+ 0x01, 0x14, 0xa4, 0x05, 0x21, 0x01, 0x0c, 0x03,
+ 0xc9, 0x0c, 0x02, 0xca, 0xc5, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x01, 0x00,
+ 0x00, 0xef, 0x2f, 0xd1, 0xc6, 0xa7, 0xea, 0x03,
+ 0xd1, 0x28, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42,
+ 0xa7, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xea, 0x2a, 0xd1, 0xe9, 0xb5, 0xa9, 0xea, 0x06,
+ 0xb5, 0x26, 0x01, 0x00, 0xd5, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0x42, 0x63, 0x00, 0x00, 0x00, 0xd1,
+ 0xc6, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x0e, 0xd1, 0x42, 0x8f, 0x01, 0x00, 0x00,
+ 0x25, 0x00, 0x00, 0xdd, 0xd1, 0xef, 0xea, 0x1d,
+ 0xd1, 0x26, 0x01, 0x00, 0xd5, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0x42, 0x63, 0x00, 0x00, 0x00, 0xd1,
+ 0xc6, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x0e, 0xd1, 0x28, 0x38, 0xd2, 0x00, 0x00,
+ 0x00, 0x04, 0xc1, 0x01, 0x00, 0x00, 0xef, 0x2f,
+ 0x22, 0x12, 0x3f, 0x1c, 0x08, 0x58, 0x21, 0x1c,
+ 0x6c, 0x30, 0x1c, 0x1c, 0x6c, 0x08, 0x08, 0x0e,
+ 0x43, 0x06, 0x05, 0xa6, 0x05, 0x01, 0x00, 0x01,
+ 0x03, 0x00, 0x00, 0x44, 0xca, 0x03, 0xcb, 0x07,
+ 0x04, 0x01, 0xf8, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00,
+ 0x00, 0xd1, 0x24, 0x01, 0x00, 0x11, 0xeb, 0x32,
+ 0x0e, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x87,
+ 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x11,
+ 0xeb, 0x20, 0x0e, 0xd1, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0xa7, 0x11, 0xeb, 0x15, 0x0e, 0xd1, 0x38,
+ 0xe9, 0x00, 0x00, 0x00, 0xa7, 0x11, 0xea, 0x0a,
+ 0x0e, 0xd1, 0x41, 0xd3, 0x01, 0x00, 0x00, 0xb5,
+ 0xa9, 0x96, 0x28, 0x04, 0x5d, 0x5d, 0x3a, 0x0e,
+ 0x43, 0x06, 0x05, 0xa8, 0x05, 0x02, 0x01, 0x02,
+ 0x03, 0x01, 0x00, 0x63, 0xca, 0x03, 0xd4, 0x07,
+ 0x11, 0x03, 0xf8, 0x06, 0x00, 0x01, 0x00, 0xb2,
+ 0x06, 0x00, 0x01, 0x00, 0xc0, 0x07, 0x00, 0x00,
+ 0x00, 0xa6, 0x05, 0x22, 0x01, 0xd2, 0xb5, 0xa9,
+ 0xea, 0x0d, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xc9, 0xec, 0x51, 0xd1, 0xb6,
+ 0xa9, 0xea, 0x05, 0xc1, 0xc9, 0xec, 0x32, 0xd1,
+ 0xb4, 0xa9, 0xea, 0x09, 0x04, 0x7d, 0x01, 0x00,
+ 0x00, 0xc9, 0xec, 0x25, 0xdd, 0xd1, 0xef, 0xea,
+ 0x11, 0x04, 0xe1, 0x01, 0x00, 0x00, 0xd1, 0x9d,
+ 0x04, 0xdf, 0x01, 0x00, 0x00, 0x9d, 0xc9, 0xec,
+ 0x09, 0x38, 0x9c, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xc9, 0x04, 0x80, 0x00, 0x00, 0x00, 0x94, 0x00,
+ 0x04, 0xf1, 0x00, 0x00, 0x00, 0x94, 0x00, 0xd2,
+ 0xb6, 0xaa, 0xea, 0x0b, 0xc5, 0x04, 0xe2, 0x01,
+ 0x00, 0x00, 0xd2, 0x9d, 0x9d, 0xc9, 0xc5, 0x28,
+ 0x05, 0x1c, 0x35, 0x0d, 0x1c, 0x0d, 0x26, 0x21,
+ 0x0d, 0x1c, 0x49, 0x0d, 0x2c, 0x27, 0x26, 0x1c,
+ 0x37, 0x0e, 0x43, 0x06, 0x05, 0xaa, 0x05, 0x03,
+ 0x0e, 0x03, 0x04, 0x00, 0x06, 0xb2, 0x02, 0xca,
+ 0x03, 0xf0, 0x07, 0x29, 0x11, 0x98, 0x07, 0x00,
+ 0x01, 0x00, 0xc6, 0x07, 0x00, 0x01, 0x00, 0xc8,
+ 0x07, 0x00, 0x01, 0x00, 0xca, 0x07, 0x00, 0x00,
+ 0x00, 0xcc, 0x07, 0x00, 0x01, 0x00, 0xb2, 0x06,
+ 0x00, 0x02, 0x00, 0xce, 0x07, 0x00, 0x03, 0x00,
+ 0xd0, 0x07, 0x00, 0x04, 0x00, 0xd2, 0x07, 0x00,
+ 0x05, 0x00, 0xe6, 0x06, 0x00, 0x06, 0x00, 0xd4,
+ 0x07, 0x00, 0x07, 0x00, 0xd6, 0x07, 0x00, 0x08,
+ 0x00, 0xd8, 0x07, 0x00, 0x09, 0x00, 0xda, 0x07,
+ 0x00, 0x0a, 0x00, 0xdc, 0x07, 0x00, 0x0b, 0x00,
+ 0xde, 0x07, 0x00, 0x0c, 0x00, 0xe0, 0x07, 0x00,
+ 0x0d, 0x00, 0xd1, 0x42, 0x90, 0x01, 0x00, 0x00,
  0x24, 0x00, 0x00, 0xc4, 0x06, 0xb6, 0xa9, 0xea,
  0x0a, 0xd1, 0xb5, 0x47, 0x8c, 0xd1, 0xb6, 0x47,
  0x9b, 0x28, 0xd1, 0xb5, 0x47, 0xb5, 0xa9, 0xea,
- 0x03, 0xb5, 0x28, 0xd1, 0x42, 0xf8, 0x00, 0x00,
- 0x00, 0x24, 0x00, 0x00, 0xcd, 0x42, 0xf8, 0x00,
- 0x00, 0x00, 0x24, 0x00, 0x00, 0xca, 0xb5, 0xc3,
- 0x0c, 0xb5, 0xc3, 0x0d, 0xb5, 0xcb, 0xc7, 0xd3,
- 0xa3, 0x69, 0xc3, 0x00, 0x00, 0x00, 0xd1, 0x42,
- 0x5d, 0x00, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00,
- 0xd0, 0xb5, 0xa9, 0xea, 0x03, 0xd2, 0x28, 0xdd,
+ 0x07, 0xbf, 0x00, 0xbd, 0xed, 0xb1, 0x28, 0xd1,
+ 0x42, 0xfb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xcd, 0x42, 0xfb, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xca, 0xbf, 0x01, 0xbd, 0xed, 0xb1, 0xc3,
+ 0x0c, 0xbf, 0x02, 0xbd, 0xed, 0xb1, 0xc3, 0x0d,
+ 0xb5, 0xcb, 0xc7, 0xd3, 0xa3, 0x69, 0xe4, 0x00,
+ 0x00, 0x00, 0xd1, 0x42, 0x5d, 0x00, 0x00, 0x00,
+ 0xd2, 0x24, 0x01, 0x00, 0xd0, 0xb5, 0xa9, 0xea,
+ 0x03, 0xd2, 0x28, 0x38, 0xfe, 0x00, 0x00, 0x00,
  0xd2, 0xc2, 0x0d, 0x9e, 0xef, 0xc3, 0x0b, 0xc7,
- 0xb7, 0xa6, 0xea, 0x2a, 0xc2, 0x0b, 0xc2, 0x0c,
- 0xa6, 0xea, 0x23, 0xdd, 0xc2, 0x0d, 0xef, 0xbf,
- 0x00, 0xa3, 0xea, 0x0b, 0xc2, 0x0b, 0xbf, 0x01,
- 0xa3, 0xea, 0x13, 0xc2, 0x0d, 0x28, 0xc2, 0x0b,
- 0xdd, 0xc2, 0x0d, 0xef, 0xbf, 0x02, 0x9a, 0xa3,
- 0xea, 0x04, 0xc2, 0x0d, 0x28, 0xc2, 0x0b, 0xc3,
- 0x0c, 0xd2, 0xc3, 0x0d, 0xc5, 0x42, 0x5d, 0x00,
- 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xc3, 0x04,
- 0xc6, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xd2, 0x24,
- 0x01, 0x00, 0xc3, 0x05, 0xc2, 0x06, 0xb6, 0x9e,
- 0xc2, 0x04, 0x9a, 0xc4, 0x07, 0xc2, 0x07, 0x9a,
- 0xc3, 0x07, 0xc2, 0x06, 0xc2, 0x06, 0xb6, 0x9e,
- 0x9a, 0xc8, 0x9a, 0xc2, 0x05, 0x9a, 0xc3, 0x08,
- 0xde, 0xc2, 0x07, 0xc2, 0x08, 0x9e, 0xef, 0xc3,
- 0x07, 0xc2, 0x04, 0xc2, 0x07, 0x9d, 0xc3, 0x09,
- 0xc2, 0x04, 0xc2, 0x07, 0x9e, 0xc3, 0x0a, 0xdf,
- 0xc2, 0x0a, 0xef, 0xdf, 0xc2, 0x09, 0xef, 0xa5,
- 0xea, 0x05, 0xc2, 0x0a, 0xc3, 0x09, 0xc2, 0x09,
- 0xb5, 0xa9, 0xea, 0x03, 0x07, 0x28, 0xd2, 0xc2,
- 0x06, 0xc8, 0x9a, 0xc2, 0x09, 0x9b, 0x9e, 0xd6,
- 0x93, 0x02, 0xed, 0x3b, 0xff, 0x07, 0x28, 0xc4,
- 0x03, 0xf0, 0x07, 0x29, 0x00, 0x00, 0x08, 0x3a,
- 0x18, 0x2b, 0x09, 0x26, 0x0e, 0x35, 0x30, 0x12,
- 0x12, 0x35, 0x3a, 0x17, 0x0f, 0x2c, 0x3f, 0x30,
- 0x26, 0x0d, 0x08, 0x3f, 0x14, 0x17, 0x13, 0x3f,
- 0x3f, 0x30, 0x1c, 0x49, 0x30, 0x26, 0x26, 0x3a,
- 0x17, 0x21, 0x0d, 0x35, 0x1c, 0x06, 0x2d, 0x43,
- 0x1c, 0xeb, 0xe2, 0x36, 0x1a, 0x3f, 0x06, 0x48,
- 0xaf, 0xbc, 0x9a, 0xf2, 0xd7, 0x7a, 0x3e, 0x06,
- 0xfc, 0xa9, 0xf1, 0xd2, 0x4d, 0x62, 0x50, 0x3f,
- 0x0e, 0x43, 0x06, 0x01, 0xa2, 0x05, 0x01, 0x07,
- 0x01, 0x05, 0x03, 0x03, 0x92, 0x01, 0x08, 0x8e,
- 0x07, 0x00, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x00,
- 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd6, 0x04,
- 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00, 0x03, 0x00,
- 0xbc, 0x07, 0x00, 0x04, 0x00, 0xd8, 0x07, 0x00,
- 0x05, 0x00, 0xda, 0x07, 0x00, 0x06, 0x00, 0xd0,
- 0x03, 0x03, 0x00, 0xa0, 0x05, 0x24, 0x01, 0xdc,
- 0x03, 0x11, 0x00, 0xbf, 0x00, 0xbf, 0x01, 0x8c,
- 0xbf, 0x02, 0x26, 0x03, 0x00, 0xc3, 0x06, 0xd1,
- 0xdd, 0xa7, 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0xd1, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xcd, 0xb5, 0xa4, 0xea, 0x05, 0x26,
- 0x00, 0x00, 0x28, 0xb7, 0x38, 0xb4, 0x00, 0x00,
- 0x00, 0x41, 0xc8, 0x01, 0x00, 0x00, 0x8c, 0xae,
- 0xc3, 0x05, 0x26, 0x00, 0x00, 0xcb, 0xb5, 0xca,
- 0xc6, 0xc5, 0xa3, 0xea, 0x47, 0xb5, 0xcc, 0xc8,
- 0xb8, 0xa3, 0xea, 0x15, 0xde, 0xd1, 0xc2, 0x06,
- 0xc8, 0x47, 0xbd, 0x64, 0xf1, 0xc4, 0x04, 0xf3,
- 0xeb, 0x03, 0xec, 0x05, 0x93, 0x03, 0xec, 0xe8,
- 0xc8, 0xb8, 0xa9, 0xea, 0x0d, 0x38, 0xcc, 0x00,
- 0x00, 0x00, 0x04, 0xef, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0xc7, 0xc6, 0xc2, 0x04, 0x49, 0xdd, 0x42,
- 0x8c, 0x01, 0x00, 0x00, 0xd1, 0xdf, 0xc2, 0x04,
- 0x9e, 0x24, 0x02, 0x00, 0xb5, 0x47, 0xd5, 0x93,
- 0x01, 0xec, 0xb6, 0xc7, 0x28, 0xc4, 0x03, 0xa6,
- 0x08, 0x14, 0x05, 0x40, 0x21, 0x3f, 0x35, 0x17,
- 0x17, 0x4e, 0x17, 0x27, 0x26, 0x3a, 0x12, 0x0d,
- 0x17, 0x1c, 0x3f, 0x1c, 0x58, 0x17, 0x06, 0x9a,
- 0x99, 0x99, 0x99, 0x99, 0x99, 0xb9, 0x3f, 0x06,
- 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xf6, 0x3f,
- 0x06, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xfb,
- 0x3f, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x03,
- 0x00, 0x03, 0x00, 0x00, 0x21, 0x03, 0xba, 0x06,
- 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
- 0x10, 0x00, 0x01, 0x00, 0x08, 0xcb, 0xc7, 0xcd,
- 0xe9, 0xca, 0xc6, 0xb6, 0xa5, 0xea, 0x0e, 0xc5,
- 0xc6, 0xb6, 0x9e, 0x47, 0xb5, 0xa9, 0xea, 0x05,
- 0x92, 0x01, 0xec, 0xef, 0xc5, 0xc6, 0x43, 0x32,
- 0x00, 0x00, 0x00, 0xc5, 0x28, 0xc4, 0x03, 0xc2,
- 0x08, 0x06, 0x0d, 0x08, 0x12, 0x49, 0x17, 0x26,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x05, 0x00,
- 0x04, 0x01, 0x00, 0x2b, 0x05, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x02, 0x00, 0xba, 0x06, 0x00, 0x03,
- 0x00, 0x10, 0x00, 0x01, 0x00, 0xd0, 0x03, 0x03,
+ 0xb7, 0xa6, 0xea, 0x3b, 0xc2, 0x0b, 0xc2, 0x0c,
+ 0xa6, 0xea, 0x34, 0x38, 0xfe, 0x00, 0x00, 0x00,
+ 0xc2, 0x0d, 0xef, 0xbf, 0x03, 0xbd, 0xea, 0xb1,
+ 0xa3, 0xea, 0x0e, 0xc2, 0x0b, 0xbf, 0x04, 0xbd,
+ 0xe7, 0xb1, 0xa3, 0xea, 0x1a, 0xc2, 0x0d, 0x28,
+ 0xc2, 0x0b, 0x38, 0xfe, 0x00, 0x00, 0x00, 0xc2,
+ 0x0d, 0xef, 0xbf, 0x05, 0xbd, 0xeb, 0xb1, 0x9a,
+ 0xa3, 0xea, 0x04, 0xc2, 0x0d, 0x28, 0xc2, 0x0b,
+ 0xc3, 0x0c, 0xd2, 0xc3, 0x0d, 0xc5, 0x42, 0x5d,
+ 0x00, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xc3,
+ 0x04, 0xc6, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xd2,
+ 0x24, 0x01, 0x00, 0xc3, 0x05, 0xc2, 0x06, 0xb6,
+ 0x9e, 0xc2, 0x04, 0x9a, 0xc4, 0x07, 0xc2, 0x07,
+ 0x9a, 0xc3, 0x07, 0xc2, 0x06, 0xc2, 0x06, 0xb6,
+ 0x9e, 0x9a, 0xc8, 0x9a, 0xc2, 0x05, 0x9a, 0xc3,
+ 0x08, 0x38, 0x05, 0x01, 0x00, 0x00, 0xc2, 0x07,
+ 0xc2, 0x08, 0x9e, 0xef, 0xc3, 0x07, 0xc2, 0x04,
+ 0xc2, 0x07, 0x9d, 0xc3, 0x09, 0xc2, 0x04, 0xc2,
+ 0x07, 0x9e, 0xc3, 0x0a, 0x38, 0xfd, 0x00, 0x00,
+ 0x00, 0xc2, 0x0a, 0xef, 0x38, 0xfd, 0x00, 0x00,
+ 0x00, 0xc2, 0x09, 0xef, 0xa5, 0xea, 0x05, 0xc2,
+ 0x0a, 0xc3, 0x09, 0xc2, 0x09, 0xb5, 0xa9, 0xea,
+ 0x03, 0x07, 0x28, 0xd2, 0xc2, 0x06, 0xc8, 0x9a,
+ 0xc2, 0x09, 0x9b, 0x9e, 0xd6, 0x93, 0x02, 0xed,
+ 0x1a, 0xff, 0x07, 0x28, 0x00, 0x00, 0x08, 0x3a,
+ 0x18, 0x2b, 0x09, 0x26, 0x22, 0x35, 0x30, 0x26,
+ 0x26, 0x35, 0x3a, 0x17, 0x0f, 0x40, 0x3f, 0x53,
+ 0x35, 0x0d, 0x08, 0x62, 0x14, 0x17, 0x13, 0x3f,
+ 0x3f, 0x30, 0x1c, 0x49, 0x44, 0x26, 0x26, 0x62,
+ 0x17, 0x21, 0x0d, 0x35, 0x1c, 0x0b, 0x00, 0x0b,
+ 0x00, 0x0b, 0x00, 0x0b, 0xfc, 0x01, 0x06, 0x40,
+ 0x76, 0x3a, 0x6b, 0x0b, 0xde, 0x0b, 0xfc, 0x01,
+ 0x06, 0x40, 0x76, 0x3a, 0x6b, 0x0b, 0xde, 0x0b,
+ 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a, 0x6b, 0x0b,
+ 0xde, 0x0e, 0x43, 0x06, 0x05, 0xac, 0x05, 0x01,
+ 0x07, 0x01, 0x05, 0x01, 0x04, 0xab, 0x01, 0xca,
+ 0x03, 0xa6, 0x08, 0x14, 0x08, 0x98, 0x07, 0x00,
+ 0x01, 0x00, 0xe6, 0x06, 0x00, 0x00, 0x00, 0xb2,
+ 0x06, 0x00, 0x01, 0x00, 0xe0, 0x04, 0x00, 0x02,
+ 0x00, 0xc6, 0x06, 0x00, 0x03, 0x00, 0xc6, 0x07,
+ 0x00, 0x04, 0x00, 0xe2, 0x07, 0x00, 0x05, 0x00,
+ 0xe4, 0x07, 0x00, 0x06, 0x00, 0xaa, 0x05, 0x24,
+ 0x01, 0xbf, 0x00, 0xbd, 0xed, 0xb1, 0xbf, 0x01,
+ 0xbd, 0xee, 0xb1, 0x8c, 0xbf, 0x02, 0xbd, 0xee,
+ 0xb1, 0x26, 0x03, 0x00, 0xc3, 0x06, 0xd1, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xa7, 0x96, 0xea, 0x0d,
+ 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x01,
+ 0x00, 0x00, 0xef, 0x2f, 0xd1, 0x42, 0x90, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0xb5, 0xa4,
+ 0xea, 0x05, 0x26, 0x00, 0x00, 0x28, 0xbf, 0x03,
+ 0xbd, 0xee, 0xb1, 0x38, 0xb7, 0x00, 0x00, 0x00,
+ 0x41, 0xcd, 0x01, 0x00, 0x00, 0x8c, 0x9f, 0xc3,
+ 0x05, 0x26, 0x00, 0x00, 0xcb, 0xb5, 0xca, 0xc6,
+ 0xc5, 0xa3, 0xea, 0x4f, 0xb5, 0xcc, 0xc8, 0xb8,
+ 0xa3, 0xea, 0x15, 0xdd, 0xd1, 0xc2, 0x06, 0xc8,
+ 0x47, 0xbd, 0x64, 0xf1, 0xc4, 0x04, 0xf3, 0xeb,
+ 0x03, 0xec, 0x05, 0x93, 0x03, 0xec, 0xe8, 0xc8,
+ 0xb8, 0xa9, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00,
+ 0x00, 0x04, 0xf4, 0x01, 0x00, 0x00, 0xef, 0x2f,
+ 0xc7, 0xc6, 0xc2, 0x04, 0x49, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0x42, 0x91, 0x01, 0x00, 0x00, 0xd1,
+ 0x38, 0xf1, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x9e,
+ 0x24, 0x02, 0x00, 0xb5, 0x47, 0xd5, 0x93, 0x01,
+ 0xec, 0xae, 0xc7, 0x28, 0x05, 0x6d, 0x35, 0x3f,
+ 0x35, 0x17, 0x17, 0x62, 0x17, 0x27, 0x26, 0x3a,
+ 0x12, 0x0d, 0x17, 0x1c, 0x3f, 0x1c, 0x80, 0x17,
+ 0x0b, 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a, 0x6b,
+ 0x0b, 0xde, 0x0b, 0x80, 0x02, 0x06, 0x60, 0xec,
+ 0xa8, 0x64, 0x6e, 0x9b, 0x0b, 0x80, 0x02, 0x06,
+ 0x50, 0xb1, 0xf1, 0xe7, 0xbc, 0xbc, 0x0b, 0x80,
+ 0x02, 0x06, 0x40, 0x76, 0x3a, 0x6b, 0x0b, 0xde,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x03, 0x00,
+ 0x03, 0x00, 0x00, 0x21, 0xca, 0x03, 0xc2, 0x08,
+ 0x06, 0x03, 0xc4, 0x06, 0x00, 0x00, 0x00, 0xb2,
+ 0x06, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcb, 0xc7, 0xcd, 0xe9, 0xca, 0xc6, 0xb6,
+ 0xa5, 0xea, 0x0e, 0xc5, 0xc6, 0xb6, 0x9e, 0x47,
+ 0xb5, 0xa9, 0xea, 0x05, 0x92, 0x01, 0xec, 0xef,
+ 0xc5, 0xc6, 0x43, 0x32, 0x00, 0x00, 0x00, 0xc5,
+ 0x28, 0x0d, 0x08, 0x12, 0x49, 0x17, 0x26, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x05, 0x00, 0x04,
+ 0x00, 0x00, 0x2f, 0xca, 0x03, 0xca, 0x08, 0x06,
+ 0x05, 0xda, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06,
+ 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x02, 0x00,
+ 0xc4, 0x06, 0x00, 0x03, 0x00, 0x10, 0x00, 0x01,
  0x00, 0x08, 0xc3, 0x04, 0xc2, 0x04, 0xd0, 0xe9,
  0xcb, 0x26, 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6,
  0xc7, 0xa3, 0xea, 0x14, 0xc5, 0xc6, 0x71, 0xc8,
- 0xc6, 0x47, 0x42, 0xfc, 0x00, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0x49, 0x93, 0x01, 0xec, 0xe9, 0xdd,
- 0xc5, 0x23, 0x01, 0x00, 0xc4, 0x03, 0xca, 0x08,
- 0x06, 0x13, 0x12, 0x0d, 0x17, 0x26, 0x62, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
- 0x02, 0x00, 0x0d, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0xd4, 0x03, 0x12, 0x00, 0xd0, 0x03, 0x03, 0x00,
- 0x08, 0xc9, 0xdd, 0xde, 0xb6, 0x26, 0x01, 0x00,
- 0xef, 0xc5, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xd3,
- 0x08, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x06, 0x00, 0x03, 0x02, 0x00, 0x63, 0x06,
- 0xa8, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00,
- 0x01, 0x00, 0xb6, 0x07, 0x00, 0x02, 0x00, 0xee,
- 0x06, 0x00, 0x03, 0x00, 0xba, 0x06, 0x00, 0x04,
- 0x00, 0x10, 0x00, 0x01, 0x00, 0xce, 0x03, 0x0f,
- 0x00, 0x9e, 0x05, 0x23, 0x01, 0x08, 0xc3, 0x05,
+ 0xc6, 0x47, 0x42, 0xff, 0x00, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x49, 0x93, 0x01, 0xec, 0xe9, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xc5, 0x23, 0x01, 0x00,
+ 0x13, 0x12, 0x0d, 0x17, 0x26, 0x62, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x15, 0xca, 0x03, 0xd3, 0x08, 0x01, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38, 0xed,
+ 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xb6, 0x26, 0x01, 0x00, 0xef, 0xc5, 0x23, 0x02,
+ 0x00, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x06, 0x00, 0x03, 0x01, 0x00, 0x67, 0xca, 0x03,
+ 0xd6, 0x08, 0x10, 0x06, 0xb2, 0x06, 0x00, 0x00,
+ 0x00, 0xea, 0x07, 0x00, 0x01, 0x00, 0xc0, 0x07,
+ 0x00, 0x02, 0x00, 0xf8, 0x06, 0x00, 0x03, 0x00,
+ 0xc4, 0x06, 0x00, 0x04, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0xa8, 0x05, 0x23, 0x01, 0x08, 0xc3, 0x05,
  0xc2, 0x05, 0xc4, 0x04, 0xe9, 0xb6, 0xa9, 0xea,
  0x0d, 0xc2, 0x04, 0xb5, 0x47, 0x42, 0x3a, 0x00,
  0x00, 0x00, 0x25, 0x00, 0x00, 0xc1, 0xca, 0xc2,
  0x04, 0xe9, 0xb6, 0x9e, 0xc9, 0xc5, 0xb5, 0xa6,
- 0xea, 0x3d, 0xc2, 0x04, 0xc5, 0x47, 0xd0, 0xb5,
- 0xa9, 0x11, 0xeb, 0x0f, 0x0e, 0xc8, 0xdd, 0xa7,
- 0xea, 0x0b, 0xc8, 0x41, 0xd4, 0x01, 0x00, 0x00,
- 0xb5, 0xa9, 0xeb, 0x1f, 0xde, 0xc8, 0xc5, 0xf0,
- 0xcf, 0xb5, 0x47, 0x04, 0x78, 0x01, 0x00, 0x00,
- 0xaa, 0xea, 0x0d, 0xc6, 0xc1, 0xaa, 0xea, 0x08,
- 0x04, 0x77, 0x01, 0x00, 0x00, 0x94, 0x01, 0xc7,
- 0x94, 0x01, 0x92, 0x00, 0xec, 0xc0, 0xc6, 0x28,
- 0xc4, 0x03, 0xd6, 0x08, 0x10, 0x12, 0x0d, 0x26,
- 0x40, 0x0d, 0x3a, 0x1c, 0x21, 0x44, 0x0d, 0x1c,
- 0x35, 0x1c, 0x27, 0x12, 0x17, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
- 0x1b, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
- 0xc5, 0xe9, 0xb6, 0xa9, 0xea, 0x0f, 0xc5, 0xb5,
- 0x47, 0xb5, 0xa9, 0xea, 0x08, 0x38, 0xf1, 0x01,
- 0x00, 0x00, 0x8c, 0x28, 0xc5, 0xe9, 0xb6, 0x9e,
- 0x28, 0xc4, 0x03, 0xea, 0x08, 0x04, 0x0d, 0x44,
- 0x21, 0x08, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x05, 0x01, 0x03, 0x00, 0x00, 0x21, 0x06, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00,
- 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
- 0x00, 0x02, 0x00, 0xba, 0x06, 0x00, 0x03, 0x00,
- 0x10, 0x00, 0x01, 0x00, 0x08, 0xc3, 0x04, 0xc2,
- 0x04, 0xd0, 0xe9, 0xb6, 0x9e, 0xca, 0xc8, 0xc6,
- 0x47, 0xcb, 0xc6, 0xb5, 0xa5, 0xea, 0x0d, 0x92,
- 0x01, 0xc7, 0xd1, 0x9a, 0xc8, 0xc6, 0x47, 0x9d,
- 0xcb, 0xec, 0xf0, 0xc7, 0x28, 0xc4, 0x03, 0xf0,
- 0x08, 0x08, 0x12, 0x0d, 0x1c, 0x17, 0x1c, 0x0d,
- 0x2b, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x05, 0x00, 0x05, 0x01, 0x00, 0x30, 0x05, 0xba,
- 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01,
- 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06,
- 0x00, 0x03, 0x00, 0x10, 0x00, 0x01, 0x00, 0xd0,
- 0x03, 0x03, 0x00, 0x08, 0xc3, 0x04, 0xc2, 0x04,
- 0xcd, 0xe9, 0xce, 0xb6, 0xa9, 0xea, 0x06, 0xdd,
- 0xb5, 0x23, 0x01, 0x00, 0x26, 0x00, 0x00, 0xcb,
- 0xb6, 0xcc, 0xc8, 0xc6, 0xa3, 0xea, 0x10, 0xc7,
- 0xc8, 0xb6, 0x9e, 0x71, 0xc8, 0xc5, 0xc8, 0x47,
- 0x9a, 0x49, 0x93, 0x03, 0xec, 0xed, 0xdd, 0xc7,
- 0x23, 0x01, 0x00, 0xc4, 0x03, 0xfa, 0x08, 0x09,
- 0x12, 0x0d, 0x12, 0x17, 0x1d, 0x17, 0x26, 0x3a,
- 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x05,
- 0x00, 0x05, 0x01, 0x00, 0x2a, 0x05, 0xba, 0x06,
- 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00,
- 0xd0, 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00,
- 0x03, 0x00, 0x10, 0x00, 0x01, 0x00, 0xd0, 0x03,
- 0x03, 0x00, 0x08, 0xc3, 0x04, 0xc2, 0x04, 0xcd,
- 0xe9, 0xca, 0xb5, 0x26, 0x01, 0x00, 0xcb, 0xb5,
- 0xcc, 0xc8, 0xc6, 0xa3, 0xea, 0x12, 0xc7, 0xc8,
- 0xb6, 0x9d, 0x71, 0xc5, 0xc8, 0x47, 0xc8, 0xb6,
- 0x9d, 0x9b, 0x49, 0x93, 0x03, 0xec, 0xeb, 0xdd,
- 0xc7, 0x23, 0x01, 0x00, 0xc4, 0x03, 0x87, 0x09,
- 0x07, 0x12, 0x0d, 0x12, 0x1c, 0x26, 0x44, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x05, 0x00,
- 0x03, 0x00, 0x00, 0x25, 0x05, 0xba, 0x06, 0x00,
- 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0,
- 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03,
+ 0xea, 0x41, 0xc2, 0x04, 0xc5, 0x47, 0xd0, 0xb5,
+ 0xa9, 0x11, 0xeb, 0x13, 0x0e, 0xc8, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0xa7, 0xea, 0x0b, 0xc8, 0x41,
+ 0xd9, 0x01, 0x00, 0x00, 0xb5, 0xa9, 0xeb, 0x1f,
+ 0xdd, 0xc8, 0xc5, 0xf0, 0xcf, 0xb5, 0x47, 0x04,
+ 0x7d, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d, 0xc6,
+ 0xc1, 0xaa, 0xea, 0x08, 0x04, 0x7c, 0x01, 0x00,
+ 0x00, 0x94, 0x01, 0xc7, 0x94, 0x01, 0x92, 0x00,
+ 0xec, 0xbc, 0xc6, 0x28, 0x12, 0x0d, 0x26, 0x40,
+ 0x0d, 0x3a, 0x1c, 0x21, 0x58, 0x0d, 0x1c, 0x35,
+ 0x1c, 0x27, 0x12, 0x17, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x1b,
+ 0xca, 0x03, 0xea, 0x08, 0x04, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xc9, 0xc5, 0xe9, 0xb6, 0xa9,
+ 0xea, 0x0f, 0xc5, 0xb5, 0x47, 0xb5, 0xa9, 0xea,
+ 0x08, 0x38, 0xf6, 0x01, 0x00, 0x00, 0x8c, 0x28,
+ 0xc5, 0xe9, 0xb6, 0x9e, 0x28, 0x0d, 0x44, 0x21,
+ 0x08, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x05,
+ 0x01, 0x03, 0x00, 0x00, 0x21, 0xca, 0x03, 0xf0,
+ 0x08, 0x08, 0x06, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xb2, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00,
+ 0x01, 0x00, 0xda, 0x06, 0x00, 0x02, 0x00, 0xc4,
+ 0x06, 0x00, 0x03, 0x00, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc3, 0x04, 0xc2, 0x04, 0xd0, 0xe9, 0xb6,
+ 0x9e, 0xca, 0xc8, 0xc6, 0x47, 0xcb, 0xc6, 0xb5,
+ 0xa5, 0xea, 0x0d, 0x92, 0x01, 0xc7, 0xd1, 0x9a,
+ 0xc8, 0xc6, 0x47, 0x9d, 0xcb, 0xec, 0xf0, 0xc7,
+ 0x28, 0x12, 0x0d, 0x1c, 0x17, 0x1c, 0x0d, 0x2b,
+ 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x05,
+ 0x00, 0x05, 0x00, 0x00, 0x38, 0xca, 0x03, 0xfa,
+ 0x08, 0x09, 0x05, 0xc4, 0x06, 0x00, 0x00, 0x00,
+ 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x02, 0x00, 0xb2, 0x06, 0x00, 0x03, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc3, 0x04, 0xc2, 0x04,
+ 0xcd, 0xe9, 0xce, 0xb6, 0xa9, 0xea, 0x0a, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xb5, 0x23, 0x01, 0x00,
+ 0x26, 0x00, 0x00, 0xcb, 0xb6, 0xcc, 0xc8, 0xc6,
+ 0xa3, 0xea, 0x10, 0xc7, 0xc8, 0xb6, 0x9e, 0x71,
+ 0xc8, 0xc5, 0xc8, 0x47, 0x9a, 0x49, 0x93, 0x03,
+ 0xec, 0xed, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc7,
+ 0x23, 0x01, 0x00, 0x12, 0x0d, 0x12, 0x17, 0x31,
+ 0x17, 0x26, 0x3a, 0x17, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x2e,
+ 0xca, 0x03, 0x87, 0x09, 0x07, 0x05, 0xc4, 0x06,
+ 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00, 0x01, 0x00,
+ 0xda, 0x06, 0x00, 0x02, 0x00, 0xb2, 0x06, 0x00,
+ 0x03, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc3,
+ 0x04, 0xc2, 0x04, 0xcd, 0xe9, 0xca, 0xb5, 0x26,
+ 0x01, 0x00, 0xcb, 0xb5, 0xcc, 0xc8, 0xc6, 0xa3,
+ 0xea, 0x12, 0xc7, 0xc8, 0xb6, 0x9d, 0x71, 0xc5,
+ 0xc8, 0x47, 0xc8, 0xb6, 0x9d, 0x9b, 0x49, 0x93,
+ 0x03, 0xec, 0xeb, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xc7, 0x23, 0x01, 0x00, 0x12, 0x0d, 0x12, 0x1c,
+ 0x26, 0x44, 0x17, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x25, 0xca,
+ 0x03, 0x90, 0x09, 0x07, 0x05, 0xc4, 0x06, 0x00,
+ 0x00, 0x00, 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda,
+ 0x06, 0x00, 0x02, 0x00, 0xb2, 0x06, 0x00, 0x03,
  0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc3, 0x04,
  0xc2, 0x04, 0xcd, 0xe9, 0xca, 0xb5, 0xcb, 0xb5,
  0xcc, 0xc8, 0xc6, 0xa3, 0xea, 0x13, 0xc7, 0xc5,
- 0xc8, 0x47, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x24,
+ 0xc8, 0x47, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24,
  0x00, 0x00, 0x9d, 0xcb, 0x93, 0x03, 0xec, 0xea,
- 0xc7, 0x28, 0xc4, 0x03, 0x90, 0x09, 0x07, 0x12,
- 0x0d, 0x12, 0x0d, 0x26, 0x49, 0x17, 0x0e, 0x43,
- 0x06, 0x01, 0xa4, 0x05, 0x02, 0x05, 0x02, 0x05,
- 0x01, 0x00, 0x4e, 0x07, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x07,
- 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x02, 0x00, 0xf6, 0x06, 0x00,
- 0x03, 0x00, 0xe6, 0x07, 0x00, 0x04, 0x00, 0xd0,
- 0x03, 0x03, 0x00, 0xdd, 0xd1, 0xef, 0xd5, 0xdd,
- 0xd2, 0xef, 0xd6, 0xd1, 0xe9, 0xd2, 0xe9, 0xa3,
- 0xea, 0x07, 0xd1, 0xc9, 0xd2, 0xd5, 0xc5, 0xd6,
- 0xd2, 0xe9, 0xcc, 0xd1, 0xe9, 0xc3, 0x04, 0x26,
- 0x00, 0x00, 0xca, 0xb5, 0xcb, 0xc7, 0xc8, 0xa3,
- 0xea, 0x10, 0xc6, 0xc7, 0x71, 0xd1, 0xc7, 0x47,
- 0xd2, 0xc7, 0x47, 0x9d, 0x49, 0x93, 0x02, 0xec,
- 0xed, 0xc8, 0xcb, 0xc7, 0xc2, 0x04, 0xa3, 0xea,
- 0x0c, 0xc6, 0xc7, 0x71, 0xd1, 0xc7, 0x47, 0x49,
- 0x93, 0x02, 0xec, 0xf0, 0xdd, 0xc6, 0x23, 0x01,
- 0x00, 0xc4, 0x03, 0x9c, 0x09, 0x0e, 0x04, 0x17,
- 0x17, 0x26, 0x0d, 0x0d, 0x0e, 0x12, 0x17, 0x17,
- 0x26, 0x4e, 0x2b, 0x3a, 0x0e, 0x43, 0x06, 0x01,
- 0xa6, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x07, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xa4, 0x05, 0x26, 0x01,
- 0xdd, 0xd1, 0xd2, 0x8c, 0x23, 0x02, 0x00, 0xc4,
- 0x03, 0xae, 0x09, 0x01, 0x03, 0x0e, 0x43, 0x06,
- 0x01, 0xa8, 0x05, 0x02, 0x06, 0x02, 0x06, 0x01,
- 0x00, 0x58, 0x08, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00,
- 0x00, 0x00, 0xbc, 0x06, 0x00, 0x01, 0x00, 0xf6,
- 0x06, 0x00, 0x02, 0x00, 0xe6, 0x07, 0x00, 0x03,
- 0x00, 0xd8, 0x06, 0x00, 0x04, 0x00, 0xd0, 0x06,
- 0x00, 0x05, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xdd,
- 0xd1, 0xef, 0xd5, 0xdd, 0xd2, 0xef, 0xd6, 0xd1,
- 0xe9, 0xcb, 0xd2, 0xe9, 0xcc, 0xc7, 0xc8, 0x9d,
- 0xb6, 0x9e, 0xc3, 0x04, 0x26, 0x00, 0x00, 0xc3,
- 0x05, 0xb5, 0xc9, 0xc5, 0xc2, 0x04, 0xa3, 0xea,
- 0x0a, 0xc2, 0x05, 0xc5, 0xb5, 0x49, 0x93, 0x00,
- 0xec, 0xf2, 0xb5, 0xc9, 0xc5, 0xc7, 0xa3, 0xea,
- 0x21, 0xb5, 0xca, 0xc6, 0xc8, 0xa3, 0xea, 0x16,
- 0xc2, 0x05, 0xc5, 0xc6, 0x9d, 0x71, 0x13, 0x47,
- 0xd1, 0xc5, 0x47, 0xd2, 0xc6, 0x47, 0x9a, 0x9d,
- 0x49, 0x93, 0x01, 0xec, 0xe7, 0x93, 0x00, 0xec,
- 0xdc, 0xdd, 0xc2, 0x05, 0x23, 0x01, 0x00, 0xc4,
- 0x03, 0xb1, 0x09, 0x0e, 0x04, 0x17, 0x17, 0x12,
- 0x12, 0x26, 0x1c, 0x2b, 0x30, 0x26, 0x26, 0x58,
- 0x17, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xaa, 0x05,
- 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x06, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0xc7, 0x28, 0x12, 0x0d, 0x12, 0x0d, 0x26, 0x49,
+ 0x17, 0x0e, 0x43, 0x06, 0x05, 0xae, 0x05, 0x02,
+ 0x05, 0x02, 0x05, 0x00, 0x00, 0x5a, 0xca, 0x03,
+ 0x9c, 0x09, 0x0e, 0x07, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xee, 0x07,
+ 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00,
+ 0xb2, 0x06, 0x00, 0x02, 0x00, 0x80, 0x07, 0x00,
+ 0x03, 0x00, 0xf0, 0x07, 0x00, 0x04, 0x00, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xd2, 0xef, 0xd6, 0xd1,
+ 0xe9, 0xd2, 0xe9, 0xa3, 0xea, 0x07, 0xd1, 0xc9,
+ 0xd2, 0xd5, 0xc5, 0xd6, 0xd2, 0xe9, 0xcc, 0xd1,
+ 0xe9, 0xc3, 0x04, 0x26, 0x00, 0x00, 0xca, 0xb5,
+ 0xcb, 0xc7, 0xc8, 0xa3, 0xea, 0x10, 0xc6, 0xc7,
+ 0x71, 0xd1, 0xc7, 0x47, 0xd2, 0xc7, 0x47, 0x9d,
+ 0x49, 0x93, 0x02, 0xec, 0xed, 0xc8, 0xcb, 0xc7,
+ 0xc2, 0x04, 0xa3, 0xea, 0x0c, 0xc6, 0xc7, 0x71,
+ 0xd1, 0xc7, 0x47, 0x49, 0x93, 0x02, 0xec, 0xf0,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc6, 0x23, 0x01,
+ 0x00, 0x04, 0x2b, 0x2b, 0x26, 0x0d, 0x0d, 0x0e,
+ 0x12, 0x17, 0x17, 0x26, 0x4e, 0x2b, 0x3a, 0x0e,
+ 0x43, 0x06, 0x05, 0xb0, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x01, 0x00, 0x07, 0xca, 0x03, 0xae, 0x09,
+ 0x01, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xae, 0x05, 0x26, 0x01,
+ 0xdd, 0xd1, 0xd2, 0x8c, 0x23, 0x02, 0x00, 0x03,
+ 0x0e, 0x43, 0x06, 0x05, 0xb2, 0x05, 0x02, 0x06,
+ 0x02, 0x06, 0x00, 0x00, 0x64, 0xca, 0x03, 0xb1,
+ 0x09, 0x0e, 0x08, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00,
+ 0x00, 0x00, 0xc6, 0x06, 0x00, 0x01, 0x00, 0x80,
+ 0x07, 0x00, 0x02, 0x00, 0xf0, 0x07, 0x00, 0x03,
+ 0x00, 0xe2, 0x06, 0x00, 0x04, 0x00, 0xda, 0x06,
+ 0x00, 0x05, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0xd5, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xd2, 0xef, 0xd6, 0xd1, 0xe9, 0xcb, 0xd2, 0xe9,
+ 0xcc, 0xc7, 0xc8, 0x9d, 0xb6, 0x9e, 0xc3, 0x04,
+ 0x26, 0x00, 0x00, 0xc3, 0x05, 0xb5, 0xc9, 0xc5,
+ 0xc2, 0x04, 0xa3, 0xea, 0x0a, 0xc2, 0x05, 0xc5,
+ 0xb5, 0x49, 0x93, 0x00, 0xec, 0xf2, 0xb5, 0xc9,
+ 0xc5, 0xc7, 0xa3, 0xea, 0x21, 0xb5, 0xca, 0xc6,
+ 0xc8, 0xa3, 0xea, 0x16, 0xc2, 0x05, 0xc5, 0xc6,
+ 0x9d, 0x71, 0x13, 0x47, 0xd1, 0xc5, 0x47, 0xd2,
+ 0xc6, 0x47, 0x9a, 0x9d, 0x49, 0x93, 0x01, 0xec,
+ 0xe7, 0x93, 0x00, 0xec, 0xdc, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0xc2, 0x05, 0x23, 0x01, 0x00, 0x04,
+ 0x2b, 0x2b, 0x12, 0x12, 0x26, 0x1c, 0x2b, 0x30,
+ 0x26, 0x26, 0x58, 0x17, 0x17, 0x0e, 0x43, 0x06,
+ 0x05, 0xb4, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x06, 0xca, 0x03, 0xc2, 0x09, 0x01, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
  0x01, 0x00, 0xd1, 0xb6, 0xd2, 0x9b, 0x9a, 0x28,
- 0xc4, 0x03, 0xc2, 0x09, 0x01, 0x03, 0x0e, 0x43,
- 0x06, 0x01, 0xac, 0x05, 0x02, 0x00, 0x02, 0x04,
- 0x02, 0x00, 0x0a, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x03,
- 0x12, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xdd, 0xde,
- 0xd1, 0xef, 0xde, 0xd2, 0xef, 0x23, 0x02, 0x00,
- 0xc4, 0x03, 0xc5, 0x09, 0x02, 0x04, 0x17, 0x0e,
- 0x43, 0x06, 0x01, 0xae, 0x05, 0x02, 0x00, 0x02,
- 0x04, 0x01, 0x00, 0x0e, 0x02, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0,
- 0x03, 0x03, 0x00, 0xdd, 0x42, 0x8c, 0x01, 0x00,
- 0x00, 0xd1, 0xd2, 0x24, 0x02, 0x00, 0xb6, 0x47,
- 0x28, 0xc4, 0x03, 0xca, 0x09, 0x01, 0x03, 0x0e,
- 0x43, 0x06, 0x01, 0xb0, 0x05, 0x02, 0x02, 0x02,
- 0x03, 0x00, 0x00, 0x22, 0x04, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
- 0x00, 0xd1, 0xe9, 0xcd, 0xd2, 0xe9, 0xaa, 0xea,
- 0x03, 0x09, 0x28, 0xb5, 0xca, 0xc6, 0xc5, 0xa3,
- 0xea, 0x10, 0xd1, 0xc6, 0x47, 0xd2, 0xc6, 0x47,
- 0xaa, 0xea, 0x03, 0x09, 0x28, 0x93, 0x01, 0xec,
- 0xed, 0x0a, 0x28, 0xc4, 0x03, 0xcd, 0x09, 0x08,
- 0x04, 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01,
- 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xd1, 0x28, 0xc4, 0x03, 0xe1, 0x09,
- 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x03, 0x01, 0x04, 0x01, 0x00, 0x1f, 0x04, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00,
- 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
- 0x00, 0x02, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xd1,
+ 0x03, 0x0e, 0x43, 0x06, 0x05, 0xb6, 0x05, 0x02,
+ 0x00, 0x02, 0x04, 0x00, 0x00, 0x16, 0xca, 0x03,
+ 0xc5, 0x09, 0x02, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xed,
+ 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xd2,
+ 0xef, 0x23, 0x02, 0x00, 0x04, 0x3f, 0x0e, 0x43,
+ 0x06, 0x05, 0xb8, 0x05, 0x02, 0x00, 0x02, 0x04,
+ 0x00, 0x00, 0x12, 0xca, 0x03, 0xca, 0x09, 0x01,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0x42, 0x91, 0x01, 0x00, 0x00, 0xd1, 0xd2, 0x24,
+ 0x02, 0x00, 0xb6, 0x47, 0x28, 0x03, 0x0e, 0x43,
+ 0x06, 0x05, 0xba, 0x05, 0x02, 0x02, 0x02, 0x03,
+ 0x00, 0x00, 0x22, 0xca, 0x03, 0xcd, 0x09, 0x08,
+ 0x04, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x00, 0x00,
+ 0xb2, 0x06, 0x00, 0x01, 0x00, 0xd1, 0xe9, 0xcd,
+ 0xd2, 0xe9, 0xaa, 0xea, 0x03, 0x09, 0x28, 0xb5,
+ 0xca, 0xc6, 0xc5, 0xa3, 0xea, 0x10, 0xd1, 0xc6,
+ 0x47, 0xd2, 0xc6, 0x47, 0xaa, 0xea, 0x03, 0x09,
+ 0x28, 0x93, 0x01, 0xec, 0xed, 0x0a, 0x28, 0x04,
+ 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d, 0x17, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01, 0x01,
+ 0x00, 0x00, 0x02, 0xca, 0x03, 0xe1, 0x09, 0x01,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x28,
+ 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x03,
+ 0x01, 0x04, 0x00, 0x00, 0x23, 0xca, 0x03, 0xe4,
+ 0x09, 0x05, 0x04, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xda, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00,
+ 0x01, 0x00, 0xe2, 0x06, 0x00, 0x02, 0x00, 0xd1,
  0xe9, 0xcb, 0x26, 0x00, 0x00, 0xc9, 0xb5, 0xca,
  0xc6, 0xc7, 0xa3, 0xea, 0x0d, 0xc5, 0xc6, 0x71,
  0xd1, 0xc6, 0x47, 0x8c, 0x49, 0x93, 0x01, 0xec,
- 0xf0, 0xdd, 0xc5, 0x23, 0x01, 0x00, 0xc4, 0x03,
- 0xe4, 0x09, 0x05, 0x04, 0x12, 0x17, 0x26, 0x3f,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x08, 0x02,
- 0x05, 0x01, 0x00, 0xbc, 0x01, 0x0a, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xf6, 0x06, 0x00, 0x00, 0x00, 0xe6, 0x07, 0x00,
- 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02, 0x00, 0xbc,
- 0x06, 0x00, 0x03, 0x00, 0xe8, 0x06, 0x00, 0x04,
- 0x00, 0xd0, 0x06, 0x00, 0x05, 0x00, 0xd8, 0x06,
- 0x00, 0x06, 0x00, 0xee, 0x06, 0x00, 0x07, 0x00,
- 0xd0, 0x03, 0x03, 0x00, 0xd2, 0x42, 0x8b, 0x01,
+ 0xf0, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc5, 0x23,
+ 0x01, 0x00, 0x04, 0x12, 0x17, 0x26, 0x3f, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x08, 0x02, 0x05,
+ 0x00, 0x00, 0xc8, 0x01, 0xca, 0x03, 0xff, 0x09,
+ 0x17, 0x0a, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00,
+ 0x00, 0xf0, 0x07, 0x00, 0x01, 0x00, 0xb2, 0x06,
+ 0x00, 0x02, 0x00, 0xc6, 0x06, 0x00, 0x03, 0x00,
+ 0xf2, 0x06, 0x00, 0x04, 0x00, 0xda, 0x06, 0x00,
+ 0x05, 0x00, 0xe2, 0x06, 0x00, 0x06, 0x00, 0xf8,
+ 0x06, 0x00, 0x07, 0x00, 0xd2, 0x42, 0x90, 0x01,
  0x00, 0x00, 0x24, 0x00, 0x00, 0xb5, 0xa3, 0xea,
- 0x0d, 0x38, 0xcc, 0x00, 0x00, 0x00, 0x04, 0xbf,
+ 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xc4,
  0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xe9, 0xc9,
- 0xd2, 0xe9, 0xca, 0xc5, 0xc6, 0xa3, 0xea, 0x0c,
- 0xdd, 0xb5, 0x26, 0x01, 0x00, 0xef, 0xd1, 0x26,
- 0x02, 0x00, 0x28, 0x38, 0x96, 0x00, 0x00, 0x00,
- 0x41, 0x3e, 0x00, 0x00, 0x00, 0x41, 0x91, 0x01,
- 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0xc3, 0x05, 0x26, 0x00, 0x00,
- 0xc3, 0x04, 0x92, 0x01, 0xc5, 0xc6, 0x9e, 0xc3,
- 0x06, 0xb5, 0xcb, 0xc7, 0xc2, 0x06, 0xa3, 0xea,
- 0x0a, 0xc2, 0x04, 0xc7, 0xb5, 0x49, 0x93, 0x02,
- 0xec, 0xf2, 0xc2, 0x06, 0xb6, 0x9e, 0xcb, 0xc7,
- 0xb5, 0xa6, 0xea, 0x41, 0xc2, 0x05, 0xc7, 0xc6,
- 0x9d, 0x47, 0xc4, 0x07, 0xb5, 0xaa, 0xea, 0x31,
- 0xc2, 0x07, 0xd2, 0xc6, 0x47, 0x9b, 0xc3, 0x07,
- 0xc2, 0x05, 0xc7, 0xc6, 0x9d, 0xb5, 0x49, 0xb5,
- 0xcc, 0xc8, 0xc6, 0xa3, 0xea, 0x15, 0xc2, 0x05,
- 0xc7, 0xc8, 0x9d, 0x71, 0x13, 0x47, 0xd2, 0xc8,
- 0x47, 0xc2, 0x07, 0x9a, 0x9e, 0x49, 0x93, 0x03,
- 0xec, 0xe8, 0xc2, 0x04, 0xc7, 0xc2, 0x07, 0x49,
- 0x92, 0x02, 0xec, 0xbc, 0xdd, 0xc2, 0x04, 0xef,
- 0xdd, 0xc2, 0x05, 0xef, 0x26, 0x02, 0x00, 0x28,
- 0xc4, 0x03, 0xff, 0x09, 0x17, 0x04, 0x44, 0x3f,
- 0x12, 0x12, 0x1c, 0x3a, 0x85, 0x1c, 0x0d, 0x1c,
- 0x2b, 0x30, 0x35, 0x2b, 0x17, 0x2b, 0x26, 0x26,
- 0x53, 0x17, 0x22, 0x17, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x01, 0x02, 0x04, 0x01, 0x00, 0x2a,
- 0x03, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00,
- 0xd0, 0x03, 0x03, 0x00, 0xd2, 0x42, 0x8b, 0x01,
+ 0xd2, 0xe9, 0xca, 0xc5, 0xc6, 0xa3, 0xea, 0x10,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xb5, 0x26, 0x01,
+ 0x00, 0xef, 0xd1, 0x26, 0x02, 0x00, 0x28, 0x38,
+ 0x99, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x41, 0x96, 0x01, 0x00, 0x00, 0x42, 0xac,
+ 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc3,
+ 0x05, 0x26, 0x00, 0x00, 0xc3, 0x04, 0x92, 0x01,
+ 0xc5, 0xc6, 0x9e, 0xc3, 0x06, 0xb5, 0xcb, 0xc7,
+ 0xc2, 0x06, 0xa3, 0xea, 0x0a, 0xc2, 0x04, 0xc7,
+ 0xb5, 0x49, 0x93, 0x02, 0xec, 0xf2, 0xc2, 0x06,
+ 0xb6, 0x9e, 0xcb, 0xc7, 0xb5, 0xa6, 0xea, 0x41,
+ 0xc2, 0x05, 0xc7, 0xc6, 0x9d, 0x47, 0xc4, 0x07,
+ 0xb5, 0xaa, 0xea, 0x31, 0xc2, 0x07, 0xd2, 0xc6,
+ 0x47, 0x9b, 0xc3, 0x07, 0xc2, 0x05, 0xc7, 0xc6,
+ 0x9d, 0xb5, 0x49, 0xb5, 0xcc, 0xc8, 0xc6, 0xa3,
+ 0xea, 0x15, 0xc2, 0x05, 0xc7, 0xc8, 0x9d, 0x71,
+ 0x13, 0x47, 0xd2, 0xc8, 0x47, 0xc2, 0x07, 0x9a,
+ 0x9e, 0x49, 0x93, 0x03, 0xec, 0xe8, 0xc2, 0x04,
+ 0xc7, 0xc2, 0x07, 0x49, 0x92, 0x02, 0xec, 0xbc,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc2, 0x04, 0xef,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc2, 0x05, 0xef,
+ 0x26, 0x02, 0x00, 0x28, 0x04, 0x44, 0x3f, 0x12,
+ 0x12, 0x1c, 0x4e, 0x85, 0x1c, 0x0d, 0x1c, 0x2b,
+ 0x30, 0x35, 0x2b, 0x17, 0x2b, 0x26, 0x26, 0x53,
+ 0x17, 0x22, 0x17, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x2e, 0xca,
+ 0x03, 0x9a, 0x0a, 0x06, 0x03, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xe4,
+ 0x06, 0x00, 0x00, 0x00, 0xd2, 0x42, 0x90, 0x01,
  0x00, 0x00, 0x24, 0x00, 0x00, 0xb5, 0xa6, 0xea,
- 0x15, 0xdd, 0x42, 0x8c, 0x01, 0x00, 0x00, 0xd1,
- 0xd2, 0x24, 0x02, 0x00, 0xc9, 0xd2, 0xd5, 0xc5,
- 0xb6, 0x47, 0xd6, 0xec, 0xe0, 0xd1, 0xd1, 0xd1,
- 0xe9, 0xb6, 0x9e, 0x47, 0x9b, 0x28, 0xc4, 0x03,
- 0x9a, 0x0a, 0x06, 0x04, 0x44, 0x3f, 0x0d, 0x17,
- 0x0e, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x06,
- 0x02, 0x04, 0x01, 0x00, 0x6f, 0x08, 0xe4, 0x06,
- 0x00, 0x01, 0x00, 0xe6, 0x06, 0x00, 0x01, 0x00,
- 0xe8, 0x06, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00,
- 0x01, 0x00, 0xec, 0x06, 0x00, 0x02, 0x00, 0xba,
- 0x06, 0x00, 0x03, 0x00, 0xee, 0x06, 0x00, 0x04,
- 0x00, 0xda, 0x06, 0x00, 0x05, 0x00, 0xd0, 0x03,
- 0x03, 0x00, 0xd1, 0xca, 0xd2, 0xcb, 0xdd, 0xb6,
- 0x26, 0x01, 0x00, 0xef, 0xc3, 0x04, 0xdd, 0xb5,
- 0x26, 0x01, 0x00, 0xef, 0xcc, 0xc6, 0x42, 0x8b,
+ 0x19, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42, 0x91,
+ 0x01, 0x00, 0x00, 0xd1, 0xd2, 0x24, 0x02, 0x00,
+ 0xc9, 0xd2, 0xd5, 0xc5, 0xb6, 0x47, 0xd6, 0xec,
+ 0xdc, 0xd1, 0xd1, 0xd1, 0xe9, 0xb6, 0x9e, 0x47,
+ 0x9b, 0x28, 0x04, 0x44, 0x53, 0x0d, 0x17, 0x0e,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x02, 0x06, 0x02,
+ 0x04, 0x00, 0x00, 0x7f, 0xca, 0x03, 0xa4, 0x0a,
+ 0x10, 0x08, 0xee, 0x06, 0x00, 0x01, 0x00, 0xf0,
+ 0x06, 0x00, 0x01, 0x00, 0xf2, 0x06, 0x00, 0x00,
+ 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0xf6, 0x06,
+ 0x00, 0x02, 0x00, 0xc4, 0x06, 0x00, 0x03, 0x00,
+ 0xf8, 0x06, 0x00, 0x04, 0x00, 0xe4, 0x06, 0x00,
+ 0x05, 0x00, 0xd1, 0xca, 0xd2, 0xcb, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0xb6, 0x26, 0x01, 0x00, 0xef,
+ 0xc3, 0x04, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xb5,
+ 0x26, 0x01, 0x00, 0xef, 0xcc, 0xc6, 0x42, 0x90,
  0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb5, 0xa6,
- 0xea, 0x29, 0xdd, 0x42, 0x8c, 0x01, 0x00, 0x00,
- 0xc7, 0xc6, 0x24, 0x02, 0x00, 0xc4, 0x05, 0xb5,
- 0x47, 0xc9, 0xc6, 0xcb, 0xc2, 0x05, 0xb6, 0x47,
- 0xca, 0xc2, 0x04, 0xc3, 0x05, 0xc8, 0xc5, 0xc2,
- 0x04, 0x9a, 0x9e, 0xc3, 0x04, 0xc2, 0x05, 0xcc,
- 0xec, 0xcc, 0xc7, 0x42, 0x8b, 0x01, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xb5, 0xa5, 0xea, 0x0d, 0x38,
- 0xcc, 0x00, 0x00, 0x00, 0x04, 0xb9, 0x01, 0x00,
- 0x00, 0xef, 0x2f, 0xdd, 0x42, 0x8c, 0x01, 0x00,
+ 0xea, 0x2d, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42,
+ 0x91, 0x01, 0x00, 0x00, 0xc7, 0xc6, 0x24, 0x02,
+ 0x00, 0xc4, 0x05, 0xb5, 0x47, 0xc9, 0xc6, 0xcb,
+ 0xc2, 0x05, 0xb6, 0x47, 0xca, 0xc2, 0x04, 0xc3,
+ 0x05, 0xc8, 0xc5, 0xc2, 0x04, 0x9a, 0x9e, 0xc3,
+ 0x04, 0xc2, 0x05, 0xcc, 0xec, 0xc8, 0xc7, 0x42,
+ 0x90, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb5,
+ 0xa5, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
+ 0x04, 0xbe, 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x42, 0x91, 0x01, 0x00,
  0x00, 0xc8, 0xd2, 0x24, 0x02, 0x00, 0xb6, 0x47,
- 0x28, 0xc4, 0x03, 0xa4, 0x0a, 0x10, 0x04, 0x0d,
- 0x0d, 0x2b, 0x26, 0x44, 0x44, 0x12, 0x0d, 0x1c,
- 0x17, 0x2b, 0x12, 0x0e, 0x44, 0x3f, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
- 0x00, 0x05, 0x01, 0x8e, 0x07, 0x00, 0x01, 0x00,
- 0xa2, 0x05, 0x25, 0x01, 0xdd, 0xd1, 0x23, 0x01,
- 0x00, 0xc4, 0x03, 0xb8, 0x0a, 0x01, 0x03, 0x0e,
- 0x43, 0x06, 0x01, 0xd2, 0x03, 0x02, 0x04, 0x02,
- 0x04, 0x02, 0x00, 0x8e, 0x01, 0x06, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00,
- 0xa4, 0x06, 0x00, 0x00, 0x00, 0xda, 0x06, 0x00,
- 0x01, 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xd2,
- 0x03, 0x00, 0x01, 0x14, 0xd0, 0x03, 0x03, 0x00,
- 0xd4, 0x03, 0x12, 0x00, 0x0c, 0x03, 0xcb, 0x0c,
- 0x02, 0xcc, 0xc7, 0xea, 0x0d, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0xbd, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa6,
+ 0x28, 0x04, 0x0d, 0x0d, 0x3f, 0x3a, 0x44, 0x58,
+ 0x12, 0x0d, 0x1c, 0x17, 0x2b, 0x12, 0x0e, 0x44,
+ 0x3f, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0x02, 0x01, 0x00, 0x05, 0xca, 0x03, 0xb8,
+ 0x0a, 0x01, 0x01, 0x98, 0x07, 0x00, 0x01, 0x00,
+ 0xac, 0x05, 0x25, 0x01, 0xdd, 0xd1, 0x23, 0x01,
+ 0x00, 0x03, 0x0e, 0x43, 0x26, 0x05, 0xd8, 0x03,
+ 0x02, 0x04, 0x02, 0x04, 0x00, 0x00, 0x9e, 0x01,
+ 0xca, 0x03, 0xbf, 0x0a, 0x12, 0x06, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xfe, 0x06, 0x00, 0x01, 0x00,
+ 0xae, 0x06, 0x00, 0x00, 0x00, 0xe4, 0x06, 0x00,
+ 0x01, 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xd8,
+ 0x03, 0x00, 0x01, 0x14, 0x0c, 0x03, 0xcb, 0x0c,
+ 0x02, 0xcc, 0xc7, 0xea, 0x0d, 0x38, 0xd2, 0x00,
+ 0x00, 0x00, 0x04, 0xc2, 0x01, 0x00, 0x00, 0xef,
+ 0x2f, 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xab,
  0x01, 0x00, 0x00, 0xc8, 0x41, 0x3e, 0x00, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0xc9, 0xd2, 0xdd, 0xa7,
- 0xea, 0x45, 0xd2, 0x42, 0x8b, 0x01, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xb5, 0xa4, 0xea, 0x0d, 0x38,
- 0xcc, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x01, 0x00,
- 0x00, 0xef, 0x2f, 0xd1, 0xde, 0xa7, 0xea, 0x12,
- 0xc8, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2,
- 0xf0, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9b,
- 0x28, 0xdd, 0xd1, 0xef, 0xd5, 0xdd, 0x42, 0x8c,
+ 0x00, 0x24, 0x01, 0x00, 0xc9, 0xd2, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0xa7, 0xea, 0x51, 0xd2, 0x42,
+ 0x90, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb5,
+ 0xa4, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
+ 0x04, 0xf9, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1,
+ 0x38, 0xed, 0x00, 0x00, 0x00, 0xa7, 0xea, 0x12,
+ 0xc8, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2,
+ 0xf0, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9b,
+ 0x28, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xd5, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42, 0x91,
  0x01, 0x00, 0x00, 0xd1, 0xd2, 0x24, 0x02, 0x00,
- 0xce, 0xb6, 0x47, 0xd5, 0xec, 0x0d, 0x38, 0xcf,
- 0x00, 0x00, 0x00, 0x04, 0xd3, 0x01, 0x00, 0x00,
- 0xef, 0x2f, 0xc5, 0xd1, 0x43, 0xd4, 0x01, 0x00,
- 0x00, 0xc5, 0xd2, 0x43, 0xd5, 0x01, 0x00, 0x00,
- 0xc5, 0x28, 0xc4, 0x03, 0xbf, 0x0a, 0x12, 0x22,
- 0x12, 0x3f, 0x67, 0x1c, 0x44, 0x3f, 0x1c, 0x53,
- 0x08, 0x17, 0x3f, 0x13, 0x0d, 0x3a, 0x08, 0x26,
- 0x26, 0x0e, 0x43, 0x06, 0x01, 0xb2, 0x05, 0x02,
- 0x00, 0x02, 0x03, 0x01, 0x00, 0x62, 0x02, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
- 0x00, 0xd2, 0x03, 0x13, 0x00, 0xd1, 0xdd, 0xa7,
- 0x96, 0xea, 0x13, 0xdd, 0xd1, 0xd2, 0x41, 0xd4,
- 0x01, 0x00, 0x00, 0x9d, 0xd2, 0x41, 0xd5, 0x01,
- 0x00, 0x00, 0x23, 0x02, 0x00, 0xd2, 0xdd, 0xa7,
- 0x96, 0xea, 0x13, 0xdd, 0xd1, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0xd2, 0x9d, 0xd1, 0x41, 0xd5, 0x01,
- 0x00, 0x00, 0x23, 0x02, 0x00, 0xd1, 0x41, 0xd5,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xd5, 0x01, 0x00,
- 0x00, 0xaa, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00,
- 0x00, 0x04, 0xd6, 0x01, 0x00, 0x00, 0xef, 0x2f,
- 0xdd, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9d, 0xd1, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4,
- 0x03, 0xd6, 0x0a, 0x07, 0x03, 0x21, 0x5d, 0x21,
- 0x5e, 0x4e, 0x3f, 0x0e, 0x43, 0x06, 0x01, 0xb4,
- 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x07,
- 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xb2, 0x05, 0x2d, 0x01, 0xdd,
- 0xd1, 0xd2, 0x8c, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xe1, 0x0a, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
- 0xb6, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x62, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xd2, 0x03, 0x13, 0x00,
- 0xd1, 0xdd, 0xa7, 0x96, 0xea, 0x13, 0xdd, 0xd1,
- 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9a, 0xd2,
- 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xd2, 0xdd, 0xa7, 0x96, 0xea, 0x13, 0xdd, 0xd1,
- 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd2, 0x9a, 0xd1,
- 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
- 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d, 0x38,
- 0xcf, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x01, 0x00,
- 0x00, 0xef, 0x2f, 0xdd, 0xd1, 0x41, 0xd4, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xd4, 0x01, 0x00, 0x00,
- 0x9a, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xc4, 0x03, 0xe4, 0x0a, 0x07, 0x03,
- 0x21, 0x5d, 0x21, 0x5e, 0x4e, 0x3f, 0x0e, 0x43,
- 0x06, 0x01, 0xb8, 0x05, 0x02, 0x00, 0x02, 0x04,
- 0x02, 0x00, 0x1e, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd2, 0x03,
- 0x13, 0x00, 0xb6, 0x05, 0x2f, 0x01, 0xd2, 0xdd,
- 0xa7, 0x96, 0xea, 0x0b, 0xdd, 0xd2, 0xd1, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0xf0, 0xd6, 0xde, 0xd1,
- 0xd2, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x24, 0x00,
- 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xef, 0x0a,
- 0x03, 0x03, 0x21, 0x35, 0x0e, 0x43, 0x06, 0x01,
- 0xba, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
- 0x1f, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xd1, 0x41, 0xd5, 0x01,
- 0x00, 0x00, 0xd2, 0x41, 0xd5, 0x01, 0x00, 0x00,
- 0xa9, 0x11, 0xea, 0x0f, 0x0e, 0xd1, 0x41, 0xd4,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xd4, 0x01, 0x00,
- 0x00, 0xa9, 0x28, 0xc4, 0x03, 0xf4, 0x0a, 0x01,
- 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xd1, 0x28, 0xc4, 0x03, 0x80,
- 0x0b, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x11, 0x01,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xd2, 0x03, 0x13,
- 0x00, 0xdd, 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00,
- 0x8c, 0xd1, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xc4, 0x03, 0x83, 0x0b, 0x01, 0x03,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x03, 0x00,
- 0x05, 0x02, 0x00, 0x2f, 0x03, 0xba, 0x06, 0x00,
- 0x00, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0x10,
- 0x00, 0x01, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xd2,
- 0x03, 0x13, 0x00, 0x08, 0xcb, 0xc7, 0xcd, 0x41,
- 0xd5, 0x01, 0x00, 0x00, 0xce, 0xdd, 0xa7, 0xea,
- 0x16, 0xde, 0xdd, 0x42, 0xf4, 0x00, 0x00, 0x00,
- 0xc5, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xc6, 0x24,
- 0x02, 0x00, 0xc6, 0x23, 0x02, 0x00, 0x38, 0xcf,
- 0x00, 0x00, 0x00, 0x04, 0xd7, 0x01, 0x00, 0x00,
- 0xef, 0x2f, 0xc4, 0x03, 0x92, 0x0b, 0x04, 0x0d,
- 0x26, 0x1c, 0x6d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x22, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x04, 0xf5,
- 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd4, 0x01, 0x00,
- 0x00, 0x9d, 0x04, 0xd9, 0x01, 0x00, 0x00, 0x9d,
- 0xc5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x9d, 0x04,
- 0xda, 0x01, 0x00, 0x00, 0x9d, 0x28, 0xc4, 0x03,
- 0x9a, 0x0b, 0x01, 0x0d, 0x0e, 0x43, 0x06, 0x01,
- 0xd4, 0x03, 0x02, 0x06, 0x02, 0x04, 0x01, 0x00,
- 0xa9, 0x01, 0x08, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
- 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00, 0xdc,
- 0x06, 0x00, 0x02, 0x00, 0xa4, 0x06, 0x00, 0x03,
- 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xd4, 0x03,
- 0x00, 0x01, 0x14, 0xd0, 0x03, 0x03, 0x00, 0x0c,
- 0x03, 0xc3, 0x04, 0x0c, 0x02, 0xc3, 0x05, 0xc2,
- 0x04, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0xbd, 0x01, 0x00, 0x00, 0xef, 0x2f, 0xd1,
- 0xdd, 0xa7, 0x96, 0x11, 0xeb, 0x06, 0x0e, 0xd2,
- 0xdd, 0xa7, 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0xef,
- 0x2f, 0xdd, 0x42, 0x8c, 0x01, 0x00, 0x00, 0xd1,
+ 0xce, 0xb6, 0x47, 0xd5, 0xec, 0x0d, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0xd8, 0x01, 0x00, 0x00,
+ 0xef, 0x2f, 0xc5, 0xd1, 0x43, 0xd9, 0x01, 0x00,
+ 0x00, 0xc5, 0xd2, 0x43, 0xda, 0x01, 0x00, 0x00,
+ 0xc5, 0x28, 0x22, 0x12, 0x3f, 0x67, 0x30, 0x44,
+ 0x3f, 0x30, 0x53, 0x08, 0x2b, 0x53, 0x13, 0x0d,
+ 0x3a, 0x08, 0x26, 0x26, 0x0e, 0x43, 0x06, 0x05,
+ 0xbc, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x76, 0xca, 0x03, 0xd6, 0x0a, 0x07, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0x38, 0xec, 0x00, 0x00, 0x00, 0xa7,
+ 0x96, 0xea, 0x17, 0x38, 0xec, 0x00, 0x00, 0x00,
+ 0xd1, 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00, 0x9d,
+ 0xd2, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23, 0x02,
+ 0x00, 0xd2, 0x38, 0xec, 0x00, 0x00, 0x00, 0xa7,
+ 0x96, 0xea, 0x17, 0x38, 0xec, 0x00, 0x00, 0x00,
+ 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2, 0x9d,
+ 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23, 0x02,
+ 0x00, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xda, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d,
+ 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xdb, 0x01,
+ 0x00, 0x00, 0xef, 0x2f, 0x38, 0xec, 0x00, 0x00,
+ 0x00, 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xd9, 0x01, 0x00, 0x00, 0x9d, 0xd1, 0x41,
+ 0xda, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x03,
+ 0x35, 0x71, 0x35, 0x72, 0x4e, 0x3f, 0x0e, 0x43,
+ 0x06, 0x05, 0xbe, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x01, 0x00, 0x07, 0xca, 0x03, 0xe1, 0x0a, 0x01,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xbc, 0x05, 0x2d, 0x01, 0xdd,
+ 0xd1, 0xd2, 0x8c, 0x23, 0x02, 0x00, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0xc0, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x00, 0x00, 0x76, 0xca, 0x03, 0xe4, 0x0a,
+ 0x07, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xd1, 0x38, 0xec, 0x00,
+ 0x00, 0x00, 0xa7, 0x96, 0xea, 0x17, 0x38, 0xec,
+ 0x00, 0x00, 0x00, 0xd1, 0xd2, 0x41, 0xd9, 0x01,
+ 0x00, 0x00, 0x9a, 0xd2, 0x41, 0xda, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd2, 0x38, 0xec, 0x00,
+ 0x00, 0x00, 0xa7, 0x96, 0xea, 0x17, 0x38, 0xec,
+ 0x00, 0x00, 0x00, 0xd1, 0x41, 0xd9, 0x01, 0x00,
+ 0x00, 0xd2, 0x9a, 0xd1, 0x41, 0xda, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd1, 0x41, 0xda, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xaa, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00,
+ 0x04, 0xdb, 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38,
+ 0xec, 0x00, 0x00, 0x00, 0xd1, 0x41, 0xd9, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xd9, 0x01, 0x00, 0x00,
+ 0x9a, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0x03, 0x35, 0x71, 0x35, 0x72, 0x4e,
+ 0x3f, 0x0e, 0x43, 0x06, 0x05, 0xc2, 0x05, 0x02,
+ 0x00, 0x02, 0x04, 0x01, 0x00, 0x26, 0xca, 0x03,
+ 0xef, 0x0a, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xc0, 0x05,
+ 0x2f, 0x01, 0xd2, 0x38, 0xec, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x0f, 0x38, 0xec, 0x00, 0x00,
+ 0x00, 0xd2, 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xf0, 0xd6, 0xdd, 0xd1, 0xd2, 0x42, 0x01, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0x03, 0x35, 0x49, 0x0e, 0x43, 0x06, 0x05, 0xc4,
+ 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x1f,
+ 0xca, 0x03, 0xf4, 0x0a, 0x01, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0x41, 0xda, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xda, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f,
+ 0x0e, 0xd1, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xd9, 0x01, 0x00, 0x00, 0xa9, 0x28, 0x03,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x02, 0xca, 0x03, 0x80, 0x0b,
+ 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1,
+ 0x28, 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x03, 0x00, 0x00, 0x15, 0xca, 0x03,
+ 0x83, 0x0b, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xec, 0x00, 0x00, 0x00, 0xd1, 0x41,
+ 0xd9, 0x01, 0x00, 0x00, 0x8c, 0xd1, 0x41, 0xda,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x03, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x03, 0x00, 0x05,
+ 0x00, 0x00, 0x3b, 0xca, 0x03, 0x92, 0x0b, 0x04,
+ 0x03, 0xc4, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcb, 0xc7, 0xcd, 0x41, 0xda, 0x01, 0x00, 0x00,
+ 0xce, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xa7, 0xea,
+ 0x1e, 0x38, 0xec, 0x00, 0x00, 0x00, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0x42, 0xf7, 0x00, 0x00, 0x00,
+ 0xc5, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xc6, 0x24,
+ 0x02, 0x00, 0xc6, 0x23, 0x02, 0x00, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0xdc, 0x01, 0x00, 0x00,
+ 0xef, 0x2f, 0x0d, 0x26, 0x30, 0x95, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x22, 0xca, 0x03, 0x9a, 0x0b, 0x01, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9, 0x04, 0xfa,
+ 0x01, 0x00, 0x00, 0xc5, 0x41, 0xd9, 0x01, 0x00,
+ 0x00, 0x9d, 0x04, 0xde, 0x01, 0x00, 0x00, 0x9d,
+ 0xc5, 0x41, 0xda, 0x01, 0x00, 0x00, 0x9d, 0x04,
+ 0xdf, 0x01, 0x00, 0x00, 0x9d, 0x28, 0x0d, 0x0e,
+ 0x43, 0x26, 0x05, 0xda, 0x03, 0x02, 0x06, 0x02,
+ 0x04, 0x00, 0x00, 0xc1, 0x01, 0xca, 0x03, 0xa1,
+ 0x0b, 0x11, 0x08, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xc8, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00,
+ 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xe6,
+ 0x06, 0x00, 0x02, 0x00, 0xae, 0x06, 0x00, 0x03,
+ 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xda, 0x03,
+ 0x00, 0x01, 0x14, 0x0c, 0x03, 0xc3, 0x04, 0x0c,
+ 0x02, 0xc3, 0x05, 0xc2, 0x04, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x01, 0x00,
+ 0x00, 0xef, 0x2f, 0xd1, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0xa7, 0x96, 0x11, 0xeb, 0x0a, 0x0e, 0xd2,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xa7, 0x96, 0xea,
+ 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04, 0xf3,
+ 0x01, 0x00, 0x00, 0xef, 0x2f, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0x42, 0x91, 0x01, 0x00, 0x00, 0xd1,
  0xd2, 0x24, 0x02, 0x00, 0xcd, 0xb6, 0x47, 0xce,
- 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0x42, 0x90, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
  0xb5, 0xa3, 0xea, 0x05, 0xc5, 0xb5, 0x47, 0x28,
- 0xdd, 0x42, 0xf0, 0x00, 0x00, 0x00, 0xd2, 0xc6,
- 0x24, 0x02, 0x00, 0xcf, 0x42, 0x8b, 0x01, 0x00,
- 0x00, 0x24, 0x00, 0x00, 0xb5, 0xa5, 0xea, 0x1d,
- 0xdd, 0x42, 0x8c, 0x01, 0x00, 0x00, 0xd1, 0xc7,
- 0x24, 0x02, 0x00, 0xb5, 0x47, 0xd5, 0xdd, 0x42,
- 0x8c, 0x01, 0x00, 0x00, 0xd2, 0xc7, 0x24, 0x02,
- 0x00, 0xb5, 0x47, 0xd6, 0x38, 0x95, 0x00, 0x00,
- 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xc2, 0x05,
- 0x41, 0x3e, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
- 0xd0, 0xd1, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xc8,
- 0xd2, 0x43, 0xc1, 0x01, 0x00, 0x00, 0xc8, 0x28,
- 0xc4, 0x03, 0xa1, 0x0b, 0x11, 0x2d, 0x17, 0x3f,
- 0x2b, 0x21, 0x3f, 0x3f, 0x12, 0x3f, 0x17, 0x3f,
- 0x3f, 0x49, 0x4a, 0x6c, 0x21, 0x26, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01,
- 0x00, 0x12, 0x01, 0x10, 0x00, 0x01, 0x00, 0xd4,
- 0x03, 0x12, 0x00, 0x08, 0xc9, 0xdd, 0xc5, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xc5, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03, 0xb9,
- 0x0b, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x22, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xd4, 0x03, 0x12, 0x00,
- 0x08, 0xc9, 0xdd, 0xc5, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00, 0x24, 0x00,
- 0x00, 0xc5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x42,
- 0xfc, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23,
- 0x02, 0x00, 0xc4, 0x03, 0xbc, 0x0b, 0x01, 0x0d,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x02, 0x00,
- 0x04, 0x01, 0x00, 0x6b, 0x02, 0xe0, 0x07, 0x00,
- 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x9c, 0x05,
- 0x22, 0x01, 0x08, 0xca, 0xc6, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xb5, 0xa4, 0xea, 0x1f, 0xdd, 0xc6,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0xb5, 0x47, 0xef,
- 0x96, 0xea, 0x12, 0xc6, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0x42, 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00,
- 0x00, 0xc9, 0xec, 0x1c, 0x04, 0xdc, 0x01, 0x00,
- 0x00, 0xc6, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x42,
- 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9d,
- 0x04, 0xda, 0x01, 0x00, 0x00, 0x9d, 0xc9, 0xc5,
- 0x04, 0xf6, 0x01, 0x00, 0x00, 0xc6, 0x41, 0xc1,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42, 0xf3, 0x00,
+ 0x00, 0x00, 0xd2, 0xc6, 0x24, 0x02, 0x00, 0xcf,
+ 0x42, 0x90, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xb5, 0xa5, 0xea, 0x25, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x42, 0x91, 0x01, 0x00, 0x00, 0xd1, 0xc7,
+ 0x24, 0x02, 0x00, 0xb5, 0x47, 0xd5, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0x42, 0x91, 0x01, 0x00, 0x00,
+ 0xd2, 0xc7, 0x24, 0x02, 0x00, 0xb5, 0x47, 0xd6,
+ 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xab, 0x01,
+ 0x00, 0x00, 0xc2, 0x05, 0x41, 0x3e, 0x00, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0xd0, 0xd1, 0x43, 0xc5,
+ 0x01, 0x00, 0x00, 0xc8, 0xd2, 0x43, 0xc6, 0x01,
+ 0x00, 0x00, 0xc8, 0x28, 0x2d, 0x17, 0x3f, 0x3f,
+ 0x35, 0x3f, 0x53, 0x12, 0x3f, 0x17, 0x53, 0x3f,
+ 0x5d, 0x5e, 0x6c, 0x21, 0x26, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00,
+ 0x16, 0xca, 0x03, 0xb9, 0x0b, 0x01, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc9, 0x38, 0xed, 0x00,
+ 0x00, 0x00, 0xc5, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xc5, 0x41, 0xc5, 0x01, 0x00, 0x00, 0x23, 0x02,
+ 0x00, 0x0d, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x04, 0x00, 0x00, 0x26, 0xca, 0x03,
+ 0xbc, 0x0b, 0x01, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xc9, 0x38, 0xed, 0x00, 0x00, 0x00, 0xc5,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0x42, 0xff, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xc5, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x42, 0xff, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x23, 0x02, 0x00, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x02, 0x00, 0x04,
+ 0x01, 0x00, 0x6b, 0xca, 0x03, 0xbf, 0x0b, 0x06,
+ 0x02, 0xea, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0xa6, 0x05, 0x22, 0x01, 0x08, 0xca,
+ 0xc6, 0x41, 0xc5, 0x01, 0x00, 0x00, 0x42, 0x90,
+ 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb5, 0xa4,
+ 0xea, 0x1f, 0xdd, 0xc6, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0xb5, 0x47, 0xef, 0x96, 0xea, 0x12, 0xc6,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0x42, 0x3a, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xc9, 0xec, 0x1c,
+ 0x04, 0xe1, 0x01, 0x00, 0x00, 0xc6, 0x41, 0xc5,
  0x01, 0x00, 0x00, 0x42, 0x3a, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0x9d, 0x04, 0xda, 0x01, 0x00,
- 0x00, 0x9d, 0x9d, 0xcd, 0x28, 0xc4, 0x03, 0xbf,
- 0x0b, 0x06, 0x0e, 0x5d, 0x44, 0x59, 0x8a, 0x94,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01,
- 0x04, 0x00, 0x00, 0x22, 0x02, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
- 0xc5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x42, 0x5d,
- 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc5,
- 0x41, 0xc1, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00,
- 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x9b, 0x28,
- 0xc4, 0x03, 0xc9, 0x0b, 0x01, 0x0d, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x03, 0x00, 0x05, 0x01,
- 0x00, 0x2e, 0x03, 0xd8, 0x06, 0x00, 0x00, 0x00,
- 0xdc, 0x06, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
- 0x00, 0xd4, 0x03, 0x12, 0x00, 0x08, 0xcb, 0xc7,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0xc9, 0xc7, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xca, 0xdd, 0xc5, 0x42,
- 0xf8, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc6,
- 0x9a, 0xc5, 0xc6, 0x42, 0xf8, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0x9a, 0x9e, 0xc6, 0xc6, 0x9a,
- 0x23, 0x02, 0x00, 0xc4, 0x03, 0xcc, 0x0b, 0x02,
- 0x0d, 0x49, 0x0e, 0x43, 0x06, 0x01, 0xbc, 0x05,
- 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x42, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xd4, 0x03, 0x12, 0x00, 0xdd, 0x42,
- 0x8d, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
- 0xd5, 0xdd, 0x42, 0x8d, 0x01, 0x00, 0x00, 0xd2,
- 0x24, 0x01, 0x00, 0xd6, 0xdd, 0xd1, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc1, 0x01, 0x00,
- 0x00, 0x9a, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00,
- 0xd2, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9a, 0x9d,
- 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0x9a, 0x23, 0x02, 0x00,
- 0xc4, 0x03, 0xd2, 0x0b, 0x03, 0x03, 0x3a, 0x3a,
- 0x0e, 0x43, 0x06, 0x01, 0xbe, 0x05, 0x02, 0x00,
- 0x02, 0x04, 0x01, 0x00, 0x42, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xd4, 0x03, 0x12, 0x00, 0xdd, 0x42, 0x8d, 0x01,
- 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xd5, 0xdd,
- 0x42, 0x8d, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
- 0x00, 0xd6, 0xdd, 0xd1, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0xd2, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a,
- 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc0, 0x01, 0x00, 0x00, 0x9a, 0x9e, 0xd1, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc1, 0x01,
- 0x00, 0x00, 0x9a, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xd7, 0x0b, 0x03, 0x03, 0x3a, 0x3a, 0x0e, 0x43,
- 0x06, 0x01, 0xc0, 0x05, 0x02, 0x00, 0x02, 0x04,
- 0x01, 0x00, 0x34, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x03,
- 0x12, 0x00, 0xdd, 0x42, 0x8d, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0xd5, 0xdd, 0x42, 0x8d,
+ 0x24, 0x00, 0x00, 0x9d, 0x04, 0xdf, 0x01, 0x00,
+ 0x00, 0x9d, 0xc9, 0xc5, 0x04, 0xfb, 0x01, 0x00,
+ 0x00, 0xc6, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x42,
+ 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9d,
+ 0x04, 0xdf, 0x01, 0x00, 0x00, 0x9d, 0x9d, 0xcd,
+ 0x28, 0x0e, 0x5d, 0x44, 0x59, 0x8a, 0x94, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x01, 0x01, 0x01, 0x04,
+ 0x00, 0x00, 0x22, 0xca, 0x03, 0xc9, 0x0b, 0x01,
+ 0x02, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xc9, 0xc5, 0x41, 0xc5, 0x01,
+ 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0xc5, 0x41, 0xc6, 0x01, 0x00,
+ 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x9b, 0x28, 0x0d, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+ 0x32, 0xca, 0x03, 0xcc, 0x0b, 0x02, 0x03, 0xe2,
+ 0x06, 0x00, 0x00, 0x00, 0xe6, 0x06, 0x00, 0x01,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcb, 0xc7,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xc9, 0xc7, 0x41,
+ 0xc6, 0x01, 0x00, 0x00, 0xca, 0x38, 0xed, 0x00,
+ 0x00, 0x00, 0xc5, 0x42, 0xfb, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xc6, 0x9a, 0xc5, 0xc6, 0x42,
+ 0xfb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9a,
+ 0x9e, 0xc6, 0xc6, 0x9a, 0x23, 0x02, 0x00, 0x0d,
+ 0x49, 0x0e, 0x43, 0x06, 0x05, 0xc6, 0x05, 0x02,
+ 0x00, 0x02, 0x04, 0x00, 0x00, 0x4e, 0xca, 0x03,
+ 0xd2, 0x0b, 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xed,
+ 0x00, 0x00, 0x00, 0x42, 0x92, 0x01, 0x00, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0xd5, 0x38, 0xed, 0x00,
+ 0x00, 0x00, 0x42, 0x92, 0x01, 0x00, 0x00, 0xd2,
+ 0x24, 0x01, 0x00, 0xd6, 0x38, 0xed, 0x00, 0x00,
+ 0x00, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41,
+ 0xc6, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc5, 0x01,
+ 0x00, 0x00, 0x9a, 0x9d, 0xd1, 0x41, 0xc6, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0x9a, 0x23, 0x02, 0x00, 0x03, 0x4e, 0x4e, 0x0e,
+ 0x43, 0x06, 0x05, 0xc8, 0x05, 0x02, 0x00, 0x02,
+ 0x04, 0x00, 0x00, 0x4e, 0xca, 0x03, 0xd7, 0x0b,
+ 0x03, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xed, 0x00, 0x00,
+ 0x00, 0x42, 0x92, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0xd5, 0x38, 0xed, 0x00, 0x00, 0x00,
+ 0x42, 0x92, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
+ 0x00, 0xd6, 0x38, 0xed, 0x00, 0x00, 0x00, 0xd1,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41, 0xc6, 0x01,
+ 0x00, 0x00, 0xd2, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0x9a, 0x9e, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0x23,
+ 0x02, 0x00, 0x03, 0x4e, 0x4e, 0x0e, 0x43, 0x06,
+ 0x05, 0xca, 0x05, 0x02, 0x00, 0x02, 0x04, 0x00,
+ 0x00, 0x40, 0xca, 0x03, 0xdc, 0x0b, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42,
+ 0x92, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xd5, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42, 0x92,
  0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xd6,
- 0xdd, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc1, 0x01,
- 0x00, 0x00, 0x9a, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xdc, 0x0b, 0x03, 0x03, 0x3a, 0x3a, 0x0e, 0x43,
- 0x06, 0x01, 0xc2, 0x05, 0x02, 0x00, 0x02, 0x04,
- 0x01, 0x00, 0x34, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x03,
- 0x12, 0x00, 0xdd, 0x42, 0x8d, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0xd5, 0xdd, 0x42, 0x8d,
+ 0x38, 0xed, 0x00, 0x00, 0x00, 0xd1, 0x41, 0xc5,
+ 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0x9a, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x9a, 0x23,
+ 0x02, 0x00, 0x03, 0x4e, 0x4e, 0x0e, 0x43, 0x06,
+ 0x05, 0xcc, 0x05, 0x02, 0x00, 0x02, 0x04, 0x00,
+ 0x00, 0x40, 0xca, 0x03, 0xe1, 0x0b, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42,
+ 0x92, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xd5, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42, 0x92,
  0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xd6,
- 0xdd, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9a, 0xd1, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0x9a, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xe1, 0x0b, 0x03, 0x03, 0x3a, 0x3a, 0x0e, 0x43,
- 0x06, 0x01, 0xc4, 0x05, 0x02, 0x00, 0x02, 0x03,
- 0x01, 0x00, 0x35, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x03,
- 0x12, 0x00, 0xdd, 0x42, 0x8d, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0xd5, 0xdd, 0x42, 0x8d,
+ 0x38, 0xed, 0x00, 0x00, 0x00, 0xd1, 0x41, 0xc5,
+ 0x01, 0x00, 0x00, 0xd2, 0x41, 0xc6, 0x01, 0x00,
+ 0x00, 0x9a, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0xd2, 0x41, 0xc5, 0x01, 0x00, 0x00, 0x9a, 0x23,
+ 0x02, 0x00, 0x03, 0x4e, 0x4e, 0x0e, 0x43, 0x06,
+ 0x05, 0xce, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x3d, 0xca, 0x03, 0xe6, 0x0b, 0x03, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42,
+ 0x92, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xd5, 0x38, 0xed, 0x00, 0x00, 0x00, 0x42, 0x92,
  0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0xd6,
- 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xc0, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f,
- 0x0e, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd2,
- 0x41, 0xc1, 0x01, 0x00, 0x00, 0xa9, 0x28, 0xc4,
- 0x03, 0xe6, 0x0b, 0x03, 0x03, 0x3a, 0x3b, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
- 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd1, 0x28, 0xc4, 0x03, 0xf5, 0x0b, 0x01,
- 0x03, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01,
- 0x01, 0x03, 0x01, 0x00, 0x13, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xd4,
- 0x03, 0x12, 0x00, 0x08, 0xc9, 0xdd, 0xc5, 0x41,
- 0xc0, 0x01, 0x00, 0x00, 0x8c, 0xc5, 0x41, 0xc1,
- 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xf8, 0x0b, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x00, 0x2e,
- 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06,
- 0x00, 0x00, 0x00, 0xd4, 0x03, 0x12, 0x00, 0xd0,
- 0x03, 0x03, 0x00, 0xd1, 0xdd, 0xa7, 0xea, 0x03,
- 0xd1, 0x28, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42,
- 0xa6, 0x01, 0x00, 0x00, 0xdd, 0x41, 0x3e, 0x00,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0xcd, 0xde, 0xd1,
- 0xef, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xc5, 0xde,
- 0xb6, 0xef, 0x43, 0xc1, 0x01, 0x00, 0x00, 0xc5,
- 0x28, 0xc4, 0x03, 0x8a, 0x0c, 0x07, 0x04, 0x1c,
- 0x08, 0x08, 0x67, 0x2b, 0x30, 0x0e, 0x43, 0x06,
- 0x01, 0xc6, 0x05, 0x01, 0x02, 0x01, 0x02, 0x00,
- 0x00, 0x19, 0x03, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00,
+ 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x41,
+ 0xc5, 0x01, 0x00, 0x00, 0xa9, 0x11, 0xea, 0x0f,
+ 0x0e, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0xd2,
+ 0x41, 0xc6, 0x01, 0x00, 0x00, 0xa9, 0x28, 0x03,
+ 0x4e, 0x4f, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0xca, 0x03,
+ 0xf5, 0x0b, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0x28, 0x03, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x17,
+ 0xca, 0x03, 0xf8, 0x0b, 0x01, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc9, 0x38, 0xed, 0x00, 0x00, 0x00, 0xc5, 0x41,
+ 0xc5, 0x01, 0x00, 0x00, 0x8c, 0xc5, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x0d, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x01, 0x01, 0x01, 0x03,
+ 0x00, 0x00, 0x3e, 0xca, 0x03, 0x8a, 0x0c, 0x07,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xae, 0x06,
+ 0x00, 0x00, 0x00, 0xd1, 0x38, 0xed, 0x00, 0x00,
+ 0x00, 0xa7, 0xea, 0x03, 0xd1, 0x28, 0x38, 0x98,
+ 0x00, 0x00, 0x00, 0x42, 0xab, 0x01, 0x00, 0x00,
+ 0x38, 0xed, 0x00, 0x00, 0x00, 0x41, 0x3e, 0x00,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xcd, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0xd1, 0xef, 0x43, 0xc5, 0x01,
+ 0x00, 0x00, 0xc5, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xb6, 0xef, 0x43, 0xc6, 0x01, 0x00, 0x00, 0xc5,
+ 0x28, 0x04, 0x30, 0x08, 0x08, 0x7b, 0x3f, 0x44,
+ 0x0e, 0x43, 0x06, 0x05, 0xd0, 0x05, 0x01, 0x02,
+ 0x01, 0x02, 0x00, 0x00, 0x19, 0xca, 0x03, 0x9a,
+ 0x0c, 0x06, 0x03, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xb2, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00,
  0x01, 0x00, 0xd1, 0xe9, 0xca, 0xb5, 0xc9, 0xc5,
  0xc6, 0xa3, 0xea, 0x0e, 0xd1, 0xc5, 0x47, 0xb5,
  0xaa, 0xea, 0x03, 0xc5, 0x28, 0x93, 0x00, 0xec,
- 0xef, 0xc6, 0x28, 0xc4, 0x03, 0x9a, 0x0c, 0x06,
- 0x04, 0x12, 0x26, 0x26, 0x0d, 0x17, 0x0e, 0x43,
- 0x06, 0x01, 0xc8, 0x05, 0x01, 0x00, 0x01, 0x02,
- 0x02, 0x00, 0x0b, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0x9a, 0x05, 0x21, 0x01, 0xd0, 0x03, 0x03,
- 0x00, 0xdd, 0xd1, 0xef, 0x11, 0xeb, 0x05, 0x0e,
- 0xd1, 0xde, 0xa7, 0x28, 0xc4, 0x03, 0xa4, 0x0c,
- 0x02, 0x04, 0x26, 0x0e, 0x43, 0x06, 0x01, 0xd6,
- 0x03, 0x02, 0x04, 0x02, 0x05, 0x04, 0x00, 0x7e,
- 0x06, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
- 0x00, 0x01, 0x00, 0xee, 0x07, 0x00, 0x00, 0x00,
- 0xd0, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00,
- 0x02, 0x00, 0xd6, 0x03, 0x00, 0x01, 0x14, 0xc8,
- 0x05, 0x38, 0x01, 0xd0, 0x03, 0x03, 0x00, 0xc6,
- 0x05, 0x37, 0x01, 0xd4, 0x03, 0x12, 0x00, 0x0c,
- 0x02, 0xcc, 0xd1, 0xc8, 0xa7, 0xea, 0x03, 0xd1,
- 0x28, 0xdd, 0xd1, 0xef, 0xea, 0x4e, 0xd2, 0xb5,
- 0xa4, 0xea, 0x0c, 0xc8, 0x42, 0x8e, 0x01, 0x00,
- 0x00, 0xb5, 0xb5, 0x25, 0x02, 0x00, 0xde, 0xd1,
- 0xef, 0xd5, 0xdf, 0xd1, 0xef, 0xc9, 0xc8, 0x42,
- 0x8e, 0x01, 0x00, 0x00, 0xd2, 0xc5, 0x24, 0x02,
- 0x00, 0xca, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x42,
- 0xf8, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xc5, 0x9e,
- 0xd2, 0x24, 0x02, 0x00, 0xd6, 0xb5, 0xcb, 0xc7,
- 0xd2, 0xa3, 0xea, 0x0e, 0xc6, 0xc7, 0x71, 0xd1,
- 0xc7, 0xc5, 0x9d, 0x47, 0x49, 0x93, 0x02, 0xec,
- 0xef, 0xc6, 0x28, 0xd1, 0xe0, 0xa7, 0xea, 0x12,
- 0xc8, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd2,
- 0xf0, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9b,
- 0x28, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0xbc,
- 0x01, 0x00, 0x00, 0xef, 0x2f, 0xc4, 0x03, 0xab,
- 0x0c, 0x10, 0x14, 0x1c, 0x08, 0x21, 0x1d, 0x3b,
- 0x17, 0x17, 0x3f, 0x62, 0x26, 0x44, 0x09, 0x21,
- 0x53, 0x08, 0x0e, 0x43, 0x06, 0x01, 0xca, 0x05,
- 0x02, 0x0a, 0x02, 0x05, 0x05, 0x00, 0x85, 0x02,
- 0x0c, 0xf2, 0x07, 0x00, 0x01, 0x00, 0xf4, 0x07,
- 0x00, 0x01, 0x00, 0xe4, 0x07, 0x00, 0x00, 0x00,
- 0xdc, 0x06, 0x00, 0x01, 0x00, 0xee, 0x07, 0x00,
- 0x02, 0x00, 0xd8, 0x06, 0x00, 0x03, 0x00, 0xd0,
- 0x06, 0x00, 0x04, 0x00, 0xa8, 0x06, 0x00, 0x05,
- 0x00, 0xbc, 0x06, 0x00, 0x06, 0x00, 0xf6, 0x07,
- 0x00, 0x07, 0x00, 0xf8, 0x07, 0x00, 0x08, 0x00,
- 0xfa, 0x07, 0x00, 0x09, 0x00, 0xd6, 0x03, 0x04,
- 0x00, 0xc8, 0x05, 0x38, 0x01, 0xd0, 0x03, 0x03,
- 0x00, 0xd4, 0x03, 0x12, 0x00, 0xc6, 0x05, 0x37,
- 0x01, 0xd1, 0xdd, 0xa7, 0x96, 0xea, 0x07, 0xd1,
- 0xc9, 0xd2, 0xd5, 0xc5, 0xd6, 0xd1, 0x41, 0xf7,
- 0x01, 0x00, 0x00, 0xd1, 0xe9, 0x9d, 0xca, 0xde,
- 0xd2, 0xef, 0xea, 0x11, 0xdf, 0xd2, 0xef, 0xd6,
- 0xc6, 0xb5, 0xa4, 0xea, 0x03, 0xd1, 0x28, 0xb5,
- 0xc3, 0x07, 0xec, 0x52, 0xd2, 0xe0, 0xa7, 0xea,
- 0x31, 0x5e, 0x04, 0x00, 0xd2, 0x41, 0xc0, 0x01,
- 0x00, 0x00, 0xef, 0x5e, 0x04, 0x00, 0xd2, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0xef, 0x9e, 0xc3, 0x05,
- 0xc6, 0xc2, 0x05, 0xa4, 0xea, 0x03, 0xd1, 0x28,
- 0xdd, 0xd2, 0xc6, 0xc2, 0x05, 0x9e, 0xf0, 0xda,
- 0x41, 0xf7, 0x01, 0x00, 0x00, 0xc3, 0x07, 0xec,
- 0x1d, 0xd2, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xc3,
- 0x07, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x42, 0xf8,
- 0x01, 0x00, 0x00, 0xc6, 0xc2, 0x07, 0xd2, 0xe9,
- 0x9d, 0x24, 0x02, 0x00, 0xca, 0x38, 0x9d, 0x00,
- 0x00, 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00, 0xd1,
- 0x41, 0xf7, 0x01, 0x00, 0x00, 0xc2, 0x07, 0x24,
- 0x02, 0x00, 0xcb, 0xc6, 0xc7, 0x9e, 0xcc, 0xdd,
- 0x42, 0x8e, 0x01, 0x00, 0x00, 0xc8, 0xc7, 0x24,
- 0x02, 0x00, 0xc3, 0x04, 0xc7, 0xc3, 0x05, 0xc2,
- 0x05, 0xc6, 0xa3, 0xea, 0x50, 0xc2, 0x05, 0xd1,
- 0x41, 0xf7, 0x01, 0x00, 0x00, 0x9e, 0xc4, 0x06,
- 0xb5, 0xa6, 0xea, 0x10, 0xc2, 0x06, 0xd1, 0xe9,
- 0xa3, 0xea, 0x09, 0xd1, 0xc2, 0x06, 0x47, 0xc3,
- 0x08, 0xec, 0x04, 0xb5, 0xc3, 0x08, 0xc2, 0x05,
- 0xc2, 0x07, 0x9e, 0xc4, 0x06, 0xb5, 0xa6, 0xea,
- 0x10, 0xc2, 0x06, 0xd2, 0xe9, 0xa3, 0xea, 0x09,
- 0xd2, 0xc2, 0x06, 0x47, 0xc3, 0x09, 0xec, 0x04,
- 0xb5, 0xc3, 0x09, 0xc2, 0x04, 0xc2, 0x05, 0xc7,
- 0x9e, 0x71, 0xc2, 0x08, 0xc2, 0x09, 0x9d, 0x49,
- 0x93, 0x05, 0xec, 0xac, 0xc2, 0x04, 0x42, 0x8a,
- 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03,
- 0xc4, 0x0c, 0x22, 0x04, 0x21, 0x0d, 0x0d, 0x0e,
- 0x35, 0x1c, 0x17, 0x1c, 0x0d, 0x12, 0x27, 0x76,
- 0x21, 0x0e, 0x2b, 0x26, 0x0d, 0x2b, 0x68, 0x71,
- 0x17, 0x45, 0x30, 0x3a, 0x3a, 0x2c, 0x12, 0x26,
+ 0xef, 0xc6, 0x28, 0x04, 0x12, 0x26, 0x26, 0x0d,
+ 0x17, 0x0e, 0x43, 0x06, 0x05, 0xd2, 0x05, 0x01,
+ 0x00, 0x01, 0x02, 0x01, 0x00, 0x0f, 0xca, 0x03,
+ 0xa4, 0x0c, 0x02, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xa4, 0x05, 0x21, 0x01, 0xdd, 0xd1, 0xef,
+ 0x11, 0xeb, 0x09, 0x0e, 0xd1, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0xa7, 0x28, 0x04, 0x26, 0x0e, 0x43,
+ 0x26, 0x05, 0xdc, 0x03, 0x02, 0x04, 0x02, 0x05,
+ 0x02, 0x00, 0x86, 0x01, 0xca, 0x03, 0xab, 0x0c,
+ 0x10, 0x06, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xe2,
+ 0x06, 0x00, 0x01, 0x00, 0xf8, 0x07, 0x00, 0x00,
+ 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06,
+ 0x00, 0x02, 0x00, 0xdc, 0x03, 0x00, 0x01, 0x14,
+ 0xd2, 0x05, 0x38, 0x01, 0xd0, 0x05, 0x37, 0x01,
+ 0x0c, 0x02, 0xcc, 0xd1, 0xc8, 0xa7, 0xea, 0x03,
+ 0xd1, 0x28, 0xdd, 0xd1, 0xef, 0xea, 0x52, 0xd2,
+ 0xb5, 0xa4, 0xea, 0x0c, 0xc8, 0x42, 0x93, 0x01,
+ 0x00, 0x00, 0xb5, 0xb5, 0x25, 0x02, 0x00, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5, 0xde,
+ 0xd1, 0xef, 0xc9, 0xc8, 0x42, 0x93, 0x01, 0x00,
+ 0x00, 0xd2, 0xc5, 0x24, 0x02, 0x00, 0xca, 0x38,
+ 0xa0, 0x00, 0x00, 0x00, 0x42, 0xfd, 0x01, 0x00,
+ 0x00, 0xd1, 0xe9, 0xc5, 0x9e, 0xd2, 0x24, 0x02,
+ 0x00, 0xd6, 0xb5, 0xcb, 0xc7, 0xd2, 0xa3, 0xea,
+ 0x0e, 0xc6, 0xc7, 0x71, 0xd1, 0xc7, 0xc5, 0x9d,
+ 0x47, 0x49, 0x93, 0x02, 0xec, 0xef, 0xc6, 0x28,
+ 0xd1, 0x38, 0xed, 0x00, 0x00, 0x00, 0xa7, 0xea,
+ 0x12, 0xc8, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0xd2, 0xf0, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0x9b, 0x28, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04,
+ 0xc1, 0x01, 0x00, 0x00, 0xef, 0x2f, 0x14, 0x1c,
+ 0x08, 0x21, 0x1d, 0x3b, 0x2b, 0x17, 0x3f, 0x62,
+ 0x26, 0x44, 0x09, 0x35, 0x53, 0x08, 0x0e, 0x43,
+ 0x06, 0x05, 0xd4, 0x05, 0x02, 0x0a, 0x02, 0x05,
+ 0x02, 0x00, 0x95, 0x02, 0xca, 0x03, 0xc4, 0x0c,
+ 0x22, 0x0c, 0xfc, 0x07, 0x00, 0x01, 0x00, 0xfe,
+ 0x07, 0x00, 0x01, 0x00, 0xee, 0x07, 0x00, 0x00,
+ 0x00, 0xe6, 0x06, 0x00, 0x01, 0x00, 0xf8, 0x07,
+ 0x00, 0x02, 0x00, 0xe2, 0x06, 0x00, 0x03, 0x00,
+ 0xda, 0x06, 0x00, 0x04, 0x00, 0xb2, 0x06, 0x00,
+ 0x05, 0x00, 0xc6, 0x06, 0x00, 0x06, 0x00, 0x80,
+ 0x08, 0x00, 0x07, 0x00, 0x82, 0x08, 0x00, 0x08,
+ 0x00, 0x84, 0x08, 0x00, 0x09, 0x00, 0xd2, 0x05,
+ 0x38, 0x01, 0xd0, 0x05, 0x37, 0x01, 0xd1, 0x38,
+ 0xee, 0x00, 0x00, 0x00, 0xa7, 0x96, 0xea, 0x07,
+ 0xd1, 0xc9, 0xd2, 0xd5, 0xc5, 0xd6, 0xd1, 0x41,
+ 0xfc, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0x9d, 0xca,
+ 0xdd, 0xd2, 0xef, 0xea, 0x15, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0xd2, 0xef, 0xd6, 0xc6, 0xb5, 0xa4,
+ 0xea, 0x03, 0xd1, 0x28, 0xb5, 0xc3, 0x07, 0xec,
+ 0x56, 0xd2, 0x38, 0xed, 0x00, 0x00, 0x00, 0xa7,
+ 0xea, 0x31, 0xde, 0xd2, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0xef, 0xde, 0xd2, 0x41, 0xc6, 0x01, 0x00,
+ 0x00, 0xef, 0x9e, 0xc3, 0x05, 0xc6, 0xc2, 0x05,
+ 0xa4, 0xea, 0x03, 0xd1, 0x28, 0x38, 0xee, 0x00,
+ 0x00, 0x00, 0xd2, 0xc6, 0xc2, 0x05, 0x9e, 0xf0,
+ 0xda, 0x41, 0xfc, 0x01, 0x00, 0x00, 0xc3, 0x07,
+ 0xec, 0x1d, 0xd2, 0x41, 0xfc, 0x01, 0x00, 0x00,
+ 0xc3, 0x07, 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42,
+ 0xfd, 0x01, 0x00, 0x00, 0xc6, 0xc2, 0x07, 0xd2,
+ 0xe9, 0x9d, 0x24, 0x02, 0x00, 0xca, 0x38, 0xa0,
+ 0x00, 0x00, 0x00, 0x42, 0xfd, 0x01, 0x00, 0x00,
+ 0xd1, 0x41, 0xfc, 0x01, 0x00, 0x00, 0xc2, 0x07,
+ 0x24, 0x02, 0x00, 0xcb, 0xc6, 0xc7, 0x9e, 0xcc,
+ 0x38, 0xee, 0x00, 0x00, 0x00, 0x42, 0x93, 0x01,
+ 0x00, 0x00, 0xc8, 0xc7, 0x24, 0x02, 0x00, 0xc3,
+ 0x04, 0xc7, 0xc3, 0x05, 0xc2, 0x05, 0xc6, 0xa3,
+ 0xea, 0x50, 0xc2, 0x05, 0xd1, 0x41, 0xfc, 0x01,
+ 0x00, 0x00, 0x9e, 0xc4, 0x06, 0xb5, 0xa6, 0xea,
+ 0x10, 0xc2, 0x06, 0xd1, 0xe9, 0xa3, 0xea, 0x09,
+ 0xd1, 0xc2, 0x06, 0x47, 0xc3, 0x08, 0xec, 0x04,
+ 0xb5, 0xc3, 0x08, 0xc2, 0x05, 0xc2, 0x07, 0x9e,
+ 0xc4, 0x06, 0xb5, 0xa6, 0xea, 0x10, 0xc2, 0x06,
+ 0xd2, 0xe9, 0xa3, 0xea, 0x09, 0xd2, 0xc2, 0x06,
+ 0x47, 0xc3, 0x09, 0xec, 0x04, 0xb5, 0xc3, 0x09,
+ 0xc2, 0x04, 0xc2, 0x05, 0xc7, 0x9e, 0x71, 0xc2,
+ 0x08, 0xc2, 0x09, 0x9d, 0x49, 0x93, 0x05, 0xec,
+ 0xac, 0xc2, 0x04, 0x42, 0x8f, 0x01, 0x00, 0x00,
+ 0x25, 0x00, 0x00, 0x04, 0x35, 0x0d, 0x0d, 0x0e,
+ 0x35, 0x1c, 0x2b, 0x1c, 0x0d, 0x12, 0x3b, 0x62,
+ 0x21, 0x0e, 0x3f, 0x26, 0x0d, 0x2b, 0x68, 0x71,
+ 0x17, 0x59, 0x30, 0x3a, 0x3a, 0x2c, 0x12, 0x26,
  0x3a, 0x2c, 0x12, 0x44, 0x17, 0x0e, 0x43, 0x06,
- 0x01, 0xcc, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01,
- 0x00, 0x07, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xca, 0x05, 0x39,
- 0x01, 0xdd, 0xd1, 0xd2, 0x8c, 0x23, 0x02, 0x00,
- 0xc4, 0x03, 0xf0, 0x0c, 0x01, 0x03, 0x0e, 0x43,
- 0x06, 0x01, 0xce, 0x05, 0x02, 0x08, 0x02, 0x06,
- 0x01, 0x00, 0x95, 0x01, 0x0a, 0xf2, 0x07, 0x00,
- 0x01, 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
- 0x00, 0xbc, 0x06, 0x00, 0x02, 0x00, 0xd0, 0x06,
- 0x00, 0x03, 0x00, 0xee, 0x07, 0x00, 0x04, 0x00,
- 0xf6, 0x06, 0x00, 0x05, 0x00, 0xe6, 0x07, 0x00,
- 0x06, 0x00, 0xc0, 0x06, 0x00, 0x07, 0x00, 0xd6,
- 0x03, 0x04, 0x00, 0xd1, 0xdd, 0xa7, 0x96, 0xea,
- 0x09, 0xdd, 0xd1, 0xd2, 0xe9, 0xf0, 0xd5, 0xec,
- 0x0d, 0xd2, 0xdd, 0xa7, 0x96, 0xea, 0x07, 0xdd,
- 0xd2, 0xd1, 0xe9, 0xf0, 0xd6, 0xd1, 0x41, 0xf7,
- 0x01, 0x00, 0x00, 0xd2, 0x41, 0xf7, 0x01, 0x00,
- 0x00, 0x9d, 0xc3, 0x04, 0x38, 0x9d, 0x00, 0x00,
- 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00, 0xd1, 0xe9,
- 0xd2, 0xe9, 0x24, 0x02, 0x00, 0xc9, 0xd1, 0xe9,
- 0xc3, 0x05, 0xd2, 0xe9, 0xc3, 0x06, 0xdd, 0x42,
- 0x8e, 0x01, 0x00, 0x00, 0xc5, 0xc2, 0x04, 0x24,
- 0x02, 0x00, 0xcc, 0xb5, 0xca, 0xc6, 0xc2, 0x05,
- 0xa3, 0xea, 0x35, 0x38, 0x9d, 0x00, 0x00, 0x00,
- 0x42, 0xf8, 0x01, 0x00, 0x00, 0xc2, 0x06, 0xc5,
- 0xc6, 0x9e, 0x24, 0x02, 0x00, 0xc3, 0x07, 0xb5,
- 0xcb, 0xc7, 0xc2, 0x07, 0xa3, 0xea, 0x15, 0xc8,
- 0xc6, 0xc7, 0x9d, 0x71, 0x13, 0x47, 0xd1, 0xc6,
- 0x47, 0xd2, 0xc7, 0x47, 0x9a, 0x9d, 0x49, 0x93,
- 0x02, 0xec, 0xe7, 0x93, 0x01, 0xec, 0xc7, 0xc8,
- 0x42, 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00,
- 0xc4, 0x03, 0xf3, 0x0c, 0x10, 0x04, 0x21, 0x2b,
- 0x21, 0x21, 0x4e, 0x5d, 0x17, 0x17, 0x44, 0x2b,
+ 0x05, 0xd6, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01,
+ 0x00, 0x07, 0xca, 0x03, 0xf0, 0x0c, 0x01, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0xd4, 0x05, 0x39, 0x01, 0xdd, 0xd1,
+ 0xd2, 0x8c, 0x23, 0x02, 0x00, 0x03, 0x0e, 0x43,
+ 0x06, 0x05, 0xd8, 0x05, 0x02, 0x08, 0x02, 0x06,
+ 0x00, 0x00, 0xa9, 0x01, 0xca, 0x03, 0xf3, 0x0c,
+ 0x10, 0x0a, 0xfc, 0x07, 0x00, 0x01, 0x00, 0xfe,
+ 0x07, 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x00,
+ 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0xc6, 0x06,
+ 0x00, 0x02, 0x00, 0xda, 0x06, 0x00, 0x03, 0x00,
+ 0xf8, 0x07, 0x00, 0x04, 0x00, 0x80, 0x07, 0x00,
+ 0x05, 0x00, 0xf0, 0x07, 0x00, 0x06, 0x00, 0xca,
+ 0x06, 0x00, 0x07, 0x00, 0xd1, 0x38, 0xee, 0x00,
+ 0x00, 0x00, 0xa7, 0x96, 0xea, 0x0d, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0xd1, 0xd2, 0xe9, 0xf0, 0xd5,
+ 0xec, 0x15, 0xd2, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x0b, 0x38, 0xee, 0x00, 0x00,
+ 0x00, 0xd2, 0xd1, 0xe9, 0xf0, 0xd6, 0xd1, 0x41,
+ 0xfc, 0x01, 0x00, 0x00, 0xd2, 0x41, 0xfc, 0x01,
+ 0x00, 0x00, 0x9d, 0xc3, 0x04, 0x38, 0xa0, 0x00,
+ 0x00, 0x00, 0x42, 0xfd, 0x01, 0x00, 0x00, 0xd1,
+ 0xe9, 0xd2, 0xe9, 0x24, 0x02, 0x00, 0xc9, 0xd1,
+ 0xe9, 0xc3, 0x05, 0xd2, 0xe9, 0xc3, 0x06, 0x38,
+ 0xee, 0x00, 0x00, 0x00, 0x42, 0x93, 0x01, 0x00,
+ 0x00, 0xc5, 0xc2, 0x04, 0x24, 0x02, 0x00, 0xcc,
+ 0xb5, 0xca, 0xc6, 0xc2, 0x05, 0xa3, 0xea, 0x35,
+ 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42, 0xfd, 0x01,
+ 0x00, 0x00, 0xc2, 0x06, 0xc5, 0xc6, 0x9e, 0x24,
+ 0x02, 0x00, 0xc3, 0x07, 0xb5, 0xcb, 0xc7, 0xc2,
+ 0x07, 0xa3, 0xea, 0x15, 0xc8, 0xc6, 0xc7, 0x9d,
+ 0x71, 0x13, 0x47, 0xd1, 0xc6, 0x47, 0xd2, 0xc7,
+ 0x47, 0x9a, 0x9d, 0x49, 0x93, 0x02, 0xec, 0xe7,
+ 0x93, 0x01, 0xec, 0xc7, 0xc8, 0x42, 0x8f, 0x01,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x04, 0x35, 0x3f,
+ 0x35, 0x35, 0x4e, 0x5d, 0x17, 0x17, 0x58, 0x2b,
  0x67, 0x2b, 0x53, 0x17, 0x17, 0x0e, 0x43, 0x06,
- 0x01, 0xd0, 0x05, 0x02, 0x00, 0x02, 0x04, 0x02,
- 0x00, 0x1a, 0x02, 0xf2, 0x07, 0x00, 0x01, 0x00,
- 0xf4, 0x07, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x04,
- 0x00, 0xce, 0x05, 0x3b, 0x01, 0xd2, 0xdd, 0xa7,
- 0x96, 0xea, 0x07, 0xdd, 0xd2, 0xd1, 0xe9, 0xf0,
- 0xd6, 0xde, 0xd1, 0xd2, 0x42, 0xfe, 0x00, 0x00,
- 0x00, 0x24, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4,
- 0x03, 0x86, 0x0d, 0x03, 0x03, 0x21, 0x21, 0x0e,
- 0x43, 0x06, 0x01, 0xd2, 0x05, 0x02, 0x00, 0x02,
- 0x03, 0x05, 0x00, 0x29, 0x02, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xc6,
- 0x03, 0x00, 0x00, 0xdc, 0x04, 0x02, 0x01, 0xd6,
- 0x03, 0x04, 0x00, 0x86, 0x04, 0x01, 0x00, 0x88,
- 0x04, 0x02, 0x00, 0xdd, 0x42, 0x76, 0x01, 0x00,
- 0x00, 0xd2, 0x24, 0x01, 0x00, 0xea, 0x07, 0xde,
- 0xd1, 0xd2, 0x23, 0x02, 0x00, 0xd1, 0xdf, 0xa7,
- 0x96, 0xea, 0x07, 0xdf, 0xd1, 0xd2, 0xe9, 0xf0,
- 0xd5, 0xe0, 0x5e, 0x04, 0x00, 0xd1, 0xef, 0xd2,
- 0x9a, 0x23, 0x01, 0x00, 0xc4, 0x03, 0x8b, 0x0d,
- 0x05, 0x03, 0x3f, 0x22, 0x21, 0x21, 0x0e, 0x43,
- 0x06, 0x01, 0xd4, 0x05, 0x02, 0x02, 0x02, 0x03,
- 0x00, 0x00, 0x33, 0x04, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
- 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
- 0xd1, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xd2, 0x41,
- 0xf7, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x03, 0x09,
- 0x28, 0xd1, 0xe9, 0xcd, 0xd2, 0xe9, 0xaa, 0xea,
- 0x03, 0x09, 0x28, 0xb5, 0xca, 0xc6, 0xc5, 0xa3,
- 0xea, 0x10, 0xd1, 0xc6, 0x47, 0xd2, 0xc6, 0x47,
- 0xaa, 0xea, 0x03, 0x09, 0x28, 0x93, 0x01, 0xec,
- 0xed, 0x0a, 0x28, 0xc4, 0x03, 0x94, 0x0d, 0x0a,
- 0x04, 0x4e, 0x0d, 0x12, 0x1c, 0x0d, 0x26, 0x30,
- 0x0d, 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xd1, 0x28, 0xc4, 0x03,
- 0xaa, 0x0d, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x03, 0x01, 0x04, 0x01, 0x00, 0x2a,
- 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06,
- 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x02, 0x00, 0xd6, 0x03, 0x04,
- 0x00, 0xd1, 0xe9, 0xca, 0xdd, 0x42, 0x8e, 0x01,
- 0x00, 0x00, 0xd1, 0xe9, 0xd1, 0x41, 0xf7, 0x01,
- 0x00, 0x00, 0x24, 0x02, 0x00, 0xc9, 0xb5, 0xcb,
- 0xc7, 0xc6, 0xa3, 0xea, 0x0d, 0xc5, 0xc7, 0x71,
- 0xd1, 0xc7, 0x47, 0x8c, 0x49, 0x93, 0x02, 0xec,
- 0xf0, 0xc5, 0x28, 0xc4, 0x03, 0xad, 0x0d, 0x06,
- 0x04, 0x12, 0x5d, 0x26, 0x2b, 0x17, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x01,
- 0x00, 0x33, 0x04, 0xa4, 0x06, 0x00, 0x00, 0x00,
- 0xd8, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00,
- 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0xd6, 0x03,
- 0x04, 0x00, 0x08, 0xcc, 0xc8, 0xe9, 0xca, 0xdd,
- 0x42, 0x8e, 0x01, 0x00, 0x00, 0xc8, 0xe9, 0xc8,
- 0x41, 0xf7, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
- 0xc9, 0xb5, 0xcb, 0xc7, 0xc6, 0xa3, 0xea, 0x14,
- 0xc5, 0xc7, 0x71, 0xc8, 0xc7, 0x47, 0x42, 0xfc,
- 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49, 0x93,
- 0x02, 0xec, 0xe9, 0xc5, 0x28, 0xc4, 0x03, 0xc2,
- 0x0d, 0x06, 0x0e, 0x12, 0x5d, 0x26, 0x4e, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x07, 0x00,
- 0x05, 0x01, 0x00, 0x6a, 0x07, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xa8,
- 0x06, 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00, 0x03,
- 0x00, 0xfc, 0x07, 0x00, 0x04, 0x00, 0xf2, 0x07,
- 0x00, 0x05, 0x00, 0x10, 0x00, 0x01, 0x00, 0xd6,
- 0x03, 0x04, 0x00, 0x08, 0xc3, 0x06, 0xc2, 0x06,
- 0xc4, 0x05, 0xe9, 0xce, 0xb5, 0xa9, 0xea, 0x0d,
- 0x38, 0xcc, 0x00, 0x00, 0x00, 0x04, 0xbf, 0x01,
- 0x00, 0x00, 0xef, 0x2f, 0xdd, 0x42, 0x8e, 0x01,
- 0x00, 0x00, 0xc6, 0xc2, 0x05, 0x41, 0xf7, 0x01,
- 0x00, 0x00, 0x8c, 0x24, 0x02, 0x00, 0xcd, 0xb5,
- 0x71, 0xb6, 0xc2, 0x05, 0xb5, 0x47, 0x9b, 0x49,
- 0xb6, 0xcb, 0xc7, 0xc6, 0xa3, 0xea, 0x2d, 0xb5,
- 0xc3, 0x04, 0xb6, 0xcc, 0xc8, 0xc7, 0xa4, 0xea,
- 0x14, 0xc2, 0x04, 0xc2, 0x05, 0xc8, 0x47, 0xc5,
- 0xc7, 0xc8, 0x9e, 0x47, 0x9a, 0x9d, 0xc3, 0x04,
- 0x93, 0x03, 0xec, 0xe9, 0xc5, 0xc7, 0x71, 0xc2,
- 0x04, 0x8c, 0xc5, 0xb5, 0x47, 0x9a, 0x49, 0x93,
- 0x02, 0xec, 0xd0, 0xc5, 0x28, 0xc4, 0x03, 0xcb,
- 0x0d, 0x0e, 0x12, 0x0d, 0x17, 0x17, 0x3f, 0x62,
- 0x30, 0x26, 0x12, 0x26, 0x4e, 0x17, 0x3a, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x06, 0x00,
- 0x04, 0x00, 0x00, 0x5a, 0x06, 0xa8, 0x06, 0x00,
- 0x00, 0x00, 0xbc, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x02, 0x00, 0xd0, 0x06, 0x00, 0x03,
- 0x00, 0xf2, 0x07, 0x00, 0x04, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0x08, 0xc3, 0x05, 0xc2, 0x05, 0xc4,
- 0x04, 0xe9, 0xcb, 0xb5, 0xc9, 0xc5, 0xc7, 0xa3,
- 0xea, 0x0d, 0xc2, 0x04, 0xc5, 0x47, 0xb5, 0xa9,
- 0xea, 0x05, 0x93, 0x00, 0xec, 0xf0, 0xc5, 0xb5,
- 0xa9, 0xea, 0x04, 0xc2, 0x04, 0x28, 0xc5, 0xca,
- 0xc6, 0xc7, 0xa3, 0xea, 0x10, 0xc2, 0x04, 0xc6,
- 0xc5, 0x9e, 0x71, 0xc2, 0x04, 0xc6, 0x47, 0x49,
- 0x93, 0x01, 0xec, 0xed, 0xc2, 0x04, 0xc7, 0xc5,
- 0x9e, 0x43, 0x32, 0x00, 0x00, 0x00, 0xc2, 0x04,
- 0x41, 0x47, 0x00, 0x00, 0x00, 0x42, 0xf7, 0x01,
- 0x00, 0x00, 0xc5, 0x9d, 0x43, 0xf7, 0x01, 0x00,
- 0x00, 0xc2, 0x04, 0x28, 0xc4, 0x03, 0xdc, 0x0d,
- 0x0c, 0x12, 0x0d, 0x17, 0x0d, 0x44, 0x17, 0x1c,
- 0x12, 0x26, 0x4e, 0x35, 0x62, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x09, 0x00, 0x06, 0x01, 0x00,
- 0x75, 0x09, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xbc,
- 0x06, 0x00, 0x01, 0x00, 0xe0, 0x07, 0x00, 0x02,
- 0x00, 0xb6, 0x07, 0x00, 0x03, 0x00, 0xee, 0x06,
- 0x00, 0x04, 0x00, 0xba, 0x06, 0x00, 0x05, 0x00,
- 0xee, 0x07, 0x00, 0x06, 0x00, 0xd8, 0x06, 0x00,
- 0x07, 0x00, 0x10, 0x00, 0x01, 0x00, 0x9e, 0x05,
- 0x23, 0x01, 0x08, 0xc3, 0x08, 0xc2, 0x08, 0xc3,
- 0x05, 0xc1, 0xcb, 0xc2, 0x08, 0x41, 0xf7, 0x01,
- 0x00, 0x00, 0xc3, 0x06, 0xc2, 0x08, 0xe9, 0xc3,
- 0x07, 0xb5, 0xca, 0xc6, 0xc2, 0x07, 0xa3, 0xea,
- 0x33, 0xc6, 0xc2, 0x06, 0x9d, 0xc9, 0xc2, 0x05,
- 0xc6, 0x47, 0xc4, 0x04, 0xb5, 0xaa, 0xea, 0x20,
- 0xdd, 0xc2, 0x04, 0xc5, 0xf0, 0xd0, 0xb5, 0x47,
- 0x04, 0x78, 0x01, 0x00, 0x00, 0xaa, 0xea, 0x0d,
- 0xc7, 0xc1, 0xaa, 0xea, 0x08, 0x04, 0x77, 0x01,
- 0x00, 0x00, 0x94, 0x02, 0xc8, 0x94, 0x02, 0x93,
- 0x01, 0xec, 0xc9, 0xc7, 0xc1, 0xaa, 0xea, 0x08,
- 0x04, 0x77, 0x01, 0x00, 0x00, 0x94, 0x02, 0xc7,
- 0x04, 0xff, 0x01, 0x00, 0x00, 0xdd, 0xb6, 0xc2,
- 0x07, 0xc2, 0x06, 0x9d, 0xf0, 0x9d, 0x04, 0xda,
- 0x01, 0x00, 0x00, 0x9d, 0x9d, 0xcf, 0x28, 0xc4,
- 0x03, 0xea, 0x0d, 0x12, 0x12, 0x17, 0x0d, 0x30,
- 0x1c, 0x2b, 0x1c, 0x21, 0x17, 0x21, 0x35, 0x1c,
- 0x27, 0x13, 0x17, 0x1c, 0x26, 0x76, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x01, 0x05, 0x01, 0x03, 0x00,
- 0x00, 0x3c, 0x06, 0xbe, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00,
- 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xba,
- 0x06, 0x00, 0x03, 0x00, 0x10, 0x00, 0x01, 0x00,
- 0x08, 0xc3, 0x04, 0xc2, 0x04, 0xd0, 0xe9, 0xce,
- 0xb5, 0xa9, 0xea, 0x03, 0xb5, 0x28, 0xc8, 0xc6,
- 0x8e, 0xce, 0x47, 0xcb, 0xc6, 0xb5, 0xa5, 0xea,
- 0x0d, 0x92, 0x01, 0xc7, 0xd1, 0x9a, 0xc8, 0xc6,
- 0x47, 0x9d, 0xcb, 0xec, 0xf0, 0xc8, 0x41, 0xf7,
- 0x01, 0x00, 0x00, 0xb5, 0xaa, 0xea, 0x0c, 0xc7,
- 0xd1, 0xc8, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xae,
- 0x9a, 0xcb, 0xc7, 0x28, 0xc4, 0x03, 0x80, 0x0e,
- 0x0c, 0x12, 0x0d, 0x12, 0x17, 0x0d, 0x21, 0x1c,
- 0x0d, 0x2b, 0x0d, 0x35, 0x3a, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
- 0x65, 0x07, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd8,
- 0x06, 0x00, 0x01, 0x00, 0xee, 0x07, 0x00, 0x02,
- 0x00, 0xd0, 0x06, 0x00, 0x03, 0x00, 0xa8, 0x06,
- 0x00, 0x04, 0x00, 0xbc, 0x06, 0x00, 0x05, 0x00,
- 0x10, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x04, 0x00,
- 0x08, 0xc3, 0x06, 0xc2, 0x06, 0xcd, 0xe9, 0xca,
- 0xc5, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xcb, 0xc6,
- 0xb5, 0xa9, 0xea, 0x11, 0xc7, 0xb5, 0xa9, 0xea,
- 0x0c, 0xdd, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xb5,
- 0xb5, 0x25, 0x02, 0x00, 0xdd, 0x42, 0x8e, 0x01,
- 0x00, 0x00, 0xc6, 0xc7, 0xb6, 0x9e, 0x24, 0x02,
- 0x00, 0xcc, 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc6,
- 0xa3, 0xea, 0x22, 0xc7, 0xc2, 0x04, 0x9d, 0xc4,
- 0x05, 0xb5, 0xa9, 0xea, 0x08, 0xc8, 0xc2, 0x04,
- 0xb5, 0x49, 0xec, 0x0d, 0xc8, 0xc2, 0x04, 0x71,
- 0xc2, 0x05, 0xc5, 0xc2, 0x04, 0x47, 0x9a, 0x49,
- 0x93, 0x04, 0xec, 0xda, 0xc8, 0x42, 0x8a, 0x01,
- 0x00, 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03, 0x8e,
- 0x0e, 0x0b, 0x12, 0x3f, 0x35, 0x3b, 0x49, 0x30,
- 0x21, 0x17, 0x27, 0x3f, 0x17, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00,
- 0x5c, 0x07, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd8,
- 0x06, 0x00, 0x01, 0x00, 0xee, 0x07, 0x00, 0x02,
- 0x00, 0xa8, 0x06, 0x00, 0x03, 0x00, 0xbc, 0x06,
- 0x00, 0x04, 0x00, 0xd0, 0x06, 0x00, 0x05, 0x00,
- 0x10, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x04, 0x00,
- 0x08, 0xc3, 0x06, 0xc2, 0x06, 0xcd, 0xe9, 0xca,
- 0xc5, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xcb, 0xdd,
- 0x42, 0x8e, 0x01, 0x00, 0x00, 0xc6, 0xc7, 0xb6,
- 0x9d, 0x24, 0x02, 0x00, 0xc3, 0x05, 0xb5, 0xcc,
- 0xc8, 0xc6, 0xa3, 0xea, 0x2e, 0xc7, 0xc8, 0x9d,
- 0xc4, 0x04, 0xb4, 0xa9, 0xea, 0x14, 0xc5, 0xc8,
- 0x47, 0xb5, 0xaa, 0xea, 0x1a, 0x38, 0xcc, 0x00,
- 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0xef,
- 0x2f, 0xc2, 0x05, 0xc8, 0x71, 0xc5, 0xc8, 0x47,
- 0xc2, 0x04, 0xb6, 0x9d, 0x9b, 0x49, 0x93, 0x03,
- 0xec, 0xcf, 0xc2, 0x05, 0x42, 0x8a, 0x01, 0x00,
- 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03, 0x9e, 0x0e,
- 0x0b, 0x12, 0x3f, 0x4e, 0x26, 0x1c, 0x17, 0x26,
- 0x3a, 0x08, 0x45, 0x17, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x06, 0x00, 0x05, 0x03, 0x00, 0x83,
- 0x01, 0x06, 0xee, 0x06, 0x00, 0x00, 0x00, 0xa8,
- 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02,
- 0x00, 0xd8, 0x06, 0x00, 0x03, 0x00, 0xba, 0x06,
- 0x00, 0x04, 0x00, 0x10, 0x00, 0x01, 0x00, 0xe2,
- 0x01, 0x00, 0x03, 0xd6, 0x03, 0x04, 0x00, 0xe2,
- 0x03, 0x14, 0x00, 0x08, 0xc3, 0x05, 0xc2, 0x05,
- 0xc4, 0x04, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xb5,
- 0xa3, 0xea, 0x0d, 0x38, 0xcc, 0x00, 0x00, 0x00,
- 0x04, 0x01, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xc2,
- 0x04, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xc2, 0x04,
- 0xe9, 0x9d, 0xcc, 0xc2, 0x04, 0x41, 0xf7, 0x01,
- 0x00, 0x00, 0xb5, 0xa5, 0x11, 0xeb, 0x08, 0x0e,
- 0xc2, 0x04, 0xb5, 0x47, 0xb5, 0xa9, 0xea, 0x05,
- 0xb6, 0xc9, 0xec, 0x18, 0xdd, 0x42, 0x03, 0x01,
- 0x00, 0x00, 0xc2, 0x04, 0xb5, 0x47, 0x24, 0x01,
- 0x00, 0xc9, 0xc2, 0x04, 0xc2, 0x04, 0xb5, 0x47,
- 0x9e, 0xc3, 0x04, 0xde, 0x42, 0x8e, 0x01, 0x00,
- 0x00, 0xc8, 0xb5, 0x24, 0x02, 0x00, 0xcb, 0xb5,
- 0xca, 0xc6, 0xc8, 0xa3, 0xea, 0x0e, 0xc7, 0xc6,
- 0x71, 0xc5, 0xdf, 0xc6, 0xef, 0x9b, 0x49, 0x93,
- 0x01, 0xec, 0xef, 0xc7, 0x42, 0x5d, 0x00, 0x00,
- 0x00, 0xc2, 0x04, 0x25, 0x01, 0x00, 0xc4, 0x03,
- 0xac, 0x0e, 0x0e, 0x12, 0x0d, 0x3a, 0x3f, 0x3f,
- 0x6c, 0x0d, 0x0d, 0x49, 0x31, 0x3f, 0x26, 0x30,
- 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x03,
- 0x00, 0x05, 0x03, 0x00, 0x30, 0x03, 0xba, 0x06,
- 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00,
- 0x10, 0x00, 0x01, 0x00, 0xf2, 0x03, 0x15, 0x00,
- 0xf0, 0x03, 0x16, 0x00, 0xe2, 0x01, 0x00, 0x03,
- 0x08, 0xcb, 0xc7, 0xcd, 0x41, 0xf7, 0x01, 0x00,
- 0x00, 0xb5, 0xaa, 0xea, 0x0d, 0x38, 0xcc, 0x00,
- 0x00, 0x00, 0x04, 0x02, 0x02, 0x00, 0x00, 0xef,
- 0x2f, 0xdd, 0xde, 0xc5, 0xef, 0xc5, 0x9b, 0xef,
- 0xce, 0xdf, 0x42, 0x04, 0x01, 0x00, 0x00, 0xc5,
- 0xb5, 0x47, 0x24, 0x01, 0x00, 0x9d, 0xce, 0x28,
- 0xc4, 0x03, 0xbd, 0x0e, 0x06, 0x0d, 0x08, 0x35,
- 0x3f, 0x2c, 0x49, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x02, 0x03, 0x02, 0x04, 0x01, 0x00, 0x3f, 0x05,
- 0xd8, 0x06, 0x00, 0x01, 0x00, 0xee, 0x07, 0x00,
- 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8,
- 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00, 0x02,
- 0x00, 0xd6, 0x03, 0x04, 0x00, 0x26, 0x00, 0x00,
- 0xc9, 0xb5, 0xca, 0xc6, 0xd1, 0xa3, 0xea, 0x09,
- 0xc5, 0xc6, 0xb5, 0x49, 0x93, 0x01, 0xec, 0xf4,
- 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa6, 0x01,
- 0x00, 0x00, 0xdd, 0x41, 0x3e, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0xcf, 0xd2, 0x43, 0xf7, 0x01,
- 0x00, 0x00, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42,
- 0x63, 0x00, 0x00, 0x00, 0xc5, 0xc7, 0x24, 0x02,
- 0x00, 0x0e, 0xc5, 0x28, 0xc4, 0x03, 0xca, 0x0e,
- 0x07, 0x05, 0x17, 0x26, 0x2c, 0x67, 0x21, 0x53,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x02, 0x01,
- 0x04, 0x04, 0x01, 0x5f, 0x03, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0x86, 0x08, 0x00, 0x00, 0x00, 0xd8,
- 0x06, 0x00, 0x01, 0x00, 0xc8, 0x05, 0x38, 0x01,
- 0xd0, 0x03, 0x03, 0x00, 0xd4, 0x03, 0x12, 0x00,
- 0xd6, 0x03, 0x04, 0x00, 0xc0, 0x00, 0xc9, 0xdd,
- 0xd1, 0xef, 0xea, 0x15, 0xde, 0xd1, 0xef, 0xd9,
- 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xce, 0xb5, 0xa3, 0xea, 0x3c, 0xc5, 0xee, 0x2f,
- 0xd1, 0xdf, 0xa7, 0xea, 0x31, 0xd1, 0x41, 0xc0,
- 0x01, 0x00, 0x00, 0x42, 0x8b, 0x01, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xb5, 0xaa, 0xea, 0x04, 0xc5,
- 0xee, 0x2f, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00,
- 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xce, 0xb5, 0xa3, 0xea, 0x04, 0xc5, 0xee, 0x2f,
- 0xc6, 0x8c, 0xca, 0xec, 0x04, 0xc5, 0xee, 0x2f,
- 0xe0, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xb5, 0xc6,
- 0x25, 0x02, 0x00, 0xc4, 0x03, 0xd6, 0x0e, 0x11,
- 0x00, 0x03, 0x0a, 0x1c, 0x17, 0x30, 0x17, 0x0d,
- 0x21, 0x5d, 0x12, 0x4e, 0x17, 0x12, 0x12, 0x0d,
- 0x12, 0x0e, 0x43, 0x06, 0x01, 0x86, 0x08, 0x00,
- 0x00, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x38,
- 0xcf, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00,
- 0x00, 0x23, 0x01, 0x00, 0xc4, 0x03, 0xd7, 0x0e,
- 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xd8, 0x03,
- 0x02, 0x04, 0x02, 0x03, 0x00, 0x00, 0x2e, 0x06,
- 0x8a, 0x08, 0x00, 0x01, 0x00, 0x8c, 0x08, 0x00,
- 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xbc,
- 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02,
- 0x00, 0x8e, 0x08, 0x00, 0x03, 0x00, 0xd2, 0xf4,
- 0xea, 0x03, 0xd1, 0xd6, 0x26, 0x00, 0x00, 0xcb,
- 0xb5, 0xc9, 0xc5, 0xd1, 0xa3, 0xea, 0x1c, 0x26,
- 0x00, 0x00, 0xcc, 0xb5, 0xca, 0xc6, 0xd2, 0xa3,
- 0xea, 0x09, 0xc8, 0xc6, 0xb5, 0x49, 0x93, 0x01,
- 0xec, 0xf4, 0xc7, 0xc5, 0xc8, 0x49, 0x93, 0x00,
- 0xec, 0xe1, 0xc7, 0x28, 0xc4, 0x03, 0xef, 0x0e,
- 0x0a, 0x04, 0x17, 0x0d, 0x17, 0x26, 0x17, 0x26,
- 0x2b, 0x17, 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x18, 0x03,
- 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x03, 0x06, 0x00, 0xdd, 0xd1, 0xd1, 0xf0, 0xc9,
- 0xb5, 0xca, 0xc6, 0xd1, 0xa3, 0xea, 0x0b, 0xc5,
- 0xc6, 0x47, 0xc6, 0xb6, 0x49, 0x93, 0x01, 0xec,
- 0xf2, 0xc5, 0x28, 0xc4, 0x03, 0xfe, 0x0e, 0x04,
- 0x04, 0x1c, 0x26, 0x35, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x03, 0x01, 0x04, 0x01, 0x00, 0x1e,
- 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
- 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
- 0xd8, 0x06, 0x00, 0x02, 0x00, 0xd8, 0x03, 0x06,
- 0x00, 0xd1, 0xe9, 0xcb, 0xdd, 0xc7, 0xc7, 0xf0,
- 0xc9, 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x0e,
- 0xc5, 0xc6, 0x47, 0xc6, 0x71, 0xd1, 0xc6, 0x47,
- 0x49, 0x93, 0x01, 0xec, 0xef, 0xc5, 0x28, 0xc4,
- 0x03, 0x85, 0x0f, 0x05, 0x04, 0x12, 0x1c, 0x26,
- 0x44, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x03,
- 0x01, 0x05, 0x01, 0x00, 0x29, 0x04, 0xd8, 0x06,
- 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00,
- 0xbc, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
- 0x02, 0x00, 0xd8, 0x03, 0x06, 0x00, 0xdd, 0xd1,
- 0xef, 0xcb, 0xb5, 0xc9, 0xc5, 0xd1, 0xa3, 0xea,
- 0x1d, 0xb5, 0xca, 0xc6, 0xd1, 0xa3, 0xea, 0x12,
- 0xc7, 0xc5, 0x47, 0xc6, 0x71, 0xb6, 0xb6, 0xc5,
- 0x9d, 0xc6, 0x9d, 0x9b, 0x49, 0x93, 0x01, 0xec,
- 0xeb, 0x93, 0x00, 0xec, 0xe0, 0xc7, 0x28, 0xc4,
- 0x03, 0x8d, 0x0f, 0x07, 0x04, 0x17, 0x26, 0x26,
- 0x44, 0x17, 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x01, 0x05, 0x01, 0x04, 0x01, 0x00, 0x7f, 0x06,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0x8a, 0x08, 0x00,
- 0x00, 0x00, 0x8c, 0x08, 0x00, 0x01, 0x00, 0xd0,
- 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03,
- 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00, 0xd8, 0x03,
- 0x06, 0x00, 0x38, 0x96, 0x00, 0x00, 0x00, 0x42,
- 0xa2, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
- 0x96, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0x08, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xd1,
- 0xe9, 0xc9, 0x38, 0x96, 0x00, 0x00, 0x00, 0x42,
- 0xa2, 0x01, 0x00, 0x00, 0xd1, 0xb5, 0x47, 0x24,
- 0x01, 0x00, 0x96, 0xea, 0x1c, 0xb6, 0xca, 0xdd,
+ 0x05, 0xda, 0x05, 0x02, 0x00, 0x02, 0x04, 0x01,
+ 0x00, 0x22, 0xca, 0x03, 0x86, 0x0d, 0x03, 0x02,
+ 0xfc, 0x07, 0x00, 0x01, 0x00, 0xfe, 0x07, 0x00,
+ 0x01, 0x00, 0xd8, 0x05, 0x3b, 0x01, 0xd2, 0x38,
+ 0xee, 0x00, 0x00, 0x00, 0xa7, 0x96, 0xea, 0x0b,
+ 0x38, 0xee, 0x00, 0x00, 0x00, 0xd2, 0xd1, 0xe9,
+ 0xf0, 0xd6, 0xdd, 0xd1, 0xd2, 0x42, 0x01, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0x03, 0x35, 0x35, 0x0e, 0x43, 0x06, 0x05, 0xdc,
+ 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x3b,
+ 0xca, 0x03, 0x8b, 0x0d, 0x05, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xe6, 0x04, 0x02, 0x01, 0x38, 0xe6, 0x00, 0x00,
+ 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00, 0xd2, 0x24,
+ 0x01, 0x00, 0xea, 0x07, 0xdd, 0xd1, 0xd2, 0x23,
+ 0x02, 0x00, 0xd1, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0xa7, 0x96, 0xea, 0x0b, 0x38, 0xee, 0x00, 0x00,
+ 0x00, 0xd1, 0xd2, 0xe9, 0xf0, 0xd5, 0x38, 0x06,
+ 0x01, 0x00, 0x00, 0x38, 0x07, 0x01, 0x00, 0x00,
+ 0xd1, 0xef, 0xd2, 0x9a, 0x23, 0x01, 0x00, 0x03,
+ 0x53, 0x22, 0x35, 0x35, 0x0e, 0x43, 0x06, 0x05,
+ 0xde, 0x05, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00,
+ 0x33, 0xca, 0x03, 0x94, 0x0d, 0x0a, 0x04, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0xe2, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06,
+ 0x00, 0x01, 0x00, 0xd1, 0x41, 0xfc, 0x01, 0x00,
+ 0x00, 0xd2, 0x41, 0xfc, 0x01, 0x00, 0x00, 0xaa,
+ 0xea, 0x03, 0x09, 0x28, 0xd1, 0xe9, 0xcd, 0xd2,
+ 0xe9, 0xaa, 0xea, 0x03, 0x09, 0x28, 0xb5, 0xca,
+ 0xc6, 0xc5, 0xa3, 0xea, 0x10, 0xd1, 0xc6, 0x47,
+ 0xd2, 0xc6, 0x47, 0xaa, 0xea, 0x03, 0x09, 0x28,
+ 0x93, 0x01, 0xec, 0xed, 0x0a, 0x28, 0x04, 0x4e,
+ 0x0d, 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d, 0x17,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x02, 0xca, 0x03, 0xaa, 0x0d,
+ 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1,
+ 0x28, 0x03, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x03, 0x01, 0x04, 0x00, 0x00, 0x2e, 0xca, 0x03,
+ 0xad, 0x0d, 0x06, 0x04, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xae, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x06,
+ 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00, 0x02, 0x00,
+ 0xd1, 0xe9, 0xca, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0x42, 0x93, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xd1,
+ 0x41, 0xfc, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
+ 0xc9, 0xb5, 0xcb, 0xc7, 0xc6, 0xa3, 0xea, 0x0d,
+ 0xc5, 0xc7, 0x71, 0xd1, 0xc7, 0x47, 0x8c, 0x49,
+ 0x93, 0x02, 0xec, 0xf0, 0xc5, 0x28, 0x04, 0x12,
+ 0x71, 0x26, 0x2b, 0x17, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x37,
+ 0xca, 0x03, 0xc2, 0x0d, 0x06, 0x04, 0xae, 0x06,
+ 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00, 0x01, 0x00,
+ 0xb2, 0x06, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcc, 0xc8, 0xe9, 0xca, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0x42, 0x93, 0x01, 0x00, 0x00,
+ 0xc8, 0xe9, 0xc8, 0x41, 0xfc, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0xc9, 0xb5, 0xcb, 0xc7, 0xc6,
+ 0xa3, 0xea, 0x14, 0xc5, 0xc7, 0x71, 0xc8, 0xc7,
+ 0x47, 0x42, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x49, 0x93, 0x02, 0xec, 0xe9, 0xc5, 0x28,
+ 0x0e, 0x12, 0x71, 0x26, 0x4e, 0x17, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x07, 0x00, 0x05, 0x00,
+ 0x00, 0x6e, 0xca, 0x03, 0xcb, 0x0d, 0x0e, 0x07,
+ 0xda, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x06, 0x00,
+ 0x01, 0x00, 0xb2, 0x06, 0x00, 0x02, 0x00, 0xc6,
+ 0x06, 0x00, 0x03, 0x00, 0x86, 0x08, 0x00, 0x04,
+ 0x00, 0xfc, 0x07, 0x00, 0x05, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xc3, 0x06, 0xc2, 0x06, 0xc4,
+ 0x05, 0xe9, 0xce, 0xb5, 0xa9, 0xea, 0x0d, 0x38,
+ 0xcf, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x01, 0x00,
+ 0x00, 0xef, 0x2f, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0x42, 0x93, 0x01, 0x00, 0x00, 0xc6, 0xc2, 0x05,
+ 0x41, 0xfc, 0x01, 0x00, 0x00, 0x8c, 0x24, 0x02,
+ 0x00, 0xcd, 0xb5, 0x71, 0xb6, 0xc2, 0x05, 0xb5,
+ 0x47, 0x9b, 0x49, 0xb6, 0xcb, 0xc7, 0xc6, 0xa3,
+ 0xea, 0x2d, 0xb5, 0xc3, 0x04, 0xb6, 0xcc, 0xc8,
+ 0xc7, 0xa4, 0xea, 0x14, 0xc2, 0x04, 0xc2, 0x05,
+ 0xc8, 0x47, 0xc5, 0xc7, 0xc8, 0x9e, 0x47, 0x9a,
+ 0x9d, 0xc3, 0x04, 0x93, 0x03, 0xec, 0xe9, 0xc5,
+ 0xc7, 0x71, 0xc2, 0x04, 0x8c, 0xc5, 0xb5, 0x47,
+ 0x9a, 0x49, 0x93, 0x02, 0xec, 0xd0, 0xc5, 0x28,
+ 0x12, 0x0d, 0x17, 0x17, 0x3f, 0x76, 0x30, 0x26,
+ 0x12, 0x26, 0x4e, 0x17, 0x3a, 0x17, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00,
+ 0x00, 0x5a, 0xca, 0x03, 0xdc, 0x0d, 0x0c, 0x06,
+ 0xb2, 0x06, 0x00, 0x00, 0x00, 0xc6, 0x06, 0x00,
+ 0x01, 0x00, 0xe2, 0x06, 0x00, 0x02, 0x00, 0xda,
+ 0x06, 0x00, 0x03, 0x00, 0xfc, 0x07, 0x00, 0x04,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc3, 0x05,
+ 0xc2, 0x05, 0xc4, 0x04, 0xe9, 0xcb, 0xb5, 0xc9,
+ 0xc5, 0xc7, 0xa3, 0xea, 0x0d, 0xc2, 0x04, 0xc5,
+ 0x47, 0xb5, 0xa9, 0xea, 0x05, 0x93, 0x00, 0xec,
+ 0xf0, 0xc5, 0xb5, 0xa9, 0xea, 0x04, 0xc2, 0x04,
+ 0x28, 0xc5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x10,
+ 0xc2, 0x04, 0xc6, 0xc5, 0x9e, 0x71, 0xc2, 0x04,
+ 0xc6, 0x47, 0x49, 0x93, 0x01, 0xec, 0xed, 0xc2,
+ 0x04, 0xc7, 0xc5, 0x9e, 0x43, 0x32, 0x00, 0x00,
+ 0x00, 0xc2, 0x04, 0x41, 0x47, 0x00, 0x00, 0x00,
+ 0x42, 0xfc, 0x01, 0x00, 0x00, 0xc5, 0x9d, 0x43,
+ 0xfc, 0x01, 0x00, 0x00, 0xc2, 0x04, 0x28, 0x12,
+ 0x0d, 0x17, 0x0d, 0x44, 0x17, 0x1c, 0x12, 0x26,
+ 0x4e, 0x35, 0x62, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x09, 0x00, 0x06, 0x01, 0x00, 0x75, 0xca,
+ 0x03, 0xea, 0x0d, 0x12, 0x09, 0xb2, 0x06, 0x00,
+ 0x00, 0x00, 0xc6, 0x06, 0x00, 0x01, 0x00, 0xea,
+ 0x07, 0x00, 0x02, 0x00, 0xc0, 0x07, 0x00, 0x03,
+ 0x00, 0xf8, 0x06, 0x00, 0x04, 0x00, 0xc4, 0x06,
+ 0x00, 0x05, 0x00, 0xf8, 0x07, 0x00, 0x06, 0x00,
+ 0xe2, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0xa8, 0x05, 0x23, 0x01, 0x08, 0xc3, 0x08,
+ 0xc2, 0x08, 0xc3, 0x05, 0xc1, 0xcb, 0xc2, 0x08,
+ 0x41, 0xfc, 0x01, 0x00, 0x00, 0xc3, 0x06, 0xc2,
+ 0x08, 0xe9, 0xc3, 0x07, 0xb5, 0xca, 0xc6, 0xc2,
+ 0x07, 0xa3, 0xea, 0x33, 0xc6, 0xc2, 0x06, 0x9d,
+ 0xc9, 0xc2, 0x05, 0xc6, 0x47, 0xc4, 0x04, 0xb5,
+ 0xaa, 0xea, 0x20, 0xdd, 0xc2, 0x04, 0xc5, 0xf0,
+ 0xd0, 0xb5, 0x47, 0x04, 0x7d, 0x01, 0x00, 0x00,
+ 0xaa, 0xea, 0x0d, 0xc7, 0xc1, 0xaa, 0xea, 0x08,
+ 0x04, 0x7c, 0x01, 0x00, 0x00, 0x94, 0x02, 0xc8,
+ 0x94, 0x02, 0x93, 0x01, 0xec, 0xc9, 0xc7, 0xc1,
+ 0xaa, 0xea, 0x08, 0x04, 0x7c, 0x01, 0x00, 0x00,
+ 0x94, 0x02, 0xc7, 0x04, 0x04, 0x02, 0x00, 0x00,
+ 0xdd, 0xb6, 0xc2, 0x07, 0xc2, 0x06, 0x9d, 0xf0,
+ 0x9d, 0x04, 0xdf, 0x01, 0x00, 0x00, 0x9d, 0x9d,
+ 0xcf, 0x28, 0x12, 0x17, 0x0d, 0x30, 0x1c, 0x2b,
+ 0x1c, 0x21, 0x17, 0x21, 0x35, 0x1c, 0x27, 0x13,
+ 0x17, 0x1c, 0x26, 0x76, 0x0e, 0x42, 0x27, 0x05,
+ 0x00, 0x01, 0x05, 0x01, 0x03, 0x00, 0x00, 0x3c,
+ 0xca, 0x03, 0x80, 0x0e, 0x0c, 0x06, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x00,
+ 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x02, 0x00, 0xc4, 0x06, 0x00, 0x03, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc3, 0x04, 0xc2, 0x04,
+ 0xd0, 0xe9, 0xce, 0xb5, 0xa9, 0xea, 0x03, 0xb5,
+ 0x28, 0xc8, 0xc6, 0x8e, 0xce, 0x47, 0xcb, 0xc6,
+ 0xb5, 0xa5, 0xea, 0x0d, 0x92, 0x01, 0xc7, 0xd1,
+ 0x9a, 0xc8, 0xc6, 0x47, 0x9d, 0xcb, 0xec, 0xf0,
+ 0xc8, 0x41, 0xfc, 0x01, 0x00, 0x00, 0xb5, 0xaa,
+ 0xea, 0x0c, 0xc7, 0xd1, 0xc8, 0x41, 0xfc, 0x01,
+ 0x00, 0x00, 0x9f, 0x9a, 0xcb, 0xc7, 0x28, 0x12,
+ 0x0d, 0x12, 0x17, 0x0d, 0x21, 0x1c, 0x0d, 0x2b,
+ 0x0d, 0x35, 0x3a, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x6d, 0xca,
+ 0x03, 0x8e, 0x0e, 0x0b, 0x07, 0xc4, 0x06, 0x00,
+ 0x00, 0x00, 0xe2, 0x06, 0x00, 0x01, 0x00, 0xf8,
+ 0x07, 0x00, 0x02, 0x00, 0xda, 0x06, 0x00, 0x03,
+ 0x00, 0xb2, 0x06, 0x00, 0x04, 0x00, 0xc6, 0x06,
+ 0x00, 0x05, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc3, 0x06, 0xc2, 0x06, 0xcd, 0xe9, 0xca, 0xc5,
+ 0x41, 0xfc, 0x01, 0x00, 0x00, 0xcb, 0xc6, 0xb5,
+ 0xa9, 0xea, 0x15, 0xc7, 0xb5, 0xa9, 0xea, 0x10,
+ 0x38, 0xee, 0x00, 0x00, 0x00, 0x42, 0x93, 0x01,
+ 0x00, 0x00, 0xb5, 0xb5, 0x25, 0x02, 0x00, 0x38,
+ 0xee, 0x00, 0x00, 0x00, 0x42, 0x93, 0x01, 0x00,
+ 0x00, 0xc6, 0xc7, 0xb6, 0x9e, 0x24, 0x02, 0x00,
+ 0xcc, 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc6, 0xa3,
+ 0xea, 0x22, 0xc7, 0xc2, 0x04, 0x9d, 0xc4, 0x05,
+ 0xb5, 0xa9, 0xea, 0x08, 0xc8, 0xc2, 0x04, 0xb5,
+ 0x49, 0xec, 0x0d, 0xc8, 0xc2, 0x04, 0x71, 0xc2,
+ 0x05, 0xc5, 0xc2, 0x04, 0x47, 0x9a, 0x49, 0x93,
+ 0x04, 0xec, 0xda, 0xc8, 0x42, 0x8f, 0x01, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0x12, 0x3f, 0x35, 0x4f,
+ 0x5d, 0x30, 0x21, 0x17, 0x27, 0x3f, 0x17, 0x0e,
+ 0x42, 0x27, 0x05, 0x00, 0x00, 0x07, 0x00, 0x05,
+ 0x00, 0x00, 0x60, 0xca, 0x03, 0x9e, 0x0e, 0x0b,
+ 0x07, 0xc4, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x06,
+ 0x00, 0x01, 0x00, 0xf8, 0x07, 0x00, 0x02, 0x00,
+ 0xb2, 0x06, 0x00, 0x03, 0x00, 0xc6, 0x06, 0x00,
+ 0x04, 0x00, 0xda, 0x06, 0x00, 0x05, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc3, 0x06, 0xc2, 0x06,
+ 0xcd, 0xe9, 0xca, 0xc5, 0x41, 0xfc, 0x01, 0x00,
+ 0x00, 0xcb, 0x38, 0xee, 0x00, 0x00, 0x00, 0x42,
+ 0x93, 0x01, 0x00, 0x00, 0xc6, 0xc7, 0xb6, 0x9d,
+ 0x24, 0x02, 0x00, 0xc3, 0x05, 0xb5, 0xcc, 0xc8,
+ 0xc6, 0xa3, 0xea, 0x2e, 0xc7, 0xc8, 0x9d, 0xc4,
+ 0x04, 0xb4, 0xa9, 0xea, 0x14, 0xc5, 0xc8, 0x47,
+ 0xb5, 0xaa, 0xea, 0x1a, 0x38, 0xcf, 0x00, 0x00,
+ 0x00, 0x04, 0x05, 0x02, 0x00, 0x00, 0xef, 0x2f,
+ 0xc2, 0x05, 0xc8, 0x71, 0xc5, 0xc8, 0x47, 0xc2,
+ 0x04, 0xb6, 0x9d, 0x9b, 0x49, 0x93, 0x03, 0xec,
+ 0xcf, 0xc2, 0x05, 0x42, 0x8f, 0x01, 0x00, 0x00,
+ 0x25, 0x00, 0x00, 0x12, 0x3f, 0x62, 0x26, 0x1c,
+ 0x17, 0x26, 0x3a, 0x08, 0x45, 0x17, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x00, 0x06, 0x00, 0x05, 0x01,
+ 0x00, 0x8b, 0x01, 0xca, 0x03, 0xac, 0x0e, 0x0e,
+ 0x06, 0xf8, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06,
+ 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x02, 0x00,
+ 0xe2, 0x06, 0x00, 0x03, 0x00, 0xc4, 0x06, 0x00,
+ 0x04, 0x00, 0x10, 0x00, 0x01, 0x00, 0xe2, 0x01,
+ 0x00, 0x03, 0x08, 0xc3, 0x05, 0xc2, 0x05, 0xc4,
+ 0x04, 0x41, 0xfc, 0x01, 0x00, 0x00, 0xb5, 0xa3,
+ 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04,
+ 0x06, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xc2, 0x04,
+ 0x41, 0xfc, 0x01, 0x00, 0x00, 0xc2, 0x04, 0xe9,
+ 0x9d, 0xcc, 0xc2, 0x04, 0x41, 0xfc, 0x01, 0x00,
+ 0x00, 0xb5, 0xa5, 0x11, 0xeb, 0x08, 0x0e, 0xc2,
+ 0x04, 0xb5, 0x47, 0xb5, 0xa9, 0xea, 0x05, 0xb6,
+ 0xc9, 0xec, 0x18, 0xdd, 0x42, 0x06, 0x01, 0x00,
+ 0x00, 0xc2, 0x04, 0xb5, 0x47, 0x24, 0x01, 0x00,
+ 0xc9, 0xc2, 0x04, 0xc2, 0x04, 0xb5, 0x47, 0x9e,
+ 0xc3, 0x04, 0x38, 0xee, 0x00, 0x00, 0x00, 0x42,
+ 0x93, 0x01, 0x00, 0x00, 0xc8, 0xb5, 0x24, 0x02,
+ 0x00, 0xcb, 0xb5, 0xca, 0xc6, 0xc8, 0xa3, 0xea,
+ 0x12, 0xc7, 0xc6, 0x71, 0xc5, 0x38, 0xf4, 0x00,
+ 0x00, 0x00, 0xc6, 0xef, 0x9b, 0x49, 0x93, 0x01,
+ 0xec, 0xeb, 0xc7, 0x42, 0x5d, 0x00, 0x00, 0x00,
+ 0xc2, 0x04, 0x25, 0x01, 0x00, 0x12, 0x0d, 0x3a,
+ 0x3f, 0x3f, 0x6c, 0x0d, 0x0d, 0x49, 0x31, 0x53,
+ 0x26, 0x44, 0x17, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x38, 0xca,
+ 0x03, 0xbd, 0x0e, 0x06, 0x03, 0xc4, 0x06, 0x00,
+ 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x03, 0x08,
+ 0xcb, 0xc7, 0xcd, 0x41, 0xfc, 0x01, 0x00, 0x00,
+ 0xb5, 0xaa, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00,
+ 0x00, 0x04, 0x07, 0x02, 0x00, 0x00, 0xef, 0x2f,
+ 0x38, 0xfc, 0x00, 0x00, 0x00, 0x38, 0xfb, 0x00,
+ 0x00, 0x00, 0xc5, 0xef, 0xc5, 0x9b, 0xef, 0xce,
+ 0xdd, 0x42, 0x07, 0x01, 0x00, 0x00, 0xc5, 0xb5,
+ 0x47, 0x24, 0x01, 0x00, 0x9d, 0xce, 0x28, 0x0d,
+ 0x08, 0x35, 0x3f, 0x54, 0x49, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x02, 0x03, 0x02, 0x04, 0x00, 0x00,
+ 0x43, 0xca, 0x03, 0xca, 0x0e, 0x07, 0x05, 0xe2,
+ 0x06, 0x00, 0x01, 0x00, 0xf8, 0x07, 0x00, 0x01,
+ 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06,
+ 0x00, 0x01, 0x00, 0xae, 0x06, 0x00, 0x02, 0x00,
+ 0x26, 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xd1,
+ 0xa3, 0xea, 0x09, 0xc5, 0xc6, 0xb5, 0x49, 0x93,
+ 0x01, 0xec, 0xf4, 0x38, 0x98, 0x00, 0x00, 0x00,
+ 0x42, 0xab, 0x01, 0x00, 0x00, 0x38, 0xee, 0x00,
+ 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xcf, 0xd2, 0x43, 0xfc, 0x01, 0x00,
+ 0x00, 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0x63,
+ 0x00, 0x00, 0x00, 0xc5, 0xc7, 0x24, 0x02, 0x00,
+ 0x0e, 0xc5, 0x28, 0x05, 0x17, 0x26, 0x2c, 0x7b,
+ 0x21, 0x53, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x02, 0x01, 0x04, 0x01, 0x01, 0x6b, 0xca, 0x03,
+ 0xd6, 0x0e, 0x11, 0x03, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0x90, 0x08, 0x00, 0x00, 0x00, 0xe2, 0x06,
+ 0x00, 0x01, 0x00, 0xd2, 0x05, 0x38, 0x01, 0xc0,
+ 0x00, 0xc9, 0xdd, 0xd1, 0xef, 0xea, 0x19, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd9, 0x42,
+ 0x90, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xce,
+ 0xb5, 0xa3, 0xea, 0x40, 0xc5, 0xee, 0x2f, 0xd1,
+ 0x38, 0xed, 0x00, 0x00, 0x00, 0xa7, 0xea, 0x31,
+ 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00, 0x42, 0x90,
+ 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb5, 0xaa,
+ 0xea, 0x04, 0xc5, 0xee, 0x2f, 0xd1, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x42, 0x90, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xce, 0xb5, 0xa3, 0xea, 0x04,
+ 0xc5, 0xee, 0x2f, 0xc6, 0x8c, 0xca, 0xec, 0x04,
+ 0xc5, 0xee, 0x2f, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0x42, 0x93, 0x01, 0x00, 0x00, 0xb5, 0xc6, 0x25,
+ 0x02, 0x00, 0x00, 0x03, 0x0a, 0x1c, 0x2b, 0x30,
+ 0x17, 0x0d, 0x35, 0x5d, 0x12, 0x4e, 0x17, 0x12,
+ 0x12, 0x0d, 0x12, 0x0e, 0x43, 0x06, 0x05, 0x90,
+ 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0d,
+ 0xca, 0x03, 0xd7, 0x0e, 0x01, 0x00, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0x09, 0x02, 0x00, 0x00,
+ 0x23, 0x01, 0x00, 0x03, 0x0e, 0x43, 0x26, 0x05,
+ 0xde, 0x03, 0x02, 0x04, 0x02, 0x03, 0x00, 0x00,
+ 0x2e, 0xca, 0x03, 0xef, 0x0e, 0x0a, 0x06, 0x94,
+ 0x08, 0x00, 0x01, 0x00, 0x96, 0x08, 0x00, 0x01,
+ 0x00, 0xb2, 0x06, 0x00, 0x00, 0x00, 0xc6, 0x06,
+ 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x02, 0x00,
+ 0x98, 0x08, 0x00, 0x03, 0x00, 0xd2, 0xf4, 0xea,
+ 0x03, 0xd1, 0xd6, 0x26, 0x00, 0x00, 0xcb, 0xb5,
+ 0xc9, 0xc5, 0xd1, 0xa3, 0xea, 0x1c, 0x26, 0x00,
+ 0x00, 0xcc, 0xb5, 0xca, 0xc6, 0xd2, 0xa3, 0xea,
+ 0x09, 0xc8, 0xc6, 0xb5, 0x49, 0x93, 0x01, 0xec,
+ 0xf4, 0xc7, 0xc5, 0xc8, 0x49, 0x93, 0x00, 0xec,
+ 0xe1, 0xc7, 0x28, 0x04, 0x17, 0x0d, 0x17, 0x26,
+ 0x17, 0x26, 0x2b, 0x17, 0x17, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00,
+ 0x1c, 0xca, 0x03, 0xfe, 0x0e, 0x04, 0x03, 0xe2,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
+ 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xf0, 0xc9, 0xb5,
+ 0xca, 0xc6, 0xd1, 0xa3, 0xea, 0x0b, 0xc5, 0xc6,
+ 0x47, 0xc6, 0xb6, 0x49, 0x93, 0x01, 0xec, 0xf2,
+ 0xc5, 0x28, 0x04, 0x30, 0x26, 0x35, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x01, 0x03, 0x01, 0x04, 0x00,
+ 0x00, 0x22, 0xca, 0x03, 0x85, 0x0f, 0x05, 0x04,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x00, 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0xe2,
+ 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xcb, 0x38,
+ 0xef, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xf0, 0xc9,
+ 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x0e, 0xc5,
+ 0xc6, 0x47, 0xc6, 0x71, 0xd1, 0xc6, 0x47, 0x49,
+ 0x93, 0x01, 0xec, 0xef, 0xc5, 0x28, 0x04, 0x12,
+ 0x30, 0x26, 0x44, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x01, 0x03, 0x01, 0x05, 0x00, 0x00, 0x2d, 0xca,
+ 0x03, 0x8d, 0x0f, 0x07, 0x04, 0xe2, 0x06, 0x00,
+ 0x01, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x00, 0xc6,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x02,
+ 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xcb, 0xb5, 0xc9, 0xc5, 0xd1, 0xa3, 0xea, 0x1d,
+ 0xb5, 0xca, 0xc6, 0xd1, 0xa3, 0xea, 0x12, 0xc7,
+ 0xc5, 0x47, 0xc6, 0x71, 0xb6, 0xb6, 0xc5, 0x9d,
+ 0xc6, 0x9d, 0x9b, 0x49, 0x93, 0x01, 0xec, 0xeb,
+ 0x93, 0x00, 0xec, 0xe0, 0xc7, 0x28, 0x04, 0x2b,
+ 0x26, 0x26, 0x44, 0x17, 0x17, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x01, 0x05, 0x01, 0x04, 0x00, 0x00,
+ 0x87, 0x01, 0xca, 0x03, 0x97, 0x0f, 0x11, 0x06,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0x94, 0x08, 0x00,
+ 0x00, 0x00, 0x96, 0x08, 0x00, 0x01, 0x00, 0xda,
+ 0x06, 0x00, 0x02, 0x00, 0xb2, 0x06, 0x00, 0x03,
+ 0x00, 0xc6, 0x06, 0x00, 0x04, 0x00, 0x38, 0x99,
+ 0x00, 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x02, 0x00,
+ 0x00, 0xef, 0x2f, 0xd1, 0xe9, 0xc9, 0x38, 0x99,
+ 0x00, 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00,
+ 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00, 0x96, 0xea,
+ 0x20, 0xb6, 0xca, 0x38, 0xef, 0x00, 0x00, 0x00,
  0xc6, 0xc5, 0xf0, 0xcb, 0xb5, 0xcc, 0xc8, 0xc5,
- 0xa3, 0xea, 0x3d, 0xc7, 0xb5, 0x47, 0xc8, 0x71,
+ 0xa3, 0xea, 0x41, 0xc7, 0xb5, 0x47, 0xc8, 0x71,
  0xd1, 0xc8, 0x47, 0x49, 0x93, 0x03, 0xec, 0xef,
- 0xd1, 0xb5, 0x47, 0xe9, 0xca, 0xdd, 0xc6, 0xc5,
- 0xf0, 0xcb, 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea,
- 0x1f, 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc6, 0xa3,
- 0xea, 0x12, 0xc7, 0xc2, 0x04, 0x47, 0xc8, 0x71,
- 0xd1, 0xc8, 0x47, 0xc2, 0x04, 0x47, 0x49, 0x93,
- 0x04, 0xec, 0xea, 0x93, 0x03, 0xec, 0xde, 0xc7,
- 0x28, 0xc4, 0x03, 0x97, 0x0f, 0x11, 0x04, 0x58,
- 0x3f, 0x12, 0x62, 0x0d, 0x1c, 0x26, 0x30, 0x18,
- 0x1c, 0x1c, 0x26, 0x30, 0x44, 0x17, 0x18, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x04,
- 0x00, 0x00, 0x4b, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x38, 0x96,
- 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
- 0xd1, 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38,
- 0xcf, 0x00, 0x00, 0x00, 0x04, 0x09, 0x02, 0x00,
- 0x00, 0xef, 0x2f, 0xd1, 0xe9, 0xc9, 0x38, 0x96,
- 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
- 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00, 0x96, 0x11,
- 0xeb, 0x08, 0x0e, 0xc5, 0xd1, 0xb5, 0x47, 0xe9,
- 0xaa, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
- 0x04, 0x0a, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xc5,
- 0x28, 0xc4, 0x03, 0xad, 0x0f, 0x06, 0x04, 0x58,
- 0x3f, 0x12, 0x94, 0x3f, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x26,
- 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
- 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x02, 0x00, 0xd8, 0x03, 0x06,
- 0x00, 0xdd, 0x42, 0x90, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0xc9, 0xd1, 0xb5, 0x47, 0xb5,
- 0x47, 0xca, 0xb6, 0xcb, 0xc7, 0xc5, 0xa3, 0xea,
- 0x0d, 0xc6, 0xd1, 0xc7, 0x47, 0xc7, 0x47, 0x9d,
- 0xca, 0x93, 0x02, 0xec, 0xf0, 0xc6, 0x28, 0xc4,
- 0x03, 0xb6, 0x0f, 0x06, 0x04, 0x3a, 0x21, 0x26,
- 0x2b, 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x06, 0x01, 0x04, 0x03, 0x00, 0x70, 0x07, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x00,
- 0x00, 0x8e, 0x07, 0x00, 0x01, 0x00, 0xee, 0x06,
- 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03, 0x00,
- 0xbc, 0x06, 0x00, 0x04, 0x00, 0x96, 0x08, 0x00,
- 0x05, 0x00, 0xd8, 0x03, 0x06, 0x00, 0xbc, 0x04,
- 0x17, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xdd, 0x42,
- 0x90, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
- 0xc9, 0x26, 0x00, 0x00, 0xca, 0xb5, 0xcc, 0xc8,
- 0xc5, 0xb6, 0x9d, 0xa3, 0xea, 0x09, 0xc6, 0xc8,
- 0xb5, 0x49, 0x93, 0x03, 0xec, 0xf2, 0xc6, 0xc5,
- 0xb6, 0x49, 0xdd, 0x42, 0x1b, 0x01, 0x00, 0x00,
- 0xc5, 0x24, 0x01, 0x00, 0xcb, 0xb5, 0xcc, 0xc8,
- 0xc5, 0xa3, 0xea, 0x36, 0xc7, 0xd1, 0x9a, 0xcb,
- 0xde, 0xc7, 0xef, 0x8c, 0xc8, 0xb6, 0x9d, 0x9b,
- 0xc3, 0x05, 0xc6, 0xc5, 0xc8, 0x9e, 0xb6, 0x9e,
- 0xc2, 0x05, 0x49, 0xb5, 0xc3, 0x04, 0xc2, 0x04,
- 0xc5, 0xa3, 0xea, 0x12, 0xc7, 0xc2, 0x04, 0x47,
- 0xc2, 0x04, 0x71, 0x13, 0x47, 0xc2, 0x05, 0x9d,
- 0x49, 0x93, 0x04, 0xec, 0xea, 0x93, 0x03, 0xec,
- 0xc7, 0xdf, 0xc6, 0x23, 0x01, 0x00, 0xc4, 0x03,
- 0xbf, 0x0f, 0x0e, 0x04, 0x3a, 0x17, 0x30, 0x2b,
- 0x17, 0x3a, 0x26, 0x17, 0x35, 0x30, 0x30, 0x58,
- 0x17, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x05, 0x02, 0x00, 0x13, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xd0, 0x03, 0x03, 0x00, 0xd8,
- 0x03, 0x06, 0x00, 0xdd, 0x42, 0x2b, 0x01, 0x00,
- 0x00, 0xde, 0x42, 0x1f, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0x25, 0x01, 0x00, 0xc4, 0x03,
- 0xd0, 0x0f, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x08, 0x01, 0x05, 0x01, 0x00, 0xd9,
- 0x01, 0x09, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
- 0x00, 0xbc, 0x06, 0x00, 0x02, 0x00, 0xc0, 0x06,
- 0x00, 0x03, 0x00, 0xde, 0x06, 0x00, 0x04, 0x00,
- 0x98, 0x08, 0x00, 0x05, 0x00, 0xec, 0x06, 0x00,
- 0x06, 0x00, 0xee, 0x06, 0x00, 0x07, 0x00, 0xd8,
- 0x03, 0x06, 0x00, 0xdd, 0x42, 0x90, 0x01, 0x00,
- 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc9, 0xb6, 0xc3,
- 0x04, 0xd1, 0x42, 0x91, 0x01, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xc3, 0x05, 0xb5, 0xca, 0xc6, 0xc5,
- 0xa3, 0x69, 0x9d, 0x00, 0x00, 0x00, 0xc6, 0xcb,
- 0xc7, 0xc5, 0xa3, 0xea, 0x0f, 0xc2, 0x05, 0xc7,
- 0x47, 0xc6, 0x47, 0xb5, 0xaa, 0xeb, 0x05, 0x93,
- 0x02, 0xec, 0xee, 0xc7, 0xc5, 0xa9, 0xea, 0x03,
- 0xb5, 0x28, 0xc7, 0xc6, 0xaa, 0xea, 0x2e, 0xb5,
- 0xcc, 0xc8, 0xc5, 0xa3, 0xea, 0x22, 0xc2, 0x05,
- 0xc7, 0x47, 0xc8, 0x47, 0xc3, 0x06, 0xc2, 0x05,
- 0xc7, 0x47, 0xc8, 0x71, 0xc2, 0x05, 0xc6, 0x47,
- 0xc8, 0x47, 0x49, 0xc2, 0x05, 0xc6, 0x47, 0xc8,
- 0xc2, 0x06, 0x49, 0x93, 0x03, 0xec, 0xdb, 0xc2,
- 0x04, 0x8c, 0xc3, 0x04, 0xc2, 0x05, 0xc6, 0x47,
- 0xc6, 0x47, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xc3, 0x07, 0xc6, 0xb6, 0x9d, 0xcb,
- 0xc7, 0xc5, 0xa3, 0xea, 0x2e, 0xc2, 0x07, 0xc2,
- 0x05, 0xc7, 0x47, 0xc6, 0x47, 0x9a, 0xc3, 0x06,
- 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea, 0x18, 0xc2,
- 0x05, 0xc7, 0x47, 0xc8, 0x71, 0x13, 0x47, 0xc2,
- 0x05, 0xc6, 0x47, 0xc8, 0x47, 0xc2, 0x06, 0x9a,
- 0x9e, 0x49, 0x93, 0x03, 0xec, 0xe5, 0x93, 0x02,
- 0xec, 0xcf, 0x93, 0x01, 0xed, 0x61, 0xff, 0xc2,
- 0x04, 0xc3, 0x07, 0xb5, 0xca, 0xc6, 0xc5, 0xa3,
- 0xea, 0x10, 0xc2, 0x07, 0xc2, 0x05, 0xc6, 0x47,
- 0xc6, 0x47, 0x9a, 0xc3, 0x07, 0x93, 0x01, 0xec,
- 0xed, 0xc2, 0x07, 0x28, 0xc4, 0x03, 0xd3, 0x0f,
- 0x1d, 0x05, 0x3a, 0x12, 0x3a, 0x35, 0x26, 0x2b,
- 0x0d, 0x17, 0x1c, 0x0d, 0x1c, 0x26, 0x2b, 0x44,
- 0x2b, 0x17, 0x1d, 0x53, 0x30, 0x3a, 0x26, 0x62,
- 0x17, 0x17, 0x1c, 0x17, 0x26, 0x4e, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x05, 0x01,
- 0x00, 0x97, 0x02, 0x0b, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x9a, 0x08,
- 0x00, 0x01, 0x00, 0x98, 0x08, 0x00, 0x02, 0x00,
- 0xa8, 0x06, 0x00, 0x03, 0x00, 0xbc, 0x06, 0x00,
- 0x04, 0x00, 0xc0, 0x06, 0x00, 0x05, 0x00, 0xe6,
- 0x07, 0x00, 0x06, 0x00, 0xd0, 0x06, 0x00, 0x07,
- 0x00, 0xee, 0x06, 0x00, 0x08, 0x00, 0xec, 0x06,
- 0x00, 0x09, 0x00, 0xd8, 0x03, 0x06, 0x00, 0xdd,
- 0x42, 0x90, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01,
- 0x00, 0xc9, 0xd1, 0x42, 0x91, 0x01, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xcb, 0xdd, 0x42, 0x1b, 0x01,
- 0x00, 0x00, 0xc5, 0x24, 0x01, 0x00, 0xca, 0xb5,
- 0xcc, 0xc8, 0xc5, 0xa3, 0x69, 0xef, 0x00, 0x00,
- 0x00, 0xc8, 0xc3, 0x04, 0xc2, 0x04, 0xc5, 0xa3,
- 0xea, 0x0f, 0xc7, 0xc2, 0x04, 0x47, 0xc8, 0x47,
- 0xb5, 0xaa, 0xeb, 0x05, 0x93, 0x04, 0xec, 0xed,
- 0xc2, 0x04, 0xc5, 0xa9, 0xea, 0x0d, 0x38, 0xcc,
- 0x00, 0x00, 0x00, 0x04, 0x0e, 0x02, 0x00, 0x00,
- 0xef, 0x2f, 0xc2, 0x04, 0xc8, 0xaa, 0xea, 0x27,
- 0xc7, 0xc2, 0x04, 0x47, 0xc3, 0x09, 0xc7, 0xc2,
- 0x04, 0x71, 0xc7, 0xc8, 0x47, 0x49, 0xc7, 0xc8,
- 0xc2, 0x09, 0x49, 0xc6, 0xc2, 0x04, 0x47, 0xc3,
- 0x09, 0xc6, 0xc2, 0x04, 0x71, 0xc6, 0xc8, 0x47,
- 0x49, 0xc6, 0xc8, 0xc2, 0x09, 0x49, 0xc7, 0xc8,
- 0x47, 0xc8, 0x47, 0x42, 0xfe, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xc3, 0x08, 0xb5, 0xc3, 0x05,
- 0xc2, 0x05, 0xc5, 0xa3, 0xea, 0x1d, 0xc7, 0xc8,
- 0x47, 0xc2, 0x05, 0x71, 0x13, 0x47, 0xc2, 0x08,
- 0x9a, 0x49, 0xc6, 0xc8, 0x47, 0xc2, 0x05, 0x71,
- 0x13, 0x47, 0xc2, 0x08, 0x9a, 0x49, 0x93, 0x05,
- 0xec, 0xdf, 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc5,
- 0xa3, 0xea, 0x55, 0xc2, 0x04, 0xc8, 0xaa, 0xea,
- 0x4b, 0xc7, 0xc2, 0x04, 0x47, 0xc8, 0x47, 0xc3,
- 0x08, 0xc8, 0xc3, 0x05, 0xc2, 0x05, 0xc5, 0xa3,
- 0xea, 0x19, 0xc7, 0xc2, 0x04, 0x47, 0xc2, 0x05,
- 0x71, 0x13, 0x47, 0xc7, 0xc8, 0x47, 0xc2, 0x05,
- 0x47, 0xc2, 0x08, 0x9a, 0x9e, 0x49, 0x93, 0x05,
- 0xec, 0xe3, 0xb5, 0xc3, 0x05, 0xc2, 0x05, 0xc5,
- 0xa3, 0xea, 0x19, 0xc6, 0xc2, 0x04, 0x47, 0xc2,
- 0x05, 0x71, 0x13, 0x47, 0xc6, 0xc8, 0x47, 0xc2,
- 0x05, 0x47, 0xc2, 0x08, 0x9a, 0x9e, 0x49, 0x93,
- 0x05, 0xec, 0xe3, 0x93, 0x04, 0xec, 0xa7, 0x93,
- 0x03, 0xed, 0x0f, 0xff, 0xc6, 0x28, 0xc4, 0x03,
- 0xf5, 0x0f, 0x22, 0x04, 0x3a, 0x35, 0x3a, 0x35,
+ 0xd1, 0xb5, 0x47, 0xe9, 0xca, 0x38, 0xef, 0x00,
+ 0x00, 0x00, 0xc6, 0xc5, 0xf0, 0xcb, 0xb5, 0xcc,
+ 0xc8, 0xc5, 0xa3, 0xea, 0x1f, 0xb5, 0xc3, 0x04,
+ 0xc2, 0x04, 0xc6, 0xa3, 0xea, 0x12, 0xc7, 0xc2,
+ 0x04, 0x47, 0xc8, 0x71, 0xd1, 0xc8, 0x47, 0xc2,
+ 0x04, 0x47, 0x49, 0x93, 0x04, 0xec, 0xea, 0x93,
+ 0x03, 0xec, 0xde, 0xc7, 0x28, 0x04, 0x58, 0x3f,
+ 0x12, 0x62, 0x0d, 0x30, 0x26, 0x30, 0x18, 0x1c,
+ 0x30, 0x26, 0x30, 0x44, 0x17, 0x18, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x01, 0x01, 0x01, 0x04, 0x00,
+ 0x00, 0x4b, 0xca, 0x03, 0xad, 0x0f, 0x06, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00,
+ 0x00, 0x00, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42,
+ 0xa7, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0x96, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00,
+ 0x04, 0x0e, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xd1,
+ 0xe9, 0xc9, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42,
+ 0xa7, 0x01, 0x00, 0x00, 0xd1, 0xb5, 0x47, 0x24,
+ 0x01, 0x00, 0x96, 0x11, 0xeb, 0x08, 0x0e, 0xc5,
+ 0xd1, 0xb5, 0x47, 0xe9, 0xaa, 0xea, 0x0d, 0x38,
+ 0xd2, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x02, 0x00,
+ 0x00, 0xef, 0x2f, 0xc5, 0x28, 0x04, 0x58, 0x3f,
+ 0x12, 0x94, 0x3f, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x01, 0x03, 0x01, 0x03, 0x00, 0x00, 0x2a, 0xca,
+ 0x03, 0xb6, 0x0f, 0x06, 0x04, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xe2, 0x06, 0x00, 0x00, 0x00, 0xda,
+ 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00, 0x02,
+ 0x00, 0x38, 0xef, 0x00, 0x00, 0x00, 0x42, 0x95,
+ 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc9,
+ 0xd1, 0xb5, 0x47, 0xb5, 0x47, 0xca, 0xb6, 0xcb,
+ 0xc7, 0xc5, 0xa3, 0xea, 0x0d, 0xc6, 0xd1, 0xc7,
+ 0x47, 0xc7, 0x47, 0x9d, 0xca, 0x93, 0x02, 0xec,
+ 0xf0, 0xc6, 0x28, 0x04, 0x4e, 0x21, 0x26, 0x2b,
+ 0x17, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x06,
+ 0x01, 0x04, 0x00, 0x00, 0x80, 0x01, 0xca, 0x03,
+ 0xbf, 0x0f, 0x0e, 0x07, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xe2, 0x06, 0x00, 0x00, 0x00, 0x98, 0x07,
+ 0x00, 0x01, 0x00, 0xf8, 0x06, 0x00, 0x02, 0x00,
+ 0xb2, 0x06, 0x00, 0x03, 0x00, 0xc6, 0x06, 0x00,
+ 0x04, 0x00, 0xa0, 0x08, 0x00, 0x05, 0x00, 0x38,
+ 0xef, 0x00, 0x00, 0x00, 0x42, 0x95, 0x01, 0x00,
+ 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc9, 0x26, 0x00,
+ 0x00, 0xca, 0xb5, 0xcc, 0xc8, 0xc5, 0xb6, 0x9d,
+ 0xa3, 0xea, 0x09, 0xc6, 0xc8, 0xb5, 0x49, 0x93,
+ 0x03, 0xec, 0xf2, 0xc6, 0xc5, 0xb6, 0x49, 0x38,
+ 0xef, 0x00, 0x00, 0x00, 0x42, 0x1e, 0x01, 0x00,
+ 0x00, 0xc5, 0x24, 0x01, 0x00, 0xcb, 0xb5, 0xcc,
+ 0xc8, 0xc5, 0xa3, 0xea, 0x3a, 0xc7, 0xd1, 0x9a,
+ 0xcb, 0x38, 0x21, 0x01, 0x00, 0x00, 0xc7, 0xef,
+ 0x8c, 0xc8, 0xb6, 0x9d, 0x9b, 0xc3, 0x05, 0xc6,
+ 0xc5, 0xc8, 0x9e, 0xb6, 0x9e, 0xc2, 0x05, 0x49,
+ 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc5, 0xa3, 0xea,
+ 0x12, 0xc7, 0xc2, 0x04, 0x47, 0xc2, 0x04, 0x71,
+ 0x13, 0x47, 0xc2, 0x05, 0x9d, 0x49, 0x93, 0x04,
+ 0xec, 0xea, 0x93, 0x03, 0xec, 0xc3, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0xc6, 0x23, 0x01, 0x00, 0x04,
+ 0x4e, 0x17, 0x30, 0x2b, 0x17, 0x4e, 0x26, 0x17,
+ 0x49, 0x30, 0x30, 0x58, 0x17, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x00,
+ 0x1b, 0xca, 0x03, 0xd0, 0x0f, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x42, 0x30, 0x01, 0x00, 0x00, 0x38, 0xef,
+ 0x00, 0x00, 0x00, 0x42, 0x22, 0x01, 0x00, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0x25, 0x01, 0x00, 0x03,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x08, 0x01,
+ 0x05, 0x00, 0x00, 0xdd, 0x01, 0xca, 0x03, 0xd3,
+ 0x0f, 0x1d, 0x09, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xe2, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00,
+ 0x01, 0x00, 0xc6, 0x06, 0x00, 0x02, 0x00, 0xca,
+ 0x06, 0x00, 0x03, 0x00, 0xe8, 0x06, 0x00, 0x04,
+ 0x00, 0xa2, 0x08, 0x00, 0x05, 0x00, 0xf6, 0x06,
+ 0x00, 0x06, 0x00, 0xf8, 0x06, 0x00, 0x07, 0x00,
+ 0x38, 0xef, 0x00, 0x00, 0x00, 0x42, 0x95, 0x01,
+ 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xc9, 0xb6,
+ 0xc3, 0x04, 0xd1, 0x42, 0x96, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xc3, 0x05, 0xb5, 0xca, 0xc6,
+ 0xc5, 0xa3, 0x69, 0x9d, 0x00, 0x00, 0x00, 0xc6,
+ 0xcb, 0xc7, 0xc5, 0xa3, 0xea, 0x0f, 0xc2, 0x05,
+ 0xc7, 0x47, 0xc6, 0x47, 0xb5, 0xaa, 0xeb, 0x05,
+ 0x93, 0x02, 0xec, 0xee, 0xc7, 0xc5, 0xa9, 0xea,
+ 0x03, 0xb5, 0x28, 0xc7, 0xc6, 0xaa, 0xea, 0x2e,
+ 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea, 0x22, 0xc2,
+ 0x05, 0xc7, 0x47, 0xc8, 0x47, 0xc3, 0x06, 0xc2,
+ 0x05, 0xc7, 0x47, 0xc8, 0x71, 0xc2, 0x05, 0xc6,
+ 0x47, 0xc8, 0x47, 0x49, 0xc2, 0x05, 0xc6, 0x47,
+ 0xc8, 0xc2, 0x06, 0x49, 0x93, 0x03, 0xec, 0xdb,
+ 0xc2, 0x04, 0x8c, 0xc3, 0x04, 0xc2, 0x05, 0xc6,
+ 0x47, 0xc6, 0x47, 0x42, 0x01, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xc3, 0x07, 0xc6, 0xb6, 0x9d,
+ 0xcb, 0xc7, 0xc5, 0xa3, 0xea, 0x2e, 0xc2, 0x07,
+ 0xc2, 0x05, 0xc7, 0x47, 0xc6, 0x47, 0x9a, 0xc3,
+ 0x06, 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea, 0x18,
+ 0xc2, 0x05, 0xc7, 0x47, 0xc8, 0x71, 0x13, 0x47,
+ 0xc2, 0x05, 0xc6, 0x47, 0xc8, 0x47, 0xc2, 0x06,
+ 0x9a, 0x9e, 0x49, 0x93, 0x03, 0xec, 0xe5, 0x93,
+ 0x02, 0xec, 0xcf, 0x93, 0x01, 0xed, 0x61, 0xff,
+ 0xc2, 0x04, 0xc3, 0x07, 0xb5, 0xca, 0xc6, 0xc5,
+ 0xa3, 0xea, 0x10, 0xc2, 0x07, 0xc2, 0x05, 0xc6,
+ 0x47, 0xc6, 0x47, 0x9a, 0xc3, 0x07, 0x93, 0x01,
+ 0xec, 0xed, 0xc2, 0x07, 0x28, 0x05, 0x4e, 0x12,
+ 0x3a, 0x35, 0x26, 0x2b, 0x0d, 0x17, 0x1c, 0x0d,
+ 0x1c, 0x26, 0x2b, 0x44, 0x2b, 0x17, 0x1d, 0x53,
+ 0x30, 0x3a, 0x26, 0x62, 0x17, 0x17, 0x1c, 0x17,
+ 0x26, 0x4e, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01,
+ 0x0a, 0x01, 0x05, 0x00, 0x00, 0x9f, 0x02, 0xca,
+ 0x03, 0xf5, 0x0f, 0x22, 0x0b, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xe2, 0x06, 0x00, 0x00, 0x00, 0xa4,
+ 0x08, 0x00, 0x01, 0x00, 0xa2, 0x08, 0x00, 0x02,
+ 0x00, 0xb2, 0x06, 0x00, 0x03, 0x00, 0xc6, 0x06,
+ 0x00, 0x04, 0x00, 0xca, 0x06, 0x00, 0x05, 0x00,
+ 0xf0, 0x07, 0x00, 0x06, 0x00, 0xda, 0x06, 0x00,
+ 0x07, 0x00, 0xf8, 0x06, 0x00, 0x08, 0x00, 0xf6,
+ 0x06, 0x00, 0x09, 0x00, 0x38, 0xef, 0x00, 0x00,
+ 0x00, 0x42, 0x95, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0xc9, 0xd1, 0x42, 0x96, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xcb, 0x38, 0xef, 0x00,
+ 0x00, 0x00, 0x42, 0x1e, 0x01, 0x00, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0xca, 0xb5, 0xcc, 0xc8, 0xc5,
+ 0xa3, 0x69, 0xef, 0x00, 0x00, 0x00, 0xc8, 0xc3,
+ 0x04, 0xc2, 0x04, 0xc5, 0xa3, 0xea, 0x0f, 0xc7,
+ 0xc2, 0x04, 0x47, 0xc8, 0x47, 0xb5, 0xaa, 0xeb,
+ 0x05, 0x93, 0x04, 0xec, 0xed, 0xc2, 0x04, 0xc5,
+ 0xa9, 0xea, 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00,
+ 0x04, 0x13, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xc2,
+ 0x04, 0xc8, 0xaa, 0xea, 0x27, 0xc7, 0xc2, 0x04,
+ 0x47, 0xc3, 0x09, 0xc7, 0xc2, 0x04, 0x71, 0xc7,
+ 0xc8, 0x47, 0x49, 0xc7, 0xc8, 0xc2, 0x09, 0x49,
+ 0xc6, 0xc2, 0x04, 0x47, 0xc3, 0x09, 0xc6, 0xc2,
+ 0x04, 0x71, 0xc6, 0xc8, 0x47, 0x49, 0xc6, 0xc8,
+ 0xc2, 0x09, 0x49, 0xc7, 0xc8, 0x47, 0xc8, 0x47,
+ 0x42, 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xc3, 0x08, 0xb5, 0xc3, 0x05, 0xc2, 0x05, 0xc5,
+ 0xa3, 0xea, 0x1d, 0xc7, 0xc8, 0x47, 0xc2, 0x05,
+ 0x71, 0x13, 0x47, 0xc2, 0x08, 0x9a, 0x49, 0xc6,
+ 0xc8, 0x47, 0xc2, 0x05, 0x71, 0x13, 0x47, 0xc2,
+ 0x08, 0x9a, 0x49, 0x93, 0x05, 0xec, 0xdf, 0xb5,
+ 0xc3, 0x04, 0xc2, 0x04, 0xc5, 0xa3, 0xea, 0x55,
+ 0xc2, 0x04, 0xc8, 0xaa, 0xea, 0x4b, 0xc7, 0xc2,
+ 0x04, 0x47, 0xc8, 0x47, 0xc3, 0x08, 0xc8, 0xc3,
+ 0x05, 0xc2, 0x05, 0xc5, 0xa3, 0xea, 0x19, 0xc7,
+ 0xc2, 0x04, 0x47, 0xc2, 0x05, 0x71, 0x13, 0x47,
+ 0xc7, 0xc8, 0x47, 0xc2, 0x05, 0x47, 0xc2, 0x08,
+ 0x9a, 0x9e, 0x49, 0x93, 0x05, 0xec, 0xe3, 0xb5,
+ 0xc3, 0x05, 0xc2, 0x05, 0xc5, 0xa3, 0xea, 0x19,
+ 0xc6, 0xc2, 0x04, 0x47, 0xc2, 0x05, 0x71, 0x13,
+ 0x47, 0xc6, 0xc8, 0x47, 0xc2, 0x05, 0x47, 0xc2,
+ 0x08, 0x9a, 0x9e, 0x49, 0x93, 0x05, 0xec, 0xe3,
+ 0x93, 0x04, 0xec, 0xa7, 0x93, 0x03, 0xed, 0x0f,
+ 0xff, 0xc6, 0x28, 0x04, 0x4e, 0x35, 0x4e, 0x35,
  0x30, 0x2b, 0x0d, 0x17, 0x21, 0x3f, 0x22, 0x21,
  0x2b, 0x1c, 0x21, 0x2b, 0x1e, 0x4e, 0x30, 0x3f,
  0x3f, 0x18, 0x30, 0x21, 0x2b, 0x30, 0x67, 0x17,
- 0x30, 0x67, 0x18, 0x17, 0x1c, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x08, 0x01, 0x05, 0x00, 0x00,
- 0x92, 0x02, 0x09, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0x98, 0x08, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00,
- 0x01, 0x00, 0xbc, 0x06, 0x00, 0x02, 0x00, 0xc0,
- 0x06, 0x00, 0x03, 0x00, 0x8c, 0x08, 0x00, 0x04,
- 0x00, 0x8a, 0x08, 0x00, 0x05, 0x00, 0x9e, 0x08,
- 0x00, 0x06, 0x00, 0xee, 0x06, 0x00, 0x07, 0x00,
- 0x38, 0x96, 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01,
- 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x96, 0x11,
- 0xeb, 0x13, 0x0e, 0x38, 0x96, 0x00, 0x00, 0x00,
- 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd1, 0xb5, 0x47,
- 0x24, 0x01, 0x00, 0x96, 0xea, 0x0d, 0x38, 0xcf,
- 0x00, 0x00, 0x00, 0x04, 0x08, 0x02, 0x00, 0x00,
- 0xef, 0x2f, 0xd1, 0xe9, 0xc3, 0x05, 0xd1, 0xb5,
- 0x47, 0xe9, 0xc3, 0x04, 0xd1, 0x42, 0x91, 0x01,
- 0x00, 0x00, 0x24, 0x00, 0x00, 0xc9, 0xb5, 0xc3,
- 0x06, 0xb5, 0xca, 0xc6, 0xc2, 0x04, 0xa3, 0x69,
- 0xbf, 0x00, 0x00, 0x00, 0xc2, 0x06, 0xcb, 0xc7,
- 0xc2, 0x05, 0xa3, 0xea, 0x0e, 0xc5, 0xc7, 0x47,
- 0xc6, 0x47, 0xb5, 0xaa, 0xeb, 0x05, 0x93, 0x02,
- 0xec, 0xee, 0xc7, 0xc2, 0x05, 0xa9, 0x6a, 0x9b,
- 0x00, 0x00, 0x00, 0xc7, 0xc2, 0x06, 0xaa, 0xea,
- 0x34, 0xb5, 0xcc, 0xc8, 0xc2, 0x04, 0xa3, 0xea,
- 0x2c, 0x36, 0xb6, 0x01, 0x00, 0x00, 0xc5, 0xc7,
- 0x47, 0xc8, 0x47, 0x3b, 0xb6, 0x01, 0x00, 0x00,
- 0xc5, 0xc7, 0x47, 0xc8, 0x71, 0xc5, 0xc2, 0x06,
- 0x47, 0xc8, 0x47, 0x49, 0xc5, 0xc2, 0x06, 0x47,
- 0xc8, 0x71, 0x38, 0xb6, 0x01, 0x00, 0x00, 0x49,
- 0x93, 0x03, 0xec, 0xd0, 0xc5, 0xc2, 0x06, 0x47,
- 0xc6, 0x47, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0xc3, 0x07, 0xb5, 0xcc, 0xc8, 0xc2,
- 0x04, 0xa3, 0xea, 0x11, 0xc5, 0xc2, 0x06, 0x47,
- 0xc8, 0x71, 0x13, 0x47, 0xc2, 0x07, 0x9a, 0x49,
- 0x93, 0x03, 0xec, 0xeb, 0xc2, 0x06, 0xb6, 0x9d,
- 0xcb, 0xc7, 0xc2, 0x05, 0xa3, 0xea, 0x2a, 0xc5,
- 0xc7, 0x47, 0xc6, 0x47, 0xc3, 0x07, 0xc6, 0xcc,
- 0xc8, 0xc2, 0x04, 0xa3, 0xea, 0x17, 0xc5, 0xc7,
- 0x47, 0xc8, 0x71, 0x13, 0x47, 0xc5, 0xc2, 0x06,
- 0x47, 0xc8, 0x47, 0xc2, 0x07, 0x9a, 0x9e, 0x49,
- 0x93, 0x03, 0xec, 0xe5, 0x93, 0x02, 0xec, 0xd2,
- 0x93, 0x06, 0x93, 0x01, 0xed, 0x3e, 0xff, 0xc2,
- 0x06, 0x28, 0xc4, 0x03, 0x9f, 0x10, 0x21, 0x05,
- 0x62, 0x62, 0x3f, 0x17, 0x21, 0x35, 0x12, 0x3a,
- 0x30, 0x26, 0x0d, 0x17, 0x17, 0x1c, 0x22, 0x2b,
- 0x4e, 0x3f, 0x3f, 0x19, 0x53, 0x2b, 0x3f, 0x18,
- 0x3a, 0x26, 0x2b, 0x5d, 0x17, 0x17, 0x0d, 0x1c,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x0c, 0x01,
- 0x05, 0x01, 0x00, 0x8c, 0x03, 0x0d, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0x98, 0x08, 0x00, 0x00, 0x00,
- 0xa8, 0x06, 0x00, 0x01, 0x00, 0xbc, 0x06, 0x00,
- 0x02, 0x00, 0xc0, 0x06, 0x00, 0x03, 0x00, 0x8c,
- 0x08, 0x00, 0x04, 0x00, 0x8a, 0x08, 0x00, 0x05,
- 0x00, 0x9e, 0x08, 0x00, 0x06, 0x00, 0xf4, 0x06,
- 0x00, 0x07, 0x00, 0xd0, 0x06, 0x00, 0x08, 0x00,
- 0xa0, 0x08, 0x00, 0x09, 0x00, 0xa2, 0x08, 0x00,
- 0x0a, 0x00, 0xee, 0x06, 0x00, 0x0b, 0x00, 0xd8,
- 0x03, 0x06, 0x00, 0x38, 0x96, 0x00, 0x00, 0x00,
- 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01,
- 0x00, 0x96, 0x11, 0xeb, 0x13, 0x0e, 0x38, 0x96,
- 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
- 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00, 0x96, 0xea,
- 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0x08,
- 0x02, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xe9, 0xc3,
- 0x05, 0xd1, 0xb5, 0x47, 0xe9, 0xc3, 0x04, 0xd1,
- 0x42, 0x91, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xc9, 0x26, 0x00, 0x00, 0xc3, 0x09, 0xb5, 0xc3,
- 0x06, 0xb5, 0xca, 0xc6, 0xc2, 0x04, 0xa3, 0x69,
- 0xcc, 0x00, 0x00, 0x00, 0xc2, 0x09, 0xc6, 0x09,
- 0x49, 0xc2, 0x06, 0xcb, 0xc7, 0xc2, 0x05, 0xa3,
+ 0x30, 0x67, 0x18, 0x17, 0x1c, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x01, 0x08, 0x01, 0x05, 0x00, 0x00,
+ 0x92, 0x02, 0xca, 0x03, 0x9f, 0x10, 0x21, 0x09,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xa2, 0x08, 0x00,
+ 0x00, 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0xc6,
+ 0x06, 0x00, 0x02, 0x00, 0xca, 0x06, 0x00, 0x03,
+ 0x00, 0x96, 0x08, 0x00, 0x04, 0x00, 0x94, 0x08,
+ 0x00, 0x05, 0x00, 0xa8, 0x08, 0x00, 0x06, 0x00,
+ 0xf8, 0x06, 0x00, 0x07, 0x00, 0x38, 0x99, 0x00,
+ 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0x96, 0x11, 0xeb, 0x13, 0x0e,
+ 0x38, 0x99, 0x00, 0x00, 0x00, 0x42, 0xa7, 0x01,
+ 0x00, 0x00, 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00,
+ 0x96, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00,
+ 0x04, 0x0d, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xd1,
+ 0xe9, 0xc3, 0x05, 0xd1, 0xb5, 0x47, 0xe9, 0xc3,
+ 0x04, 0xd1, 0x42, 0x96, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xc9, 0xb5, 0xc3, 0x06, 0xb5, 0xca,
+ 0xc6, 0xc2, 0x04, 0xa3, 0x69, 0xbf, 0x00, 0x00,
+ 0x00, 0xc2, 0x06, 0xcb, 0xc7, 0xc2, 0x05, 0xa3,
  0xea, 0x0e, 0xc5, 0xc7, 0x47, 0xc6, 0x47, 0xb5,
  0xaa, 0xeb, 0x05, 0x93, 0x02, 0xec, 0xee, 0xc7,
- 0xc2, 0x05, 0xa9, 0x6a, 0xa3, 0x00, 0x00, 0x00,
- 0xc2, 0x09, 0xc6, 0x0a, 0x49, 0xc7, 0xc2, 0x06,
- 0xaa, 0xea, 0x34, 0xb5, 0xcc, 0xc8, 0xc2, 0x04,
- 0xa3, 0xea, 0x2c, 0x36, 0xb6, 0x01, 0x00, 0x00,
- 0xc5, 0xc7, 0x47, 0xc8, 0x47, 0x3b, 0xb6, 0x01,
- 0x00, 0x00, 0xc5, 0xc7, 0x47, 0xc8, 0x71, 0xc5,
- 0xc2, 0x06, 0x47, 0xc8, 0x47, 0x49, 0xc5, 0xc2,
- 0x06, 0x47, 0xc8, 0x71, 0x38, 0xb6, 0x01, 0x00,
- 0x00, 0x49, 0x93, 0x03, 0xec, 0xd0, 0xc5, 0xc2,
- 0x06, 0x47, 0xc6, 0x47, 0x42, 0xfe, 0x00, 0x00,
- 0x00, 0x24, 0x00, 0x00, 0xc3, 0x0b, 0xb5, 0xcc,
- 0xc8, 0xc2, 0x04, 0xa3, 0xea, 0x11, 0xc5, 0xc2,
- 0x06, 0x47, 0xc8, 0x71, 0x13, 0x47, 0xc2, 0x0b,
- 0x9a, 0x49, 0x93, 0x03, 0xec, 0xeb, 0xb5, 0xcb,
- 0xc7, 0xc2, 0x05, 0xa3, 0xea, 0x30, 0xc7, 0xc2,
- 0x06, 0xaa, 0xea, 0x26, 0xc5, 0xc7, 0x47, 0xc6,
- 0x47, 0xc3, 0x0b, 0xc6, 0xcc, 0xc8, 0xc2, 0x04,
+ 0xc2, 0x05, 0xa9, 0x6a, 0x9b, 0x00, 0x00, 0x00,
+ 0xc7, 0xc2, 0x06, 0xaa, 0xea, 0x34, 0xb5, 0xcc,
+ 0xc8, 0xc2, 0x04, 0xa3, 0xea, 0x2c, 0x36, 0xbb,
+ 0x01, 0x00, 0x00, 0xc5, 0xc7, 0x47, 0xc8, 0x47,
+ 0x3b, 0xbb, 0x01, 0x00, 0x00, 0xc5, 0xc7, 0x47,
+ 0xc8, 0x71, 0xc5, 0xc2, 0x06, 0x47, 0xc8, 0x47,
+ 0x49, 0xc5, 0xc2, 0x06, 0x47, 0xc8, 0x71, 0x38,
+ 0xbb, 0x01, 0x00, 0x00, 0x49, 0x93, 0x03, 0xec,
+ 0xd0, 0xc5, 0xc2, 0x06, 0x47, 0xc6, 0x47, 0x42,
+ 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc3,
+ 0x07, 0xb5, 0xcc, 0xc8, 0xc2, 0x04, 0xa3, 0xea,
+ 0x11, 0xc5, 0xc2, 0x06, 0x47, 0xc8, 0x71, 0x13,
+ 0x47, 0xc2, 0x07, 0x9a, 0x49, 0x93, 0x03, 0xec,
+ 0xeb, 0xc2, 0x06, 0xb6, 0x9d, 0xcb, 0xc7, 0xc2,
+ 0x05, 0xa3, 0xea, 0x2a, 0xc5, 0xc7, 0x47, 0xc6,
+ 0x47, 0xc3, 0x07, 0xc6, 0xcc, 0xc8, 0xc2, 0x04,
  0xa3, 0xea, 0x17, 0xc5, 0xc7, 0x47, 0xc8, 0x71,
  0x13, 0x47, 0xc5, 0xc2, 0x06, 0x47, 0xc8, 0x47,
- 0xc2, 0x0b, 0x9a, 0x9e, 0x49, 0x93, 0x03, 0xec,
- 0xe5, 0x93, 0x02, 0xec, 0xcc, 0x93, 0x06, 0x93,
- 0x01, 0xed, 0x31, 0xff, 0xc2, 0x04, 0xc2, 0x06,
- 0x9e, 0xc3, 0x0a, 0xdd, 0xc2, 0x04, 0xc2, 0x0a,
- 0xf0, 0xc3, 0x08, 0xb5, 0xcc, 0xb5, 0xca, 0xc6,
- 0xc2, 0x04, 0xa3, 0xea, 0x50, 0xc2, 0x09, 0xc6,
- 0x47, 0x96, 0xea, 0x45, 0xb5, 0xc3, 0x06, 0xb5,
- 0xc3, 0x07, 0xb5, 0xcb, 0xc7, 0xc2, 0x04, 0xa3,
- 0xea, 0x35, 0xc2, 0x09, 0xc7, 0x47, 0xea, 0x13,
- 0xc2, 0x08, 0xc7, 0x47, 0xc8, 0x71, 0xc5, 0xc2,
- 0x07, 0x47, 0xc6, 0x47, 0x8c, 0x49, 0x93, 0x07,
- 0xec, 0x19, 0xc2, 0x06, 0xc8, 0xa9, 0xea, 0x0a,
- 0xc2, 0x08, 0xc7, 0x47, 0xc8, 0xb6, 0x49, 0xec,
- 0x08, 0xc2, 0x08, 0xc7, 0x47, 0xc8, 0xb5, 0x49,
- 0x93, 0x06, 0x93, 0x02, 0xec, 0xc7, 0x93, 0x03,
- 0x93, 0x01, 0xec, 0xac, 0xc2, 0x08, 0x28, 0xc4,
- 0x03, 0xc8, 0x10, 0x3b, 0x05, 0x62, 0x62, 0x3f,
+ 0xc2, 0x07, 0x9a, 0x9e, 0x49, 0x93, 0x03, 0xec,
+ 0xe5, 0x93, 0x02, 0xec, 0xd2, 0x93, 0x06, 0x93,
+ 0x01, 0xed, 0x3e, 0xff, 0xc2, 0x06, 0x28, 0x05,
+ 0x62, 0x62, 0x3f, 0x17, 0x21, 0x35, 0x12, 0x3a,
+ 0x30, 0x26, 0x0d, 0x17, 0x17, 0x1c, 0x22, 0x2b,
+ 0x4e, 0x3f, 0x3f, 0x19, 0x53, 0x2b, 0x3f, 0x18,
+ 0x3a, 0x26, 0x2b, 0x5d, 0x17, 0x17, 0x0d, 0x1c,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x01, 0x0c, 0x01,
+ 0x05, 0x00, 0x00, 0x90, 0x03, 0xca, 0x03, 0xc8,
+ 0x10, 0x3b, 0x0d, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xa2, 0x08, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00,
+ 0x01, 0x00, 0xc6, 0x06, 0x00, 0x02, 0x00, 0xca,
+ 0x06, 0x00, 0x03, 0x00, 0x96, 0x08, 0x00, 0x04,
+ 0x00, 0x94, 0x08, 0x00, 0x05, 0x00, 0xa8, 0x08,
+ 0x00, 0x06, 0x00, 0xfe, 0x06, 0x00, 0x07, 0x00,
+ 0xda, 0x06, 0x00, 0x08, 0x00, 0xaa, 0x08, 0x00,
+ 0x09, 0x00, 0xac, 0x08, 0x00, 0x0a, 0x00, 0xf8,
+ 0x06, 0x00, 0x0b, 0x00, 0x38, 0x99, 0x00, 0x00,
+ 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x96, 0x11, 0xeb, 0x13, 0x0e, 0x38,
+ 0x99, 0x00, 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00,
+ 0x00, 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00, 0x96,
+ 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04,
+ 0x0d, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xd1, 0xe9,
+ 0xc3, 0x05, 0xd1, 0xb5, 0x47, 0xe9, 0xc3, 0x04,
+ 0xd1, 0x42, 0x96, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xc9, 0x26, 0x00, 0x00, 0xc3, 0x09, 0xb5,
+ 0xc3, 0x06, 0xb5, 0xca, 0xc6, 0xc2, 0x04, 0xa3,
+ 0x69, 0xcc, 0x00, 0x00, 0x00, 0xc2, 0x09, 0xc6,
+ 0x09, 0x49, 0xc2, 0x06, 0xcb, 0xc7, 0xc2, 0x05,
+ 0xa3, 0xea, 0x0e, 0xc5, 0xc7, 0x47, 0xc6, 0x47,
+ 0xb5, 0xaa, 0xeb, 0x05, 0x93, 0x02, 0xec, 0xee,
+ 0xc7, 0xc2, 0x05, 0xa9, 0x6a, 0xa3, 0x00, 0x00,
+ 0x00, 0xc2, 0x09, 0xc6, 0x0a, 0x49, 0xc7, 0xc2,
+ 0x06, 0xaa, 0xea, 0x34, 0xb5, 0xcc, 0xc8, 0xc2,
+ 0x04, 0xa3, 0xea, 0x2c, 0x36, 0xbb, 0x01, 0x00,
+ 0x00, 0xc5, 0xc7, 0x47, 0xc8, 0x47, 0x3b, 0xbb,
+ 0x01, 0x00, 0x00, 0xc5, 0xc7, 0x47, 0xc8, 0x71,
+ 0xc5, 0xc2, 0x06, 0x47, 0xc8, 0x47, 0x49, 0xc5,
+ 0xc2, 0x06, 0x47, 0xc8, 0x71, 0x38, 0xbb, 0x01,
+ 0x00, 0x00, 0x49, 0x93, 0x03, 0xec, 0xd0, 0xc5,
+ 0xc2, 0x06, 0x47, 0xc6, 0x47, 0x42, 0x01, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xc3, 0x0b, 0xb5,
+ 0xcc, 0xc8, 0xc2, 0x04, 0xa3, 0xea, 0x11, 0xc5,
+ 0xc2, 0x06, 0x47, 0xc8, 0x71, 0x13, 0x47, 0xc2,
+ 0x0b, 0x9a, 0x49, 0x93, 0x03, 0xec, 0xeb, 0xb5,
+ 0xcb, 0xc7, 0xc2, 0x05, 0xa3, 0xea, 0x30, 0xc7,
+ 0xc2, 0x06, 0xaa, 0xea, 0x26, 0xc5, 0xc7, 0x47,
+ 0xc6, 0x47, 0xc3, 0x0b, 0xc6, 0xcc, 0xc8, 0xc2,
+ 0x04, 0xa3, 0xea, 0x17, 0xc5, 0xc7, 0x47, 0xc8,
+ 0x71, 0x13, 0x47, 0xc5, 0xc2, 0x06, 0x47, 0xc8,
+ 0x47, 0xc2, 0x0b, 0x9a, 0x9e, 0x49, 0x93, 0x03,
+ 0xec, 0xe5, 0x93, 0x02, 0xec, 0xcc, 0x93, 0x06,
+ 0x93, 0x01, 0xed, 0x31, 0xff, 0xc2, 0x04, 0xc2,
+ 0x06, 0x9e, 0xc3, 0x0a, 0x38, 0xef, 0x00, 0x00,
+ 0x00, 0xc2, 0x04, 0xc2, 0x0a, 0xf0, 0xc3, 0x08,
+ 0xb5, 0xcc, 0xb5, 0xca, 0xc6, 0xc2, 0x04, 0xa3,
+ 0xea, 0x50, 0xc2, 0x09, 0xc6, 0x47, 0x96, 0xea,
+ 0x45, 0xb5, 0xc3, 0x06, 0xb5, 0xc3, 0x07, 0xb5,
+ 0xcb, 0xc7, 0xc2, 0x04, 0xa3, 0xea, 0x35, 0xc2,
+ 0x09, 0xc7, 0x47, 0xea, 0x13, 0xc2, 0x08, 0xc7,
+ 0x47, 0xc8, 0x71, 0xc5, 0xc2, 0x07, 0x47, 0xc6,
+ 0x47, 0x8c, 0x49, 0x93, 0x07, 0xec, 0x19, 0xc2,
+ 0x06, 0xc8, 0xa9, 0xea, 0x0a, 0xc2, 0x08, 0xc7,
+ 0x47, 0xc8, 0xb6, 0x49, 0xec, 0x08, 0xc2, 0x08,
+ 0xc7, 0x47, 0xc8, 0xb5, 0x49, 0x93, 0x06, 0x93,
+ 0x02, 0xec, 0xc7, 0x93, 0x03, 0x93, 0x01, 0xec,
+ 0xac, 0xc2, 0x08, 0x28, 0x05, 0x62, 0x62, 0x3f,
  0x17, 0x21, 0x35, 0x1c, 0x12, 0x3a, 0x1c, 0x30,
  0x26, 0x0d, 0x17, 0x17, 0x1c, 0x1c, 0x22, 0x2b,
  0x4e, 0x3f, 0x3f, 0x19, 0x53, 0x2b, 0x3f, 0x18,
  0x2b, 0x21, 0x26, 0x2b, 0x5d, 0x18, 0x17, 0x0e,
- 0x00, 0x05, 0x08, 0x26, 0x2b, 0x0d, 0x2b, 0x27,
+ 0x00, 0x05, 0x08, 0x26, 0x3f, 0x0d, 0x2b, 0x27,
  0x12, 0x12, 0x2b, 0x21, 0x49, 0x0d, 0x0d, 0x21,
  0x26, 0x0d, 0x27, 0x0e, 0x17, 0x0e, 0x17, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x03, 0x02, 0x04,
- 0x00, 0x00, 0x2d, 0x05, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
- 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00,
- 0xd0, 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xce,
- 0xd2, 0xe9, 0xaa, 0xea, 0x0d, 0x38, 0xcf, 0x00,
- 0x00, 0x00, 0x04, 0x12, 0x02, 0x00, 0x00, 0xef,
- 0x2f, 0xb5, 0xcb, 0xb5, 0xc9, 0xc5, 0xc6, 0xa3,
- 0xea, 0x0f, 0xc7, 0xd1, 0xc5, 0x47, 0xd2, 0xc5,
- 0x47, 0x9a, 0x9d, 0xcb, 0x93, 0x00, 0xec, 0xee,
- 0xc7, 0x28, 0xc4, 0x03, 0x92, 0x11, 0x08, 0x04,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x03, 0x02, 0x04,
+ 0x00, 0x00, 0x2d, 0xca, 0x03, 0x92, 0x11, 0x08,
+ 0x05, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06,
+ 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x00,
+ 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x02, 0x00, 0xd1, 0xe9, 0xce, 0xd2, 0xe9, 0xaa,
+ 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00, 0x04,
+ 0x17, 0x02, 0x00, 0x00, 0xef, 0x2f, 0xb5, 0xcb,
+ 0xb5, 0xc9, 0xc5, 0xc6, 0xa3, 0xea, 0x0f, 0xc7,
+ 0xd1, 0xc5, 0x47, 0xd2, 0xc5, 0x47, 0x9a, 0x9d,
+ 0xcb, 0x93, 0x00, 0xec, 0xee, 0xc7, 0x28, 0x04,
  0x12, 0x1c, 0x40, 0x0d, 0x26, 0x35, 0x17, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02, 0x06,
- 0x00, 0x00, 0x58, 0x03, 0xf2, 0x07, 0x00, 0x01,
- 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00, 0xd0, 0x06,
- 0x00, 0x00, 0x00, 0xd1, 0xe9, 0xb8, 0xaa, 0x11,
- 0xeb, 0x06, 0x0e, 0xd2, 0xe9, 0xb8, 0xaa, 0xea,
- 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0x13,
- 0x02, 0x00, 0x00, 0xef, 0x2f, 0x26, 0x00, 0x00,
- 0xcd, 0xb5, 0x71, 0xd1, 0xb6, 0x47, 0xd2, 0xb7,
- 0x47, 0x9a, 0xd1, 0xb7, 0x47, 0xd2, 0xb6, 0x47,
- 0x9a, 0x9e, 0x49, 0xc5, 0xb6, 0x71, 0xd1, 0xb7,
- 0x47, 0xd2, 0xb5, 0x47, 0x9a, 0xd1, 0xb5, 0x47,
- 0xd2, 0xb7, 0x47, 0x9a, 0x9e, 0x49, 0xc5, 0xb7,
- 0x71, 0xd1, 0xb5, 0x47, 0xd2, 0xb6, 0x47, 0x9a,
- 0xd1, 0xb6, 0x47, 0xd2, 0xb5, 0x47, 0x9a, 0x9e,
- 0x49, 0xc5, 0x28, 0xc4, 0x03, 0x9f, 0x11, 0x07,
+ 0x42, 0x27, 0x05, 0x00, 0x02, 0x01, 0x02, 0x06,
+ 0x00, 0x00, 0x58, 0xca, 0x03, 0x9f, 0x11, 0x07,
+ 0x03, 0xfc, 0x07, 0x00, 0x01, 0x00, 0xfe, 0x07,
+ 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00,
+ 0xd1, 0xe9, 0xb8, 0xaa, 0x11, 0xeb, 0x06, 0x0e,
+ 0xd2, 0xe9, 0xb8, 0xaa, 0xea, 0x0d, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0x18, 0x02, 0x00, 0x00,
+ 0xef, 0x2f, 0x26, 0x00, 0x00, 0xcd, 0xb5, 0x71,
+ 0xd1, 0xb6, 0x47, 0xd2, 0xb7, 0x47, 0x9a, 0xd1,
+ 0xb7, 0x47, 0xd2, 0xb6, 0x47, 0x9a, 0x9e, 0x49,
+ 0xc5, 0xb6, 0x71, 0xd1, 0xb7, 0x47, 0xd2, 0xb5,
+ 0x47, 0x9a, 0xd1, 0xb5, 0x47, 0xd2, 0xb7, 0x47,
+ 0x9a, 0x9e, 0x49, 0xc5, 0xb7, 0x71, 0xd1, 0xb5,
+ 0x47, 0xd2, 0xb6, 0x47, 0x9a, 0xd1, 0xb6, 0x47,
+ 0xd2, 0xb5, 0x47, 0x9a, 0x9e, 0x49, 0xc5, 0x28,
  0x04, 0x49, 0x3f, 0x17, 0x5d, 0x62, 0x62, 0x0e,
- 0x43, 0x06, 0x01, 0xd6, 0x05, 0x02, 0x03, 0x02,
- 0x05, 0x00, 0x00, 0x30, 0x05, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0,
- 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
- 0x00, 0xd8, 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9,
- 0xcf, 0xd2, 0xe9, 0xaa, 0xea, 0x0d, 0x38, 0xcf,
- 0x00, 0x00, 0x00, 0x04, 0x14, 0x02, 0x00, 0x00,
+ 0x43, 0x06, 0x05, 0xe0, 0x05, 0x02, 0x03, 0x02,
+ 0x05, 0x00, 0x00, 0x30, 0xca, 0x03, 0xab, 0x11,
+ 0x07, 0x05, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
+ 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0xe2, 0x06,
+ 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xcf, 0xd2, 0xe9,
+ 0xaa, 0xea, 0x0d, 0x38, 0xd2, 0x00, 0x00, 0x00,
+ 0x04, 0x19, 0x02, 0x00, 0x00, 0xef, 0x2f, 0x26,
+ 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xc7, 0xa3,
+ 0xea, 0x10, 0xc5, 0xc6, 0x71, 0xd1, 0xc6, 0x47,
+ 0xd2, 0xc6, 0x47, 0x9d, 0x49, 0x93, 0x01, 0xec,
+ 0xed, 0xc5, 0x28, 0x04, 0x12, 0x1c, 0x3f, 0x17,
+ 0x26, 0x4e, 0x0e, 0x43, 0x06, 0x05, 0xe2, 0x05,
+ 0x02, 0x03, 0x02, 0x05, 0x00, 0x00, 0x30, 0xca,
+ 0x03, 0xb5, 0x11, 0x07, 0x05, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xda,
+ 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x01,
+ 0x00, 0xe2, 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9,
+ 0xcf, 0xd2, 0xe9, 0xaa, 0xea, 0x0d, 0x38, 0xd2,
+ 0x00, 0x00, 0x00, 0x04, 0x19, 0x02, 0x00, 0x00,
  0xef, 0x2f, 0x26, 0x00, 0x00, 0xc9, 0xb5, 0xca,
  0xc6, 0xc7, 0xa3, 0xea, 0x10, 0xc5, 0xc6, 0x71,
- 0xd1, 0xc6, 0x47, 0xd2, 0xc6, 0x47, 0x9d, 0x49,
- 0x93, 0x01, 0xec, 0xed, 0xc5, 0x28, 0xc4, 0x03,
- 0xab, 0x11, 0x07, 0x04, 0x12, 0x1c, 0x3f, 0x17,
- 0x26, 0x4e, 0x0e, 0x43, 0x06, 0x01, 0xd8, 0x05,
- 0x02, 0x03, 0x02, 0x05, 0x00, 0x00, 0x30, 0x05,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8,
- 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x02,
- 0x00, 0xd1, 0xe9, 0xcf, 0xd2, 0xe9, 0xaa, 0xea,
- 0x0d, 0x38, 0xcf, 0x00, 0x00, 0x00, 0x04, 0x14,
- 0x02, 0x00, 0x00, 0xef, 0x2f, 0x26, 0x00, 0x00,
- 0xc9, 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x10,
- 0xc5, 0xc6, 0x71, 0xd1, 0xc6, 0x47, 0xd2, 0xc6,
- 0x47, 0x9e, 0x49, 0x93, 0x01, 0xec, 0xed, 0xc5,
- 0x28, 0xc4, 0x03, 0xb5, 0x11, 0x07, 0x04, 0x12,
+ 0xd1, 0xc6, 0x47, 0xd2, 0xc6, 0x47, 0x9e, 0x49,
+ 0x93, 0x01, 0xec, 0xed, 0xc5, 0x28, 0x04, 0x12,
  0x1c, 0x3f, 0x17, 0x26, 0x4e, 0x0e, 0x43, 0x06,
- 0x01, 0xda, 0x05, 0x02, 0x03, 0x02, 0x04, 0x00,
- 0x00, 0x1d, 0x05, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xcb, 0x26,
- 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xc7, 0xa3,
- 0xea, 0x0e, 0xc5, 0xc6, 0x71, 0xd1, 0xc6, 0x47,
- 0xd2, 0x9a, 0x49, 0x93, 0x01, 0xec, 0xef, 0xc5,
- 0x28, 0xc4, 0x03, 0xbf, 0x11, 0x05, 0x04, 0x12,
- 0x17, 0x26, 0x44, 0x0e, 0x43, 0x06, 0x01, 0xdc,
+ 0x05, 0xe4, 0x05, 0x02, 0x03, 0x02, 0x04, 0x00,
+ 0x00, 0x1d, 0xca, 0x03, 0xbf, 0x11, 0x05, 0x05,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00,
+ 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xb2,
+ 0x06, 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x02,
+ 0x00, 0xd1, 0xe9, 0xcb, 0x26, 0x00, 0x00, 0xc9,
+ 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x0e, 0xc5,
+ 0xc6, 0x71, 0xd1, 0xc6, 0x47, 0xd2, 0x9a, 0x49,
+ 0x93, 0x01, 0xec, 0xef, 0xc5, 0x28, 0x04, 0x12,
+ 0x17, 0x26, 0x44, 0x0e, 0x43, 0x06, 0x05, 0xe6,
  0x05, 0x02, 0x0b, 0x02, 0x05, 0x00, 0x00, 0xbf,
- 0x02, 0x0d, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0x8a, 0x08, 0x00, 0x00,
- 0x00, 0x8c, 0x08, 0x00, 0x01, 0x00, 0x9e, 0x08,
- 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03, 0x00,
- 0xbc, 0x06, 0x00, 0x04, 0x00, 0xc0, 0x06, 0x00,
- 0x05, 0x00, 0xd0, 0x06, 0x00, 0x06, 0x00, 0x8e,
- 0x08, 0x00, 0x07, 0x00, 0xfc, 0x07, 0x00, 0x08,
- 0x00, 0xaa, 0x08, 0x00, 0x09, 0x00, 0xac, 0x08,
- 0x00, 0x0a, 0x00, 0xd1, 0xe9, 0xc9, 0x38, 0x96,
- 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
- 0xd1, 0xb5, 0x47, 0x24, 0x01, 0x00, 0xc4, 0x09,
- 0xea, 0x08, 0xd1, 0xb5, 0x47, 0xe9, 0xcb, 0xec,
- 0x03, 0xb6, 0xcb, 0xc7, 0xd2, 0xe9, 0xaa, 0xea,
- 0x0d, 0x38, 0xcc, 0x00, 0x00, 0x00, 0x04, 0x17,
- 0x02, 0x00, 0x00, 0xef, 0x2f, 0x38, 0x96, 0x00,
- 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd2,
- 0xb5, 0x47, 0x24, 0x01, 0x00, 0xc4, 0x0a, 0xea,
- 0x08, 0xd2, 0xb5, 0x47, 0xe9, 0xca, 0xec, 0x03,
- 0xb6, 0xca, 0x26, 0x00, 0x00, 0xc3, 0x06, 0xc2,
- 0x09, 0xea, 0x55, 0xc2, 0x0a, 0xea, 0x51, 0xb5,
- 0xcc, 0xc8, 0xc5, 0xa3, 0x69, 0xda, 0x00, 0x00,
- 0x00, 0x26, 0x00, 0x00, 0xc3, 0x07, 0xb5, 0xc3,
- 0x04, 0xc2, 0x04, 0xc6, 0xa3, 0xea, 0x2f, 0xb5,
+ 0x02, 0xca, 0x03, 0xc7, 0x11, 0x2d, 0x0d, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0x94, 0x08, 0x00, 0x00, 0x00, 0x96, 0x08,
+ 0x00, 0x01, 0x00, 0xa8, 0x08, 0x00, 0x02, 0x00,
+ 0xb2, 0x06, 0x00, 0x03, 0x00, 0xc6, 0x06, 0x00,
+ 0x04, 0x00, 0xca, 0x06, 0x00, 0x05, 0x00, 0xda,
+ 0x06, 0x00, 0x06, 0x00, 0x98, 0x08, 0x00, 0x07,
+ 0x00, 0x86, 0x08, 0x00, 0x08, 0x00, 0xb4, 0x08,
+ 0x00, 0x09, 0x00, 0xb6, 0x08, 0x00, 0x0a, 0x00,
+ 0xd1, 0xe9, 0xc9, 0x38, 0x99, 0x00, 0x00, 0x00,
+ 0x42, 0xa7, 0x01, 0x00, 0x00, 0xd1, 0xb5, 0x47,
+ 0x24, 0x01, 0x00, 0xc4, 0x09, 0xea, 0x08, 0xd1,
+ 0xb5, 0x47, 0xe9, 0xcb, 0xec, 0x03, 0xb6, 0xcb,
+ 0xc7, 0xd2, 0xe9, 0xaa, 0xea, 0x0d, 0x38, 0xcf,
+ 0x00, 0x00, 0x00, 0x04, 0x1c, 0x02, 0x00, 0x00,
+ 0xef, 0x2f, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42,
+ 0xa7, 0x01, 0x00, 0x00, 0xd2, 0xb5, 0x47, 0x24,
+ 0x01, 0x00, 0xc4, 0x0a, 0xea, 0x08, 0xd2, 0xb5,
+ 0x47, 0xe9, 0xca, 0xec, 0x03, 0xb6, 0xca, 0x26,
+ 0x00, 0x00, 0xc3, 0x06, 0xc2, 0x09, 0xea, 0x55,
+ 0xc2, 0x0a, 0xea, 0x51, 0xb5, 0xcc, 0xc8, 0xc5,
+ 0xa3, 0x69, 0xda, 0x00, 0x00, 0x00, 0x26, 0x00,
+ 0x00, 0xc3, 0x07, 0xb5, 0xc3, 0x04, 0xc2, 0x04,
+ 0xc6, 0xa3, 0xea, 0x2f, 0xb5, 0xc3, 0x08, 0xb5,
+ 0xc3, 0x05, 0xc2, 0x05, 0xc7, 0xa3, 0xea, 0x18,
+ 0xc2, 0x08, 0xd1, 0xc8, 0x47, 0xc2, 0x05, 0x47,
+ 0xd2, 0xc2, 0x05, 0x47, 0xc2, 0x04, 0x47, 0x9a,
+ 0x9d, 0xc3, 0x08, 0x93, 0x05, 0xec, 0xe4, 0xc2,
+ 0x07, 0xc2, 0x04, 0xc2, 0x08, 0x49, 0x93, 0x04,
+ 0xec, 0xcd, 0xc2, 0x06, 0xc8, 0xc2, 0x07, 0x49,
+ 0x93, 0x03, 0xec, 0xb3, 0xc2, 0x09, 0xea, 0x3a,
+ 0xc2, 0x0a, 0x96, 0xea, 0x35, 0xb5, 0xcc, 0xc8,
+ 0xc5, 0xa3, 0x69, 0x81, 0x00, 0x00, 0x00, 0xb5,
  0xc3, 0x08, 0xb5, 0xc3, 0x05, 0xc2, 0x05, 0xc7,
- 0xa3, 0xea, 0x18, 0xc2, 0x08, 0xd1, 0xc8, 0x47,
- 0xc2, 0x05, 0x47, 0xd2, 0xc2, 0x05, 0x47, 0xc2,
- 0x04, 0x47, 0x9a, 0x9d, 0xc3, 0x08, 0x93, 0x05,
- 0xec, 0xe4, 0xc2, 0x07, 0xc2, 0x04, 0xc2, 0x08,
- 0x49, 0x93, 0x04, 0xec, 0xcd, 0xc2, 0x06, 0xc8,
- 0xc2, 0x07, 0x49, 0x93, 0x03, 0xec, 0xb3, 0xc2,
- 0x09, 0xea, 0x3a, 0xc2, 0x0a, 0x96, 0xea, 0x35,
- 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0x69, 0x81, 0x00,
- 0x00, 0x00, 0xb5, 0xc3, 0x08, 0xb5, 0xc3, 0x05,
- 0xc2, 0x05, 0xc7, 0xa3, 0xea, 0x15, 0xc2, 0x08,
- 0xd1, 0xc8, 0x47, 0xc2, 0x05, 0x47, 0xd2, 0xc2,
- 0x05, 0x47, 0x9a, 0x9d, 0xc3, 0x08, 0x93, 0x05,
- 0xec, 0xe7, 0xc2, 0x06, 0xc8, 0xc2, 0x08, 0x49,
- 0x93, 0x03, 0xec, 0xcf, 0xc2, 0x09, 0x96, 0xea,
- 0x38, 0xc2, 0x0a, 0xea, 0x34, 0xb5, 0xcc, 0xc8,
- 0xc5, 0xa3, 0xea, 0x44, 0x26, 0x00, 0x00, 0xc3,
- 0x07, 0xb5, 0xc3, 0x04, 0xc2, 0x04, 0xc6, 0xa3,
- 0xea, 0x15, 0xc2, 0x07, 0xc2, 0x04, 0x71, 0xd1,
- 0xc8, 0x47, 0xd2, 0xb5, 0x47, 0xc2, 0x04, 0x47,
- 0x9a, 0x49, 0x93, 0x04, 0xec, 0xe7, 0xc2, 0x06,
- 0xc8, 0xc2, 0x07, 0x49, 0x93, 0x03, 0xec, 0xd0,
- 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea, 0x11, 0xc2,
- 0x06, 0xc8, 0x71, 0xd1, 0xc8, 0x47, 0xd2, 0xb5,
- 0x47, 0x9a, 0x49, 0x93, 0x03, 0xec, 0xec, 0xc2,
- 0x06, 0x28, 0xc4, 0x03, 0xc7, 0x11, 0x2d, 0x04,
+ 0xa3, 0xea, 0x15, 0xc2, 0x08, 0xd1, 0xc8, 0x47,
+ 0xc2, 0x05, 0x47, 0xd2, 0xc2, 0x05, 0x47, 0x9a,
+ 0x9d, 0xc3, 0x08, 0x93, 0x05, 0xec, 0xe7, 0xc2,
+ 0x06, 0xc8, 0xc2, 0x08, 0x49, 0x93, 0x03, 0xec,
+ 0xcf, 0xc2, 0x09, 0x96, 0xea, 0x38, 0xc2, 0x0a,
+ 0xea, 0x34, 0xb5, 0xcc, 0xc8, 0xc5, 0xa3, 0xea,
+ 0x44, 0x26, 0x00, 0x00, 0xc3, 0x07, 0xb5, 0xc3,
+ 0x04, 0xc2, 0x04, 0xc6, 0xa3, 0xea, 0x15, 0xc2,
+ 0x07, 0xc2, 0x04, 0x71, 0xd1, 0xc8, 0x47, 0xd2,
+ 0xb5, 0x47, 0xc2, 0x04, 0x47, 0x9a, 0x49, 0x93,
+ 0x04, 0xec, 0xe7, 0xc2, 0x06, 0xc8, 0xc2, 0x07,
+ 0x49, 0x93, 0x03, 0xec, 0xd0, 0xb5, 0xcc, 0xc8,
+ 0xc5, 0xa3, 0xea, 0x11, 0xc2, 0x06, 0xc8, 0x71,
+ 0xd1, 0xc8, 0x47, 0xd2, 0xb5, 0x47, 0x9a, 0x49,
+ 0x93, 0x03, 0xec, 0xec, 0xc2, 0x06, 0x28, 0x04,
  0x12, 0x5d, 0x0d, 0x1c, 0x0d, 0x0e, 0x21, 0x3f,
  0x5d, 0x0d, 0x27, 0x0d, 0x1c, 0x2b, 0x35, 0x1c,
  0x30, 0x12, 0x30, 0x62, 0x17, 0x26, 0x17, 0x21,
  0x17, 0x30, 0x35, 0x12, 0x30, 0x53, 0x17, 0x21,
  0x17, 0x30, 0x26, 0x1c, 0x30, 0x53, 0x17, 0x21,
- 0x18, 0x26, 0x3f, 0x18, 0x0e, 0x43, 0x06, 0x01,
- 0xde, 0x05, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00,
- 0x0e, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xdc, 0x05, 0x42, 0x01,
- 0xdd, 0xd1, 0xd2, 0x42, 0xfe, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xfb, 0x11, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
- 0xe0, 0x05, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00,
- 0x23, 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd0,
- 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
- 0x00, 0xd8, 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9,
- 0xcb, 0x26, 0x00, 0x00, 0xc9, 0xb5, 0xca, 0xc6,
- 0xc7, 0xa3, 0xea, 0x14, 0xc5, 0xc6, 0x71, 0xd1,
- 0xc6, 0x47, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0x49, 0x93, 0x01, 0xec, 0xe9, 0xc5,
- 0x28, 0xc4, 0x03, 0xfe, 0x11, 0x05, 0x04, 0x12,
- 0x17, 0x26, 0x62, 0x0e, 0x43, 0x06, 0x01, 0xe2,
+ 0x18, 0x26, 0x3f, 0x18, 0x0e, 0x43, 0x06, 0x05,
+ 0xe8, 0x05, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00,
+ 0x0e, 0xca, 0x03, 0xfb, 0x11, 0x01, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0xe6, 0x05, 0x42, 0x01, 0xdd, 0xd1, 0xd2,
+ 0x42, 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0x23, 0x02, 0x00, 0x03, 0x0e, 0x43, 0x06, 0x05,
+ 0xea, 0x05, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00,
+ 0x23, 0xca, 0x03, 0xfe, 0x11, 0x05, 0x04, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
+ 0x00, 0xb2, 0x06, 0x00, 0x01, 0x00, 0xe2, 0x06,
+ 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xcb, 0x26, 0x00,
+ 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea,
+ 0x14, 0xc5, 0xc6, 0x71, 0xd1, 0xc6, 0x47, 0x42,
+ 0x01, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49,
+ 0x93, 0x01, 0xec, 0xe9, 0xc5, 0x28, 0x04, 0x12,
+ 0x17, 0x26, 0x62, 0x0e, 0x43, 0x06, 0x05, 0xec,
  0x05, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x22,
- 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
- 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00,
- 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd1, 0xe9, 0xcd,
- 0xd2, 0xe9, 0xaa, 0xea, 0x03, 0x09, 0x28, 0xb5,
- 0xca, 0xc6, 0xc5, 0xa3, 0xea, 0x10, 0xd1, 0xc6,
- 0x47, 0xd2, 0xc6, 0x47, 0xaa, 0xea, 0x03, 0x09,
- 0x28, 0x93, 0x01, 0xec, 0xed, 0x0a, 0x28, 0xc4,
- 0x03, 0x86, 0x12, 0x08, 0x04, 0x12, 0x1c, 0x0d,
- 0x26, 0x30, 0x0d, 0x17, 0x0e, 0x42, 0x07, 0x01,
+ 0xca, 0x03, 0x86, 0x12, 0x08, 0x04, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00,
+ 0xe2, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00,
+ 0x01, 0x00, 0xd1, 0xe9, 0xcd, 0xd2, 0xe9, 0xaa,
+ 0xea, 0x03, 0x09, 0x28, 0xb5, 0xca, 0xc6, 0xc5,
+ 0xa3, 0xea, 0x10, 0xd1, 0xc6, 0x47, 0xd2, 0xc6,
+ 0x47, 0xaa, 0xea, 0x03, 0x09, 0x28, 0x93, 0x01,
+ 0xec, 0xed, 0x0a, 0x28, 0x04, 0x12, 0x1c, 0x0d,
+ 0x26, 0x30, 0x0d, 0x17, 0x0e, 0x42, 0x27, 0x05,
  0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x28,
- 0xc4, 0x03, 0x99, 0x12, 0x01, 0x03, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x01, 0x03, 0x01, 0x04, 0x00,
- 0x00, 0x1c, 0x04, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xa8, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00,
- 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xd1,
- 0xe9, 0xca, 0x26, 0x00, 0x00, 0xcb, 0xb5, 0xc9,
- 0xc5, 0xc6, 0xa3, 0xea, 0x0d, 0xc7, 0xc5, 0x71,
- 0xd1, 0xc5, 0x47, 0x8c, 0x49, 0x93, 0x00, 0xec,
- 0xf0, 0xc7, 0x28, 0xc4, 0x03, 0x9c, 0x12, 0x05,
- 0x04, 0x12, 0x17, 0x26, 0x3f, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
- 0x0c, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xd1, 0xd2, 0x42, 0xfe,
- 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9a, 0x28,
- 0xc4, 0x03, 0xa9, 0x12, 0x00, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x06, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
- 0x06, 0x00, 0x01, 0x00, 0xda, 0x05, 0x41, 0x01,
- 0xdd, 0xd2, 0xd1, 0x23, 0x02, 0x00, 0xc4, 0x03,
- 0xaf, 0x12, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xe0, 0x05, 0x44, 0x01, 0xd1, 0xdd,
- 0xd2, 0xef, 0x9a, 0x28, 0xc4, 0x03, 0xb0, 0x12,
- 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x04,
- 0x00, 0x04, 0x00, 0x00, 0x25, 0x04, 0xa8, 0x06,
- 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00,
- 0xd0, 0x06, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01,
- 0x00, 0x08, 0xcc, 0xc8, 0xe9, 0xca, 0x26, 0x00,
- 0x00, 0xcb, 0xb5, 0xc9, 0xc5, 0xc6, 0xa3, 0xea,
- 0x14, 0xc7, 0xc5, 0x71, 0xc8, 0xc5, 0x47, 0x42,
- 0xfc, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49,
- 0x93, 0x00, 0xec, 0xe9, 0xc7, 0x28, 0xc4, 0x03,
- 0xb4, 0x12, 0x05, 0x0e, 0x12, 0x17, 0x26, 0x62,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x06, 0x00,
- 0x03, 0x00, 0x00, 0x3f, 0x06, 0xd0, 0x06, 0x00,
- 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8,
- 0x06, 0x00, 0x02, 0x00, 0xd4, 0x07, 0x00, 0x03,
- 0x00, 0xba, 0x06, 0x00, 0x04, 0x00, 0x10, 0x00,
- 0x01, 0x00, 0x08, 0xc3, 0x05, 0xc2, 0x05, 0xc3,
- 0x04, 0x26, 0x00, 0x00, 0xc9, 0xc2, 0x04, 0xe9,
- 0xcb, 0xb5, 0xca, 0xc6, 0xc7, 0xa3, 0xea, 0x28,
- 0xc2, 0x04, 0xc6, 0x47, 0xcc, 0x38, 0x96, 0x00,
- 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00, 0xc8,
- 0x24, 0x01, 0x00, 0xea, 0x0b, 0xc8, 0x42, 0x91,
- 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcc, 0xc5,
- 0xc6, 0xc8, 0x49, 0x93, 0x01, 0xec, 0xd5, 0xc5,
- 0x28, 0xc4, 0x03, 0xbc, 0x12, 0x0a, 0x12, 0x17,
+ 0xca, 0x03, 0x99, 0x12, 0x01, 0x01, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xd1, 0x28, 0x03, 0x0e, 0x42,
+ 0x27, 0x05, 0x00, 0x01, 0x03, 0x01, 0x04, 0x00,
+ 0x00, 0x1c, 0xca, 0x03, 0x9c, 0x12, 0x05, 0x04,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xb2, 0x06, 0x00,
+ 0x00, 0x00, 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda,
+ 0x06, 0x00, 0x02, 0x00, 0xd1, 0xe9, 0xca, 0x26,
+ 0x00, 0x00, 0xcb, 0xb5, 0xc9, 0xc5, 0xc6, 0xa3,
+ 0xea, 0x0d, 0xc7, 0xc5, 0x71, 0xd1, 0xc5, 0x47,
+ 0x8c, 0x49, 0x93, 0x00, 0xec, 0xf0, 0xc7, 0x28,
+ 0x04, 0x12, 0x17, 0x26, 0x3f, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x0c, 0xca, 0x03, 0xa9, 0x12, 0x00, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0xd2, 0x42, 0x01, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x9a, 0x28, 0x0e, 0x42, 0x27,
+ 0x05, 0x00, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
+ 0x06, 0xca, 0x03, 0xaf, 0x12, 0x00, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0xe4, 0x05, 0x41, 0x01, 0xdd, 0xd2, 0xd1,
+ 0x23, 0x02, 0x00, 0x0e, 0x42, 0x27, 0x05, 0x00,
+ 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0xca,
+ 0x03, 0xb0, 0x12, 0x00, 0x02, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01, 0x00, 0xea,
+ 0x05, 0x44, 0x01, 0xd1, 0xdd, 0xd2, 0xef, 0x9a,
+ 0x28, 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x04,
+ 0x00, 0x04, 0x00, 0x00, 0x25, 0xca, 0x03, 0xb4,
+ 0x12, 0x05, 0x04, 0xb2, 0x06, 0x00, 0x00, 0x00,
+ 0xe2, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcc,
+ 0xc8, 0xe9, 0xca, 0x26, 0x00, 0x00, 0xcb, 0xb5,
+ 0xc9, 0xc5, 0xc6, 0xa3, 0xea, 0x14, 0xc7, 0xc5,
+ 0x71, 0xc8, 0xc5, 0x47, 0x42, 0xff, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x49, 0x93, 0x00, 0xec,
+ 0xe9, 0xc7, 0x28, 0x0e, 0x12, 0x17, 0x26, 0x62,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x06, 0x00,
+ 0x03, 0x00, 0x00, 0x3f, 0xca, 0x03, 0xbc, 0x12,
+ 0x0a, 0x06, 0xda, 0x06, 0x00, 0x00, 0x00, 0xb2,
+ 0x06, 0x00, 0x01, 0x00, 0xe2, 0x06, 0x00, 0x02,
+ 0x00, 0xde, 0x07, 0x00, 0x03, 0x00, 0xc4, 0x06,
+ 0x00, 0x04, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc3, 0x05, 0xc2, 0x05, 0xc3, 0x04, 0x26, 0x00,
+ 0x00, 0xc9, 0xc2, 0x04, 0xe9, 0xcb, 0xb5, 0xca,
+ 0xc6, 0xc7, 0xa3, 0xea, 0x28, 0xc2, 0x04, 0xc6,
+ 0x47, 0xcc, 0x38, 0x99, 0x00, 0x00, 0x00, 0x42,
+ 0xa7, 0x01, 0x00, 0x00, 0xc8, 0x24, 0x01, 0x00,
+ 0xea, 0x0b, 0xc8, 0x42, 0x96, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xcc, 0xc5, 0xc6, 0xc8, 0x49,
+ 0x93, 0x01, 0xec, 0xd5, 0xc5, 0x28, 0x12, 0x17,
  0x17, 0x17, 0x26, 0x1c, 0x53, 0x35, 0x17, 0x17,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x03, 0x01, 0x00, 0x0c, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0xd8, 0x03, 0x06, 0x00, 0x08, 0xc9, 0xdd,
- 0x42, 0xfe, 0x00, 0x00, 0x00, 0xc5, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0xc8, 0x12, 0x01, 0x0d, 0x0e,
- 0x43, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
- 0x01, 0x00, 0x07, 0x00, 0xc8, 0x03, 0x01, 0x00,
- 0xdd, 0x41, 0x28, 0x01, 0x00, 0x00, 0x28, 0xc4,
- 0x03, 0xd5, 0x12, 0x00, 0x0e, 0x43, 0x06, 0x01,
- 0xf0, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x09, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1,
- 0x42, 0xf8, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
- 0xc4, 0x03, 0xe1, 0x12, 0x01, 0x04, 0x0e, 0x43,
- 0x06, 0x01, 0xf2, 0x03, 0x01, 0x00, 0x01, 0x02,
- 0x00, 0x00, 0x09, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd1, 0x42, 0xf9, 0x00, 0x00, 0x00, 0x25,
- 0x00, 0x00, 0xc4, 0x03, 0xe6, 0x12, 0x01, 0x04,
- 0x0e, 0x43, 0x06, 0x01, 0xf4, 0x03, 0x01, 0x00,
- 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xd1, 0x42, 0xfa, 0x00, 0x00,
- 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03, 0xeb, 0x12,
- 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01, 0xf6, 0x03,
- 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42, 0xfb,
- 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03,
- 0xf0, 0x12, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01,
- 0xf8, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x09, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd1,
- 0x42, 0xfc, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
- 0xc4, 0x03, 0xf5, 0x12, 0x01, 0x04, 0x0e, 0x43,
- 0x06, 0x01, 0xfa, 0x03, 0x01, 0x00, 0x01, 0x02,
- 0x00, 0x00, 0x09, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xd1, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x25,
- 0x00, 0x00, 0xc4, 0x03, 0xfa, 0x12, 0x01, 0x04,
- 0x0e, 0x43, 0x06, 0x01, 0xfc, 0x03, 0x01, 0x00,
- 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xd1, 0x42, 0xfe, 0x00, 0x00,
- 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03, 0xff, 0x12,
- 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01, 0xfe, 0x03,
- 0x01, 0x00, 0x01, 0x04, 0x05, 0x00, 0x58, 0x01,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00,
- 0x00, 0xca, 0x03, 0x02, 0x00, 0xd0, 0x03, 0x05,
- 0x00, 0xd4, 0x03, 0x07, 0x00, 0xc8, 0x03, 0x01,
- 0x00, 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd1,
- 0x24, 0x01, 0x00, 0xea, 0x03, 0xd1, 0x28, 0xd1,
- 0xde, 0xa7, 0xea, 0x16, 0xdd, 0x42, 0xb1, 0x01,
- 0x00, 0x00, 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00,
- 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x25, 0x02,
- 0x00, 0xd1, 0xdf, 0xa7, 0xea, 0x03, 0xd1, 0x28,
- 0xd1, 0xe0, 0xa7, 0xea, 0x19, 0xdf, 0x42, 0x8c,
- 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x24,
- 0x02, 0x00, 0xb5, 0x47, 0x28, 0x5e, 0x04, 0x00,
- 0x42, 0x01, 0x01, 0x00, 0x00, 0xd1, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0x84, 0x13, 0x0a, 0x04, 0x3f,
- 0x08, 0x21, 0x6c, 0x1c, 0x08, 0x21, 0x76, 0x08,
- 0x0e, 0x43, 0x06, 0x01, 0x80, 0x04, 0x01, 0x00,
- 0x01, 0x04, 0x03, 0x00, 0x32, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00, 0x00, 0xca,
- 0x03, 0x02, 0x00, 0xc8, 0x03, 0x01, 0x00, 0xdd,
- 0x42, 0x76, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01,
- 0x00, 0xea, 0x03, 0xd1, 0x28, 0xd1, 0xde, 0xa7,
- 0xea, 0x16, 0xdd, 0x42, 0x18, 0x02, 0x00, 0x00,
- 0xd1, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd1, 0x41,
- 0xc1, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0xdf,
- 0x42, 0x00, 0x01, 0x00, 0x00, 0xd1, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0x93, 0x13, 0x05, 0x04, 0x3f,
- 0x08, 0x21, 0x6d, 0x0e, 0x43, 0x06, 0x01, 0x82,
- 0x04, 0x01, 0x00, 0x01, 0x04, 0x03, 0x00, 0x32,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xc6, 0x03,
- 0x00, 0x00, 0xca, 0x03, 0x02, 0x00, 0xc8, 0x03,
- 0x01, 0x00, 0xdd, 0x42, 0x76, 0x01, 0x00, 0x00,
+ 0x0e, 0x42, 0x27, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x10, 0xca, 0x03, 0xc8, 0x12,
+ 0x01, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc9,
+ 0x38, 0xef, 0x00, 0x00, 0x00, 0x42, 0x01, 0x01,
+ 0x00, 0x00, 0xc5, 0x25, 0x01, 0x00, 0x0d, 0x0e,
+ 0x43, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x00, 0x0b, 0xca, 0x03, 0xd5, 0x12, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x41, 0x2d,
+ 0x01, 0x00, 0x00, 0x28, 0x0e, 0x43, 0x06, 0x05,
+ 0xf6, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0xca, 0x03, 0xe1, 0x12, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42, 0xfb, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0xf8, 0x03, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x09, 0xca, 0x03, 0xe6, 0x12, 0x01,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42,
+ 0xfc, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0xfa, 0x03, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x09, 0xca, 0x03, 0xeb,
+ 0x12, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0x04, 0x0e, 0x43, 0x06, 0x05, 0xfc, 0x03,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0xca,
+ 0x03, 0xf0, 0x12, 0x01, 0x01, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xd1, 0x42, 0xfe, 0x00, 0x00, 0x00,
+ 0x25, 0x00, 0x00, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0xfe, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0xca, 0x03, 0xf5, 0x12, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42, 0xff, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0x80, 0x04, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x09, 0xca, 0x03, 0xfa, 0x12, 0x01,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42,
+ 0x00, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x82, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x09, 0xca, 0x03, 0xff,
+ 0x12, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0x42, 0x01, 0x01, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0x04, 0x0e, 0x43, 0x06, 0x05, 0x84, 0x04,
+ 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x72, 0xca,
+ 0x03, 0x84, 0x13, 0x0a, 0x01, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42,
+ 0x7b, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0xea, 0x03, 0xd1, 0x28, 0xd1, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0xa7, 0xea, 0x1a, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0xb6, 0x01, 0x00, 0x00, 0xd1,
+ 0x41, 0xc5, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc6,
+ 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0xd1, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xa7, 0xea, 0x03, 0xd1,
+ 0x28, 0xd1, 0x38, 0xed, 0x00, 0x00, 0x00, 0xa7,
+ 0xea, 0x1d, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42,
+ 0x91, 0x01, 0x00, 0x00, 0xd1, 0x41, 0xc5, 0x01,
+ 0x00, 0x00, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0xb5, 0x47, 0x28, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x04, 0x01, 0x00, 0x00,
+ 0xd1, 0x25, 0x01, 0x00, 0x04, 0x53, 0x08, 0x35,
+ 0x80, 0x30, 0x08, 0x35, 0x8a, 0x08, 0x0e, 0x43,
+ 0x06, 0x05, 0x86, 0x04, 0x01, 0x00, 0x01, 0x04,
+ 0x00, 0x00, 0x42, 0xca, 0x03, 0x93, 0x13, 0x05,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00,
  0xd1, 0x24, 0x01, 0x00, 0xea, 0x03, 0xd1, 0x28,
- 0xd1, 0xde, 0xa7, 0xea, 0x16, 0xdd, 0x42, 0x19,
- 0x02, 0x00, 0x00, 0xd1, 0x41, 0xc0, 0x01, 0x00,
- 0x00, 0xd1, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x25,
- 0x02, 0x00, 0xdf, 0x42, 0x01, 0x01, 0x00, 0x00,
- 0xd1, 0x25, 0x01, 0x00, 0xc4, 0x03, 0x9e, 0x13,
- 0x05, 0x04, 0x3f, 0x08, 0x21, 0x6d, 0x0e, 0x43,
- 0x06, 0x01, 0x84, 0x04, 0x01, 0x04, 0x01, 0x05,
- 0x05, 0x00, 0x6b, 0x05, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xea, 0x06,
- 0x00, 0x01, 0x00, 0x9c, 0x07, 0x00, 0x02, 0x00,
- 0x9e, 0x07, 0x00, 0x03, 0x00, 0xd6, 0x03, 0x08,
- 0x00, 0xcc, 0x03, 0x03, 0x00, 0xf6, 0x03, 0x18,
- 0x00, 0x84, 0x04, 0x1f, 0x00, 0xc8, 0x03, 0x01,
- 0x00, 0xd1, 0xdd, 0xa7, 0xea, 0x07, 0xd1, 0xb6,
- 0xb7, 0x9b, 0xae, 0x28, 0xd1, 0xde, 0xa7, 0xea,
- 0x34, 0xdf, 0xd1, 0xef, 0xc9, 0xd1, 0x41, 0xce,
- 0x01, 0x00, 0x00, 0xca, 0xe0, 0xc5, 0xc6, 0x9d,
- 0xb7, 0x9b, 0xef, 0xcb, 0xe0, 0xc5, 0xc6, 0x9e,
- 0xb7, 0x9b, 0xef, 0xcc, 0xd1, 0x41, 0xcf, 0x01,
- 0x00, 0x00, 0xb5, 0xa3, 0xea, 0x04, 0xc8, 0x8c,
- 0xcc, 0xde, 0x42, 0x89, 0x01, 0x00, 0x00, 0xc7,
- 0xc8, 0x25, 0x02, 0x00, 0x5e, 0x04, 0x00, 0xd1,
- 0xef, 0xd9, 0xb5, 0xa3, 0xea, 0x13, 0xde, 0xb5,
- 0x5e, 0x04, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00,
+ 0xd1, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xa7, 0xea,
+ 0x1a, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x1d,
+ 0x02, 0x00, 0x00, 0xd1, 0x41, 0xc5, 0x01, 0x00,
+ 0x00, 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x25,
+ 0x02, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x03, 0x01, 0x00, 0x00, 0xd1, 0x25, 0x01, 0x00,
+ 0x04, 0x53, 0x08, 0x35, 0x81, 0x0e, 0x43, 0x06,
+ 0x05, 0x88, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00,
+ 0x00, 0x42, 0xca, 0x03, 0x9e, 0x13, 0x05, 0x01,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x42, 0x7b, 0x01, 0x00, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0xea, 0x03, 0xd1, 0x28, 0xd1,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0xa7, 0xea, 0x1a,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x42, 0x1e, 0x02,
+ 0x00, 0x00, 0xd1, 0x41, 0xc5, 0x01, 0x00, 0x00,
+ 0xd1, 0x41, 0xc6, 0x01, 0x00, 0x00, 0x25, 0x02,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x04,
+ 0x01, 0x00, 0x00, 0xd1, 0x25, 0x01, 0x00, 0x04,
+ 0x53, 0x08, 0x35, 0x81, 0x0e, 0x43, 0x06, 0x05,
+ 0x8a, 0x04, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00,
+ 0x8d, 0x01, 0xca, 0x03, 0xa9, 0x13, 0x0e, 0x05,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00,
+ 0x00, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0xa6,
+ 0x07, 0x00, 0x02, 0x00, 0xa8, 0x07, 0x00, 0x03,
+ 0x00, 0xd1, 0x38, 0xee, 0x00, 0x00, 0x00, 0xa7,
+ 0xea, 0x07, 0xd1, 0xb6, 0xb7, 0x9b, 0x9f, 0x28,
+ 0xd1, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xa7, 0xea,
+ 0x44, 0x38, 0xfe, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0xc9, 0xd1, 0x41, 0xd3, 0x01, 0x00, 0x00, 0xca,
+ 0x38, 0x05, 0x01, 0x00, 0x00, 0xc5, 0xc6, 0x9d,
+ 0xb7, 0x9b, 0xef, 0xcb, 0x38, 0x05, 0x01, 0x00,
+ 0x00, 0xc5, 0xc6, 0x9e, 0xb7, 0x9b, 0xef, 0xcc,
+ 0xd1, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xb5, 0xa3,
+ 0xea, 0x04, 0xc8, 0x8c, 0xcc, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xc7,
+ 0xc8, 0x25, 0x02, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0xd9, 0xb5, 0xa3, 0xea, 0x19,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0xb5, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x05, 0x01, 0x00, 0x00,
  0xd1, 0x8c, 0x24, 0x01, 0x00, 0x23, 0x02, 0x00,
- 0x5e, 0x04, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00,
- 0xd1, 0x25, 0x01, 0x00, 0xc4, 0x03, 0xa9, 0x13,
- 0x0e, 0x05, 0x1c, 0x1c, 0x21, 0x17, 0x26, 0x2b,
- 0x2b, 0x35, 0x12, 0x3b, 0x21, 0x17, 0x5e, 0x0e,
- 0x43, 0x06, 0x01, 0x86, 0x04, 0x01, 0x00, 0x01,
- 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xd1, 0x42, 0x03, 0x01, 0x00, 0x00,
- 0x25, 0x00, 0x00, 0xc4, 0x03, 0xc0, 0x13, 0x01,
- 0x04, 0x0e, 0x43, 0x06, 0x01, 0x88, 0x04, 0x01,
- 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42, 0x04, 0x01,
- 0x00, 0x00, 0x25, 0x00, 0x00, 0xc4, 0x03, 0xc5,
- 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01, 0x8a,
- 0x04, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x0b,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x88, 0x04,
- 0x21, 0x00, 0xc8, 0x03, 0x01, 0x00, 0xdd, 0xd1,
- 0xef, 0xde, 0x41, 0x85, 0x01, 0x00, 0x00, 0x9a,
- 0x28, 0xc4, 0x03, 0xca, 0x13, 0x01, 0x04, 0x0e,
- 0x43, 0x06, 0x01, 0x8c, 0x04, 0x01, 0x00, 0x01,
- 0x02, 0x02, 0x00, 0x0b, 0x01, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0x88, 0x04, 0x21, 0x00, 0xc8, 0x03,
- 0x01, 0x00, 0xdd, 0xd1, 0xef, 0xde, 0x41, 0x86,
- 0x01, 0x00, 0x00, 0x9a, 0x28, 0xc4, 0x03, 0xcf,
- 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x01, 0x8e,
- 0x04, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x07,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x8c, 0x04,
- 0x23, 0x00, 0xdd, 0xd1, 0xef, 0xbd, 0x0a, 0x9a,
- 0x28, 0xc4, 0x03, 0xd4, 0x13, 0x01, 0x04, 0x0e,
- 0x43, 0x06, 0x01, 0x90, 0x04, 0x01, 0x00, 0x01,
- 0x03, 0x00, 0x00, 0x08, 0x01, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbd, 0x0a, 0xd1, 0xbd, 0x0a, 0x9b,
- 0xae, 0x28, 0xc4, 0x03, 0xd9, 0x13, 0x01, 0x04,
- 0x0e, 0x43, 0x06, 0x01, 0x92, 0x04, 0x01, 0x01,
- 0x01, 0x04, 0x05, 0x00, 0x2b, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00,
- 0xcc, 0x03, 0x03, 0x00, 0xd6, 0x03, 0x08, 0x00,
- 0x86, 0x04, 0x20, 0x00, 0xda, 0x03, 0x0a, 0x00,
- 0xc8, 0x03, 0x01, 0x00, 0xd1, 0xdd, 0xa7, 0x11,
- 0xeb, 0x05, 0x0e, 0xd1, 0xde, 0xa7, 0xea, 0x10,
- 0xdf, 0xd1, 0xe0, 0x9a, 0xef, 0xcd, 0xb6, 0xc5,
- 0x9b, 0x9e, 0xb7, 0xe0, 0x9a, 0x9b, 0x28, 0x5e,
- 0x04, 0x00, 0x42, 0x09, 0x01, 0x00, 0x00, 0x5e,
- 0x04, 0x00, 0xd1, 0xef, 0x25, 0x01, 0x00, 0xc4,
- 0x03, 0xde, 0x13, 0x05, 0x05, 0x3f, 0x21, 0x2b,
- 0x08, 0x0e, 0x43, 0x06, 0x01, 0x94, 0x04, 0x01,
- 0x01, 0x01, 0x04, 0x05, 0x00, 0x29, 0x02, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
- 0x00, 0xcc, 0x03, 0x03, 0x00, 0xd6, 0x03, 0x08,
- 0x00, 0x86, 0x04, 0x20, 0x00, 0xda, 0x03, 0x0a,
- 0x00, 0xc8, 0x03, 0x01, 0x00, 0xd1, 0xdd, 0xa7,
- 0x11, 0xeb, 0x05, 0x0e, 0xd1, 0xde, 0xa7, 0xea,
- 0x0e, 0xdf, 0xd1, 0xe0, 0x9a, 0xef, 0xcd, 0xb6,
- 0xc5, 0x9b, 0x9d, 0xb7, 0x9b, 0x28, 0x5e, 0x04,
- 0x00, 0x42, 0x0a, 0x01, 0x00, 0x00, 0x5e, 0x04,
- 0x00, 0xd1, 0xef, 0x25, 0x01, 0x00, 0xc4, 0x03,
- 0xe9, 0x13, 0x05, 0x05, 0x3f, 0x21, 0x21, 0x08,
- 0x0e, 0x43, 0x06, 0x01, 0x96, 0x04, 0x01, 0x00,
- 0x01, 0x04, 0x05, 0x00, 0x24, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xcc, 0x03, 0x03, 0x00, 0xd6,
- 0x03, 0x08, 0x00, 0x92, 0x04, 0x26, 0x00, 0x94,
- 0x04, 0x27, 0x00, 0xc8, 0x03, 0x01, 0x00, 0xd1,
- 0xdd, 0xa7, 0x11, 0xeb, 0x05, 0x0e, 0xd1, 0xde,
- 0xa7, 0xea, 0x09, 0xdf, 0xd1, 0xef, 0xe0, 0xd1,
- 0xef, 0x9b, 0x28, 0x5e, 0x04, 0x00, 0x42, 0x0b,
- 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00, 0xd1, 0xef,
- 0x25, 0x01, 0x00, 0xc4, 0x03, 0xf4, 0x13, 0x04,
- 0x04, 0x3f, 0x26, 0x08, 0x0e, 0x43, 0x06, 0x01,
- 0x98, 0x04, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00,
- 0x0c, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xc8,
- 0x03, 0x01, 0x00, 0xdd, 0x42, 0x0c, 0x01, 0x00,
- 0x00, 0xdd, 0xd1, 0xef, 0x25, 0x01, 0x00, 0xc4,
- 0x03, 0xfd, 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06,
- 0x01, 0x9a, 0x04, 0x01, 0x00, 0x01, 0x04, 0x01,
- 0x00, 0x0c, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x01, 0x00, 0xdd, 0x42, 0x0d, 0x01,
- 0x00, 0x00, 0xdd, 0xd1, 0xef, 0x25, 0x01, 0x00,
- 0xc4, 0x03, 0x82, 0x14, 0x01, 0x04, 0x0e, 0x43,
- 0x06, 0x01, 0x9c, 0x04, 0x01, 0x00, 0x01, 0x04,
- 0x01, 0x00, 0x0c, 0x01, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xc8, 0x03, 0x01, 0x00, 0xdd, 0x42, 0x0e,
- 0x01, 0x00, 0x00, 0xdd, 0xd1, 0xef, 0x25, 0x01,
- 0x00, 0xc4, 0x03, 0x87, 0x14, 0x01, 0x04, 0x0e,
- 0x43, 0x06, 0x01, 0x9e, 0x04, 0x02, 0x00, 0x02,
- 0x05, 0x01, 0x00, 0x0f, 0x02, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xc8,
- 0x03, 0x01, 0x00, 0xdd, 0x42, 0x0f, 0x01, 0x00,
- 0x00, 0xdd, 0xd1, 0xef, 0xdd, 0xd2, 0xef, 0x25,
- 0x02, 0x00, 0xc4, 0x03, 0x8c, 0x14, 0x01, 0x04,
- 0x0e, 0x43, 0x06, 0x01, 0xa0, 0x04, 0x01, 0x00,
- 0x01, 0x02, 0x02, 0x00, 0x16, 0x01, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xc8, 0x03, 0x01, 0x00, 0x92,
- 0x04, 0x26, 0x00, 0xd1, 0xb5, 0xa9, 0xea, 0x03,
- 0xb6, 0x28, 0xd1, 0xdd, 0x41, 0x28, 0x01, 0x00,
- 0x00, 0x9a, 0xd5, 0xde, 0xd1, 0xef, 0xd1, 0x9b,
- 0x28, 0xc4, 0x03, 0x91, 0x14, 0x05, 0x04, 0x1c,
- 0x08, 0x08, 0x30, 0x0e, 0x43, 0x06, 0x01, 0xa2,
- 0x04, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x0d,
- 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x01, 0x00, 0xd1, 0xbe, 0xb4, 0x00, 0x9a, 0xdd,
- 0x41, 0x28, 0x01, 0x00, 0x00, 0x9b, 0x28, 0xc4,
- 0x03, 0x9b, 0x14, 0x01, 0x04, 0x0e, 0x43, 0x06,
- 0x01, 0xa4, 0x04, 0x01, 0x00, 0x01, 0x02, 0x01,
- 0x00, 0x0d, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00,
- 0xc8, 0x03, 0x01, 0x00, 0xd1, 0xdd, 0x41, 0x28,
- 0x01, 0x00, 0x00, 0x9a, 0xbe, 0xb4, 0x00, 0x9b,
- 0x28, 0xc4, 0x03, 0xa0, 0x14, 0x01, 0x04, 0x0e,
- 0x43, 0x06, 0x01, 0xa6, 0x04, 0x01, 0x01, 0x01,
- 0x04, 0x01, 0x01, 0x15, 0x02, 0xba, 0x06, 0x00,
- 0x01, 0x00, 0xd2, 0x07, 0x00, 0x00, 0x00, 0xc8,
- 0x03, 0x01, 0x00, 0xdd, 0x42, 0x03, 0x01, 0x00,
- 0x00, 0xdd, 0xd1, 0xef, 0x24, 0x01, 0x00, 0xcd,
- 0xb6, 0xc5, 0x9b, 0x9e, 0xbf, 0x00, 0x9a, 0x28,
- 0xc4, 0x03, 0xa5, 0x14, 0x02, 0x04, 0x3f, 0x06,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f,
- 0x0e, 0x43, 0x06, 0x01, 0xa8, 0x04, 0x01, 0x01,
- 0x01, 0x04, 0x01, 0x01, 0x15, 0x02, 0xba, 0x06,
- 0x00, 0x01, 0x00, 0xd2, 0x07, 0x00, 0x00, 0x00,
- 0xc8, 0x03, 0x01, 0x00, 0xdd, 0x42, 0x03, 0x01,
- 0x00, 0x00, 0xdd, 0xd1, 0xef, 0x24, 0x01, 0x00,
- 0xcd, 0xb6, 0xc5, 0x9b, 0x9d, 0xbf, 0x00, 0x9a,
- 0x28, 0xc4, 0x03, 0xab, 0x14, 0x02, 0x04, 0x3f,
- 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
- 0x3f, 0x0e, 0x43, 0x06, 0x01, 0xaa, 0x04, 0x01,
- 0x01, 0x01, 0x04, 0x01, 0x00, 0x16, 0x02, 0xba,
- 0x06, 0x00, 0x01, 0x00, 0xd2, 0x07, 0x00, 0x00,
- 0x00, 0xc8, 0x03, 0x01, 0x00, 0xdd, 0x42, 0x03,
- 0x01, 0x00, 0x00, 0xdd, 0xd1, 0xef, 0xb7, 0x9a,
- 0x24, 0x01, 0x00, 0xcd, 0xb6, 0x9e, 0xc5, 0xb6,
- 0x9d, 0x9b, 0x28, 0xc4, 0x03, 0xb1, 0x14, 0x02,
- 0x04, 0x49, 0x0e, 0x43, 0x06, 0x01, 0xac, 0x04,
- 0x01, 0x01, 0x01, 0x04, 0x03, 0x00, 0x11, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00,
- 0x00, 0x00, 0xc8, 0x03, 0x01, 0x00, 0x88, 0x04,
- 0x21, 0x00, 0x84, 0x04, 0x1f, 0x00, 0xdd, 0xd1,
- 0xef, 0xc9, 0xde, 0xdf, 0xc5, 0xc5, 0x9a, 0xb6,
- 0x9d, 0xef, 0xc5, 0x9d, 0x23, 0x01, 0x00, 0xc4,
- 0x03, 0xb7, 0x14, 0x02, 0x04, 0x17, 0x0e, 0x43,
- 0x06, 0x01, 0xae, 0x04, 0x01, 0x01, 0x01, 0x04,
- 0x03, 0x00, 0x11, 0x02, 0xba, 0x06, 0x00, 0x01,
- 0x00, 0xe4, 0x06, 0x00, 0x00, 0x00, 0xc8, 0x03,
- 0x01, 0x00, 0x88, 0x04, 0x21, 0x00, 0x84, 0x04,
- 0x1f, 0x00, 0xdd, 0xd1, 0xef, 0xc9, 0xde, 0xdf,
- 0xc5, 0xc5, 0x9a, 0xb6, 0x9e, 0xef, 0xc5, 0x9d,
- 0x23, 0x01, 0x00, 0xc4, 0x03, 0xbd, 0x14, 0x02,
- 0x04, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xb0, 0x04,
- 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x11, 0x02,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00,
- 0x00, 0x00, 0xc8, 0x03, 0x01, 0x00, 0x88, 0x04,
- 0x21, 0x00, 0xdd, 0xd1, 0xef, 0xc9, 0xbf, 0x00,
- 0xde, 0xb6, 0xc5, 0x9d, 0xb6, 0xc5, 0x9e, 0x9b,
- 0xef, 0x9a, 0x28, 0xc4, 0x03, 0xc3, 0x14, 0x02,
- 0x04, 0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
- 0x00, 0xe0, 0x3f, 0x0e, 0x43, 0x06, 0x01, 0xb2,
- 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x0d,
- 0x01, 0xe4, 0x06, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x01, 0x00, 0x86, 0x04, 0x20, 0x00, 0xdd, 0xd1,
- 0xef, 0xd5, 0xb6, 0xb6, 0xde, 0xd1, 0x8c, 0xef,
- 0x9d, 0x9b, 0x28, 0xc4, 0x03, 0xc9, 0x14, 0x02,
- 0x04, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xb4, 0x04,
- 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x08, 0x03,
- 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
- 0x01, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xd1,
- 0xd2, 0xd1, 0x9e, 0xd3, 0x9a, 0x9d, 0x28, 0xc4,
- 0x03, 0xcf, 0x14, 0x01, 0x04,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x05, 0x01,
+ 0x00, 0x00, 0xd1, 0x25, 0x01, 0x00, 0x05, 0x30,
+ 0x1c, 0x35, 0x2b, 0x26, 0x3f, 0x3f, 0x35, 0x12,
+ 0x4f, 0x2b, 0x17, 0x7c, 0x0e, 0x43, 0x06, 0x05,
+ 0x8c, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0xca, 0x03, 0xc0, 0x13, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42, 0x06, 0x01,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0x8e, 0x04, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x09, 0xca, 0x03, 0xc5, 0x13, 0x01,
+ 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0x42,
+ 0x07, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x90, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x13, 0xca, 0x03, 0xca,
+ 0x13, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0x07, 0x01, 0x00, 0x00, 0xd1, 0xef, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x41, 0x8a, 0x01, 0x00,
+ 0x00, 0x9a, 0x28, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0x92, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x13, 0xca, 0x03, 0xcf, 0x13, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0x07, 0x01, 0x00,
+ 0x00, 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x41, 0x8b, 0x01, 0x00, 0x00, 0x9a, 0x28, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x94, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x0b, 0xca, 0x03, 0xd4,
+ 0x13, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0x09, 0x01, 0x00, 0x00, 0xd1, 0xef, 0xbd,
+ 0x0a, 0x9a, 0x28, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0x96, 0x04, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00,
+ 0x08, 0xca, 0x03, 0xd9, 0x13, 0x01, 0x01, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xbd, 0x0a, 0xd1, 0xbd,
+ 0x0a, 0x9b, 0x9f, 0x28, 0x04, 0x0e, 0x43, 0x06,
+ 0x05, 0x98, 0x04, 0x01, 0x01, 0x01, 0x04, 0x00,
+ 0x00, 0x43, 0xca, 0x03, 0xde, 0x13, 0x05, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00,
+ 0x00, 0x00, 0xd1, 0x38, 0xe9, 0x00, 0x00, 0x00,
+ 0xa7, 0x11, 0xeb, 0x09, 0x0e, 0xd1, 0x38, 0xee,
+ 0x00, 0x00, 0x00, 0xa7, 0xea, 0x1c, 0x38, 0x06,
+ 0x01, 0x00, 0x00, 0xd1, 0x38, 0xf0, 0x00, 0x00,
+ 0x00, 0x9a, 0xef, 0xcd, 0xb6, 0xc5, 0x9b, 0x9e,
+ 0xb7, 0x38, 0xf0, 0x00, 0x00, 0x00, 0x9a, 0x9b,
+ 0x28, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x0c,
+ 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0x25, 0x01, 0x00, 0x05, 0x67, 0x49,
+ 0x3f, 0x08, 0x0e, 0x43, 0x06, 0x05, 0x9a, 0x04,
+ 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x3d, 0xca,
+ 0x03, 0xe9, 0x13, 0x05, 0x02, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x00, 0xd1,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0xa7, 0x11, 0xeb,
+ 0x09, 0x0e, 0xd1, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0xa7, 0xea, 0x16, 0x38, 0x06, 0x01, 0x00, 0x00,
+ 0xd1, 0x38, 0xf0, 0x00, 0x00, 0x00, 0x9a, 0xef,
+ 0xcd, 0xb6, 0xc5, 0x9b, 0x9d, 0xb7, 0x9b, 0x28,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x0d, 0x01,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1,
+ 0xef, 0x25, 0x01, 0x00, 0x05, 0x67, 0x49, 0x21,
+ 0x08, 0x0e, 0x43, 0x06, 0x05, 0x9c, 0x04, 0x01,
+ 0x00, 0x01, 0x04, 0x00, 0x00, 0x38, 0xca, 0x03,
+ 0xf4, 0x13, 0x04, 0x01, 0xc4, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xa7,
+ 0x11, 0xeb, 0x09, 0x0e, 0xd1, 0x38, 0xee, 0x00,
+ 0x00, 0x00, 0xa7, 0xea, 0x11, 0x38, 0x0c, 0x01,
+ 0x00, 0x00, 0xd1, 0xef, 0x38, 0x0d, 0x01, 0x00,
+ 0x00, 0xd1, 0xef, 0x9b, 0x28, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0x25, 0x01,
+ 0x00, 0x04, 0x67, 0x4e, 0x08, 0x0e, 0x43, 0x06,
+ 0x05, 0x9e, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00,
+ 0x00, 0x14, 0xca, 0x03, 0xfd, 0x13, 0x01, 0x01,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x0f, 0x01, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0x25, 0x01,
+ 0x00, 0x04, 0x0e, 0x43, 0x06, 0x05, 0xa0, 0x04,
+ 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x14, 0xca,
+ 0x03, 0x82, 0x14, 0x01, 0x01, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x10, 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x25, 0x01, 0x00, 0x04, 0x0e,
+ 0x43, 0x06, 0x05, 0xa2, 0x04, 0x01, 0x00, 0x01,
+ 0x04, 0x00, 0x00, 0x14, 0xca, 0x03, 0x87, 0x14,
+ 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x42, 0x11, 0x01, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef,
+ 0x25, 0x01, 0x00, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0xa4, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00,
+ 0x1b, 0xca, 0x03, 0x8c, 0x14, 0x01, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xc8, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x12,
+ 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd2,
+ 0xef, 0x25, 0x02, 0x00, 0x04, 0x0e, 0x43, 0x06,
+ 0x05, 0xa6, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x1e, 0xca, 0x03, 0x91, 0x14, 0x05, 0x01,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xd1, 0xb5, 0xa9,
+ 0xea, 0x03, 0xb6, 0x28, 0xd1, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x41, 0x2d, 0x01, 0x00, 0x00, 0x9a,
+ 0xd5, 0x38, 0x0c, 0x01, 0x00, 0x00, 0xd1, 0xef,
+ 0xd1, 0x9b, 0x28, 0x04, 0x1c, 0x08, 0x08, 0x44,
+ 0x0e, 0x43, 0x06, 0x05, 0xa8, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x11, 0xca, 0x03, 0x9b,
+ 0x14, 0x01, 0x01, 0xc4, 0x06, 0x00, 0x01, 0x00,
+ 0xd1, 0xbe, 0xb4, 0x00, 0x9a, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x41, 0x2d, 0x01, 0x00, 0x00, 0x9b,
+ 0x28, 0x04, 0x0e, 0x43, 0x06, 0x05, 0xaa, 0x04,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x11, 0xca,
+ 0x03, 0xa0, 0x14, 0x01, 0x01, 0xc4, 0x06, 0x00,
+ 0x01, 0x00, 0xd1, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x41, 0x2d, 0x01, 0x00, 0x00, 0x9a, 0xbe, 0xb4,
+ 0x00, 0x9b, 0x28, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0xac, 0x04, 0x01, 0x01, 0x01, 0x04, 0x00, 0x01,
+ 0x20, 0xca, 0x03, 0xa5, 0x14, 0x02, 0x02, 0xc4,
+ 0x06, 0x00, 0x01, 0x00, 0xdc, 0x07, 0x00, 0x00,
+ 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x06,
+ 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd1, 0xef, 0x24, 0x01, 0x00, 0xcd, 0xb6, 0xc5,
+ 0x9b, 0x9e, 0xbf, 0x00, 0xbd, 0xed, 0xb1, 0x9a,
+ 0x28, 0x04, 0x67, 0x0b, 0x88, 0x02, 0x06, 0xe8,
+ 0x89, 0x04, 0x23, 0xc7, 0x8a, 0x0e, 0x43, 0x06,
+ 0x05, 0xae, 0x04, 0x01, 0x01, 0x01, 0x04, 0x00,
+ 0x01, 0x20, 0xca, 0x03, 0xab, 0x14, 0x02, 0x02,
+ 0xc4, 0x06, 0x00, 0x01, 0x00, 0xdc, 0x07, 0x00,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x06, 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0x24, 0x01, 0x00, 0xcd, 0xb6,
+ 0xc5, 0x9b, 0x9d, 0xbf, 0x00, 0xbd, 0xed, 0xb1,
+ 0x9a, 0x28, 0x04, 0x67, 0x0b, 0x88, 0x02, 0x06,
+ 0xe8, 0x89, 0x04, 0x23, 0xc7, 0x8a, 0x0e, 0x43,
+ 0x06, 0x05, 0xb0, 0x04, 0x01, 0x01, 0x01, 0x04,
+ 0x00, 0x00, 0x1e, 0xca, 0x03, 0xb1, 0x14, 0x02,
+ 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xdc, 0x07,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x42, 0x06, 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xd1, 0xef, 0xb7, 0x9a, 0x24, 0x01,
+ 0x00, 0xcd, 0xb6, 0x9e, 0xc5, 0xb6, 0x9d, 0x9b,
+ 0x28, 0x04, 0x71, 0x0e, 0x43, 0x06, 0x05, 0xb2,
+ 0x04, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x1d,
+ 0xca, 0x03, 0xb7, 0x14, 0x02, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xee, 0x06, 0x00, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xc9,
+ 0x38, 0x07, 0x01, 0x00, 0x00, 0x38, 0x05, 0x01,
+ 0x00, 0x00, 0xc5, 0xc5, 0x9a, 0xb6, 0x9d, 0xef,
+ 0xc5, 0x9d, 0x23, 0x01, 0x00, 0x04, 0x2b, 0x0e,
+ 0x43, 0x06, 0x05, 0xb4, 0x04, 0x01, 0x01, 0x01,
+ 0x04, 0x00, 0x00, 0x1d, 0xca, 0x03, 0xbd, 0x14,
+ 0x02, 0x02, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xee,
+ 0x06, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xd1, 0xef, 0xc9, 0x38, 0x07, 0x01, 0x00,
+ 0x00, 0x38, 0x05, 0x01, 0x00, 0x00, 0xc5, 0xc5,
+ 0x9a, 0xb6, 0x9e, 0xef, 0xc5, 0x9d, 0x23, 0x01,
+ 0x00, 0x04, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xb6,
+ 0x04, 0x01, 0x01, 0x01, 0x05, 0x00, 0x01, 0x1c,
+ 0xca, 0x03, 0xc3, 0x14, 0x02, 0x02, 0xc4, 0x06,
+ 0x00, 0x01, 0x00, 0xee, 0x06, 0x00, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xc9,
+ 0xbf, 0x00, 0xbd, 0xed, 0xb1, 0x38, 0x07, 0x01,
+ 0x00, 0x00, 0xb6, 0xc5, 0x9d, 0xb6, 0xc5, 0x9e,
+ 0x9b, 0xef, 0x9a, 0x28, 0x04, 0x2b, 0x0b, 0x88,
+ 0x02, 0x06, 0xe8, 0x89, 0x04, 0x23, 0xc7, 0x8a,
+ 0x0e, 0x43, 0x06, 0x05, 0xb8, 0x04, 0x01, 0x00,
+ 0x01, 0x04, 0x00, 0x00, 0x15, 0xca, 0x03, 0xc9,
+ 0x14, 0x02, 0x01, 0xee, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd1, 0xef, 0xd5,
+ 0xb6, 0xb6, 0x38, 0x06, 0x01, 0x00, 0x00, 0xd1,
+ 0x8c, 0xef, 0x9d, 0x9b, 0x28, 0x04, 0x2b, 0x0e,
+ 0x43, 0x06, 0x05, 0xba, 0x04, 0x03, 0x00, 0x03,
+ 0x03, 0x00, 0x00, 0x08, 0xca, 0x03, 0xcf, 0x14,
+ 0x01, 0x03, 0xc4, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06, 0x00, 0x01,
+ 0x00, 0xd1, 0xd2, 0xd1, 0x9e, 0xd3, 0x9a, 0x9d,
+ 0x28, 0x04,
 };
 
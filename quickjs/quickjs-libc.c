@@ -59,6 +59,7 @@
 #include <termios.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 
 #if defined(__APPLE__)
 typedef sig_t sighandler_t;
@@ -75,6 +76,12 @@ typedef sig_t sighandler_t;
 #define USE_WORKER
 #endif
 
+#if defined(__linux__)
+/* use epoll() instead of select() in the event loop */
+#define USE_EPOLL
+#include <sys/epoll.h>
+#endif
+
 #ifdef USE_WORKER
 #include <pthread.h>
 #include <stdatomic.h>
@@ -101,12 +108,22 @@ typedef struct {
 } JSOSSignalHandler;
 
 typedef struct {
-    struct list_head link;
+    int heap_idx; /* index in JSThreadState.timer_heap, -1 if not active */
     BOOL has_object;
     int64_t timeout;
+    uint64_t seq; /* creation order of the timers */
     JSValue func;
 } JSOSTimer;
 
+#ifdef USE_EPOLL
+typedef struct {
+    JSOSRWHandler *rh; /* NULL if no handler */
+    uint32_t events; /* events registered in the epoll set */
+    uint32_t gen; /* incremented each time a new handler is created */
+    BOOL no_epoll; /* TRUE if epoll is not supported for this fd */
+} JSOSFdEntry;
+#endif
+
 typedef struct {
     struct list_head link;
     uint8_t *data;
@@ -114,6 +131,9 @@ typedef struct {
     /* list of SharedArrayBuffers, necessary to free the message */
     uint8_t **sab_tab;
     size_t sab_tab_len;
+    /* transferred ArrayBuffers */
+    JSArrayBufferTransfer *transfer_tab;
+    int transfer_len;
 } JSWorkerMessage;
 
 typedef struct {
@@ -135,9 +155,21 @@ typedef struct {
 typedef struct JSThreadState {
     struct list_head os_rw_handlers; /* list of JSOSRWHandler.link */
     struct list_head os_signal_handlers; /* list JSOSSignalHandler.link */
-    struct list_head os_timers; /* list of JSOSTimer.link */
+    /* binary heap of the active timers ordered by timeout */
+    JSOSTimer **timer_heap;
+    int timer_count;
+    int timer_size;
+    uint64_t timer_seq;
+#ifdef USE_EPOLL
+    int epoll_fd; /* -1 if epoll is not available: select() is used */
+    JSOSFdEntry *fd_tab; /* indexed by file descriptor */
+    int fd_tab_size;
+    int no_epoll_count; /* number of fds with no_epoll = TRUE */
+#endif
     struct list_head port_list; /* list of JSWorkerMessageHandler.link */
     int eval_script_recurse; /* only used in the main thread */
+    struct JSModulePreloader *module_preloader; /* see js_std_preload_modules() */
+    struct JSAsyncIOQueue *async_io; /* NULL if no asynchronous I/O yet */
     /* not used in the main thread */
     JSWorkerMessagePipe *recv_pipe, *send_pipe;
 } JSThreadState;
@@ -371,51 +403,58 @@ fail:
     return JS_EXCEPTION;
 }
 
-uint8_t *js_load_file(JSContext *ctx, size_t *pbuf_len, const char *filename)
+/* read the whole file 'f' from its start */
+static uint8_t *js_load_file_fp(JSContext *ctx, size_t *pbuf_len, FILE *f)
 {
-    FILE *f;
     uint8_t *buf;
     size_t buf_len;
     long lret;
-    
-    f = fopen(filename, "rb");
-    if (!f)
-        return NULL;
+
     if (fseek(f, 0, SEEK_END) < 0)
-        goto fail;
+        return NULL;
     lret = ftell(f);
     if (lret < 0)
-        goto fail;
+        return NULL;
     /* XXX: on Linux, ftell() return LONG_MAX for directories */
     if (lret == LONG_MAX) {
         errno = EISDIR;
-        goto fail;
+        return NULL;
     }
     buf_len = lret;
     if (fseek(f, 0, SEEK_SET) < 0)
-        goto fail;
+        return NULL;
     if (ctx)
         buf = js_malloc(ctx, buf_len + 1);
     else
         buf = malloc(buf_len + 1);
     if (!buf)
-        goto fail;
+        return NULL;
     if (fread(buf, 1, buf_len, f) != buf_len) {
         errno = EIO;
         if (ctx)
             js_free(ctx, buf);
         else
             free(buf);
-    fail:
-        fclose(f);
         return NULL;
     }
     buf[buf_len] = '\0';
-    fclose(f);
     *pbuf_len = buf_len;
     return buf;
 }
 
+uint8_t *js_load_file(JSContext *ctx, size_t *pbuf_len, const char *filename)
+{
+    FILE *f;
+    uint8_t *buf;
+
+    f = fopen(filename, "rb");
+    if (!f)
+        return NULL;
+    buf = js_load_file_fp(ctx, pbuf_len, f);
+    fclose(f);
+    return buf;
+}
+
 /* load and evaluate a file */
 static JSValue js_loadScript(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv)
@@ -577,6 +616,342 @@ int js_module_set_import_meta(JSContext *ctx, JSValueConst func_val,
     return 0;
 }
 
+/* Module bytecode cache: the bytecode of the modules loaded from source
+   files is stored in a directory and read back by the next runs. An entry
+   is used only if the source has the same modification time and size and
+   if it was written by the same build of the engine. The directory must
+   be trusted as the bytecode is not verified. */
+
+static char *js_module_cache_dir; /* see js_std_set_module_cache() */
+
+#define JS_MODULE_CACHE_MAGIC "QJSMODC1"
+
+typedef struct {
+    char magic[8];
+    uint32_t build_id_len;
+    uint32_t key_len;
+    int64_t mtime_ns;
+    int64_t size;
+    uint64_t bytecode_len;
+    /* followed by the build id, the key and the bytecode */
+} JSModuleCacheHeader;
+
+typedef struct {
+    /* the source is read from the file whose modification time and size
+       were taken, so that it cannot be replaced in between */
+    FILE *source;
+    int64_t mtime_ns;
+    int64_t size;
+    char file[PATH_MAX + 32]; /* cache entry */
+    size_t key_len;
+    /* absolute path of the source and module name separated by '\n': the
+       module name is stored in the bytecode and depends on the importer */
+    char key[2 * PATH_MAX];
+} JSModuleCacheKey;
+
+static int64_t js_stat_mtime_ns(const struct stat *st)
+{
+#if defined(_WIN32) || defined(ANDROID)
+    return (int64_t)st->st_mtime * 1000000000;
+#elif defined(__APPLE__)
+    return (int64_t)st->st_mtimespec.tv_sec * 1000000000 +
+        st->st_mtimespec.tv_nsec;
+#else
+    return (int64_t)st->st_mtim.tv_sec * 1000000000 + st->st_mtim.tv_nsec;
+#endif
+}
+
+/* Return TRUE if the modification time and size of the source are the
+   ones of the key */
+static BOOL js_module_cache_source_unchanged(const JSModuleCacheKey *key)
+{
+    struct stat st;
+    return fstat(fileno(key->source), &st) == 0 &&
+        js_stat_mtime_ns(&st) == key->mtime_ns && st.st_size == key->size;
+}
+
+static void js_module_cache_free_key(JSModuleCacheKey *key)
+{
+    if (key) {
+        fclose(key->source);
+        free(key);
+    }
+}
+
+/* Return the cache key of the module source file (freed with
+   js_module_cache_free_key()) or NULL if the cache is disabled or the
+   file is not found */
+static JSModuleCacheKey *js_module_cache_key(const char *module_name)
+{
+    JSModuleCacheKey *key;
+    struct stat st;
+    uint64_t h;
+    size_t i, len;
+    int ret;
+
+    if (!js_module_cache_dir)
+        return NULL;
+    key = malloc(sizeof(*key));
+    if (!key)
+        return NULL;
+    key->source = NULL;
+#if defined(_WIN32)
+    if (!_fullpath(key->key, module_name, PATH_MAX))
+        goto fail;
+#else
+    if (!realpath(module_name, key->key))
+        goto fail;
+#endif
+    key->source = fopen(key->key, "rb");
+    if (!key->source)
+        goto fail;
+    if (fstat(fileno(key->source), &st) != 0 || !S_ISREG(st.st_mode))
+        goto fail;
+    key->mtime_ns = js_stat_mtime_ns(&st);
+    key->size = st.st_size;
+    len = strlen(key->key);
+    ret = snprintf(key->key + len, sizeof(key->key) - len, "\n%s",
+                   module_name);
+    if (ret < 0 || ret >= sizeof(key->key) - len)
+        goto fail;
+    key->key_len = len + ret;
+
+    /* FNV-1a */
+    h = UINT64_C(0xcbf29ce484222325);
+    for(i = 0; i < key->key_len; i++)
+        h = (h ^ (uint8_t)key->key[i]) * UINT64_C(0x100000001b3);
+    ret = snprintf(key->file, sizeof(key->file), "%s/%016" PRIx64 ".qbc",
+                   js_module_cache_dir, h);
+    if (ret < 0 || ret >= sizeof(key->file))
+        goto fail;
+    return key;
+ fail:
+    if (key->source)
+        fclose(key->source);
+    free(key);
+    return NULL;
+}
+
+static BOOL js_module_cache_check_header(const JSModuleCacheKey *key,
+                                        const JSModuleCacheHeader *h)
+{
+    return memcmp(h->magic, JS_MODULE_CACHE_MAGIC, sizeof(h->magic)) == 0 &&
+        h->build_id_len == strlen(JS_GetBuildId()) &&
+        h->key_len == key->key_len &&
+        h->mtime_ns == key->mtime_ns && h->size == key->size &&
+        h->bytecode_len != 0 && h->bytecode_len <= INT32_MAX;
+}
+
+/* Return the cached bytecode (allocated with malloc()) or NULL if there
+   is no valid cache entry */
+static uint8_t *js_module_cache_read(const JSModuleCacheKey *key,
+                                     size_t *pbytecode_len)
+{
+    JSModuleCacheHeader h;
+    const char *build_id;
+    size_t build_id_len;
+    uint8_t *buf;
+    FILE *f;
+
+    f = fopen(key->file, "rb");
+    if (!f)
+        return NULL;
+    buf = NULL;
+    build_id = JS_GetBuildId();
+    build_id_len = strlen(build_id);
+    if (fread(&h, sizeof(h), 1, f) != 1 ||
+        !js_module_cache_check_header(key, &h))
+        goto done;
+    buf = malloc(max_int(build_id_len + key->key_len, (int)h.bytecode_len));
+    if (!buf)
+        goto done;
+    if (fread(buf, build_id_len + key->key_len, 1, f) != 1 ||
+        memcmp(buf, build_id, build_id_len) != 0 ||
+        memcmp(buf + build_id_len, key->key, key->key_len) != 0 ||
+        fread(buf, h.bytecode_len, 1, f) != 1) {
+        free(buf);
+        buf = NULL;
+        goto done;
+    }
+    *pbytecode_len = h.bytecode_len;
+ done:
+    fclose(f);
+    return buf;
+}
+
+/* The entry is written to a temporary file which is then renamed, so that
+   concurrent readers and writers (other processes or workers) never see a
+   partial entry. Errors are ignored. */
+static void js_module_cache_write(const JSModuleCacheKey *key,
+                                  const uint8_t *bytecode, size_t bytecode_len)
+{
+    char tmp[PATH_MAX + 64];
+    JSModuleCacheHeader h;
+    const char *build_id;
+    FILE *f;
+    BOOL ok;
+
+    /* 'key' is unique among the threads writing concurrently */
+#if defined(_WIN32)
+    snprintf(tmp, sizeof(tmp), "%s.%lu.%p", key->file,
+             (unsigned long)GetCurrentProcessId(), (void *)key);
+#else
+    snprintf(tmp, sizeof(tmp), "%s.%ld.%p", key->file, (long)getpid(),
+             (void *)key);
+#endif
+    f = fopen(tmp, "wb");
+    if (!f)
+        return;
+    build_id = JS_GetBuildId();
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, JS_MODULE_CACHE_MAGIC, sizeof(h.magic));
+    h.build_id_len = strlen(build_id);
+    h.key_len = key->key_len;
+    h.mtime_ns = key->mtime_ns;
+    h.size = key->size;
+    h.bytecode_len = bytecode_len;
+    ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+        fwrite(build_id, h.build_id_len, 1, f) == 1 &&
+        fwrite(key->key, key->key_len, 1, f) == 1 &&
+        fwrite(bytecode, bytecode_len, 1, f) == 1;
+    if (fclose(f) != 0)
+        ok = FALSE;
+#if defined(_WIN32)
+    /* rename() does not replace an existing file */
+    if (ok)
+        remove(key->file);
+#endif
+    if (!ok || rename(tmp, key->file) != 0)
+        remove(tmp);
+}
+
+#if !defined(_WIN32)
+/* The cache entries are not modified once written (see
+   js_module_cache_write()), so the bytecode is read in place from a
+   read only mapping shared by the processes using the cache. It is
+   unmapped when the module and its functions are freed. */
+typedef struct {
+    void *addr;
+    size_t size;
+} JSModuleCacheMapping;
+
+static void js_module_cache_unmap(JSRuntime *rt, void *opaque, void *ptr)
+{
+    JSModuleCacheMapping *cm = opaque;
+    munmap(cm->addr, cm->size);
+    free(cm);
+}
+
+static JSValue js_module_cache_read_mapped(JSContext *ctx,
+                                           const JSModuleCacheKey *key)
+{
+    const JSModuleCacheHeader *h;
+    JSModuleCacheMapping *cm;
+    const char *build_id;
+    const uint8_t *p;
+    struct stat st;
+    int fd;
+
+    fd = open(key->file, O_RDONLY);
+    if (fd < 0)
+        return JS_UNDEFINED;
+    cm = NULL;
+    if (fstat(fd, &st) != 0 || st.st_size < sizeof(*h))
+        goto fail;
+    cm = malloc(sizeof(*cm));
+    if (!cm)
+        goto fail;
+    cm->size = st.st_size;
+    cm->addr = mmap(NULL, cm->size, PROT_READ, MAP_SHARED, fd, 0);
+    if (cm->addr == MAP_FAILED)
+        goto fail;
+    close(fd);
+    h = cm->addr;
+    p = (const uint8_t *)(h + 1);
+    build_id = JS_GetBuildId();
+    if (!js_module_cache_check_header(key, h) ||
+        cm->size != sizeof(*h) + h->build_id_len + h->key_len +
+        h->bytecode_len ||
+        memcmp(p, build_id, h->build_id_len) != 0 ||
+        memcmp(p + h->build_id_len, key->key, key->key_len) != 0) {
+        js_module_cache_unmap(NULL, cm, NULL);
+        return JS_UNDEFINED;
+    }
+    p += h->build_id_len + h->key_len;
+    return JS_ReadObjectROM(ctx, p, h->bytecode_len, JS_READ_OBJ_BYTECODE,
+                            js_module_cache_unmap, cm);
+ fail:
+    free(cm);
+    close(fd);
+    return JS_UNDEFINED;
+}
+#endif
+
+static JSModuleDef *js_module_loader_cached(JSContext *ctx,
+                                            const JSModuleCacheKey *key)
+{
+    JSValue obj;
+    JSModuleDef *m;
+#if defined(_WIN32)
+    uint8_t *buf;
+    size_t buf_len;
+
+    buf = js_module_cache_read(key, &buf_len);
+    if (!buf)
+        return NULL;
+    obj = JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_BYTECODE);
+    free(buf);
+#else
+    obj = js_module_cache_read_mapped(ctx, key);
+    if (JS_IsUndefined(obj))
+        return NULL;
+#endif
+    if (JS_IsException(obj)) {
+        /* compiled again from source */
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return NULL;
+    }
+    js_module_set_import_meta(ctx, obj, TRUE, FALSE);
+    m = JS_VALUE_GET_PTR(obj);
+    JS_FreeValue(ctx, obj);
+    return m;
+}
+
+static void js_module_cache_store(JSContext *ctx, const JSModuleCacheKey *key,
+                                  JSValueConst obj)
+{
+    uint8_t *buf;
+    size_t buf_len;
+
+    buf = JS_WriteObject(ctx, &buf_len, obj, JS_WRITE_OBJ_BYTECODE);
+    if (!buf) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return;
+    }
+    js_module_cache_write(key, buf, buf_len);
+    js_free(ctx, buf);
+}
+
+/* Enable the module bytecode cache in the directory 'dir' (created if
+   needed) for all the runtimes, or disable it if 'dir' is NULL. Must be
+   called before the runtimes are created. */
+void js_std_set_module_cache(const char *dir)
+{
+    free(js_module_cache_dir);
+    js_module_cache_dir = NULL;
+    if (dir) {
+#if defined(_WIN32)
+        mkdir(dir);
+#else
+        mkdir(dir, 0777);
+#endif
+        js_module_cache_dir = strdup(dir);
+    }
+}
+
+static JSModuleDef *js_module_loader_preloaded(JSContext *ctx,
+                                               const char *module_name);
+
 JSModuleDef *js_module_loader(JSContext *ctx,
                               const char *module_name, void *opaque)
 {
@@ -584,13 +959,26 @@ JSModuleDef *js_module_loader(JSContext *ctx,
 
     if (has_suffix(module_name, NATIVE_MODULE_SUFFIX)) {
         m = js_module_loader_so(ctx, module_name);
+    } else if ((m = js_module_loader_preloaded(ctx, module_name)) != NULL) {
+        /* compiled by js_std_preload_modules() */
     } else {
+        JSModuleCacheKey *key;
         size_t buf_len;
         uint8_t *buf;
         JSValue func_val;
+
+        key = js_module_cache_key(module_name);
+        if (key && (m = js_module_loader_cached(ctx, key)) != NULL) {
+            js_module_cache_free_key(key);
+            return m;
+        }
     
-        buf = js_load_file(ctx, &buf_len, module_name);
+        if (key)
+            buf = js_load_file_fp(ctx, &buf_len, key->source);
+        else
+            buf = js_load_file(ctx, &buf_len, module_name);
         if (!buf) {
+            js_module_cache_free_key(key);
             JS_ThrowReferenceError(ctx, "could not load module filename '%s'",
                                    module_name);
             return NULL;
@@ -600,8 +988,16 @@ JSModuleDef *js_module_loader(JSContext *ctx,
         func_val = JS_Eval(ctx, (char *)buf, buf_len, module_name,
                            JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
         js_free(ctx, buf);
-        if (JS_IsException(func_val))
+        if (JS_IsException(func_val)) {
+            js_module_cache_free_key(key);
             return NULL;
+        }
+        if (key) {
+            /* not stored if the source was modified while it was read */
+            if (js_module_cache_source_unchanged(key))
+                js_module_cache_store(ctx, key, func_val);
+            js_module_cache_free_key(key);
+        }
         /* XXX: could propagate the exception */
         js_module_set_import_meta(ctx, func_val, TRUE, FALSE);
         /* the module is already referenced, so we must free it */
@@ -798,11 +1194,14 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
 }
 
 static JSClassID js_std_file_class_id;
+static JSClassID js_std_file_chunk_iterator_class_id;
 
 typedef struct {
     FILE *f;
     BOOL close_in_finalizer;
     BOOL is_popen;
+    char *line_buf; /* reused by getline(), allocated with malloc() */
+    size_t line_buf_size;
 } JSSTDFile;
 
 static void js_std_file_finalizer(JSRuntime *rt, JSValue val)
@@ -815,6 +1214,7 @@ static void js_std_file_finalizer(JSRuntime *rt, JSValue val)
             else
                 fclose(s->f);
         }
+        free(s->line_buf);
         js_free_rt(rt, s);
     }
 }
@@ -1059,6 +1459,9 @@ static JSValue js_std_file_close(JSContext *ctx, JSValueConst this_val,
     else
         err = js_get_errno(fclose(s->f));
     s->f = NULL;
+    free(s->line_buf);
+    s->line_buf = NULL;
+    s->line_buf_size = 0;
     return JS_NewInt32(ctx, err);
 }
 
@@ -1184,11 +1587,11 @@ static JSValue js_std_file_read_write(JSContext *ctx, JSValueConst this_val,
     return JS_NewInt64(ctx, ret);
 }
 
-/* XXX: could use less memory and go faster */
 static JSValue js_std_file_getline(JSContext *ctx, JSValueConst this_val,
                                    int argc, JSValueConst *argv)
 {
     FILE *f = js_std_file_get(ctx, this_val);
+#if defined(_WIN32)
     int c;
     DynBuf dbuf;
     JSValue obj;
@@ -1218,19 +1621,37 @@ static JSValue js_std_file_getline(JSContext *ctx, JSValueConst this_val,
     obj = JS_NewStringLen(ctx, (const char *)dbuf.buf, dbuf.size);
     dbuf_free(&dbuf);
     return obj;
+#else
+    JSSTDFile *s;
+    ssize_t len;
+
+    if (!f)
+        return JS_EXCEPTION;
+    s = JS_GetOpaque(this_val, js_std_file_class_id);
+    /* getline() searches the line feed in the stdio buffer and the
+       line buffer is reused by the next calls */
+    len = getline(&s->line_buf, &s->line_buf_size, f);
+    if (len < 0) {
+        if (ferror(f) && errno == ENOMEM)
+            return JS_ThrowOutOfMemory(ctx);
+        return JS_NULL;
+    }
+    if (len > 0 && s->line_buf[len - 1] == '\n')
+        len--;
+    return JS_NewStringLen(ctx, s->line_buf, len);
+#endif
 }
 
-/* XXX: could use less memory and go faster */
 static JSValue js_std_file_readAsString(JSContext *ctx, JSValueConst this_val,
                                         int argc, JSValueConst *argv)
 {
     FILE *f = js_std_file_get(ctx, this_val);
-    int c;
     DynBuf dbuf;
     JSValue obj;
     uint64_t max_size64;
-    size_t max_size;
+    size_t max_size, len, chunk_size;
     JSValueConst max_size_val;
+    struct stat st;
     
     if (!f)
         return JS_EXCEPTION;
@@ -1248,19 +1669,141 @@ static JSValue js_std_file_readAsString(JSContext *ctx, JSValueConst this_val,
     }
 
     js_std_dbuf_init(ctx, &dbuf);
+    /* a regular file is usually read with a single fread() */
+    if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+        st.st_size > 0 && (uint64_t)st.st_size < max_size) {
+        if (dbuf_realloc(&dbuf, st.st_size + 1))
+            goto fail;
+    }
     while (max_size != 0) {
-        c = fgetc(f);
-        if (c == EOF)
+        if (dbuf.size == dbuf.allocated_size &&
+            dbuf_realloc(&dbuf, dbuf.size + 65536))
+            goto fail;
+        chunk_size = dbuf.allocated_size - dbuf.size;
+        if (chunk_size > max_size)
+            chunk_size = max_size;
+        len = fread(dbuf.buf + dbuf.size, 1, chunk_size, f);
+        if (len == 0)
             break;
-        if (dbuf_putc(&dbuf, c)) {
-            dbuf_free(&dbuf);
-            return JS_EXCEPTION;
-        }
-        max_size--;
+        dbuf.size += len;
+        max_size -= len;
     }
     obj = JS_NewStringLen(ctx, (const char *)dbuf.buf, dbuf.size);
     dbuf_free(&dbuf);
     return obj;
+ fail:
+    dbuf_free(&dbuf);
+    return JS_ThrowOutOfMemory(ctx);
+}
+
+/* Chunk iterator: the chunks are Uint8Arrays on the same ArrayBuffer,
+   so a chunk is only valid until the next one is read */
+typedef struct {
+    JSValue file;
+    JSValue buffer; /* ArrayBuffer */
+    JSValue ctor; /* Uint8Array */
+} JSSTDFileChunkIterator;
+
+static void js_std_file_chunk_iterator_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSSTDFileChunkIterator *it;
+    it = JS_GetOpaque(val, js_std_file_chunk_iterator_class_id);
+    if (it) {
+        JS_FreeValueRT(rt, it->file);
+        JS_FreeValueRT(rt, it->buffer);
+        JS_FreeValueRT(rt, it->ctor);
+        js_free_rt(rt, it);
+    }
+}
+
+static void js_std_file_chunk_iterator_mark(JSRuntime *rt, JSValueConst val,
+                                            JS_MarkFunc *mark_func)
+{
+    JSSTDFileChunkIterator *it;
+    it = JS_GetOpaque(val, js_std_file_chunk_iterator_class_id);
+    if (it) {
+        JS_MarkValue(rt, it->file, mark_func);
+        JS_MarkValue(rt, it->buffer, mark_func);
+        JS_MarkValue(rt, it->ctor, mark_func);
+    }
+}
+
+static JSValue js_std_file_readChunks(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv)
+{
+    FILE *f = js_std_file_get(ctx, this_val);
+    JSSTDFileChunkIterator *it;
+    JSValue obj, global_obj;
+    uint32_t size;
+
+    if (!f)
+        return JS_EXCEPTION;
+    size = 65536;
+    if (argc >= 1 && !JS_IsUndefined(argv[0])) {
+        if (JS_ToUint32(ctx, &size, argv[0]))
+            return JS_EXCEPTION;
+        if (size == 0 || size > INT32_MAX)
+            return JS_ThrowRangeError(ctx, "invalid chunk size");
+    }
+    obj = JS_NewObjectClass(ctx, js_std_file_chunk_iterator_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    it = js_mallocz(ctx, sizeof(*it));
+    if (!it) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    it->file = JS_DupValue(ctx, this_val);
+    it->buffer = JS_UNDEFINED;
+    it->ctor = JS_UNDEFINED;
+    JS_SetOpaque(obj, it);
+    it->buffer = JS_NewArrayBufferCopy(ctx, NULL, size);
+    global_obj = JS_GetGlobalObject(ctx);
+    it->ctor = JS_GetPropertyStr(ctx, global_obj, "Uint8Array");
+    JS_FreeValue(ctx, global_obj);
+    if (JS_IsException(it->buffer) || JS_IsException(it->ctor)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    return obj;
+}
+
+static JSValue js_std_file_chunk_iterator_next(JSContext *ctx,
+                                               JSValueConst this_val,
+                                               int argc, JSValueConst *argv,
+                                               BOOL *pdone, int magic)
+{
+    JSSTDFileChunkIterator *it;
+    JSValue args[3];
+    FILE *f;
+    uint8_t *buf;
+    size_t size, len;
+
+    it = JS_GetOpaque2(ctx, this_val, js_std_file_chunk_iterator_class_id);
+    if (!it)
+        return JS_EXCEPTION;
+    f = js_std_file_get(ctx, it->file);
+    if (!f)
+        return JS_EXCEPTION;
+    buf = JS_GetArrayBuffer(ctx, &size, it->buffer);
+    if (!buf)
+        return JS_EXCEPTION;
+    len = fread(buf, 1, size, f);
+    if (len == 0) {
+        *pdone = TRUE;
+        return JS_UNDEFINED;
+    }
+    *pdone = FALSE;
+    args[0] = it->buffer;
+    args[1] = JS_NewInt32(ctx, 0);
+    args[2] = JS_NewInt64(ctx, len);
+    return JS_CallConstructor(ctx, it->ctor, 3, (JSValueConst *)args);
+}
+
+static JSValue js_std_file_chunk_iterator(JSContext *ctx, JSValueConst this_val,
+                                          int argc, JSValueConst *argv)
+{
+    return JS_DupValue(ctx, this_val);
 }
 
 static JSValue js_std_file_getByte(JSContext *ctx, JSValueConst this_val,
@@ -1471,13 +2014,539 @@ static JSValue js_std_urlGet(JSContext *ctx, JSValueConst this_val,
     return JS_EXCEPTION;
 }
 
-static JSClassDef js_std_file_class = {
-    "FILE",
-    .finalizer = js_std_file_finalizer,
-}; 
+/* Asynchronous I/O: the requests are executed by a process wide pool of
+   threads and completed by js_os_poll(). The threads only use temporary
+   buffers allocated with malloc() so that the ArrayBuffers may be
+   detached or collected while a request is running. The completed
+   requests of a runtime are collected in a list and a single byte is
+   written to its wakeup pipe when the list becomes non empty, so that
+   the promises of all the requests completed since the last poll are
+   resolved at once. Without threads the requests are executed
+   synchronously. */
+
+typedef enum {
+    JS_ASYNC_IO_READ,
+    JS_ASYNC_IO_WRITE,
+    JS_ASYNC_IO_LOAD_FILE,
+} JSAsyncIOType;
+
+typedef struct JSAsyncIORequest {
+    struct list_head link; /* thread pool queue or JSAsyncIOQueue.done_list */
+    struct JSAsyncIOQueue *queue;
+    JSAsyncIOType type;
+    int fd;
+    int64_t pos; /* file position, -1 to use the current one */
+    uint8_t *buf; /* allocated with malloc() */
+    size_t len;
+    char *filename;
+    ssize_t ret; /* byte count or -errno */
+    /* only used by the thread of the runtime */
+    struct list_head js_link; /* JSAsyncIOQueue.pending_list */
+    JSValue resolving_funcs[2];
+    JSValue buffer; /* destination of JS_ASYNC_IO_READ */
+    uint64_t offset;
+} JSAsyncIORequest;
+
+typedef struct JSAsyncIOQueue {
+#ifdef USE_WORKER
+    pthread_mutex_t mutex;
+#endif
+    int ref_count; /* one for the runtime and one per running request */
+    BOOL closed; /* TRUE when the runtime is freed */
+    struct list_head done_list; /* list of JSAsyncIORequest.link */
+    int read_fd; /* wakeup pipe */
+    int write_fd;
+    /* only used by the thread of the runtime */
+    struct list_head pending_list; /* list of JSAsyncIORequest.js_link */
+} JSAsyncIOQueue;
 
-static const JSCFunctionListEntry js_std_error_props[] = {
-    /* various errno values */
+static void js_async_io_free_queue(JSAsyncIOQueue *q)
+{
+#ifdef USE_WORKER
+    int ref_count;
+    pthread_mutex_lock(&q->mutex);
+    ref_count = --q->ref_count;
+    pthread_mutex_unlock(&q->mutex);
+    if (ref_count != 0)
+        return;
+    close(q->read_fd);
+    close(q->write_fd);
+    pthread_mutex_destroy(&q->mutex);
+#else
+    if (--q->ref_count != 0)
+        return;
+#endif
+    free(q);
+}
+
+static void js_async_io_free_request(JSAsyncIORequest *req)
+{
+    JSAsyncIOQueue *q = req->queue;
+    free(req->buf);
+    free(req->filename);
+    free(req);
+    js_async_io_free_queue(q);
+}
+
+/* may be called from any thread */
+static void js_async_io_execute(JSAsyncIORequest *req)
+{
+    ssize_t ret;
+
+    switch(req->type) {
+    case JS_ASYNC_IO_READ:
+#if !defined(_WIN32)
+        if (req->pos >= 0)
+            ret = pread(req->fd, req->buf, req->len, req->pos);
+        else
+#endif
+            ret = read(req->fd, req->buf, req->len);
+        break;
+    case JS_ASYNC_IO_WRITE:
+#if !defined(_WIN32)
+        if (req->pos >= 0)
+            ret = pwrite(req->fd, req->buf, req->len, req->pos);
+        else
+#endif
+            ret = write(req->fd, req->buf, req->len);
+        break;
+    case JS_ASYNC_IO_LOAD_FILE:
+        /* no context: the buffer is allocated with malloc() */
+        req->buf = js_load_file(NULL, &req->len, req->filename);
+        ret = req->buf ? req->len : -1;
+        break;
+    default:
+        abort();
+    }
+    req->ret = js_get_errno(ret);
+}
+
+#ifdef USE_WORKER
+
+#define JS_ASYNC_IO_MAX_THREADS 4
+
+static pthread_mutex_t js_async_io_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t js_async_io_cond = PTHREAD_COND_INITIALIZER;
+static struct list_head js_async_io_requests =
+    LIST_HEAD_INIT(js_async_io_requests);
+static int js_async_io_queued; /* number of requests in js_async_io_requests */
+static int js_async_io_idle; /* number of threads waiting for a request */
+static int js_async_io_threads;
+
+/* add the request to the completed requests of its runtime */
+static void js_async_io_done(JSAsyncIORequest *req)
+{
+    JSAsyncIOQueue *q = req->queue;
+
+    pthread_mutex_lock(&q->mutex);
+    if (q->closed) {
+        pthread_mutex_unlock(&q->mutex);
+        js_async_io_free_request(req);
+        return;
+    }
+    /* indicate that requests are completed */
+    if (list_empty(&q->done_list)) {
+        uint8_t ch = '\0';
+        int ret;
+        for(;;) {
+            ret = write(q->write_fd, &ch, 1);
+            if (ret == 1)
+                break;
+            if (ret < 0 && errno != EAGAIN && errno != EINTR)
+                break;
+        }
+    }
+    list_add_tail(&req->link, &q->done_list);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+static void *js_async_io_worker(void *opaque)
+{
+    JSAsyncIORequest *req;
+
+    pthread_mutex_lock(&js_async_io_mutex);
+    for(;;) {
+        while (list_empty(&js_async_io_requests)) {
+            js_async_io_idle++;
+            pthread_cond_wait(&js_async_io_cond, &js_async_io_mutex);
+            js_async_io_idle--;
+        }
+        req = list_entry(js_async_io_requests.next, JSAsyncIORequest, link);
+        list_del(&req->link);
+        js_async_io_queued--;
+        pthread_mutex_unlock(&js_async_io_mutex);
+
+        js_async_io_execute(req);
+        js_async_io_done(req);
+
+        pthread_mutex_lock(&js_async_io_mutex);
+    }
+    return NULL;
+}
+
+/* return -1 if no thread is available */
+static int js_async_io_submit(JSAsyncIORequest *req)
+{
+    pthread_t tid;
+    pthread_attr_t attr;
+    int ret;
+
+    pthread_mutex_lock(&js_async_io_mutex);
+    if (js_async_io_queued >= js_async_io_idle &&
+        js_async_io_threads < JS_ASYNC_IO_MAX_THREADS) {
+        pthread_attr_init(&attr);
+        /* no join at the end */
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        ret = pthread_create(&tid, &attr, js_async_io_worker, NULL);
+        pthread_attr_destroy(&attr);
+        if (ret == 0)
+            js_async_io_threads++;
+    }
+    if (js_async_io_threads == 0) {
+        pthread_mutex_unlock(&js_async_io_mutex);
+        return -1;
+    }
+    list_add_tail(&req->link, &js_async_io_requests);
+    js_async_io_queued++;
+    pthread_cond_signal(&js_async_io_cond);
+    pthread_mutex_unlock(&js_async_io_mutex);
+    return 0;
+}
+
+#endif /* USE_WORKER */
+
+static JSAsyncIOQueue *js_async_io_get_queue(JSContext *ctx)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSAsyncIOQueue *q;
+
+    if (ts->async_io)
+        return ts->async_io;
+    q = malloc(sizeof(*q));
+    if (!q) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    memset(q, 0, sizeof(*q));
+    q->ref_count = 1;
+    init_list_head(&q->done_list);
+    init_list_head(&q->pending_list);
+    q->read_fd = -1;
+    q->write_fd = -1;
+#ifdef USE_WORKER
+    {
+        int pipe_fds[2];
+        if (pipe(pipe_fds) < 0) {
+            free(q);
+            JS_ThrowTypeError(ctx, "could not create the wakeup pipe");
+            return NULL;
+        }
+        q->read_fd = pipe_fds[0];
+        q->write_fd = pipe_fds[1];
+        pthread_mutex_init(&q->mutex, NULL);
+    }
+#ifdef USE_EPOLL
+    {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.u64 = q->read_fd;
+        if (ts->epoll_fd >= 0 &&
+            epoll_ctl(ts->epoll_fd, EPOLL_CTL_ADD, q->read_fd, &ev) < 0) {
+            js_async_io_free_queue(q);
+            JS_ThrowTypeError(ctx, "could not poll the wakeup pipe");
+            return NULL;
+        }
+    }
+#endif
+#endif
+    ts->async_io = q;
+    return q;
+}
+
+/* resolve the promise of a completed request and free it */
+static void js_async_io_complete(JSContext *ctx, JSAsyncIORequest *req)
+{
+    JSValue val, ret;
+    BOOL is_reject;
+    uint8_t *buf;
+    size_t size;
+
+    list_del(&req->js_link);
+    is_reject = FALSE;
+    switch(req->type) {
+    case JS_ASYNC_IO_READ:
+        if (req->ret > 0) {
+            /* the array buffer may have been detached or resized */
+            buf = JS_GetArrayBuffer(ctx, &size, req->buffer);
+            if (!buf) {
+                val = JS_GetException(ctx);
+                is_reject = TRUE;
+                break;
+            }
+            if (req->offset + req->ret > size) {
+                JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+                val = JS_GetException(ctx);
+                is_reject = TRUE;
+                break;
+            }
+            memcpy(buf + req->offset, req->buf, req->ret);
+        }
+        val = JS_NewInt64(ctx, req->ret);
+        break;
+    case JS_ASYNC_IO_WRITE:
+        val = JS_NewInt64(ctx, req->ret);
+        break;
+    case JS_ASYNC_IO_LOAD_FILE:
+        if (req->buf)
+            val = JS_NewStringLen(ctx, (char *)req->buf, req->len);
+        else
+            val = JS_NULL;
+        if (JS_IsException(val)) {
+            val = JS_GetException(ctx);
+            is_reject = TRUE;
+        }
+        break;
+    default:
+        abort();
+    }
+    ret = JS_Call(ctx, req->resolving_funcs[is_reject], JS_UNDEFINED,
+                  1, (JSValueConst *)&val);
+    JS_FreeValue(ctx, val);
+    if (JS_IsException(ret))
+        js_std_dump_error(ctx);
+    else
+        JS_FreeValue(ctx, ret);
+    JS_FreeValue(ctx, req->resolving_funcs[0]);
+    JS_FreeValue(ctx, req->resolving_funcs[1]);
+    JS_FreeValue(ctx, req->buffer);
+    js_async_io_free_request(req);
+}
+
+#ifdef USE_WORKER
+/* complete all the requests executed since the last call. Return TRUE
+   if a promise was resolved. */
+static BOOL js_async_io_poll(JSContext *ctx, JSAsyncIOQueue *q)
+{
+    struct list_head done_list, *el, *el1;
+
+    init_list_head(&done_list);
+    pthread_mutex_lock(&q->mutex);
+    if (!list_empty(&q->done_list)) {
+        uint8_t ch;
+        int ret;
+        for(;;) {
+            ret = read(q->read_fd, &ch, 1);
+            if (ret >= 0)
+                break;
+            if (errno != EAGAIN && errno != EINTR)
+                break;
+        }
+        /* move the list */
+        done_list = q->done_list;
+        done_list.next->prev = &done_list;
+        done_list.prev->next = &done_list;
+        init_list_head(&q->done_list);
+    }
+    pthread_mutex_unlock(&q->mutex);
+    if (list_empty(&done_list))
+        return FALSE;
+    list_for_each_safe(el, el1, &done_list) {
+        JSAsyncIORequest *req = list_entry(el, JSAsyncIORequest, link);
+        js_async_io_complete(ctx, req);
+    }
+    return TRUE;
+}
+#endif
+
+static BOOL js_async_io_pending(JSThreadState *ts)
+{
+    return ts->async_io && !list_empty(&ts->async_io->pending_list);
+}
+
+static void js_free_async_io(JSRuntime *rt, JSAsyncIOQueue *q)
+{
+    struct list_head free_list, *el, *el1;
+
+    list_for_each(el, &q->pending_list) {
+        JSAsyncIORequest *req = list_entry(el, JSAsyncIORequest, js_link);
+        JS_FreeValueRT(rt, req->resolving_funcs[0]);
+        JS_FreeValueRT(rt, req->resolving_funcs[1]);
+        JS_FreeValueRT(rt, req->buffer);
+    }
+    init_list_head(&free_list);
+#ifdef USE_WORKER
+    /* cancel the requests which are not running. The running ones are
+       freed by the thread pool. */
+    pthread_mutex_lock(&js_async_io_mutex);
+    list_for_each_safe(el, el1, &js_async_io_requests) {
+        JSAsyncIORequest *req = list_entry(el, JSAsyncIORequest, link);
+        if (req->queue == q) {
+            list_del(&req->link);
+            list_add_tail(&req->link, &free_list);
+            js_async_io_queued--;
+        }
+    }
+    pthread_mutex_unlock(&js_async_io_mutex);
+
+    pthread_mutex_lock(&q->mutex);
+    q->closed = TRUE;
+    list_for_each_safe(el, el1, &q->done_list) {
+        list_del(el);
+        list_add_tail(el, &free_list);
+    }
+    pthread_mutex_unlock(&q->mutex);
+#endif
+    list_for_each_safe(el, el1, &free_list) {
+        JSAsyncIORequest *req = list_entry(el, JSAsyncIORequest, link);
+        js_async_io_free_request(req);
+    }
+    js_async_io_free_queue(q);
+}
+
+/* return a promise or JS_EXCEPTION. 'req' is freed in all cases. */
+static JSValue js_async_io_start(JSContext *ctx, JSAsyncIORequest *req)
+{
+    JSAsyncIOQueue *q;
+    JSValue promise;
+
+    q = js_async_io_get_queue(ctx);
+    if (!q)
+        goto fail;
+    promise = JS_NewPromiseCapability(ctx, req->resolving_funcs);
+    if (JS_IsException(promise))
+        goto fail;
+    req->queue = q;
+#ifdef USE_WORKER
+    pthread_mutex_lock(&q->mutex);
+    q->ref_count++;
+    pthread_mutex_unlock(&q->mutex);
+#else
+    q->ref_count++;
+#endif
+    list_add_tail(&req->js_link, &q->pending_list);
+#ifdef USE_WORKER
+    if (js_async_io_submit(req) == 0)
+        return promise;
+#endif
+    js_async_io_execute(req);
+    js_async_io_complete(ctx, req);
+    return promise;
+ fail:
+    JS_FreeValue(ctx, req->buffer);
+    free(req->buf);
+    free(req->filename);
+    free(req);
+    return JS_EXCEPTION;
+}
+
+static JSAsyncIORequest *js_async_io_new_request(JSContext *ctx,
+                                                 JSAsyncIOType type)
+{
+    JSAsyncIORequest *req;
+
+    req = malloc(sizeof(*req));
+    if (!req) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    memset(req, 0, sizeof(*req));
+    req->type = type;
+    req->fd = -1;
+    req->pos = -1;
+    req->resolving_funcs[0] = JS_UNDEFINED;
+    req->resolving_funcs[1] = JS_UNDEFINED;
+    req->buffer = JS_UNDEFINED;
+    return req;
+}
+
+/* load a file as a UTF-8 encoded string without blocking */
+static JSValue js_std_loadFileAsync(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSAsyncIORequest *req;
+    const char *filename;
+
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename)
+        return JS_EXCEPTION;
+    req = js_async_io_new_request(ctx, JS_ASYNC_IO_LOAD_FILE);
+    if (req) {
+        req->filename = strdup(filename);
+        if (!req->filename) {
+            free(req);
+            req = NULL;
+            JS_ThrowOutOfMemory(ctx);
+        }
+    }
+    JS_FreeCString(ctx, filename);
+    if (!req)
+        return JS_EXCEPTION;
+    return js_async_io_start(ctx, req);
+}
+
+static JSValue js_os_read_write_async(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv, int magic)
+{
+    JSAsyncIORequest *req;
+    int fd;
+    int64_t file_pos;
+    uint64_t pos, len;
+    size_t size;
+    uint8_t *buf;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &pos, argv[2]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &len, argv[3]))
+        return JS_EXCEPTION;
+    file_pos = -1;
+    if (argc > 4 && !JS_IsUndefined(argv[4])) {
+        if (JS_ToInt64Ext(ctx, &file_pos, argv[4]))
+            return JS_EXCEPTION;
+        if (file_pos < 0)
+            return JS_ThrowRangeError(ctx, "invalid file position");
+    }
+    buf = JS_GetArrayBuffer(ctx, &size, argv[1]);
+    if (!buf)
+        return JS_EXCEPTION;
+    if (pos + len > size)
+        return JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+    req = js_async_io_new_request(ctx, magic ? JS_ASYNC_IO_WRITE :
+                                  JS_ASYNC_IO_READ);
+    if (!req)
+        return JS_EXCEPTION;
+    req->fd = fd;
+    req->pos = file_pos;
+    req->len = len;
+    req->buf = malloc(len != 0 ? len : 1);
+    if (!req->buf) {
+        free(req);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    if (magic) {
+        memcpy(req->buf, buf + pos, len);
+    } else {
+        req->buffer = JS_DupValue(ctx, argv[1]);
+        req->offset = pos;
+    }
+    return js_async_io_start(ctx, req);
+}
+
+static JSClassDef js_std_file_class = {
+    "FILE",
+    .finalizer = js_std_file_finalizer,
+}; 
+
+static JSClassDef js_std_file_chunk_iterator_class = {
+    "FILE Chunk Iterator",
+    .finalizer = js_std_file_chunk_iterator_finalizer,
+    .gc_mark = js_std_file_chunk_iterator_mark,
+};
+
+static const JSCFunctionListEntry js_std_error_props[] = {
+    /* various errno values */
 #define DEF(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
     DEF(EINVAL),
     DEF(EIO),
@@ -1504,6 +2573,7 @@ static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("getenviron", 1, js_std_getenviron ),
     JS_CFUNC_DEF("urlGet", 1, js_std_urlGet ),
     JS_CFUNC_DEF("loadFile", 1, js_std_loadFile ),
+    JS_CFUNC_DEF("loadFileAsync", 1, js_std_loadFileAsync ),
     JS_CFUNC_DEF("strerror", 1, js_std_strerror ),
     JS_CFUNC_DEF("parseExtJSON", 1, js_std_parseExtJSON ),
     
@@ -1537,11 +2607,18 @@ static const JSCFunctionListEntry js_std_file_proto_funcs[] = {
     JS_CFUNC_MAGIC_DEF("write", 3, js_std_file_read_write, 1 ),
     JS_CFUNC_DEF("getline", 0, js_std_file_getline ),
     JS_CFUNC_DEF("readAsString", 0, js_std_file_readAsString ),
+    JS_CFUNC_DEF("readChunks", 0, js_std_file_readChunks ),
     JS_CFUNC_DEF("getByte", 0, js_std_file_getByte ),
     JS_CFUNC_DEF("putByte", 1, js_std_file_putByte ),
     /* setvbuf, ...  */
 };
 
+static const JSCFunctionListEntry js_std_file_chunk_iterator_proto_funcs[] = {
+    JS_ITERATOR_NEXT_DEF("next", 0, js_std_file_chunk_iterator_next, 0 ),
+    JS_CFUNC_DEF("[Symbol.iterator]", 0, js_std_file_chunk_iterator ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "FILE Chunk Iterator", JS_PROP_CONFIGURABLE ),
+};
+
 static int js_std_init(JSContext *ctx, JSModuleDef *m)
 {
     JSValue proto;
@@ -1556,6 +2633,14 @@ static int js_std_init(JSContext *ctx, JSModuleDef *m)
                                countof(js_std_file_proto_funcs));
     JS_SetClassProto(ctx, js_std_file_class_id, proto);
 
+    JS_NewClassID(&js_std_file_chunk_iterator_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), js_std_file_chunk_iterator_class_id,
+                &js_std_file_chunk_iterator_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, js_std_file_chunk_iterator_proto_funcs,
+                               countof(js_std_file_chunk_iterator_proto_funcs));
+    JS_SetClassProto(ctx, js_std_file_chunk_iterator_class_id, proto);
+
     JS_SetModuleExportList(ctx, m, js_std_funcs,
                            countof(js_std_funcs));
     JS_SetModuleExport(ctx, m, "in", js_new_std_file(ctx, stdin, FALSE, FALSE));
@@ -1836,6 +2921,102 @@ static BOOL is_main_thread(JSRuntime *rt)
     return !ts->recv_pipe;
 }
 
+#ifdef USE_EPOLL
+
+static JSOSFdEntry *get_fd_entry(JSRuntime *rt, JSThreadState *ts, int fd)
+{
+    if (fd >= ts->fd_tab_size) {
+        JSOSFdEntry *tab;
+        int new_size = max_int(fd + 1, ts->fd_tab_size * 3 / 2);
+        tab = js_realloc_rt(rt, ts->fd_tab, sizeof(tab[0]) * new_size);
+        if (!tab)
+            return NULL;
+        memset(tab + ts->fd_tab_size, 0,
+               sizeof(tab[0]) * (new_size - ts->fd_tab_size));
+        ts->fd_tab = tab;
+        ts->fd_tab_size = new_size;
+    }
+    return &ts->fd_tab[fd];
+}
+
+/* update the epoll registration of 'fd' from its read/write handler
+   and the worker ports using it. Return -1 if not enough memory. */
+static int os_poll_update_fd(JSRuntime *rt, JSThreadState *ts, int fd)
+{
+    JSOSFdEntry *e;
+    JSOSRWHandler *rh;
+    struct epoll_event ev;
+    struct list_head *el;
+    uint32_t events;
+    int ret;
+
+    /* the select() loop computes the fd sets at each iteration */
+    if (ts->epoll_fd < 0)
+        return 0;
+    e = get_fd_entry(rt, ts, fd);
+    if (!e)
+        return -1;
+    events = 0;
+    rh = e->rh;
+    if (rh) {
+        if (!JS_IsNull(rh->rw_func[0]))
+            events |= EPOLLIN;
+        if (!JS_IsNull(rh->rw_func[1]))
+            events |= EPOLLOUT;
+    }
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (port->recv_pipe->read_fd == fd &&
+            !JS_IsNull(port->on_message_func))
+            events |= EPOLLIN;
+    }
+
+    if (e->no_epoll) {
+        /* regular files are always ready as with select() */
+        if (events == 0) {
+            e->no_epoll = FALSE;
+            ts->no_epoll_count--;
+        }
+        e->events = events;
+        return 0;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.u64 = fd | ((uint64_t)e->gen << 32);
+    if (events == 0) {
+        if (e->events != 0) {
+            /* may fail if the fd was already closed */
+            epoll_ctl(ts->epoll_fd, EPOLL_CTL_DEL, fd, &ev);
+        }
+    } else {
+        ret = -1;
+        if (e->events != 0) {
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_MOD, fd, &ev);
+            /* the fd may have been closed and reused */
+        }
+        if (ret < 0)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+        if (ret < 0 && errno == EEXIST)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_MOD, fd, &ev);
+        if (ret < 0) {
+            e->no_epoll = TRUE;
+            ts->no_epoll_count++;
+        }
+    }
+    e->events = events;
+    return 0;
+}
+
+static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
+{
+    if (fd < ts->fd_tab_size)
+        return ts->fd_tab[fd].rh;
+    else
+        return NULL;
+}
+
+#else
+
 static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
 {
     JSOSRWHandler *rh;
@@ -1849,9 +3030,15 @@ static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
     return NULL;
 }
 
+#endif /* !USE_EPOLL */
+
 static void free_rw_handler(JSRuntime *rt, JSOSRWHandler *rh)
 {
     int i;
+#ifdef USE_EPOLL
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    ts->fd_tab[rh->fd].rh = NULL;
+#endif
     list_del(&rh->link);
     for(i = 0; i < 2; i++) {
         JS_FreeValueRT(rt, rh->rw_func[i]);
@@ -1870,6 +3057,8 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
     
     if (JS_ToInt32(ctx, &fd, argv[0]))
         return JS_EXCEPTION;
+    if (fd < 0)
+        return JS_ThrowRangeError(ctx, "invalid file descriptor");
     func = argv[1];
     if (JS_IsNull(func)) {
         rh = find_rh(ts, fd);
@@ -1887,6 +3076,11 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
             return JS_ThrowTypeError(ctx, "not a function");
         rh = find_rh(ts, fd);
         if (!rh) {
+#ifdef USE_EPOLL
+            JSOSFdEntry *e = get_fd_entry(rt, ts, fd);
+            if (!e)
+                return JS_ThrowOutOfMemory(ctx);
+#endif
             rh = js_mallocz(ctx, sizeof(*rh));
             if (!rh)
                 return JS_EXCEPTION;
@@ -1894,10 +3088,19 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
             rh->rw_func[0] = JS_NULL;
             rh->rw_func[1] = JS_NULL;
             list_add_tail(&rh->link, &ts->os_rw_handlers);
+#ifdef USE_EPOLL
+            e->rh = rh;
+            /* ignore the pending events of a previous handler */
+            e->gen++;
+#endif
         }
         JS_FreeValue(ctx, rh->rw_func[magic]);
         rh->rw_func[magic] = JS_DupValue(ctx, func);
     }
+#ifdef USE_EPOLL
+    if (os_poll_update_fd(rt, ts, fd))
+        return JS_ThrowOutOfMemory(ctx);
+#endif
     return JS_UNDEFINED;
 }
 
@@ -1993,28 +3196,109 @@ static int64_t get_time_ms(void)
 }
 #endif
 
-static void unlink_timer(JSRuntime *rt, JSOSTimer *th)
+/* timer heap */
+
+static inline BOOL timer_lt(const JSOSTimer *a, const JSOSTimer *b)
 {
-    if (th->link.prev) {
-        list_del(&th->link);
-        th->link.prev = th->link.next = NULL;
-    }
+    /* the timers with the same timeout are called in creation order */
+    return a->timeout < b->timeout ||
+        (a->timeout == b->timeout && a->seq < b->seq);
 }
 
-static void free_timer(JSRuntime *rt, JSOSTimer *th)
+static inline void timer_heap_set(JSThreadState *ts, int idx, JSOSTimer *th)
 {
-    JS_FreeValueRT(rt, th->func);
-    js_free_rt(rt, th);
+    ts->timer_heap[idx] = th;
+    th->heap_idx = idx;
 }
 
-static JSClassID js_os_timer_class_id;
-
-static void js_os_timer_finalizer(JSRuntime *rt, JSValue val)
+static void timer_heap_up(JSThreadState *ts, int idx)
 {
-    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
-    if (th) {
-        th->has_object = FALSE;
-        if (!th->link.prev)
+    JSOSTimer *th = ts->timer_heap[idx];
+    int parent;
+
+    while (idx > 0) {
+        parent = (idx - 1) / 2;
+        if (!timer_lt(th, ts->timer_heap[parent]))
+            break;
+        timer_heap_set(ts, idx, ts->timer_heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(ts, idx, th);
+}
+
+static void timer_heap_down(JSThreadState *ts, int idx)
+{
+    JSOSTimer *th = ts->timer_heap[idx];
+    int child;
+
+    for(;;) {
+        child = idx * 2 + 1;
+        if (child >= ts->timer_count)
+            break;
+        if (child + 1 < ts->timer_count &&
+            timer_lt(ts->timer_heap[child + 1], ts->timer_heap[child]))
+            child++;
+        if (!timer_lt(ts->timer_heap[child], th))
+            break;
+        timer_heap_set(ts, idx, ts->timer_heap[child]);
+        idx = child;
+    }
+    timer_heap_set(ts, idx, th);
+}
+
+static int link_timer(JSRuntime *rt, JSOSTimer *th)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+
+    if (ts->timer_count >= ts->timer_size) {
+        JSOSTimer **heap;
+        int new_size = max_int(16, ts->timer_size * 3 / 2);
+        heap = js_realloc_rt(rt, ts->timer_heap, sizeof(heap[0]) * new_size);
+        if (!heap)
+            return -1;
+        ts->timer_heap = heap;
+        ts->timer_size = new_size;
+    }
+    th->seq = ts->timer_seq++;
+    timer_heap_set(ts, ts->timer_count++, th);
+    timer_heap_up(ts, th->heap_idx);
+    return 0;
+}
+
+static void unlink_timer(JSRuntime *rt, JSOSTimer *th)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *last;
+    int idx;
+
+    idx = th->heap_idx;
+    if (idx >= 0) {
+        th->heap_idx = -1;
+        last = ts->timer_heap[--ts->timer_count];
+        if (last != th) {
+            timer_heap_set(ts, idx, last);
+            if (idx > 0 && timer_lt(last, ts->timer_heap[(idx - 1) / 2]))
+                timer_heap_up(ts, idx);
+            else
+                timer_heap_down(ts, idx);
+        }
+    }
+}
+
+static void free_timer(JSRuntime *rt, JSOSTimer *th)
+{
+    JS_FreeValueRT(rt, th->func);
+    js_free_rt(rt, th);
+}
+
+static JSClassID js_os_timer_class_id;
+
+static void js_os_timer_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
+    if (th) {
+        th->has_object = FALSE;
+        if (th->heap_idx < 0)
             free_timer(rt, th);
     }
 }
@@ -2032,7 +3316,6 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
                                 int argc, JSValueConst *argv)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int64_t delay;
     JSValueConst func;
     JSOSTimer *th;
@@ -2054,8 +3337,12 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
     th->has_object = TRUE;
     th->timeout = get_time_ms() + delay;
     th->func = JS_DupValue(ctx, func);
-    list_add_tail(&th->link, &ts->os_timers);
+    th->heap_idx = -1;
     JS_SetOpaque(obj, th);
+    if (link_timer(rt, th)) {
+        JS_FreeValue(ctx, obj);
+        return JS_ThrowOutOfMemory(ctx);
+    }
     return obj;
 }
 
@@ -2088,6 +3375,58 @@ static void call_handler(JSContext *ctx, JSValueConst func)
     JS_FreeValue(ctx, ret);
 }
 
+static void js_std_execute_pending_jobs(JSContext *ctx)
+{
+    JSContext *ctx1;
+
+    JS_ExecutePendingJobs(JS_GetRuntime(ctx), -1, 0, &ctx1);
+    if (ctx1)
+        js_std_dump_error(ctx1);
+}
+
+/* call the expired timers. The pending jobs are executed between two
+   timers. Return 0 if at least one timer was called, otherwise the
+   delay in ms until the next timer or -1 if there is no timer. */
+static int run_timers(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    int64_t cur_time;
+    uint64_t seq_end;
+    JSOSTimer *th;
+    JSValue func;
+    BOOL called;
+
+    if (ts->timer_count == 0)
+        return -1;
+    cur_time = get_time_ms();
+    /* the timers created by the handlers are called at the next poll */
+    seq_end = ts->timer_seq;
+    called = FALSE;
+    while (ts->timer_count > 0) {
+        th = ts->timer_heap[0];
+        if (th->timeout > cur_time) {
+            if (called)
+                break;
+            return min_int64(th->timeout - cur_time, INT32_MAX);
+        }
+        if (th->seq >= seq_end)
+            break;
+        if (called)
+            js_std_execute_pending_jobs(ctx);
+        /* the timer expired */
+        func = th->func;
+        th->func = JS_UNDEFINED;
+        unlink_timer(rt, th);
+        if (!th->has_object)
+            free_timer(rt, th);
+        call_handler(ctx, func);
+        JS_FreeValue(ctx, func);
+        called = TRUE;
+    }
+    return called ? 0 : -1;
+}
+
 #if defined(_WIN32)
 
 static int js_os_poll(JSContext *ctx)
@@ -2095,40 +3434,19 @@ static int js_os_poll(JSContext *ctx)
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int min_delay, console_fd;
-    int64_t cur_time, delay;
     JSOSRWHandler *rh;
     struct list_head *el;
     
     /* XXX: handle signals if useful */
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers))
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0 &&
+        !js_async_io_pending(ts))
         return -1; /* no more events */
     
     /* XXX: only timers and basic console input are supported */
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-    } else {
-        min_delay = -1;
-    }
+    min_delay = run_timers(ctx);
+    if (min_delay == 0)
+        return 0;
 
     console_fd = -1;
     list_for_each(el, &ts->os_rw_handlers) {
@@ -2201,8 +3519,9 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
 
         pthread_mutex_unlock(&ps->mutex);
 
-        data_obj = JS_ReadObject(ctx, msg->data, msg->data_len,
-                                 JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE);
+        data_obj = JS_ReadObject3(ctx, msg->data, msg->data_len,
+                                  JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                                  NULL, msg->transfer_tab, msg->transfer_len);
 
         js_free_message(msg);
         
@@ -2242,23 +3561,16 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
 }
 #endif
 
-static int js_os_poll(JSContext *ctx)
+/* return 0 if a signal handler was called */
+static int handle_pending_signals(JSContext *ctx, JSThreadState *ts)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int ret, fd_max, min_delay;
-    int64_t cur_time, delay;
-    fd_set rfds, wfds;
-    JSOSRWHandler *rh;
+    JSOSSignalHandler *sh;
     struct list_head *el;
-    struct timeval tv, *tvp;
+    uint64_t mask;
 
     /* only check signals in the main thread */
     if (!ts->recv_pipe &&
         unlikely(os_pending_signals != 0)) {
-        JSOSSignalHandler *sh;
-        uint64_t mask;
-        
         list_for_each(el, &ts->os_signal_handlers) {
             sh = list_entry(el, JSOSSignalHandler, link);
             mask = (uint64_t)1 << sh->sig_num;
@@ -2269,32 +3581,130 @@ static int js_os_poll(JSContext *ctx)
             }
         }
     }
+    return -1;
+}
+
+#ifdef USE_EPOLL
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
-        list_empty(&ts->port_list))
+/* call the handlers of 'fd' for the events 'revents'. Return TRUE if
+   a handler was called. */
+static BOOL os_poll_dispatch(JSContext *ctx, JSThreadState *ts, int fd,
+                             uint32_t gen, uint32_t revents, BOOL called)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSOSFdEntry *e;
+    JSOSRWHandler *rh;
+    struct list_head *el;
+
+    /* the handlers may have been modified by the previous handlers */
+#define GET_RH() (fd < ts->fd_tab_size && ts->fd_tab[fd].gen == gen ? \
+                  ts->fd_tab[fd].rh : NULL)
+    rh = GET_RH();
+    if (rh && !JS_IsNull(rh->rw_func[0]) &&
+        (revents & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+        if (called)
+            js_std_execute_pending_jobs(ctx);
+        call_handler(ctx, rh->rw_func[0]);
+        called = TRUE;
+    }
+    rh = GET_RH();
+    if (rh && !JS_IsNull(rh->rw_func[1]) &&
+        (revents & (EPOLLOUT | EPOLLHUP | EPOLLERR))) {
+        if (called)
+            js_std_execute_pending_jobs(ctx);
+        call_handler(ctx, rh->rw_func[1]);
+        called = TRUE;
+    }
+#undef GET_RH
+    e = &ts->fd_tab[fd];
+    if (e->gen == gen && (revents & EPOLLIN)) {
+        list_for_each(el, &ts->port_list) {
+            JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+            if (port->recv_pipe->read_fd == fd &&
+                !JS_IsNull(port->on_message_func)) {
+                if (called)
+                    js_std_execute_pending_jobs(ctx);
+                if (handle_posted_message(rt, ctx, port))
+                    called = TRUE;
+                /* must stop because the list may have been modified */
+                break;
+            }
+        }
+    }
+    return called;
+}
+
+static int js_os_poll_epoll(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    struct epoll_event events[64];
+    int i, n, fd, timeout;
+    BOOL called;
+
+    if (handle_pending_signals(ctx, ts) == 0)
+        return 0;
+
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0 &&
+        list_empty(&ts->port_list) && !js_async_io_pending(ts))
         return -1; /* no more events */
-    
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
+
+    timeout = run_timers(ctx);
+    if (timeout == 0)
+        return 0;
+    /* the fds not supported by epoll are always ready */
+    if (ts->no_epoll_count > 0)
+        timeout = 0;
+
+    n = epoll_wait(ts->epoll_fd, events, countof(events), timeout);
+    /* all the ready handlers are called before polling again */
+    called = FALSE;
+    for(i = 0; i < n; i++) {
+        fd = (uint32_t)events[i].data.u64;
+        if (ts->async_io && fd == ts->async_io->read_fd) {
+            if (js_async_io_poll(ctx, ts->async_io))
+                called = TRUE;
+            continue;
+        }
+        called = os_poll_dispatch(ctx, ts, fd, events[i].data.u64 >> 32,
+                                  events[i].events, called);
+    }
+    if (ts->no_epoll_count > 0) {
+        for(fd = 0; fd < ts->fd_tab_size; fd++) {
+            JSOSFdEntry *e = &ts->fd_tab[fd];
+            if (e->no_epoll) {
+                called = os_poll_dispatch(ctx, ts, fd, e->gen, e->events,
+                                          called);
             }
         }
+    }
+    return 0;
+}
+
+#endif /* USE_EPOLL */
+
+/* also used with epoll when the epoll instance could not be created */
+static int js_os_poll_select(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    int ret, fd_max, min_delay;
+    fd_set rfds, wfds;
+    JSOSRWHandler *rh;
+    struct list_head *el;
+    struct timeval tv, *tvp;
+
+    if (handle_pending_signals(ctx, ts) == 0)
+        return 0;
+
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0 &&
+        list_empty(&ts->port_list) && !js_async_io_pending(ts))
+        return -1; /* no more events */
+    
+    min_delay = run_timers(ctx);
+    if (min_delay == 0)
+        return 0;
+    if (min_delay > 0) {
         tv.tv_sec = min_delay / 1000;
         tv.tv_usec = (min_delay % 1000) * 1000;
         tvp = &tv;
@@ -2323,6 +3733,11 @@ static int js_os_poll(JSContext *ctx)
         }
     }
 
+    if (ts->async_io) {
+        fd_max = max_int(fd_max, ts->async_io->read_fd);
+        FD_SET(ts->async_io->read_fd, &rfds);
+    }
+
     ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
     if (ret > 0) {
         list_for_each(el, &ts->os_rw_handlers) {
@@ -2351,10 +3766,24 @@ static int js_os_poll(JSContext *ctx)
                 }
             }
         }
+
+        if (ts->async_io && FD_ISSET(ts->async_io->read_fd, &rfds))
+            js_async_io_poll(ctx, ts->async_io);
     }
     done:
     return 0;
 }
+
+static int js_os_poll(JSContext *ctx)
+{
+#ifdef USE_EPOLL
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    if (ts->epoll_fd >= 0)
+        return js_os_poll_epoll(ctx);
+#endif
+    return js_os_poll_select(ctx);
+}
+
 #endif /* !_WIN32 */
 
 static JSValue make_obj_error(JSContext *ctx,
@@ -3254,6 +4683,11 @@ static void js_free_message(JSWorkerMessage *msg)
         js_sab_free(NULL, msg->sab_tab[i]);
     }
     free(msg->sab_tab);
+    /* free the transferred ArrayBuffers which were not used */
+    for(i = 0; i < msg->transfer_len; i++) {
+        free(msg->transfer_tab[i].data);
+    }
+    free(msg->transfer_tab);
     free(msg->data);
     free(msg);
 }
@@ -3284,9 +4718,17 @@ static void js_free_message_pipe(JSWorkerMessagePipe *ps)
 static void js_free_port(JSRuntime *rt, JSWorkerMessageHandler *port)
 {
     if (port) {
+        list_del(&port->link);
+#ifdef USE_EPOLL
+        {
+            JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+            /* 'ts' is NULL if the handlers were already freed */
+            if (ts)
+                os_poll_update_fd(rt, ts, port->recv_pipe->read_fd);
+        }
+#endif
         js_free_message_pipe(port->recv_pipe);
         JS_FreeValueRT(rt, port->on_message_func);
-        list_del(&port->link);
         js_free_rt(rt, port);
     }
 }
@@ -3385,17 +4827,63 @@ static JSValue js_worker_ctor_internal(JSContext *ctx, JSValueConst new_target,
     return JS_EXCEPTION;
 }
 
-static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
-                              int argc, JSValueConst *argv)
+/* start a worker thread running the module 'filename'. The thread
+   gets a new reference to the pipes. */
+static int js_worker_start(JSContext *ctx, const char *filename,
+                           const char *basename,
+                           JSWorkerMessagePipe *recv_pipe,
+                           JSWorkerMessagePipe *send_pipe)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    WorkerFuncArgs *args = NULL;
+    WorkerFuncArgs *args;
     pthread_t tid;
     pthread_attr_t attr;
-    JSValue obj = JS_UNDEFINED;
     int ret;
+
+    args = malloc(sizeof(*args));
+    if (!args)
+        goto oom_fail;
+    memset(args, 0, sizeof(*args));
+    args->filename = strdup(filename);
+    args->basename = strdup(basename);
+    if (!args->filename || !args->basename)
+        goto oom_fail;
+    args->recv_pipe = js_dup_message_pipe(recv_pipe);
+    args->send_pipe = js_dup_message_pipe(send_pipe);
+
+    pthread_attr_init(&attr);
+    /* no join at the end */
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    ret = pthread_create(&tid, &attr, worker_func, args);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        JS_ThrowTypeError(ctx, "could not create worker");
+        goto fail;
+    }
+    return 0;
+ oom_fail:
+    JS_ThrowOutOfMemory(ctx);
+ fail:
+    if (args) {
+        free(args->filename);
+        free(args->basename);
+        js_free_message_pipe(args->recv_pipe);
+        js_free_message_pipe(args->send_pipe);
+        free(args);
+    }
+    return -1;
+}
+
+/* create a Worker object whose messages are processed by
+   'thread_count' threads running the module 'argv[0]' */
+static JSValue js_worker_ctor2(JSContext *ctx, JSValueConst new_target,
+                               JSValueConst filename_val, int thread_count)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSWorkerMessagePipe *recv_pipe = NULL, *send_pipe = NULL;
+    JSValue obj = JS_UNDEFINED;
     const char *filename = NULL, *basename;
     JSAtom basename_atom;
+    int i;
     
     /* XXX: in order to avoid problems with resource liberation, we
        don't support creating workers inside workers */
@@ -3414,58 +4902,66 @@ static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
         goto fail;
     
     /* module name */
-    filename = JS_ToCString(ctx, argv[0]);
+    filename = JS_ToCString(ctx, filename_val);
     if (!filename)
         goto fail;
 
-    args = malloc(sizeof(*args));
-    if (!args)
+    /* ports. All the threads of a pool share the same pipes: a
+       message is processed by the first idle thread. */
+    recv_pipe = js_new_message_pipe();
+    if (!recv_pipe)
         goto oom_fail;
-    memset(args, 0, sizeof(*args));
-    args->filename = strdup(filename);
-    args->basename = strdup(basename);
-
-    /* ports */
-    args->recv_pipe = js_new_message_pipe();
-    if (!args->recv_pipe)
-        goto oom_fail;
-    args->send_pipe = js_new_message_pipe();
-    if (!args->send_pipe)
+    send_pipe = js_new_message_pipe();
+    if (!send_pipe)
         goto oom_fail;
 
-    obj = js_worker_ctor_internal(ctx, new_target,
-                                  args->send_pipe, args->recv_pipe);
+    obj = js_worker_ctor_internal(ctx, new_target, send_pipe, recv_pipe);
     if (JS_IsException(obj))
         goto fail;
-    
-    pthread_attr_init(&attr);
-    /* no join at the end */
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
-    ret = pthread_create(&tid, &attr, worker_func, args);
-    pthread_attr_destroy(&attr);
-    if (ret != 0) {
-        JS_ThrowTypeError(ctx, "could not create worker");
-        goto fail;
+
+    for(i = 0; i < thread_count; i++) {
+        if (js_worker_start(ctx, filename, basename, recv_pipe, send_pipe))
+            goto fail;
     }
+    js_free_message_pipe(recv_pipe);
+    js_free_message_pipe(send_pipe);
     JS_FreeCString(ctx, basename);
     JS_FreeCString(ctx, filename);
     return obj;
  oom_fail:
     JS_ThrowOutOfMemory(ctx);
  fail:
+    js_free_message_pipe(recv_pipe);
+    js_free_message_pipe(send_pipe);
     JS_FreeCString(ctx, basename);
     JS_FreeCString(ctx, filename);
-    if (args) {
-        free(args->filename);
-        free(args->basename);
-        js_free_message_pipe(args->recv_pipe);
-        js_free_message_pipe(args->send_pipe);
-        free(args);
-    }
     JS_FreeValue(ctx, obj);
     return JS_EXCEPTION;
 }
 
+static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
+                              int argc, JSValueConst *argv)
+{
+    return js_worker_ctor2(ctx, new_target, argv[0], 1);
+}
+
+/* WorkerPool(filename, [thread_count]) */
+static JSValue js_worker_pool_ctor(JSContext *ctx, JSValueConst new_target,
+                                   int argc, JSValueConst *argv)
+{
+    int32_t thread_count;
+
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32(ctx, &thread_count, argv[1]))
+            return JS_EXCEPTION;
+        if (thread_count < 1 || thread_count > 1024)
+            return JS_ThrowRangeError(ctx, "invalid thread count");
+    } else {
+        thread_count = max_int(sysconf(_SC_NPROCESSORS_ONLN), 1);
+    }
+    return js_worker_ctor2(ctx, new_target, argv[0], thread_count);
+}
+
 static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
                                      int argc, JSValueConst *argv)
 {
@@ -3475,36 +4971,76 @@ static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
     uint8_t *data;
     JSWorkerMessage *msg;
     uint8_t **sab_tab;
+    JSValue *transfer_list = NULL;
+    int64_t transfer_len = 0;
     
     if (!worker)
         return JS_EXCEPTION;
-    
-    data = JS_WriteObject2(ctx, &data_len, argv[0],
-                           JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE,
-                           &sab_tab, &sab_tab_len);
-    if (!data)
-        return JS_EXCEPTION;
 
     msg = malloc(sizeof(*msg));
     if (!msg)
-        goto fail;
-    msg->data = NULL;
-    msg->sab_tab = NULL;
+        return JS_ThrowOutOfMemory(ctx);
+    memset(msg, 0, sizeof(*msg));
 
-    /* must reallocate because the allocator may be different */
-    msg->data = malloc(data_len);
-    if (!msg->data)
+    /* optional list of the ArrayBuffers to transfer */
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        JSValue val;
+        int ret;
+        val = JS_GetPropertyStr(ctx, argv[1], "length");
+        if (JS_IsException(val))
+            goto fail;
+        ret = JS_ToInt64(ctx, &transfer_len, val);
+        JS_FreeValue(ctx, val);
+        if (ret)
+            goto fail;
+        if (transfer_len < 0 || transfer_len > INT32_MAX) {
+            JS_ThrowRangeError(ctx, "invalid transfer list length");
+            goto fail;
+        }
+    }
+    if (transfer_len > 0) {
+        transfer_list = js_mallocz(ctx, sizeof(transfer_list[0]) * transfer_len);
+        if (!transfer_list)
+            goto fail;
+        for(i = 0; i < transfer_len; i++) {
+            transfer_list[i] = JS_GetPropertyUint32(ctx, argv[1], i);
+            if (JS_IsException(transfer_list[i]))
+                goto fail;
+        }
+        msg->transfer_tab = calloc(transfer_len, sizeof(msg->transfer_tab[0]));
+        if (!msg->transfer_tab) {
+            JS_ThrowOutOfMemory(ctx);
+            goto fail;
+        }
+    }
+
+    /* the message is directly allocated with malloc() because the
+       runtime allocator may be different in the receiving thread */
+    data = JS_WriteObject3(ctx, &data_len, argv[0],
+                           JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE |
+                           JS_WRITE_OBJ_MALLOC, &sab_tab, &sab_tab_len,
+                           transfer_list, transfer_len, msg->transfer_tab);
+    if (!data)
         goto fail;
-    memcpy(msg->data, data, data_len);
+    msg->data = data;
     msg->data_len = data_len;
+    msg->transfer_len = transfer_len;
+
+    if (transfer_list) {
+        for(i = 0; i < transfer_len; i++)
+            JS_FreeValue(ctx, transfer_list[i]);
+        js_free(ctx, transfer_list);
+    }
 
     msg->sab_tab = malloc(sizeof(msg->sab_tab[0]) * sab_tab_len);
-    if (!msg->sab_tab)
-        goto fail;
+    if (!msg->sab_tab) {
+        js_free(ctx, sab_tab);
+        js_free_message(msg);
+        return JS_ThrowOutOfMemory(ctx);
+    }
     memcpy(msg->sab_tab, sab_tab, sizeof(msg->sab_tab[0]) * sab_tab_len);
     msg->sab_tab_len = sab_tab_len;
 
-    js_free(ctx, data);
     js_free(ctx, sab_tab);
     
     /* increment the SAB reference counts */
@@ -3530,15 +5066,14 @@ static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
     pthread_mutex_unlock(&ps->mutex);
     return JS_UNDEFINED;
  fail:
-    if (msg) {
-        free(msg->data);
-        free(msg->sab_tab);
-        free(msg);
+    if (transfer_list) {
+        for(i = 0; i < transfer_len; i++)
+            JS_FreeValue(ctx, transfer_list[i]);
+        js_free(ctx, transfer_list);
     }
-    js_free(ctx, data);
-    js_free(ctx, sab_tab);
+    free(msg->transfer_tab);
+    free(msg);
     return JS_EXCEPTION;
-    
 }
 
 static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
@@ -3572,6 +5107,10 @@ static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
         }
         JS_FreeValue(ctx, port->on_message_func);
         port->on_message_func = JS_DupValue(ctx, func);
+#ifdef USE_EPOLL
+        if (os_poll_update_fd(rt, ts, port->recv_pipe->read_fd))
+            return JS_ThrowOutOfMemory(ctx);
+#endif
     }
     return JS_UNDEFINED;
 }
@@ -3591,7 +5130,7 @@ static JSValue js_worker_get_onmessage(JSContext *ctx, JSValueConst this_val)
 }
 
 static const JSCFunctionListEntry js_worker_proto_funcs[] = {
-    JS_CFUNC_DEF("postMessage", 1, js_worker_postMessage ),
+    JS_CFUNC_DEF("postMessage", 2, js_worker_postMessage ),
     JS_CGETSET_DEF("onmessage", js_worker_get_onmessage, js_worker_set_onmessage ),
 };
 
@@ -3604,6 +5143,409 @@ void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt))
 #endif
 }
 
+/* Parallel module loading: the static import graph of a module is
+   discovered by scanning the sources and the modules are compiled to
+   bytecode by a pool of threads, each with its own runtime. The main
+   thread only reads the bytecode and links it when js_module_loader() is
+   called for these modules. */
+
+typedef struct JSPreloadedModule {
+    struct list_head link; /* JSModulePreloader.modules */
+    uint32_t hash;
+    BOOL compile; /* FALSE for the root modules, evaluated from source */
+    uint8_t *bytecode; /* allocated with malloc(), NULL if not compiled */
+    size_t bytecode_len;
+    char name[0];
+} JSPreloadedModule;
+
+typedef struct JSModulePreloader {
+#ifdef USE_WORKER
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+#endif
+    /* discovered modules, the ones from 'next' are not compiled yet */
+    struct list_head modules;
+    struct list_head *next;
+    int busy; /* number of modules being compiled */
+} JSModulePreloader;
+
+static uint32_t js_preload_hash(const char *name)
+{
+    uint32_t h = 0;
+    while (*name)
+        h = h * 263 + (uint8_t)*name++;
+    return h;
+}
+
+static JSPreloadedModule *js_preload_find(JSModulePreloader *pl,
+                                          const char *name, uint32_t hash)
+{
+    struct list_head *el;
+    list_for_each(el, &pl->modules) {
+        JSPreloadedModule *pm = list_entry(el, JSPreloadedModule, link);
+        if (pm->hash == hash && !strcmp(pm->name, name))
+            return pm;
+    }
+    return NULL;
+}
+
+static void js_free_module_preloader(JSModulePreloader *pl)
+{
+    struct list_head *el, *el1;
+
+    list_for_each_safe(el, el1, &pl->modules) {
+        JSPreloadedModule *pm = list_entry(el, JSPreloadedModule, link);
+        free(pm->bytecode);
+        free(pm);
+    }
+#ifdef USE_WORKER
+    pthread_mutex_destroy(&pl->mutex);
+    pthread_cond_destroy(&pl->cond);
+#endif
+    free(pl);
+}
+
+static JSModuleDef *js_module_loader_preloaded(JSContext *ctx,
+                                               const char *module_name)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSPreloadedModule *pm;
+    JSValue obj;
+    JSModuleDef *m;
+
+    if (!ts || !ts->module_preloader)
+        return NULL;
+    pm = js_preload_find(ts->module_preloader, module_name,
+                         js_preload_hash(module_name));
+    if (!pm || !pm->bytecode)
+        return NULL;
+    obj = JS_ReadObject(ctx, pm->bytecode, pm->bytecode_len,
+                        JS_READ_OBJ_BYTECODE);
+    /* the bytecode is used once */
+    free(pm->bytecode);
+    pm->bytecode = NULL;
+    if (JS_IsException(obj)) {
+        /* compiled again from source */
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return NULL;
+    }
+    js_module_set_import_meta(ctx, obj, TRUE, FALSE);
+    m = JS_VALUE_GET_PTR(obj);
+    JS_FreeValue(ctx, obj);
+    return m;
+}
+
+#ifdef USE_WORKER
+
+/* must be called with the mutex locked */
+static void js_preload_add(JSModulePreloader *pl, const char *name,
+                           BOOL compile)
+{
+    JSPreloadedModule *pm;
+    uint32_t hash;
+    size_t len;
+
+    if (has_suffix(name, NATIVE_MODULE_SUFFIX))
+        return;
+    hash = js_preload_hash(name);
+    if (js_preload_find(pl, name, hash))
+        return;
+    len = strlen(name);
+    pm = malloc(sizeof(*pm) + len + 1);
+    if (!pm)
+        return;
+    pm->hash = hash;
+    pm->compile = compile;
+    pm->bytecode = NULL;
+    pm->bytecode_len = 0;
+    memcpy(pm->name, name, len + 1);
+    list_add_tail(&pm->link, &pl->modules);
+    if (pl->next == &pl->modules)
+        pl->next = &pm->link;
+}
+
+typedef struct {
+    JSModulePreloader *pl;
+    JSContext *ctx;
+    const char *base_name;
+} JSPreloadScan;
+
+static void js_preload_import(JSPreloadScan *sc, const char *spec, size_t len)
+{
+    char buf[PATH_MAX];
+    char *name;
+
+    if (len == 0 || len >= sizeof(buf))
+        return;
+    memcpy(buf, spec, len);
+    buf[len] = '\0';
+    name = JS_NormalizeModuleName(sc->ctx, sc->base_name, buf);
+    if (!name) {
+        JS_FreeValue(sc->ctx, JS_GetException(sc->ctx));
+        return;
+    }
+    pthread_mutex_lock(&sc->pl->mutex);
+    js_preload_add(sc->pl, name, TRUE);
+    pthread_cond_broadcast(&sc->pl->cond);
+    pthread_mutex_unlock(&sc->pl->mutex);
+    js_free(sc->ctx, name);
+}
+
+static BOOL js_preload_is_ident(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '_' || c == '$' || c >= 0x80;
+}
+
+/* Fast scan of the static imports of a module source: 'import "m"',
+   'import ... from "m"', 'export ... from "m"' and 'import("m")'.
+   Comments, strings, templates and regexps are skipped. Unusual code may
+   make it miss or invent an import: the module is then compiled by the
+   main thread or for nothing. */
+static void js_preload_scan(JSPreloadScan *sc, const char *p, const char *end)
+{
+    enum { SCAN_NONE, SCAN_IMPORT, SCAN_FROM } state = SCAN_NONE;
+    int last = '('; /* last significant character, '(' if a regexp may follow */
+    const char *q;
+    int c;
+
+    while (p < end) {
+        c = (uint8_t)*p;
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            p++;
+        } else if (c == '/' && p + 1 < end && p[1] == '/') {
+            while (p < end && *p != '\n')
+                p++;
+        } else if (c == '/' && p + 1 < end && p[1] == '*') {
+            for (p += 2; p + 1 < end && !(p[0] == '*' && p[1] == '/'); p++)
+                continue;
+            p += 2;
+        } else if (c == '"' || c == '\'' || c == '`' ||
+                   (c == '/' && strchr("(,=:[!&|?{};+-*%<>~^", last))) {
+            /* string, template or regexp literal */
+            BOOL escaped = FALSE, in_class = FALSE;
+            for (q = p + 1; q < end; q++) {
+                if (*q == '\\') {
+                    escaped = TRUE;
+                    q++;
+                } else if (c == '/' && *q == '[') {
+                    in_class = TRUE;
+                } else if (c == '/' && *q == ']') {
+                    in_class = FALSE;
+                } else if (*q == c && !in_class) {
+                    break;
+                } else if (*q == '\n' && c != '`') {
+                    break;
+                }
+            }
+            if (c != '/' && c != '`' && state != SCAN_NONE && !escaped && q < end)
+                js_preload_import(sc, p + 1, q - (p + 1));
+            p = q + 1;
+            last = '"';
+            state = SCAN_NONE;
+        } else if (js_preload_is_ident(c)) {
+            for (q = p; q < end && js_preload_is_ident((uint8_t)*q); q++)
+                continue;
+#define IS_WORD(w) (q - p == sizeof(w) - 1 && !memcmp(p, w, sizeof(w) - 1))
+            if (IS_WORD("import") && last != '.') {
+                state = SCAN_IMPORT;
+            } else if (IS_WORD("from") && state != SCAN_NONE) {
+                state = SCAN_FROM;
+            } else if (state == SCAN_FROM) {
+                state = SCAN_NONE;
+            }
+            /* a regexp may follow these keywords */
+            if (IS_WORD("return") || IS_WORD("typeof") || IS_WORD("case") ||
+                IS_WORD("do") || IS_WORD("else") || IS_WORD("in") ||
+                IS_WORD("of") || IS_WORD("new") || IS_WORD("delete") ||
+                IS_WORD("void") || IS_WORD("throw") || IS_WORD("yield") ||
+                IS_WORD("await") || IS_WORD("instanceof"))
+                last = '(';
+            else
+                last = 'a';
+#undef IS_WORD
+            p = q;
+        } else {
+            /* 'import(' keeps the state for dynamic imports, the
+               punctuation of the import clause too */
+            if (!(state == SCAN_IMPORT && strchr("({},*", c)))
+                state = SCAN_NONE;
+            last = c;
+            p++;
+        }
+    }
+}
+
+static void *js_preload_worker(void *opaque)
+{
+    JSModulePreloader *pl = opaque;
+    JSPreloadedModule *pm;
+    JSPreloadScan sc;
+    JSModuleCacheKey *key;
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    uint8_t *buf, *bc;
+    size_t buf_len, bc_len;
+
+    rt = JS_NewRuntime();
+    if (!rt)
+        return NULL;
+    js_std_init_handlers(rt);
+    /* same context options as the workers (e.g. bignum extensions) */
+    if (js_worker_new_context_func) {
+        ctx = js_worker_new_context_func(rt);
+    } else {
+        ctx = JS_NewContextRaw(rt);
+        if (ctx) {
+            /* what the compiler needs */
+            JS_AddIntrinsicBaseObjects(ctx);
+            JS_AddIntrinsicEval(ctx);
+            JS_AddIntrinsicRegExpCompiler(ctx);
+#ifdef CONFIG_BIGNUM
+            JS_AddIntrinsicBigInt(ctx);
+#endif
+        }
+    }
+    if (!ctx)
+        goto done;
+    sc.pl = pl;
+    sc.ctx = ctx;
+
+    pthread_mutex_lock(&pl->mutex);
+    for(;;) {
+        while (pl->next == &pl->modules && pl->busy != 0)
+            pthread_cond_wait(&pl->cond, &pl->mutex);
+        if (pl->next == &pl->modules)
+            break;
+        pm = list_entry(pl->next, JSPreloadedModule, link);
+        pl->next = pl->next->next;
+        pl->busy++;
+        pthread_mutex_unlock(&pl->mutex);
+
+        bc = NULL;
+        bc_len = 0;
+        key = pm->compile ? js_module_cache_key(pm->name) : NULL;
+        if (key) {
+            bc = js_module_cache_read(key, &bc_len);
+            buf = js_load_file_fp(ctx, &buf_len, key->source);
+        } else {
+            buf = js_load_file(ctx, &buf_len, pm->name);
+        }
+        if (buf) {
+            sc.base_name = pm->name;
+            js_preload_scan(&sc, (const char *)buf, (const char *)buf + buf_len);
+            if (pm->compile && !bc) {
+                val = JS_Eval(ctx, (char *)buf, buf_len, pm->name,
+                              JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY |
+                              JS_EVAL_FLAG_NO_RESOLVE);
+                if (!JS_IsException(val)) {
+                    uint8_t *out = JS_WriteObject(ctx, &bc_len, val,
+                                                  JS_WRITE_OBJ_BYTECODE);
+                    if (out) {
+                        bc = malloc(bc_len);
+                        if (bc)
+                            memcpy(bc, out, bc_len);
+                        if (key && js_module_cache_source_unchanged(key))
+                            js_module_cache_write(key, out, bc_len);
+                        js_free(ctx, out);
+                    }
+                    JS_FreeValue(ctx, val);
+                }
+                /* errors are reported when the main thread compiles it */
+                JS_FreeValue(ctx, JS_GetException(ctx));
+            }
+            js_free(ctx, buf);
+        }
+        js_module_cache_free_key(key);
+
+        pthread_mutex_lock(&pl->mutex);
+        pm->bytecode = bc;
+        pm->bytecode_len = bc ? bc_len : 0;
+        if (--pl->busy == 0)
+            pthread_cond_broadcast(&pl->cond);
+    }
+    pthread_mutex_unlock(&pl->mutex);
+    JS_FreeContext(ctx);
+ done:
+    js_std_free_handlers(rt);
+    JS_FreeRuntime(rt);
+    return NULL;
+}
+
+#endif /* USE_WORKER */
+
+/* Compile the modules statically imported (directly or not) by the module
+   'filename' on 'n_threads' threads. js_module_loader() then reads their
+   bytecode instead of compiling them. 'filename' itself is not compiled.
+   The default module name normalizer is assumed. Return the number of
+   compiled modules or -1 if error. */
+int js_std_preload_modules(JSContext *ctx, const char *filename, int n_threads)
+{
+#ifdef USE_WORKER
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSModulePreloader *pl;
+    pthread_t tid[64];
+    struct list_head *el;
+    int i, n;
+
+    pl = ts->module_preloader;
+    if (!pl) {
+        pl = malloc(sizeof(*pl));
+        if (!pl)
+            return -1;
+        pthread_mutex_init(&pl->mutex, NULL);
+        pthread_cond_init(&pl->cond, NULL);
+        init_list_head(&pl->modules);
+        pl->next = &pl->modules;
+        pl->busy = 0;
+        ts->module_preloader = pl;
+    }
+    js_preload_add(pl, filename, FALSE);
+
+    n_threads = max_int(1, min_int(n_threads, countof(tid)));
+    for(n = 0; n < n_threads; n++) {
+        if (pthread_create(&tid[n], NULL, js_preload_worker, pl) != 0)
+            break;
+    }
+    if (n == 0)
+        return -1;
+    for(i = 0; i < n; i++)
+        pthread_join(tid[i], NULL);
+
+    n = 0;
+    list_for_each(el, &pl->modules) {
+        if (list_entry(el, JSPreloadedModule, link)->bytecode)
+            n++;
+    }
+    return n;
+#else
+    return 0;
+#endif
+}
+
+/* Compile the module 'filename' and the modules it statically imports
+   into the module cache (see js_std_set_module_cache()) without
+   evaluating them. The modules are compiled on 'n_threads' threads if
+   'n_threads' > 1. Return 0 if OK or -1 if exception. */
+int js_std_warm_module_cache(JSContext *ctx, const char *filename,
+                             int n_threads)
+{
+    JSModuleDef *m;
+
+    if (!js_module_cache_dir) {
+        JS_ThrowTypeError(ctx, "module cache is not enabled");
+        return -1;
+    }
+    if (n_threads > 1)
+        js_std_preload_modules(ctx, filename, n_threads);
+    m = js_module_loader(ctx, filename, NULL);
+    if (!m)
+        return -1;
+    /* load the imported modules which are not compiled yet */
+    return JS_ResolveModule(ctx, JS_MKPTR(JS_TAG_MODULE, m));
+}
+
 #if defined(_WIN32)
 #define OS_PLATFORM "win32"
 #elif defined(__APPLE__)
@@ -3633,6 +5575,8 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     JS_CFUNC_DEF("seek", 3, js_os_seek ),
     JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
     JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
+    JS_CFUNC_MAGIC_DEF("readAsync", 4, js_os_read_write_async, 0 ),
+    JS_CFUNC_MAGIC_DEF("writeAsync", 4, js_os_read_write_async, 1 ),
     JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
     JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
     JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
@@ -3731,6 +5675,14 @@ static int js_os_init(JSContext *ctx, JSModuleDef *m)
         }
         
         JS_SetModuleExport(ctx, m, "Worker", obj);
+
+        /* WorkerPool class: same API as Worker */
+        proto = JS_NewObjectProto(ctx, proto);
+        obj = JS_NewCFunction2(ctx, js_worker_pool_ctor, "WorkerPool", 1,
+                               JS_CFUNC_constructor, 0);
+        JS_SetConstructor(ctx, obj, proto);
+        JS_FreeValue(ctx, proto);
+        JS_SetModuleExport(ctx, m, "WorkerPool", obj);
     }
 #endif /* USE_WORKER */
 
@@ -3747,6 +5699,7 @@ JSModuleDef *js_init_module_os(JSContext *ctx, const char *module_name)
     JS_AddModuleExportList(ctx, m, js_os_funcs, countof(js_os_funcs));
 #ifdef USE_WORKER
     JS_AddModuleExport(ctx, m, "Worker");
+    JS_AddModuleExport(ctx, m, "WorkerPool");
 #endif
     return m;
 }
@@ -3815,8 +5768,11 @@ void js_std_init_handlers(JSRuntime *rt)
     memset(ts, 0, sizeof(*ts));
     init_list_head(&ts->os_rw_handlers);
     init_list_head(&ts->os_signal_handlers);
-    init_list_head(&ts->os_timers);
     init_list_head(&ts->port_list);
+#ifdef USE_EPOLL
+    /* fall back to select() if it fails (e.g. too many open files) */
+    ts->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+#endif
 
     JS_SetRuntimeOpaque(rt, ts);
 
@@ -3848,12 +5804,19 @@ void js_std_free_handlers(JSRuntime *rt)
         free_sh(rt, sh);
     }
     
-    list_for_each_safe(el, el1, &ts->os_timers) {
-        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+    while (ts->timer_count > 0) {
+        JSOSTimer *th = ts->timer_heap[0];
         unlink_timer(rt, th);
         if (!th->has_object)
             free_timer(rt, th);
     }
+    js_free_rt(rt, ts->timer_heap);
+
+#ifdef USE_EPOLL
+    js_free_rt(rt, ts->fd_tab);
+    if (ts->epoll_fd >= 0)
+        close(ts->epoll_fd);
+#endif
 
 #ifdef USE_WORKER
     /* XXX: free port_list ? */
@@ -3861,6 +5824,11 @@ void js_std_free_handlers(JSRuntime *rt)
     js_free_message_pipe(ts->send_pipe);
 #endif
 
+    if (ts->module_preloader)
+        js_free_module_preloader(ts->module_preloader);
+    if (ts->async_io)
+        js_free_async_io(rt, ts->async_io);
+
     free(ts);
     JS_SetRuntimeOpaque(rt, NULL); /* fail safe */
 }
@@ -3916,20 +5884,9 @@ void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
 /* main loop which calls the user JS callbacks */
 void js_std_loop(JSContext *ctx)
 {
-    JSContext *ctx1;
-    int err;
-
     for(;;) {
         /* execute the pending jobs */
-        for(;;) {
-            err = JS_ExecutePendingJob(JS_GetRuntime(ctx), &ctx1);
-            if (err <= 0) {
-                if (err < 0) {
-                    js_std_dump_error(ctx1);
-                }
-                break;
-            }
-        }
+        js_std_execute_pending_jobs(ctx);
 
         if (!os_poll_func || os_poll_func(ctx))
             break;
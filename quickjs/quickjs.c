@@ -51,6 +51,20 @@
 #ifdef CONFIG_BIGNUM
 #include "libbf.h"
 #endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define HAVE_SSE2
+#include <emmintrin.h>
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+/* AVX2 versions of some functions are selected at run time */
+#define HAVE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define HAVE_NEON
+#include <arm_neon.h>
+#endif
 
 #define OPTIMIZE         1
 #define SHORT_OPCODES    1
@@ -242,16 +256,41 @@ typedef struct {
 } JSNumericOperations;
 #endif
 
+/* open addressing atom hash table entry. Empty entries have atom = 0
+   and deleted entries have atom = 0 and hash = JS_ATOM_HASH_DELETED. The
+   hash is duplicated here so that probing does not touch the atoms. */
+typedef struct JSAtomHashEntry {
+    uint32_t hash;
+    uint32_t atom;
+} JSAtomHashEntry;
+
+#define JS_ATOM_HASH_DELETED 0xffffffff
+
+typedef struct JSRegExpCacheEntry {
+    struct list_head link; /* JSRuntime.regexp_cache_lru, most recent first */
+    struct JSRegExpCacheEntry *hash_next;
+    uint32_t hash;
+    int re_flags;
+    JSString *pattern;
+    JSString *bytecode;
+} JSRegExpCacheEntry;
+
+/* default limits of the compiled RegExp cache */
+#define JS_REGEXP_CACHE_MAX_COUNT 256
+#define JS_REGEXP_CACHE_MAX_SIZE  (1024 * 1024)
+
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
     const char *rt_info;
 
     int atom_hash_size; /* power of two */
+    int atom_hash_count; /* number of live entries in atom_hash */
+    int atom_hash_used; /* number of live and deleted entries in atom_hash */
     int atom_count;
     int atom_size;
-    int atom_count_resize; /* resize hash table at this count */
-    uint32_t *atom_hash;
+    int atom_count_resize; /* resize hash table at this used count */
+    JSAtomHashEntry *atom_hash;
     JSAtomStruct **atom_array;
     int atom_free_index; /* 0 = none */
 
@@ -288,12 +327,15 @@ struct JSRuntime {
     void *host_promise_rejection_tracker_opaque;
 
     struct list_head job_list; /* list of JSJobEntry.link */
+    struct list_head job_free_list; /* recycled JSJobEntry of JS_JOB_POOL_ARGS arguments */
+    int job_free_count;
 
     JSModuleNormalizeFunc *module_normalize_func;
     JSModuleLoaderFunc *module_loader_func;
     void *module_loader_opaque;
 
     BOOL can_block : 8; /* TRUE if Atomics.wait can block */
+    BOOL lazy_compilation : 8; /* see JS_SetLazyCompilation() */
     /* used to allocate, free and clone SharedArrayBuffers */
     JSSharedArrayBufferFunctions sab_funcs;
 
@@ -302,6 +344,19 @@ struct JSRuntime {
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+
+    /* compiled RegExp cache keyed by (pattern, flags). It is shared
+       by all the contexts since the bytecode is context independent. */
+    struct list_head regexp_cache_lru; /* list of JSRegExpCacheEntry.link */
+    JSRegExpCacheEntry **regexp_cache_hash;
+    int regexp_cache_hash_bits;
+    int regexp_cache_count;
+    int regexp_cache_max_count; /* 0 = cache disabled */
+    size_t regexp_cache_size; /* in bytes */
+    size_t regexp_cache_max_size;
+    int64_t regexp_cache_hits;
+    int64_t regexp_cache_misses;
+    JSRuntimeStats stats; /* counters, see JS_GetRuntimeStats() */
 #ifdef CONFIG_BIGNUM
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
@@ -320,11 +375,13 @@ struct JSClass {
     JSClassCall *call;
     /* pointers for exotic behavior, can be NULL if none are present */
     const JSClassExoticMethods *exotic;
+    int64_t obj_count; /* number of live objects of this class */
 };
 
 #define JS_MODE_STRICT (1 << 0)
 #define JS_MODE_STRIP  (1 << 1)
 #define JS_MODE_MATH   (1 << 2)
+#define JS_MODE_LAZY   (1 << 3) /* nested functions are compiled when first called */
 
 typedef struct JSStackFrame {
     struct JSStackFrame *prev_frame; /* NULL if first stack frame */
@@ -507,7 +564,7 @@ struct JSString {
        XXX: could change encoding to have one more bit in hash */
     uint32_t hash : 30;
     uint8_t atom_type : 2; /* != 0 if atom, JS_ATOM_TYPE_x */
-    uint32_t hash_next; /* atom_index for JS_ATOM_TYPE_SYMBOL */
+    uint32_t hash_next; /* atom_index if atom */
 #ifdef DUMP_LEAKS
     struct list_head link; /* string list */
 #endif
@@ -595,6 +652,23 @@ typedef enum JSFunctionKindEnum {
     JS_FUNC_ASYNC_GENERATOR = (JS_FUNC_GENERATOR | JS_FUNC_ASYNC),
 } JSFunctionKindEnum;
 
+/* Atoms of the bytecode read from a read only buffer
+   (JS_READ_OBJ_ROM_DATA). The bytecode of the functions is used in
+   place and contains the atom indexes of the buffer: it is copied and
+   relocated when the function is first called, unless the indexes are
+   the atoms. The map is shared by the functions of the buffer and
+   'free_func' is called when the last one is freed. */
+typedef struct JSAtomMap {
+    int ref_count;
+    BOOL identity; /* the atom indexes are the atoms */
+    uint32_t first_atom;
+    uint32_t count;
+    const uint8_t *buf;
+    JSFreeArrayBufferDataFunc *free_func;
+    void *opaque;
+    JSAtom atoms[0];
+} JSAtomMap;
+
 typedef struct JSFunctionBytecode {
     JSGCObjectHeader header; /* must come first */
     uint8_t js_mode;
@@ -611,7 +685,16 @@ typedef struct JSFunctionBytecode {
     uint8_t has_debug : 1;
     uint8_t backtrace_barrier : 1; /* stop backtrace on this function */
     uint8_t read_only_bytecode : 1;
-    /* XXX: 4 bits available */
+    /* lazy function: only the closure variables are resolved, the
+       function is compiled from debug.source when it is first called
+       and the result is stored in cpool[0] */
+    uint8_t is_lazy : 1;
+    uint8_t is_func_expr : 1; /* lazy function only */
+    uint8_t is_module_code : 1; /* lazy function only */
+    /* debug.pc2line_buf and debug.source are not allocated separately */
+    uint8_t inline_debug : 1;
+    /* the read only bytecode must be relocated before it is executed */
+    uint8_t atom_reloc_pending : 1;
     uint8_t *byte_code_buf; /* (self pointer) */
     int byte_code_len;
     JSAtom func_name;
@@ -625,6 +708,7 @@ typedef struct JSFunctionBytecode {
     JSValue *cpool; /* constant pool (self pointer) */
     int cpool_count;
     int closure_var_count;
+    JSAtomMap *atom_map; /* read only bytecode only */
     struct {
         /* debug info, move to separate structure to save memory? */
         JSAtom filename;
@@ -883,14 +967,36 @@ struct JSPersitentBlock {
   struct JSStorage* storage;
   uint32_t oid; /* dybase object id */
   JS_PERSISTENT_STATUS status;
+  JSObject* obj; /* owner, not referenced */
+  struct list_head dirty_link; /* in storage dirty list while status == JS_PERSISTENT_MODIFIED */
 };
 
 int js_load_persistent_object(JSContext *ctx, JSValueConst obj);
 int js_free_persistent_object(JSRuntime *rt, JSValueConst obj);
+struct list_head* js_storage_dirty_list(struct JSStorage* pst);
 
+/* maintains the invariant: the block is linked in its storage dirty list
+   iff its status is JS_PERSISTENT_MODIFIED */
+static inline void js_persistent_block_set_status(struct JSPersitentBlock* pb, JS_PERSISTENT_STATUS status)
+{
+  if (status == pb->status)
+    return;
+  if (pb->status == JS_PERSISTENT_MODIFIED)
+    list_del(&pb->dirty_link);
+  else if (status == JS_PERSISTENT_MODIFIED)
+    list_add_tail(&pb->dirty_link, js_storage_dirty_list(pb->storage));
+  pb->status = status;
+}
+
+/* a dormant object has no properties yet: load it before it gets modified,
+   otherwise the next commit would store it truncated */
 #define MARK_MODIFIED_OBJ(p) \
-  if (p->persistent) \
-    p->persistent->status = JS_PERSISTENT_MODIFIED;
+  if (p->persistent && p->persistent->status != JS_PERSISTENT_MODIFIED) { \
+    if (p->persistent->status == JS_PERSISTENT_DORMANT) \
+      js_load_persistent_object(ctx, JS_MKPTR(JS_TAG_OBJECT, p)); \
+    if (p->persistent) \
+      js_persistent_block_set_status(p->persistent, JS_PERSISTENT_MODIFIED); \
+  }
 
 #define MARK_MODIFIED_VALUE(obj) \
   if (JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT) { \
@@ -1056,6 +1162,9 @@ static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
+static JSValue js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b);
+static int js_relocate_bytecode(JSContext *ctx, JSFunctionBytecode *b);
+static void js_atom_map_free(JSRuntime *rt, JSAtomMap *map);
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
                                   int argc, JSValueConst *argv, int flags);
@@ -1154,6 +1263,7 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags);
 static JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
                                               JSValue pattern, JSValue bc);
+static void js_regexp_cache_free(JSRuntime *rt);
 static void gc_decref(JSRuntime *rt);
 static int JS_NewClass1(JSRuntime *rt, JSClassID class_id,
                         const JSClassDef *class_def, JSAtom name);
@@ -1225,6 +1335,8 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
                                             JSFreeArrayBufferDataFunc *free_func,
                                             void *opaque, BOOL alloc_flag);
 static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj);
+static void js_array_buffer_free(JSRuntime *rt, void *opaque, void *ptr);
+static void js_array_buffer_free_malloc(JSRuntime *rt, void *opaque, void *ptr);
 static JSValue js_typed_array_constructor(JSContext *ctx,
                                           JSValueConst this_val,
                                           int argc, JSValueConst *argv,
@@ -1259,6 +1371,10 @@ static __exception int perform_promise_then(JSContext *ctx,
                                             JSValueConst *cap_resolving_funcs);
 static JSValue js_promise_resolve(JSContext *ctx, JSValueConst this_val,
                                   int argc, JSValueConst *argv, int magic);
+static JSValue js_promise_then(JSContext *ctx, JSValueConst this_val,
+                               int argc, JSValueConst *argv);
+static JSValue promise_reaction_job(JSContext *ctx, int argc,
+                                    JSValueConst *argv);
 static int js_string_compare(JSContext *ctx,
                              const JSString *p1, const JSString *p2);
 static JSValue JS_ToNumber(JSContext *ctx, JSValueConst val);
@@ -1316,6 +1432,12 @@ static JSClassID js_class_id_alloc = JS_CLASS_INIT_COUNT;
 static void js_trigger_gc(JSRuntime *rt, size_t size)
 {
     BOOL force_gc;
+#ifdef CONFIG_STORAGE
+    /* persistent objects are stored from free_object(): never start a
+       GC cycle while objects are being freed */
+    if (rt->gc_phase != JS_GC_PHASE_NONE)
+        return;
+#endif
 #ifdef FORCE_GC_AT_MALLOC
     force_gc = TRUE;
 #else
@@ -1340,6 +1462,8 @@ static size_t js_malloc_usable_size_unknown(const void *ptr)
 
 void *js_malloc_rt(JSRuntime *rt, size_t size)
 {
+    rt->stats.alloc_count++;
+    rt->stats.alloc_size += size;
     return rt->mf.js_malloc(&rt->malloc_state, size);
 }
 
@@ -1350,6 +1474,10 @@ void js_free_rt(JSRuntime *rt, void *ptr)
 
 void *js_realloc_rt(JSRuntime *rt, void *ptr, size_t size)
 {
+    if (size != 0) {
+        rt->stats.alloc_count++;
+        rt->stats.alloc_size += size;
+    }
     return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
 }
 
@@ -1689,6 +1817,10 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     init_list_head(&rt->string_list);
 #endif
     init_list_head(&rt->job_list);
+    init_list_head(&rt->job_free_list);
+    init_list_head(&rt->regexp_cache_lru);
+    rt->regexp_cache_max_count = JS_REGEXP_CACHE_MAX_COUNT;
+    rt->regexp_cache_max_size = JS_REGEXP_CACHE_MAX_SIZE;
 
     if (JS_InitAtoms(rt))
         goto fail;
@@ -1836,6 +1968,18 @@ void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
     rt->malloc_gc_threshold = gc_threshold;
 }
 
+/* memory exchanged with other runtimes (e.g. transferred ArrayBuffers)
+   is allocated with malloc() */
+static void *js_malloc_libc(size_t size)
+{
+    return malloc(size);
+}
+
+static void js_free_libc(void *ptr)
+{
+    free(ptr);
+}
+
 #define malloc(s) malloc_is_forbidden(s)
 #define free(p) free_is_forbidden(p)
 #define realloc(p,s) realloc_is_forbidden(p,s)
@@ -1851,12 +1995,22 @@ void JS_SetCanBlock(JSRuntime *rt, BOOL can_block)
     rt->can_block = can_block;
 }
 
+void JS_SetLazyCompilation(JSRuntime *rt, BOOL enable)
+{
+    rt->lazy_compilation = enable;
+}
+
 void JS_SetSharedArrayBufferFunctions(JSRuntime *rt,
                                       const JSSharedArrayBufferFunctions *sf)
 {
     rt->sab_funcs = *sf;
 }
 
+/* job entries of at most JS_JOB_POOL_ARGS arguments (all the promise
+   jobs) are recycled instead of being freed */
+#define JS_JOB_POOL_ARGS 5
+#define JS_JOB_POOL_MAX  256
+
 /* return 0 if OK, < 0 if exception */
 int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
                   int argc, JSValueConst *argv)
@@ -1865,9 +2019,15 @@ int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
     JSJobEntry *e;
     int i;
 
-    e = js_malloc(ctx, sizeof(*e) + argc * sizeof(JSValue));
-    if (!e)
-        return -1;
+    if (argc <= JS_JOB_POOL_ARGS && !list_empty(&rt->job_free_list)) {
+        e = list_entry(rt->job_free_list.next, JSJobEntry, link);
+        list_del(&e->link);
+        rt->job_free_count--;
+    } else {
+        e = js_malloc(ctx, sizeof(*e) + max_int(argc, JS_JOB_POOL_ARGS) * sizeof(JSValue));
+        if (!e)
+            return -1;
+    }
     e->ctx = ctx;
     e->job_func = job_func;
     e->argc = argc;
@@ -1883,35 +2043,95 @@ BOOL JS_IsJobPending(JSRuntime *rt)
     return !list_empty(&rt->job_list);
 }
 
-/* return < 0 if exception, 0 if no job pending, 1 if a job was
-   executed successfully. the context of the job is stored in '*pctx' */
-int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx)
+/* run the first pending job. Return FALSE if it raised an exception */
+static BOOL js_execute_job(JSRuntime *rt, JSContext **pctx)
 {
     JSContext *ctx;
     JSJobEntry *e;
     JSValue res;
-    int i, ret;
-
-    if (list_empty(&rt->job_list)) {
-        *pctx = NULL;
-        return 0;
-    }
+    BOOL ok;
+    int i;
 
-    /* get the first pending job and execute it */
     e = list_entry(rt->job_list.next, JSJobEntry, link);
     list_del(&e->link);
     ctx = e->ctx;
-    res = e->job_func(e->ctx, e->argc, (JSValueConst *)e->argv);
+    rt->stats.job_count++;
+    /* direct call of the most frequent job */
+    if (e->job_func == promise_reaction_job)
+        res = promise_reaction_job(ctx, e->argc, (JSValueConst *)e->argv);
+    else
+        res = e->job_func(ctx, e->argc, (JSValueConst *)e->argv);
     for(i = 0; i < e->argc; i++)
         JS_FreeValue(ctx, e->argv[i]);
-    if (JS_IsException(res))
-        ret = -1;
-    else
-        ret = 1;
+    ok = !JS_IsException(res);
     JS_FreeValue(ctx, res);
-    js_free(ctx, e);
+    if (e->argc <= JS_JOB_POOL_ARGS && rt->job_free_count < JS_JOB_POOL_MAX) {
+        list_add(&e->link, &rt->job_free_list);
+        rt->job_free_count++;
+    } else {
+        js_free(ctx, e);
+    }
     *pctx = ctx;
-    return ret;
+    return ok;
+}
+
+/* return < 0 if exception, 0 if no job pending, 1 if a job was
+   executed successfully. the context of the job is stored in '*pctx' */
+int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx)
+{
+    if (list_empty(&rt->job_list)) {
+        *pctx = NULL;
+        return 0;
+    }
+    return js_execute_job(rt, pctx) ? 1 : -1;
+}
+
+static int64_t js_job_time_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000 + (tv.tv_usec / 1000);
+}
+
+/* monotonic time in microseconds, used for the GC statistics */
+static int64_t js_get_time_us(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + (ts.tv_nsec / 1000);
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+/* execute up to 'max_jobs' pending jobs (no limit if max_jobs < 0),
+   including the jobs enqueued by them. If 'time_budget_ms' > 0, stop
+   when it is elapsed. Stop after the first job raising an exception and
+   store its context in '*pctx', otherwise '*pctx' is set to NULL. Return
+   the number of executed jobs. */
+int JS_ExecutePendingJobs(JSRuntime *rt, int max_jobs, int time_budget_ms,
+                          JSContext **pctx)
+{
+    JSContext *ctx;
+    int64_t deadline;
+    int n;
+
+    *pctx = NULL;
+    deadline = time_budget_ms > 0 ? js_job_time_ms() + time_budget_ms : 0;
+    for(n = 0; n != max_jobs && !list_empty(&rt->job_list);) {
+        n++;
+        if (!js_execute_job(rt, &ctx)) {
+            *pctx = ctx;
+            break;
+        }
+        /* reading the clock is not free, check it every 16 jobs */
+        if (deadline != 0 && (n & 15) == 0 && js_job_time_ms() >= deadline)
+            break;
+    }
+    return n;
 }
 
 static inline uint32_t atom_get_free(const JSAtomStruct *p)
@@ -1933,9 +2153,13 @@ static inline JSAtomStruct *atom_set_free(uint32_t v)
 static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char)
 {
     JSString *str;
-    str = js_malloc_rt(rt, sizeof(JSString) + (max_len << is_wide_char) + 1 - is_wide_char);
+    size_t size;
+    size = sizeof(JSString) + (max_len << is_wide_char) + 1 - is_wide_char;
+    str = js_malloc_rt(rt, size);
     if (unlikely(!str))
         return NULL;
+    rt->stats.str_alloc_count++;
+    rt->stats.str_alloc_size += size;
     str->header.ref_count = 1;
     str->is_wide_char = is_wide_char;
     str->len = max_len;
@@ -1994,6 +2218,13 @@ void JS_FreeRuntime(JSRuntime *rt)
         js_free_rt(rt, e);
     }
     init_list_head(&rt->job_list);
+    list_for_each_safe(el, el1, &rt->job_free_list) {
+        js_free_rt(rt, list_entry(el, JSJobEntry, link));
+    }
+    init_list_head(&rt->job_free_list);
+    rt->job_free_count = 0;
+
+    js_regexp_cache_free(rt);
 
     JS_RunGC(rt);
 
@@ -2446,8 +2677,8 @@ static inline BOOL is_math_mode(JSContext *ctx)
 #define JS_ATOM_MAX_INT (JS_ATOM_TAG_INT - 1)
 #define JS_ATOM_MAX     ((1U << 30) - 1)
 
-/* return the max count from the hash size */
-#define JS_ATOM_COUNT_RESIZE(n) ((n) * 2)
+/* return the max used count from the hash size (max load factor = 1/2) */
+#define JS_ATOM_COUNT_RESIZE(n) ((n) / 2)
 
 static inline BOOL __JS_AtomIsConst(JSAtom v)
 {
@@ -2519,24 +2750,101 @@ static inline BOOL is_num_string(uint32_t *pval, const JSString *p)
     }
 }
 
-/* XXX: could use faster version ? */
-static inline uint32_t hash_string8(const uint8_t *str, size_t len, uint32_t h)
+/* The strings are hashed 8 characters at a time. A 16 bit string is
+   split into its low and high bytes: the low bytes are hashed as an 8
+   bit string and the high bytes are only mixed in when they are not
+   zero, so that a 16 bit string containing only 8 bit characters has
+   the same hash as its 8 bit version. */
+
+static inline uint64_t hash_mix64(uint64_t h, uint64_t w)
 {
-    size_t i;
+    h = (h ^ w) * 0x9e3779b97f4a7c15;
+    return h ^ (h >> 29);
+}
 
-    for(i = 0; i < len; i++)
-        h = h * 263 + str[i];
-    return h;
+static inline uint32_t hash_final64(uint64_t h)
+{
+    h = (h ^ (h >> 32)) * 0xd6e8feb86659fd93;
+    return (uint32_t)(h ^ (h >> 32));
 }
 
-static inline uint32_t hash_string16(const uint16_t *str,
-                                     size_t len, uint32_t h)
+/* read the last 1 <= len <= 7 bytes of a string without a variable
+   size copy. The string length is part of the hash seed, so the
+   overlapping reads do not cause extra collisions. */
+static inline uint64_t hash_load_tail8(const uint8_t *p, size_t len)
 {
-    size_t i;
+    if (len >= 4)
+        return ((uint64_t)get_u32(p) << 32) | get_u32(p + len - 4);
+    else
+        return ((uint32_t)p[0] << 16) | ((uint32_t)p[len >> 1] << 8) |
+            p[len - 1];
+}
 
-    for(i = 0; i < len; i++)
-        h = h * 263 + str[i];
-    return h;
+static uint32_t hash_string8(const uint8_t *str, size_t len, uint32_t h0)
+{
+    uint64_t h;
+
+    h = ((uint64_t)h0 << 32) ^ len;
+    while (len >= 8) {
+        h = hash_mix64(h, get_u64(str));
+        str += 8;
+        len -= 8;
+    }
+    if (len != 0)
+        h = hash_mix64(h, hash_load_tail8(str, len));
+    return hash_final64(h);
+}
+
+/* split 'len' <= 8 characters into their low and high bytes */
+static inline void hash_split16(uint64_t *plo, uint64_t *phi,
+                                const uint16_t *str, size_t len)
+{
+    uint8_t lo[8], hi[8];
+#ifdef HAVE_SSE2
+    if (len == 8) {
+        __m128i v, m;
+        v = _mm_loadu_si128((const __m128i *)str);
+        m = _mm_set1_epi16(0xff);
+        _mm_storel_epi64((__m128i *)lo,
+                         _mm_packus_epi16(_mm_and_si128(v, m), m));
+        _mm_storel_epi64((__m128i *)hi,
+                         _mm_packus_epi16(_mm_srli_epi16(v, 8), m));
+    } else
+#endif
+    {
+        size_t i;
+        memset(lo, 0, sizeof(lo));
+        memset(hi, 0, sizeof(hi));
+        for(i = 0; i < len; i++) {
+            lo[i] = str[i];
+            hi[i] = str[i] >> 8;
+        }
+    }
+    if (len == 8) {
+        *plo = get_u64(lo);
+        *phi = get_u64(hi);
+    } else {
+        *plo = hash_load_tail8(lo, len);
+        *phi = hash_load_tail8(hi, len);
+    }
+}
+
+static uint32_t hash_string16(const uint16_t *str, size_t len, uint32_t h0)
+{
+    uint64_t h, lo, hi;
+    size_t l;
+
+    h = ((uint64_t)h0 << 32) ^ len;
+    while (len != 0) {
+        l = min_uint32(len, 8);
+        hash_split16(&lo, &hi, str, l);
+        h = hash_mix64(h, lo);
+        if (hi != 0)
+            h = hash_mix64(h, hi);
+        str += l;
+        len -= l;
+    }
+    return hash_final64(h);
 }
 
 static uint32_t hash_string(const JSString *str, uint32_t h)
@@ -2589,15 +2897,12 @@ static __maybe_unused void JS_DumpAtoms(JSRuntime *rt)
            rt->atom_count, rt->atom_size, rt->atom_hash_size);
     printf("JSAtom hash table: {\n");
     for(i = 0; i < rt->atom_hash_size; i++) {
-        h = rt->atom_hash[i];
+        h = rt->atom_hash[i].atom;
         if (h) {
-            printf("  %d:", i);
-            while (h) {
-                p = rt->atom_array[h];
-                printf(" ");
-                JS_DumpString(rt, p);
-                h = p->hash_next;
-            }
+            p = rt->atom_array[h];
+            printf("  %d: %d ", i, (int)(rt->atom_hash[i].hash &
+                                         (rt->atom_hash_size - 1)));
+            JS_DumpString(rt, p);
             printf("\n");
         }
     }
@@ -2615,10 +2920,22 @@ static __maybe_unused void JS_DumpAtoms(JSRuntime *rt)
     printf("}\n");
 }
 
+/* return the index of the first empty or deleted entry for 'h' */
+static uint32_t atom_hash_find_free(JSAtomHashEntry *tab, uint32_t hash_mask,
+                                    uint32_t h)
+{
+    h &= hash_mask;
+    while (tab[h].atom != 0)
+        h = (h + 1) & hash_mask;
+    return h;
+}
+
+/* also used to remove the deleted entries if 'new_hash_size' is the
+   current size */
 static int JS_ResizeAtomHash(JSRuntime *rt, int new_hash_size)
 {
-    JSAtomStruct *p;
-    uint32_t new_hash_mask, h, i, hash_next1, j, *new_hash;
+    JSAtomHashEntry *new_hash, *e;
+    uint32_t new_hash_mask, i, j;
 
     assert((new_hash_size & (new_hash_size - 1)) == 0); /* power of two */
     new_hash_mask = new_hash_size - 1;
@@ -2626,20 +2943,16 @@ static int JS_ResizeAtomHash(JSRuntime *rt, int new_hash_size)
     if (!new_hash)
         return -1;
     for(i = 0; i < rt->atom_hash_size; i++) {
-        h = rt->atom_hash[i];
-        while (h != 0) {
-            p = rt->atom_array[h];
-            hash_next1 = p->hash_next;
-            /* add in new hash table */
-            j = p->hash & new_hash_mask;
-            p->hash_next = new_hash[j];
-            new_hash[j] = h;
-            h = hash_next1;
+        e = &rt->atom_hash[i];
+        if (e->atom != 0) {
+            j = atom_hash_find_free(new_hash, new_hash_mask, e->hash);
+            new_hash[j] = *e;
         }
     }
     js_free_rt(rt, rt->atom_hash);
     rt->atom_hash = new_hash;
     rt->atom_hash_size = new_hash_size;
+    rt->atom_hash_used = rt->atom_hash_count;
     rt->atom_count_resize = JS_ATOM_COUNT_RESIZE(new_hash_size);
     //    JS_DumpAtoms(rt);
     return 0;
@@ -2651,11 +2964,13 @@ static int JS_InitAtoms(JSRuntime *rt)
     const char *p;
 
     rt->atom_hash_size = 0;
+    rt->atom_hash_count = 0;
+    rt->atom_hash_used = 0;
     rt->atom_hash = NULL;
     rt->atom_count = 0;
     rt->atom_size = 0;
     rt->atom_free_index = 0;
-    if (JS_ResizeAtomHash(rt, 256))     /* there are at least 195 predefined atoms */
+    if (JS_ResizeAtomHash(rt, 512))     /* there are at least 195 predefined atoms */
         return -1;
 
     p = js_atom_init;
@@ -2731,28 +3046,17 @@ static BOOL JS_AtomIsString(JSContext *ctx, JSAtom v)
     return JS_AtomGetKind(ctx, v) == JS_ATOM_KIND_STRING;
 }
 
-static JSAtom js_get_atom_index(JSRuntime *rt, JSAtomStruct *p)
+static inline JSAtom js_get_atom_index(JSRuntime *rt, JSAtomStruct *p)
 {
-    uint32_t i = p->hash_next;  /* atom_index */
-    if (p->atom_type != JS_ATOM_TYPE_SYMBOL) {
-        JSAtomStruct *p1;
-
-        i = rt->atom_hash[p->hash & (rt->atom_hash_size - 1)];
-        p1 = rt->atom_array[i];
-        while (p1 != p) {
-            assert(i != 0);
-            i = p1->hash_next;
-            p1 = rt->atom_array[i];
-        }
-    }
-    return i;
+    return p->hash_next;  /* atom_index */
 }
 
 /* string case (internal). Return JS_ATOM_NULL if error. 'str' is
    freed. */
 static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
 {
-    uint32_t h, h1, i;
+    uint32_t h, h1, i, hash_mask, free_h1;
+    JSAtomHashEntry *e;
     JSAtomStruct *p;
     int len;
 
@@ -2773,19 +3077,39 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
         len = str->len;
         h = hash_string(str, atom_type);
         h &= JS_ATOM_HASH_MASK;
-        h1 = h & (rt->atom_hash_size - 1);
-        i = rt->atom_hash[h1];
-        while (i != 0) {
-            p = rt->atom_array[i];
-            if (p->hash == h &&
-                p->atom_type == atom_type &&
-                p->len == len &&
-                js_string_memcmp(p, str, len) == 0) {
-                if (!__JS_AtomIsConst(i))
-                    p->header.ref_count++;
-                goto done;
+        hash_mask = rt->atom_hash_size - 1;
+        h1 = h & hash_mask;
+        free_h1 = -1;
+        for(;;) {
+            e = &rt->atom_hash[h1];
+            i = e->atom;
+            if (i == 0) {
+                if (e->hash != JS_ATOM_HASH_DELETED)
+                    break;
+                if (free_h1 == -1)
+                    free_h1 = h1;
+            } else if (e->hash == h) {
+                p = rt->atom_array[i];
+                if (p->atom_type == atom_type &&
+                    p->len == len &&
+                    js_string_memcmp(p, str, len) == 0) {
+                    if (!__JS_AtomIsConst(i))
+                        p->header.ref_count++;
+                    goto done;
+                }
             }
-            i = p->hash_next;
+            h1 = (h1 + 1) & hash_mask;
+        }
+        if (free_h1 != -1) {
+            /* reuse a deleted entry */
+            h1 = free_h1;
+        } else if (unlikely(rt->atom_hash_used >= rt->atom_count_resize)) {
+            /* grow the table or only remove the deleted entries */
+            if (JS_ResizeAtomHash(rt, rt->atom_hash_count * 2 >=
+                                  rt->atom_count_resize ?
+                                  rt->atom_hash_size * 2 : rt->atom_hash_size))
+                goto fail;
+            h1 = atom_hash_find_free(rt->atom_hash, rt->atom_hash_size - 1, h);
         }
     } else {
         h1 = 0; /* avoid warning */
@@ -2888,10 +3212,12 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
     rt->atom_count++;
 
     if (atom_type != JS_ATOM_TYPE_SYMBOL) {
-        p->hash_next = rt->atom_hash[h1];
-        rt->atom_hash[h1] = i;
-        if (unlikely(rt->atom_count >= rt->atom_count_resize))
-            JS_ResizeAtomHash(rt, rt->atom_hash_size * 2);
+        e = &rt->atom_hash[h1];
+        if (e->hash != JS_ATOM_HASH_DELETED)
+            rt->atom_hash_used++;
+        e->hash = h;
+        e->atom = i;
+        rt->atom_hash_count++;
     }
 
     //    JS_DumpAtoms(rt);
@@ -2933,25 +3259,32 @@ JSAtom JS_NewAtomSymbolLenRT(JSRuntime *rt, const char *str, int len)
 static JSAtom __JS_FindAtom(JSRuntime *rt, const char *str, size_t len,
                             int atom_type)
 {
-    uint32_t h, h1, i;
+    uint32_t h, h1, i, hash_mask;
+    JSAtomHashEntry *e;
     JSAtomStruct *p;
 
     h = hash_string8((const uint8_t *)str, len, JS_ATOM_TYPE_STRING);
     h &= JS_ATOM_HASH_MASK;
-    h1 = h & (rt->atom_hash_size - 1);
-    i = rt->atom_hash[h1];
-    while (i != 0) {
-        p = rt->atom_array[i];
-        if (p->hash == h &&
-            p->atom_type == JS_ATOM_TYPE_STRING &&
-            p->len == len &&
-            p->is_wide_char == 0 &&
-            memcmp(p->u.str8, str, len) == 0) {
-            if (!__JS_AtomIsConst(i))
-                p->header.ref_count++;
-            return i;
+    hash_mask = rt->atom_hash_size - 1;
+    h1 = h & hash_mask;
+    for(;;) {
+        e = &rt->atom_hash[h1];
+        i = e->atom;
+        if (i == 0) {
+            if (e->hash != JS_ATOM_HASH_DELETED)
+                break;
+        } else if (e->hash == h) {
+            p = rt->atom_array[i];
+            if (p->atom_type == JS_ATOM_TYPE_STRING &&
+                p->len == len &&
+                p->is_wide_char == 0 &&
+                memcmp(p->u.str8, str, len) == 0) {
+                if (!__JS_AtomIsConst(i))
+                    p->header.ref_count++;
+                return i;
+            }
         }
-        i = p->hash_next;
+        h1 = (h1 + 1) & hash_mask;
     }
     return JS_ATOM_NULL;
 }
@@ -2966,24 +3299,31 @@ static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p)
 #endif
     uint32_t i = p->hash_next;  /* atom_index */
     if (p->atom_type != JS_ATOM_TYPE_SYMBOL) {
-        JSAtomStruct *p0, *p1;
-        uint32_t h0;
-
-        h0 = p->hash & (rt->atom_hash_size - 1);
-        i = rt->atom_hash[h0];
-        p1 = rt->atom_array[i];
-        if (p1 == p) {
-            rt->atom_hash[h0] = p1->hash_next;
-        } else {
+        JSAtomHashEntry *e;
+        uint32_t h0, hash_mask;
+
+        hash_mask = rt->atom_hash_size - 1;
+        h0 = p->hash & hash_mask;
+        while (rt->atom_hash[h0].atom != i) {
+            assert(rt->atom_hash[h0].atom != 0 ||
+                   rt->atom_hash[h0].hash == JS_ATOM_HASH_DELETED);
+            h0 = (h0 + 1) & hash_mask;
+        }
+        e = &rt->atom_hash[h0];
+        e->atom = 0;
+        e->hash = JS_ATOM_HASH_DELETED;
+        rt->atom_hash_count--;
+        e = &rt->atom_hash[(h0 + 1) & hash_mask];
+        if (e->atom == 0 && e->hash != JS_ATOM_HASH_DELETED) {
+            /* end of a probe sequence: the trailing deleted entries
+               can be emptied */
             for(;;) {
-                assert(i != 0);
-                p0 = p1;
-                i = p1->hash_next;
-                p1 = rt->atom_array[i];
-                if (p1 == p) {
-                    p0->hash_next = p1->hash_next;
+                e = &rt->atom_hash[h0];
+                if (e->atom != 0 || e->hash != JS_ATOM_HASH_DELETED)
                     break;
-                }
+                e->hash = 0;
+                rt->atom_hash_used--;
+                h0 = (h0 - 1) & hash_mask;
             }
         }
     }
@@ -4440,6 +4780,8 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
     sh_alloc = js_malloc(ctx, get_shape_size(hash_size, prop_size));
     if (!sh_alloc)
         return NULL;
+    rt->stats.shape_alloc_count++;
+    rt->stats.shape_alloc_size += get_shape_size(hash_size, prop_size);
     sh = get_shape_from_alloc(sh_alloc, hash_size);
     sh->header.ref_count = 1;
     add_gc_object(rt, &sh->header, JS_GC_OBJ_TYPE_SHAPE);
@@ -4482,6 +4824,8 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
     sh_alloc = js_malloc(ctx, size);
     if (!sh_alloc)
         return NULL;
+    ctx->rt->stats.shape_alloc_count++;
+    ctx->rt->stats.shape_alloc_size += size;
     sh_alloc1 = get_alloc_from_shape(sh1);
     memcpy(sh_alloc, sh_alloc1, size);
     sh = get_shape_from_alloc(sh_alloc, hash_size);
@@ -4842,6 +5186,10 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
         js_free_shape(ctx->rt, sh);
         return JS_EXCEPTION;
     }
+    ctx->rt->stats.obj_alloc_count++;
+    ctx->rt->stats.obj_alloc_size += sizeof(JSObject) +
+        sizeof(JSProperty) * sh->prop_size;
+    ctx->rt->class_array[class_id].obj_count++;
 
     switch(class_id) {
     case JS_CLASS_OBJECT:
@@ -5207,6 +5555,7 @@ static JSValue js_c_function_data_call(JSContext *ctx, JSValueConst func_obj,
     JSValueConst *arg_buf;
     int i;
 
+    ctx->rt->stats.c_call_count++;
     /* XXX: could add the function on the stack for debug */
     if (unlikely(argc < s->length)) {
         arg_buf = alloca(sizeof(arg_buf[0]) * s->length);
@@ -5514,6 +5863,7 @@ static void free_object(JSRuntime *rt, JSObject *p)
 
     p->free_mark = 1; /* used to tell the object is invalid when
                          freeing cycles */
+    rt->class_array[p->class_id].obj_count--;
     /* free all the fields */
     sh = p->shape;
     pr = get_shape_prop(sh);
@@ -5908,6 +6258,10 @@ static void gc_free_cycles(JSRuntime *rt)
 
 void JS_RunGC(JSRuntime *rt)
 {
+    int64_t start, pause;
+
+    start = js_get_time_us();
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5917,6 +6271,12 @@ void JS_RunGC(JSRuntime *rt)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    pause = js_get_time_us() - start;
+    rt->stats.gc_count++;
+    rt->stats.gc_time += pause;
+    if (pause > rt->stats.gc_max_time)
+        rt->stats.gc_max_time = pause;
 }
 
 /* Return false if not an object or if the object has already been
@@ -5981,11 +6341,13 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
     if (b->has_debug) {
         js_func_size += sizeof(*b) - offsetof(JSFunctionBytecode, debug);
         if (b->debug.source) {
-            memory_used_count++;
+            if (!b->inline_debug)
+                memory_used_count++;
             js_func_size += b->debug.source_len + 1;
         }
         if (b->debug.pc2line_len) {
-            memory_used_count++;
+            if (!b->inline_debug)
+                memory_used_count++;
             hp->js_func_pc2line_count += 1;
             hp->js_func_pc2line_size += b->debug.pc2line_len;
         }
@@ -6430,6 +6792,35 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
     }
 }
 
+/* Unlike JS_ComputeMemoryUsage(), the counters are maintained
+   incrementally so reading them does not walk the heap. */
+void JS_GetRuntimeStats(JSRuntime *rt, JSRuntimeStats *s)
+{
+    int i;
+
+    *s = rt->stats;
+    s->malloc_count = rt->malloc_state.malloc_count;
+    s->malloc_size = rt->malloc_state.malloc_size;
+    s->obj_count = 0;
+    for(i = 0; i < rt->class_count; i++)
+        s->obj_count += rt->class_array[i].obj_count;
+}
+
+void JS_EnumClassStats(JSRuntime *rt, JSClassStatsFunc *func, void *opaque)
+{
+    char buf[ATOM_GET_STR_BUF_SIZE];
+    JSClass *cl;
+    int i;
+
+    for(i = 1; i < rt->class_count; i++) {
+        cl = &rt->class_array[i];
+        if (cl->class_id == 0)
+            continue;
+        func(opaque, i, JS_AtomGetStrRT(rt, buf, sizeof(buf), cl->class_name),
+             cl->obj_count);
+    }
+}
+
 JSValue JS_GetGlobalObject(JSContext *ctx)
 {
     return JS_DupValue(ctx, ctx->global_obj);
@@ -6439,6 +6830,7 @@ JSValue JS_GetGlobalObject(JSContext *ctx)
 JSValue JS_Throw(JSContext *ctx, JSValue obj)
 {
     JSRuntime *rt = ctx->rt;
+    rt->stats.exception_count++;
     JS_FreeValue(ctx, rt->current_exception);
     rt->current_exception = obj;
     return JS_EXCEPTION;
@@ -7987,6 +8379,11 @@ static JSValue JS_GetPropertyValue(JSContext *ctx, JSValueConst this_obj,
             goto slow_path;
         switch(p->class_id) {
         case JS_CLASS_ARRAY:
+#ifdef CONFIG_STORAGE
+            /* dormant elements are placeholders, the slow path loads them */
+            if (unlikely(p->persistent && p->persistent->status == JS_PERSISTENT_DORMANT))
+                goto slow_path;
+#endif
         case JS_CLASS_ARGUMENTS:
             return JS_DupValue(ctx, p->u.array.u.values[idx]);
         case JS_CLASS_INT8_ARRAY:
@@ -8785,6 +9182,8 @@ static int JS_SetPropertyValue(JSContext *ctx, JSValueConst this_obj,
         idx = JS_VALUE_GET_INT(prop);
         switch(p->class_id) {
         case JS_CLASS_ARRAY:
+            /* dormant arrays are loaded before being modified */
+            MARK_MODIFIED_OBJ(p);
             if (unlikely(idx >= (uint32_t)p->u.array.count)) {
                 JSObject *p1;
                 JSShape *sh1;
@@ -11020,6 +11419,34 @@ int JS_ToInt64Ext(JSContext *ctx, int64_t *pres, JSValueConst val)
         return JS_ToInt64(ctx, pres, val);
 }
 
+/* ToInt32() of a double */
+static inline int32_t js_double_to_int32(double d)
+{
+    JSFloat64Union u;
+    int32_t ret;
+    int e;
+
+    u.d = d;
+    /* we avoid doing fmod(x, 2^32) */
+    e = (u.u64 >> 52) & 0x7ff;
+    if (likely(e <= (1023 + 30))) {
+        /* fast case */
+        ret = (int32_t)d;
+    } else if (e <= (1023 + 30 + 53)) {
+        uint64_t v;
+        /* remainder modulo 2^32 */
+        v = (u.u64 & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
+        v = v << ((e - 1023) - 52 + 32);
+        ret = v >> 32;
+        /* take the sign into account */
+        if (u.u64 >> 63)
+            ret = -ret;
+    } else {
+        ret = 0; /* also handles NaN and +inf */
+    }
+    return ret;
+}
+
 /* return (<0, 0) in case of exception */
 static int JS_ToInt32Free(JSContext *ctx, int32_t *pres, JSValue val)
 {
@@ -11036,30 +11463,7 @@ static int JS_ToInt32Free(JSContext *ctx, int32_t *pres, JSValue val)
         ret = JS_VALUE_GET_INT(val);
         break;
     case JS_TAG_FLOAT64:
-        {
-            JSFloat64Union u;
-            double d;
-            int e;
-            d = JS_VALUE_GET_FLOAT64(val);
-            u.d = d;
-            /* we avoid doing fmod(x, 2^32) */
-            e = (u.u64 >> 52) & 0x7ff;
-            if (likely(e <= (1023 + 30))) {
-                /* fast case */
-                ret = (int32_t)d;
-            } else if (e <= (1023 + 30 + 53)) {
-                uint64_t v;
-                /* remainder modulo 2^32 */
-                v = (u.u64 & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
-                v = v << ((e - 1023) - 52 + 32);
-                ret = v >> 32;
-                /* take the sign into account */
-                if (u.u64 >> 63)
-                    ret = -ret;
-            } else {
-                ret = 0; /* also handles NaN and +inf */
-            }
-        }
+        ret = js_double_to_int32(JS_VALUE_GET_FLOAT64(val));
         break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -11092,6 +11496,17 @@ static inline int JS_ToUint32Free(JSContext *ctx, uint32_t *pres, JSValue val)
     return JS_ToInt32Free(ctx, (int32_t *)pres, val);
 }
 
+/* ToUint8Clamp() of a double */
+static inline int js_double_to_uint8_clamp(double d)
+{
+    if (isnan(d) || d < 0)
+        return 0;
+    else if (d > 255)
+        return 255;
+    else
+        return lrint(d);
+}
+
 static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val)
 {
     uint32_t tag;
@@ -11111,19 +11526,7 @@ static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val)
         res = max_int(0, min_int(255, res));
         break;
     case JS_TAG_FLOAT64:
-        {
-            double d = JS_VALUE_GET_FLOAT64(val);
-            if (isnan(d)) {
-                res = 0;
-            } else {
-                if (d < 0)
-                    res = 0;
-                else if (d > 255)
-                    res = 255;
-                else
-                    res = lrint(d);
-            }
-        }
+        res = js_double_to_uint8_clamp(JS_VALUE_GET_FLOAT64(val));
         break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -16258,6 +16661,7 @@ static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
     int arg_count, i;
     JSCFunctionEnum cproto;
 
+    rt->stats.c_call_count++;
     p = JS_VALUE_GET_OBJ(func_obj);
     cproto = p->u.cfunc.cproto;
     arg_count = p->u.cfunc.length;
@@ -16423,8 +16827,74 @@ JS_BOOL JS_AreFunctionsOfSameOrigin(JSContext *ctx, JSValue f1, JSValue f2) {
 
   JSObject *p1 = JS_VALUE_GET_OBJ(f1);
   JSObject *p2 = JS_VALUE_GET_OBJ(f2);
-  
-  return p1->u.func.function_bytecode == p2->u.func.function_bytecode; /* what about native functions ? */
+  JSFunctionBytecode *b1 = p1->u.func.function_bytecode;
+  JSFunctionBytecode *b2 = p2->u.func.function_bytecode;
+
+  /* a lazy function is of the same origin as its compiled version */
+  if (js_class_has_bytecode(p1->class_id) && b1->is_lazy &&
+      JS_VALUE_GET_TAG(b1->cpool[0]) == JS_TAG_FUNCTION_BYTECODE)
+    b1 = JS_VALUE_GET_PTR(b1->cpool[0]);
+  if (js_class_has_bytecode(p2->class_id) && b2->is_lazy &&
+      JS_VALUE_GET_TAG(b2->cpool[0]) == JS_TAG_FUNCTION_BYTECODE)
+    b2 = JS_VALUE_GET_PTR(b2->cpool[0]);
+  return b1 == b2; /* what about native functions ? */
+}
+
+/* replace the lazy function of 'p' by its compiled version */
+static int js_link_lazy_function(JSContext *ctx, JSObject *p)
+{
+    JSFunctionBytecode *b, *b1;
+    JSVarRef **var_refs, *var_ref;
+    JSValue func_obj;
+    int i;
+
+    b = p->u.func.function_bytecode;
+    if (JS_IsNull(b->cpool[0])) {
+        func_obj = js_compile_lazy_function(b->realm, b);
+        if (JS_IsException(func_obj))
+            return -1;
+        b->cpool[0] = func_obj;
+    }
+    b1 = JS_VALUE_GET_PTR(b->cpool[0]);
+    var_refs = NULL;
+    if (b1->closure_var_count) {
+        var_refs = js_mallocz(ctx, sizeof(var_refs[0]) * b1->closure_var_count);
+        if (!var_refs)
+            return -1;
+        for(i = 0; i < b1->closure_var_count; i++) {
+            var_ref = p->u.func.var_refs[b1->closure_var[i].var_idx];
+            if (var_ref)
+                var_ref->header.ref_count++;
+            var_refs[i] = var_ref;
+        }
+    }
+    if (p->u.func.var_refs) {
+        for(i = 0; i < b->closure_var_count; i++)
+            free_var_ref(ctx->rt, p->u.func.var_refs[i]);
+        js_free(ctx, p->u.func.var_refs);
+    }
+    p->u.func.var_refs = var_refs;
+    p->u.func.function_bytecode = b1;
+    JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b1));
+    JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    return 0;
+}
+
+/* called before the first execution of the function of 'p' if it is
+   lazy or if its bytecode must be relocated */
+static int js_prepare_function(JSContext *ctx, JSObject *p)
+{
+    JSFunctionBytecode *b;
+
+    b = p->u.func.function_bytecode;
+    if (b->is_lazy) {
+        if (js_link_lazy_function(ctx, p))
+            return -1;
+        b = p->u.func.function_bytecode;
+    }
+    if (b->atom_reloc_pending)
+        return js_relocate_bytecode(ctx, b);
+    return 0;
 }
 
 /* argument of OP_special_object */
@@ -16524,6 +16994,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                          (JSValueConst *)argv, flags);
     }
     b = p->u.func.function_bytecode;
+    if (unlikely(b->is_lazy || b->atom_reloc_pending)) {
+        if (js_prepare_function(caller_ctx, p))
+            return JS_EXCEPTION;
+        b = p->u.func.function_bytecode;
+    }
 
     if (unlikely(argc < b->arg_count || (flags & JS_CALL_FLAG_COPY_ARGV))) {
         arg_allocated_size = b->arg_count;
@@ -19161,6 +19636,11 @@ static __exception int async_func_init(JSContext *ctx, JSAsyncFunctionState *s,
     init_list_head(&sf->var_ref_list);
     p = JS_VALUE_GET_OBJ(func_obj);
     b = p->u.func.function_bytecode;
+    if (unlikely(b->is_lazy || b->atom_reloc_pending)) {
+        if (js_prepare_function(ctx, p))
+            return -1;
+        b = p->u.func.function_bytecode;
+    }
     sf->js_mode = b->js_mode;
     sf->cur_pc = b->byte_code_buf;
     arg_buf_len = max_int(b->arg_count, argc);
@@ -20243,6 +20723,8 @@ typedef struct JSFunctionDef {
     BOOL is_derived_class_constructor;
     BOOL in_function_body;
     BOOL backtrace_barrier;
+    BOOL is_lazy; /* see js_new_lazy_function_def() */
+    BOOL is_module_code; /* lazy function defined in a module */
     JSFunctionKindEnum func_kind : 8;
     JSParseFunctionEnum func_type : 8;
     uint8_t js_mode; /* bitmap of JS_MODE_x */
@@ -27682,6 +28164,14 @@ static char *js_default_module_normalize_name(JSContext *ctx,
     return filename;
 }
 
+/* default module name normalization (no normalizer is set). The result
+   must be freed with js_free() */
+char *JS_NormalizeModuleName(JSContext *ctx, const char *base_name,
+                             const char *name)
+{
+    return js_default_module_normalize_name(ctx, base_name, name);
+}
+
 static JSModuleDef *js_find_loaded_module(JSContext *ctx, JSAtom name)
 {
     struct list_head *el;
@@ -29202,6 +29692,69 @@ static void free_bytecode_atoms(JSRuntime *rt,
     }
 }
 
+static void js_atom_map_free(JSRuntime *rt, JSAtomMap *map)
+{
+    uint32_t i;
+
+    if (--map->ref_count > 0)
+        return;
+    for(i = 0; i < map->count; i++)
+        JS_FreeAtomRT(rt, map->atoms[i]);
+    if (map->free_func)
+        map->free_func(rt, map->opaque, (void *)map->buf);
+    js_free_rt(rt, map);
+}
+
+/* copy the read only bytecode of 'b' and replace the atom indexes of
+   the buffer by the atoms */
+static int js_relocate_bytecode(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSAtomMap *map = b->atom_map;
+    uint8_t *bc_buf;
+    int pos, len, op;
+    uint32_t idx;
+    JSAtom atom;
+
+    bc_buf = js_malloc(ctx, max_int(b->byte_code_len, 1));
+    if (!bc_buf)
+        return -1;
+    memcpy(bc_buf, b->byte_code_buf, b->byte_code_len);
+    for(pos = 0; pos < b->byte_code_len; pos += len) {
+        op = bc_buf[pos];
+        len = short_opcode_info(op).size;
+        if (len > b->byte_code_len - pos)
+            goto fail;
+        switch(short_opcode_info(op).fmt) {
+        case OP_FMT_atom:
+        case OP_FMT_atom_u8:
+        case OP_FMT_atom_u16:
+        case OP_FMT_atom_label_u8:
+        case OP_FMT_atom_label_u16:
+            idx = get_u32(bc_buf + pos + 1);
+            if (__JS_AtomIsTaggedInt(idx) || idx < map->first_atom) {
+                atom = idx;
+            } else if (idx - map->first_atom < map->count) {
+                atom = map->atoms[idx - map->first_atom];
+            } else {
+                goto fail;
+            }
+            put_u32(bc_buf + pos + 1, JS_DupAtom(ctx, atom));
+            break;
+        default:
+            break;
+        }
+    }
+    b->byte_code_buf = bc_buf;
+    b->read_only_bytecode = FALSE;
+    b->atom_reloc_pending = FALSE;
+    return 0;
+ fail:
+    free_bytecode_atoms(ctx->rt, bc_buf, pos, TRUE);
+    js_free(ctx, bc_buf);
+    JS_ThrowSyntaxError(ctx, "invalid bytecode");
+    return -1;
+}
+
 static void js_free_function_def(JSContext *ctx, JSFunctionDef *fd)
 {
     int i;
@@ -32857,6 +33410,33 @@ static int add_module_variables(JSContext *ctx, JSFunctionDef *fd)
 /* create a function object from a function definition. The function
    definition is freed. All the child functions are also created. It
    must be done this way to resolve all the variables. */
+/* When a lazy function is compiled, the variables of the parent
+   scopes are only visible through its closure variables. If they can
+   be defined dynamically (direct eval or 'with'), the closure
+   variables must contain all the parent variables ordered by scope as
+   for a direct eval. */
+static BOOL js_lazy_function_has_dynamic_scope(JSFunctionDef *fd)
+{
+    int i;
+
+    for(fd = fd->parent; fd != NULL; fd = fd->parent) {
+        if (fd->has_eval_call)
+            return TRUE;
+        for(i = 0; i < fd->var_count; i++) {
+            if (fd->vars[i].var_name == JS_ATOM__with_)
+                return TRUE;
+        }
+        for(i = 0; i < fd->closure_var_count; i++) {
+            JSAtom var_name = fd->closure_var[i].var_name;
+            if (var_name == JS_ATOM__var_ ||
+                var_name == JS_ATOM__arg_var_ ||
+                var_name == JS_ATOM__with_)
+                return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
 {
     JSValue func_obj;
@@ -32896,7 +33476,8 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
        are used to compile the eval and they must be ordered by scope,
        so it is necessary to create the closure variables before any
        other variable lookup is done. */
-    if (fd->has_eval_call)
+    if (fd->has_eval_call ||
+        (fd->is_lazy && js_lazy_function_has_dynamic_scope(fd)))
         add_eval_variables(ctx, fd);
 
     /* add the module global variables in the closure */
@@ -32972,6 +33553,8 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     b = js_mallocz(ctx, function_size);
     if (!b)
         goto fail;
+    ctx->rt->stats.js_func_alloc_count++;
+    ctx->rt->stats.js_func_alloc_size += function_size;
     b->header.ref_count = 1;
 
     b->byte_code_buf = (void *)((uint8_t*)b + byte_code_offset);
@@ -33002,10 +33585,10 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
         }
         b->var_count = fd->var_count;
         b->arg_count = fd->arg_count;
-        b->defined_arg_count = fd->defined_arg_count;
         js_free(ctx, fd->args);
         js_free(ctx, fd->vars);
     }
+    b->defined_arg_count = fd->defined_arg_count;
     b->cpool_count = fd->cpool_count;
     if (b->cpool_count) {
         b->cpool = (void *)((uint8_t*)b + cpool_offset);
@@ -33060,6 +33643,9 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     b->super_allowed = fd->super_allowed;
     b->arguments_allowed = fd->arguments_allowed;
     b->backtrace_barrier = fd->backtrace_barrier;
+    b->is_lazy = fd->is_lazy;
+    b->is_func_expr = fd->is_func_expr;
+    b->is_module_code = fd->is_module_code;
     b->realm = JS_DupContext(ctx);
 
     add_gc_object(ctx->rt, &b->header, JS_GC_OBJ_TYPE_FUNCTION_BYTECODE);
@@ -33093,7 +33679,14 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
                JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name));
     }
 #endif
-    free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+    /* the atoms of the read only bytecode are referenced by the atom map */
+    if (b->byte_code_buf && !b->read_only_bytecode)
+        free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+    if (b->atom_map) {
+        if (!b->read_only_bytecode)
+            js_free_rt(rt, b->byte_code_buf); /* relocated copy */
+        js_atom_map_free(rt, b->atom_map);
+    }
 
     if (b->vardefs) {
         for(i = 0; i < b->arg_count + b->var_count; i++) {
@@ -33113,8 +33706,10 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
     JS_FreeAtomRT(rt, b->func_name);
     if (b->has_debug) {
         JS_FreeAtomRT(rt, b->debug.filename);
-        js_free_rt(rt, b->debug.pc2line_buf);
-        js_free_rt(rt, b->debug.source);
+        if (!b->inline_debug) {
+            js_free_rt(rt, b->debug.pc2line_buf);
+            js_free_rt(rt, b->debug.source);
+        }
     }
 
     remove_gc_object(&b->header);
@@ -33297,6 +33892,208 @@ static JSFunctionDef *js_parse_function_class_fields_init(JSParseState *s)
     return fd;
 }
 
+/* set of atoms, used to collect the free variables of a lazy function */
+typedef struct JSAtomSet {
+    JSAtom *tab; /* open addressing, JS_ATOM_NULL for empty slots */
+    uint32_t size; /* power of two */
+    uint32_t count;
+} JSAtomSet;
+
+/* return 1 if the atom was added, 0 if already present, -1 if error */
+static int js_atom_set_add(JSContext *ctx, JSAtomSet *as, JSAtom atom)
+{
+    uint32_t h, i, new_size;
+    JSAtom *new_tab;
+
+    if (2 * (as->count + 1) > as->size) {
+        new_size = max_int(as->size * 2, 32);
+        new_tab = js_mallocz(ctx, sizeof(new_tab[0]) * new_size);
+        if (!new_tab)
+            return -1;
+        for(i = 0; i < as->size; i++) {
+            if (as->tab[i] == JS_ATOM_NULL)
+                continue;
+            h = (as->tab[i] * 0x9e3779b1) & (new_size - 1);
+            while (new_tab[h] != JS_ATOM_NULL)
+                h = (h + 1) & (new_size - 1);
+            new_tab[h] = as->tab[i];
+        }
+        js_free(ctx, as->tab);
+        as->tab = new_tab;
+        as->size = new_size;
+    }
+    h = (atom * 0x9e3779b1) & (as->size - 1);
+    while (as->tab[h] != JS_ATOM_NULL) {
+        if (as->tab[h] == atom)
+            return 0;
+        h = (h + 1) & (as->size - 1);
+    }
+    as->tab[h] = atom;
+    as->count++;
+    return 1;
+}
+
+/* Emit a reference to each variable which is not defined in the
+   function 'fd' or in its children. Return 1 if the function cannot
+   be compiled lazily, -1 if error. */
+static int js_lazy_function_scan(JSContext *ctx, JSFunctionDef *fd,
+                                 JSAtomSet *as, DynBuf *bc)
+{
+    struct list_head *el;
+    const uint8_t *bc_buf = fd->byte_code.buf;
+    int pos, op, ret;
+    JSAtom var_name;
+
+    /* a direct eval can reference any variable of the parent scopes */
+    if (fd->has_eval_call)
+        return 1;
+    for (pos = 0; pos < fd->byte_code.size; pos += opcode_info[op].size) {
+        op = bc_buf[pos];
+        switch(op) {
+        case OP_scope_get_private_field:
+        case OP_scope_get_private_field2:
+        case OP_scope_put_private_field:
+            /* XXX: the private names of the enclosing classes would
+               have to be captured too */
+            return 1;
+        case OP_scope_get_var_undef:
+        case OP_scope_get_var:
+        case OP_scope_put_var:
+        case OP_scope_delete_var:
+        case OP_scope_make_ref:
+        case OP_scope_get_ref:
+        case OP_scope_put_var_init:
+            var_name = get_u32(bc_buf + pos + 1);
+            ret = js_atom_set_add(ctx, as, var_name);
+            if (ret < 0)
+                return -1;
+            if (ret > 0) {
+                dbuf_putc(bc, OP_scope_get_var);
+                dbuf_put_u32(bc, JS_DupAtom(ctx, var_name));
+                dbuf_put_u16(bc, 0);
+                dbuf_putc(bc, OP_drop);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    list_for_each(el, &fd->child_list) {
+        JSFunctionDef *fd1 = list_entry(el, JSFunctionDef, link);
+        ret = js_lazy_function_scan(ctx, fd1, as, bc);
+        if (ret)
+            return ret;
+    }
+    return 0;
+}
+
+/* Replace the parsed function 'fd' by a function which only captures
+   the variables of the parent scopes referenced by 'fd'. The function
+   is compiled again from its source when it is first called (see
+   js_compile_lazy_function()). Return 'fd' if it cannot be compiled
+   lazily and NULL if error (fd is freed). */
+static JSFunctionDef *js_new_lazy_function_def(JSParseState *s,
+                                               JSFunctionDef *fd)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionDef *lfd;
+    JSAtomSet as;
+    int i, ret;
+    static const JSAtom pseudo_vars[] = {
+        JS_ATOM_this, JS_ATOM_new_target, JS_ATOM_home_object,
+        JS_ATOM_this_active_func, JS_ATOM_arguments,
+    };
+
+    if ((fd->func_type != JS_PARSE_FUNC_STATEMENT &&
+         fd->func_type != JS_PARSE_FUNC_VAR &&
+         fd->func_type != JS_PARSE_FUNC_EXPR) ||
+        !fd->source ||
+        fd->func_name == JS_ATOM_yield ||
+        fd->func_name == JS_ATOM_await)
+        return fd;
+    /* immediately invoked function expressions are compiled now */
+    if (fd->func_type == JS_PARSE_FUNC_EXPR &&
+        (s->token.val == '(' || s->token.val == ')'))
+        return fd;
+
+    lfd = js_new_function_def(ctx, fd->parent, FALSE, fd->is_func_expr,
+                              s->filename, fd->line_num);
+    if (!lfd)
+        goto fail;
+
+    /* the variables defined by the function are not captured */
+    memset(&as, 0, sizeof(as));
+    for(i = 0; i < countof(pseudo_vars); i++) {
+        if (js_atom_set_add(ctx, &as, pseudo_vars[i]) < 0)
+            goto fail1;
+    }
+    if (fd->is_func_expr && fd->func_name != JS_ATOM_NULL) {
+        if (js_atom_set_add(ctx, &as, fd->func_name) < 0)
+            goto fail1;
+    }
+    for(i = 0; i < fd->arg_count; i++) {
+        if (fd->args[i].var_name != JS_ATOM_NULL &&
+            js_atom_set_add(ctx, &as, fd->args[i].var_name) < 0)
+            goto fail1;
+    }
+    /* the parameter expressions cannot see the body variables */
+    if (!fd->has_parameter_expressions) {
+        for(i = 0; i < fd->var_count; i++) {
+            if (fd->vars[i].scope_level == 0 &&
+                js_atom_set_add(ctx, &as, fd->vars[i].var_name) < 0)
+                goto fail1;
+        }
+    }
+    ret = js_lazy_function_scan(ctx, fd, &as, &lfd->byte_code);
+    js_free(ctx, as.tab);
+    if (ret) {
+        if (ret < 0)
+            goto fail;
+        js_free_function_def(ctx, lfd);
+        return fd;
+    }
+    dbuf_putc(&lfd->byte_code, OP_undefined);
+    dbuf_putc(&lfd->byte_code, OP_return);
+    if (dbuf_error(&lfd->byte_code)) {
+        JS_ThrowOutOfMemory(ctx);
+        goto fail;
+    }
+
+    /* cpool[0] is the compiled function */
+    lfd->cpool = js_malloc(ctx, sizeof(lfd->cpool[0]));
+    if (!lfd->cpool)
+        goto fail;
+    lfd->cpool[0] = JS_NULL;
+    lfd->cpool_count = lfd->cpool_size = 1;
+
+    lfd->is_lazy = TRUE;
+    lfd->is_module_code = s->is_module;
+    lfd->js_mode = fd->js_mode;
+    lfd->parent_scope_level = fd->parent_scope_level;
+    lfd->func_name = fd->func_name;
+    fd->func_name = JS_ATOM_NULL;
+    lfd->source = fd->source;
+    lfd->source_len = fd->source_len;
+    fd->source = NULL;
+    lfd->func_kind = fd->func_kind;
+    lfd->func_type = fd->func_type;
+    lfd->has_prototype = fd->has_prototype;
+    lfd->has_simple_parameter_list = fd->has_simple_parameter_list;
+    lfd->defined_arg_count = fd->defined_arg_count;
+    lfd->has_this_binding = TRUE;
+    lfd->new_target_allowed = TRUE;
+    lfd->arguments_allowed = TRUE;
+    js_free_function_def(ctx, fd);
+    return lfd;
+ fail1:
+    js_free(ctx, as.tab);
+ fail:
+    if (lfd)
+        js_free_function_def(ctx, lfd);
+    js_free_function_def(ctx, fd);
+    return NULL;
+}
+
 /* func_name must be JS_ATOM_NULL for JS_PARSE_FUNC_STATEMENT and
    JS_PARSE_FUNC_EXPR, JS_PARSE_FUNC_ARROW and JS_PARSE_FUNC_VAR */
 static __exception int js_parse_function_decl2(JSParseState *s,
@@ -33737,6 +34534,12 @@ static __exception int js_parse_function_decl2(JSParseState *s,
 done:
     s->cur_func = fd->parent;
 
+    if ((fd->js_mode & JS_MODE_LAZY) && !pfd) {
+        fd = js_new_lazy_function_def(s, fd);
+        if (!fd)
+            return -1;
+    }
+
     /* create the function object */
     {
         int idx;
@@ -34014,6 +34817,8 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
             js_mode |= JS_MODE_STRICT;
         if (flags & JS_EVAL_FLAG_STRIP)
             js_mode |= JS_MODE_STRIP;
+        if (ctx->rt->lazy_compilation)
+            js_mode |= JS_MODE_LAZY;
         if (eval_type == JS_EVAL_TYPE_MODULE) {
             JSAtom module_name = JS_NewAtom(ctx, filename);
             if (module_name == JS_ATOM_NULL)
@@ -34067,10 +34872,9 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
     fun_obj = js_create_function(ctx, fd);
     if (JS_IsException(fun_obj))
         goto fail1;
-    /* Could add a flag to avoid resolution if necessary */
     if (m) {
         m->func_obj = fun_obj;
-        if (js_resolve_module(ctx, m) < 0)
+        if (!(flags & JS_EVAL_FLAG_NO_RESOLVE) && js_resolve_module(ctx, m) < 0)
             goto fail1;
         fun_obj = JS_DupValue(ctx, JS_MKPTR(JS_TAG_MODULE, m));
     }
@@ -34087,6 +34891,58 @@ static JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
     return JS_EXCEPTION;
 }
 
+/* Compile the lazy function 'b' from its source. The parent scopes
+   are only visible through the closure variables of 'b', so the
+   closure variables of the result reference the closure variables
+   of 'b' (see js_link_lazy_function()). */
+static JSValue js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSParseState s1, *s = &s1;
+    JSFunctionDef *fd, *fd1;
+    JSValue func_obj;
+    const char *filename;
+    int i;
+
+    filename = JS_AtomToCString(ctx, b->debug.filename);
+    if (!filename)
+        return JS_EXCEPTION;
+    func_obj = JS_EXCEPTION;
+    js_parse_init(ctx, s, b->debug.source, b->debug.source_len, filename,
+                  b->debug.line_num);
+    fd = js_new_function_def(ctx, NULL, TRUE, FALSE, filename,
+                             b->debug.line_num);
+    if (!fd)
+        goto done;
+    fd->eval_type = JS_EVAL_TYPE_DIRECT;
+    fd->js_mode = b->js_mode;
+    for(i = 0; i < b->closure_var_count; i++) {
+        JSClosureVar *cv = &b->closure_var[i];
+        if (add_closure_var(ctx, fd, FALSE, cv->is_arg, i, cv->var_name,
+                            cv->is_const, cv->is_lexical, cv->var_kind) < 0)
+            goto done;
+    }
+    s->cur_func = fd;
+    s->is_module = b->is_module_code;
+    s->allow_html_comments = !s->is_module;
+
+    if (next_token(s) ||
+        js_parse_function_decl2(s, JS_PARSE_FUNC_EXPR, JS_FUNC_NORMAL,
+                                JS_ATOM_NULL, s->token.ptr,
+                                s->token.line_num, JS_PARSE_EXPORT_NONE,
+                                &fd1)) {
+        free_token(s, &s->token);
+        goto done;
+    }
+    /* a function declaration does not define its name */
+    fd1->is_func_expr = b->is_func_expr;
+    func_obj = js_create_function(ctx, fd1);
+ done:
+    if (fd)
+        js_free_function_def(ctx, fd);
+    JS_FreeCString(ctx, filename);
+    return func_obj;
+}
+
 /* the indirection is needed to make 'eval' optional */
 static JSValue JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
                                const char *input, size_t input_len,
@@ -34194,7 +35050,10 @@ static void js_object_list_init(JSObjectList *s)
 
 static uint32_t js_object_list_get_hash(JSObject *p, uint32_t hash_size)
 {
-    return ((uintptr_t)p * 3163) & (hash_size - 1);
+    /* the low bits of the object addresses are always zero: use the
+       middle bits of the product */
+    return (uint32_t)(((uint64_t)(uintptr_t)p * UINT64_C(0x9e3779b97f4a7c15)) >> 32) &
+        (hash_size - 1);
 }
 
 static int js_object_list_resize_hash(JSContext *ctx, JSObjectList *s,
@@ -34299,20 +35158,69 @@ typedef enum BCTagEnum {
     BC_TAG_DATE,
     BC_TAG_OBJECT_VALUE,
     BC_TAG_OBJECT_REFERENCE,
+    BC_TAG_ARRAY_BUFFER_TRANSFER,
 } BCTagEnum;
 
+/* incremented when the serialization format changes (3/4: debug table
+   sizes precede the variable definitions of a function) */
 #ifdef CONFIG_BIGNUM
-#define BC_BASE_VERSION 2
+#define BC_BASE_VERSION 4
 #else
-#define BC_BASE_VERSION 1
+#define BC_BASE_VERSION 3
 #endif
 #define BC_BE_VERSION 0x40
+#define BC_COMPRESSED_VERSION 0x20 /* set if the data after the version
+                                      byte is compressed */
 #ifdef WORDS_BIGENDIAN
 #define BC_VERSION (BC_BASE_VERSION | BC_BE_VERSION)
 #else
 #define BC_VERSION BC_BASE_VERSION
 #endif
 
+/* BC_VERSION does not change with the opcodes or the predefined atoms,
+   so the build id adds a hash of their definitions. The bytecode is
+   compatible between the builds with the same id. */
+static const char js_bytecode_tables[] =
+#define FMT(f)
+#define DEF(id, size, n_pop, n_push, f) #id " " #size " " #n_pop " " #n_push " " #f "\0"
+#include "quickjs-opcode.h"
+#undef DEF
+#undef FMT
+#define DEF(name, str) str "\0"
+#include "quickjs-atom.h"
+#undef DEF
+;
+
+static char js_build_id[64];
+
+static void js_build_id_init(void)
+{
+    uint64_t h;
+    size_t i;
+
+    /* FNV-1a */
+    h = UINT64_C(0xcbf29ce484222325);
+    for(i = 0; i < sizeof(js_bytecode_tables); i++)
+        h = (h ^ (uint8_t)js_bytecode_tables[i]) * UINT64_C(0x100000001b3);
+    snprintf(js_build_id, sizeof(js_build_id), "%s bc%d-%016" PRIx64,
+             QUICKJS_VERSION, BC_VERSION, h);
+}
+
+#ifdef CONFIG_ATOMICS
+static pthread_once_t js_build_id_once = PTHREAD_ONCE_INIT;
+#endif
+
+const char *JS_GetBuildId(void)
+{
+#ifdef CONFIG_ATOMICS
+    pthread_once(&js_build_id_once, js_build_id_init);
+#else
+    if (!js_build_id[0])
+        js_build_id_init();
+#endif
+    return js_build_id;
+}
+
 typedef struct BCWriterState {
     JSContext *ctx;
     DynBuf dbuf;
@@ -34320,6 +35228,7 @@ typedef struct BCWriterState {
     BOOL allow_bytecode : 8;
     BOOL allow_sab : 8;
     BOOL allow_reference : 8;
+    BOOL strip_debug : 8;
     uint32_t first_atom;
     uint32_t *atom_to_idx;
     int atom_to_idx_size;
@@ -34331,6 +35240,9 @@ typedef struct BCWriterState {
     int sab_tab_size;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
+    /* ArrayBuffers which are moved instead of copied */
+    JSObject **transfer_tab;
+    int transfer_len;
 } BCWriterState;
 
 #ifdef DUMP_READ_OBJECT
@@ -34357,6 +35269,7 @@ static const char * const bc_tag_str[] = {
     "Date",
     "ObjectValue",
     "ObjectReference",
+    "ArrayBufferTransfer",
 };
 #endif
 
@@ -34720,6 +35633,8 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     uint32_t flags;
     int idx, i;
 
+    if (b->atom_reloc_pending && js_relocate_bytecode(s->ctx, b))
+        goto fail;
     bc_put_u8(s, BC_TAG_FUNCTION_BYTECODE);
     flags = idx = 0;
     bc_set_flags(&flags, &idx, b->has_prototype, 1);
@@ -34733,6 +35648,9 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     bc_set_flags(&flags, &idx, b->arguments_allowed, 1);
     bc_set_flags(&flags, &idx, b->has_debug, 1);
     bc_set_flags(&flags, &idx, b->backtrace_barrier, 1);
+    bc_set_flags(&flags, &idx, b->is_lazy, 1);
+    bc_set_flags(&flags, &idx, b->is_func_expr, 1);
+    bc_set_flags(&flags, &idx, b->is_module_code, 1);
     assert(idx <= 16);
     bc_put_u16(s, flags);
     bc_put_u8(s, b->js_mode);
@@ -34745,6 +35663,16 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     bc_put_leb128(s, b->closure_var_count);
     bc_put_leb128(s, b->cpool_count);
     bc_put_leb128(s, b->byte_code_len);
+    /* the size of the debug information is known before it is read so
+       that the function can be allocated at once */
+    if (b->has_debug) {
+        bc_put_atom(s, b->debug.filename);
+        bc_put_leb128(s, b->debug.line_num);
+        bc_put_leb128(s, s->strip_debug ? 0 : b->debug.pc2line_len);
+        /* the source is needed to compile a lazy function */
+        if (b->is_lazy)
+            bc_put_leb128(s, b->debug.source_len);
+    }
     if (b->vardefs) {
         /* XXX: this field is redundant */
         bc_put_leb128(s, b->arg_count + b->var_count);
@@ -34783,10 +35711,14 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
         goto fail;
 
     if (b->has_debug) {
-        bc_put_atom(s, b->debug.filename);
-        bc_put_leb128(s, b->debug.line_num);
-        bc_put_leb128(s, b->debug.pc2line_len);
-        dbuf_put(&s->dbuf, b->debug.pc2line_buf, b->debug.pc2line_len);
+        if (!s->strip_debug)
+            dbuf_put(&s->dbuf, b->debug.pc2line_buf, b->debug.pc2line_len);
+        if (b->is_lazy) {
+            /* zero terminated so that it can be parsed in place */
+            dbuf_put(&s->dbuf, (const uint8_t *)b->debug.source,
+                     b->debug.source_len);
+            bc_put_u8(s, '\0');
+        }
     }
 
     for(i = 0; i < b->cpool_count; i++) {
@@ -34867,6 +35799,12 @@ static int JS_WriteArray(BCWriterState *s, JSValueConst obj)
         goto fail1;
     bc_put_leb128(s, len);
     for(i = 0; i < len; i++) {
+        /* fast path for the dense arrays of plain data */
+        if (likely(p->fast_array && i < p->u.array.count)) {
+            if (JS_WriteObjectRec(s, p->u.array.u.values[i]))
+                goto fail1;
+            continue;
+        }
         val = JS_GetPropertyUint32(s->ctx, obj, i);
         if (JS_IsException(val))
             goto fail1;
@@ -34946,10 +35884,20 @@ static int JS_WriteArrayBuffer(BCWriterState *s, JSValueConst obj)
 {
     JSObject *p = JS_VALUE_GET_OBJ(obj);
     JSArrayBuffer *abuf = p->u.array_buffer;
+    int i;
+
     if (abuf->detached) {
         JS_ThrowTypeErrorDetachedArrayBuffer(s->ctx);
         return -1;
     }
+    for(i = 0; i < s->transfer_len; i++) {
+        if (s->transfer_tab[i] == p) {
+            /* only the index in the transfer list is stored */
+            bc_put_u8(s, BC_TAG_ARRAY_BUFFER_TRANSFER);
+            bc_put_leb128(s, i);
+            return 0;
+        }
+    }
     bc_put_u8(s, BC_TAG_ARRAY_BUFFER);
     bc_put_leb128(s, abuf->byte_length);
     dbuf_put(&s->dbuf, abuf->data, abuf->byte_length);
@@ -35149,10 +36097,77 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     return -1;
 }
 
-uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
-                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+/* compress the data following the version byte. The output is the
+   version byte with BC_COMPRESSED_VERSION set, the uncompressed and
+   compressed lengths, and the compressed block. */
+static int JS_WriteObjectCompress(BCWriterState *s)
+{
+    DynBuf dbuf1, block;
+
+    dbuf_init2(&block, s->dbuf.opaque, s->dbuf.realloc_func);
+    if (lz_block_compress(&block, s->dbuf.buf + 1, s->dbuf.size - 1))
+        goto fail;
+    dbuf_init2(&dbuf1, s->dbuf.opaque, s->dbuf.realloc_func);
+    dbuf_putc(&dbuf1, s->dbuf.buf[0] | BC_COMPRESSED_VERSION);
+    dbuf_put_leb128(&dbuf1, s->dbuf.size - 1);
+    dbuf_put_leb128(&dbuf1, block.size);
+    dbuf_put(&dbuf1, block.buf, block.size);
+    dbuf_free(&block);
+    if (dbuf_error(&dbuf1)) {
+        dbuf_free(&dbuf1);
+        return -1;
+    }
+    dbuf_free(&s->dbuf);
+    s->dbuf = dbuf1;
+    return 0;
+ fail:
+    dbuf_free(&block);
+    return -1;
+}
+
+/* return the data of the ArrayBuffer 'p' in a buffer allocated with
+   malloc() and detach it. The data is not copied if it was allocated
+   with the default allocator. 'copy' is NULL or a buffer of
+   max(byte_length, 1) bytes allocated with malloc(). */
+static uint8_t *js_array_buffer_transfer(JSContext *ctx, JSObject *p,
+                                         uint8_t *copy)
+{
+    JSRuntime *rt = ctx->rt;
+    JSArrayBuffer *abuf = p->u.array_buffer;
+    uint8_t *data = abuf->data;
+
+    if (copy) {
+        memcpy(copy, data, abuf->byte_length);
+        if (abuf->free_func)
+            abuf->free_func(rt, abuf->opaque, data);
+        data = copy;
+    } else if (abuf->free_func == js_array_buffer_free) {
+        /* remove the buffer from the memory accounting of the runtime */
+        rt->malloc_state.malloc_count--;
+        rt->malloc_state.malloc_size -= js_def_malloc_usable_size(data) + MALLOC_OVERHEAD;
+    }
+    abuf->free_func = NULL;
+    JS_DetachArrayBuffer(ctx, JS_MKPTR(JS_TAG_OBJECT, p));
+    return data;
+}
+
+/* TRUE if js_array_buffer_transfer() can move the data of 'p' without
+   copying it */
+static BOOL js_array_buffer_can_transfer(JSRuntime *rt, JSObject *p)
+{
+    JSArrayBuffer *abuf = p->u.array_buffer;
+    return (abuf->free_func == js_array_buffer_free_malloc ||
+            (abuf->free_func == js_array_buffer_free &&
+             rt->mf.js_malloc == js_def_malloc));
+}
+
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list, int transfer_len,
+                         JSArrayBufferTransfer *transfer_tab)
 {
     BCWriterState ss, *s = &ss;
+    int i, j;
 
     memset(s, 0, sizeof(*s));
     s->ctx = ctx;
@@ -35161,18 +36176,68 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
     s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0);
+    s->strip_debug = ((flags & JS_WRITE_OBJ_STRIP_DEBUG) != 0);
     /* XXX: could use a different version when bytecode is included */
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
         s->first_atom = 1;
-    js_dbuf_init(ctx, &s->dbuf);
+    if (flags & JS_WRITE_OBJ_MALLOC)
+        dbuf_init(&s->dbuf);
+    else
+        js_dbuf_init(ctx, &s->dbuf);
     js_object_list_init(&s->object_list);
 
+    if (transfer_len > 0) {
+        /* the whole table is freed by fail_transfer */
+        memset(transfer_tab, 0, sizeof(transfer_tab[0]) * transfer_len);
+        s->transfer_tab = js_mallocz(ctx, sizeof(s->transfer_tab[0]) * transfer_len);
+        if (!s->transfer_tab)
+            goto fail;
+        for(i = 0; i < transfer_len; i++) {
+            JSObject *p;
+            if (JS_VALUE_GET_TAG(transfer_list[i]) != JS_TAG_OBJECT ||
+                JS_VALUE_GET_OBJ(transfer_list[i])->class_id != JS_CLASS_ARRAY_BUFFER) {
+                JS_ThrowTypeError(ctx, "only ArrayBuffers can be transferred");
+                goto fail_transfer;
+            }
+            p = JS_VALUE_GET_OBJ(transfer_list[i]);
+            if (p->u.array_buffer->detached) {
+                JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+                goto fail_transfer;
+            }
+            for(j = 0; j < i; j++) {
+                if (s->transfer_tab[j] == p) {
+                    JS_ThrowTypeError(ctx, "duplicate ArrayBuffer in transfer list");
+                    goto fail_transfer;
+                }
+            }
+            s->transfer_tab[i] = p;
+            /* allocate the copies before modifying anything */
+            if (!js_array_buffer_can_transfer(ctx->rt, p)) {
+                transfer_tab[i].data = js_malloc_libc(max_int(p->u.array_buffer->byte_length, 1));
+                if (!transfer_tab[i].data) {
+                    JS_ThrowOutOfMemory(ctx);
+                    goto fail_transfer;
+                }
+            }
+        }
+        s->transfer_len = transfer_len;
+    }
+
     if (JS_WriteObjectRec(s, obj))
-        goto fail;
+        goto fail_transfer;
     if (JS_WriteObjectAtoms(s))
-        goto fail;
+        goto fail_transfer;
+    if ((flags & JS_WRITE_OBJ_COMPRESS) && JS_WriteObjectCompress(s))
+        goto fail_transfer;
+    /* the message is complete: move the ArrayBuffer contents */
+    for(i = 0; i < s->transfer_len; i++) {
+        transfer_tab[i].byte_length = s->transfer_tab[i]->u.array_buffer->byte_length;
+        transfer_tab[i].data = js_array_buffer_transfer(ctx, s->transfer_tab[i],
+                                                        transfer_tab[i].data);
+    }
+    js_free(ctx, s->transfer_tab);
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
@@ -35182,7 +36247,14 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     if (psab_tab_len)
         *psab_tab_len = s->sab_tab_len;
     return s->dbuf.buf;
+ fail_transfer:
+    for(i = 0; i < transfer_len; i++) {
+        js_free_libc(transfer_tab[i].data);
+        transfer_tab[i].data = NULL;
+    }
  fail:
+    js_free(ctx, s->transfer_tab);
+    js_free(ctx, s->sab_tab);
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
@@ -35195,12 +36267,22 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     return NULL;
 }
 
+uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+{
+    return JS_WriteObject3(ctx, psize, obj, flags, psab_tab, psab_tab_len,
+                           NULL, 0, NULL);
+}
+
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags)
 {
     return JS_WriteObject2(ctx, psize, obj, flags, NULL, NULL);
 }
 
+#define BC_SHAPE_CACHE_SIZE 8 /* must be a power of two */
+#define BC_SHAPE_CACHE_MAX_PROPS 16
+
 typedef struct BCReaderState {
     JSContext *ctx;
     const uint8_t *buf_start, *ptr, *buf_end;
@@ -35212,10 +36294,23 @@ typedef struct BCReaderState {
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
     BOOL allow_reference : 8;
+    /* uncompressed data (allocated) and end of the compressed data */
+    uint8_t *unpacked_buf;
+    const uint8_t *packed_end;
+    /* read only data */
+    JSAtomMap *atom_map;
+    JSFreeArrayBufferDataFunc *rom_free_func;
+    void *rom_opaque;
     /* object references */
     JSObject **objects;
     int objects_count;
     int objects_size;
+    /* transferred ArrayBuffers */
+    JSArrayBufferTransfer *transfer_tab;
+    int transfer_len;
+    /* shapes of the last plain objects read, reused by the following
+       objects with the same properties */
+    JSShape *shape_cache[BC_SHAPE_CACHE_SIZE];
 
 #ifdef DUMP_READ_OBJECT
     const uint8_t *ptr_last;
@@ -35443,16 +36538,20 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
     uint32_t idx;
 
     if (s->is_rom_data) {
-        /* directly use the input buffer */
+        /* directly use the input buffer. The atoms are relocated when
+           the function is first called. */
         if (unlikely(s->buf_end - s->ptr < bc_len))
             return bc_read_error_end(s);
-        bc_buf = (uint8_t *)s->ptr;
+        b->byte_code_buf = (uint8_t *)s->ptr;
         s->ptr += bc_len;
-    } else {
-        bc_buf = (void *)((uint8_t*)b + byte_code_offset);
-        if (bc_get_buf(s, bc_buf, bc_len))
-            return -1;
+        b->atom_map = s->atom_map;
+        b->atom_map->ref_count++;
+        b->atom_reloc_pending = !s->atom_map->identity;
+        return 0;
     }
+    bc_buf = (void *)((uint8_t*)b + byte_code_offset);
+    if (bc_get_buf(s, bc_buf, bc_len))
+        return -1;
     b->byte_code_buf = bc_buf;
 
     pos = 0;
@@ -35466,20 +36565,15 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
             idx = get_u32(bc_buf + pos + 1);
-            if (s->is_rom_data) {
-                /* just increment the reference count of the atom */
-                JS_DupAtom(s->ctx, (JSAtom)idx);
-            } else {
-                if (bc_idx_to_atom(s, &atom, idx)) {
-                    /* Note: the atoms will be freed up to this position */
-                    b->byte_code_len = pos;
-                    return -1;
-                }
-                put_u32(bc_buf + pos + 1, atom);
+            if (bc_idx_to_atom(s, &atom, idx)) {
+                /* Note: the atoms will be freed up to this position */
+                b->byte_code_len = pos;
+                return -1;
+            }
+            put_u32(bc_buf + pos + 1, atom);
 #ifdef DUMP_READ_OBJECT
-                bc_read_trace(s, "at %d, fixup atom: ", pos + 1); print_atom(s->ctx, atom); printf("\n");
+            bc_read_trace(s, "at %d, fixup atom: ", pos + 1); print_atom(s->ctx, atom); printf("\n");
 #endif
-            }
             break;
         default:
             break;
@@ -35651,7 +36745,8 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     uint8_t v8;
     int idx, i, local_count;
     int function_size, cpool_offset, byte_code_offset;
-    int closure_var_offset, vardefs_offset;
+    int closure_var_offset, vardefs_offset, debug_offset;
+    JSAtom filename = JS_ATOM_NULL;
 
     memset(&bc, 0, sizeof(bc));
     bc.header.ref_count = 1;
@@ -35671,6 +36766,9 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     bc.arguments_allowed = bc_get_flags(v16, &idx, 1);
     bc.has_debug = bc_get_flags(v16, &idx, 1);
     bc.backtrace_barrier = bc_get_flags(v16, &idx, 1);
+    bc.is_lazy = bc_get_flags(v16, &idx, 1);
+    bc.is_func_expr = bc_get_flags(v16, &idx, 1);
+    bc.is_module_code = bc_get_flags(v16, &idx, 1);
     bc.read_only_bytecode = s->is_rom_data;
     if (bc_get_u8(s, &v8))
         goto fail;
@@ -35691,6 +36789,22 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
         goto fail;
     if (bc_get_leb128_int(s, &bc.byte_code_len))
         goto fail;
+    if (bc.has_debug) {
+        if (bc_get_atom(s, &filename))
+            goto fail;
+        if (bc_get_leb128_int(s, &bc.debug.line_num))
+            goto fail;
+        if (bc_get_leb128_int(s, &bc.debug.pc2line_len))
+            goto fail;
+        if (bc.is_lazy && bc_get_leb128_int(s, &bc.debug.source_len))
+            goto fail;
+        if (bc.debug.pc2line_len < 0 || bc.debug.source_len < 0 ||
+            bc.debug.pc2line_len + (int64_t)bc.debug.source_len + bc.is_lazy >
+            s->buf_end - s->ptr) {
+            bc_read_error_end(s);
+            goto fail;
+        }
+    }
     if (bc_get_leb128_int(s, &local_count))
         goto fail;
 
@@ -35709,13 +36823,38 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     if (!bc.read_only_bytecode) {
         function_size += bc.byte_code_len;
     }
+    /* the debug information is allocated with the function or is read
+       in place */
+    debug_offset = function_size;
+    if (bc.has_debug && !bc.read_only_bytecode) {
+        function_size += bc.debug.pc2line_len;
+        if (bc.is_lazy)
+            function_size += bc.debug.source_len + 1;
+    }
 
     b = js_mallocz(ctx, function_size);
-    if (!b)
+    if (!b) {
+        JS_FreeAtom(ctx, filename);
         return JS_EXCEPTION;
+    }
+    ctx->rt->stats.js_func_alloc_count++;
+    ctx->rt->stats.js_func_alloc_size += function_size;
 
     memcpy(b, &bc, offsetof(JSFunctionBytecode, debug));
     b->header.ref_count = 1;
+    if (bc.has_debug) {
+        b->inline_debug = TRUE;
+        b->debug.filename = filename;
+        b->debug.line_num = bc.debug.line_num;
+        b->debug.pc2line_len = bc.debug.pc2line_len;
+        b->debug.source_len = bc.debug.source_len;
+        if (!b->read_only_bytecode) {
+            if (b->debug.pc2line_len != 0)
+                b->debug.pc2line_buf = (uint8_t *)b + debug_offset;
+            if (b->is_lazy)
+                b->debug.source = (char *)b + debug_offset + b->debug.pc2line_len;
+        }
+    }
     if (local_count != 0) {
         b->vardefs = (void *)((uint8_t*)b + vardefs_offset);
     }
@@ -35796,18 +36935,34 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     if (b->has_debug) {
         /* read optional debug information */
         bc_read_trace(s, "debug {\n");
-        if (bc_get_atom(s, &b->debug.filename))
-            goto fail;
-        if (bc_get_leb128_int(s, &b->debug.line_num))
-            goto fail;
-        if (bc_get_leb128_int(s, &b->debug.pc2line_len))
-            goto fail;
-        if (b->debug.pc2line_len) {
-            b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
-            if (!b->debug.pc2line_buf)
+        if (b->read_only_bytecode) {
+            /* the check made with the header does not account for the
+               variables and the bytecode read since then */
+            if (b->debug.pc2line_len +
+                (b->is_lazy ? (int64_t)b->debug.source_len + 1 : 0) >
+                s->buf_end - s->ptr) {
+                bc_read_error_end(s);
                 goto fail;
+            }
+            if (b->debug.pc2line_len != 0)
+                b->debug.pc2line_buf = (uint8_t *)s->ptr;
+            s->ptr += b->debug.pc2line_len;
+            if (b->is_lazy) {
+                b->debug.source = (char *)s->ptr;
+                s->ptr += b->debug.source_len + 1;
+                if (s->ptr[-1] != '\0') {
+                    JS_ThrowSyntaxError(ctx, "invalid function source");
+                    goto fail;
+                }
+            }
+        } else {
             if (bc_get_buf(s, b->debug.pc2line_buf, b->debug.pc2line_len))
                 goto fail;
+            if (b->is_lazy) {
+                if (bc_get_buf(s, (uint8_t *)b->debug.source,
+                               b->debug.source_len + 1))
+                    goto fail;
+            }
         }
 #ifdef DUMP_READ_OBJECT
         bc_read_trace(s, "filename: "); print_atom(s->ctx, b->debug.filename); printf("\n");
@@ -35828,6 +36983,8 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     b->realm = JS_DupContext(ctx);
     return obj;
  fail:
+    if (JS_IsUndefined(obj))
+        JS_FreeAtom(ctx, filename);
     JS_FreeValue(ctx, obj);
     return JS_EXCEPTION;
 }
@@ -35933,6 +37090,110 @@ static JSValue JS_ReadModule(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+/* define the property 'atom' of the plain object 'obj' being read. 'val'
+   is freed. */
+static int bc_define_object_prop(JSContext *ctx, JSValueConst obj,
+                                 JSAtom atom, JSValue val)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSProperty *pr;
+
+    /* the object was created by the reader, so a property which is not
+       already defined can be added directly */
+    if (unlikely(find_own_property1(p, atom)))
+        return JS_DefinePropertyValue(ctx, obj, atom, val, JS_PROP_C_W_E);
+    pr = add_property(ctx, p, atom, JS_PROP_C_W_E);
+    if (!pr) {
+        JS_FreeValue(ctx, val);
+        return -1;
+    }
+    pr->u.value = val;
+    return 0;
+}
+
+/* Plain objects with the same properties in the same order (e.g. the
+   records of an array) share the shape of the first one instead of
+   building a new shape property by property. */
+static JSValue JS_ReadObjectTagShaped(BCReaderState *s, JSValue obj,
+                                      uint32_t prop_count)
+{
+    JSContext *ctx = s->ctx;
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSAtom atoms[BC_SHAPE_CACHE_MAX_PROPS];
+    JSValue vals[BC_SHAPE_CACHE_MAX_PROPS];
+    JSShape *sh, **psh;
+    JSShapeProperty *prs;
+    uint32_t i, n;
+    int ret;
+
+    for(n = 0; n < prop_count; n++) {
+        if (bc_get_atom(s, &atoms[n]))
+            goto fail;
+#ifdef DUMP_READ_OBJECT
+        bc_read_trace(s, "propname: "); print_atom(s->ctx, atoms[n]); printf("\n");
+#endif
+        vals[n] = JS_ReadObjectRec(s);
+        if (JS_IsException(vals[n])) {
+            JS_FreeAtom(ctx, atoms[n]);
+            goto fail;
+        }
+    }
+
+    psh = &s->shape_cache[(atoms[0] + prop_count) & (BC_SHAPE_CACHE_SIZE - 1)];
+    sh = *psh;
+    if (sh && sh->prop_count == prop_count && sh->proto == p->shape->proto) {
+        prs = get_shape_prop(sh);
+        for(i = 0; i < prop_count; i++) {
+            if (prs[i].atom != atoms[i])
+                break;
+        }
+        if (i == prop_count) {
+            /* 'obj' has no property yet: switch to the cached shape */
+            if (sh->prop_size != p->shape->prop_size) {
+                JSProperty *new_prop;
+                new_prop = js_realloc(ctx, p->prop,
+                                      sizeof(p->prop[0]) * sh->prop_size);
+                if (!new_prop)
+                    goto fail;
+                p->prop = new_prop;
+            }
+            js_free_shape(ctx->rt, p->shape);
+            p->shape = js_dup_shape(sh);
+            for(i = 0; i < prop_count; i++) {
+                p->prop[i].u.value = vals[i];
+                JS_FreeAtom(ctx, atoms[i]);
+            }
+            return obj;
+        }
+    }
+
+    for(i = 0; i < prop_count; i++) {
+        ret = bc_define_object_prop(ctx, obj, atoms[i], vals[i]);
+        JS_FreeAtom(ctx, atoms[i]);
+        if (ret < 0) {
+            i++;
+            goto fail_define;
+        }
+    }
+    /* only the shapes without duplicate properties can be reused */
+    sh = p->shape;
+    if (sh->is_hashed && sh->prop_count == prop_count) {
+        if (*psh)
+            js_free_shape(ctx->rt, *psh);
+        *psh = js_dup_shape(sh);
+    }
+    return obj;
+ fail:
+    i = 0;
+ fail_define:
+    for(; i < n; i++) {
+        JS_FreeValue(ctx, vals[i]);
+        JS_FreeAtom(ctx, atoms[i]);
+    }
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
 static JSValue JS_ReadObjectTag(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -35947,6 +37208,8 @@ static JSValue JS_ReadObjectTag(BCReaderState *s)
         goto fail;
     if (bc_get_leb128(s, &prop_count))
         goto fail;
+    if (prop_count != 0 && prop_count <= BC_SHAPE_CACHE_MAX_PROPS)
+        return JS_ReadObjectTagShaped(s, obj, prop_count);
     for(i = 0; i < prop_count; i++) {
         if (bc_get_atom(s, &atom))
             goto fail;
@@ -35958,7 +37221,7 @@ static JSValue JS_ReadObjectTag(BCReaderState *s)
             JS_FreeAtom(ctx, atom);
             goto fail;
         }
-        ret = JS_DefinePropertyValue(ctx, obj, atom, val, JS_PROP_C_W_E);
+        ret = bc_define_object_prop(ctx, obj, atom, val);
         JS_FreeAtom(ctx, atom);
         if (ret < 0)
             goto fail;
@@ -35984,10 +37247,24 @@ static JSValue JS_ReadArray(BCReaderState *s, int tag)
     is_template = (tag == BC_TAG_TEMPLATE_OBJECT);
     if (bc_get_leb128(s, &len))
         goto fail;
+    /* each element takes at least one byte, so the allocation is
+       bounded by the input size */
+    if (!is_template && len > 0 &&
+        expand_fast_array(ctx, JS_VALUE_GET_OBJ(obj),
+                          min_uint32(len, s->buf_end - s->ptr)))
+        goto fail;
     for(i = 0; i < len; i++) {
+        JSObject *p;
         val = JS_ReadObjectRec(s);
         if (JS_IsException(val))
             goto fail;
+        /* fast path: append to the dense array */
+        p = JS_VALUE_GET_OBJ(obj);
+        if (likely(!is_template && p->fast_array && i == p->u.array.count)) {
+            if (add_fast_array_element(ctx, p, val, 0) < 0)
+                goto fail;
+            continue;
+        }
         if (is_template)
             prop_flags = JS_PROP_ENUMERABLE;
         else
@@ -36085,6 +37362,33 @@ static JSValue JS_ReadArrayBuffer(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static JSValue JS_ReadArrayBufferTransfer(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSArrayBufferTransfer *t;
+    uint32_t idx;
+    JSValue obj;
+
+    if (bc_get_leb128(s, &idx))
+        return JS_EXCEPTION;
+    if (idx >= s->transfer_len || !s->transfer_tab[idx].data)
+        return JS_ThrowSyntaxError(ctx, "invalid transferred ArrayBuffer");
+    t = &s->transfer_tab[idx];
+    obj = js_array_buffer_constructor3(ctx, JS_UNDEFINED, t->byte_length,
+                                       JS_CLASS_ARRAY_BUFFER, t->data,
+                                       js_array_buffer_free_malloc, NULL,
+                                       FALSE);
+    if (JS_IsException(obj))
+        return JS_EXCEPTION;
+    /* the ArrayBuffer now owns the data */
+    t->data = NULL;
+    if (BC_add_object_ref(s, obj)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    return obj;
+}
+
 static JSValue JS_ReadSharedArrayBuffer(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -36247,6 +37551,11 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             goto invalid_tag;
         obj = JS_ReadSharedArrayBuffer(s);
         break;
+    case BC_TAG_ARRAY_BUFFER_TRANSFER:
+        if (!s->transfer_tab)
+            goto invalid_tag;
+        obj = JS_ReadArrayBufferTransfer(s);
+        break;
     case BC_TAG_DATE:
         obj = JS_ReadDate(s);
         break;
@@ -36284,6 +37593,33 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
     return obj;
 }
 
+/* uncompress the data following the version byte and continue
+   reading from the uncompressed data */
+static int JS_ReadObjectUncompress(BCReaderState *s)
+{
+    uint32_t raw_len, packed_len;
+
+    if (bc_get_leb128(s, &raw_len))
+        return -1;
+    if (bc_get_leb128(s, &packed_len))
+        return -1;
+    if (s->buf_end - s->ptr < packed_len)
+        return bc_read_error_end(s);
+    s->packed_end = s->ptr + packed_len;
+    s->unpacked_buf = js_malloc(s->ctx, max_int(raw_len, 1));
+    if (!s->unpacked_buf)
+        return s->error_state = -1;
+    if (lz_block_decompress(s->unpacked_buf, raw_len, s->ptr, packed_len)) {
+        JS_ThrowSyntaxError(s->ctx, "invalid compressed data");
+        return s->error_state = -1;
+    }
+    s->buf_start = s->ptr = s->unpacked_buf;
+    s->buf_end = s->unpacked_buf + raw_len;
+    /* the objects cannot reference the temporary buffer */
+    s->is_rom_data = FALSE;
+    return 0;
+}
+
 static int JS_ReadObjectAtoms(BCReaderState *s)
 {
     uint8_t v8;
@@ -36293,6 +37629,11 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
 
     if (bc_get_u8(s, &v8))
         return -1;
+    if (v8 == (BC_VERSION | BC_COMPRESSED_VERSION)) {
+        if (JS_ReadObjectUncompress(s))
+            return -1;
+        v8 = BC_VERSION;
+    }
     /* XXX: could support byte swapped input */
     if (v8 != BC_VERSION) {
         JS_ThrowSyntaxError(s->ctx, "invalid version (%d expected=%d)",
@@ -36304,7 +37645,21 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
 
     bc_read_trace(s, "%d atom indexes {\n", s->idx_to_atom_count);
 
-    if (s->idx_to_atom_count != 0) {
+    if (s->is_rom_data) {
+        /* the atoms are kept by the functions using the buffer */
+        s->atom_map = js_mallocz(s->ctx, sizeof(JSAtomMap) +
+                                 s->idx_to_atom_count * sizeof(JSAtom));
+        if (!s->atom_map)
+            return s->error_state = -1;
+        s->atom_map->ref_count = 1;
+        s->atom_map->identity = TRUE;
+        s->atom_map->first_atom = s->first_atom;
+        s->atom_map->count = s->idx_to_atom_count;
+        s->atom_map->buf = s->buf_start;
+        s->atom_map->free_func = s->rom_free_func;
+        s->atom_map->opaque = s->rom_opaque;
+        s->idx_to_atom = s->atom_map->atoms;
+    } else if (s->idx_to_atom_count != 0) {
         s->idx_to_atom = js_mallocz(s->ctx, s->idx_to_atom_count *
                                     sizeof(s->idx_to_atom[0]));
         if (!s->idx_to_atom)
@@ -36318,8 +37673,8 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
         if (atom == JS_ATOM_NULL)
             return s->error_state = -1;
         s->idx_to_atom[i] = atom;
-        if (s->is_rom_data && (atom != (i + s->first_atom)))
-            s->is_rom_data = FALSE; /* atoms must be relocated */
+        if (s->atom_map && (atom != (i + s->first_atom)))
+            s->atom_map->identity = FALSE; /* atoms must be relocated */
     }
     bc_read_trace(s, "}\n");
     return 0;
@@ -36328,20 +37683,36 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
 static void bc_reader_free(BCReaderState *s)
 {
     int i;
-    if (s->idx_to_atom) {
-        for(i = 0; i < s->idx_to_atom_count; i++) {
-            JS_FreeAtom(s->ctx, s->idx_to_atom[i]);
+    if (s->atom_map) {
+        /* 'buf' is freed when it is no longer used by the functions */
+        js_atom_map_free(s->ctx->rt, s->atom_map);
+    } else {
+        if (s->idx_to_atom) {
+            for(i = 0; i < s->idx_to_atom_count; i++) {
+                JS_FreeAtom(s->ctx, s->idx_to_atom[i]);
+            }
+            js_free(s->ctx, s->idx_to_atom);
         }
-        js_free(s->ctx, s->idx_to_atom);
+    }
+    for(i = 0; i < BC_SHAPE_CACHE_SIZE; i++) {
+        if (s->shape_cache[i])
+            js_free_shape(s->ctx->rt, s->shape_cache[i]);
     }
     js_free(s->ctx, s->objects);
+    js_free(s->ctx, s->unpacked_buf);
 }
 
-JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
-                       int flags, size_t* premnants_len)
+static JSValue JS_ReadObjectInternal(JSContext *ctx, const uint8_t *buf,
+                                     size_t buf_len, int flags,
+                                     size_t *premnants_len,
+                                     JSArrayBufferTransfer *transfer_tab,
+                                     int transfer_len,
+                                     JSFreeArrayBufferDataFunc *free_func,
+                                     void *opaque)
 {
     BCReaderState ss, *s = &ss;
     JSValue obj;
+    BOOL buf_used;
 
     ctx->binary_object_count += 1;
     ctx->binary_object_size += buf_len;
@@ -36355,6 +37726,10 @@ JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->transfer_tab = transfer_tab;
+    s->transfer_len = transfer_len;
+    s->rom_free_func = free_func;
+    s->rom_opaque = opaque;
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
@@ -36364,11 +37739,42 @@ JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     } else {
         obj = JS_ReadObjectRec(s);
     }
-    *premnants_len = s->buf_end - s->ptr;
+    if (premnants_len) {
+        if (s->unpacked_buf)
+            *premnants_len = (buf + buf_len) - s->packed_end;
+        else
+            *premnants_len = s->buf_end - s->ptr;
+    }
+    buf_used = (s->atom_map != NULL);
     bc_reader_free(s);
+    if (free_func && !buf_used)
+        free_func(ctx->rt, opaque, (void *)buf);
     return obj;
 }
 
+JSValue JS_ReadObject3(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, size_t *premnants_len,
+                       JSArrayBufferTransfer *transfer_tab, int transfer_len)
+{
+    return JS_ReadObjectInternal(ctx, buf, buf_len, flags, premnants_len,
+                                 transfer_tab, transfer_len, NULL, NULL);
+}
+
+JSValue JS_ReadObjectROM(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                         int flags, JSFreeArrayBufferDataFunc *free_func,
+                         void *opaque)
+{
+    return JS_ReadObjectInternal(ctx, buf, buf_len,
+                                 flags | JS_READ_OBJ_ROM_DATA, NULL,
+                                 NULL, 0, free_func, opaque);
+}
+
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, size_t* premnants_len)
+{
+    return JS_ReadObject3(ctx, buf, buf_len, flags, premnants_len, NULL, 0);
+}
+
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
   int flags)
 {
@@ -42562,6 +43968,168 @@ static void js_regexp_finalizer(JSRuntime *rt, JSValue val)
     JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, re->pattern));
 }
 
+/* RegExp cache */
+
+static uint32_t regexp_cache_hash(const JSString *pattern, int re_flags)
+{
+    return hash_string(pattern, re_flags) * 0x9e370001;
+}
+
+static size_t regexp_cache_entry_size(const JSRegExpCacheEntry *e)
+{
+    return sizeof(*e) + (e->pattern->len << e->pattern->is_wide_char) +
+        e->bytecode->len;
+}
+
+static void regexp_cache_remove(JSRuntime *rt, JSRegExpCacheEntry *e)
+{
+    JSRegExpCacheEntry **pe;
+
+    pe = &rt->regexp_cache_hash[e->hash >> (32 - rt->regexp_cache_hash_bits)];
+    while (*pe != e)
+        pe = &(*pe)->hash_next;
+    *pe = e->hash_next;
+    list_del(&e->link);
+    rt->regexp_cache_count--;
+    rt->regexp_cache_size -= regexp_cache_entry_size(e);
+    JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->pattern));
+    JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+    js_free_rt(rt, e);
+}
+
+/* evict the least recently used entries until the limits are respected */
+static void regexp_cache_trim(JSRuntime *rt, int max_count, size_t max_size)
+{
+    JSRegExpCacheEntry *e;
+
+    while (rt->regexp_cache_count > max_count ||
+           rt->regexp_cache_size > max_size) {
+        e = list_entry(rt->regexp_cache_lru.prev, JSRegExpCacheEntry, link);
+        regexp_cache_remove(rt, e);
+    }
+}
+
+static int regexp_cache_resize(JSRuntime *rt, int new_hash_bits)
+{
+    JSRegExpCacheEntry **new_hash, *e, *e_next;
+    int i, old_size;
+    uint32_t h;
+
+    new_hash = js_mallocz_rt(rt, sizeof(new_hash[0]) << new_hash_bits);
+    if (!new_hash)
+        return -1;
+    old_size = rt->regexp_cache_hash ? 1 << rt->regexp_cache_hash_bits : 0;
+    for(i = 0; i < old_size; i++) {
+        for(e = rt->regexp_cache_hash[i]; e != NULL; e = e_next) {
+            e_next = e->hash_next;
+            h = e->hash >> (32 - new_hash_bits);
+            e->hash_next = new_hash[h];
+            new_hash[h] = e;
+        }
+    }
+    js_free_rt(rt, rt->regexp_cache_hash);
+    rt->regexp_cache_hash = new_hash;
+    rt->regexp_cache_hash_bits = new_hash_bits;
+    return 0;
+}
+
+/* return the cached bytecode or JS_UNDEFINED if not found */
+static JSValue js_regexp_cache_find(JSRuntime *rt, JSString *pattern,
+                                    int re_flags)
+{
+    JSRegExpCacheEntry *e;
+    uint32_t h;
+
+    if (rt->regexp_cache_max_count <= 0)
+        return JS_UNDEFINED;
+    if (rt->regexp_cache_hash) {
+        h = regexp_cache_hash(pattern, re_flags);
+        for(e = rt->regexp_cache_hash[h >> (32 - rt->regexp_cache_hash_bits)];
+            e != NULL; e = e->hash_next) {
+            if (e->hash == h && e->re_flags == re_flags &&
+                e->pattern->len == pattern->len &&
+                js_string_memcmp(e->pattern, pattern, pattern->len) == 0) {
+                /* move to the front of the LRU list */
+                list_del(&e->link);
+                list_add(&e->link, &rt->regexp_cache_lru);
+                rt->regexp_cache_hits++;
+                return JS_DupValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+            }
+        }
+    }
+    rt->regexp_cache_misses++;
+    return JS_UNDEFINED;
+}
+
+/* failures are ignored: the cache is only an optimization */
+static void js_regexp_cache_add(JSRuntime *rt, JSString *pattern,
+                                int re_flags, JSString *bytecode)
+{
+    JSRegExpCacheEntry *e;
+    uint32_t h;
+    size_t size;
+
+    if (rt->regexp_cache_max_count <= 0)
+        return;
+    size = sizeof(*e) + (pattern->len << pattern->is_wide_char) +
+        bytecode->len;
+    if (size > rt->regexp_cache_max_size)
+        return;
+    if (!rt->regexp_cache_hash ||
+        rt->regexp_cache_count >= (1 << rt->regexp_cache_hash_bits)) {
+        if (regexp_cache_resize(rt, rt->regexp_cache_hash ?
+                                rt->regexp_cache_hash_bits + 1 : 4))
+            return;
+    }
+    e = js_malloc_rt(rt, sizeof(*e));
+    if (!e)
+        return;
+    h = regexp_cache_hash(pattern, re_flags);
+    e->hash = h;
+    e->re_flags = re_flags;
+    e->pattern = JS_VALUE_GET_STRING(JS_DupValueRT(rt, JS_MKPTR(JS_TAG_STRING, pattern)));
+    e->bytecode = JS_VALUE_GET_STRING(JS_DupValueRT(rt, JS_MKPTR(JS_TAG_STRING, bytecode)));
+    h >>= 32 - rt->regexp_cache_hash_bits;
+    e->hash_next = rt->regexp_cache_hash[h];
+    rt->regexp_cache_hash[h] = e;
+    list_add(&e->link, &rt->regexp_cache_lru);
+    rt->regexp_cache_count++;
+    rt->regexp_cache_size += size;
+    regexp_cache_trim(rt, rt->regexp_cache_max_count,
+                      rt->regexp_cache_max_size);
+}
+
+static void js_regexp_cache_free(JSRuntime *rt)
+{
+    regexp_cache_trim(rt, 0, 0);
+    js_free_rt(rt, rt->regexp_cache_hash);
+    rt->regexp_cache_hash = NULL;
+    rt->regexp_cache_hash_bits = 0;
+}
+
+/* 'max_count' = 0 disables the cache */
+void JS_SetRegExpCacheLimits(JSRuntime *rt, int max_count, size_t max_size)
+{
+    rt->regexp_cache_max_count = max_int(max_count, 0);
+    rt->regexp_cache_max_size = max_size;
+    regexp_cache_trim(rt, rt->regexp_cache_max_count, max_size);
+}
+
+void JS_GetRegExpCacheStats(JSRuntime *rt, JSRegExpCacheStats *s)
+{
+    s->count = rt->regexp_cache_count;
+    s->size = rt->regexp_cache_size;
+    s->max_count = rt->regexp_cache_max_count;
+    s->max_size = rt->regexp_cache_max_size;
+    s->hits = rt->regexp_cache_hits;
+    s->misses = rt->regexp_cache_misses;
+}
+
+void JS_ClearRegExpCache(JSRuntime *rt)
+{
+    regexp_cache_trim(rt, 0, 0);
+}
+
 /* create a string containing the RegExp bytecode */
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags)
@@ -42613,6 +44181,13 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
         JS_FreeCString(ctx, str);
     }
 
+    if (JS_VALUE_GET_TAG(pattern) == JS_TAG_STRING) {
+        ret = js_regexp_cache_find(ctx->rt, JS_VALUE_GET_STRING(pattern),
+                                   re_flags);
+        if (!JS_IsUndefined(ret))
+            return ret;
+    }
+
     str = JS_ToCStringLen2(ctx, &len, pattern, !(re_flags & LRE_FLAG_UTF16));
     if (!str)
         return JS_EXCEPTION;
@@ -42626,6 +44201,10 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
 
     ret = js_new_string8(ctx, re_bytecode_buf, re_bytecode_len);
     js_free(ctx, re_bytecode_buf);
+    if (!JS_IsException(ret) && JS_VALUE_GET_TAG(pattern) == JS_TAG_STRING) {
+        js_regexp_cache_add(ctx->rt, JS_VALUE_GET_STRING(pattern), re_flags,
+                            JS_VALUE_GET_STRING(ret));
+    }
     return ret;
 }
 
@@ -46780,7 +48359,7 @@ static JSValue promise_reaction_job(JSContext *ctx, int argc,
 
     assert(argc == 5);
     handler = argv[2];
-    is_reject = JS_ToBool(ctx, argv[3]);
+    is_reject = JS_VALUE_GET_BOOL(argv[3]);
     arg = argv[4];
 #ifdef DUMP_PROMISE
     printf("promise_reaction_job: is_reject=%d\n", is_reject);
@@ -46792,6 +48371,11 @@ static JSValue promise_reaction_job(JSContext *ctx, int argc,
         } else {
             res = JS_DupValue(ctx, arg);
         }
+    } else if (JS_VALUE_GET_TAG(handler) == JS_TAG_OBJECT &&
+               (JS_VALUE_GET_OBJ(handler)->class_id == JS_CLASS_ASYNC_FUNCTION_RESOLVE ||
+                JS_VALUE_GET_OBJ(handler)->class_id == JS_CLASS_ASYNC_FUNCTION_REJECT)) {
+        /* 'await' continuation: resume the async function directly */
+        res = js_async_function_resolve_call(ctx, handler, JS_UNDEFINED, 1, &arg, 0);
     } else {
         res = JS_Call(ctx, handler, JS_UNDEFINED, 1, &arg);
     }
@@ -46874,6 +48458,7 @@ static JSValue js_promise_resolve_thenable_job(JSContext *ctx,
 {
     JSValueConst promise, thenable, then;
     JSValue args[2], res;
+    JSObject *p;
 
 #ifdef DUMP_PROMISE
     printf("js_promise_resolve_thenable_job\n");
@@ -46884,7 +48469,15 @@ static JSValue js_promise_resolve_thenable_job(JSContext *ctx,
     then = argv[2];
     if (js_create_resolving_functions(ctx, args, promise) < 0)
         return JS_EXCEPTION;
-    res = JS_Call(ctx, then, thenable, 2, (JSValueConst *)args);
+    p = JS_VALUE_GET_TAG(then) == JS_TAG_OBJECT ? JS_VALUE_GET_OBJ(then) : NULL;
+    if (p && p->class_id == JS_CLASS_C_FUNCTION &&
+        p->u.cfunc.c_function.generic == js_promise_then &&
+        JS_GetOpaque(thenable, JS_CLASS_PROMISE)) {
+        /* native promise with the intrinsic 'then' */
+        res = js_promise_then(p->u.cfunc.realm, thenable, 2, (JSValueConst *)args);
+    } else {
+        res = JS_Call(ctx, then, thenable, 2, (JSValueConst *)args);
+    }
     if (JS_IsException(res)) {
         JSValue error = JS_GetException(ctx);
         res = JS_Call(ctx, args[1], JS_UNDEFINED, 1, (JSValueConst *)&error);
@@ -51583,6 +53176,581 @@ static uint8_t const typed_array_size_log2[JS_TYPED_ARRAY_COUNT] = {
     2, 3
 };
 
+static inline BOOL typed_array_is_bigint(int class_id)
+{
+#ifdef CONFIG_BIGNUM
+    return (class_id == JS_CLASS_BIG_INT64_ARRAY ||
+            class_id == JS_CLASS_BIG_UINT64_ARRAY);
+#else
+    return FALSE;
+#endif
+}
+
+/* TRUE if the elements of a typed array of class 'src_class_id' can
+   be copied bit by bit to a typed array of class 'dst_class_id' */
+static BOOL typed_array_same_bits(int dst_class_id, int src_class_id)
+{
+    if (typed_array_size_log2(dst_class_id) !=
+        typed_array_size_log2(src_class_id))
+        return FALSE;
+    if (dst_class_id == JS_CLASS_FLOAT32_ARRAY ||
+        dst_class_id == JS_CLASS_FLOAT64_ARRAY ||
+        src_class_id == JS_CLASS_FLOAT32_ARRAY ||
+        src_class_id == JS_CLASS_FLOAT64_ARRAY)
+        return (dst_class_id == src_class_id);
+    /* Uint8ClampedArray clamps the negative values */
+    if (dst_class_id == JS_CLASS_UINT8C_ARRAY)
+        return (src_class_id != JS_CLASS_INT8_ARRAY);
+    return TRUE;
+}
+
+/* Typed array kernels. The SSE2 or NEON versions are selected at
+   compile time. With GCC or clang on x86, the AVX2 versions are
+   selected at run time by js_ta_kernels_init(). */
+
+/* The search kernels return a mask of the matching bytes of a vector
+   ('bpb' bits per byte) and are expanded in DEF_TA_SEARCH(). */
+
+#ifdef HAVE_SSE2
+#define TA_VEC_SIZE 16
+#define TA_VEC_BPB  1
+
+static inline uint64_t ta_match_u8(const uint8_t *p, uint8_t v)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(a, _mm_set1_epi8(v)));
+}
+
+static inline uint64_t ta_match_u16(const uint8_t *p, uint16_t v)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(a, _mm_set1_epi16(v)));
+}
+
+static inline uint64_t ta_match_u32(const uint8_t *p, uint32_t v)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(a, _mm_set1_epi32(v)));
+}
+
+static inline uint64_t ta_match_u64(const uint8_t *p, uint64_t v)
+{
+    __m128i a, c;
+    a = _mm_loadu_si128((const __m128i *)p);
+    /* no 64 bit compare in SSE2: both 32 bit halves must match */
+    c = _mm_cmpeq_epi32(a, _mm_set1_epi64x(v));
+    c = _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (uint32_t)_mm_movemask_epi8(c);
+}
+
+static inline uint64_t ta_match_f32(const uint8_t *p, float v)
+{
+    __m128 a = _mm_loadu_ps((const float *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(a, _mm_set1_ps(v))));
+}
+
+static inline uint64_t ta_match_f64(const uint8_t *p, double v)
+{
+    __m128d a = _mm_loadu_pd((const double *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(a, _mm_set1_pd(v))));
+}
+
+static inline void ta_fill_vec(uint8_t *p, uint64_t v, size_t size)
+{
+    __m128i a = _mm_set1_epi64x(v);
+    for(; size >= 16; size -= 16, p += 16)
+        _mm_storeu_si128((__m128i *)p, a);
+}
+
+#elif defined(HAVE_NEON)
+#define TA_VEC_SIZE 16
+#define TA_VEC_BPB  4
+
+/* no movemask in NEON: narrow each byte of the comparison to 4 bits */
+static inline uint64_t ta_neon_mask(uint8x16_t c)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(c), 4)), 0);
+}
+
+static inline uint64_t ta_match_u8(const uint8_t *p, uint8_t v)
+{
+    return ta_neon_mask(vceqq_u8(vld1q_u8(p), vdupq_n_u8(v)));
+}
+
+static inline uint64_t ta_match_u16(const uint8_t *p, uint16_t v)
+{
+    return ta_neon_mask(vreinterpretq_u8_u16(vceqq_u16(vld1q_u16((const uint16_t *)p), vdupq_n_u16(v))));
+}
+
+static inline uint64_t ta_match_u32(const uint8_t *p, uint32_t v)
+{
+    return ta_neon_mask(vreinterpretq_u8_u32(vceqq_u32(vld1q_u32((const uint32_t *)p), vdupq_n_u32(v))));
+}
+
+static inline uint64_t ta_match_u64(const uint8_t *p, uint64_t v)
+{
+    return ta_neon_mask(vreinterpretq_u8_u64(vceqq_u64(vld1q_u64((const uint64_t *)p), vdupq_n_u64(v))));
+}
+
+static inline uint64_t ta_match_f32(const uint8_t *p, float v)
+{
+    return ta_neon_mask(vreinterpretq_u8_u32(vceqq_f32(vld1q_f32((const float *)p), vdupq_n_f32(v))));
+}
+
+static inline uint64_t ta_match_f64(const uint8_t *p, double v)
+{
+    return ta_neon_mask(vreinterpretq_u8_u64(vceqq_f64(vld1q_f64((const double *)p), vdupq_n_f64(v))));
+}
+
+static inline void ta_fill_vec(uint8_t *p, uint64_t v, size_t size)
+{
+    uint8x16_t a = vreinterpretq_u8_u64(vdupq_n_u64(v));
+    for(; size >= 16; size -= 16, p += 16)
+        vst1q_u8(p, a);
+}
+
+#else
+/* scalar fallback */
+#define TA_VEC_SIZE 0
+#define TA_VEC_BPB  1
+#define ta_match_u8(p, v)  0
+#define ta_match_u16(p, v) 0
+#define ta_match_u32(p, v) 0
+#define ta_match_u64(p, v) 0
+#define ta_match_f32(p, v) 0
+#define ta_match_f64(p, v) 0
+
+static inline void ta_fill_vec(uint8_t *p, uint64_t v, size_t size)
+{
+}
+#endif
+
+#ifdef HAVE_AVX2_DISPATCH
+#define TA_AVX2 __attribute__((target("avx2")))
+
+static inline TA_AVX2 uint64_t ta_match_u8_avx2(const uint8_t *p, uint8_t v)
+{
+    __m256i a = _mm256_loadu_si256((const __m256i *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, _mm256_set1_epi8(v)));
+}
+
+static inline TA_AVX2 uint64_t ta_match_u16_avx2(const uint8_t *p, uint16_t v)
+{
+    __m256i a = _mm256_loadu_si256((const __m256i *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, _mm256_set1_epi16(v)));
+}
+
+static inline TA_AVX2 uint64_t ta_match_u32_avx2(const uint8_t *p, uint32_t v)
+{
+    __m256i a = _mm256_loadu_si256((const __m256i *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, _mm256_set1_epi32(v)));
+}
+
+static inline TA_AVX2 uint64_t ta_match_u64_avx2(const uint8_t *p, uint64_t v)
+{
+    __m256i a = _mm256_loadu_si256((const __m256i *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi64(a, _mm256_set1_epi64x(v)));
+}
+
+static inline TA_AVX2 uint64_t ta_match_f32_avx2(const uint8_t *p, float v)
+{
+    __m256 a = _mm256_loadu_ps((const float *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(a, _mm256_set1_ps(v), _CMP_EQ_OQ)));
+}
+
+static inline TA_AVX2 uint64_t ta_match_f64_avx2(const uint8_t *p, double v)
+{
+    __m256d a = _mm256_loadu_pd((const double *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(a, _mm256_set1_pd(v), _CMP_EQ_OQ)));
+}
+#endif
+
+/* forward 8 bit searches use memchr().
+   ta_index_of_xxx() returns the index of the first element equal to
+   'v' in tab[k..len-1], ta_last_index_of_xxx() the index of the last
+   one in tab[0..k]. -1 if not found. */
+#define DEF_TA_FIRST_SEARCH(name, attr, type, vsize, bpb, match)        \
+static attr int ta_index_of_ ## name(const type *tab, int k, int len,  \
+                                     type v)                            \
+{                                                                       \
+    const int n = (vsize) / sizeof(type);                               \
+    uint64_t m;                                                         \
+    if (n != 0) {                                                       \
+        for(; k + n <= len; k += n) {                                   \
+            m = match((const uint8_t *)(tab + k), v);                   \
+            if (m != 0)                                                 \
+                return k + ctz64(m) / (bpb) / sizeof(type);             \
+        }                                                               \
+    }                                                                   \
+    for(; k < len; k++) {                                               \
+        if (tab[k] == v)                                                \
+            return k;                                                   \
+    }                                                                   \
+    return -1;                                                          \
+}
+
+#define DEF_TA_LAST_SEARCH(name, attr, type, vsize, bpb, match)         \
+static attr int ta_last_index_of_ ## name(const type *tab, int k,      \
+                                          type v)                       \
+{                                                                       \
+    const int n = (vsize) / sizeof(type);                               \
+    uint64_t m;                                                         \
+    if (n != 0) {                                                       \
+        for(; k + 1 >= n; k -= n) {                                     \
+            m = match((const uint8_t *)(tab + k + 1 - n), v);           \
+            if (m != 0)                                                 \
+                return k + 1 - n + (63 - clz64(m)) / (bpb) / sizeof(type); \
+        }                                                               \
+    }                                                                   \
+    for(; k >= 0; k--) {                                                \
+        if (tab[k] == v)                                                \
+            return k;                                                   \
+    }                                                                   \
+    return -1;                                                          \
+}
+
+#define DEF_TA_SEARCH(name, attr, type, vsize, bpb, match)      \
+    DEF_TA_FIRST_SEARCH(name, attr, type, vsize, bpb, match)    \
+    DEF_TA_LAST_SEARCH(name, attr, type, vsize, bpb, match)
+
+DEF_TA_LAST_SEARCH(u8, , uint8_t, TA_VEC_SIZE, TA_VEC_BPB, ta_match_u8)
+DEF_TA_SEARCH(u16, , uint16_t, TA_VEC_SIZE, TA_VEC_BPB, ta_match_u16)
+DEF_TA_SEARCH(u32, , uint32_t, TA_VEC_SIZE, TA_VEC_BPB, ta_match_u32)
+DEF_TA_SEARCH(u64, , uint64_t, TA_VEC_SIZE, TA_VEC_BPB, ta_match_u64)
+DEF_TA_SEARCH(f32, , float, TA_VEC_SIZE, TA_VEC_BPB, ta_match_f32)
+DEF_TA_SEARCH(f64, , double, TA_VEC_SIZE, TA_VEC_BPB, ta_match_f64)
+
+/* fill 'size' bytes with the repeated 64 bit pattern 'v'. 'size' is a
+   multiple of the element size. */
+static void ta_fill(uint8_t *p, uint64_t v, size_t size)
+{
+    size_t size1 = size & ~(size_t)15;
+    ta_fill_vec(p, v, size1);
+    if (TA_VEC_SIZE == 0)
+        size1 = 0;
+    for(p += size1, size -= size1; size >= 8; size -= 8, p += 8)
+        memcpy(p, &v, 8);
+    memcpy(p, &v, size);
+}
+
+#ifdef HAVE_AVX2_DISPATCH
+DEF_TA_LAST_SEARCH(u8_avx2, TA_AVX2, uint8_t, 32, 1, ta_match_u8_avx2)
+DEF_TA_SEARCH(u16_avx2, TA_AVX2, uint16_t, 32, 1, ta_match_u16_avx2)
+DEF_TA_SEARCH(u32_avx2, TA_AVX2, uint32_t, 32, 1, ta_match_u32_avx2)
+DEF_TA_SEARCH(u64_avx2, TA_AVX2, uint64_t, 32, 1, ta_match_u64_avx2)
+DEF_TA_SEARCH(f32_avx2, TA_AVX2, float, 32, 1, ta_match_f32_avx2)
+DEF_TA_SEARCH(f64_avx2, TA_AVX2, double, 32, 1, ta_match_f64_avx2)
+
+static TA_AVX2 void ta_fill_avx2(uint8_t *p, uint64_t v, size_t size)
+{
+    __m256i a = _mm256_set1_epi64x(v);
+    for(; size >= 32; size -= 32, p += 32)
+        _mm256_storeu_si256((__m256i *)p, a);
+    ta_fill(p, v, size);
+}
+#endif
+
+#define TA_KERNELS_DEF(sfx)                     \
+    ta_fill ## sfx,                             \
+    ta_last_index_of_u8 ## sfx,                 \
+    ta_index_of_u16 ## sfx,                     \
+    ta_last_index_of_u16 ## sfx,                \
+    ta_index_of_u32 ## sfx,                     \
+    ta_last_index_of_u32 ## sfx,                \
+    ta_index_of_u64 ## sfx,                     \
+    ta_last_index_of_u64 ## sfx,                \
+    ta_index_of_f32 ## sfx,                     \
+    ta_last_index_of_f32 ## sfx,                \
+    ta_index_of_f64 ## sfx,                     \
+    ta_last_index_of_f64 ## sfx,
+
+typedef struct {
+    void (*fill)(uint8_t *p, uint64_t v, size_t size);
+    int (*last_index_of_u8)(const uint8_t *tab, int k, uint8_t v);
+    int (*index_of_u16)(const uint16_t *tab, int k, int len, uint16_t v);
+    int (*last_index_of_u16)(const uint16_t *tab, int k, uint16_t v);
+    int (*index_of_u32)(const uint32_t *tab, int k, int len, uint32_t v);
+    int (*last_index_of_u32)(const uint32_t *tab, int k, uint32_t v);
+    int (*index_of_u64)(const uint64_t *tab, int k, int len, uint64_t v);
+    int (*last_index_of_u64)(const uint64_t *tab, int k, uint64_t v);
+    int (*index_of_f32)(const float *tab, int k, int len, float v);
+    int (*last_index_of_f32)(const float *tab, int k, float v);
+    int (*index_of_f64)(const double *tab, int k, int len, double v);
+    int (*last_index_of_f64)(const double *tab, int k, double v);
+} JSTypedArrayKernels;
+
+/* may be replaced by js_ta_kernels_init() */
+static JSTypedArrayKernels ta_kernels = { TA_KERNELS_DEF() };
+
+#ifdef HAVE_AVX2_DISPATCH
+static const JSTypedArrayKernels ta_kernels_avx2 = { TA_KERNELS_DEF(_avx2) };
+#endif
+
+#ifdef HAVE_AVX2_DISPATCH
+static void js_ta_kernels_select(void)
+{
+    if (__builtin_cpu_supports("avx2"))
+        ta_kernels = ta_kernels_avx2;
+}
+
+#ifdef CONFIG_ATOMICS
+static pthread_once_t ta_kernels_once = PTHREAD_ONCE_INIT;
+#endif
+#endif
+
+/* the kernels are selected once per process: contexts may be created
+   concurrently by several threads (e.g. workers) */
+static void js_ta_kernels_init(void)
+{
+#ifdef HAVE_AVX2_DISPATCH
+#ifdef CONFIG_ATOMICS
+    pthread_once(&ta_kernels_once, js_ta_kernels_select);
+#else
+    static BOOL ta_kernels_selected;
+    if (!ta_kernels_selected) {
+        js_ta_kernels_select();
+        ta_kernels_selected = TRUE;
+    }
+#endif
+#endif
+}
+
+/* LSD radix sort with 8 bit digits of unsigned keys. The digits
+   which are identical for all the keys are skipped. Return the
+   buffer containing the result ('tab' or 'tmp'). */
+#define DEF_TA_RADIX_SORT(name, type)                                   \
+static type *name(type *tab, type *tmp, size_t len)                     \
+{                                                                       \
+    uint32_t count[sizeof(type)][256], pos, c;                          \
+    size_t i;                                                           \
+    int d, j;                                                           \
+    type *t;                                                            \
+    memset(count, 0, sizeof(count));                                    \
+    for(i = 0; i < len; i++) {                                          \
+        for(d = 0; d < sizeof(type); d++)                               \
+            count[d][(tab[i] >> (d * 8)) & 0xff]++;                     \
+    }                                                                   \
+    for(d = 0; d < sizeof(type); d++) {                                 \
+        if (count[d][(tab[0] >> (d * 8)) & 0xff] == len)                \
+            continue;                                                   \
+        pos = 0;                                                        \
+        for(j = 0; j < 256; j++) {                                      \
+            c = count[d][j];                                            \
+            count[d][j] = pos;                                          \
+            pos += c;                                                   \
+        }                                                               \
+        for(i = 0; i < len; i++)                                        \
+            tmp[count[d][(tab[i] >> (d * 8)) & 0xff]++] = tab[i];       \
+        t = tab;                                                        \
+        tab = tmp;                                                      \
+        tmp = t;                                                        \
+    }                                                                   \
+    return tab;                                                         \
+}
+
+DEF_TA_RADIX_SORT(ta_radix_sort_u8, uint8_t)
+DEF_TA_RADIX_SORT(ta_radix_sort_u16, uint16_t)
+DEF_TA_RADIX_SORT(ta_radix_sort_u32, uint32_t)
+DEF_TA_RADIX_SORT(ta_radix_sort_u64, uint64_t)
+
+/* map the elements of a typed array to unsigned keys with the same
+   order as js_cmp_doubles() ('inverse' = FALSE) or back
+   ('inverse' = TRUE). NaNs are canonicalized and sorted last. */
+static void ta_sort_keys(void *array_ptr, int class_id, size_t len,
+                         BOOL inverse)
+{
+    size_t i;
+
+    switch(class_id) {
+    case JS_CLASS_INT8_ARRAY:
+        {
+            uint8_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x80;
+        }
+        break;
+    case JS_CLASS_INT16_ARRAY:
+        {
+            uint16_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x8000;
+        }
+        break;
+    case JS_CLASS_INT32_ARRAY:
+        {
+            uint32_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x80000000;
+        }
+        break;
+#ifdef CONFIG_BIGNUM
+    case JS_CLASS_BIG_INT64_ARRAY:
+        {
+            uint64_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= (uint64_t)1 << 63;
+        }
+        break;
+#endif
+    case JS_CLASS_FLOAT32_ARRAY:
+        {
+            uint32_t *tab = array_ptr, v;
+            for(i = 0; i < len; i++) {
+                v = tab[i];
+                if (!inverse) {
+                    if ((v & 0x7fffffff) > 0x7f800000)
+                        v = 0x7fc00000; /* NaN */
+                    v = (v & 0x80000000) ? ~v : v | 0x80000000;
+                } else {
+                    v = (v & 0x80000000) ? v & 0x7fffffff : ~v;
+                }
+                tab[i] = v;
+            }
+        }
+        break;
+    case JS_CLASS_FLOAT64_ARRAY:
+        {
+            const uint64_t sign = (uint64_t)1 << 63;
+            uint64_t *tab = array_ptr, v;
+            for(i = 0; i < len; i++) {
+                v = tab[i];
+                if (!inverse) {
+                    if ((v & ~sign) > ((uint64_t)0x7ff << 52))
+                        v = (uint64_t)0x7ff8 << 48; /* NaN */
+                    v = (v & sign) ? ~v : v | sign;
+                } else {
+                    v = (v & sign) ? v & ~sign : ~v;
+                }
+                tab[i] = v;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/* sort a typed array without comparator. Return -1 if not enough
+   memory (nothing is modified in this case). */
+static int ta_radix_sort(JSContext *ctx, void *array_ptr, int class_id,
+                         size_t len)
+{
+    size_t elt_size;
+    void *tmp, *res;
+
+    elt_size = 1 << typed_array_size_log2(class_id);
+    tmp = js_malloc_rt(ctx->rt, len * elt_size);
+    if (!tmp)
+        return -1;
+    ta_sort_keys(array_ptr, class_id, len, FALSE);
+    switch(elt_size) {
+    case 1:
+        res = ta_radix_sort_u8(array_ptr, tmp, len);
+        break;
+    case 2:
+        res = ta_radix_sort_u16(array_ptr, tmp, len);
+        break;
+    case 4:
+        res = ta_radix_sort_u32(array_ptr, tmp, len);
+        break;
+    case 8:
+        res = ta_radix_sort_u64(array_ptr, tmp, len);
+        break;
+    default:
+        abort();
+    }
+    if (res != array_ptr)
+        memcpy(array_ptr, res, len * elt_size);
+    ta_sort_keys(array_ptr, class_id, len, TRUE);
+    js_free_rt(ctx->rt, tmp);
+    return 0;
+}
+
+/* convert 'len' elements between two number (not BigInt) typed arrays
+   of different types. The buffers must not overlap. */
+static void ta_convert(uint8_t *dst, int dst_class_id,
+                       const uint8_t *src, int src_class_id, size_t len)
+{
+    double buf[256];
+    int dst_shift, src_shift;
+    size_t i, n;
+
+    dst_shift = typed_array_size_log2(dst_class_id);
+    src_shift = typed_array_size_log2(src_class_id);
+    while (len != 0) {
+        n = min_int(len, countof(buf));
+        switch(src_class_id) {
+        case JS_CLASS_UINT8C_ARRAY:
+        case JS_CLASS_UINT8_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint8_t *)src)[i];
+            break;
+        case JS_CLASS_INT8_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int8_t *)src)[i];
+            break;
+        case JS_CLASS_INT16_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int16_t *)src)[i];
+            break;
+        case JS_CLASS_UINT16_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint16_t *)src)[i];
+            break;
+        case JS_CLASS_INT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int32_t *)src)[i];
+            break;
+        case JS_CLASS_UINT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint32_t *)src)[i];
+            break;
+        case JS_CLASS_FLOAT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const float *)src)[i];
+            break;
+        case JS_CLASS_FLOAT64_ARRAY:
+            memcpy(buf, src, n * sizeof(buf[0]));
+            break;
+        default:
+            abort();
+        }
+        switch(dst_class_id) {
+        case JS_CLASS_UINT8C_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint8_t *)dst)[i] = js_double_to_uint8_clamp(buf[i]);
+            break;
+        case JS_CLASS_INT8_ARRAY:
+        case JS_CLASS_UINT8_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint8_t *)dst)[i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_INT16_ARRAY:
+        case JS_CLASS_UINT16_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint16_t *)dst)[i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_INT32_ARRAY:
+        case JS_CLASS_UINT32_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint32_t *)dst)[i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_FLOAT32_ARRAY:
+            for(i = 0; i < n; i++)
+                ((float *)dst)[i] = buf[i];
+            break;
+        case JS_CLASS_FLOAT64_ARRAY:
+            memcpy(dst, buf, n * sizeof(buf[0]));
+            break;
+        default:
+            abort();
+        }
+        src += n << src_shift;
+        dst += n << dst_shift;
+        len -= n;
+    }
+}
+
 static JSValue js_array_buffer_constructor3(JSContext *ctx,
                                             JSValueConst new_target,
                                             uint64_t len, JSClassID class_id,
@@ -51620,6 +53788,8 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
             if (!abuf->data)
                 goto fail;
         }
+        rt->stats.binary_alloc_count++;
+        rt->stats.binary_alloc_size += len;
     } else {
         if (class_id == JS_CLASS_SHARED_ARRAY_BUFFER &&
             rt->sab_funcs.sab_dup) {
@@ -51647,6 +53817,12 @@ static void js_array_buffer_free(JSRuntime *rt, void *opaque, void *ptr)
     js_free_rt(rt, ptr);
 }
 
+/* used for the transferred ArrayBuffers */
+static void js_array_buffer_free_malloc(JSRuntime *rt, void *opaque, void *ptr)
+{
+    js_free_libc(ptr);
+}
+
 static JSValue js_array_buffer_constructor2(JSContext *ctx,
                                             JSValueConst new_target,
                                             uint64_t len, JSClassID class_id)
@@ -52137,11 +54313,35 @@ static JSValue js_typed_array_set_internal(JSContext *ctx,
                     src_abuf->data + src_ta->offset, src_len << shift);
             goto done;
         }
-        if (dest_abuf->data == src_abuf->data) {
-            /* copying between the same buffer using different types of mappings
-               would require a temporary buffer */
+        if (typed_array_same_bits(p->class_id, src_p->class_id)) {
+            /* same representation (e.g. Int8Array and Uint8Array) */
+            memmove(dest_abuf->data + dest_ta->offset + (offset << shift),
+                    src_abuf->data + src_ta->offset, src_len << shift);
+            goto done;
+        }
+        if (!typed_array_is_bigint(p->class_id) &&
+            !typed_array_is_bigint(src_p->class_id)) {
+            uint8_t *src_data, *tmp = NULL;
+            size_t src_size;
+
+            src_data = src_abuf->data + src_ta->offset;
+            if (dest_abuf->data == src_abuf->data) {
+                /* copying between the same buffer using different
+                   types of mappings requires a temporary buffer */
+                src_size = src_len << typed_array_size_log2(src_p->class_id);
+                tmp = js_malloc(ctx, max_int(src_size, 1));
+                if (!tmp)
+                    goto fail;
+                memcpy(tmp, src_data, src_size);
+                src_data = tmp;
+            }
+            ta_convert(dest_abuf->data + dest_ta->offset + (offset << shift),
+                       p->class_id, src_data, src_p->class_id, src_len);
+            js_free(ctx, tmp);
+            goto done;
         }
-        /* otherwise, default behavior is slow but correct */
+        /* otherwise (mixing BigInt and Number), default behavior is
+           slow but correct */
     } else {
         if (js_get_length64(ctx, &src_len, src_obj))
             goto fail;
@@ -52496,30 +54696,26 @@ static JSValue js_typed_array_fill(JSContext *ctx, JSValueConst this_val,
         return JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
 
     shift = typed_array_size_log2(p->class_id);
+    if (k >= final)
+        return JS_DupValue(ctx, this_val);
+    /* replicate the element in a 64 bit pattern */
     switch(shift) {
     case 0:
-        if (k < final) {
-            memset(p->u.array.u.uint8_ptr + k, v64, final - k);
-        }
-        break;
+        memset(p->u.array.u.uint8_ptr + k, v64, final - k);
+        return JS_DupValue(ctx, this_val);
     case 1:
-        for(; k < final; k++) {
-            p->u.array.u.uint16_ptr[k] = v64;
-        }
+        v64 = (v64 & 0xffff) * 0x0001000100010001;
         break;
     case 2:
-        for(; k < final; k++) {
-            p->u.array.u.uint32_ptr[k] = v64;
-        }
+        v64 = (v64 & 0xffffffff) * 0x0000000100000001;
         break;
     case 3:
-        for(; k < final; k++) {
-            p->u.array.u.uint64_ptr[k] = v64;
-        }
         break;
     default:
         abort();
     }
+    ta_kernels.fill(p->u.array.u.uint8_ptr + ((size_t)k << shift), v64,
+                    (size_t)(final - k) << shift);
     return JS_DupValue(ctx, this_val);
 }
 
@@ -52689,12 +54885,7 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
                 if (pp)
                     res = pp - pv;
             } else {
-                for (; k != stop; k += inc) {
-                    if (pv[k] == v) {
-                        res = k;
-                        break;
-                    }
-                }
+                res = ta_kernels.last_index_of_u8(pv, k, v);
             }
         }
         break;
@@ -52709,12 +54900,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
         scan16:
             pv = p->u.array.u.uint16_ptr;
             v = v64;
-            for (; k != stop; k += inc) {
-                if (pv[k] == v) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_kernels.index_of_u16(pv, k, len, v);
+            else
+                res = ta_kernels.last_index_of_u16(pv, k, v);
         }
         break;
     case JS_CLASS_INT32_ARRAY:
@@ -52728,12 +54917,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
         scan32:
             pv = p->u.array.u.uint32_ptr;
             v = v64;
-            for (; k != stop; k += inc) {
-                if (pv[k] == v) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_kernels.index_of_u32(pv, k, len, v);
+            else
+                res = ta_kernels.last_index_of_u32(pv, k, v);
         }
         break;
     case JS_CLASS_FLOAT32_ARRAY:
@@ -52752,12 +54939,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
             }
         } else if ((f = (float)d) == d) {
             const float *pv = p->u.array.u.float_ptr;
-            for (; k != stop; k += inc) {
-                if (pv[k] == f) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_kernels.index_of_f32(pv, k, len, f);
+            else
+                res = ta_kernels.last_index_of_f32(pv, k, f);
         }
         break;
     case JS_CLASS_FLOAT64_ARRAY:
@@ -52776,12 +54961,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
             }
         } else {
             const double *pv = p->u.array.u.double_ptr;
-            for (; k != stop; k += inc) {
-                if (pv[k] == d) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_kernels.index_of_f64(pv, k, len, d);
+            else
+                res = ta_kernels.last_index_of_f64(pv, k, d);
         }
         break;
 #ifdef CONFIG_BIGNUM
@@ -52800,12 +54983,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
         scan64:
             pv = p->u.array.u.uint64_ptr;
             v = v64;
-            for (; k != stop; k += inc) {
-                if (pv[k] == v) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_kernels.index_of_u64(pv, k, len, v);
+            else
+                res = ta_kernels.last_index_of_u64(pv, k, v);
         }
         break;
 #endif
@@ -53337,9 +55518,13 @@ static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
             js_free(ctx, array_tmp);
             js_free(ctx, array_idx);
         } else {
-            rqsort(array_ptr, len, elt_size, cmpfun, &tsc);
-            if (tsc.exception)
-                return JS_EXCEPTION;
+            /* the radix sort is faster except for small arrays */
+            if (len < 64 ||
+                ta_radix_sort(ctx, array_ptr, p->class_id, len) < 0) {
+                rqsort(array_ptr, len, elt_size, cmpfun, &tsc);
+                if (tsc.exception)
+                    return JS_EXCEPTION;
+            }
         }
     }
     return JS_DupValue(ctx, this_val);
@@ -54467,6 +56652,8 @@ void JS_AddIntrinsicTypedArrays(JSContext *ctx)
     JSValueConst array_buffer_func, shared_array_buffer_func;
     int i;
 
+    js_ta_kernels_init();
+
     ctx->class_proto[JS_CLASS_ARRAY_BUFFER] = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_ARRAY_BUFFER],
                                js_array_buffer_proto_funcs,
@@ -54778,6 +56965,8 @@ JS_BOOL js_set_persistent_rt(JSRuntime* rt, JSValue val, struct JSStorage* pst,
 
   if (status == JS_NOT_PERSISTENT) {
     if (po->persistent) {
+      if (po->persistent->status == JS_PERSISTENT_MODIFIED)
+        list_del(&po->persistent->dirty_link);
       js_free_rt(rt,po->persistent);
       po->persistent = NULL;
     }
@@ -54788,11 +56977,16 @@ JS_BOOL js_set_persistent_rt(JSRuntime* rt, JSValue val, struct JSStorage* pst,
     po->persistent = js_malloc_rt(rt, sizeof(struct JSPersitentBlock));
     if (!po->persistent)
       return 0;
+    po->persistent->status = JS_NOT_PERSISTENT;
+    po->persistent->obj = po;
+  } else if (po->persistent->storage != pst) {
+    /* moving to another storage: leave the old dirty list first */
+    js_persistent_block_set_status(po->persistent, JS_NOT_PERSISTENT);
   }
 
-  po->persistent->status = status; // loaded, modified, etc.
   po->persistent->oid = oid;
   po->persistent->storage = pst;
+  js_persistent_block_set_status(po->persistent, status); // loaded, modified, etc.
 
   return 1;
 }
@@ -54806,7 +57000,18 @@ void js_set_persistent_status(JSValue val, JS_PERSISTENT_STATUS status) {
   JSObject* po = JS_VALUE_GET_OBJ(val);
   assert(po->persistent);
   assert(status);
-  po->persistent->status = status;   
+  js_persistent_block_set_status(po->persistent, status);
+}
+
+/* returns the first object of a storage dirty list (not duplicated)
+   or JS_UNDEFINED if the list is empty */
+JSValue js_persistent_dirty_first(struct list_head* dirty_list)
+{
+  struct JSPersitentBlock* pb;
+  if (list_empty(dirty_list))
+    return JS_UNDEFINED;
+  pb = list_entry(dirty_list->next, struct JSPersitentBlock, dirty_link);
+  return JS_MKPTR(JS_TAG_OBJECT, pb->obj);
 }
 
 JS_PERSISTENT_STATUS js_is_persistent(JSValue val, struct JSStorage** pstor, uint32_t* poid)
@@ -54827,14 +57032,93 @@ JS_PERSISTENT_STATUS js_is_persistent(JSValue val, struct JSStorage** pstor, uin
   return po->persistent->status;
 }
 
-uint32_t* js_get_persistent_oid_ref(JSValue val)
+/* Object layouts: plain objects sharing a shape are persisted with the same
+   storage class descriptor, the storage keeps a reference to the shape as the
+   key of its descriptor cache. Only hashed shapes qualify: they are never
+   modified in place while referenced by more than one owner. */
+
+/* returns the shape of obj (not referenced) if all its own properties are
+   writable, enumerable and configurable data properties with string keys, NULL
+   otherwise */
+void* js_persistent_layout(JSContext *ctx, JSValueConst obj, uint32_t max_count, uint32_t *pcount)
 {
-  assert(js_is_persitable(val));
- 
-  JSObject* po = JS_VALUE_GET_OBJ(val);
-  assert(po->persistent);
+  JSObject *p = JS_VALUE_GET_OBJ(obj);
+  JSShape *sh = p->shape;
+  JSShapeProperty *prs;
+  uint32_t i, idx;
+
+  if (p->class_id != JS_CLASS_OBJECT || !sh->is_hashed ||
+      sh->deleted_prop_count != 0 || sh->prop_count > max_count)
+    return NULL;
+  for (i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+    if ((prs->flags & (JS_PROP_TMASK | JS_PROP_C_W_E)) != JS_PROP_C_W_E ||
+        prs->atom == JS_ATOM_constructor || !JS_AtomIsString(ctx, prs->atom) ||
+        JS_AtomIsArrayIndex(ctx, &idx, prs->atom))
+      return NULL;
+  }
+  *pcount = sh->prop_count;
+  return sh;
+}
+
+void* js_persistent_layout_dup(void* layout)
+{
+  return js_dup_shape(layout);
+}
+
+void js_persistent_layout_free(JSRuntime *rt, void* layout)
+{
+  js_free_shape(rt, layout);
+}
+
+void js_persistent_layout_mark(JSRuntime *rt, void* layout, JS_MarkFunc *mark_func)
+{
+  mark_func(rt, &((JSShape *)layout)->header);
+}
+
+JSAtom js_persistent_layout_atom(void* layout, uint32_t n)
+{
+  JSShape *sh = layout;
+  assert(n < sh->prop_count);
+  return get_shape_prop(sh)[n].atom;
+}
+
+/* moves out value of n-th property of the object having a layout, the
+   property is left undefined */
+JSValue js_persistent_layout_take(JSValueConst obj, uint32_t n)
+{
+  JSObject *p = JS_VALUE_GET_OBJ(obj);
+  JSValue val;
+  assert(n < p->shape->prop_count);
+  val = p->prop[n].u.value;
+  p->prop[n].u.value = JS_UNDEFINED;
+  return val;
+}
+
+/* fills an object that has no own properties yet: it takes the layout shape
+   directly instead of growing its own one property at a time. The shape holds
+   the prototype so it is only taken by objects having the same one. On
+   success the values are owned by the object, returns FALSE if the object
+   does not qualify */
+JS_BOOL js_persistent_layout_fill(JSContext *ctx, JSValueConst obj, void* layout, JSValue *values)
+{
+  JSObject *p = JS_VALUE_GET_OBJ(obj);
+  JSShape *sh = layout;
+  uint32_t i;
 
-  return &po->persistent->oid;
+  if (p->class_id != JS_CLASS_OBJECT || p->shape->prop_count != 0 ||
+      p->shape->proto != sh->proto)
+    return FALSE;
+  if (p->shape->prop_size != sh->prop_size) {
+    JSProperty *new_prop = js_realloc(ctx, p->prop, sizeof(p->prop[0]) * sh->prop_size);
+    if (!new_prop)
+      return FALSE;
+    p->prop = new_prop;
+  }
+  js_free_shape(ctx->rt, p->shape);
+  p->shape = js_dup_shape(sh);
+  for (i = 0; i < sh->prop_count; i++)
+    p->prop[i].u.value = values[i];
+  return TRUE;
 }
 
 #endif
@@ -5,7 +5,7 @@
 const uint32_t qjsc_repl_size = 16089;
 
 const uint8_t qjsc_repl[16089] = {
- 0x02, 0xa1, 0x03, 0x14, 0x2e, 0x2e, 0x2f, 0x72,
+ 0x04, 0xa1, 0x03, 0x14, 0x2e, 0x2e, 0x2f, 0x72,
  0x65, 0x70, 0x6c, 0x2e, 0x6a, 0x73, 0x06, 0x73,
  0x74, 0x64, 0x04, 0x6f, 0x73, 0x10, 0x69, 0x73,
  0x46, 0x69, 0x6e, 0x69, 0x74, 0x65, 0x14, 0x70,
@@ -503,14 +503,14 @@ const uint8_t qjsc_repl[16089] = {
  0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
  0x5f, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
  0x69, 0x65, 0x72, 0x12, 0x73, 0x65, 0x74, 0x5f,
- 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0f, 0xc4, 0x03,
- 0x02, 0xc6, 0x03, 0xc8, 0x03, 0x00, 0x00, 0x02,
+ 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0f, 0xca, 0x03,
+ 0x02, 0xcc, 0x03, 0xce, 0x03, 0x00, 0x00, 0x02,
  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x01,
  0x0e, 0x00, 0x02, 0x03, 0xa6, 0x01, 0x00, 0x00,
- 0x00, 0x02, 0x02, 0x01, 0x0d, 0x00, 0xc6, 0x03,
- 0x00, 0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x08, 0xea,
+ 0x00, 0x02, 0x02, 0x01, 0x0d, 0x00, 0xcc, 0x03,
+ 0x00, 0x0d, 0xce, 0x03, 0x01, 0x0d, 0x08, 0xea,
  0x02, 0x29, 0xc0, 0x00, 0x38, 0x8d, 0x00, 0x00,
- 0x00, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x00,
+ 0x00, 0xef, 0x29, 0x0e, 0x43, 0x22, 0x03, 0x00,
  0x01, 0x77, 0x01, 0x02, 0x02, 0x48, 0xf7, 0x09,
  0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x0c, 0xc0,
  0x00, 0xc3, 0x2a, 0xc0, 0x01, 0xc3, 0x2b, 0xc0,
@@ -549,163 +549,163 @@ const uint8_t qjsc_repl[16089] = {
  0x43, 0xc3, 0x72, 0xc0, 0x44, 0xc3, 0x73, 0xc0,
  0x45, 0xc3, 0x74, 0xc0, 0x46, 0xc3, 0x75, 0xc0,
  0x47, 0xc3, 0x76, 0xd1, 0x65, 0x01, 0x00, 0x43,
- 0xe4, 0x00, 0x00, 0x00, 0xd1, 0x65, 0x00, 0x00,
- 0x43, 0xe3, 0x00, 0x00, 0x00, 0xd1, 0x41, 0x95,
- 0x00, 0x00, 0x00, 0xc9, 0xd1, 0x41, 0x99, 0x00,
- 0x00, 0x00, 0xca, 0xd1, 0x41, 0x96, 0x00, 0x00,
- 0x00, 0xcb, 0xd1, 0x41, 0x9f, 0x00, 0x00, 0x00,
- 0xcc, 0xd1, 0x41, 0x9d, 0x00, 0x00, 0x00, 0xc3,
- 0x04, 0xd1, 0x41, 0xe5, 0x00, 0x00, 0x00, 0xc3,
- 0x05, 0xd1, 0x41, 0xe6, 0x00, 0x00, 0x00, 0xc3,
- 0x06, 0x65, 0x01, 0x00, 0x41, 0xe7, 0x00, 0x00,
- 0x00, 0xf4, 0xc3, 0x07, 0x37, 0xe8, 0x00, 0x00,
- 0x00, 0xf5, 0xc3, 0x08, 0x37, 0xb3, 0x00, 0x00,
- 0x00, 0xf5, 0xc3, 0x09, 0x0b, 0x04, 0xe9, 0x00,
- 0x00, 0x00, 0x4c, 0xea, 0x00, 0x00, 0x00, 0x04,
- 0xeb, 0x00, 0x00, 0x00, 0x4c, 0xec, 0x00, 0x00,
- 0x00, 0x04, 0xed, 0x00, 0x00, 0x00, 0x4c, 0xee,
- 0x00, 0x00, 0x00, 0x04, 0xef, 0x00, 0x00, 0x00,
- 0x4c, 0xf0, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x00,
- 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00, 0x00, 0x04,
- 0xf3, 0x00, 0x00, 0x00, 0x4c, 0xf4, 0x00, 0x00,
- 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x4c, 0xf6,
- 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00,
- 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x00,
- 0x00, 0x00, 0x4c, 0xfa, 0x00, 0x00, 0x00, 0x04,
- 0xfb, 0x00, 0x00, 0x00, 0x4c, 0xfc, 0x00, 0x00,
- 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x4c, 0xfd,
- 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00,
- 0x4c, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
- 0x00, 0x00, 0x4c, 0x01, 0x01, 0x00, 0x00, 0x04,
- 0x02, 0x01, 0x00, 0x00, 0x4c, 0x03, 0x01, 0x00,
- 0x00, 0x04, 0x04, 0x01, 0x00, 0x00, 0x4c, 0x05,
- 0x01, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00,
- 0x4c, 0x07, 0x01, 0x00, 0x00, 0x04, 0x08, 0x01,
- 0x00, 0x00, 0x4c, 0x09, 0x01, 0x00, 0x00, 0x04,
- 0x0a, 0x01, 0x00, 0x00, 0x4c, 0x0b, 0x01, 0x00,
+ 0xe7, 0x00, 0x00, 0x00, 0xd1, 0x65, 0x00, 0x00,
+ 0x43, 0xe6, 0x00, 0x00, 0x00, 0xd1, 0x41, 0x98,
+ 0x00, 0x00, 0x00, 0xc9, 0xd1, 0x41, 0x9c, 0x00,
+ 0x00, 0x00, 0xca, 0xd1, 0x41, 0x99, 0x00, 0x00,
+ 0x00, 0xcb, 0xd1, 0x41, 0xa2, 0x00, 0x00, 0x00,
+ 0xcc, 0xd1, 0x41, 0xa0, 0x00, 0x00, 0x00, 0xc3,
+ 0x04, 0xd1, 0x41, 0xe8, 0x00, 0x00, 0x00, 0xc3,
+ 0x05, 0xd1, 0x41, 0xe9, 0x00, 0x00, 0x00, 0xc3,
+ 0x06, 0x65, 0x01, 0x00, 0x41, 0xea, 0x00, 0x00,
+ 0x00, 0xf4, 0xc3, 0x07, 0x37, 0xeb, 0x00, 0x00,
+ 0x00, 0xf5, 0xc3, 0x08, 0x37, 0xb6, 0x00, 0x00,
+ 0x00, 0xf5, 0xc3, 0x09, 0x0b, 0x04, 0xec, 0x00,
+ 0x00, 0x00, 0x4c, 0xed, 0x00, 0x00, 0x00, 0x04,
+ 0xee, 0x00, 0x00, 0x00, 0x4c, 0xef, 0x00, 0x00,
+ 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x4c, 0xf1,
+ 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00,
+ 0x4c, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00,
+ 0x00, 0x00, 0x4c, 0xf5, 0x00, 0x00, 0x00, 0x04,
+ 0xf6, 0x00, 0x00, 0x00, 0x4c, 0xf7, 0x00, 0x00,
+ 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x4c, 0xf9,
+ 0x00, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00,
+ 0x4c, 0xfb, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x00,
+ 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00, 0x00, 0x04,
+ 0xfe, 0x00, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00,
+ 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x4c, 0x00,
+ 0x01, 0x00, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00,
+ 0x4c, 0x02, 0x01, 0x00, 0x00, 0x04, 0x03, 0x01,
+ 0x00, 0x00, 0x4c, 0x04, 0x01, 0x00, 0x00, 0x04,
+ 0x05, 0x01, 0x00, 0x00, 0x4c, 0x06, 0x01, 0x00,
+ 0x00, 0x04, 0x07, 0x01, 0x00, 0x00, 0x4c, 0x08,
+ 0x01, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00,
+ 0x4c, 0x0a, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x01,
+ 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00, 0x00, 0x04,
+ 0x0d, 0x01, 0x00, 0x00, 0x4c, 0x0e, 0x01, 0x00,
  0x00, 0xc3, 0x0a, 0xc2, 0x07, 0xea, 0x7e, 0x0b,
- 0x04, 0xec, 0x00, 0x00, 0x00, 0x4c, 0x16, 0x00,
- 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x4c,
- 0x0c, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00,
- 0x00, 0x4c, 0x4b, 0x00, 0x00, 0x00, 0x04, 0xf8,
- 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x01, 0x00, 0x00,
- 0x04, 0xf0, 0x00, 0x00, 0x00, 0x4c, 0x49, 0x00,
- 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x4c,
- 0x0e, 0x01, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00,
- 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x07,
- 0x01, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00,
- 0x04, 0xf2, 0x00, 0x00, 0x00, 0x4c, 0x10, 0x01,
- 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00, 0x4c,
- 0x11, 0x01, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00,
- 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00, 0x04, 0xff,
- 0x00, 0x00, 0x00, 0x4c, 0x13, 0x01, 0x00, 0x00,
- 0xc3, 0x0b, 0xec, 0x7c, 0x0b, 0x04, 0x01, 0x01,
+ 0x04, 0xef, 0x00, 0x00, 0x00, 0x4c, 0x16, 0x00,
+ 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x4c,
+ 0x0f, 0x01, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00,
+ 0x00, 0x4c, 0x4b, 0x00, 0x00, 0x00, 0x04, 0xfb,
+ 0x00, 0x00, 0x00, 0x4c, 0x10, 0x01, 0x00, 0x00,
+ 0x04, 0xf3, 0x00, 0x00, 0x00, 0x4c, 0x49, 0x00,
+ 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x4c,
+ 0x11, 0x01, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00,
+ 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x0a,
+ 0x01, 0x00, 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00,
+ 0x04, 0xf5, 0x00, 0x00, 0x00, 0x4c, 0x13, 0x01,
+ 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x4c,
+ 0x14, 0x01, 0x00, 0x00, 0x04, 0xef, 0x00, 0x00,
+ 0x00, 0x4c, 0x15, 0x01, 0x00, 0x00, 0x04, 0x02,
+ 0x01, 0x00, 0x00, 0x4c, 0x16, 0x01, 0x00, 0x00,
+ 0xc3, 0x0b, 0xec, 0x7c, 0x0b, 0x04, 0x04, 0x01,
  0x00, 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00, 0x04,
- 0xfa, 0x00, 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00,
- 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x4c, 0x4b,
- 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00,
- 0x4c, 0x0d, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x00,
+ 0xfd, 0x00, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00,
+ 0x00, 0x04, 0x0c, 0x01, 0x00, 0x00, 0x4c, 0x4b,
+ 0x00, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00,
+ 0x4c, 0x10, 0x01, 0x00, 0x00, 0x04, 0xf3, 0x00,
  0x00, 0x00, 0x4c, 0x49, 0x00, 0x00, 0x00, 0x04,
- 0x0b, 0x01, 0x00, 0x00, 0x4c, 0x0e, 0x01, 0x00,
- 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x4c, 0x1b,
- 0x00, 0x00, 0x00, 0x04, 0x07, 0x01, 0x00, 0x00,
- 0x4c, 0x0f, 0x01, 0x00, 0x00, 0x04, 0x01, 0x01,
- 0x00, 0x00, 0x4c, 0x10, 0x01, 0x00, 0x00, 0x04,
- 0xee, 0x00, 0x00, 0x00, 0x4c, 0x11, 0x01, 0x00,
- 0x00, 0x04, 0x0b, 0x01, 0x00, 0x00, 0x4c, 0x12,
- 0x01, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00,
- 0x4c, 0x13, 0x01, 0x00, 0x00, 0xc3, 0x0b, 0x26,
+ 0x0e, 0x01, 0x00, 0x00, 0x4c, 0x11, 0x01, 0x00,
+ 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x4c, 0x1b,
+ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x01, 0x00, 0x00,
+ 0x4c, 0x12, 0x01, 0x00, 0x00, 0x04, 0x04, 0x01,
+ 0x00, 0x00, 0x4c, 0x13, 0x01, 0x00, 0x00, 0x04,
+ 0xf1, 0x00, 0x00, 0x00, 0x4c, 0x14, 0x01, 0x00,
+ 0x00, 0x04, 0x0e, 0x01, 0x00, 0x00, 0x4c, 0x15,
+ 0x01, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00,
+ 0x4c, 0x16, 0x01, 0x00, 0x00, 0xc3, 0x0b, 0x26,
  0x00, 0x00, 0xc3, 0x0c, 0xc1, 0xc3, 0x0d, 0xc1,
  0xc3, 0x11, 0xc1, 0xc3, 0x12, 0xb5, 0xc3, 0x13,
- 0xc2, 0x07, 0xea, 0x0a, 0x04, 0x14, 0x01, 0x00,
- 0x00, 0xc3, 0x14, 0xec, 0x08, 0x04, 0x15, 0x01,
- 0x00, 0x00, 0xc3, 0x14, 0x04, 0x16, 0x01, 0x00,
+ 0xc2, 0x07, 0xea, 0x0a, 0x04, 0x17, 0x01, 0x00,
+ 0x00, 0xc3, 0x14, 0xec, 0x08, 0x04, 0x18, 0x01,
+ 0x00, 0x00, 0xc3, 0x14, 0x04, 0x19, 0x01, 0x00,
  0x00, 0xc3, 0x15, 0x0a, 0xc3, 0x16, 0x09, 0xc3,
  0x17, 0x0a, 0xc3, 0x18, 0xb5, 0xc3, 0x19, 0xc1,
  0xc3, 0x1a, 0xb5, 0xc3, 0x1b, 0xc1, 0xc3, 0x1c,
  0xb5, 0xc3, 0x1d, 0xc1, 0xc3, 0x1e, 0xb5, 0xc3,
  0x1f, 0x09, 0xc3, 0x23, 0xb5, 0xc3, 0x24, 0xb5,
  0xc3, 0x25, 0xb5, 0xc3, 0x29, 0x0b, 0xc2, 0x3c,
- 0x4c, 0x17, 0x01, 0x00, 0x00, 0xc2, 0x3f, 0x4c,
- 0x18, 0x01, 0x00, 0x00, 0xc2, 0x59, 0x4c, 0x19,
- 0x01, 0x00, 0x00, 0xc2, 0x4d, 0x4c, 0x1a, 0x01,
- 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x1b, 0x01, 0x00,
- 0x00, 0xc2, 0x3e, 0x4c, 0x1c, 0x01, 0x00, 0x00,
- 0xc2, 0x3a, 0x4c, 0x1d, 0x01, 0x00, 0x00, 0xc2,
- 0x4e, 0x4c, 0x1e, 0x01, 0x00, 0x00, 0xc2, 0x5e,
- 0x4c, 0x1f, 0x01, 0x00, 0x00, 0xc2, 0x44, 0x4c,
- 0x20, 0x01, 0x00, 0x00, 0xc2, 0x54, 0x4c, 0x21,
- 0x01, 0x00, 0x00, 0xc2, 0x44, 0x4c, 0x22, 0x01,
- 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x23, 0x01, 0x00,
- 0x00, 0xc2, 0x46, 0x4c, 0x24, 0x01, 0x00, 0x00,
- 0xc2, 0x39, 0x4c, 0x25, 0x01, 0x00, 0x00, 0xc2,
- 0x3b, 0x4c, 0x26, 0x01, 0x00, 0x00, 0xc2, 0x3b,
- 0x4c, 0x27, 0x01, 0x00, 0x00, 0xc2, 0x4f, 0x4c,
- 0x28, 0x01, 0x00, 0x00, 0xc2, 0x5a, 0x4c, 0x29,
- 0x01, 0x00, 0x00, 0xc2, 0x58, 0x4c, 0x2a, 0x01,
- 0x00, 0x00, 0xc2, 0x46, 0x4c, 0x2b, 0x01, 0x00,
- 0x00, 0xc2, 0x47, 0x4c, 0x2c, 0x01, 0x00, 0x00,
- 0xc2, 0x3e, 0x4c, 0x2d, 0x01, 0x00, 0x00, 0xc2,
- 0x3f, 0x4c, 0x2e, 0x01, 0x00, 0x00, 0xc2, 0x42,
- 0x4c, 0x2f, 0x01, 0x00, 0x00, 0xc2, 0x43, 0x4c,
- 0x30, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c, 0x31,
- 0x01, 0x00, 0x00, 0xc2, 0x43, 0x4c, 0x32, 0x01,
- 0x00, 0x00, 0xc2, 0x3c, 0x4c, 0x33, 0x01, 0x00,
- 0x00, 0xc2, 0x4c, 0x4c, 0x34, 0x01, 0x00, 0x00,
- 0xc2, 0x3d, 0x4c, 0x35, 0x01, 0x00, 0x00, 0xc2,
- 0x49, 0x4c, 0x36, 0x01, 0x00, 0x00, 0xc2, 0x4a,
- 0x4c, 0x37, 0x01, 0x00, 0x00, 0xc2, 0x46, 0x4c,
- 0x38, 0x01, 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x39,
- 0x01, 0x00, 0x00, 0xc2, 0x3e, 0x4c, 0x3a, 0x01,
- 0x00, 0x00, 0xc2, 0x3f, 0x4c, 0x3b, 0x01, 0x00,
- 0x00, 0xc2, 0x3d, 0x4c, 0x3c, 0x01, 0x00, 0x00,
- 0xc2, 0x3c, 0x4c, 0x3d, 0x01, 0x00, 0x00, 0xc2,
- 0x57, 0x4c, 0x3e, 0x01, 0x00, 0x00, 0xc2, 0x43,
- 0x4c, 0x3f, 0x01, 0x00, 0x00, 0xc2, 0x56, 0x4c,
- 0x40, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c, 0x41,
- 0x01, 0x00, 0x00, 0xc2, 0x55, 0x4c, 0x42, 0x01,
- 0x00, 0x00, 0xc2, 0x52, 0x4c, 0x43, 0x01, 0x00,
- 0x00, 0xc2, 0x50, 0x4c, 0x44, 0x01, 0x00, 0x00,
- 0xc2, 0x51, 0x4c, 0x45, 0x01, 0x00, 0x00, 0xc2,
- 0x4e, 0x4c, 0x46, 0x01, 0x00, 0x00, 0xc3, 0x5f,
- 0x09, 0xc3, 0x68, 0x04, 0xe3, 0x00, 0x00, 0x00,
+ 0x4c, 0x1a, 0x01, 0x00, 0x00, 0xc2, 0x3f, 0x4c,
+ 0x1b, 0x01, 0x00, 0x00, 0xc2, 0x59, 0x4c, 0x1c,
+ 0x01, 0x00, 0x00, 0xc2, 0x4d, 0x4c, 0x1d, 0x01,
+ 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x1e, 0x01, 0x00,
+ 0x00, 0xc2, 0x3e, 0x4c, 0x1f, 0x01, 0x00, 0x00,
+ 0xc2, 0x3a, 0x4c, 0x20, 0x01, 0x00, 0x00, 0xc2,
+ 0x4e, 0x4c, 0x21, 0x01, 0x00, 0x00, 0xc2, 0x5e,
+ 0x4c, 0x22, 0x01, 0x00, 0x00, 0xc2, 0x44, 0x4c,
+ 0x23, 0x01, 0x00, 0x00, 0xc2, 0x54, 0x4c, 0x24,
+ 0x01, 0x00, 0x00, 0xc2, 0x44, 0x4c, 0x25, 0x01,
+ 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x26, 0x01, 0x00,
+ 0x00, 0xc2, 0x46, 0x4c, 0x27, 0x01, 0x00, 0x00,
+ 0xc2, 0x39, 0x4c, 0x28, 0x01, 0x00, 0x00, 0xc2,
+ 0x3b, 0x4c, 0x29, 0x01, 0x00, 0x00, 0xc2, 0x3b,
+ 0x4c, 0x2a, 0x01, 0x00, 0x00, 0xc2, 0x4f, 0x4c,
+ 0x2b, 0x01, 0x00, 0x00, 0xc2, 0x5a, 0x4c, 0x2c,
+ 0x01, 0x00, 0x00, 0xc2, 0x58, 0x4c, 0x2d, 0x01,
+ 0x00, 0x00, 0xc2, 0x46, 0x4c, 0x2e, 0x01, 0x00,
+ 0x00, 0xc2, 0x47, 0x4c, 0x2f, 0x01, 0x00, 0x00,
+ 0xc2, 0x3e, 0x4c, 0x30, 0x01, 0x00, 0x00, 0xc2,
+ 0x3f, 0x4c, 0x31, 0x01, 0x00, 0x00, 0xc2, 0x42,
+ 0x4c, 0x32, 0x01, 0x00, 0x00, 0xc2, 0x43, 0x4c,
+ 0x33, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c, 0x34,
+ 0x01, 0x00, 0x00, 0xc2, 0x43, 0x4c, 0x35, 0x01,
+ 0x00, 0x00, 0xc2, 0x3c, 0x4c, 0x36, 0x01, 0x00,
+ 0x00, 0xc2, 0x4c, 0x4c, 0x37, 0x01, 0x00, 0x00,
+ 0xc2, 0x3d, 0x4c, 0x38, 0x01, 0x00, 0x00, 0xc2,
+ 0x49, 0x4c, 0x39, 0x01, 0x00, 0x00, 0xc2, 0x4a,
+ 0x4c, 0x3a, 0x01, 0x00, 0x00, 0xc2, 0x46, 0x4c,
+ 0x3b, 0x01, 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x3c,
+ 0x01, 0x00, 0x00, 0xc2, 0x3e, 0x4c, 0x3d, 0x01,
+ 0x00, 0x00, 0xc2, 0x3f, 0x4c, 0x3e, 0x01, 0x00,
+ 0x00, 0xc2, 0x3d, 0x4c, 0x3f, 0x01, 0x00, 0x00,
+ 0xc2, 0x3c, 0x4c, 0x40, 0x01, 0x00, 0x00, 0xc2,
+ 0x57, 0x4c, 0x41, 0x01, 0x00, 0x00, 0xc2, 0x43,
+ 0x4c, 0x42, 0x01, 0x00, 0x00, 0xc2, 0x56, 0x4c,
+ 0x43, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c, 0x44,
+ 0x01, 0x00, 0x00, 0xc2, 0x55, 0x4c, 0x45, 0x01,
+ 0x00, 0x00, 0xc2, 0x52, 0x4c, 0x46, 0x01, 0x00,
+ 0x00, 0xc2, 0x50, 0x4c, 0x47, 0x01, 0x00, 0x00,
+ 0xc2, 0x51, 0x4c, 0x48, 0x01, 0x00, 0x00, 0xc2,
+ 0x4e, 0x4c, 0x49, 0x01, 0x00, 0x00, 0xc3, 0x5f,
+ 0x09, 0xc3, 0x68, 0x04, 0xe6, 0x00, 0x00, 0x00,
  0xc3, 0x69, 0xc2, 0x07, 0xea, 0x09, 0xd1, 0xc0,
- 0x40, 0x43, 0x47, 0x01, 0x00, 0x00, 0xc2, 0x2a,
+ 0x40, 0x43, 0x4a, 0x01, 0x00, 0x00, 0xc2, 0x2a,
  0xee, 0x0e, 0xc2, 0x72, 0xee, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0x90, 0x05, 0x00, 0x01, 0x00, 0x04,
+ 0x02, 0x03, 0x96, 0x05, 0x00, 0x01, 0x00, 0x04,
  0x07, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x26, 0x01,
  0x00, 0x00, 0x0c, 0x00, 0x28, 0x01, 0x00, 0x01,
  0x0c, 0x00, 0x2b, 0x01, 0x00, 0x27, 0x01, 0x00,
  0x2c, 0x01, 0x65, 0x01, 0x00, 0x41, 0x0d, 0x00,
- 0x00, 0x00, 0x42, 0x49, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x42, 0x4c, 0x01, 0x00, 0x00, 0x24,
  0x00, 0x00, 0xe1, 0xbd, 0x50, 0xe3, 0x65, 0x03,
- 0x00, 0x42, 0x4a, 0x01, 0x00, 0x00, 0xdd, 0x24,
+ 0x00, 0x42, 0x4d, 0x01, 0x00, 0x00, 0xdd, 0x24,
  0x01, 0x00, 0xea, 0x35, 0x65, 0x03, 0x00, 0x41,
- 0x4b, 0x01, 0x00, 0x00, 0xea, 0x14, 0x65, 0x03,
- 0x00, 0x42, 0x4b, 0x01, 0x00, 0x00, 0xdd, 0x24,
+ 0x4e, 0x01, 0x00, 0x00, 0xea, 0x14, 0x65, 0x03,
+ 0x00, 0x42, 0x4e, 0x01, 0x00, 0x00, 0xdd, 0x24,
  0x01, 0x00, 0xcd, 0xea, 0x05, 0xc5, 0xb5, 0x47,
- 0xe3, 0x65, 0x03, 0x00, 0x41, 0x4c, 0x01, 0x00,
- 0x00, 0xea, 0x0e, 0x65, 0x03, 0x00, 0x42, 0x4c,
+ 0xe3, 0x65, 0x03, 0x00, 0x41, 0x4f, 0x01, 0x00,
+ 0x00, 0xea, 0x0e, 0x65, 0x03, 0x00, 0x42, 0x4f,
  0x01, 0x00, 0x00, 0xdd, 0x24, 0x01, 0x00, 0x0e,
- 0x65, 0x03, 0x00, 0x42, 0x4d, 0x01, 0x00, 0x00,
- 0x65, 0x03, 0x00, 0x41, 0x4e, 0x01, 0x00, 0x00,
+ 0x65, 0x03, 0x00, 0x42, 0x50, 0x01, 0x00, 0x00,
+ 0x65, 0x03, 0x00, 0x41, 0x51, 0x01, 0x00, 0x00,
  0x5e, 0x04, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x38,
- 0xa8, 0x00, 0x00, 0x00, 0x11, 0xbd, 0x40, 0x21,
+ 0xab, 0x00, 0x00, 0x00, 0x11, 0xbd, 0x40, 0x21,
  0x01, 0x00, 0x5f, 0x05, 0x00, 0x65, 0x03, 0x00,
- 0x42, 0x4f, 0x01, 0x00, 0x00, 0xdd, 0x5e, 0x06,
+ 0x42, 0x52, 0x01, 0x00, 0x00, 0xdd, 0x5e, 0x06,
  0x00, 0x24, 0x02, 0x00, 0x29, 0x0e, 0x43, 0x02,
- 0x03, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x02, 0x01,
- 0x00, 0x04, 0x00, 0xa2, 0x05, 0x2d, 0x01, 0xdd,
- 0xb8, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa4,
+ 0x03, 0xa6, 0x05, 0x00, 0x00, 0x00, 0x02, 0x01,
+ 0x00, 0x04, 0x00, 0xa8, 0x05, 0x2d, 0x01, 0xdd,
+ 0xb8, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xaa,
  0x05, 0x00, 0x02, 0x00, 0x06, 0x04, 0x00, 0x28,
  0x00, 0x00, 0x01, 0x0c, 0x00, 0x26, 0x01, 0x00,
  0x27, 0x01, 0x00, 0x2d, 0x01, 0x65, 0x00, 0x00,
- 0x42, 0x53, 0x01, 0x00, 0x00, 0xde, 0xdf, 0x41,
- 0x54, 0x01, 0x00, 0x00, 0xb5, 0xdf, 0xe9, 0x24,
+ 0x42, 0x56, 0x01, 0x00, 0x00, 0xde, 0xdf, 0x41,
+ 0x57, 0x01, 0x00, 0x00, 0xb5, 0xdf, 0xe9, 0x24,
  0x04, 0x00, 0xc9, 0xb5, 0xca, 0xc6, 0xc5, 0xa3,
  0xea, 0x0b, 0xe0, 0xdf, 0xc6, 0x47, 0xef, 0x0e,
  0x93, 0x01, 0xec, 0xf2, 0x29, 0x0e, 0x43, 0x02,
- 0x03, 0xa2, 0x05, 0x01, 0x00, 0x01, 0x04, 0x04,
+ 0x03, 0xa8, 0x05, 0x01, 0x00, 0x01, 0x04, 0x04,
  0x00, 0x5f, 0x00, 0x00, 0x16, 0x01, 0x00, 0x66,
  0x01, 0x00, 0x24, 0x01, 0x00, 0x25, 0x01, 0xdd,
  0x96, 0xea, 0x06, 0xde, 0xd1, 0xef, 0x0e, 0x29,
@@ -720,95 +720,95 @@ const uint8_t qjsc_repl[16089] = {
  0x00, 0xa6, 0x9d, 0xe3, 0xd1, 0xb6, 0xbb, 0xdf,
  0x9e, 0xa0, 0xb6, 0x9e, 0xad, 0xe4, 0x29, 0xb5,
  0xe3, 0xde, 0xd1, 0xef, 0x0e, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xaa, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x02, 0x03, 0xb0, 0x05, 0x01, 0x00, 0x01, 0x02,
  0x00, 0x00, 0x35, 0x00, 0xd1, 0x97, 0x04, 0x4b,
  0x00, 0x00, 0x00, 0xab, 0x11, 0xea, 0x2a, 0x0e,
- 0xd1, 0x04, 0x56, 0x01, 0x00, 0x00, 0xa6, 0x11,
- 0xea, 0x09, 0x0e, 0xd1, 0x04, 0x57, 0x01, 0x00,
+ 0xd1, 0x04, 0x59, 0x01, 0x00, 0x00, 0xa6, 0x11,
+ 0xea, 0x09, 0x0e, 0xd1, 0x04, 0x5a, 0x01, 0x00,
  0x00, 0xa4, 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x04,
- 0x58, 0x01, 0x00, 0x00, 0xa6, 0x11, 0xea, 0x09,
- 0x0e, 0xd1, 0x04, 0x59, 0x01, 0x00, 0x00, 0xa4,
- 0x28, 0x0e, 0x43, 0x02, 0x03, 0xb4, 0x05, 0x01,
+ 0x5b, 0x01, 0x00, 0x00, 0xa6, 0x11, 0xea, 0x09,
+ 0x0e, 0xd1, 0x04, 0x5c, 0x01, 0x00, 0x00, 0xa4,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xba, 0x05, 0x01,
  0x00, 0x01, 0x02, 0x00, 0x02, 0x19, 0x00, 0xd1,
  0x97, 0x04, 0x4b, 0x00, 0x00, 0x00, 0xab, 0x11,
  0xea, 0x0e, 0x0e, 0xd1, 0xbf, 0x00, 0xa6, 0x11,
  0xea, 0x06, 0x0e, 0xd1, 0xbf, 0x01, 0xa4, 0x28,
  0x07, 0x02, 0x30, 0x07, 0x02, 0x39, 0x0e, 0x43,
- 0x02, 0x03, 0xb6, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x02, 0x03, 0xbc, 0x05, 0x01, 0x00, 0x01, 0x02,
  0x02, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x01, 0x00,
  0x2f, 0x01, 0xd1, 0x97, 0x04, 0x4b, 0x00, 0x00,
  0x00, 0xab, 0x11, 0xea, 0x22, 0x0e, 0xdd, 0xd1,
  0xef, 0x11, 0xeb, 0x1b, 0x0e, 0xde, 0xd1, 0xef,
- 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x04, 0x5c, 0x01,
+ 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x04, 0x5f, 0x01,
  0x00, 0x00, 0xa9, 0x11, 0xeb, 0x09, 0x0e, 0xd1,
- 0x04, 0x5d, 0x01, 0x00, 0x00, 0xa9, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0xbc, 0x05, 0x01, 0x04, 0x01,
+ 0x04, 0x60, 0x01, 0x00, 0x00, 0xa9, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0xc2, 0x05, 0x01, 0x04, 0x01,
  0x03, 0x00, 0x00, 0x32, 0x00, 0xd1, 0xe9, 0xcc,
  0xb5, 0xc9, 0xb5, 0xcb, 0xc7, 0xc8, 0xa3, 0xea,
- 0x25, 0xd1, 0x42, 0x5f, 0x01, 0x00, 0x00, 0xc7,
+ 0x25, 0xd1, 0x42, 0x62, 0x01, 0x00, 0x00, 0xc7,
  0x24, 0x01, 0x00, 0xce, 0x01, 0x00, 0xdc, 0x00,
  0x00, 0xa3, 0x11, 0xeb, 0x09, 0x0e, 0xc6, 0x01,
  0x00, 0xe0, 0x00, 0x00, 0xa6, 0xea, 0x03, 0x93,
  0x00, 0x93, 0x02, 0xec, 0xd8, 0xc5, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0xc0, 0x05, 0x01, 0x01, 0x01,
+ 0x43, 0x02, 0x03, 0xc6, 0x05, 0x01, 0x01, 0x01,
  0x03, 0x00, 0x00, 0x29, 0x00, 0xd1, 0x97, 0x04,
  0x4b, 0x00, 0x00, 0x00, 0xac, 0xea, 0x03, 0x09,
- 0x28, 0xd1, 0x42, 0x61, 0x01, 0x00, 0x00, 0xb5,
+ 0x28, 0xd1, 0x42, 0x64, 0x01, 0x00, 0x00, 0xb5,
  0x24, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xdc, 0x00,
  0x00, 0xa6, 0x11, 0xea, 0x09, 0x0e, 0xc5, 0x01,
  0x00, 0xe0, 0x00, 0x00, 0xa3, 0x28, 0x0e, 0x43,
- 0x02, 0x03, 0xc4, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x02, 0x03, 0xca, 0x05, 0x02, 0x00, 0x02, 0x03,
  0x00, 0x00, 0x23, 0x00, 0xd1, 0xd2, 0x9d, 0x11,
- 0x04, 0x63, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13,
- 0x11, 0x04, 0x64, 0x01, 0x00, 0x00, 0xab, 0xeb,
- 0x0a, 0x11, 0x04, 0x65, 0x01, 0x00, 0x00, 0xab,
+ 0x04, 0x66, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13,
+ 0x11, 0x04, 0x67, 0x01, 0x00, 0x00, 0xab, 0xeb,
+ 0x0a, 0x11, 0x04, 0x68, 0x01, 0x00, 0x00, 0xab,
  0xea, 0x03, 0x0a, 0x28, 0x0e, 0x09, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0xcc, 0x05, 0x03, 0x03, 0x03,
+ 0x43, 0x02, 0x03, 0xd2, 0x05, 0x03, 0x03, 0x03,
  0x06, 0x03, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0c,
  0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0xd2, 0xca,
  0xc6, 0xd1, 0xe9, 0xa3, 0xea, 0x5b, 0xd3, 0xc6,
  0xcd, 0x47, 0xcb, 0xc6, 0x8f, 0xce, 0xd1, 0xe9,
  0xa3, 0xea, 0x08, 0xd3, 0xc6, 0x47, 0xc7, 0xa9,
- 0xeb, 0xf2, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0xeb, 0xf2, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
  0x00, 0x00, 0xde, 0xdf, 0xc7, 0x47, 0x11, 0xeb,
  0x07, 0x0e, 0x04, 0x16, 0x00, 0x00, 0x00, 0x47,
  0x24, 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00, 0x42,
- 0x67, 0x01, 0x00, 0x00, 0xd1, 0x42, 0x68, 0x01,
+ 0x6a, 0x01, 0x00, 0x00, 0xd1, 0x42, 0x6b, 0x01,
  0x00, 0x00, 0xc5, 0xc6, 0x24, 0x02, 0x00, 0x24,
- 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0xde, 0x04, 0xea, 0x00, 0x00,
+ 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0xde, 0x04, 0xed, 0x00, 0x00,
  0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0xec, 0xa1,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xd2, 0x05, 0x02,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xd8, 0x05, 0x02,
  0x00, 0x02, 0x05, 0x01, 0x00, 0x1d, 0x00, 0x00,
- 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
- 0x00, 0x00, 0x04, 0x6a, 0x01, 0x00, 0x00, 0xd1,
+ 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
+ 0x00, 0x00, 0x04, 0x6d, 0x01, 0x00, 0x00, 0xd1,
  0xb6, 0xaa, 0xea, 0x04, 0xd1, 0xec, 0x02, 0xc1,
  0x9d, 0xd2, 0x9d, 0x24, 0x01, 0x00, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0xd6, 0x05, 0x01, 0x02, 0x01,
+ 0x43, 0x02, 0x03, 0xdc, 0x05, 0x01, 0x02, 0x01,
  0x04, 0x05, 0x00, 0xa1, 0x01, 0x00, 0x00, 0x29,
  0x01, 0x00, 0x28, 0x01, 0x00, 0x00, 0x0c, 0x00,
  0x04, 0x01, 0x00, 0x35, 0x01, 0xd1, 0xb5, 0xa5,
  0xea, 0x4d, 0xd1, 0xb5, 0xaa, 0x69, 0x97, 0x00,
  0x00, 0x00, 0xdd, 0xde, 0xb6, 0x9e, 0xa9, 0xea,
- 0x19, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00,
- 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x19, 0x65, 0x02, 0x00, 0x42, 0x6a, 0x01, 0x00,
+ 0x00, 0x04, 0x23, 0x01, 0x00, 0x00, 0x24, 0x01,
  0x00, 0x0e, 0xb5, 0xe1, 0xd1, 0x8e, 0xd5, 0xec,
- 0xda, 0xe0, 0x42, 0x6c, 0x01, 0x00, 0x00, 0xde,
+ 0xda, 0xe0, 0x42, 0x6f, 0x01, 0x00, 0x00, 0xde,
  0xb6, 0x9e, 0xdd, 0x9e, 0xd1, 0x24, 0x02, 0x00,
- 0xca, 0x5e, 0x04, 0x00, 0xc6, 0x04, 0x6d, 0x01,
+ 0xca, 0x5e, 0x04, 0x00, 0xc6, 0x04, 0x70, 0x01,
  0x00, 0x00, 0xf0, 0x0e, 0xd1, 0xc6, 0x9e, 0xd5,
  0xdd, 0xc6, 0x9d, 0xe1, 0xec, 0xb5, 0xd1, 0x8c,
  0xd5, 0xd1, 0xb5, 0xaa, 0xea, 0x48, 0xdd, 0xb5,
  0xa9, 0xea, 0x22, 0x5e, 0x04, 0x00, 0xb6, 0x04,
- 0x56, 0x01, 0x00, 0x00, 0xf0, 0x0e, 0x5e, 0x04,
- 0x00, 0xde, 0xb6, 0x9e, 0x04, 0x6d, 0x01, 0x00,
+ 0x59, 0x01, 0x00, 0x00, 0xf0, 0x0e, 0x5e, 0x04,
+ 0x00, 0xde, 0xb6, 0x9e, 0x04, 0x70, 0x01, 0x00,
  0x00, 0xf0, 0x0e, 0xd1, 0x8e, 0xd5, 0xde, 0xb6,
- 0x9e, 0xe1, 0xec, 0xd6, 0xe0, 0x42, 0x6c, 0x01,
+ 0x9e, 0xe1, 0xec, 0xd6, 0xe0, 0x42, 0x6f, 0x01,
  0x00, 0x00, 0xd1, 0xdd, 0x24, 0x02, 0x00, 0xca,
- 0x5e, 0x04, 0x00, 0xc6, 0x04, 0x6e, 0x01, 0x00,
+ 0x5e, 0x04, 0x00, 0xc6, 0x04, 0x71, 0x01, 0x00,
  0x00, 0xf0, 0x0e, 0xd1, 0xc6, 0x9e, 0xd5, 0xdd,
  0xc6, 0x9e, 0xe1, 0xec, 0xb5, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xde, 0x05, 0x00, 0x05, 0x00, 0x06,
+ 0x02, 0x03, 0xe4, 0x05, 0x00, 0x05, 0x00, 0x06,
  0x0d, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x1c, 0x01,
  0x00, 0x1e, 0x01, 0x00, 0x18, 0x01, 0x00, 0x1f,
  0x01, 0x00, 0x00, 0x0c, 0x00, 0x36, 0x01, 0x00,
@@ -816,362 +816,362 @@ const uint8_t qjsc_repl[16089] = {
  0x00, 0x34, 0x01, 0x00, 0x29, 0x01, 0x00, 0x28,
  0x01, 0x00, 0x1d, 0x01, 0xdd, 0xde, 0xaa, 0x69,
  0xc6, 0x00, 0x00, 0x00, 0xdf, 0x96, 0xea, 0x32,
- 0xde, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xe0,
- 0x24, 0x02, 0x00, 0xdd, 0x42, 0x68, 0x01, 0x00,
+ 0xde, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xe0,
+ 0x24, 0x02, 0x00, 0xdd, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xb5, 0xe0, 0x24, 0x02, 0x00, 0xa9, 0xea,
- 0x19, 0x65, 0x04, 0x00, 0x42, 0x67, 0x01, 0x00,
- 0x00, 0xdd, 0x42, 0x68, 0x01, 0x00, 0x00, 0xe0,
+ 0x19, 0x65, 0x04, 0x00, 0x42, 0x6a, 0x01, 0x00,
+ 0x00, 0xdd, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xe0,
  0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xec,
  0x53, 0x5e, 0x05, 0x00, 0x5e, 0x06, 0x00, 0xde,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xe0, 0x24,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xe0, 0x24,
  0x02, 0x00, 0xef, 0x8c, 0xef, 0x0e, 0xdf, 0xea,
  0x2e, 0x5e, 0x07, 0x00, 0xea, 0x0e, 0x5e, 0x07,
- 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x9d, 0xdd,
+ 0x00, 0x04, 0x23, 0x01, 0x00, 0x00, 0x9d, 0xdd,
  0x9d, 0xec, 0x02, 0xdd, 0xcf, 0xe9, 0xdd, 0xe9,
  0x9e, 0xcc, 0x5e, 0x08, 0x00, 0xc7, 0xef, 0xc3,
  0x04, 0x5e, 0x09, 0x00, 0xc7, 0xc8, 0xc2, 0x04,
  0xb7, 0x47, 0xf1, 0x0e, 0xec, 0x0e, 0x65, 0x04,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0xdd, 0x24,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0xdd, 0x24,
  0x01, 0x00, 0x0e, 0x5e, 0x0a, 0x00, 0x5e, 0x06,
  0x00, 0xdd, 0xef, 0x9d, 0x5e, 0x0b, 0x00, 0x9c,
  0x60, 0x0a, 0x00, 0xb5, 0xa9, 0xea, 0x12, 0x65,
- 0x04, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
- 0x70, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
- 0x65, 0x04, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x71, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x04, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04,
+ 0x73, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x65, 0x04, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x74, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0xdd, 0xe2, 0xdd, 0xe9, 0xe4, 0x5e, 0x0c,
  0x00, 0xe0, 0xa5, 0xea, 0x19, 0x5e, 0x05, 0x00,
- 0x5e, 0x06, 0x00, 0xdd, 0x42, 0x68, 0x01, 0x00,
+ 0x5e, 0x06, 0x00, 0xdd, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xe0, 0x5e, 0x0c, 0x00, 0x24, 0x02, 0x00,
  0xef, 0xef, 0x0e, 0xec, 0x1f, 0x5e, 0x0c, 0x00,
  0xe0, 0xa3, 0xea, 0x18, 0x5e, 0x05, 0x00, 0x5e,
- 0x06, 0x00, 0xdd, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0xdd, 0x42, 0x6b, 0x01, 0x00, 0x00,
  0x5e, 0x0c, 0x00, 0xe0, 0x24, 0x02, 0x00, 0xef,
  0x8c, 0xef, 0x0e, 0x5e, 0x0c, 0x00, 0xe4, 0x65,
- 0x04, 0x00, 0x41, 0x72, 0x01, 0x00, 0x00, 0x42,
- 0x73, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xe8, 0x05, 0x01, 0x00,
+ 0x04, 0x00, 0x41, 0x75, 0x01, 0x00, 0x00, 0x42,
+ 0x76, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xee, 0x05, 0x01, 0x00,
  0x01, 0x04, 0x02, 0x00, 0x22, 0x00, 0x00, 0x1c,
  0x01, 0x00, 0x1d, 0x01, 0xd1, 0xea, 0x1f, 0xdd,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xde, 0x24,
- 0x02, 0x00, 0xd1, 0x9d, 0xdd, 0x42, 0x68, 0x01,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xde, 0x24,
+ 0x02, 0x00, 0xd1, 0x9d, 0xdd, 0x42, 0x6b, 0x01,
  0x00, 0x00, 0xde, 0x24, 0x01, 0x00, 0x9d, 0xe1,
  0xde, 0xd1, 0xe9, 0x9d, 0xe2, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xea, 0x05, 0x00, 0x00, 0x00, 0x01,
- 0x01, 0x00, 0x03, 0x00, 0xec, 0x05, 0x23, 0x01,
- 0x0a, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xee,
+ 0x02, 0x03, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x01,
+ 0x01, 0x00, 0x03, 0x00, 0xf2, 0x05, 0x23, 0x01,
+ 0x0a, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xf4,
  0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x07,
- 0x00, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05, 0x1d,
+ 0x00, 0xf6, 0x05, 0x1c, 0x01, 0xf8, 0x05, 0x1d,
  0x01, 0xc1, 0xe1, 0xb5, 0xe2, 0xbd, 0xfe, 0x28,
- 0x0e, 0x43, 0x02, 0x03, 0xf4, 0x05, 0x00, 0x00,
+ 0x0e, 0x43, 0x02, 0x03, 0xfa, 0x05, 0x00, 0x00,
  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0xf6, 0x05, 0x00, 0x00, 0x00,
- 0x01, 0x01, 0x00, 0x03, 0x00, 0xf2, 0x05, 0x1d,
+ 0x43, 0x02, 0x03, 0xfc, 0x05, 0x00, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x03, 0x00, 0xf8, 0x05, 0x1d,
  0x01, 0xb5, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xf8, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
- 0x04, 0x00, 0xf2, 0x05, 0x1d, 0x01, 0xf0, 0x05,
+ 0xfe, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+ 0x04, 0x00, 0xf8, 0x05, 0x1d, 0x01, 0xf6, 0x05,
  0x1c, 0x01, 0xde, 0xe9, 0xe1, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xfa, 0x05, 0x00, 0x00, 0x00, 0x04,
- 0x03, 0x00, 0x1d, 0x00, 0xf2, 0x05, 0x1d, 0x01,
- 0xf0, 0x05, 0x1c, 0x01, 0xc0, 0x05, 0x32, 0x01,
+ 0x02, 0x03, 0x80, 0x06, 0x00, 0x00, 0x00, 0x04,
+ 0x03, 0x00, 0x1d, 0x00, 0xf8, 0x05, 0x1d, 0x01,
+ 0xf6, 0x05, 0x1c, 0x01, 0xc6, 0x05, 0x32, 0x01,
  0xdd, 0xde, 0xe9, 0xa3, 0xea, 0x17, 0xdd, 0x8f,
- 0xe1, 0xdf, 0xde, 0x42, 0x7e, 0x01, 0x00, 0x00,
+ 0xe1, 0xdf, 0xde, 0x42, 0x81, 0x01, 0x00, 0x00,
  0xdd, 0x24, 0x01, 0x00, 0xef, 0xea, 0x06, 0xdd,
  0x8f, 0xe1, 0xec, 0xee, 0x29, 0x0e, 0x43, 0x02,
- 0x03, 0xfe, 0x05, 0x00, 0x00, 0x00, 0x04, 0x03,
- 0x00, 0x1c, 0x00, 0xf2, 0x05, 0x1d, 0x01, 0xc0,
- 0x05, 0x32, 0x01, 0xf0, 0x05, 0x1c, 0x01, 0xdd,
+ 0x03, 0x84, 0x06, 0x00, 0x00, 0x00, 0x04, 0x03,
+ 0x00, 0x1c, 0x00, 0xf8, 0x05, 0x1d, 0x01, 0xc6,
+ 0x05, 0x32, 0x01, 0xf6, 0x05, 0x1c, 0x01, 0xdd,
  0xb5, 0xa5, 0xea, 0x17, 0xdd, 0x8e, 0xe1, 0xde,
- 0xdf, 0x42, 0x7e, 0x01, 0x00, 0x00, 0xdd, 0x24,
+ 0xdf, 0x42, 0x81, 0x01, 0x00, 0x00, 0xdd, 0x24,
  0x01, 0x00, 0xef, 0xea, 0x06, 0xdd, 0x8e, 0xe1,
- 0xec, 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x80,
+ 0xec, 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x86,
  0x06, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x35,
  0x00, 0x00, 0x1c, 0x01, 0x00, 0x30, 0x01, 0xd1,
  0xdd, 0xe9, 0xa3, 0xea, 0x15, 0xde, 0xdd, 0x42,
- 0x7e, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0x81, 0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
  0xef, 0x96, 0xea, 0x06, 0xd1, 0x8f, 0xd5, 0xec,
  0xe7, 0xd1, 0xdd, 0xe9, 0xa3, 0xea, 0x14, 0xde,
- 0xdd, 0x42, 0x7e, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0xdd, 0x42, 0x81, 0x01, 0x00, 0x00, 0xd1, 0x24,
  0x01, 0x00, 0xef, 0xea, 0x06, 0xd1, 0x8f, 0xd5,
  0xec, 0xe8, 0xd1, 0x28, 0x0e, 0x43, 0x02, 0x03,
- 0x82, 0x06, 0x01, 0x00, 0x01, 0x05, 0x02, 0x00,
+ 0x88, 0x06, 0x01, 0x00, 0x01, 0x05, 0x02, 0x00,
  0x37, 0x00, 0x00, 0x30, 0x01, 0x00, 0x1c, 0x01,
  0xd1, 0xb5, 0xa5, 0xea, 0x17, 0xdd, 0xde, 0x42,
- 0x7e, 0x01, 0x00, 0x00, 0xd1, 0xb6, 0x9e, 0x24,
+ 0x81, 0x01, 0x00, 0x00, 0xd1, 0xb6, 0x9e, 0x24,
  0x01, 0x00, 0xef, 0x96, 0xea, 0x06, 0xd1, 0x8e,
  0xd5, 0xec, 0xe6, 0xd1, 0xb5, 0xa5, 0xea, 0x16,
- 0xdd, 0xde, 0x42, 0x7e, 0x01, 0x00, 0x00, 0xd1,
+ 0xdd, 0xde, 0x42, 0x81, 0x01, 0x00, 0x00, 0xd1,
  0xb6, 0x9e, 0x24, 0x01, 0x00, 0xef, 0xea, 0x06,
  0xd1, 0x8e, 0xd5, 0xec, 0xe7, 0xd1, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0x84, 0x06, 0x00, 0x00, 0x00,
- 0x02, 0x02, 0x00, 0x05, 0x00, 0xf2, 0x05, 0x1d,
- 0x01, 0x80, 0x06, 0x40, 0x01, 0xde, 0xdd, 0xef,
- 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x86, 0x06,
+ 0x43, 0x02, 0x03, 0x8a, 0x06, 0x00, 0x00, 0x00,
+ 0x02, 0x02, 0x00, 0x05, 0x00, 0xf8, 0x05, 0x1d,
+ 0x01, 0x86, 0x06, 0x40, 0x01, 0xde, 0xdd, 0xef,
+ 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x8c, 0x06,
  0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x05, 0x00,
- 0xf2, 0x05, 0x1d, 0x01, 0x82, 0x06, 0x41, 0x01,
+ 0xf8, 0x05, 0x1d, 0x01, 0x88, 0x06, 0x41, 0x01,
  0xde, 0xdd, 0xef, 0xe1, 0x29, 0x0e, 0x43, 0x02,
- 0x03, 0x88, 0x06, 0x00, 0x00, 0x00, 0x03, 0x03,
- 0x00, 0x17, 0x00, 0xc6, 0x03, 0x00, 0x0c, 0x8a,
- 0x06, 0x45, 0x01, 0xf0, 0x05, 0x1c, 0x01, 0x65,
- 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
- 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x03, 0x8e, 0x06, 0x00, 0x00, 0x00, 0x03, 0x03,
+ 0x00, 0x17, 0x00, 0xcc, 0x03, 0x00, 0x0c, 0x90,
+ 0x06, 0x45, 0x01, 0xf6, 0x05, 0x1c, 0x01, 0x65,
+ 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04,
+ 0x23, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
  0xde, 0xdf, 0xef, 0x0e, 0xb4, 0x28, 0x0e, 0x43,
- 0x02, 0x03, 0x8a, 0x06, 0x01, 0x00, 0x01, 0x03,
+ 0x02, 0x03, 0x90, 0x06, 0x01, 0x00, 0x01, 0x03,
  0x02, 0x00, 0x12, 0x00, 0x00, 0x0c, 0x01, 0x00,
- 0x20, 0x01, 0xd1, 0xea, 0x0c, 0xdd, 0x42, 0x86,
+ 0x20, 0x01, 0xd1, 0xea, 0x0c, 0xdd, 0x42, 0x89,
  0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e,
  0xdd, 0xe9, 0xe2, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0x8e, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00,
- 0x20, 0x00, 0x90, 0x06, 0x20, 0x01, 0x92, 0x06,
- 0x0c, 0x01, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05,
+ 0x94, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00,
+ 0x20, 0x00, 0x96, 0x06, 0x20, 0x01, 0x98, 0x06,
+ 0x0c, 0x01, 0xf6, 0x05, 0x1c, 0x01, 0xf8, 0x05,
  0x1d, 0x01, 0xdd, 0xb5, 0xa5, 0xea, 0x1b, 0xdd,
- 0xde, 0xe9, 0xa9, 0xea, 0x0c, 0xde, 0x42, 0x86,
+ 0xde, 0xe9, 0xa9, 0xea, 0x0c, 0xde, 0x42, 0x89,
  0x01, 0x00, 0x00, 0xdf, 0x24, 0x01, 0x00, 0x0e,
  0xdd, 0x8e, 0xe1, 0xde, 0xdd, 0x47, 0xe7, 0xe9,
- 0xe4, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x94, 0x06,
+ 0xe4, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9a, 0x06,
  0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x12, 0x00,
- 0x90, 0x06, 0x20, 0x01, 0x92, 0x06, 0x0c, 0x01,
- 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05, 0x1d, 0x01,
+ 0x96, 0x06, 0x20, 0x01, 0x98, 0x06, 0x0c, 0x01,
+ 0xf6, 0x05, 0x1c, 0x01, 0xf8, 0x05, 0x1d, 0x01,
  0xdd, 0xde, 0xe9, 0xb6, 0x9e, 0xa3, 0xea, 0x0a,
  0xdd, 0x8f, 0xe1, 0xde, 0xdd, 0x47, 0xe7, 0xe9,
- 0xe4, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x96, 0x06,
+ 0xe4, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9c, 0x06,
  0x01, 0x03, 0x01, 0x05, 0x04, 0x00, 0x3d, 0x00,
  0x00, 0x1d, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x20,
  0x01, 0x00, 0x1c, 0x01, 0xdd, 0xc9, 0xb6, 0xca,
  0xc6, 0xde, 0xe9, 0xa4, 0xea, 0x33, 0xde, 0xe9,
  0xc6, 0xd1, 0x9a, 0x9d, 0xdf, 0x9d, 0xde, 0xe9,
- 0x9c, 0xcb, 0xde, 0xc7, 0x47, 0x42, 0x68, 0x01,
+ 0x9c, 0xcb, 0xde, 0xc7, 0x47, 0x42, 0x6b, 0x01,
  0x00, 0x00, 0xb5, 0xc5, 0x24, 0x02, 0x00, 0xe0,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xc5, 0x24,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xc5, 0x24,
  0x02, 0x00, 0xa9, 0xea, 0x08, 0xc7, 0xe3, 0xde,
  0xc7, 0x47, 0xe4, 0x29, 0x93, 0x01, 0xec, 0xc9,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0x98, 0x06, 0x00,
- 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x96,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x9c,
  0x06, 0x48, 0x01, 0xdd, 0xb4, 0x23, 0x01, 0x00,
- 0x0e, 0x43, 0x02, 0x03, 0x9a, 0x06, 0x00, 0x00,
- 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x96, 0x06,
+ 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x06, 0x00, 0x00,
+ 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x9c, 0x06,
  0x48, 0x01, 0xdd, 0xb6, 0x23, 0x01, 0x00, 0x0e,
- 0x43, 0x02, 0x03, 0x9c, 0x06, 0x01, 0x02, 0x01,
+ 0x43, 0x02, 0x03, 0xa2, 0x06, 0x01, 0x02, 0x01,
  0x04, 0x05, 0x00, 0x66, 0x00, 0x00, 0x1d, 0x01,
  0x00, 0x32, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x22,
  0x01, 0x00, 0x53, 0x01, 0xdd, 0xc9, 0xd1, 0xb5,
  0xa3, 0xea, 0x15, 0x92, 0x00, 0xde, 0xdf, 0x42,
- 0x7e, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01, 0x00,
+ 0x81, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01, 0x00,
  0xef, 0xea, 0x05, 0x92, 0x00, 0xec, 0xef, 0xc5,
- 0xb6, 0x9d, 0xca, 0xde, 0xdf, 0x42, 0x7e, 0x01,
+ 0xb6, 0x9d, 0xca, 0xde, 0xdf, 0x42, 0x81, 0x01,
  0x00, 0x00, 0xc6, 0x24, 0x01, 0x00, 0xef, 0xea,
  0x05, 0x93, 0x01, 0xec, 0xef, 0xc5, 0xb5, 0xa6,
  0xea, 0x30, 0xc5, 0xdf, 0xe9, 0xa3, 0xea, 0x2a,
  0xe0, 0x5e, 0x04, 0x00, 0xab, 0xea, 0x0a, 0x5e,
  0x04, 0x00, 0xc5, 0xc6, 0xd1, 0xf1, 0x0e, 0x29,
- 0xdf, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xc5,
- 0x24, 0x02, 0x00, 0xdf, 0x42, 0x68, 0x01, 0x00,
+ 0xdf, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xc5,
+ 0x24, 0x02, 0x00, 0xdf, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xc6, 0x24, 0x01, 0x00, 0x9d, 0xe3, 0xc5,
- 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e, 0x06,
+ 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa4, 0x06,
  0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00,
- 0x9c, 0x06, 0x4b, 0x01, 0xdd, 0xb6, 0xef, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x06, 0x00, 0x00,
- 0x00, 0x03, 0x03, 0x00, 0x1f, 0x00, 0xf0, 0x05,
- 0x1c, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0x9c, 0x06,
+ 0xa2, 0x06, 0x4b, 0x01, 0xdd, 0xb6, 0xef, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xa6, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x03, 0x00, 0x1f, 0x00, 0xf6, 0x05,
+ 0x1c, 0x01, 0xcc, 0x03, 0x00, 0x0c, 0xa2, 0x06,
  0x4b, 0x01, 0xdd, 0xe9, 0xb5, 0xa9, 0xea, 0x15,
- 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x65, 0x01, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x23, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0xbd, 0xfd, 0x28, 0xdf, 0xb6, 0xef, 0x0e,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x06, 0x00,
- 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00, 0x9c,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa8, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00, 0xa2,
  0x06, 0x4b, 0x01, 0xdd, 0xb4, 0xef, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0xa4, 0x06, 0x00, 0x01, 0x00,
+ 0x43, 0x02, 0x03, 0xaa, 0x06, 0x00, 0x01, 0x00,
  0x06, 0x02, 0x00, 0x51, 0x00, 0x00, 0x1d, 0x01,
  0x00, 0x1c, 0x01, 0xdd, 0xc9, 0xde, 0xe9, 0xb6,
  0xa5, 0xea, 0x49, 0xc5, 0xb5, 0xa5, 0xea, 0x44,
  0xc5, 0xde, 0xe9, 0xa9, 0xea, 0x03, 0x92, 0x00,
- 0xde, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xc5,
- 0xb6, 0x9e, 0x24, 0x02, 0x00, 0xde, 0x42, 0x68,
+ 0xde, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xc5,
+ 0xb6, 0x9e, 0x24, 0x02, 0x00, 0xde, 0x42, 0x6b,
  0x01, 0x00, 0x00, 0xc5, 0xc5, 0xb6, 0x9d, 0x24,
- 0x02, 0x00, 0x9d, 0xde, 0x42, 0x68, 0x01, 0x00,
+ 0x02, 0x00, 0x9d, 0xde, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xc5, 0xb6, 0x9e, 0xc5, 0x24, 0x02, 0x00,
- 0x9d, 0xde, 0x42, 0x68, 0x01, 0x00, 0x00, 0xc5,
+ 0x9d, 0xde, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xc5,
  0xb6, 0x9d, 0x24, 0x01, 0x00, 0x9d, 0xe2, 0xc5,
  0xb6, 0x9d, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xa6, 0x06, 0x00, 0x04, 0x00, 0x05, 0x04, 0x00,
+ 0xac, 0x06, 0x00, 0x04, 0x00, 0x05, 0x04, 0x00,
  0x57, 0x00, 0x00, 0x41, 0x01, 0x00, 0x1d, 0x01,
  0x00, 0x40, 0x01, 0x00, 0x1c, 0x01, 0xdd, 0xde,
  0xef, 0xc9, 0xdf, 0xc5, 0xef, 0xca, 0xdf, 0xde,
  0xef, 0xcb, 0xdd, 0xc7, 0xef, 0xcc, 0xc5, 0xc6,
  0xa3, 0xea, 0x42, 0xc6, 0xde, 0xa4, 0xea, 0x3d,
  0xde, 0xc8, 0xa4, 0xea, 0x38, 0xc8, 0xc7, 0xa3,
- 0xea, 0x33, 0xe0, 0x42, 0x68, 0x01, 0x00, 0x00,
- 0xb5, 0xc5, 0x24, 0x02, 0x00, 0xe0, 0x42, 0x68,
+ 0xea, 0x33, 0xe0, 0x42, 0x6b, 0x01, 0x00, 0x00,
+ 0xb5, 0xc5, 0x24, 0x02, 0x00, 0xe0, 0x42, 0x6b,
  0x01, 0x00, 0x00, 0xc8, 0xc7, 0x24, 0x02, 0x00,
- 0x9d, 0xe0, 0x42, 0x68, 0x01, 0x00, 0x00, 0xc6,
- 0xc8, 0x24, 0x02, 0x00, 0x9d, 0xe0, 0x42, 0x68,
+ 0x9d, 0xe0, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xc6,
+ 0xc8, 0x24, 0x02, 0x00, 0x9d, 0xe0, 0x42, 0x6b,
  0x01, 0x00, 0x00, 0xc5, 0xc6, 0x24, 0x02, 0x00,
  0x9d, 0xe4, 0xc7, 0xe2, 0x29, 0x0e, 0x43, 0x02,
- 0x03, 0xa8, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+ 0x03, 0xae, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
  0x00, 0x30, 0x00, 0x00, 0x40, 0x01, 0x00, 0x1d,
  0x01, 0x00, 0x1c, 0x01, 0xdd, 0xde, 0xef, 0xc9,
- 0xdf, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xde,
- 0x24, 0x02, 0x00, 0xdf, 0x42, 0x68, 0x01, 0x00,
- 0x00, 0xde, 0xc5, 0x24, 0x02, 0x00, 0x42, 0x95,
+ 0xdf, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xde,
+ 0x24, 0x02, 0x00, 0xdf, 0x42, 0x6b, 0x01, 0x00,
+ 0x00, 0xde, 0xc5, 0x24, 0x02, 0x00, 0x42, 0x98,
  0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9d, 0xdf,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01,
  0x00, 0x9d, 0xe3, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xac, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x00,
+ 0xb2, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x00,
  0x30, 0x00, 0x00, 0x40, 0x01, 0x00, 0x1d, 0x01,
  0x00, 0x1c, 0x01, 0xdd, 0xde, 0xef, 0xc9, 0xdf,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xde, 0x24,
- 0x02, 0x00, 0xdf, 0x42, 0x68, 0x01, 0x00, 0x00,
- 0xde, 0xc5, 0x24, 0x02, 0x00, 0x42, 0x97, 0x01,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xde, 0x24,
+ 0x02, 0x00, 0xdf, 0x42, 0x6b, 0x01, 0x00, 0x00,
+ 0xde, 0xc5, 0x24, 0x02, 0x00, 0x42, 0x9a, 0x01,
  0x00, 0x00, 0x24, 0x00, 0x00, 0x9d, 0xdf, 0x42,
- 0x68, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01, 0x00,
- 0x9d, 0xe3, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb0,
+ 0x6b, 0x01, 0x00, 0x00, 0xc5, 0x24, 0x01, 0x00,
+ 0x9d, 0xe3, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb6,
  0x06, 0x03, 0x01, 0x03, 0x04, 0x06, 0x00, 0x5e,
  0x00, 0x00, 0x1c, 0x01, 0x00, 0x22, 0x01, 0x00,
  0x53, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x1d, 0x01,
- 0x00, 0x21, 0x01, 0xdd, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0x21, 0x01, 0xdd, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xd1, 0xd2, 0x24, 0x02, 0x00, 0xc9, 0xde,
  0xdf, 0xac, 0xea, 0x05, 0xc5, 0xe4, 0xec, 0x10,
  0xd3, 0xb5, 0xa3, 0xea, 0x07, 0xc5, 0xe0, 0x9d,
  0xe4, 0xec, 0x05, 0xe0, 0xc5, 0x9d, 0xe4, 0xdd,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xd1, 0x24,
- 0x02, 0x00, 0xdd, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xd1, 0x24,
+ 0x02, 0x00, 0xdd, 0x42, 0x6b, 0x01, 0x00, 0x00,
  0xd2, 0x24, 0x01, 0x00, 0x9d, 0xe1, 0x5e, 0x04,
  0x00, 0xd2, 0xa5, 0xea, 0x0d, 0x5e, 0x04, 0x00,
  0xd2, 0xd1, 0x9e, 0x9e, 0x5f, 0x04, 0x00, 0xec,
  0x0c, 0x5e, 0x04, 0x00, 0xd1, 0xa5, 0xea, 0x05,
  0xd1, 0x5f, 0x04, 0x00, 0xdf, 0x5f, 0x05, 0x00,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x06, 0x00,
- 0x00, 0x00, 0x04, 0x03, 0x00, 0x07, 0x00, 0xb0,
- 0x06, 0x53, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0xf0,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x06, 0x00,
+ 0x00, 0x00, 0x04, 0x03, 0x00, 0x07, 0x00, 0xb6,
+ 0x06, 0x53, 0x01, 0xf8, 0x05, 0x1d, 0x01, 0xf6,
  0x05, 0x1c, 0x01, 0xdd, 0xde, 0xdf, 0xe9, 0xb6,
- 0xf1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb4, 0x06,
+ 0xf1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xba, 0x06,
  0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x06, 0x00,
- 0xb0, 0x06, 0x53, 0x01, 0xf2, 0x05, 0x1d, 0x01,
+ 0xb6, 0x06, 0x53, 0x01, 0xf8, 0x05, 0x1d, 0x01,
  0xdd, 0xb5, 0xde, 0xb4, 0xf1, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xb6, 0x06, 0x00, 0x00, 0x00, 0x04,
- 0x03, 0x00, 0x08, 0x00, 0xb0, 0x06, 0x53, 0x01,
- 0xf2, 0x05, 0x1d, 0x01, 0x80, 0x06, 0x40, 0x01,
+ 0x02, 0x03, 0xbc, 0x06, 0x00, 0x00, 0x00, 0x04,
+ 0x03, 0x00, 0x08, 0x00, 0xb6, 0x06, 0x53, 0x01,
+ 0xf8, 0x05, 0x1d, 0x01, 0x86, 0x06, 0x40, 0x01,
  0xdd, 0xde, 0xdf, 0xde, 0xef, 0xb6, 0xf1, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x06, 0x00, 0x00,
- 0x00, 0x04, 0x03, 0x00, 0x08, 0x00, 0xb0, 0x06,
- 0x53, 0x01, 0x82, 0x06, 0x41, 0x01, 0xf2, 0x05,
+ 0x0e, 0x43, 0x02, 0x03, 0xbe, 0x06, 0x00, 0x00,
+ 0x00, 0x04, 0x03, 0x00, 0x08, 0x00, 0xb6, 0x06,
+ 0x53, 0x01, 0x88, 0x06, 0x41, 0x01, 0xf8, 0x05,
  0x1d, 0x01, 0xdd, 0xde, 0xdf, 0xef, 0xdf, 0xb4,
- 0xf1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xba, 0x06,
+ 0xf1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x06,
  0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00,
- 0xe8, 0x05, 0x38, 0x01, 0xbc, 0x06, 0x0d, 0x01,
+ 0xee, 0x05, 0x38, 0x01, 0xc2, 0x06, 0x0d, 0x01,
  0xdd, 0xde, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xbe, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00,
- 0x39, 0x00, 0xc0, 0x06, 0x22, 0x01, 0xbe, 0x06,
- 0x59, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xc2, 0x06,
+ 0xc4, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00,
+ 0x39, 0x00, 0xc6, 0x06, 0x22, 0x01, 0xc4, 0x06,
+ 0x59, 0x01, 0xcc, 0x03, 0x00, 0x0c, 0xc8, 0x06,
  0x64, 0x01, 0xdd, 0xde, 0xab, 0xea, 0x20, 0x65,
- 0x02, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
- 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
- 0x65, 0x02, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0x02, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04,
+ 0x23, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x65, 0x02, 0x00, 0x42, 0xa5, 0x01, 0x00, 0x00,
  0xb5, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x65, 0x02,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0xa3,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0xa6,
  0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xe0,
- 0xee, 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc8,
+ 0xee, 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xce,
  0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x05,
- 0x00, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05, 0x1d,
+ 0x00, 0xf6, 0x05, 0x1c, 0x01, 0xf8, 0x05, 0x1d,
  0x01, 0xc1, 0xe1, 0xb5, 0xe2, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xca, 0x06, 0x02, 0x01, 0x02, 0x04,
+ 0x02, 0x03, 0xd0, 0x06, 0x02, 0x01, 0x02, 0x04,
  0x01, 0x00, 0x1d, 0x00, 0x00, 0x30, 0x01, 0xc1,
  0xc9, 0xd2, 0xb5, 0xa5, 0xea, 0x15, 0xdd, 0xd1,
  0xd2, 0xb6, 0x9e, 0x47, 0xef, 0xea, 0x0c, 0xd2,
  0x8e, 0xd6, 0xd1, 0xd2, 0x47, 0xc5, 0x9d, 0xc9,
  0xec, 0xe8, 0xc5, 0x28, 0x0e, 0x43, 0x02, 0x03,
- 0xcc, 0x06, 0x02, 0x06, 0x02, 0x05, 0x7a, 0x02,
- 0x87, 0x02, 0x08, 0xce, 0x06, 0x00, 0x01, 0x00,
- 0xd0, 0x06, 0x00, 0x01, 0x00, 0xd2, 0x06, 0x00,
- 0x00, 0x00, 0xd4, 0x06, 0x00, 0x01, 0x00, 0xd6,
+ 0xd2, 0x06, 0x02, 0x06, 0x02, 0x05, 0x7a, 0x02,
+ 0x87, 0x02, 0x08, 0xd4, 0x06, 0x00, 0x01, 0x00,
+ 0xd6, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00,
+ 0x00, 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xdc,
  0x06, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00,
  0xe8, 0x01, 0x00, 0x01, 0x00, 0xa0, 0x01, 0x00,
- 0x01, 0x00, 0xd8, 0x06, 0x00, 0x03, 0xaa, 0x02,
- 0x00, 0x01, 0xb2, 0x02, 0x01, 0x01, 0xac, 0x02,
- 0x02, 0x01, 0xbe, 0x02, 0x03, 0x01, 0xba, 0x02,
- 0x04, 0x01, 0xca, 0x03, 0x05, 0x01, 0xcc, 0x03,
- 0x06, 0x01, 0xda, 0x06, 0x07, 0x01, 0xdc, 0x06,
- 0x08, 0x01, 0xde, 0x06, 0x09, 0x01, 0xe0, 0x06,
- 0x0a, 0x01, 0xe2, 0x06, 0x0b, 0x01, 0x92, 0x06,
- 0x0c, 0x01, 0xbc, 0x06, 0x0d, 0x01, 0xe4, 0x06,
- 0x0e, 0x01, 0xe6, 0x06, 0x0f, 0x01, 0xe8, 0x06,
- 0x10, 0x01, 0xea, 0x06, 0x11, 0x01, 0xec, 0x06,
- 0x12, 0x01, 0xee, 0x06, 0x13, 0x01, 0xf0, 0x06,
- 0x14, 0x01, 0xf2, 0x06, 0x15, 0x01, 0xf4, 0x06,
- 0x16, 0x01, 0xf6, 0x06, 0x17, 0x01, 0xf8, 0x06,
- 0x18, 0x01, 0xfa, 0x06, 0x19, 0x01, 0xfc, 0x06,
- 0x1a, 0x01, 0xfe, 0x06, 0x1b, 0x01, 0xf0, 0x05,
- 0x1c, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0x80, 0x07,
- 0x1e, 0x01, 0x82, 0x07, 0x1f, 0x01, 0x90, 0x06,
- 0x20, 0x01, 0x84, 0x07, 0x21, 0x01, 0xc0, 0x06,
- 0x22, 0x01, 0xec, 0x05, 0x23, 0x01, 0x86, 0x07,
- 0x24, 0x01, 0x88, 0x07, 0x25, 0x01, 0x8a, 0x07,
- 0x26, 0x01, 0x8c, 0x07, 0x27, 0x01, 0x8e, 0x07,
- 0x28, 0x01, 0x90, 0x07, 0x29, 0x01, 0x90, 0x05,
- 0x2a, 0x01, 0xa0, 0x05, 0x2b, 0x01, 0xa4, 0x05,
- 0x2c, 0x01, 0xa2, 0x05, 0x2d, 0x01, 0xaa, 0x05,
- 0x2e, 0x01, 0xb4, 0x05, 0x2f, 0x01, 0xb6, 0x05,
- 0x30, 0x01, 0xbc, 0x05, 0x31, 0x01, 0xc0, 0x05,
- 0x32, 0x01, 0xc4, 0x05, 0x33, 0x01, 0xcc, 0x05,
- 0x34, 0x01, 0xd2, 0x05, 0x35, 0x01, 0xd6, 0x05,
- 0x36, 0x01, 0xde, 0x05, 0x37, 0x01, 0xe8, 0x05,
- 0x38, 0x01, 0xea, 0x05, 0x39, 0x01, 0xee, 0x05,
- 0x3a, 0x01, 0xf4, 0x05, 0x3b, 0x01, 0xf6, 0x05,
- 0x3c, 0x01, 0xf8, 0x05, 0x3d, 0x01, 0xfa, 0x05,
- 0x3e, 0x01, 0xfe, 0x05, 0x3f, 0x01, 0x80, 0x06,
- 0x40, 0x01, 0x82, 0x06, 0x41, 0x01, 0x84, 0x06,
- 0x42, 0x01, 0x86, 0x06, 0x43, 0x01, 0x88, 0x06,
- 0x44, 0x01, 0x8a, 0x06, 0x45, 0x01, 0x8e, 0x06,
- 0x46, 0x01, 0x94, 0x06, 0x47, 0x01, 0x96, 0x06,
- 0x48, 0x01, 0x98, 0x06, 0x49, 0x01, 0x9a, 0x06,
- 0x4a, 0x01, 0x9c, 0x06, 0x4b, 0x01, 0x9e, 0x06,
- 0x4c, 0x01, 0xa0, 0x06, 0x4d, 0x01, 0xa2, 0x06,
- 0x4e, 0x01, 0xa4, 0x06, 0x4f, 0x01, 0xa6, 0x06,
- 0x50, 0x01, 0xa8, 0x06, 0x51, 0x01, 0xac, 0x06,
- 0x52, 0x01, 0xb0, 0x06, 0x53, 0x01, 0xb2, 0x06,
- 0x54, 0x01, 0xb4, 0x06, 0x55, 0x01, 0xb6, 0x06,
- 0x56, 0x01, 0xb8, 0x06, 0x57, 0x01, 0xba, 0x06,
- 0x58, 0x01, 0xbe, 0x06, 0x59, 0x01, 0xc8, 0x06,
- 0x5a, 0x01, 0xca, 0x06, 0x5b, 0x01, 0xcc, 0x06,
- 0x5c, 0x01, 0x92, 0x07, 0x5d, 0x01, 0x94, 0x07,
- 0x5e, 0x01, 0x96, 0x07, 0x5f, 0x01, 0x98, 0x07,
- 0x60, 0x01, 0x9a, 0x07, 0x61, 0x01, 0x9c, 0x07,
- 0x62, 0x01, 0x9e, 0x07, 0x63, 0x01, 0xc2, 0x06,
- 0x64, 0x01, 0xa0, 0x07, 0x65, 0x01, 0xa2, 0x07,
- 0x66, 0x01, 0xa4, 0x07, 0x67, 0x01, 0xa6, 0x07,
- 0x68, 0x01, 0xa8, 0x07, 0x69, 0x01, 0xaa, 0x07,
- 0x6a, 0x01, 0xac, 0x07, 0x6b, 0x01, 0xae, 0x07,
- 0x6c, 0x01, 0xb0, 0x07, 0x6d, 0x01, 0xb2, 0x07,
- 0x6e, 0x01, 0xb4, 0x07, 0x6f, 0x01, 0xb6, 0x07,
- 0x70, 0x01, 0xb8, 0x07, 0x71, 0x01, 0xba, 0x07,
- 0x72, 0x01, 0xbc, 0x07, 0x73, 0x01, 0xbe, 0x07,
- 0x74, 0x01, 0xc0, 0x07, 0x75, 0x01, 0xc2, 0x07,
- 0x76, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xc8, 0x03,
+ 0x01, 0x00, 0xde, 0x06, 0x00, 0x03, 0xb0, 0x02,
+ 0x00, 0x01, 0xb8, 0x02, 0x01, 0x01, 0xb2, 0x02,
+ 0x02, 0x01, 0xc4, 0x02, 0x03, 0x01, 0xc0, 0x02,
+ 0x04, 0x01, 0xd0, 0x03, 0x05, 0x01, 0xd2, 0x03,
+ 0x06, 0x01, 0xe0, 0x06, 0x07, 0x01, 0xe2, 0x06,
+ 0x08, 0x01, 0xe4, 0x06, 0x09, 0x01, 0xe6, 0x06,
+ 0x0a, 0x01, 0xe8, 0x06, 0x0b, 0x01, 0x98, 0x06,
+ 0x0c, 0x01, 0xc2, 0x06, 0x0d, 0x01, 0xea, 0x06,
+ 0x0e, 0x01, 0xec, 0x06, 0x0f, 0x01, 0xee, 0x06,
+ 0x10, 0x01, 0xf0, 0x06, 0x11, 0x01, 0xf2, 0x06,
+ 0x12, 0x01, 0xf4, 0x06, 0x13, 0x01, 0xf6, 0x06,
+ 0x14, 0x01, 0xf8, 0x06, 0x15, 0x01, 0xfa, 0x06,
+ 0x16, 0x01, 0xfc, 0x06, 0x17, 0x01, 0xfe, 0x06,
+ 0x18, 0x01, 0x80, 0x07, 0x19, 0x01, 0x82, 0x07,
+ 0x1a, 0x01, 0x84, 0x07, 0x1b, 0x01, 0xf6, 0x05,
+ 0x1c, 0x01, 0xf8, 0x05, 0x1d, 0x01, 0x86, 0x07,
+ 0x1e, 0x01, 0x88, 0x07, 0x1f, 0x01, 0x96, 0x06,
+ 0x20, 0x01, 0x8a, 0x07, 0x21, 0x01, 0xc6, 0x06,
+ 0x22, 0x01, 0xf2, 0x05, 0x23, 0x01, 0x8c, 0x07,
+ 0x24, 0x01, 0x8e, 0x07, 0x25, 0x01, 0x90, 0x07,
+ 0x26, 0x01, 0x92, 0x07, 0x27, 0x01, 0x94, 0x07,
+ 0x28, 0x01, 0x96, 0x07, 0x29, 0x01, 0x96, 0x05,
+ 0x2a, 0x01, 0xa6, 0x05, 0x2b, 0x01, 0xaa, 0x05,
+ 0x2c, 0x01, 0xa8, 0x05, 0x2d, 0x01, 0xb0, 0x05,
+ 0x2e, 0x01, 0xba, 0x05, 0x2f, 0x01, 0xbc, 0x05,
+ 0x30, 0x01, 0xc2, 0x05, 0x31, 0x01, 0xc6, 0x05,
+ 0x32, 0x01, 0xca, 0x05, 0x33, 0x01, 0xd2, 0x05,
+ 0x34, 0x01, 0xd8, 0x05, 0x35, 0x01, 0xdc, 0x05,
+ 0x36, 0x01, 0xe4, 0x05, 0x37, 0x01, 0xee, 0x05,
+ 0x38, 0x01, 0xf0, 0x05, 0x39, 0x01, 0xf4, 0x05,
+ 0x3a, 0x01, 0xfa, 0x05, 0x3b, 0x01, 0xfc, 0x05,
+ 0x3c, 0x01, 0xfe, 0x05, 0x3d, 0x01, 0x80, 0x06,
+ 0x3e, 0x01, 0x84, 0x06, 0x3f, 0x01, 0x86, 0x06,
+ 0x40, 0x01, 0x88, 0x06, 0x41, 0x01, 0x8a, 0x06,
+ 0x42, 0x01, 0x8c, 0x06, 0x43, 0x01, 0x8e, 0x06,
+ 0x44, 0x01, 0x90, 0x06, 0x45, 0x01, 0x94, 0x06,
+ 0x46, 0x01, 0x9a, 0x06, 0x47, 0x01, 0x9c, 0x06,
+ 0x48, 0x01, 0x9e, 0x06, 0x49, 0x01, 0xa0, 0x06,
+ 0x4a, 0x01, 0xa2, 0x06, 0x4b, 0x01, 0xa4, 0x06,
+ 0x4c, 0x01, 0xa6, 0x06, 0x4d, 0x01, 0xa8, 0x06,
+ 0x4e, 0x01, 0xaa, 0x06, 0x4f, 0x01, 0xac, 0x06,
+ 0x50, 0x01, 0xae, 0x06, 0x51, 0x01, 0xb2, 0x06,
+ 0x52, 0x01, 0xb6, 0x06, 0x53, 0x01, 0xb8, 0x06,
+ 0x54, 0x01, 0xba, 0x06, 0x55, 0x01, 0xbc, 0x06,
+ 0x56, 0x01, 0xbe, 0x06, 0x57, 0x01, 0xc0, 0x06,
+ 0x58, 0x01, 0xc4, 0x06, 0x59, 0x01, 0xce, 0x06,
+ 0x5a, 0x01, 0xd0, 0x06, 0x5b, 0x01, 0xd2, 0x06,
+ 0x5c, 0x01, 0x98, 0x07, 0x5d, 0x01, 0x9a, 0x07,
+ 0x5e, 0x01, 0x9c, 0x07, 0x5f, 0x01, 0x9e, 0x07,
+ 0x60, 0x01, 0xa0, 0x07, 0x61, 0x01, 0xa2, 0x07,
+ 0x62, 0x01, 0xa4, 0x07, 0x63, 0x01, 0xc8, 0x06,
+ 0x64, 0x01, 0xa6, 0x07, 0x65, 0x01, 0xa8, 0x07,
+ 0x66, 0x01, 0xaa, 0x07, 0x67, 0x01, 0xac, 0x07,
+ 0x68, 0x01, 0xae, 0x07, 0x69, 0x01, 0xb0, 0x07,
+ 0x6a, 0x01, 0xb2, 0x07, 0x6b, 0x01, 0xb4, 0x07,
+ 0x6c, 0x01, 0xb6, 0x07, 0x6d, 0x01, 0xb8, 0x07,
+ 0x6e, 0x01, 0xba, 0x07, 0x6f, 0x01, 0xbc, 0x07,
+ 0x70, 0x01, 0xbe, 0x07, 0x71, 0x01, 0xc0, 0x07,
+ 0x72, 0x01, 0xc2, 0x07, 0x73, 0x01, 0xc4, 0x07,
+ 0x74, 0x01, 0xc6, 0x07, 0x75, 0x01, 0xc8, 0x07,
+ 0x76, 0x01, 0xcc, 0x03, 0x00, 0x0c, 0xce, 0x03,
  0x01, 0x0c, 0x0c, 0x03, 0xc3, 0x04, 0x08, 0xcc,
  0x0c, 0x00, 0xc3, 0x05, 0xd2, 0xb5, 0xa4, 0x11,
- 0xeb, 0x16, 0x0e, 0x04, 0xe2, 0x01, 0x00, 0x00,
- 0x42, 0xe3, 0x01, 0x00, 0x00, 0xd1, 0xd2, 0xb6,
+ 0xeb, 0x16, 0x0e, 0x04, 0xe5, 0x01, 0x00, 0x00,
+ 0x42, 0xe6, 0x01, 0x00, 0x00, 0xd1, 0xd2, 0xb6,
  0x9e, 0x47, 0x24, 0x01, 0x00, 0xb5, 0xa6, 0xea,
  0x03, 0xdd, 0x28, 0xd2, 0xb7, 0xa6, 0x69, 0xd9,
  0x00, 0x00, 0x00, 0xd1, 0xd2, 0xb6, 0x9e, 0x47,
- 0x04, 0xe4, 0x01, 0x00, 0x00, 0xab, 0x69, 0xc9,
+ 0x04, 0xe7, 0x01, 0x00, 0x00, 0xab, 0x69, 0xc9,
  0x00, 0x00, 0x00, 0xd2, 0x8e, 0xd6, 0x0b, 0xc9,
  0xd1, 0xd2, 0xb6, 0x9e, 0x47, 0xcf, 0x11, 0x04,
- 0xe5, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
- 0x04, 0xe6, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07,
- 0x04, 0x58, 0x01, 0x00, 0x00, 0x28, 0x11, 0x04,
- 0xe7, 0x01, 0x00, 0x00, 0xab, 0xea, 0x05, 0x26,
- 0x00, 0x00, 0x28, 0x11, 0x04, 0xe8, 0x01, 0x00,
+ 0xe8, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
+ 0x04, 0xe9, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07,
+ 0x04, 0x5b, 0x01, 0x00, 0x00, 0x28, 0x11, 0x04,
+ 0xea, 0x01, 0x00, 0x00, 0xab, 0xea, 0x05, 0x26,
+ 0x00, 0x00, 0x28, 0x11, 0x04, 0xeb, 0x01, 0x00,
  0x00, 0xab, 0xea, 0x03, 0x0b, 0x28, 0x11, 0x04,
- 0xe9, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07, 0xbf,
+ 0xec, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07, 0xbf,
  0x00, 0xbf, 0x01, 0x33, 0x28, 0x5e, 0x31, 0x00,
  0xc7, 0xef, 0xea, 0x73, 0x5e, 0x5c, 0x00, 0xd1,
  0xd2, 0xf0, 0xca, 0x04, 0x03, 0x00, 0x00, 0x00,
  0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
  0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x26,
- 0x04, 0x00, 0x42, 0xea, 0x01, 0x00, 0x00, 0xc6,
+ 0x04, 0x00, 0x42, 0xed, 0x01, 0x00, 0x00, 0xc6,
  0x24, 0x01, 0x00, 0x11, 0xeb, 0x0b, 0x0e, 0x38,
- 0xeb, 0x01, 0x00, 0x00, 0xc6, 0x8d, 0xef, 0x96,
+ 0xee, 0x01, 0x00, 0x00, 0xc6, 0x8d, 0xef, 0x96,
  0xea, 0x0d, 0x38, 0x3d, 0x00, 0x00, 0x00, 0xc6,
  0x31, 0x01, 0x00, 0x00, 0x00, 0x28, 0x5e, 0x5d,
  0x00, 0xd1, 0xd2, 0xc6, 0xe9, 0x9e, 0xf0, 0xcd,
@@ -1184,7 +1184,7 @@ const uint8_t qjsc_repl[16089] = {
  0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00,
  0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff,
  0x0b, 0x00, 0x01, 0x20, 0x00, 0x0c, 0x00, 0x0a,
- 0x0e, 0x43, 0x02, 0x03, 0x92, 0x07, 0x02, 0x0a,
+ 0x0e, 0x43, 0x02, 0x03, 0x98, 0x07, 0x02, 0x0a,
  0x02, 0x04, 0x03, 0x01, 0xe3, 0x01, 0x00, 0x00,
  0x5b, 0x01, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x01,
  0xdd, 0xd1, 0xd2, 0xf0, 0xc9, 0xde, 0xd1, 0xd2,
@@ -1192,20 +1192,20 @@ const uint8_t qjsc_repl[16089] = {
  0xcc, 0xb5, 0xc3, 0x04, 0xc7, 0xca, 0xc2, 0x04,
  0xbd, 0x0a, 0xa3, 0xea, 0x67, 0xc6, 0xf3, 0xeb,
  0x63, 0xc6, 0x06, 0xac, 0xea, 0x5e, 0xdf, 0x42,
- 0xec, 0x01, 0x00, 0x00, 0xc6, 0x24, 0x01, 0x00,
+ 0xef, 0x01, 0x00, 0x00, 0xc6, 0x24, 0x01, 0x00,
  0xc3, 0x07, 0xb5, 0xc3, 0x05, 0xc2, 0x05, 0xc2,
  0x07, 0xe9, 0xa3, 0xea, 0x38, 0xc2, 0x07, 0xc2,
  0x05, 0x47, 0xc4, 0x08, 0x97, 0x04, 0x4b, 0x00,
  0x00, 0x00, 0xa9, 0xea, 0x24, 0xc1, 0xc2, 0x08,
  0x8d, 0x9d, 0xc2, 0x08, 0xaa, 0xea, 0x1a, 0xc2,
- 0x08, 0x42, 0xed, 0x01, 0x00, 0x00, 0xc5, 0x24,
- 0x01, 0x00, 0xea, 0x0d, 0xc8, 0x42, 0x86, 0x01,
+ 0x08, 0x42, 0xf0, 0x01, 0x00, 0x00, 0xc5, 0x24,
+ 0x01, 0x00, 0xea, 0x0d, 0xc8, 0x42, 0x89, 0x01,
  0x00, 0x00, 0xc2, 0x08, 0x24, 0x01, 0x00, 0x0e,
  0x93, 0x05, 0xec, 0xc2, 0xdf, 0x42, 0x62, 0x00,
  0x00, 0x00, 0xc6, 0x24, 0x01, 0x00, 0xca, 0x93,
  0x04, 0xec, 0x94, 0xc8, 0xe9, 0xb6, 0xa5, 0xea,
  0x46, 0xc0, 0x00, 0xc3, 0x09, 0xc0, 0x00, 0x0e,
- 0xc8, 0x42, 0xee, 0x01, 0x00, 0x00, 0x62, 0x09,
+ 0xc8, 0x42, 0xf1, 0x01, 0x00, 0x00, 0x62, 0x09,
  0x00, 0x24, 0x01, 0x00, 0x0e, 0xb6, 0xc4, 0x05,
  0xc3, 0x04, 0xc2, 0x04, 0xc8, 0xe9, 0xa3, 0xea,
  0x1e, 0xc8, 0xc2, 0x04, 0x47, 0xc8, 0xc2, 0x04,
@@ -1213,24 +1213,24 @@ const uint8_t qjsc_repl[16089] = {
  0x05, 0x91, 0xc3, 0x05, 0x71, 0xc8, 0xc2, 0x04,
  0x47, 0x49, 0x93, 0x04, 0xec, 0xdd, 0xc8, 0xc2,
  0x05, 0x43, 0x32, 0x00, 0x00, 0x00, 0x0b, 0xc8,
- 0x4c, 0xef, 0x01, 0x00, 0x00, 0xc5, 0xe9, 0x4c,
- 0xa8, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0xf0, 0x01,
- 0x00, 0x00, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xe2,
+ 0x4c, 0xf2, 0x01, 0x00, 0x00, 0xc5, 0xe9, 0x4c,
+ 0xab, 0x01, 0x00, 0x00, 0xc7, 0x4c, 0xf3, 0x01,
+ 0x00, 0x00, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xe8,
  0x07, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x34,
  0x00, 0xd1, 0xb5, 0x47, 0xd2, 0xb5, 0x47, 0xaa,
- 0xea, 0x1b, 0xd1, 0xb5, 0x47, 0x04, 0x5c, 0x01,
+ 0xea, 0x1b, 0xd1, 0xb5, 0x47, 0x04, 0x5f, 0x01,
  0x00, 0x00, 0xa9, 0xea, 0x03, 0xb6, 0x28, 0xd2,
- 0xb5, 0x47, 0x04, 0x5c, 0x01, 0x00, 0x00, 0xa9,
+ 0xb5, 0x47, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xa9,
  0xea, 0x03, 0xb4, 0x28, 0xd1, 0xd2, 0xa3, 0xea,
  0x03, 0xb4, 0x28, 0xd1, 0xd2, 0xa5, 0xea, 0x04,
  0xb6, 0x8d, 0x28, 0xb5, 0x28, 0x0e, 0x43, 0x02,
- 0x03, 0x94, 0x07, 0x00, 0x0d, 0x00, 0x07, 0x0a,
+ 0x03, 0x9a, 0x07, 0x00, 0x0d, 0x00, 0x07, 0x0a,
  0x00, 0x8f, 0x03, 0x00, 0x00, 0x5d, 0x01, 0x00,
  0x1c, 0x01, 0x00, 0x1d, 0x01, 0x00, 0x38, 0x01,
  0x00, 0x22, 0x01, 0x00, 0x5e, 0x01, 0x00, 0x04,
  0x01, 0x00, 0x28, 0x01, 0x00, 0x00, 0x0c, 0x00,
  0x64, 0x01, 0xdd, 0xde, 0xdf, 0xf0, 0xce, 0x41,
- 0xef, 0x01, 0x00, 0x00, 0xcd, 0xe9, 0xb5, 0xab,
+ 0xf2, 0x01, 0x00, 0x00, 0xcd, 0xe9, 0xb5, 0xab,
  0xea, 0x02, 0x29, 0xc5, 0xb5, 0x47, 0xcf, 0xe9,
  0xc3, 0x05, 0xb6, 0xcc, 0xc8, 0xc5, 0xe9, 0xa3,
  0xea, 0x2a, 0xc5, 0xc8, 0x47, 0xc3, 0x06, 0xb5,
@@ -1238,61 +1238,61 @@ const uint8_t qjsc_repl[16089] = {
  0x17, 0xc2, 0x06, 0xc2, 0x04, 0x47, 0xc7, 0xc2,
  0x04, 0x47, 0xac, 0xea, 0x07, 0xc2, 0x04, 0xc3,
  0x05, 0xec, 0x05, 0x93, 0x04, 0xec, 0xe4, 0x93,
- 0x03, 0xec, 0xd2, 0xc6, 0x41, 0xa8, 0x01, 0x00,
+ 0x03, 0xec, 0xd2, 0xc6, 0x41, 0xab, 0x01, 0x00,
  0x00, 0xcc, 0xc8, 0xc2, 0x05, 0xa3, 0xea, 0x0b,
  0xe0, 0xc7, 0xc8, 0x47, 0xef, 0x0e, 0x93, 0x03,
  0xec, 0xf1, 0x5e, 0x04, 0x00, 0x5e, 0x05, 0x00,
  0xab, 0xea, 0x42, 0xc5, 0xe9, 0xb6, 0xa9, 0xea,
- 0x3c, 0xc6, 0x41, 0xf0, 0x01, 0x00, 0x00, 0xc5,
+ 0x3c, 0xc6, 0x41, 0xf3, 0x01, 0x00, 0x00, 0xc5,
  0xb5, 0x47, 0x47, 0xc4, 0x0c, 0xf5, 0xea, 0x1a,
- 0xe0, 0x04, 0xf2, 0x01, 0x00, 0x00, 0xef, 0x0e,
+ 0xe0, 0x04, 0xf5, 0x01, 0x00, 0x00, 0xef, 0x0e,
  0xc2, 0x0c, 0xe9, 0xb5, 0xa9, 0xea, 0x1e, 0xe0,
- 0x04, 0xf3, 0x01, 0x00, 0x00, 0xef, 0x0e, 0xec,
+ 0x04, 0xf6, 0x01, 0x00, 0x00, 0xef, 0x0e, 0xec,
  0x14, 0xc2, 0x0c, 0x97, 0x04, 0x4c, 0x00, 0x00,
- 0x00, 0xa9, 0xea, 0x09, 0xe0, 0x04, 0xe4, 0x01,
+ 0x00, 0xa9, 0xea, 0x09, 0xe0, 0x04, 0xe7, 0x01,
  0x00, 0x00, 0xef, 0x0e, 0x5e, 0x04, 0x00, 0x5e,
  0x05, 0x00, 0xab, 0x69, 0xdc, 0x00, 0x00, 0x00,
  0xc5, 0xe9, 0xb7, 0xa6, 0x69, 0xd3, 0x00, 0x00,
  0x00, 0xb5, 0xc3, 0x07, 0xb5, 0xcc, 0xc8, 0xc5,
  0xe9, 0xa3, 0xea, 0x18, 0x5e, 0x06, 0x00, 0x42,
- 0xf4, 0x01, 0x00, 0x00, 0xc2, 0x07, 0xc5, 0xc8,
+ 0xf7, 0x01, 0x00, 0x00, 0xc2, 0x07, 0xc5, 0xc8,
  0x47, 0xe9, 0x24, 0x02, 0x00, 0xc3, 0x07, 0x93,
  0x03, 0xec, 0xe4, 0xb7, 0x94, 0x07, 0x5e, 0x06,
- 0x00, 0x42, 0xf4, 0x01, 0x00, 0x00, 0xb6, 0x5e,
- 0x06, 0x00, 0x42, 0xf5, 0x01, 0x00, 0x00, 0x5e,
+ 0x00, 0x42, 0xf7, 0x01, 0x00, 0x00, 0xb6, 0x5e,
+ 0x06, 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00, 0x5e,
  0x07, 0x00, 0xb6, 0x9d, 0xc2, 0x07, 0x9b, 0x24,
  0x01, 0x00, 0x24, 0x02, 0x00, 0xc3, 0x09, 0x5e,
- 0x06, 0x00, 0x42, 0xf6, 0x01, 0x00, 0x00, 0xc5,
+ 0x06, 0x00, 0x42, 0xf9, 0x01, 0x00, 0x00, 0xc5,
  0xe9, 0xc2, 0x09, 0x9b, 0x24, 0x01, 0x00, 0xc3,
- 0x0b, 0x65, 0x08, 0x00, 0x42, 0x67, 0x01, 0x00,
- 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x0b, 0x65, 0x08, 0x00, 0x42, 0x6a, 0x01, 0x00,
+ 0x00, 0x04, 0x23, 0x01, 0x00, 0x00, 0x24, 0x01,
  0x00, 0x0e, 0xb5, 0xc3, 0x0a, 0xc2, 0x0a, 0xc2,
  0x0b, 0xa3, 0xea, 0x58, 0xb5, 0xc3, 0x08, 0xc2,
  0x08, 0xc2, 0x09, 0xa3, 0xea, 0x39, 0xc2, 0x08,
  0xc2, 0x0b, 0x9a, 0xc2, 0x0a, 0x9d, 0xd0, 0xc5,
  0xe9, 0xa6, 0xeb, 0x2b, 0xc5, 0xc8, 0x47, 0xcb,
  0xc2, 0x08, 0xc2, 0x09, 0xb6, 0x9e, 0xaa, 0xea,
- 0x0d, 0xc7, 0x42, 0xf7, 0x01, 0x00, 0x00, 0xc2,
+ 0x0d, 0xc7, 0x42, 0xfa, 0x01, 0x00, 0x00, 0xc2,
  0x07, 0x24, 0x01, 0x00, 0xcb, 0x65, 0x08, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0xc7, 0x24, 0x01,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0xc7, 0x24, 0x01,
  0x00, 0x0e, 0x93, 0x08, 0xec, 0xc2, 0x65, 0x08,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x20,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x23,
  0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x93,
  0x0a, 0xec, 0xa3, 0x5e, 0x09, 0x00, 0xee, 0x0e,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0x98, 0x07, 0x02,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e, 0x07, 0x02,
  0x01, 0x02, 0x02, 0x00, 0x00, 0x10, 0x00, 0xc1,
  0xc9, 0xd2, 0x90, 0xd6, 0xb5, 0xa5, 0xea, 0x06,
  0xd1, 0x94, 0x00, 0xec, 0xf5, 0xc5, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0xc2, 0x06, 0x00, 0x00, 0x00,
- 0x03, 0x07, 0x00, 0x1e, 0x00, 0xc6, 0x03, 0x00,
- 0x0c, 0xec, 0x06, 0x12, 0x01, 0x90, 0x07, 0x29,
- 0x01, 0xbc, 0x05, 0x31, 0x01, 0x8e, 0x07, 0x28,
- 0x01, 0x80, 0x07, 0x1e, 0x01, 0x82, 0x07, 0x1f,
- 0x01, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x43, 0x02, 0x03, 0xc8, 0x06, 0x00, 0x00, 0x00,
+ 0x03, 0x07, 0x00, 0x1e, 0x00, 0xcc, 0x03, 0x00,
+ 0x0c, 0xf2, 0x06, 0x12, 0x01, 0x96, 0x07, 0x29,
+ 0x01, 0xc2, 0x05, 0x31, 0x01, 0x94, 0x07, 0x28,
+ 0x01, 0x86, 0x07, 0x1e, 0x01, 0x88, 0x07, 0x1f,
+ 0x01, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00,
  0x00, 0xde, 0x24, 0x01, 0x00, 0x0e, 0xe0, 0xde,
  0xef, 0x5e, 0x04, 0x00, 0x9c, 0xe3, 0xc1, 0x5f,
  0x05, 0x00, 0xb5, 0x5f, 0x06, 0x00, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0xa0, 0x07, 0x02, 0x01, 0x02,
+ 0x43, 0x02, 0x03, 0xa6, 0x07, 0x02, 0x01, 0x02,
  0x06, 0x12, 0x01, 0xb0, 0x01, 0x00, 0x00, 0x1c,
  0x01, 0x00, 0x1d, 0x01, 0x00, 0x20, 0x01, 0x00,
  0x0c, 0x01, 0x00, 0x63, 0x01, 0x00, 0x12, 0x01,
@@ -1304,40 +1304,40 @@ const uint8_t qjsc_repl[16089] = {
  0x0e, 0xc1, 0xe5, 0xe9, 0xe2, 0xe0, 0xe9, 0xe3,
  0xd2, 0x5f, 0x04, 0x00, 0x5e, 0x06, 0x00, 0x5f,
  0x05, 0x00, 0x5e, 0x07, 0x00, 0xea, 0x22, 0x5e,
- 0x05, 0x00, 0x5e, 0x08, 0x00, 0x04, 0xf8, 0x01,
+ 0x05, 0x00, 0x5e, 0x08, 0x00, 0x04, 0xfb, 0x01,
  0x00, 0x00, 0x5e, 0x09, 0x00, 0x5e, 0x05, 0x00,
  0xe9, 0x9e, 0xf0, 0x9d, 0x60, 0x05, 0x00, 0x5e,
  0x0a, 0x00, 0x9d, 0x5f, 0x05, 0x00, 0xec, 0x66,
  0x5e, 0x0b, 0x00, 0xea, 0x50, 0x5e, 0x0c, 0x00,
- 0x42, 0xf9, 0x01, 0x00, 0x00, 0x5e, 0x0d, 0x00,
- 0x24, 0x01, 0x00, 0x04, 0xf8, 0x01, 0x00, 0x00,
+ 0x42, 0xfc, 0x01, 0x00, 0x00, 0x5e, 0x0d, 0x00,
+ 0x24, 0x01, 0x00, 0x04, 0xfb, 0x01, 0x00, 0x00,
  0x9d, 0xc9, 0xb5, 0x5f, 0x0d, 0x00, 0x5e, 0x08,
  0x00, 0xbf, 0x00, 0xba, 0xc5, 0xe9, 0x9e, 0xf0,
  0xc5, 0x9d, 0xc9, 0x5e, 0x05, 0x00, 0xc5, 0x42,
- 0x68, 0x01, 0x00, 0x00, 0xb5, 0xc5, 0xe9, 0xb9,
- 0x9e, 0x24, 0x02, 0x00, 0x04, 0xe4, 0x01, 0x00,
- 0x00, 0x9d, 0xc5, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xc5, 0xe9, 0xb9,
+ 0x9e, 0x24, 0x02, 0x00, 0x04, 0xe7, 0x01, 0x00,
+ 0x00, 0x9d, 0xc5, 0x42, 0x6b, 0x01, 0x00, 0x00,
  0xc5, 0xe9, 0xb9, 0x9e, 0x24, 0x01, 0x00, 0x9d,
  0x9d, 0x5f, 0x05, 0x00, 0x5e, 0x05, 0x00, 0xe9,
  0x5f, 0x09, 0x00, 0x5e, 0x05, 0x00, 0x5e, 0x0e,
  0x00, 0x9d, 0x5f, 0x05, 0x00, 0x5e, 0x0f, 0x00,
  0xee, 0x0e, 0x5e, 0x10, 0x00, 0xee, 0x0e, 0xb5,
  0x5f, 0x11, 0x00, 0x29, 0x07, 0x02, 0x30, 0x0e,
- 0x43, 0x02, 0x03, 0xa2, 0x07, 0x01, 0x01, 0x01,
+ 0x43, 0x02, 0x03, 0xa8, 0x07, 0x01, 0x01, 0x01,
  0x03, 0x04, 0x02, 0x8c, 0x01, 0x00, 0x00, 0x01,
  0x01, 0x00, 0x62, 0x01, 0x00, 0x61, 0x01, 0x00,
- 0x67, 0x01, 0xdd, 0x42, 0xfa, 0x01, 0x00, 0x00,
+ 0x67, 0x01, 0xdd, 0x42, 0xfd, 0x01, 0x00, 0x00,
  0xd1, 0x24, 0x01, 0x00, 0xc9, 0xde, 0x11, 0xb5,
- 0xab, 0xea, 0x16, 0xc5, 0x04, 0xfb, 0x01, 0x00,
+ 0xab, 0xea, 0x16, 0xc5, 0x04, 0xfe, 0x01, 0x00,
  0x00, 0xa9, 0xea, 0x07, 0xc5, 0xe3, 0xb6, 0xe2,
  0xec, 0x6c, 0xe0, 0xc5, 0xef, 0x0e, 0xec, 0x66,
  0x11, 0xb6, 0xab, 0xea, 0x27, 0xdf, 0xc5, 0x9d,
- 0xe3, 0xc5, 0x04, 0xfc, 0x01, 0x00, 0x00, 0xa9,
+ 0xe3, 0xc5, 0x04, 0xff, 0x01, 0x00, 0x00, 0xa9,
  0xea, 0x05, 0xb7, 0xe2, 0xec, 0x50, 0xc5, 0x04,
- 0xfd, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x05, 0xb8,
+ 0x00, 0x02, 0x00, 0x00, 0xa9, 0xea, 0x05, 0xb8,
  0xe2, 0xec, 0x43, 0xe0, 0xdf, 0xef, 0x0e, 0xb5,
  0xe2, 0xec, 0x3b, 0x11, 0xb7, 0xab, 0xea, 0x27,
- 0xdf, 0xc5, 0x9d, 0xe3, 0xc5, 0x04, 0xfe, 0x01,
+ 0xdf, 0xc5, 0x9d, 0xe3, 0xc5, 0x04, 0x01, 0x02,
  0x00, 0x00, 0xa9, 0x11, 0xeb, 0x0e, 0x0e, 0xc5,
  0xbf, 0x00, 0xa6, 0x11, 0xea, 0x06, 0x0e, 0xc5,
  0xbf, 0x01, 0xa4, 0x96, 0xea, 0x18, 0xe0, 0xdf,
@@ -1345,7 +1345,7 @@ const uint8_t qjsc_repl[16089] = {
  0xab, 0xea, 0x0b, 0xdf, 0xc5, 0x9d, 0xe3, 0xe0,
  0xdf, 0xef, 0x0e, 0xb5, 0xe2, 0x29, 0x07, 0x02,
  0x30, 0x07, 0x02, 0x39, 0x0e, 0x43, 0x02, 0x03,
- 0xa4, 0x07, 0x01, 0x01, 0x01, 0x05, 0x0d, 0x00,
+ 0xaa, 0x07, 0x01, 0x01, 0x01, 0x05, 0x0d, 0x00,
  0xb0, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x31,
  0x01, 0x00, 0x38, 0x01, 0x00, 0x5f, 0x01, 0x00,
  0x21, 0x01, 0x00, 0x63, 0x01, 0x00, 0x1c, 0x01,
@@ -1359,13 +1359,13 @@ const uint8_t qjsc_repl[16089] = {
  0x00, 0x5e, 0x06, 0x00, 0xef, 0x29, 0x11, 0xbd,
  0xfe, 0xab, 0xea, 0x07, 0x5e, 0x05, 0x00, 0x07,
  0xef, 0x29, 0x11, 0xbd, 0xfd, 0xab, 0xea, 0x26,
- 0x65, 0x07, 0x00, 0x42, 0x4d, 0x01, 0x00, 0x00,
- 0x65, 0x07, 0x00, 0x41, 0x4e, 0x01, 0x00, 0x00,
+ 0x65, 0x07, 0x00, 0x42, 0x50, 0x01, 0x00, 0x00,
+ 0x65, 0x07, 0x00, 0x41, 0x51, 0x01, 0x00, 0x00,
  0x07, 0x24, 0x02, 0x00, 0x0e, 0x65, 0x07, 0x00,
- 0x42, 0x4f, 0x01, 0x00, 0x00, 0x5e, 0x08, 0x00,
+ 0x42, 0x52, 0x01, 0x00, 0x00, 0x5e, 0x08, 0x00,
  0x07, 0x24, 0x02, 0x00, 0x29, 0x0e, 0x5e, 0x04,
  0x00, 0x5f, 0x09, 0x00, 0xec, 0x20, 0xde, 0xd1,
- 0xef, 0xb6, 0xab, 0xea, 0x14, 0xd1, 0x04, 0xf8,
+ 0xef, 0xb6, 0xab, 0xea, 0x14, 0xd1, 0x04, 0xfb,
  0x01, 0x00, 0x00, 0xa6, 0xea, 0x0b, 0xdf, 0xd1,
  0xef, 0x0e, 0xdf, 0x5f, 0x09, 0x00, 0xec, 0x06,
  0x5e, 0x0a, 0x00, 0xee, 0x0e, 0x5e, 0x0b, 0x00,
@@ -1373,76 +1373,76 @@ const uint8_t qjsc_repl[16089] = {
  0x0b, 0x00, 0x5e, 0x06, 0x00, 0xe9, 0xa5, 0xea,
  0x07, 0x5e, 0x06, 0x00, 0xe9, 0xec, 0x04, 0x5e,
  0x0b, 0x00, 0x5f, 0x0b, 0x00, 0x5e, 0x0c, 0x00,
- 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xaa, 0x07,
+ 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb0, 0x07,
  0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x70, 0x00,
  0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0xdd, 0xd1,
  0xef, 0x96, 0xea, 0x0a, 0xd1, 0x42, 0x3a, 0x00,
  0x00, 0x00, 0x25, 0x00, 0x00, 0xd1, 0xb5, 0xa9,
  0xea, 0x15, 0xb6, 0xd1, 0x9b, 0xb5, 0xa3, 0xea,
- 0x09, 0x04, 0xff, 0x01, 0x00, 0x00, 0xc9, 0xec,
+ 0x09, 0x04, 0x02, 0x02, 0x00, 0x00, 0xc9, 0xec,
  0x4c, 0xbf, 0x00, 0xc9, 0xec, 0x47, 0xd2, 0xbd,
- 0x10, 0xa9, 0xea, 0x37, 0xd1, 0xde, 0x42, 0xf5,
+ 0x10, 0xa9, 0xea, 0x37, 0xd1, 0xde, 0x42, 0xf8,
  0x01, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xab,
  0xea, 0x29, 0xd1, 0xb5, 0xa3, 0xea, 0x0c, 0xd1,
- 0x8c, 0xd5, 0x04, 0x00, 0x02, 0x00, 0x00, 0xc9,
- 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x01, 0x02,
+ 0x8c, 0xd5, 0x04, 0x03, 0x02, 0x00, 0x00, 0xc9,
+ 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x04, 0x02,
  0x00, 0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00,
  0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d, 0x9d, 0xc9,
  0xec, 0x0b, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00,
  0x24, 0x00, 0x00, 0xc9, 0xc5, 0x28, 0x07, 0x02,
- 0x30, 0x0e, 0x43, 0x02, 0x03, 0xac, 0x07, 0x02,
+ 0x30, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x07, 0x02,
  0x01, 0x02, 0x05, 0x01, 0x01, 0xfe, 0x01, 0x00,
- 0x00, 0x69, 0x01, 0x38, 0xb3, 0x00, 0x00, 0x00,
- 0x42, 0xe5, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01,
- 0x00, 0x96, 0xea, 0x29, 0xdd, 0x04, 0x02, 0x02,
- 0x00, 0x00, 0xac, 0xea, 0x17, 0x04, 0x03, 0x02,
+ 0x00, 0x69, 0x01, 0x38, 0xb6, 0x00, 0x00, 0x00,
+ 0x42, 0xe8, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01,
+ 0x00, 0x96, 0xea, 0x29, 0xdd, 0x04, 0x05, 0x02,
+ 0x00, 0x00, 0xac, 0xea, 0x17, 0x04, 0x06, 0x02,
  0x00, 0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0x9d, 0x04, 0xf3, 0x01, 0x00,
+ 0x24, 0x00, 0x00, 0x9d, 0x04, 0xf6, 0x01, 0x00,
  0x00, 0x9d, 0x28, 0xd1, 0x42, 0x3a, 0x00, 0x00,
  0x00, 0x25, 0x00, 0x00, 0xd1, 0xb5, 0xa9, 0xea,
  0x15, 0xb6, 0xd1, 0x9b, 0xb5, 0xa3, 0xea, 0x09,
- 0x04, 0xff, 0x01, 0x00, 0x00, 0xc9, 0xec, 0x3e,
+ 0x04, 0x02, 0x02, 0x00, 0x00, 0xc9, 0xec, 0x3e,
  0xbf, 0x00, 0xc9, 0xec, 0x39, 0xd2, 0xbd, 0x10,
  0xa9, 0xea, 0x29, 0xd1, 0xb5, 0xa3, 0xea, 0x0c,
- 0xd1, 0x8c, 0xd5, 0x04, 0x00, 0x02, 0x00, 0x00,
- 0xc9, 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x01,
+ 0xd1, 0x8c, 0xd5, 0x04, 0x03, 0x02, 0x00, 0x00,
+ 0xc9, 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x04,
  0x02, 0x00, 0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00,
  0x00, 0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d, 0x9d,
  0xc9, 0xec, 0x0b, 0xd1, 0x42, 0x3a, 0x00, 0x00,
  0x00, 0x24, 0x00, 0x00, 0xc9, 0xd1, 0x97, 0x04,
  0x8f, 0x00, 0x00, 0x00, 0xab, 0xea, 0x13, 0xdd,
- 0x04, 0x02, 0x02, 0x00, 0x00, 0xac, 0xea, 0x0a,
- 0x04, 0x04, 0x02, 0x00, 0x00, 0x94, 0x00, 0xec,
- 0x57, 0xdd, 0x04, 0xe3, 0x00, 0x00, 0x00, 0xac,
- 0xea, 0x4e, 0xc5, 0x42, 0xe3, 0x01, 0x00, 0x00,
- 0x04, 0xe4, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x04, 0x05, 0x02, 0x00, 0x00, 0xac, 0xea, 0x0a,
+ 0x04, 0x07, 0x02, 0x00, 0x00, 0x94, 0x00, 0xec,
+ 0x57, 0xdd, 0x04, 0xe6, 0x00, 0x00, 0x00, 0xac,
+ 0xea, 0x4e, 0xc5, 0x42, 0xe6, 0x01, 0x00, 0x00,
+ 0x04, 0xe7, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
  0xb5, 0xa3, 0xea, 0x3c, 0xd2, 0xbd, 0x10, 0xa9,
- 0x11, 0xea, 0x12, 0x0e, 0xc5, 0x42, 0xe3, 0x01,
- 0x00, 0x00, 0x04, 0x05, 0x02, 0x00, 0x00, 0x24,
+ 0x11, 0xea, 0x12, 0x0e, 0xc5, 0x42, 0xe6, 0x01,
+ 0x00, 0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x24,
  0x01, 0x00, 0xb5, 0xa3, 0x11, 0xeb, 0x18, 0x0e,
  0xd2, 0xbd, 0x0a, 0xa9, 0xea, 0x1a, 0xc5, 0x42,
- 0xe3, 0x01, 0x00, 0x00, 0x04, 0x06, 0x02, 0x00,
+ 0xe6, 0x01, 0x00, 0x00, 0x04, 0x09, 0x02, 0x00,
  0x00, 0x24, 0x01, 0x00, 0xb5, 0xa3, 0xea, 0x08,
- 0x04, 0x07, 0x02, 0x00, 0x00, 0x94, 0x00, 0xc5,
+ 0x04, 0x0a, 0x02, 0x00, 0x00, 0x94, 0x00, 0xc5,
  0x28, 0x07, 0x02, 0x30, 0x0e, 0x43, 0x02, 0x03,
- 0xae, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01, 0x00,
+ 0xb4, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01, 0x00,
  0x4a, 0x00, 0x00, 0x69, 0x01, 0xd2, 0xbd, 0x10,
  0xa9, 0xea, 0x29, 0xd1, 0xb5, 0xa3, 0xea, 0x0c,
- 0xd1, 0x8c, 0xd5, 0x04, 0x00, 0x02, 0x00, 0x00,
- 0xc9, 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x01,
+ 0xd1, 0x8c, 0xd5, 0x04, 0x03, 0x02, 0x00, 0x00,
+ 0xc9, 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x04,
  0x02, 0x00, 0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00,
  0x00, 0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d, 0x9d,
  0xc9, 0xec, 0x0b, 0xd1, 0x42, 0x3a, 0x00, 0x00,
- 0x00, 0x24, 0x00, 0x00, 0xc9, 0xdd, 0x04, 0xe3,
- 0x00, 0x00, 0x00, 0xab, 0xea, 0x08, 0x04, 0x08,
+ 0x00, 0x24, 0x00, 0x00, 0xc9, 0xdd, 0x04, 0xe6,
+ 0x00, 0x00, 0x00, 0xab, 0xea, 0x08, 0x04, 0x0b,
  0x02, 0x00, 0x00, 0x94, 0x00, 0xc5, 0x28, 0x0e,
- 0x43, 0x02, 0x03, 0xb0, 0x07, 0x01, 0x02, 0x01,
+ 0x43, 0x02, 0x03, 0xb6, 0x07, 0x01, 0x02, 0x01,
  0x02, 0x09, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x0c,
  0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00,
  0x01, 0x00, 0x6a, 0x01, 0x00, 0x68, 0x01, 0x00,
  0x6c, 0x01, 0x00, 0x6b, 0x01, 0x00, 0x01, 0x01,
  0xc0, 0x00, 0xca, 0x26, 0x00, 0x00, 0xc9, 0xc6,
- 0xd1, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x92,
+ 0xd1, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x98,
  0x08, 0x01, 0x06, 0x01, 0x05, 0x0b, 0x00, 0x95,
  0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01,
  0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
@@ -1451,377 +1451,377 @@ const uint8_t qjsc_repl[16089] = {
  0x00, 0x08, 0x00, 0xd1, 0x97, 0xc4, 0x04, 0x04,
  0x4c, 0x00, 0x00, 0x00, 0xab, 0x69, 0xdd, 0x01,
  0x00, 0x00, 0xd1, 0xf3, 0xea, 0x0f, 0x65, 0x00,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0xd1, 0x24,
- 0x01, 0x00, 0x0e, 0x29, 0xde, 0x42, 0xe3, 0x01,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x0e, 0x29, 0xde, 0x42, 0xe6, 0x01,
  0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xb5, 0xa6,
- 0xea, 0x13, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
- 0x00, 0x00, 0x04, 0x0a, 0x02, 0x00, 0x00, 0x24,
+ 0xea, 0x13, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
+ 0x00, 0x00, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0x29, 0xdf, 0xea, 0x62, 0xd1,
- 0x38, 0xe8, 0x00, 0x00, 0x00, 0xa7, 0x11, 0xeb,
- 0x40, 0x0e, 0xd1, 0x38, 0x0b, 0x02, 0x00, 0x00,
- 0xa7, 0x11, 0xeb, 0x35, 0x0e, 0xd1, 0x38, 0x0c,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xa7, 0x11, 0xeb,
+ 0x40, 0x0e, 0xd1, 0x38, 0x0e, 0x02, 0x00, 0x00,
+ 0xa7, 0x11, 0xeb, 0x35, 0x0e, 0xd1, 0x38, 0x0f,
  0x02, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x2a, 0x0e,
- 0xd1, 0x38, 0x0d, 0x02, 0x00, 0x00, 0xa7, 0x11,
- 0xeb, 0x1f, 0x0e, 0xd1, 0x38, 0x0e, 0x02, 0x00,
+ 0xd1, 0x38, 0x10, 0x02, 0x00, 0x00, 0xa7, 0x11,
+ 0xeb, 0x1f, 0x0e, 0xd1, 0x38, 0x11, 0x02, 0x00,
  0x00, 0xa7, 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x38,
- 0x0f, 0x02, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x09,
- 0x0e, 0xd1, 0x38, 0x10, 0x02, 0x00, 0x00, 0xa7,
- 0xea, 0x17, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0x12, 0x02, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x09,
+ 0x0e, 0xd1, 0x38, 0x13, 0x02, 0x00, 0x00, 0xa7,
+ 0xea, 0x17, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
  0x00, 0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00,
  0x24, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29,
- 0xde, 0x42, 0x86, 0x01, 0x00, 0x00, 0xd1, 0x24,
- 0x01, 0x00, 0x0e, 0xe0, 0x42, 0x11, 0x02, 0x00,
+ 0xde, 0x42, 0x89, 0x01, 0x00, 0x00, 0xd1, 0x24,
+ 0x01, 0x00, 0x0e, 0xe0, 0x42, 0x14, 0x02, 0x00,
  0x00, 0xd1, 0x24, 0x01, 0x00, 0x69, 0x86, 0x00,
  0x00, 0x00, 0xd1, 0xe9, 0xc9, 0x65, 0x00, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x12, 0x02,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x15, 0x02,
  0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xb5, 0xca,
  0xc6, 0xc5, 0xa3, 0xea, 0x54, 0xc6, 0xb5, 0xac,
- 0xea, 0x12, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
- 0x00, 0x00, 0x04, 0x13, 0x02, 0x00, 0x00, 0x24,
+ 0xea, 0x12, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
+ 0x00, 0x00, 0x04, 0x16, 0x02, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xc6, 0xd1, 0xa8, 0xea, 0x0b,
  0x5e, 0x04, 0x00, 0xd1, 0xc6, 0x47, 0xef, 0x0e,
- 0xec, 0x12, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
- 0x00, 0x00, 0x04, 0x14, 0x02, 0x00, 0x00, 0x24,
+ 0xec, 0x12, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
+ 0x00, 0x00, 0x04, 0x17, 0x02, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xc6, 0xbd, 0x14, 0xa5, 0xea,
- 0x14, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
- 0x00, 0x04, 0x15, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x14, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00,
+ 0x00, 0x04, 0x18, 0x02, 0x00, 0x00, 0x24, 0x01,
  0x00, 0x0e, 0xec, 0x05, 0x93, 0x01, 0xec, 0xa9,
- 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x16, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x19, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0xed, 0x9d, 0x00, 0x5e, 0x05, 0x00, 0x42,
- 0x17, 0x02, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
- 0x04, 0xa3, 0x00, 0x00, 0x00, 0xab, 0xea, 0x18,
- 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x1a, 0x02, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0x04, 0xa6, 0x00, 0x00, 0x00, 0xab, 0xea, 0x18,
+ 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
  0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00, 0x24, 0x00,
  0x00, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x71, 0x5e,
- 0x05, 0x00, 0x42, 0x18, 0x02, 0x00, 0x00, 0xd1,
+ 0x05, 0x00, 0x42, 0x1b, 0x02, 0x00, 0x00, 0xd1,
  0x24, 0x01, 0x00, 0xcf, 0xe9, 0xc9, 0x65, 0x00,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x19,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x1c,
  0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xb5,
  0xca, 0xc6, 0xc5, 0xa3, 0xea, 0x39, 0xc6, 0xb5,
- 0xac, 0xea, 0x12, 0x65, 0x00, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0x04, 0x13, 0x02, 0x00, 0x00,
+ 0xac, 0xea, 0x12, 0x65, 0x00, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0x04, 0x16, 0x02, 0x00, 0x00,
  0x24, 0x01, 0x00, 0x0e, 0xc7, 0xc6, 0x47, 0xcc,
- 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0xc8, 0x04, 0x1a, 0x02, 0x00, 0x00, 0x24, 0x02,
+ 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0xc8, 0x04, 0x1d, 0x02, 0x00, 0x00, 0x24, 0x02,
  0x00, 0x0e, 0x5e, 0x04, 0x00, 0xd1, 0xc8, 0x47,
  0xef, 0x0e, 0x93, 0x01, 0xec, 0xc4, 0x65, 0x00,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x1b,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x1e,
  0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xde,
- 0x42, 0x1c, 0x02, 0x00, 0x00, 0xd1, 0x24, 0x01,
+ 0x42, 0x1f, 0x02, 0x00, 0x00, 0xd1, 0x24, 0x01,
  0x00, 0x0e, 0x29, 0xc2, 0x04, 0x04, 0x4b, 0x00,
- 0x00, 0x00, 0xab, 0xea, 0x36, 0xd1, 0x42, 0x1d,
+ 0x00, 0x00, 0xab, 0xea, 0x36, 0xd1, 0x42, 0x20,
  0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc4, 0x05,
  0xe9, 0xbd, 0x4f, 0xa5, 0xea, 0x16, 0xc2, 0x05,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xb5, 0xbd, 0x4b,
- 0x24, 0x02, 0x00, 0x04, 0x1e, 0x02, 0x00, 0x00,
- 0x9d, 0xc3, 0x05, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xb5, 0xbd, 0x4b,
+ 0x24, 0x02, 0x00, 0x04, 0x21, 0x02, 0x00, 0x00,
+ 0x9d, 0xc3, 0x05, 0x65, 0x00, 0x00, 0x42, 0x6a,
  0x01, 0x00, 0x00, 0xc2, 0x05, 0x24, 0x01, 0x00,
  0x0e, 0x29, 0xc2, 0x04, 0x04, 0x49, 0x00, 0x00,
  0x00, 0xab, 0xea, 0x1e, 0x65, 0x00, 0x00, 0x42,
- 0x67, 0x01, 0x00, 0x00, 0x5e, 0x06, 0x00, 0xd1,
+ 0x6a, 0x01, 0x00, 0x00, 0x5e, 0x06, 0x00, 0xd1,
  0x5e, 0x07, 0x00, 0xea, 0x05, 0xbd, 0x10, 0xec,
  0x03, 0xbd, 0x0a, 0xf0, 0x24, 0x01, 0x00, 0x0e,
  0x29, 0xc2, 0x04, 0x04, 0x8e, 0x00, 0x00, 0x00,
- 0xab, 0xea, 0x1e, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0xab, 0xea, 0x1e, 0x65, 0x00, 0x00, 0x42, 0x6a,
  0x01, 0x00, 0x00, 0x5e, 0x08, 0x00, 0xd1, 0x5e,
  0x07, 0x00, 0xea, 0x05, 0xbd, 0x10, 0xec, 0x03,
  0xbd, 0x0a, 0xf0, 0x24, 0x01, 0x00, 0x0e, 0x29,
  0xc2, 0x04, 0x04, 0x8f, 0x00, 0x00, 0x00, 0xab,
- 0xea, 0x1e, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0xea, 0x1e, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
  0x00, 0x00, 0x5e, 0x09, 0x00, 0xd1, 0x5e, 0x07,
  0x00, 0xea, 0x05, 0xbd, 0x10, 0xec, 0x03, 0xbd,
  0x0a, 0xf0, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc2,
  0x04, 0x04, 0x90, 0x00, 0x00, 0x00, 0xab, 0xea,
- 0x1d, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x1d, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00,
  0x00, 0xd1, 0x42, 0x3a, 0x00, 0x00, 0x00, 0x24,
- 0x00, 0x00, 0x04, 0x1f, 0x02, 0x00, 0x00, 0x9d,
+ 0x00, 0x00, 0x04, 0x22, 0x02, 0x00, 0x00, 0x9d,
  0x24, 0x01, 0x00, 0x0e, 0x29, 0xc2, 0x04, 0x04,
  0x4d, 0x00, 0x00, 0x00, 0xab, 0xea, 0x13, 0x65,
- 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e,
+ 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x5e,
  0x0a, 0x00, 0xd1, 0xef, 0x24, 0x01, 0x00, 0x0e,
  0x29, 0xc2, 0x04, 0x04, 0x1b, 0x00, 0x00, 0x00,
- 0xab, 0xea, 0x20, 0x65, 0x00, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0x04, 0x20, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x20, 0x65, 0x00, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0x04, 0x23, 0x02, 0x00, 0x00,
  0xd1, 0x41, 0x39, 0x00, 0x00, 0x00, 0x9d, 0x04,
- 0x63, 0x01, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
- 0x0e, 0x29, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0x66, 0x01, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
  0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x07, 0x01, 0x01,
+ 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x07, 0x01, 0x01,
  0x01, 0x04, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x2e,
- 0x01, 0xd1, 0xb5, 0x47, 0x04, 0x21, 0x02, 0x00,
+ 0x01, 0xd1, 0xb5, 0x47, 0x04, 0x24, 0x02, 0x00,
  0x00, 0xac, 0xea, 0x03, 0xc1, 0x28, 0xb6, 0xc9,
  0xc5, 0xd1, 0xe9, 0xa3, 0xea, 0x0d, 0xdd, 0xd1,
  0xc5, 0x47, 0xef, 0x96, 0xeb, 0x05, 0x93, 0x00,
- 0xec, 0xef, 0xd1, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0xec, 0xef, 0xd1, 0x42, 0x6b, 0x01, 0x00, 0x00,
  0xb6, 0xc5, 0x25, 0x02, 0x00, 0x0e, 0x43, 0x02,
- 0x03, 0xb4, 0x07, 0x02, 0x04, 0x02, 0x07, 0x0c,
+ 0x03, 0xba, 0x07, 0x02, 0x04, 0x02, 0x07, 0x0c,
  0x00, 0xb2, 0x07, 0x00, 0x00, 0x70, 0x01, 0x00,
  0x00, 0x0c, 0x00, 0x68, 0x01, 0x00, 0x17, 0x01,
  0x00, 0x09, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x04,
  0x01, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x01, 0x00,
  0x06, 0x01, 0x00, 0x69, 0x01, 0x00, 0x08, 0x01,
- 0xd1, 0x04, 0x22, 0x02, 0x00, 0x00, 0xab, 0x11,
- 0xeb, 0x14, 0x0e, 0xd1, 0x04, 0x23, 0x02, 0x00,
+ 0xd1, 0x04, 0x25, 0x02, 0x00, 0x00, 0xab, 0x11,
+ 0xeb, 0x14, 0x0e, 0xd1, 0x04, 0x26, 0x02, 0x00,
  0x00, 0xab, 0x11, 0xeb, 0x09, 0x0e, 0xd1, 0x04,
- 0xdb, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x07, 0xdd,
- 0xee, 0x0e, 0xed, 0x8d, 0x03, 0xd1, 0x04, 0x24,
+ 0xde, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x07, 0xdd,
+ 0xee, 0x0e, 0xed, 0x8d, 0x03, 0xd1, 0x04, 0x27,
  0x02, 0x00, 0x00, 0xab, 0xea, 0x4b, 0xd2, 0x42,
- 0x68, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6, 0x9d,
- 0x24, 0x01, 0x00, 0x42, 0x25, 0x02, 0x00, 0x00,
- 0x24, 0x00, 0x00, 0xd0, 0x42, 0x26, 0x02, 0x00,
- 0x00, 0x04, 0xe4, 0x01, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0xc8, 0x42, 0x26, 0x02, 0x00, 0x00, 0x04,
- 0xe9, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xa4,
- 0xea, 0x08, 0x04, 0x27, 0x02, 0x00, 0x00, 0x94,
- 0x03, 0x65, 0x01, 0x00, 0x42, 0x28, 0x02, 0x00,
+ 0x6b, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6, 0x9d,
+ 0x24, 0x01, 0x00, 0x42, 0x28, 0x02, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xd0, 0x42, 0x29, 0x02, 0x00,
+ 0x00, 0x04, 0xe7, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xc8, 0x42, 0x29, 0x02, 0x00, 0x00, 0x04,
+ 0xec, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xa4,
+ 0xea, 0x08, 0x04, 0x2a, 0x02, 0x00, 0x00, 0x94,
+ 0x03, 0x65, 0x01, 0x00, 0x42, 0x2b, 0x02, 0x00,
  0x00, 0xc8, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28,
- 0xd1, 0x04, 0x29, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0xd1, 0x04, 0x2c, 0x02, 0x00, 0x00, 0xab, 0xea,
  0x06, 0x0a, 0xe3, 0xed, 0x2c, 0x03, 0xd1, 0x04,
- 0x2a, 0x02, 0x00, 0x00, 0xab, 0xea, 0x06, 0x09,
- 0xe3, 0xed, 0x1e, 0x03, 0xd1, 0x04, 0x2b, 0x02,
+ 0x2d, 0x02, 0x00, 0x00, 0xab, 0xea, 0x06, 0x09,
+ 0xe3, 0xed, 0x1e, 0x03, 0xd1, 0x04, 0x2e, 0x02,
  0x00, 0x00, 0xab, 0xea, 0x07, 0xe0, 0x96, 0xe4,
  0xed, 0x0f, 0x03, 0x5e, 0x04, 0x00, 0x69, 0x96,
- 0x01, 0x00, 0x00, 0xd1, 0x04, 0x05, 0x02, 0x00,
+ 0x01, 0x00, 0x00, 0xd1, 0x04, 0x08, 0x02, 0x00,
  0x00, 0xab, 0x69, 0x8a, 0x01, 0x00, 0x00, 0xd2,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6,
- 0x9d, 0x24, 0x01, 0x00, 0x42, 0x25, 0x02, 0x00,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6,
+ 0x9d, 0x24, 0x01, 0x00, 0x42, 0x28, 0x02, 0x00,
  0x00, 0x24, 0x00, 0x00, 0x42, 0x60, 0x00, 0x00,
- 0x00, 0x04, 0xf8, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x04, 0xfb, 0x01, 0x00, 0x00, 0x24, 0x01,
  0x00, 0xcd, 0xe9, 0xb6, 0xab, 0xea, 0x49, 0xc5,
  0xb5, 0x47, 0xc1, 0xab, 0xea, 0x42, 0x65, 0x01,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x2c,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x2f,
  0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9d, 0x04,
- 0x2d, 0x02, 0x00, 0x00, 0x9d, 0x5e, 0x06, 0x00,
- 0x42, 0xf5, 0x01, 0x00, 0x00, 0x5e, 0x05, 0x00,
+ 0x30, 0x02, 0x00, 0x00, 0x9d, 0x5e, 0x06, 0x00,
+ 0x42, 0xf8, 0x01, 0x00, 0x00, 0x5e, 0x05, 0x00,
  0x5e, 0x07, 0x00, 0x9b, 0x24, 0x01, 0x00, 0x9d,
- 0x04, 0x2e, 0x02, 0x00, 0x00, 0x9d, 0x5e, 0x08,
- 0x00, 0x9d, 0x04, 0x2f, 0x02, 0x00, 0x00, 0x9d,
+ 0x04, 0x31, 0x02, 0x00, 0x00, 0x9d, 0x5e, 0x08,
+ 0x00, 0x9d, 0x04, 0x32, 0x02, 0x00, 0x00, 0x9d,
  0x24, 0x01, 0x00, 0x0e, 0xed, 0x16, 0x01, 0xc5,
- 0xb5, 0x47, 0x04, 0x30, 0x02, 0x00, 0x00, 0xab,
+ 0xb5, 0x47, 0x04, 0x33, 0x02, 0x00, 0x00, 0xab,
  0xea, 0x0d, 0xbd, 0x0b, 0x5f, 0x05, 0x00, 0xba,
  0x5f, 0x08, 0x00, 0xed, 0xff, 0x00, 0xc5, 0xb5,
- 0x47, 0x04, 0x31, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x47, 0x04, 0x34, 0x02, 0x00, 0x00, 0xab, 0xea,
  0x0e, 0xbd, 0x18, 0x5f, 0x05, 0x00, 0xbd, 0x08,
  0x5f, 0x08, 0x00, 0xed, 0xe7, 0x00, 0xc5, 0xb5,
- 0x47, 0x04, 0x32, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x47, 0x04, 0x35, 0x02, 0x00, 0x00, 0xab, 0xea,
  0x0e, 0xbd, 0x35, 0x5f, 0x05, 0x00, 0xbd, 0x0b,
  0x5f, 0x08, 0x00, 0xed, 0xcf, 0x00, 0xc5, 0xb5,
- 0x47, 0x04, 0x33, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x47, 0x04, 0x36, 0x02, 0x00, 0x00, 0xab, 0xea,
  0x0e, 0xbd, 0x71, 0x5f, 0x05, 0x00, 0xbd, 0x0f,
- 0x5f, 0x08, 0x00, 0xed, 0xb7, 0x00, 0x38, 0x34,
+ 0x5f, 0x08, 0x00, 0xed, 0xb7, 0x00, 0x38, 0x37,
  0x02, 0x00, 0x00, 0xc5, 0xb5, 0x47, 0xef, 0xca,
- 0xc5, 0xe9, 0xb7, 0xa6, 0xea, 0x0d, 0x38, 0x34,
+ 0xc5, 0xe9, 0xb7, 0xa6, 0xea, 0x0d, 0x38, 0x37,
  0x02, 0x00, 0x00, 0xc5, 0xb6, 0x47, 0xef, 0xcb,
- 0xec, 0x0c, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41,
- 0x35, 0x02, 0x00, 0x00, 0xcb, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0x42, 0xeb, 0x01, 0x00, 0x00, 0xc6,
+ 0xec, 0x0c, 0x38, 0xb7, 0x00, 0x00, 0x00, 0x41,
+ 0x38, 0x02, 0x00, 0x00, 0xcb, 0x38, 0x9b, 0x00,
+ 0x00, 0x00, 0x42, 0xee, 0x01, 0x00, 0x00, 0xc6,
  0x24, 0x01, 0x00, 0x11, 0xeb, 0x1e, 0x0e, 0xc6,
- 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41, 0x36, 0x02,
+ 0x38, 0xb7, 0x00, 0x00, 0x00, 0x41, 0x39, 0x02,
  0x00, 0x00, 0xa3, 0x11, 0xeb, 0x0e, 0x0e, 0xc6,
- 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41, 0x37, 0x02,
+ 0x38, 0xb7, 0x00, 0x00, 0x00, 0x41, 0x3a, 0x02,
  0x00, 0x00, 0xa5, 0xea, 0x14, 0x65, 0x01, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x38, 0x02,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x3b, 0x02,
  0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28,
- 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xeb, 0x01,
+ 0x38, 0x9b, 0x00, 0x00, 0x00, 0x42, 0xee, 0x01,
  0x00, 0x00, 0xc7, 0x24, 0x01, 0x00, 0x11, 0xeb,
- 0x1e, 0x0e, 0xc7, 0x38, 0xb4, 0x00, 0x00, 0x00,
- 0x41, 0x39, 0x02, 0x00, 0x00, 0xa3, 0x11, 0xeb,
- 0x0e, 0x0e, 0xc7, 0x38, 0xb4, 0x00, 0x00, 0x00,
- 0x41, 0x35, 0x02, 0x00, 0x00, 0xa5, 0xea, 0x14,
- 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x3a, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x1e, 0x0e, 0xc7, 0x38, 0xb7, 0x00, 0x00, 0x00,
+ 0x41, 0x3c, 0x02, 0x00, 0x00, 0xa3, 0x11, 0xeb,
+ 0x0e, 0x0e, 0xc7, 0x38, 0xb7, 0x00, 0x00, 0x00,
+ 0x41, 0x38, 0x02, 0x00, 0x00, 0xa5, 0xea, 0x14,
+ 0x65, 0x01, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x3d, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0x09, 0x28, 0xc6, 0x5f, 0x05, 0x00, 0xc7,
  0x5f, 0x08, 0x00, 0x09, 0x28, 0x5e, 0x04, 0x00,
- 0xea, 0x78, 0xd1, 0x04, 0x3b, 0x02, 0x00, 0x00,
- 0xab, 0xea, 0x6f, 0xd2, 0x42, 0x68, 0x01, 0x00,
+ 0xea, 0x78, 0xd1, 0x04, 0x3e, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x6f, 0xd2, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0xd1, 0xe9, 0xb6, 0x9d, 0x24, 0x01, 0x00,
- 0x42, 0x25, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xc9, 0x5e, 0x06, 0x00, 0x42, 0xf6, 0x01, 0x00,
+ 0x42, 0x28, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xc9, 0x5e, 0x06, 0x00, 0x42, 0xf9, 0x01, 0x00,
  0x00, 0x5e, 0x09, 0x00, 0xc5, 0xef, 0x5e, 0x07,
- 0x00, 0x9a, 0x24, 0x01, 0x00, 0xce, 0x38, 0xb4,
- 0x00, 0x00, 0x00, 0x41, 0x36, 0x02, 0x00, 0x00,
- 0xa3, 0x11, 0xeb, 0x0e, 0x0e, 0xc6, 0x38, 0xb4,
- 0x00, 0x00, 0x00, 0x41, 0x37, 0x02, 0x00, 0x00,
- 0xa5, 0xea, 0x14, 0x65, 0x01, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0x04, 0x38, 0x02, 0x00, 0x00,
+ 0x00, 0x9a, 0x24, 0x01, 0x00, 0xce, 0x38, 0xb7,
+ 0x00, 0x00, 0x00, 0x41, 0x39, 0x02, 0x00, 0x00,
+ 0xa3, 0x11, 0xeb, 0x0e, 0x0e, 0xc6, 0x38, 0xb7,
+ 0x00, 0x00, 0x00, 0x41, 0x3a, 0x02, 0x00, 0x00,
+ 0xa5, 0xea, 0x14, 0x65, 0x01, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0x04, 0x3b, 0x02, 0x00, 0x00,
  0x24, 0x01, 0x00, 0x0e, 0x09, 0x28, 0xc6, 0x5f,
- 0x05, 0x00, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41,
- 0x35, 0x02, 0x00, 0x00, 0x5f, 0x08, 0x00, 0x09,
+ 0x05, 0x00, 0x38, 0xb7, 0x00, 0x00, 0x00, 0x41,
+ 0x38, 0x02, 0x00, 0x00, 0x5f, 0x08, 0x00, 0x09,
  0x28, 0x5e, 0x04, 0x00, 0xea, 0x6e, 0xd1, 0x04,
- 0x3c, 0x02, 0x00, 0x00, 0xab, 0xea, 0x65, 0xd2,
- 0x42, 0x68, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6,
- 0x9d, 0x24, 0x01, 0x00, 0x42, 0x25, 0x02, 0x00,
+ 0x3f, 0x02, 0x00, 0x00, 0xab, 0xea, 0x65, 0xd2,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0xd1, 0xe9, 0xb6,
+ 0x9d, 0x24, 0x01, 0x00, 0x42, 0x28, 0x02, 0x00,
  0x00, 0x24, 0x00, 0x00, 0xcd, 0xc1, 0xab, 0xea,
- 0x1e, 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00,
- 0x00, 0x04, 0x3d, 0x02, 0x00, 0x00, 0x5e, 0x0a,
- 0x00, 0x9d, 0x04, 0x20, 0x01, 0x00, 0x00, 0x9d,
+ 0x1e, 0x65, 0x01, 0x00, 0x42, 0x6a, 0x01, 0x00,
+ 0x00, 0x04, 0x40, 0x02, 0x00, 0x00, 0x5e, 0x0a,
+ 0x00, 0x9d, 0x04, 0x23, 0x01, 0x00, 0x00, 0x9d,
  0x24, 0x01, 0x00, 0x0e, 0xec, 0x2c, 0xc5, 0x04,
- 0xe3, 0x00, 0x00, 0x00, 0xab, 0x11, 0xeb, 0x09,
- 0x0e, 0xc5, 0x04, 0x02, 0x02, 0x00, 0x00, 0xab,
+ 0xe6, 0x00, 0x00, 0x00, 0xab, 0x11, 0xeb, 0x09,
+ 0x0e, 0xc5, 0x04, 0x05, 0x02, 0x00, 0x00, 0xab,
  0xea, 0x07, 0xc5, 0x5f, 0x0a, 0x00, 0xec, 0x12,
- 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x3e, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
- 0x0e, 0x09, 0x28, 0xd1, 0x04, 0x3f, 0x02, 0x00,
+ 0x65, 0x01, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x41, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x09, 0x28, 0xd1, 0x04, 0x42, 0x02, 0x00,
  0x00, 0xab, 0xea, 0x14, 0x65, 0x01, 0x00, 0x42,
- 0x67, 0x01, 0x00, 0x00, 0x04, 0x40, 0x02, 0x00,
+ 0x6a, 0x01, 0x00, 0x00, 0x04, 0x43, 0x02, 0x00,
  0x00, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x6a, 0xd1,
- 0x04, 0x41, 0x02, 0x00, 0x00, 0xab, 0xea, 0x10,
- 0x65, 0x01, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0x04, 0x44, 0x02, 0x00, 0x00, 0xab, 0xea, 0x10,
+ 0x65, 0x01, 0x00, 0x42, 0xa5, 0x01, 0x00, 0x00,
  0xb5, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x52, 0x5e,
- 0x0b, 0x00, 0xea, 0x17, 0xd1, 0x04, 0x58, 0x01,
- 0x00, 0x00, 0xab, 0xea, 0x0e, 0x36, 0x42, 0x02,
- 0x00, 0x00, 0x0a, 0x3b, 0x42, 0x02, 0x00, 0x00,
+ 0x0b, 0x00, 0xea, 0x17, 0xd1, 0x04, 0x5b, 0x01,
+ 0x00, 0x00, 0xab, 0xea, 0x0e, 0x36, 0x45, 0x02,
+ 0x00, 0x00, 0x0a, 0x3b, 0x45, 0x02, 0x00, 0x00,
  0xec, 0x37, 0x5e, 0x0b, 0x00, 0xea, 0x17, 0xd1,
- 0x04, 0x08, 0x02, 0x00, 0x00, 0xab, 0xea, 0x0e,
- 0x36, 0x42, 0x02, 0x00, 0x00, 0x09, 0x3b, 0x42,
+ 0x04, 0x0b, 0x02, 0x00, 0x00, 0xab, 0xea, 0x0e,
+ 0x36, 0x45, 0x02, 0x00, 0x00, 0x09, 0x3b, 0x45,
  0x02, 0x00, 0x00, 0xec, 0x1c, 0x65, 0x01, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x43, 0x02,
- 0x00, 0x00, 0xd1, 0x9d, 0x04, 0x20, 0x01, 0x00,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x46, 0x02,
+ 0x00, 0x00, 0xd1, 0x9d, 0x04, 0x23, 0x01, 0x00,
  0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28,
- 0x0a, 0x28, 0x0e, 0x43, 0x02, 0x03, 0x00, 0x01,
+ 0x0a, 0x28, 0x0e, 0x43, 0x22, 0x03, 0x00, 0x01,
  0x00, 0x01, 0x03, 0x01, 0x00, 0x46, 0x00, 0x00,
- 0x68, 0x01, 0xd1, 0x11, 0x04, 0x44, 0x02, 0x00,
+ 0x68, 0x01, 0xd1, 0x11, 0x04, 0x47, 0x02, 0x00,
  0x00, 0xab, 0xea, 0x05, 0x09, 0xe1, 0xec, 0x38,
- 0x11, 0x04, 0x45, 0x02, 0x00, 0x00, 0xab, 0xea,
- 0x05, 0x0a, 0xe1, 0xec, 0x2b, 0x11, 0x04, 0x46,
- 0x02, 0x00, 0x00, 0xab, 0xea, 0x0e, 0x36, 0x42,
- 0x02, 0x00, 0x00, 0x09, 0x3b, 0x42, 0x02, 0x00,
- 0x00, 0xec, 0x15, 0x11, 0x04, 0x47, 0x02, 0x00,
- 0x00, 0xab, 0xea, 0x0c, 0x36, 0x42, 0x02, 0x00,
- 0x00, 0x0a, 0x3b, 0x42, 0x02, 0x00, 0x00, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xb6, 0x07, 0x00, 0x01,
+ 0x11, 0x04, 0x48, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x05, 0x0a, 0xe1, 0xec, 0x2b, 0x11, 0x04, 0x49,
+ 0x02, 0x00, 0x00, 0xab, 0xea, 0x0e, 0x36, 0x45,
+ 0x02, 0x00, 0x00, 0x09, 0x3b, 0x45, 0x02, 0x00,
+ 0x00, 0xec, 0x15, 0x11, 0x04, 0x4a, 0x02, 0x00,
+ 0x00, 0xab, 0xea, 0x0c, 0x36, 0x45, 0x02, 0x00,
+ 0x00, 0x0a, 0x3b, 0x45, 0x02, 0x00, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xbc, 0x07, 0x00, 0x01,
  0x00, 0x05, 0x07, 0x01, 0xd5, 0x01, 0x00, 0x00,
  0x00, 0x0c, 0x00, 0x68, 0x01, 0x00, 0x17, 0x01,
  0x00, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00, 0x69,
  0x01, 0x00, 0x07, 0x01, 0xc0, 0x00, 0xc9, 0x65,
- 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
- 0x48, 0x02, 0x00, 0x00, 0x04, 0x49, 0x02, 0x00,
- 0x00, 0x9d, 0xc5, 0xde, 0xef, 0x9d, 0x04, 0x4a,
- 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4b, 0x02, 0x00,
+ 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04,
+ 0x4b, 0x02, 0x00, 0x00, 0x04, 0x4c, 0x02, 0x00,
+ 0x00, 0x9d, 0xc5, 0xde, 0xef, 0x9d, 0x04, 0x4d,
+ 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4e, 0x02, 0x00,
  0x00, 0x9d, 0xc5, 0xde, 0x96, 0xef, 0x9d, 0x04,
- 0x4c, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4d, 0x02,
+ 0x4f, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x50, 0x02,
  0x00, 0x00, 0x9d, 0xc5, 0xdf, 0xef, 0x9d, 0x04,
- 0x4e, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4f, 0x02,
- 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0xe0,
- 0xea, 0x35, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
- 0x00, 0x00, 0x04, 0x50, 0x02, 0x00, 0x00, 0xc5,
- 0x38, 0x42, 0x02, 0x00, 0x00, 0xef, 0x9d, 0x04,
  0x51, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x52, 0x02,
- 0x00, 0x00, 0x9d, 0xc5, 0x38, 0x42, 0x02, 0x00,
- 0x00, 0x96, 0xef, 0x9d, 0x04, 0x53, 0x02, 0x00,
+ 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0xe0,
+ 0xea, 0x35, 0x65, 0x00, 0x00, 0x42, 0x6a, 0x01,
+ 0x00, 0x00, 0x04, 0x53, 0x02, 0x00, 0x00, 0xc5,
+ 0x38, 0x45, 0x02, 0x00, 0x00, 0xef, 0x9d, 0x04,
+ 0x54, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x55, 0x02,
+ 0x00, 0x00, 0x9d, 0xc5, 0x38, 0x45, 0x02, 0x00,
+ 0x00, 0x96, 0xef, 0x9d, 0x04, 0x56, 0x02, 0x00,
  0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x04,
- 0x00, 0xea, 0x37, 0x65, 0x00, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0x04, 0x54, 0x02, 0x00, 0x00,
- 0x04, 0x55, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01,
+ 0x00, 0xea, 0x37, 0x65, 0x00, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0x04, 0x57, 0x02, 0x00, 0x00,
+ 0x04, 0x58, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01,
  0x00, 0x0e, 0xe0, 0x96, 0xea, 0x1c, 0x65, 0x00,
- 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x56,
+ 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x59,
  0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9d, 0x04,
- 0x57, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
+ 0x5a, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
  0x0e, 0x5e, 0x06, 0x00, 0x96, 0xea, 0x12, 0x65,
- 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
- 0x58, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x09, 0x01,
+ 0x00, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04,
+ 0x5b, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x09, 0x01,
  0x00, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x00, 0xd1,
  0xea, 0x07, 0x04, 0x80, 0x00, 0x00, 0x00, 0x28,
- 0x04, 0xf8, 0x01, 0x00, 0x00, 0x28, 0x0e, 0x43,
- 0x02, 0x03, 0xb8, 0x07, 0x01, 0x03, 0x01, 0x06,
+ 0x04, 0xfb, 0x01, 0x00, 0x00, 0x28, 0x0e, 0x43,
+ 0x02, 0x03, 0xbe, 0x07, 0x01, 0x03, 0x01, 0x06,
  0x08, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x69, 0x01,
  0x00, 0x03, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x19,
  0x01, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0x00,
  0x6d, 0x01, 0x00, 0x00, 0x03, 0x6c, 0x95, 0x00,
- 0x00, 0x00, 0xdd, 0x04, 0x02, 0x02, 0x00, 0x00,
- 0xab, 0xea, 0x09, 0x04, 0x5a, 0x02, 0x00, 0x00,
+ 0x00, 0x00, 0xdd, 0x04, 0x05, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x09, 0x04, 0x5d, 0x02, 0x00, 0x00,
  0xd1, 0x9d, 0xd5, 0xde, 0x11, 0x21, 0x00, 0x00,
- 0x42, 0x5b, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00,
- 0xca, 0x65, 0x02, 0x00, 0x42, 0x5c, 0x02, 0x00,
- 0x00, 0xd1, 0x0b, 0x0a, 0x4c, 0x5d, 0x02, 0x00,
+ 0x42, 0x5e, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xca, 0x65, 0x02, 0x00, 0x42, 0x5f, 0x02, 0x00,
+ 0x00, 0xd1, 0x0b, 0x0a, 0x4c, 0x60, 0x02, 0x00,
  0x00, 0x24, 0x02, 0x00, 0xc9, 0xde, 0x11, 0x21,
- 0x00, 0x00, 0x42, 0x5b, 0x02, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x42, 0x5e, 0x02, 0x00, 0x00, 0x24,
  0x00, 0x00, 0xc6, 0x9e, 0xe4, 0x65, 0x02, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00,
- 0x5e, 0x05, 0x00, 0x41, 0x12, 0x01, 0x00, 0x00,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00,
+ 0x5e, 0x05, 0x00, 0x41, 0x15, 0x01, 0x00, 0x00,
  0x47, 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x06, 0x00,
- 0xc5, 0xef, 0x0e, 0x65, 0x02, 0x00, 0x42, 0x67,
- 0x01, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00,
+ 0xc5, 0xef, 0x0e, 0x65, 0x02, 0x00, 0x42, 0x6a,
+ 0x01, 0x00, 0x00, 0x04, 0x23, 0x01, 0x00, 0x00,
  0x24, 0x01, 0x00, 0x0e, 0x65, 0x02, 0x00, 0x42,
- 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x41,
- 0xea, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
- 0x5e, 0x07, 0x00, 0xc5, 0x43, 0x5c, 0x01, 0x00,
+ 0x6a, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x41,
+ 0xed, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x5e, 0x07, 0x00, 0xc5, 0x43, 0x5f, 0x01, 0x00,
  0x00, 0x0e, 0x29, 0xcb, 0x6c, 0x86, 0x00, 0x00,
- 0x00, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x65, 0x02, 0x00, 0x42, 0x6a, 0x01, 0x00,
  0x00, 0x5e, 0x04, 0x00, 0x5e, 0x05, 0x00, 0x41,
- 0x13, 0x01, 0x00, 0x00, 0x47, 0x24, 0x01, 0x00,
- 0x0e, 0xc7, 0x38, 0x97, 0x00, 0x00, 0x00, 0xa7,
- 0xea, 0x2c, 0x38, 0x5e, 0x02, 0x00, 0x00, 0x42,
- 0x5f, 0x02, 0x00, 0x00, 0xc7, 0x24, 0x01, 0x00,
+ 0x16, 0x01, 0x00, 0x00, 0x47, 0x24, 0x01, 0x00,
+ 0x0e, 0xc7, 0x38, 0x9a, 0x00, 0x00, 0x00, 0xa7,
+ 0xea, 0x2c, 0x38, 0x61, 0x02, 0x00, 0x00, 0x42,
+ 0x62, 0x02, 0x00, 0x00, 0xc7, 0x24, 0x01, 0x00,
  0x0e, 0xc7, 0x41, 0x38, 0x00, 0x00, 0x00, 0xea,
- 0x35, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x35, 0x65, 0x02, 0x00, 0x42, 0x6a, 0x01, 0x00,
  0x00, 0xc7, 0x41, 0x38, 0x00, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xec, 0x21, 0x65, 0x02, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x60, 0x02,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x5e,
- 0x02, 0x00, 0x00, 0x42, 0x5f, 0x02, 0x00, 0x00,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x63, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x61,
+ 0x02, 0x00, 0x00, 0x42, 0x62, 0x02, 0x00, 0x00,
  0xc7, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x02, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00,
- 0x41, 0xea, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00,
+ 0x41, 0xed, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0x0e, 0x29, 0x2f, 0x0e, 0x43, 0x02, 0x03,
- 0xba, 0x07, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00,
- 0x6e, 0x00, 0xda, 0x06, 0x07, 0x01, 0xdc, 0x06,
- 0x08, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xde, 0x06,
- 0x09, 0x01, 0xe8, 0x06, 0x10, 0x01, 0xba, 0x02,
- 0x04, 0x01, 0xe4, 0x06, 0x0e, 0x01, 0xe6, 0x06,
- 0x0f, 0x01, 0xa8, 0x07, 0x69, 0x01, 0xd8, 0x06,
- 0x00, 0x03, 0xbc, 0x07, 0x73, 0x01, 0xdd, 0x96,
+ 0xc0, 0x07, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00,
+ 0x6e, 0x00, 0xe0, 0x06, 0x07, 0x01, 0xe2, 0x06,
+ 0x08, 0x01, 0xcc, 0x03, 0x00, 0x0c, 0xe4, 0x06,
+ 0x09, 0x01, 0xee, 0x06, 0x10, 0x01, 0xc0, 0x02,
+ 0x04, 0x01, 0xea, 0x06, 0x0e, 0x01, 0xec, 0x06,
+ 0x0f, 0x01, 0xae, 0x07, 0x69, 0x01, 0xde, 0x06,
+ 0x00, 0x03, 0xc2, 0x07, 0x73, 0x01, 0xdd, 0x96,
  0xea, 0x28, 0xde, 0xea, 0x14, 0x65, 0x02, 0x00,
- 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x61, 0x02,
+ 0x42, 0x6a, 0x01, 0x00, 0x00, 0x04, 0x64, 0x02,
  0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x12,
- 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
- 0x04, 0x62, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x65, 0x02, 0x00, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x04, 0x65, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
  0x0e, 0xe0, 0xea, 0x3c, 0x5e, 0x05, 0x00, 0x42,
- 0x5f, 0x02, 0x00, 0x00, 0xbd, 0x0a, 0x24, 0x01,
- 0x00, 0x5e, 0x05, 0x00, 0x42, 0x5f, 0x02, 0x00,
+ 0x62, 0x02, 0x00, 0x00, 0xbd, 0x0a, 0x24, 0x01,
+ 0x00, 0x5e, 0x05, 0x00, 0x42, 0x62, 0x02, 0x00,
  0x00, 0xb7, 0x24, 0x01, 0x00, 0x9b, 0x5f, 0x04,
  0x00, 0xbd, 0x71, 0x5f, 0x06, 0x00, 0xbd, 0x0f,
- 0x5f, 0x07, 0x00, 0xde, 0xea, 0x12, 0x04, 0x02,
+ 0x5f, 0x07, 0x00, 0xde, 0xea, 0x12, 0x04, 0x05,
  0x02, 0x00, 0x00, 0x5f, 0x08, 0x00, 0x5e, 0x09,
- 0x00, 0xdd, 0x43, 0x42, 0x02, 0x00, 0x00, 0x5e,
+ 0x00, 0xdd, 0x43, 0x45, 0x02, 0x00, 0x00, 0x5e,
  0x0a, 0x00, 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xbc, 0x07, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00,
- 0x0c, 0x00, 0xa0, 0x07, 0x65, 0x01, 0x98, 0x07,
- 0x60, 0x01, 0xfe, 0x06, 0x1b, 0x01, 0xbe, 0x07,
- 0x74, 0x01, 0xdd, 0xde, 0x04, 0x63, 0x02, 0x00,
+ 0xc2, 0x07, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00,
+ 0x0c, 0x00, 0xa6, 0x07, 0x65, 0x01, 0x9e, 0x07,
+ 0x60, 0x01, 0x84, 0x07, 0x1b, 0x01, 0xc4, 0x07,
+ 0x74, 0x01, 0xdd, 0xde, 0x04, 0x66, 0x02, 0x00,
  0x00, 0xdf, 0xf0, 0xe0, 0xf0, 0x29, 0x0e, 0x43,
- 0x02, 0x03, 0xbe, 0x07, 0x01, 0x00, 0x01, 0x02,
+ 0x02, 0x03, 0xc4, 0x07, 0x01, 0x00, 0x01, 0x02,
  0x02, 0x00, 0x07, 0x00, 0x00, 0x75, 0x01, 0x00,
  0x73, 0x01, 0xdd, 0xd1, 0xef, 0x0e, 0xde, 0xee,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x07, 0x01,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc6, 0x07, 0x01,
  0x02, 0x01, 0x06, 0x0c, 0x00, 0x9e, 0x01, 0x00,
  0x00, 0x70, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x6f,
  0x01, 0x00, 0x1a, 0x01, 0x00, 0x76, 0x01, 0x00,
  0x11, 0x01, 0x00, 0x1b, 0x01, 0x00, 0x09, 0x01,
  0x00, 0x71, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x0f,
  0x01, 0x00, 0x00, 0x0c, 0xd1, 0xf3, 0xea, 0x04,
- 0xc1, 0xd5, 0x29, 0xd1, 0x04, 0x23, 0x02, 0x00,
+ 0xc1, 0xd5, 0x29, 0xd1, 0x04, 0x26, 0x02, 0x00,
  0x00, 0xab, 0xea, 0x04, 0xdd, 0xee, 0x29, 0xde,
  0xd1, 0xef, 0xce, 0xe9, 0xb5, 0xa5, 0xea, 0x17,
  0xdf, 0xc6, 0xd1, 0xf0, 0x96, 0xea, 0x02, 0x29,
- 0xd1, 0x42, 0x68, 0x01, 0x00, 0x00, 0xc6, 0xe9,
+ 0xd1, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xc6, 0xe9,
  0xb6, 0x9d, 0x24, 0x01, 0x00, 0xd5, 0xd1, 0xc1,
  0xab, 0xea, 0x02, 0x29, 0xe0, 0xea, 0x0b, 0xe0,
- 0x04, 0x20, 0x01, 0x00, 0x00, 0x9d, 0xd1, 0x9d,
+ 0x04, 0x23, 0x01, 0x00, 0x00, 0x9d, 0xd1, 0x9d,
  0xd5, 0x5e, 0x04, 0x00, 0xd1, 0xef, 0xcd, 0xb5,
  0x47, 0x5f, 0x05, 0x00, 0xc5, 0xb6, 0x47, 0x5f,
  0x06, 0x00, 0x5e, 0x05, 0x00, 0xea, 0x04, 0xd1,
  0xe4, 0x29, 0xc1, 0xe4, 0x5e, 0x07, 0x00, 0xea,
- 0x24, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x42, 0x64,
- 0x02, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x42, 0x65,
+ 0x24, 0x38, 0xb7, 0x00, 0x00, 0x00, 0x42, 0x67,
+ 0x02, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x42, 0x68,
  0x02, 0x00, 0x00, 0x07, 0xd1, 0x24, 0x02, 0x00,
  0x5e, 0x09, 0x00, 0x5e, 0x0a, 0x00, 0x24, 0x03,
  0x00, 0x0e, 0xec, 0x07, 0x5e, 0x08, 0x00, 0xd1,
  0xef, 0x0e, 0xb5, 0x5f, 0x06, 0x00, 0x65, 0x0b,
- 0x00, 0x42, 0x66, 0x02, 0x00, 0x00, 0x24, 0x00,
- 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc2, 0x07,
+ 0x00, 0x42, 0x69, 0x02, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc8, 0x07,
  0x01, 0x17, 0x01, 0x04, 0x03, 0x0a, 0x8f, 0x04,
  0x00, 0x00, 0x30, 0x01, 0x00, 0x33, 0x01, 0x00,
  0x2f, 0x01, 0xc0, 0x00, 0xc3, 0x0a, 0xc0, 0x01,
@@ -1831,156 +1831,156 @@ const uint8_t qjsc_repl[16089] = {
  0xc3, 0x11, 0xc0, 0x08, 0xc3, 0x15, 0xc0, 0x09,
  0xc3, 0x16, 0xd1, 0xe9, 0xcc, 0xc1, 0xc3, 0x05,
  0xb5, 0xc3, 0x06, 0xb6, 0xc3, 0x08, 0x26, 0x00,
- 0x00, 0xc3, 0x09, 0x04, 0x67, 0x02, 0x00, 0x00,
- 0x04, 0x68, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x69,
- 0x02, 0x00, 0x00, 0x9d, 0x04, 0x6a, 0x02, 0x00,
- 0x00, 0x9d, 0x04, 0x6b, 0x02, 0x00, 0x00, 0x9d,
- 0x04, 0x6c, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x6d,
- 0x02, 0x00, 0x00, 0x9d, 0x04, 0x6e, 0x02, 0x00,
- 0x00, 0x9d, 0x04, 0x6f, 0x02, 0x00, 0x00, 0x9d,
- 0x04, 0x70, 0x02, 0x00, 0x00, 0x9d, 0xc3, 0x12,
- 0x04, 0x71, 0x02, 0x00, 0x00, 0xc3, 0x13, 0x04,
- 0x72, 0x02, 0x00, 0x00, 0xc3, 0x14, 0xb5, 0xc9,
+ 0x00, 0xc3, 0x09, 0x04, 0x6a, 0x02, 0x00, 0x00,
+ 0x04, 0x6b, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x6c,
+ 0x02, 0x00, 0x00, 0x9d, 0x04, 0x6d, 0x02, 0x00,
+ 0x00, 0x9d, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x9d,
+ 0x04, 0x6f, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x70,
+ 0x02, 0x00, 0x00, 0x9d, 0x04, 0x71, 0x02, 0x00,
+ 0x00, 0x9d, 0x04, 0x72, 0x02, 0x00, 0x00, 0x9d,
+ 0x04, 0x73, 0x02, 0x00, 0x00, 0x9d, 0xc3, 0x12,
+ 0x04, 0x74, 0x02, 0x00, 0x00, 0xc3, 0x13, 0x04,
+ 0x75, 0x02, 0x00, 0x00, 0xc3, 0x14, 0xb5, 0xc9,
  0xc5, 0xc8, 0xa3, 0x69, 0x75, 0x01, 0x00, 0x00,
  0x07, 0xc3, 0x04, 0xc5, 0xcb, 0xd1, 0xc5, 0x91,
- 0xc9, 0x47, 0xce, 0x11, 0x04, 0xf8, 0x01, 0x00,
- 0x00, 0xab, 0xeb, 0x1c, 0x11, 0x04, 0x1f, 0x01,
- 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04, 0x22,
+ 0xc9, 0x47, 0xce, 0x11, 0x04, 0xfb, 0x01, 0x00,
+ 0x00, 0xab, 0xeb, 0x1c, 0x11, 0x04, 0x22, 0x01,
+ 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04, 0x25,
  0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11, 0x04,
- 0x20, 0x01, 0x00, 0x00, 0xab, 0xea, 0x04, 0x0e,
- 0xec, 0xc7, 0x11, 0x04, 0x73, 0x02, 0x00, 0x00,
- 0xab, 0xeb, 0x0a, 0x11, 0x04, 0x00, 0x02, 0x00,
+ 0x23, 0x01, 0x00, 0x00, 0xab, 0xea, 0x04, 0x0e,
+ 0xec, 0xc7, 0x11, 0x04, 0x76, 0x02, 0x00, 0x00,
+ 0xab, 0xeb, 0x0a, 0x11, 0x04, 0x03, 0x02, 0x00,
  0x00, 0xab, 0xea, 0x18, 0xc5, 0xc8, 0xa3, 0xea,
  0x0d, 0xd1, 0xc5, 0x47, 0xc6, 0xa9, 0xea, 0x06,
  0x93, 0x00, 0x0e, 0xec, 0xa4, 0xb6, 0xc3, 0x08,
- 0x0e, 0xec, 0x9e, 0x11, 0x04, 0xe9, 0x01, 0x00,
+ 0x0e, 0xec, 0x9e, 0x11, 0x04, 0xec, 0x01, 0x00,
  0x00, 0xab, 0xea, 0x44, 0xc5, 0xc8, 0xa3, 0xea,
  0x13, 0xd1, 0xc5, 0x47, 0x04, 0x80, 0x00, 0x00,
  0x00, 0xa9, 0xea, 0x08, 0xc2, 0x0d, 0xee, 0x0e,
  0xed, 0xe7, 0x00, 0xc5, 0xc8, 0xa3, 0xea, 0x13,
- 0xd1, 0xc5, 0x47, 0x04, 0xe9, 0x01, 0x00, 0x00,
+ 0xd1, 0xc5, 0x47, 0x04, 0xec, 0x01, 0x00, 0x00,
  0xa9, 0xea, 0x08, 0xc2, 0x0e, 0xee, 0x0e, 0xed,
  0xd0, 0x00, 0xc2, 0x08, 0xea, 0x0b, 0xc2, 0x10,
  0xee, 0x0e, 0xb5, 0xc3, 0x08, 0xed, 0xc2, 0x00,
  0xb6, 0xc3, 0x08, 0x0e, 0xed, 0x53, 0xff, 0x11,
- 0x04, 0xe5, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13,
- 0x11, 0x04, 0xe6, 0x01, 0x00, 0x00, 0xab, 0xeb,
- 0x0a, 0x11, 0x04, 0x74, 0x02, 0x00, 0x00, 0xab,
+ 0x04, 0xe8, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13,
+ 0x11, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xab, 0xeb,
+ 0x0a, 0x11, 0x04, 0x77, 0x02, 0x00, 0x00, 0xab,
  0xea, 0x0c, 0xc2, 0x0f, 0xc6, 0xef, 0x0e, 0xb5,
- 0xc3, 0x08, 0xed, 0x95, 0x00, 0x11, 0x04, 0xf2,
+ 0xc3, 0x08, 0xed, 0x95, 0x00, 0x11, 0x04, 0xf5,
  0x01, 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04,
- 0xfc, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
- 0x04, 0x75, 0x02, 0x00, 0x00, 0xab, 0xea, 0x0f,
+ 0xff, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
+ 0x04, 0x78, 0x02, 0x00, 0x00, 0xab, 0xea, 0x0f,
  0xb6, 0xc3, 0x08, 0x93, 0x06, 0xc2, 0x0a, 0xc6,
  0xef, 0x0e, 0x0e, 0xed, 0x04, 0xff, 0x11, 0x04,
- 0xf3, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11,
- 0x04, 0xe7, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a,
- 0x11, 0x04, 0xe8, 0x01, 0x00, 0x00, 0xab, 0xea,
+ 0xf6, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11,
+ 0x04, 0xea, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a,
+ 0x11, 0x04, 0xeb, 0x01, 0x00, 0x00, 0xab, 0xea,
  0x25, 0xb5, 0xc3, 0x08, 0xc2, 0x06, 0xb5, 0xa5,
  0xea, 0x13, 0xde, 0xc2, 0x0b, 0xee, 0xc6, 0xf0,
  0xea, 0x0b, 0x92, 0x06, 0xc2, 0x0c, 0xee, 0x0e,
- 0x0e, 0xed, 0xce, 0xfe, 0x04, 0x11, 0x01, 0x00,
+ 0x0e, 0xed, 0xce, 0xfe, 0x04, 0x14, 0x01, 0x00,
  0x00, 0xc3, 0x04, 0xec, 0x2c, 0xdf, 0xc6, 0xef,
  0xea, 0x0a, 0xc2, 0x11, 0xee, 0x0e, 0xb5, 0xc3,
  0x08, 0xec, 0x1e, 0xdd, 0xc6, 0xef, 0x11, 0xeb,
- 0x09, 0x0e, 0xc6, 0x04, 0x5d, 0x01, 0x00, 0x00,
+ 0x09, 0x0e, 0xc6, 0x04, 0x60, 0x01, 0x00, 0x00,
  0xa9, 0xea, 0x07, 0xc2, 0x15, 0xee, 0x0e, 0xec,
  0x08, 0xb6, 0xc3, 0x08, 0x0e, 0xed, 0x9a, 0xfe,
  0x0e, 0xc2, 0x04, 0x69, 0x94, 0xfe, 0xff, 0xff,
  0xc2, 0x16, 0xc7, 0xc5, 0xf0, 0x0e, 0xed, 0x89,
  0xfe, 0xc2, 0x16, 0xc8, 0xc8, 0xf0, 0x0e, 0xc2,
  0x05, 0xc2, 0x06, 0xc2, 0x09, 0x26, 0x03, 0x00,
- 0x28, 0x0e, 0x43, 0x02, 0x03, 0xec, 0x09, 0x01,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xf2, 0x09, 0x01,
  0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00,
  0x05, 0x01, 0xdd, 0xd1, 0x9d, 0xe1, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0xee, 0x09, 0x01, 0x00, 0x01,
+ 0x43, 0x02, 0x03, 0xf4, 0x09, 0x01, 0x00, 0x01,
  0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x05, 0x01,
- 0xdd, 0x42, 0x68, 0x01, 0x00, 0x00, 0xdd, 0xe9,
+ 0xdd, 0x42, 0x6b, 0x01, 0x00, 0x00, 0xdd, 0xe9,
  0xb6, 0x9e, 0x25, 0x01, 0x00, 0x0e, 0x43, 0x02,
- 0x03, 0xf0, 0x09, 0x01, 0x00, 0x01, 0x05, 0x02,
+ 0x03, 0xf6, 0x09, 0x01, 0x00, 0x01, 0x05, 0x02,
  0x00, 0x14, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x05,
- 0x01, 0xdd, 0xee, 0xd5, 0xde, 0x42, 0x68, 0x01,
+ 0x01, 0xdd, 0xee, 0xd5, 0xde, 0x42, 0x6b, 0x01,
  0x00, 0x00, 0xb5, 0xde, 0xe9, 0xb6, 0x9e, 0x24,
  0x02, 0x00, 0xe2, 0xd1, 0x28, 0x0e, 0x43, 0x02,
- 0x03, 0xf2, 0x09, 0x00, 0x00, 0x00, 0x03, 0x06,
- 0x00, 0x49, 0x00, 0xf4, 0x09, 0x04, 0x01, 0xec,
- 0x09, 0x0a, 0x01, 0xf6, 0x09, 0x00, 0x01, 0x90,
- 0x08, 0x03, 0x01, 0xf8, 0x09, 0x00, 0x03, 0xf0,
- 0x09, 0x0c, 0x01, 0x04, 0x0c, 0x01, 0x00, 0x00,
- 0xe1, 0xde, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xef,
+ 0x03, 0xf8, 0x09, 0x00, 0x00, 0x00, 0x03, 0x06,
+ 0x00, 0x49, 0x00, 0xfa, 0x09, 0x04, 0x01, 0xf2,
+ 0x09, 0x0a, 0x01, 0xfc, 0x09, 0x00, 0x01, 0x96,
+ 0x08, 0x03, 0x01, 0xfe, 0x09, 0x00, 0x03, 0xf6,
+ 0x09, 0x0c, 0x01, 0x04, 0x0f, 0x01, 0x00, 0x00,
+ 0xe1, 0xde, 0x04, 0xec, 0x01, 0x00, 0x00, 0xef,
  0x0e, 0xdf, 0x8f, 0xe3, 0xdf, 0xe0, 0xb6, 0x9e,
  0xa3, 0xea, 0x31, 0x5e, 0x04, 0x00, 0xdf, 0x47,
  0x04, 0x80, 0x00, 0x00, 0x00, 0xa9, 0xea, 0x1f,
  0x5e, 0x04, 0x00, 0xdf, 0xb6, 0x9d, 0x47, 0x04,
- 0xe9, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x10, 0xdf,
- 0xb7, 0x9d, 0xe3, 0x5e, 0x05, 0x00, 0x04, 0xe9,
+ 0xec, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x10, 0xdf,
+ 0xb7, 0x9d, 0xe3, 0x5e, 0x05, 0x00, 0x04, 0xec,
  0x01, 0x00, 0x00, 0xef, 0x0e, 0x29, 0xdf, 0x8f,
  0xe3, 0xec, 0xca, 0x29, 0x0e, 0x43, 0x02, 0x03,
- 0xfa, 0x09, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
- 0x1f, 0x00, 0xf4, 0x09, 0x04, 0x01, 0xf6, 0x09,
- 0x00, 0x01, 0x90, 0x08, 0x03, 0x01, 0xf8, 0x09,
- 0x00, 0x03, 0x04, 0x0c, 0x01, 0x00, 0x00, 0xe1,
+ 0x80, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+ 0x1f, 0x00, 0xfa, 0x09, 0x04, 0x01, 0xfc, 0x09,
+ 0x00, 0x01, 0x96, 0x08, 0x03, 0x01, 0xfe, 0x09,
+ 0x00, 0x03, 0x04, 0x0f, 0x01, 0x00, 0x00, 0xe1,
  0xde, 0x8f, 0xe2, 0xde, 0xdf, 0xa3, 0xea, 0x11,
- 0xe0, 0xde, 0x47, 0x04, 0x20, 0x01, 0x00, 0x00,
+ 0xe0, 0xde, 0x47, 0x04, 0x23, 0x01, 0x00, 0x00,
  0xa9, 0xeb, 0x06, 0xde, 0x8f, 0xe2, 0xec, 0xec,
- 0x29, 0x0e, 0x43, 0x02, 0x03, 0xfc, 0x09, 0x01,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x82, 0x0a, 0x01,
  0x00, 0x01, 0x03, 0x07, 0x00, 0x4c, 0x00, 0x00,
  0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x01,
  0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
  0x03, 0x00, 0x0c, 0x01, 0x04, 0x4b, 0x00, 0x00,
  0x00, 0xe1, 0xde, 0xd1, 0xef, 0x0e, 0xdf, 0xe0,
  0xa3, 0xea, 0x3d, 0x5e, 0x05, 0x00, 0xdf, 0x91,
- 0xe3, 0x47, 0x60, 0x04, 0x00, 0x04, 0x20, 0x01,
- 0x00, 0x00, 0xa9, 0xea, 0x09, 0x04, 0x11, 0x01,
+ 0xe3, 0x47, 0x60, 0x04, 0x00, 0x04, 0x23, 0x01,
+ 0x00, 0x00, 0xa9, 0xea, 0x09, 0x04, 0x14, 0x01,
  0x00, 0x00, 0xe1, 0xec, 0xe2, 0x5e, 0x04, 0x00,
- 0x04, 0x21, 0x02, 0x00, 0x00, 0xa9, 0xea, 0x0b,
+ 0x04, 0x24, 0x02, 0x00, 0x00, 0xa9, 0xea, 0x0b,
  0xdf, 0xe0, 0xa6, 0xeb, 0x13, 0xdf, 0x8f, 0xe3,
  0xec, 0xcd, 0x5e, 0x04, 0x00, 0xd1, 0xa9, 0xea,
  0xc6, 0x5e, 0x06, 0x00, 0xee, 0x0e, 0x29, 0x29,
- 0x0e, 0x43, 0x02, 0x03, 0xfe, 0x09, 0x00, 0x00,
- 0x00, 0x03, 0x09, 0x00, 0xc4, 0x01, 0x00, 0xf4,
- 0x09, 0x04, 0x01, 0xec, 0x09, 0x0a, 0x01, 0xf6,
- 0x09, 0x00, 0x01, 0x90, 0x08, 0x03, 0x01, 0xd6,
- 0x06, 0x01, 0x01, 0xf8, 0x09, 0x00, 0x03, 0xee,
- 0x09, 0x0b, 0x01, 0xf0, 0x09, 0x0c, 0x01, 0xb6,
- 0x05, 0x00, 0x00, 0x04, 0x0d, 0x01, 0x00, 0x00,
- 0xe1, 0xde, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xef,
+ 0x0e, 0x43, 0x02, 0x03, 0x84, 0x0a, 0x00, 0x00,
+ 0x00, 0x03, 0x09, 0x00, 0xc4, 0x01, 0x00, 0xfa,
+ 0x09, 0x04, 0x01, 0xf2, 0x09, 0x0a, 0x01, 0xfc,
+ 0x09, 0x00, 0x01, 0x96, 0x08, 0x03, 0x01, 0xdc,
+ 0x06, 0x01, 0x01, 0xfe, 0x09, 0x00, 0x03, 0xf4,
+ 0x09, 0x0b, 0x01, 0xf6, 0x09, 0x0c, 0x01, 0xbc,
+ 0x05, 0x00, 0x00, 0x04, 0x10, 0x01, 0x00, 0x00,
+ 0xe1, 0xde, 0x04, 0xec, 0x01, 0x00, 0x00, 0xef,
  0x0e, 0xdf, 0xe0, 0xa3, 0x69, 0xb1, 0x00, 0x00,
  0x00, 0x5e, 0x05, 0x00, 0xdf, 0x91, 0xe3, 0x47,
- 0x60, 0x04, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00,
- 0xa9, 0xea, 0x09, 0x04, 0x11, 0x01, 0x00, 0x00,
- 0xe1, 0xec, 0xdf, 0x5e, 0x04, 0x00, 0x04, 0x21,
+ 0x60, 0x04, 0x00, 0x04, 0x23, 0x01, 0x00, 0x00,
+ 0xa9, 0xea, 0x09, 0x04, 0x14, 0x01, 0x00, 0x00,
+ 0xe1, 0xec, 0xdf, 0x5e, 0x04, 0x00, 0x04, 0x24,
  0x02, 0x00, 0x00, 0xa9, 0xea, 0x0b, 0xdf, 0xe0,
  0xa3, 0xea, 0xcf, 0xdf, 0x8f, 0xe3, 0xec, 0xca,
- 0x5e, 0x06, 0x00, 0xee, 0x04, 0xfc, 0x01, 0x00,
+ 0x5e, 0x06, 0x00, 0xee, 0x04, 0xff, 0x01, 0x00,
  0x00, 0xa9, 0xea, 0x13, 0x5e, 0x04, 0x00, 0x04,
- 0xe7, 0x01, 0x00, 0x00, 0xa9, 0xea, 0xb3, 0x5e,
+ 0xea, 0x01, 0x00, 0x00, 0xa9, 0xea, 0xb3, 0x5e,
  0x07, 0x00, 0xee, 0x0e, 0xec, 0xac, 0x5e, 0x04,
- 0x00, 0x04, 0xfc, 0x01, 0x00, 0x00, 0xa9, 0xea,
- 0x2e, 0xde, 0x04, 0xfc, 0x01, 0x00, 0x00, 0xef,
- 0x0e, 0x5e, 0x05, 0x00, 0xdf, 0x47, 0x04, 0xfc,
+ 0x00, 0x04, 0xff, 0x01, 0x00, 0x00, 0xa9, 0xea,
+ 0x2e, 0xde, 0x04, 0xff, 0x01, 0x00, 0x00, 0xef,
+ 0x0e, 0x5e, 0x05, 0x00, 0xdf, 0x47, 0x04, 0xff,
  0x01, 0x00, 0x00, 0xa9, 0x11, 0xeb, 0x0d, 0x0e,
- 0x5e, 0x05, 0x00, 0xdf, 0x47, 0x04, 0xe7, 0x01,
+ 0x5e, 0x05, 0x00, 0xdf, 0x47, 0x04, 0xea, 0x01,
  0x00, 0x00, 0xa9, 0x69, 0x7d, 0xff, 0xff, 0xff,
  0xdf, 0x8f, 0xe3, 0xed, 0x75, 0xff, 0x5e, 0x04,
- 0x00, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xa9, 0x69,
+ 0x00, 0x04, 0xec, 0x01, 0x00, 0x00, 0xa9, 0x69,
  0x69, 0xff, 0xff, 0xff, 0x5e, 0x07, 0x00, 0xee,
  0x0e, 0xdf, 0xe0, 0xa3, 0xea, 0x11, 0x5e, 0x08,
  0x00, 0x5e, 0x05, 0x00, 0xdf, 0x47, 0xef, 0xea,
  0x06, 0xdf, 0x8f, 0xe3, 0xec, 0xec, 0x29, 0x0e,
- 0x43, 0x02, 0x03, 0x80, 0x0a, 0x00, 0x00, 0x00,
- 0x03, 0x05, 0x00, 0x41, 0x00, 0xf4, 0x09, 0x04,
- 0x01, 0xf6, 0x09, 0x00, 0x01, 0x90, 0x08, 0x03,
- 0x01, 0xb6, 0x05, 0x00, 0x00, 0xf8, 0x09, 0x00,
+ 0x43, 0x02, 0x03, 0x86, 0x0a, 0x00, 0x00, 0x00,
+ 0x03, 0x05, 0x00, 0x41, 0x00, 0xfa, 0x09, 0x04,
+ 0x01, 0xfc, 0x09, 0x00, 0x01, 0x96, 0x08, 0x03,
+ 0x01, 0xbc, 0x05, 0x00, 0x00, 0xfe, 0x09, 0x00,
  0x03, 0x04, 0x49, 0x00, 0x00, 0x00, 0xe1, 0xde,
  0xdf, 0xa3, 0xea, 0x36, 0xe0, 0x5e, 0x04, 0x00,
  0xde, 0x47, 0xef, 0x11, 0xeb, 0x25, 0x0e, 0x5e,
- 0x04, 0x00, 0xde, 0x47, 0x04, 0xe4, 0x01, 0x00,
+ 0x04, 0x00, 0xde, 0x47, 0x04, 0xe7, 0x01, 0x00,
  0x00, 0xa9, 0xea, 0x1e, 0xde, 0xdf, 0xb6, 0x9e,
  0xa9, 0x11, 0xeb, 0x0f, 0x0e, 0x5e, 0x04, 0x00,
- 0xde, 0xb6, 0x9d, 0x47, 0x04, 0xe4, 0x01, 0x00,
+ 0xde, 0xb6, 0x9d, 0x47, 0x04, 0xe7, 0x01, 0x00,
  0x00, 0xaa, 0xea, 0x06, 0xde, 0x8f, 0xe2, 0xec,
- 0xc7, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x82, 0x0a,
+ 0xc7, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x88, 0x0a,
  0x00, 0x02, 0x00, 0x05, 0x0a, 0x00, 0xb3, 0x01,
  0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00,
  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
@@ -1988,33 +1988,33 @@ const uint8_t qjsc_repl[16089] = {
  0x01, 0x00, 0x13, 0x01, 0x00, 0x14, 0x01, 0xb6,
  0xe1, 0xde, 0xdf, 0xa3, 0xea, 0x0f, 0xe0, 0x5e,
  0x04, 0x00, 0xde, 0x47, 0xef, 0xea, 0x06, 0xde,
- 0x8f, 0xe2, 0xec, 0xee, 0x04, 0x67, 0x02, 0x00,
- 0x00, 0x5e, 0x04, 0x00, 0x42, 0x68, 0x01, 0x00,
+ 0x8f, 0xe2, 0xec, 0xee, 0x04, 0x6a, 0x02, 0x00,
+ 0x00, 0x5e, 0x04, 0x00, 0x42, 0x6b, 0x01, 0x00,
  0x00, 0x5e, 0x05, 0x00, 0xde, 0x24, 0x02, 0x00,
- 0x9d, 0x04, 0x67, 0x02, 0x00, 0x00, 0x9d, 0xc9,
- 0x5e, 0x06, 0x00, 0x42, 0xe3, 0x01, 0x00, 0x00,
+ 0x9d, 0x04, 0x6a, 0x02, 0x00, 0x00, 0x9d, 0xc9,
+ 0x5e, 0x06, 0x00, 0x42, 0xe6, 0x01, 0x00, 0x00,
  0xc5, 0x24, 0x01, 0x00, 0xb5, 0xa6, 0xea, 0x1c,
- 0x04, 0x0e, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00,
- 0x5e, 0x08, 0x00, 0x42, 0xe3, 0x01, 0x00, 0x00,
+ 0x04, 0x11, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00,
+ 0x5e, 0x08, 0x00, 0x42, 0xe6, 0x01, 0x00, 0x00,
  0xc5, 0x24, 0x01, 0x00, 0xb5, 0xa6, 0xea, 0x03,
  0xb5, 0xe1, 0x29, 0xde, 0xca, 0xc6, 0xdf, 0xa3,
  0xea, 0x12, 0x5e, 0x04, 0x00, 0xc6, 0x47, 0x04,
- 0xf8, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x05, 0x93,
+ 0xfb, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x05, 0x93,
  0x01, 0xec, 0xeb, 0xc6, 0xdf, 0xa3, 0xea, 0x17,
- 0x5e, 0x04, 0x00, 0xc6, 0x47, 0x04, 0xf2, 0x01,
+ 0x5e, 0x04, 0x00, 0xc6, 0x47, 0x04, 0xf5, 0x01,
  0x00, 0x00, 0xa9, 0xea, 0x0a, 0x04, 0x1b, 0x00,
  0x00, 0x00, 0x5f, 0x07, 0x00, 0x29, 0x5e, 0x09,
- 0x00, 0x42, 0xe3, 0x01, 0x00, 0x00, 0xc5, 0x24,
- 0x01, 0x00, 0xb5, 0xa6, 0xea, 0x0a, 0x04, 0x0f,
+ 0x00, 0x42, 0xe6, 0x01, 0x00, 0x00, 0xc5, 0x24,
+ 0x01, 0x00, 0xb5, 0xa6, 0xea, 0x0a, 0x04, 0x12,
  0x01, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x29, 0x04,
- 0x10, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00, 0xb5,
- 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x84, 0x0a,
+ 0x13, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00, 0xb5,
+ 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x8a, 0x0a,
  0x02, 0x00, 0x02, 0x03, 0x02, 0x00, 0x2b, 0x00,
  0x00, 0x09, 0x01, 0x00, 0x04, 0x01, 0xdd, 0xe9,
- 0xd1, 0xa3, 0xea, 0x12, 0xdd, 0x42, 0x86, 0x01,
+ 0xd1, 0xa3, 0xea, 0x12, 0xdd, 0x42, 0x89, 0x01,
  0x00, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xec, 0xea, 0xdd, 0xe9, 0xd2,
- 0xa3, 0xea, 0x0e, 0xdd, 0x42, 0x86, 0x01, 0x00,
+ 0xa3, 0xea, 0x0e, 0xdd, 0x42, 0x89, 0x01, 0x00,
  0x00, 0xde, 0x24, 0x01, 0x00, 0x0e, 0xec, 0xee,
  0x29,
 };
@@ -21,6 +21,11 @@ extern "C" {
 #include <ctype.h>
 #endif //_INC_CTYPE
 
+/**
+ * Maximal length of string and binary index keys
+ */
+#define DYBASE_MAX_KEY_LENGTH 2040
+
 /**
  * Supported database field types
  */
@@ -53,21 +58,53 @@ enum dybase_error_code {
   dybase_out_of_memory_error
 };
 
+/**
+ * Open mode flags
+ */
+enum dybase_open_mode {
+  dybase_open_read_only  = 0x00,
+  dybase_open_read_write = 0x01,
+  dybase_open_mmap_read  = 0x02, // read clean pages through file mapping
+  dybase_open_wal        = 0x04  // commit transactions to write-ahead log
+};
+
 typedef void *   dybase_storage_t;
 typedef void *   dybase_handle_t;
 typedef void *   dybase_iterator_t;
 typedef unsigned dybase_oid_t;
 
 typedef void *   hashtable_t;
+typedef void *   oidhashtable_t;
 
 typedef void (*dybase_error_handler_t)(int error_code, char const *msg);
 
+typedef struct dybase_bulk_item_t {
+  void *       key;      // pointer to the value of the key
+  int          key_size; // size of the string key
+  dybase_oid_t obj;      // OID of the object associated with this key
+} dybase_bulk_item_t;
+
+/**
+ * Garbage collector and compaction statistics
+ */
+typedef struct dybase_gc_stats_t {
+  int       active;        // GC cycle is in progress
+  long long cycles;        // number of completed GC cycles
+  long long marked;        // objects marked by the current (or last) cycle
+  long long freed_objects; // total number of collected objects
+  long long freed_bytes;   // total size of collected objects
+  long long relocated;     // total number of objects moved by compaction
+  long long truncated;     // total number of bytes cut off the file end
+  long long file_size;     // size of the database
+} dybase_gc_stats_t;
+
 /**
  * Open storage
  * @param file_path path to the storage file
  * @page_pool_size size of page pool in bytes, if 0, then default value will be
  * used
  * @param hnd error handler
+ * @param read_write combination of dybase_open_mode flags
  * @return pointer to the opened storage or NULL if open failed
  */
 dybase_storage_t DYBASE_DLL_ENTRY dybase_open(const char *file_path,
@@ -93,6 +130,30 @@ void DYBASE_DLL_ENTRY dybase_commit(dybase_storage_t storage);
  */
 void DYBASE_DLL_ENTRY dybase_rollback(dybase_storage_t storage);
 
+/**
+ * Move read only storage to the last transaction committed by the storage
+ * opened for writing by this process. Read only storages of a file opened
+ * for writing by the same process are snapshots: they read the last commit
+ * without blocking the writer. Writer may commit once after the snapshot was
+ * taken, its next transaction waits until the snapshot is refreshed or
+ * closed (snapshot used by the writing thread is moved implicitly, see
+ * dybase_snapshot_moved()). Objects of the previous snapshot should not be
+ * accessed after refresh.
+ * @param storage pointer to the storage opened in read only mode
+ * @return 1 if snapshot was moved, 0 if storage is not a snapshot
+ */
+int DYBASE_DLL_ENTRY dybase_refresh(dybase_storage_t storage);
+
+/**
+ * Check if read only storage was moved to the last commit by a transaction
+ * of the writer running in the same thread. The flag is cleared by this call
+ * and by dybase_refresh(). Objects of the previous snapshot should not be
+ * accessed once it was moved.
+ * @param storage pointer to the storage opened in read only mode
+ * @return 1 if snapshot was moved since the last check or refresh
+ */
+int DYBASE_DLL_ENTRY dybase_snapshot_moved(dybase_storage_t storage);
+
 /**
  * Get identifier of the root object
  * @param storage pointer to the opened storage
@@ -108,6 +169,24 @@ dybase_oid_t DYBASE_DLL_ENTRY dybase_get_root_object(dybase_storage_t storage);
 void DYBASE_DLL_ENTRY dybase_set_root_object(dybase_storage_t storage,
                                              dybase_oid_t     oid);
 
+/**
+ * Get identifier of the catalog object. Catalog is the second root of the
+ * storage for application metadata, objects reachable from it are not
+ * collected by dybase_gc.
+ * @param storage pointer to the opened storage
+ * @return catalog object OID or 0 if catalog was not yet specified
+ */
+dybase_oid_t DYBASE_DLL_ENTRY
+             dybase_get_catalog_object(dybase_storage_t storage);
+
+/**
+ * Set storage catalog
+ * @param storage pointer to the opened storage
+ * @param oid object identifier of new storage catalog
+ */
+void DYBASE_DLL_ENTRY dybase_set_catalog_object(dybase_storage_t storage,
+                                                dybase_oid_t     oid);
+
 /**
  * Allocate object
  * @param storage pointer to the opened storage
@@ -134,6 +213,33 @@ void DYBASE_DLL_ENTRY dybase_deallocate_object(dybase_storage_t storage,
 dybase_handle_t DYBASE_DLL_ENTRY dybase_begin_store_object(
     dybase_storage_t storage, dybase_oid_t oid, char const *class_name);
 
+/**
+ * Register class of objects with fixed set of fields. Class name and field
+ * names are kept once in the class descriptor, so objects of this class can
+ * be stored by dybase_begin_store_class_object with only field values in the
+ * object body. Registering the same class again returns the same descriptor.
+ * @param storage pointer to the opened storage
+ * @param class_name name of the class
+ * @param field_names names of the fields
+ * @param n_fields number of fields
+ * @return OID of the class descriptor or 0 in case of error
+ */
+dybase_oid_t DYBASE_DLL_ENTRY dybase_register_class(
+    dybase_storage_t storage, char const *class_name,
+    char const *const *field_names, int n_fields);
+
+/**
+ * Begin store of object of the class registered by dybase_register_class.
+ * Field values should be stored by dybase_store_array_element in order of
+ * the class fields, followed by dybase_end_store_object.
+ * @param storage pointer to the opened storage
+ * @param oid object identifier
+ * @param class_oid OID of the class descriptor
+ * @return handle of stored object
+ */
+dybase_handle_t DYBASE_DLL_ENTRY dybase_begin_store_class_object(
+    dybase_storage_t storage, dybase_oid_t oid, dybase_oid_t class_oid);
+
 /**
  * Store object field
  * @param handle object handle returned by dybase_begin_store_object
@@ -207,6 +313,23 @@ void dybase_end_load_object(dybase_handle_t handle);
  */
 DYBASE_DLL_ENTRY char *dybase_get_class_name(dybase_handle_t handle);
 
+/**
+ * Get OID of the loaded object class descriptor. Objects with the same class
+ * name and the same set of fields share the descriptor.
+ * @param handle object handle returned by dybase_begin_load_object
+ * @return OID of the class descriptor
+ */
+DYBASE_DLL_ENTRY dybase_oid_t dybase_get_class_oid(dybase_handle_t handle);
+
+/**
+ * Get field names of the loaded object class
+ * @param handle object handle returned by dybase_begin_load_object
+ * @param n_fields pointer to the location to receive number of fields
+ * @return array of field names, valid while the storage is opened
+ */
+DYBASE_DLL_ENTRY char **dybase_get_class_fields(dybase_handle_t handle,
+                                                int *           n_fields);
+
 /**
  * Move to next field. This function should be called before dybase_get_value
  * function. When this functions is called first time after
@@ -270,6 +393,28 @@ int DYBASE_DLL_ENTRY dybase_insert_in_index(dybase_storage_t storage,
                                             int key_type, int key_size,
                                             dybase_oid_t obj, int replace);
 
+/**
+ * Insert many values in index at once. Keys of the new items and keys already
+ * present in the index are sorted in memory and B-tree pages are rebuilt
+ * bottom-up, which is much faster than inserting items one by one. Calling it
+ * with no items rebuilds (compacts) the index.
+ * @param storage pointer to the opened storage
+ * @param index OID of index created by dybase_create_index
+ * @param key_type type of the inserted keys which should match type of the
+ * index
+ * @param items items to insert, they need not be sorted
+ * @param n_items number of items
+ * @param fill_factor how full built pages are, in percents (0 means 100)
+ * @return number of inserted items: in case of unique index items with keys
+ * which are already present in the index (or repeated in items) are skipped
+ */
+int DYBASE_DLL_ENTRY dybase_bulk_insert_in_index(dybase_storage_t    storage,
+                                                 dybase_oid_t        index,
+                                                 int                 key_type,
+                                                 dybase_bulk_item_t *items,
+                                                 int                 n_items,
+                                                 int fill_factor);
+
 /**
  * Remove key from the index
  * @param storage pointer to the opened storage
@@ -391,6 +536,38 @@ dybase_iterator_t DYBASE_DLL_ENTRY dybase_create_index_iterator(
 dybase_oid_t DYBASE_DLL_ENTRY
              dybase_index_iterator_next(dybase_iterator_t iterator);
 
+/**
+ * Get next elements. Iterator also starts asynchronous read of the following
+ * leaf pages of the index.
+ * @param iterator index iterator
+ * @param oids buffer receiving oids of the objects
+ * @param n size of the buffer
+ * @return number of fetched oids, 0 if there are no more objects
+ */
+int DYBASE_DLL_ENTRY dybase_index_iterator_next_n(dybase_iterator_t iterator,
+                                                  dybase_oid_t *    oids,
+                                                  int               n);
+
+/**
+ * Get next element and its key
+ * @param iterator index iterator
+ * @param key buffer of DYBASE_MAX_KEY_LENGTH bytes to receive the key
+ * @param key_length pointer to the location to receive length of the key
+ * @return oid of next object in the index or 0 if there are no more objects
+ */
+dybase_oid_t DYBASE_DLL_ENTRY dybase_index_iterator_next_key(
+    dybase_iterator_t iterator, void *key, int *key_length);
+
+/**
+ * Start asynchronous read of the objects which are going to be loaded
+ * @param storage pointer to the opened storage
+ * @param oids OIDs of the objects
+ * @param n number of objects
+ */
+void DYBASE_DLL_ENTRY dybase_prefetch_objects(dybase_storage_t storage,
+                                              dybase_oid_t *   oids,
+                                              int              n);
+
 /**
  * Free index iterator
  * @param iterator index iterator
@@ -410,10 +587,64 @@ void DYBASE_DLL_ENTRY dybase_set_gc_threshold(dybase_storage_t storage,
                                               long             allocated_delta);
 
 /**
- * Explicit start of garbage collector
+ * Explicit start of garbage collector. Stops the application until the whole
+ * storage is marked and swept, completes incremental cycle if it is started.
  */
 void DYBASE_DLL_ENTRY dybase_gc(dybase_storage_t storage);
 
+/**
+ * Start incremental garbage collection cycle. Objects reachable from the
+ * storage root (and catalog) when the cycle is started are marked by
+ * dybase_gc_step calls, objects which are referenced only by the application
+ * should be passed to dybase_gc_mark after the cycle is started.
+ * @param threshold start the cycle only if total size of objects allocated
+ * since the previous cycle exceeds the threshold, -1 to start it anyway
+ * @return 1 if new cycle is started, 0 if cycle is in progress or not needed
+ */
+int DYBASE_DLL_ENTRY dybase_gc_start(dybase_storage_t storage,
+                                     long             threshold);
+
+/**
+ * Mark object used by the application as reachable in the current GC cycle
+ */
+void DYBASE_DLL_ENTRY dybase_gc_mark(dybase_storage_t storage,
+                                     dybase_oid_t     oid);
+
+/**
+ * Perform part of the incremental GC cycle: mark at most max_objects
+ * objects, unreachable objects are freed when marking is completed
+ * (changes are saved by the next commit)
+ * @return 1 if no GC cycle is in progress after this step
+ */
+int DYBASE_DLL_ENTRY dybase_gc_step(dybase_storage_t storage,
+                                    int              max_objects);
+
+/**
+ * Move at most max_objects objects (0 - no limit) from the end of the storage
+ * file to the free space at its beginning, commit the transaction and
+ * truncate free tail of the file.
+ * @return number of moved objects, 0 if there is nothing to move
+ */
+int DYBASE_DLL_ENTRY dybase_compact(dybase_storage_t storage,
+                                    int              max_objects);
+
+/**
+ * Get garbage collector and compaction statistics
+ */
+void DYBASE_DLL_ENTRY dybase_get_gc_stats(dybase_storage_t   storage,
+                                          dybase_gc_stats_t *stats);
+
+/**
+ * Make the index weak: it does not keep its objects alive. Garbage collector
+ * frees objects referenced only by weak indices and removes their entries from
+ * these indices. The setting is not persistent, it should be repeated each
+ * time the storage is opened, before GC is started.
+ * @param storage pointer to the opened storage
+ * @param index OID of index created by dybase_create_index
+ */
+void DYBASE_DLL_ENTRY dybase_set_weak_index(dybase_storage_t storage,
+                                            dybase_oid_t     index);
+
 
 hashtable_t DYBASE_DLL_ENTRY hashtable_create();
 void       DYBASE_DLL_ENTRY hashtable_put(hashtable_t ht, void *key, int keySize, void *value);
@@ -426,6 +657,18 @@ typedef int each_cb_t(void* key, unsigned int key_length, void* data, void* opaq
 void       DYBASE_DLL_ENTRY hashtable_each(hashtable_t ht, each_cb_t* pcb, void* opaque);
 void       DYBASE_DLL_ENTRY hashtable_free(hashtable_t ht);
 
+/**
+ * Growable hashtable keyed by object oid (oid must not be 0).
+ * The callback of oidhashtable_each receives a pointer to the oid as key
+ * and must not modify the table.
+ */
+oidhashtable_t DYBASE_DLL_ENTRY oidhashtable_create();
+void       DYBASE_DLL_ENTRY oidhashtable_put(oidhashtable_t ht, dybase_oid_t oid, void *value);
+void*      DYBASE_DLL_ENTRY oidhashtable_get(oidhashtable_t ht, dybase_oid_t oid);
+void*      DYBASE_DLL_ENTRY oidhashtable_remove(oidhashtable_t ht, dybase_oid_t oid);
+void       DYBASE_DLL_ENTRY oidhashtable_each(oidhashtable_t ht, each_cb_t* pcb, void* opaque);
+void       DYBASE_DLL_ENTRY oidhashtable_free(oidhashtable_t ht);
+
 
 #ifdef __cplusplus
 }
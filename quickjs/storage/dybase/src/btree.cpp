@@ -187,6 +187,11 @@ bool dbBtree::remove(dbDatabase *db, oid_t treeId, void *key, int keyType,
     db->handleError(dybase_not_opened, "Database not opened");
     return false;
   }
+  return _remove(db, treeId, key, keyType, keySize, oid);
+}
+
+bool dbBtree::_remove(dbDatabase *db, oid_t treeId, void *key, int keyType,
+                      length_t keySize, oid_t oid) {
   dbGetTie          treeTie;
   dbBtreePage::item rem;
   dbBtree *         tree = (dbBtree *)db->getObject(treeTie, treeId);
@@ -234,12 +239,58 @@ bool dbBtree::remove(dbDatabase *db, oid_t treeId, void *key, int keyType,
   return result != not_found;
 }
 
+// Weak index: entries referencing objects which are freed by the sweep of the
+// current GC cycle are collected first (key length, oid and key packed one
+// after another), then removed from the tree
+void dbBtree::removeGarbage(dbDatabase *db, oid_t treeId) {
+  byte *   buf  = NULL;
+  size_t   used = 0, size = 0;
+  byte     key[dbBtreePage::dbMaxKeyLen];
+  length_t keyLength;
+  oid_t    oid;
+  int      type;
+  {
+    dbGetTie tie;
+    type = ((dbBtree *)db->getObject(tie, treeId))->type;
+  }
+  {
+    dbBtreeIterator it(db, treeId, type, NULL, 0, 0, NULL, 0, 0, true);
+    while ((oid = it.next(key, keyLength)) != 0) {
+      if (!db->isGarbage(oid)) { continue; }
+      size_t itemSize = DOALIGN(sizeof(length_t) + sizeof(oid_t) + keyLength,
+                                sizeof(length_t));
+      if (used + itemSize > size) {
+        size         = size ? size * 2 : 4096;
+        size        += itemSize;
+        byte *newBuf = new byte[size];
+        memcpy(newBuf, buf, used);
+        delete[] buf;
+        buf = newBuf;
+      }
+      *(length_t *)(buf + used)                = keyLength;
+      *(oid_t *)(buf + used + sizeof(length_t)) = oid;
+      memcpy(buf + used + sizeof(length_t) + sizeof(oid_t), key, keyLength);
+      used += itemSize;
+    }
+  }
+  for (size_t pos = 0; pos < used;) {
+    keyLength = *(length_t *)(buf + pos);
+    oid       = *(oid_t *)(buf + pos + sizeof(length_t));
+    _remove(db, treeId, buf + pos + sizeof(length_t) + sizeof(oid_t), type,
+            keyLength, oid);
+    pos += DOALIGN(sizeof(length_t) + sizeof(oid_t) + keyLength,
+                   sizeof(length_t));
+  }
+  delete[] buf;
+}
+
 void dbBtree::clear(dbDatabase *db, oid_t treeId) {
   dbCriticalSection cs(db->mutex);
   if (!db->opened) {
     db->handleError(dybase_not_opened, "Database not opened");
     return;
   }
+  db->beforeUpdate(treeId);
   _clear(db, treeId);
 }
 
@@ -259,6 +310,7 @@ void dbBtree::drop(dbDatabase *db, oid_t treeId) {
     db->handleError(dybase_not_opened, "Database not opened");
     return;
   }
+  db->beforeUpdate(treeId);
   _drop(db, treeId);
 }
 
@@ -447,6 +499,7 @@ oid_t dbBtreePage::allocate(dbDatabase *db, oid_t root, int type, item &ins) {
       if (replace) {                                                           \
         db->pool.unfix(pg);                                                    \
         pg                           = (dbBtreePage *)db->put(tie, pageId);    \
+        db->shadeOid(pg->record[maxItems - r - 1]);                            \
         pg->record[maxItems - r - 1] = ins.oid;                                \
         return dbBtree::done;                                                  \
       } else if (unique) {                                                     \
@@ -551,6 +604,7 @@ int dbBtreePage::insert(dbDatabase *db, oid_t pageId, int type, item &ins,
       if (replace) {
         db->pool.unfix(pg);
         pg                = (dbBtreePage *)db->put(tie, pageId);
+        db->shadeOid(pg->strKey[r].oid);
         pg->strKey[r].oid = ins.oid;
         return dbBtree::done;
       } else if (unique) {
@@ -736,7 +790,7 @@ int dbBtreePage::removeStrKey(int r) {
   int offs = strKey[r].offs;
   memmove(charKey + sizeof(charKey) - size + len * sizeof(char),
           charKey + sizeof(charKey) - size, size - sizeof(charKey) + offs);
-  memcpy(&strKey[r], &strKey[r + 1], (nItems - r) * sizeof(str));
+  memmove(&strKey[r], &strKey[r + 1], (nItems - r) * sizeof(str));
   nItems -= 1;
   size -= len * sizeof(char);
   for (int i = nItems; --i >= 0;) {
@@ -1010,7 +1064,7 @@ int dbBtreePage::handlePageUnderflow(dbDatabase *db, int r, int type, item &rem,
         db->freePage(record[maxItems - r - 2]);
         memmove(&record[maxItems - nItems], &record[maxItems - nItems - 1],
                 (nItems - r - 1) * sizeof(oid_t));
-        memcpy(charKey + r * sizeofType, charKey + (r + 1) * sizeofType,
+        memmove(charKey + r * sizeofType, charKey + (r + 1) * sizeofType,
                (nItems - r - 1) * sizeofType);
         a->nItems += bn;
         nItems -= 1;
@@ -1089,6 +1143,7 @@ int dbBtreePage::handlePageUnderflow(dbDatabase *db, int r, int type, item &rem,
           if (pg->record[maxItems - r - 1] == oid || oid == 0) {               \
             db->pool.unfix(pg);                                                \
             pg = (dbBtreePage *)db->put(tie, pageId);                          \
+            db->shadeOid(pg->record[maxItems - r - 1]);                        \
             memcpy(&pg->KEY[r], &pg->KEY[r + 1], (n - r - 1) * sizeof(TYPE));  \
             memmove(&pg->record[maxItems - n + 1], &pg->record[maxItems - n],  \
                     (n - r - 1) * sizeof(oid_t));                              \
@@ -1159,6 +1214,7 @@ int dbBtreePage::remove(dbDatabase *db, oid_t pageId, int type, item &rem,
           if (pg->strKey[r].oid == rem.oid || rem.oid == 0) {
             db->pool.unfix(pg);
             pg = (dbBtreePage *)db->put(tie, pageId);
+            db->shadeOid(pg->strKey[r].oid);
             return pg->removeStrKey(r);
           }
         } else {
@@ -1206,7 +1262,7 @@ void dbBtreePage::purge(dbDatabase *db, oid_t pageId, int type, int height) {
 
 void dbBtreePage::markPage(dbDatabase *db, oid_t pageId, int type, int height) {
   dbBtreePage *pg =
-      (dbBtreePage *)db->pool.get(db->getGCPos(pageId) & ~dbPageObjectFlag);
+      (dbBtreePage *)db->pool.get(db->getPos(pageId) & ~dbFlagsMask);
   int i, n = pg->nItems;
   if (--height != 0) {
     if (type == dybase_chars_type || type == dybase_bytes_type) { // page of strings
@@ -1232,6 +1288,288 @@ void dbBtreePage::markPage(dbDatabase *db, oid_t pageId, int type, int height) {
   db->pool.unfix(pg);
 }
 
+//
+// Bulk loading. Keys are sorted in memory and pages are written bottom-up,
+// level by level, following the layout produced by insert(): key i of an
+// inner page is the largest key of child i and the last child has no key.
+//
+
+static int compareBulkKeys(int type, dbBtreeBulkItem const *a,
+                           dbBtreeBulkItem const *b) {
+  switch (type) {
+  case dybase_object_ref_type:
+  case dybase_array_ref_type:
+  case dybase_index_ref_type:
+    return a->refKey < b->refKey ? -1 : a->refKey == b->refKey ? 0 : 1;
+  case dybase_bool_type: return a->boolKey - b->boolKey;
+  case dybase_int_type:
+    return a->intKey < b->intKey ? -1 : a->intKey == b->intKey ? 0 : 1;
+  case dybase_date_type:
+  case dybase_long_type:
+    return a->longKey < b->longKey ? -1 : a->longKey == b->longKey ? 0 : 1;
+  case dybase_real_type:
+    return a->realKey < b->realKey ? -1 : a->realKey == b->realKey ? 0 : 1;
+  case dybase_chars_type:
+  case dybase_bytes_type:
+    return compareStrings(a->charKey, a->keyLen, b->charKey, b->keyLen);
+  }
+  return 0;
+}
+
+#define BULK_COMPARATOR(NAME, TYPE)                                            \
+  static int NAME(void const *p, void const *q) {                              \
+    dbBtreeBulkItem const *a    = (dbBtreeBulkItem const *)p;                  \
+    dbBtreeBulkItem const *b    = (dbBtreeBulkItem const *)q;                  \
+    int                    diff = compareBulkKeys(TYPE, a, b);                 \
+    if (diff != 0) { return diff; }                                            \
+    return a->seq < b->seq ? -1 : a->seq == b->seq ? 0 : 1;                    \
+  }
+
+BULK_COMPARATOR(compareBulkRef, dybase_object_ref_type)
+BULK_COMPARATOR(compareBulkBool, dybase_bool_type)
+BULK_COMPARATOR(compareBulkInt, dybase_int_type)
+BULK_COMPARATOR(compareBulkLong, dybase_long_type)
+BULK_COMPARATOR(compareBulkReal, dybase_real_type)
+BULK_COMPARATOR(compareBulkStr, dybase_chars_type)
+
+void dbBtreePage::collect(dbDatabase *db, oid_t pageId, int type, int height,
+                          dbBuffer<dbBtreeBulkItem> &items,
+                          dbBuffer<char> &chars) {
+  dbBtreePage *pg     = (dbBtreePage *)db->get(pageId);
+  int          i, n   = pg->nItems;
+  bool         strKey = type == dybase_chars_type || type == dybase_bytes_type;
+  if (--height != 0) {
+    for (i = 0; i <= n; i++) {
+      collect(db, strKey ? pg->strKey[i].oid : pg->record[maxItems - i - 1],
+              type, height, items, chars);
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      dbBtreeBulkItem *it = items.append(1);
+      it->seq             = 0;
+      if (strKey) {
+        // chars may be reallocated: keep the offset, caller rebases it
+        length_t offs = chars.size();
+        it->oid       = pg->strKey[i].oid;
+        it->keyLen    = pg->strKey[i].size;
+        memcpy(chars.append(int(it->keyLen)), &pg->charKey[pg->strKey[i].offs],
+               it->keyLen);
+        it->charKey = (char *)(size_t)offs;
+      } else {
+        it->oid     = pg->record[maxItems - i - 1];
+        it->keyLen  = dbSizeofType[type];
+        it->longKey = 0;
+        memcpy(&it->boolKey, &pg->charKey[i * dbSizeofType[type]], it->keyLen);
+      }
+    }
+  }
+  db->pool.unfix(pg);
+}
+
+// writes one page holding n items (children for inner pages), returns its oid
+oid_t dbBtreePage::build(dbDatabase *db, int type, bool leaf,
+                         dbBtreeBulkItem *items, int n) {
+  oid_t        pageId = db->allocatePage();
+  dbBtreePage *pg     = (dbBtreePage *)db->put(pageId);
+  int          nKeys  = leaf ? n : n - 1;
+  if (type == dybase_chars_type || type == dybase_bytes_type) {
+    length_t size = 0;
+    for (int i = 0; i < n; i++) {
+      pg->strKey[i].oid = items[i].oid;
+      if (i < nKeys) {
+        size += items[i].keyLen * sizeof(char);
+        pg->strKey[i].offs = db_nat2(sizeof(pg->charKey) - size);
+        pg->strKey[i].size = db_nat2(items[i].keyLen);
+        memcpy(&pg->charKey[pg->strKey[i].offs], items[i].charKey,
+               items[i].keyLen);
+      } else {
+        pg->strKey[i].offs = 0;
+        pg->strKey[i].size = 0;
+      }
+    }
+    pg->size = db_nat4(size);
+  } else {
+    int keySize = dbSizeofType[type];
+    for (int i = 0; i < n; i++) {
+      pg->record[maxItems - i - 1] = items[i].oid;
+    }
+    for (int i = 0; i < nKeys; i++) {
+      memcpy(&pg->charKey[i * keySize], &items[i].boolKey, keySize);
+    }
+    pg->size = 0;
+  }
+  pg->nItems = nKeys;
+  db->pool.unfix(pg);
+  return pageId;
+}
+
+// splits a level of n items into pages filled up to fillFactor percent,
+// returns the number of pages, their item counts are stored in groups
+static int groupBulkLevel(int type, bool leaf, dbBtreeBulkItem *items, int n,
+                          int fillFactor, dbBuffer<int> &groups) {
+  if (type == dybase_chars_type || type == dybase_bytes_type) {
+    const length_t capacity = dbPageSize - 8;
+    const length_t target   = capacity * fillFactor / 100;
+    const int      minItems = leaf ? 1 : 2;
+    const length_t strSize  = sizeof(dbBtreePage::str);
+    for (int i = 0; i < n;) {
+      length_t keys = 0;
+      int      cnt  = 0;
+      while (i < n) {
+        // the last child of an inner page has no key
+        length_t need = keys + (cnt + 1) * strSize +
+                        (leaf ? items[i].keyLen * sizeof(char) : 0);
+        if (cnt != 0 && need > capacity) { break; }
+        if (cnt >= minItems && need > target) { break; }
+        keys += items[i].keyLen * sizeof(char);
+        cnt += 1;
+        i += 1;
+      }
+      groups.add(cnt);
+    }
+    int m = int(groups.size());
+    if (!leaf && m > 1 && groups.base()[m - 1] == 1) {
+      int *g = groups.base();
+      if (g[m - 2] > 2) {
+        g[m - 2] -= 1;
+        g[m - 1] += 1;
+      } else {
+        // two children and a single one: merge them if the keys fit
+        length_t need = items[n - 3].keyLen + items[n - 2].keyLen + 3 * strSize;
+        if (need <= capacity) {
+          g[m - 2] += 1;
+          return m - 1;
+        }
+      }
+    }
+    return m;
+  } else {
+    const int max = int((dbPageSize - 8) / (sizeof(oid_t) + dbSizeofType[type]));
+    int       target = max * fillFactor / 100;
+    if (target < 3) { target = 3; }
+    // even distribution keeps inner pages at two children at least
+    int pages = (n + target - 1) / target;
+    int base = n / pages, extra = n % pages;
+    for (int i = 0; i < pages; i++) {
+      groups.add(base + (i < extra ? 1 : 0));
+    }
+    return pages;
+  }
+}
+
+int dbBtree::bulkInsert(dbDatabase *db, oid_t treeId, int keyType,
+                        dybase_bulk_item_t *input, int nInput,
+                        int fillFactor) {
+  dbCriticalSection cs(db->mutex);
+  if (!db->opened) {
+    db->handleError(dybase_not_opened, "Database not opened");
+    return 0;
+  }
+  dbGetTie treeTie;
+  dbBtree *tree   = (dbBtree *)db->getObject(treeTie, treeId);
+  int      type   = tree->type;
+  bool     unique = tree->unique != 0;
+  oid_t    rootId = tree->root;
+  int      height = tree->height;
+  bool     strKey = type == dybase_chars_type || type == dybase_bytes_type;
+
+  if (nInput > 0 && keyType != type) {
+    db->handleError(dybase_bad_key_type,
+                    "Type of the key doesn't match index type");
+    return 0;
+  }
+  for (int i = 0; i < nInput; i++) {
+    if (strKey && length_t(input[i].key_size) > dbBtreePage::dbMaxKeyLen) {
+      db->handleError(dybase_bad_key_type, "Size of string key is too large");
+      return 0;
+    }
+  }
+  if (fillFactor <= 0 || fillFactor > 100) { fillFactor = 100; }
+
+  // existing keys take part in the rebuild, they are already unique
+  dbBuffer<dbBtreeBulkItem> items;
+  dbBuffer<char>            chars;
+  if (rootId != 0) {
+    dbBtreePage::collect(db, rootId, type, height, items, chars);
+    dbBtreePage::purge(db, rootId, type, height);
+  }
+  int nOld = int(items.size());
+  if (nOld + nInput == 0) { return 0; }
+
+  dbBtreeBulkItem *it = items.append(nInput);
+  for (int i = 0; i < nInput; i++, it++) {
+    it->oid = input[i].obj;
+    it->seq = nOld + i;
+    if (strKey) {
+      it->keyLen  = input[i].key_size;
+      it->charKey = (char *)input[i].key;
+    } else {
+      it->keyLen  = dbSizeofType[type];
+      it->longKey = 0;
+      memcpy(&it->boolKey, input[i].key, it->keyLen);
+    }
+  }
+  it = items.base();
+  for (int i = 0; i < nOld; i++) {
+    it[i].seq = i;
+    if (strKey) { it[i].charKey = chars.base() + (size_t)it[i].charKey; }
+  }
+
+  int (*comparator)(void const *, void const *) = NULL;
+  switch (type) {
+  case dybase_object_ref_type:
+  case dybase_array_ref_type:
+  case dybase_index_ref_type: comparator = compareBulkRef; break;
+  case dybase_bool_type: comparator = compareBulkBool; break;
+  case dybase_int_type: comparator = compareBulkInt; break;
+  case dybase_date_type:
+  case dybase_long_type: comparator = compareBulkLong; break;
+  case dybase_real_type: comparator = compareBulkReal; break;
+  default: comparator = compareBulkStr; break;
+  }
+  int n = nOld + nInput;
+  qsort(it, n, sizeof(dbBtreeBulkItem), comparator);
+
+  // like repeated insert() without replace: the first (oldest) key wins
+  int inserted = nInput;
+  if (unique) {
+    int j = 0;
+    for (int i = 0; i < n; i++) {
+      if (j == 0 || compareBulkKeys(type, &it[j - 1], &it[i]) != 0) {
+        it[j++] = it[i];
+      }
+    }
+    inserted = j - nOld;
+    n        = j;
+  }
+
+  bool leaf = true;
+  height    = 0;
+  while (true) {
+    dbBuffer<int> groups;
+    int           nPages = groupBulkLevel(type, leaf, it, n, fillFactor, groups);
+    int *         g      = groups.base();
+    height += 1;
+    // the item describing a page is its oid and its largest key,
+    // written in place since pages never outnumber their items
+    for (int p = 0, i = 0; p < nPages; p++) {
+      oid_t pageId = dbBtreePage::build(db, type, leaf, &it[i], g[p]);
+      i += g[p];
+      it[p]     = it[i - 1];
+      it[p].oid = pageId;
+    }
+    n    = nPages;
+    leaf = false;
+    if (n == 1) { break; }
+  }
+
+  dbPutTie tie;
+  dbBtree *t = (dbBtree *)db->putObject(tie, treeId);
+  t->root    = it[0].oid;
+  t->height  = height;
+  return inserted;
+}
+
 int dbBtreeIterator::compare(void *key, int keyType, dbBtreePage *pg, int pos) {
   switch (keyType) {
   case dybase_bool_type: return *(db_int1 *)key - pg->boolKey[pos];
@@ -1267,6 +1605,7 @@ dbBtreeIterator::dbBtreeIterator(dbDatabase *db, oid_t treeId, int type,
   dbGetTie tie;
   dbBtree *tree = (dbBtree *)db->getObject(tie, treeId);
   sp            = 0;
+  keyBuf        = NULL;
 
   if (tree->height == 0) { return; }
 
@@ -1346,6 +1685,19 @@ dbBtreeIterator::dbBtreeIterator(dbDatabase *db, oid_t treeId, int type,
     }
   }
 
+  if ((type == dybase_chars_type || type == dybase_bytes_type) &&
+      (from != NULL || till != NULL)) {
+    keyBuf = new byte[fromLength + tillLength + 1];
+    if (from != NULL) {
+      memcpy(keyBuf, from, fromLength);
+      this->from = keyBuf;
+    }
+    if (till != NULL) {
+      memcpy(keyBuf + fromLength, till, tillLength);
+      this->till = keyBuf + fromLength;
+    }
+  }
+
   int pageId = tree->root;
 
   if (type == dybase_chars_type || type == dybase_bytes_type) {
@@ -1599,6 +1951,8 @@ dbBtreeIterator::dbBtreeIterator(dbDatabase *db, oid_t treeId, int type,
   }
 }
 
+dbBtreeIterator::~dbBtreeIterator() { delete[] keyBuf; }
+
 oid_t dbBtreeIterator::next() {
   if (sp == 0) { return 0; }
   int          pos = posStack[sp - 1];
@@ -1610,6 +1964,56 @@ oid_t dbBtreeIterator::next() {
   return oid;
 }
 
+oid_t dbBtreeIterator::next(void *key, length_t &keyLength) {
+  if (sp == 0) { return 0; }
+  int          pos = posStack[sp - 1];
+  dbBtreePage *pg  = (dbBtreePage *)db->get(pageStack[sp - 1]);
+  oid_t        oid;
+  if (type == dybase_chars_type || type == dybase_bytes_type) {
+    oid       = pg->strKey[pos].oid;
+    keyLength = pg->strKey[pos].size;
+    memcpy(key, &pg->charKey[pg->strKey[pos].offs], keyLength);
+  } else {
+    oid = pg->record[dbBtreePage::maxItems - 1 - pos];
+    switch (type) {
+    case dybase_bool_type: keyLength = sizeof(db_int1); break;
+    case dybase_date_type:
+    case dybase_long_type:
+    case dybase_real_type: keyLength = sizeof(db_int8); break;
+    default: keyLength = sizeof(db_int4);
+    }
+    memcpy(key, (byte *)pg->record + pos * keyLength, keyLength);
+  }
+  gotoNextItem(pg, pos);
+  return oid;
+}
+
+int dbBtreeIterator::next(oid_t *oids, int n) {
+  int i = 0;
+  while (i < n && sp != 0) {
+    oids[i++] = next();
+  }
+  if (sp > 1) { prefetchLeaves(); }
+  return i;
+}
+
+void dbBtreeIterator::prefetchLeaves() {
+  // siblings of the current leaf page following in the iteration order
+  dbBtreePage *pg  = (dbBtreePage *)db->get(pageStack[sp - 2]);
+  int          pos = posStack[sp - 2];
+  oid_t        leaves[ReadAheadPages];
+  int          n = 0;
+  while (n < ReadAheadPages) {
+    pos += ascent ? 1 : -1;
+    if (pos < 0 || pos > (int)pg->nItems) { break; }
+    leaves[n++] = (type == dybase_chars_type || type == dybase_bytes_type)
+                      ? pg->strKey[pos].oid
+                      : pg->record[dbBtreePage::maxItems - 1 - pos];
+  }
+  db->pool.unfix(pg);
+  if (n != 0) { db->prefetch(leaves, n); }
+}
+
 void dbBtreeIterator::gotoNextItem(dbBtreePage *pg, int pos) {
   oid_t pageId;
   if (type == dybase_chars_type || type == dybase_bytes_type) {
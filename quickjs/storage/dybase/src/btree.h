@@ -25,6 +25,21 @@ public:
   dbBuffer<oid_t> selection;
 };
 
+// key/oid pair used to build B-tree pages bottom-up (see dbBtree::bulkInsert)
+struct dbBtreeBulkItem {
+  oid_t    oid; // record oid in leaves, child page oid in inner pages
+  length_t keyLen;
+  length_t seq; // input order, keeps sorting stable
+  union {
+    db_int1  boolKey;
+    db_int4  intKey;
+    db_int8  longKey;
+    oid_t    refKey;
+    db_real8 realKey;
+    char *   charKey;
+  };
+};
+
 class dbBtreePage {
 public:
   db_nat4 nItems;
@@ -74,6 +89,11 @@ public:
 
   static void purge(dbDatabase *db, oid_t pageId, int type, int height);
 
+  static void  collect(dbDatabase *db, oid_t pageId, int type, int height,
+                       dbBuffer<dbBtreeBulkItem> &items, dbBuffer<char> &chars);
+  static oid_t build(dbDatabase *db, int type, bool leaf,
+                     dbBtreeBulkItem *items, int n);
+
   int  insertStrKey(dbDatabase *db, int r, item &ins, int height);
   int  replaceStrKey(dbDatabase *db, int r, item &ins, int height);
   int  removeStrKey(int r);
@@ -101,6 +121,9 @@ protected:
 
   static void _drop(dbDatabase *db, oid_t treeId);
   static void _clear(dbDatabase *db, oid_t treeId);
+  static bool _remove(dbDatabase *db, oid_t treeId, void *key, int keyType,
+                      length_t keySize, oid_t oid);
+  static void removeGarbage(dbDatabase *db, oid_t treeId);
 
 public:
   enum OperationEffect { done, overflow, underflow, duplicate, not_found };
@@ -113,6 +136,9 @@ public:
                       length_t keySize, oid_t oid);
   static void  drop(dbDatabase *db, oid_t treeId);
   static void  clear(dbDatabase *db, oid_t treeId);
+  static int   bulkInsert(dbDatabase *db, oid_t treeId, int keyType,
+                          dybase_bulk_item_t *items, int nItems,
+                          int fillFactor);
   static bool  is_unique(dbDatabase *db, oid_t treeId);
   static int   get_type(dbDatabase *db, oid_t treeId);
 
@@ -126,15 +152,25 @@ public:
   dbBtreeIterator(dbDatabase *db, oid_t treeId, int keyType, void *from,
                   length_t fromLength, int fromInclusion, void *till,
                   length_t tillLength, int tillInclusion, bool ascent);
+  ~dbBtreeIterator();
   oid_t next();
+  int   next(oid_t *oids, int n);
+
+  /**
+   * Get next object and its key
+   * @param key buffer of dbBtreePage::dbMaxKeyLen bytes to receive the key
+   * @param keyLength receives length of the key in bytes
+   */
+  oid_t next(void *key, length_t &keyLength);
 
 private:
   void       gotoNextItem(dbBtreePage *pg, int pos);
+  void       prefetchLeaves();
   static int compare(void *key, int keyType, dbBtreePage *pg, int pos);
   static int compareStr(void *key, length_t keyLength, dbBtreePage *pg,
                         int pos);
 
-  enum { MaxTreeHeight = 8 };
+  enum { MaxTreeHeight = 8, ReadAheadPages = 4 };
 
   dbDatabase *db;
   int         height;
@@ -150,6 +186,7 @@ private:
   } from_val, till_val;
   void *   from;
   void *   till;
+  byte *   keyBuf; // copy of string boundaries, caller may free them
   length_t fromLength;
   length_t tillLength;
   int      fromInclusion;
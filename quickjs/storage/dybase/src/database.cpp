@@ -31,8 +31,29 @@ void dbDatabase::throwException(int error, char const *msg) {
 
 bool dbDatabase::open(const char *name, int openAttr) {
   dbCriticalSection cs(mutex);
-  int               rc;
-  opened = false;
+  shared     = NULL;
+  indexStale = false;
+  snapshotMoved = false;
+  mappedPool = (openAttr & dbFile::mmap_read) != 0;
+  if (!openFile(name, openAttr)) {
+    if (shared != NULL) {
+      shared->detach(this);
+      shared = NULL;
+    }
+    return false;
+  }
+  if (shared != NULL && accessType != dbReadOnly) {
+    dbCriticalSection cs(dbSharedFile::mutex);
+    shared->header    = *header;
+    shared->published = true;
+  }
+  return true;
+}
+
+bool dbDatabase::openFile(const char *name, int openAttr) {
+  int  rc;
+  bool snapshot = false;
+  opened        = false;
 
   length_t indexSize =
       initIndexSize < dbFirstUserId ? length_t(dbFirstUserId) : initIndexSize;
@@ -50,6 +71,9 @@ bool dbDatabase::open(const char *name, int openAttr) {
   gcThreshold                       = 0;
   allocatedDelta                    = 0;
   gcDone                            = false;
+  gcActive                          = false;
+  compactPos                        = 0;
+  memset(&gcStats, 0, sizeof gcStats);
   modified                          = false;
 
   if (accessType == dbReadOnly) { openAttr |= dbFile::read_only; }
@@ -146,13 +170,40 @@ bool dbDatabase::open(const char *name, int openAttr) {
       handleError(dybase_open_error, "Failed to create database file");
       return false;
     }
+    shared = dbSharedFile::attach(name, this, snapshot);
+    if (shared == NULL) {
+      delete file;
+      handleError(dybase_open_error, "Database is already opened for writing");
+      return false;
+    }
+    // apply transactions committed to the log but not checkpointed
+    dbWriteAheadLog pendingLog;
+    if (!snapshot && pendingLog.open(name, dbFile::read_only) == dbFile::ok &&
+        pendingLog.size() != 0) {
+      if (accessType == dbReadOnly) {
+        delete file;
+        handleError(dybase_open_error,
+                    "Can not apply write-ahead log in read only mode");
+        return false;
+      }
+      if (pendingLog.replay(file) != dbFile::ok) {
+        delete file;
+        handleError(dybase_open_error, "Failed to apply write-ahead log");
+        return false;
+      }
+      TRACE_MSG(("Write-ahead log applied\n"));
+    }
+    pendingLog.close(!snapshot && accessType != dbReadOnly);
   }
-  memset(header, 0, sizeof(dbHeader));
-  rc = file->read(0, header, dbPageSize);
-  if (rc != dbFile::ok && rc != dbFile::eof) {
-    delete file;
-    handleError(dybase_open_error, "Failed to read file header");
-    return false;
+  if (!snapshot) {
+    // header of the snapshot is published by the writer
+    memset(header, 0, sizeof(dbHeader));
+    rc = file->read(0, header, dbPageSize);
+    if (rc != dbFile::ok && rc != dbFile::eof) {
+      delete file;
+      handleError(dybase_open_error, "Failed to read file header");
+      return false;
+    }
   }
 
   if ((unsigned)header->curr > 1) {
@@ -184,6 +235,8 @@ bool dbDatabase::open(const char *name, int openAttr) {
     header->root[1].classDescList = 0;
     header->root[1].rootObject    = 0;
     used += indexSize * sizeof(offs_t);
+    header->extMagic   = dbHeader::dbHeaderExtMagic;
+    header->catalog[0] = header->catalog[1] = 0;
 
     header->root[0].shadowIndex     = header->root[1].index;
     header->root[1].shadowIndex     = header->root[0].index;
@@ -230,7 +283,7 @@ bool dbDatabase::open(const char *name, int openAttr) {
     header->root[0].size = used;
     header->root[1].size = used;
     currIndexSize        = dbFirstUserId;
-    if (!pool.open(file, used)) {
+    if (!pool.open(file, used, (openAttr & dbFile::mmap_read) != 0)) {
       delete file;
       handleError(dybase_open_error, "Failed to allocate page pool");
       return false;
@@ -271,18 +324,25 @@ bool dbDatabase::open(const char *name, int openAttr) {
   } else {
     int curr   = header->curr;
     this->curr = curr;
+    header->checkExtension();
+    if (accessType == dbReadOnly) {
+      // committed state is never modified by the writer of shared file
+      header->root[1 - curr]    = header->root[curr];
+      header->catalog[1 - curr] = header->catalog[curr];
+    }
     if (header->root[curr].indexSize != header->root[curr].shadowIndexSize) {
       delete file;
       handleError(dybase_open_error, "Header of database file is corrupted");
       return false;
     }
 
-    if (rc != dbFile::ok) {
+    if (!snapshot && rc != dbFile::ok) {
       delete file;
       handleError(dybase_open_error, "Failed to read object index");
       return false;
     }
-    pool.open(file, header->root[curr].size);
+    pool.open(file, header->root[curr].size,
+              (openAttr & dbFile::mmap_read) != 0);
     if (header->dirty) {
       TRACE_MSG(("Database was not normally closed: start recovery\n"));
       if (accessType == dbReadOnly) {
@@ -302,6 +362,7 @@ bool dbDatabase::open(const char *name, int openAttr) {
       header->root[1 - curr].bitmapEnd       = header->root[curr].bitmapEnd;
       header->root[1 - curr].rootObject      = header->root[curr].rootObject;
       header->root[1 - curr].classDescList   = header->root[curr].classDescList;
+      header->catalog[1 - curr]              = header->catalog[curr];
 
       pool.copy(
           header->root[1 - curr].index, header->root[curr].index,
@@ -312,6 +373,19 @@ bool dbDatabase::open(const char *name, int openAttr) {
   }
   committedIndexSize = currIndexSize;
 
+  if ((openAttr & dbFile::wal) && accessType != dbReadOnly && *name != '@') {
+    log = new dbWriteAheadLog;
+    if (log->open(name, openAttr) != dbFile::ok) {
+      delete log;
+      log = NULL;
+      pool.close();
+      delete file;
+      handleError(dybase_open_error, "Failed to create write-ahead log");
+      return false;
+    }
+    pool.log = log;
+  }
+
   loadScheme();
   opened = true;
   return true;
@@ -333,13 +407,7 @@ void dbDatabase::loadScheme() {
   *cpp = NULL;
 }
 
-void dbDatabase::close() {
-  dbCriticalSection cs(mutex);
-  if (!opened) {
-    handleError(dybase_not_opened, "Database not opened");
-    return;
-  }
-  if (modified) { commitTransaction(); }
+void dbDatabase::freeScheme() {
   dbClassDescriptor *desc, *next;
   for (desc = classDescList; desc != NULL; desc = next) {
     next = desc->next;
@@ -348,6 +416,22 @@ void dbDatabase::close() {
   classDescList = NULL;
   classOidHash.clear();
   classSignatureHash.clear();
+}
+
+void dbDatabase::close() {
+  dbCriticalSection cs(mutex);
+  if (!opened) {
+    handleError(dybase_not_opened, "Database not opened");
+    return;
+  }
+  if (modified) { commitTransaction(); }
+  if (indexStale) { syncIndex(); }
+  if (gcActive) {
+    delete[] greyBitmap;
+    delete[] blackBitmap;
+    gcActive = false;
+  }
+  freeScheme();
 
   opened = false;
   if (header->dirty) {
@@ -362,9 +446,22 @@ void dbDatabase::close() {
       throwException(dybase_file_error, "Failed to write header to the disk");
     }
   }
+  if (log != NULL) {
+    // database file is consistent now: log is not needed any more
+    if (file->flush() != dbFile::ok) {
+      throwException(dybase_file_error, "Failed to flush changes to the disk");
+    }
+    log->close(true);
+    delete log;
+    log = NULL;
+  }
   pool.close();
   file->close();
   delete file;
+  if (shared != NULL) {
+    shared->detach(this);
+    shared = NULL;
+  }
 }
 
 dbObject *dbDatabase::putObject(dbPutTie &tie, oid_t oid) {
@@ -404,6 +501,13 @@ void dbDatabase::setRoot(oid_t oid) {
   modified                          = true;
 }
 
+oid_t dbDatabase::getCatalog() { return header->catalog[1 - curr]; }
+
+void dbDatabase::setCatalog(oid_t oid) {
+  header->catalog[1 - curr] = oid;
+  modified                  = true;
+}
+
 dbLoadHandle *dbDatabase::getLoadHandle(oid_t oid) {
   dbCriticalSection cs(mutex);
   if (!opened) {
@@ -422,34 +526,67 @@ dbLoadHandle *dbDatabase::getLoadHandle(oid_t oid) {
   return hnd;
 }
 
-void dbDatabase::storeObject(dbStoreHandle *handle) {
-  dbCriticalSection cs(mutex);
-  if (!opened) {
-    handleError(dybase_not_opened, "Database not opened");
-    return;
-  }
-  dbObject *         obj  = (dbObject *)handle->body.base();
-  dbClassDescriptor *desc = (dbClassDescriptor *)classSignatureHash.get(
-      handle->signature.base(), handle->signature.size());
+dbClassDescriptor *dbDatabase::findClassDescriptor(char *   signature,
+                                                   length_t size) {
+  dbClassDescriptor *desc =
+      (dbClassDescriptor *)classSignatureHash.get(signature, size);
   if (desc == NULL) {
-    dbClass *cls =
-        dbClass::create(handle->signature.base(), handle->signature.size());
-    cls->next = header->root[1 - curr].classDescList;
-    desc      = new dbClassDescriptor(cls, allocateObject(cls));
+    dbClass *cls = dbClass::create(signature, size);
+    cls->next    = header->root[1 - curr].classDescList;
+    desc         = new dbClassDescriptor(cls, allocateObject(cls));
     header->root[1 - curr].classDescList = desc->oid;
     classOidHash.put(&desc->oid, sizeof(desc->oid), desc);
     classSignatureHash.put(cls->signature, desc->signatureSize, desc);
     desc->next    = classDescList;
     classDescList = desc;
   }
+  return desc;
+}
+
+oid_t dbDatabase::registerClass(char const *className,
+                                char const *const *fieldNames, int nFields) {
+  dbCriticalSection cs(mutex);
+  if (!opened) {
+    handleError(dybase_not_opened, "Database not opened");
+    return 0;
+  }
+  dbSmallBuffer<char, 256> signature;
+  strcpy(signature.append((int)strlen(className) + 1), className);
+  for (int i = 0; i < nFields; i++) {
+    strcpy(signature.append((int)strlen(fieldNames[i]) + 1), fieldNames[i]);
+  }
+  return findClassDescriptor(signature.base(), signature.size())->oid;
+}
+
+void dbDatabase::storeObject(dbStoreHandle *handle) {
+  dbCriticalSection cs(mutex);
+  if (!opened) {
+    handleError(dybase_not_opened, "Database not opened");
+    return;
+  }
+  dbObject *         obj = (dbObject *)handle->body.base();
+  dbClassDescriptor *desc;
+  if (handle->cid != 0) {
+    desc = (dbClassDescriptor *)classOidHash.get(&handle->cid,
+                                                 sizeof(handle->cid));
+    if (desc == NULL) {
+      handleError(dybase_bad_key_type, "Bad object descriptor");
+      return;
+    }
+  } else {
+    desc = findClassDescriptor(handle->signature.base(),
+                               handle->signature.size());
+  }
   obj->size  = handle->body.size();
   obj->cid   = desc->oid;
   oid_t  oid = handle->oid;
   offs_t pos = getPos(oid);
   if (pos == 0) {
+    markAllocated(oid);
     pos = allocate(obj->size);
     setPos(oid, pos | dbModifiedFlag);
   } else {
+    beforeUpdate(oid);
     int      offs    = (int)pos & (dbPageSize - 1);
     byte *   p       = pool.get(pos - offs);
     length_t oldSize = ((dbObject *)(p + (offs & ~dbFlagsMask)))->size;
@@ -492,6 +629,7 @@ void dbDatabase::freeObject(oid_t oid) {
     handleError(dybase_not_opened, "Database not opened");
     return;
   }
+  beforeUpdate(oid);
   dbObject hdr;
   getHeader(hdr, oid);
   offs_t pos = getPos(oid);
@@ -547,6 +685,7 @@ inline void dbDatabase::commitLocation() {
 }
 
 void dbDatabase::setDirty() {
+  if (indexStale) { syncIndex(); }
   modified = true;
   if (!header->dirty) {
     header->dirty = true;
@@ -611,7 +750,7 @@ offs_t dbDatabase::allocate(length_t size, oid_t oid) {
   size = DOALIGN(size, dbAllocationQuantum);
   allocatedDelta += size;
   if (gcThreshold != 0 && allocatedDelta > gcThreshold && !gcDone) {
-    startGC();
+    fullGC();
   }
 
   int            objBitSize = size >> dbAllocationQuantumBits;
@@ -903,7 +1042,7 @@ offs_t dbDatabase::allocate(length_t size, oid_t oid) {
     }
     if (gcThreshold != 0 && !gcDone) {
       allocatedDelta -= size;
-      startGC();
+      fullGC();
       currRBitmapPage = currPBitmapPage = dbBitmapId;
       currRBitmapOffs = currPBitmapOffs = 0;
       return allocate(size, oid);
@@ -964,81 +1103,258 @@ void dbDatabase::free(offs_t pos, length_t size) {
 void dbDatabase::gc() {
   dbCriticalSection cs(mutex);
   if (gcDone) { return; }
+  fullGC();
+}
+
+void dbDatabase::fullGC() {
+  if (!gcActive) { startGC(); }
+  markGC(0);
+  gcDone = true;
+  sweepGC();
+}
+
+bool dbDatabase::startIncrementalGC(long threshold) {
+  dbCriticalSection cs(mutex);
+  if (!opened || gcActive || accessType == dbReadOnly ||
+      (threshold >= 0 && allocatedDelta <= threshold)) {
+    return false;
+  }
   startGC();
+  return true;
+}
+
+void dbDatabase::markRoot(oid_t oid) {
+  dbCriticalSection cs(mutex);
+  if (gcActive) { markOid(oid); }
+}
+
+bool dbDatabase::gcStep(int maxObjects) {
+  dbCriticalSection cs(mutex);
+  if (!gcActive) { return true; }
+  if (!markGC(maxObjects)) { return false; }
+  sweepGC();
+  return true;
+}
+
+void dbDatabase::setWeakIndex(oid_t treeId) {
+  dbCriticalSection cs(mutex);
+  if (isWeakIndex(treeId)) { return; }
+  if (nWeakIndices == weakIndicesSize) {
+    weakIndicesSize = weakIndicesSize ? weakIndicesSize * 2 : 8;
+    oid_t *newIndices = new oid_t[weakIndicesSize];
+    memcpy(newIndices, weakIndices, nWeakIndices * sizeof(oid_t));
+    delete[] weakIndices;
+    weakIndices = newIndices;
+  }
+  weakIndices[nWeakIndices++] = treeId;
+}
+
+void dbDatabase::getGcStats(dybase_gc_stats_t *stats) {
+  dbCriticalSection cs(mutex);
+  *stats           = gcStats;
+  stats->active    = gcActive;
+  stats->file_size = opened ? header->root[1 - curr].size : 0;
 }
 
 void dbDatabase::startGC() {
-  int bitmapSize =
-      (int)(header->root[curr].size >> (dbAllocationQuantumBits + 5)) + 1;
-  bool   existsNotMarkedObjects;
-  offs_t pos;
-  int    i, j;
-
-  // mark
-  greyBitmap  = new db_int4[bitmapSize];
-  blackBitmap = new db_int4[bitmapSize];
+  gcIndexSize    = oid_t(currIndexSize);
+  int bitmapSize = int(gcIndexSize >> 5) + 1;
+  greyBitmap     = new db_int4[bitmapSize];
+  blackBitmap    = new db_int4[bitmapSize];
   memset(greyBitmap, 0, bitmapSize * sizeof(db_int4));
   memset(blackBitmap, 0, bitmapSize * sizeof(db_int4));
-  int rootOid = header->root[curr].rootObject;
-  if (rootOid != 0) {
+  gcScanPos      = 0;
+  gcRescan       = false;
+  gcActive       = true;
+  gcStats.marked = 0;
+  markOid(header->root[1 - curr].rootObject);
+  markOid(header->catalog[1 - curr]);
+}
+
+void dbDatabase::scanObject(oid_t oid) {
+  greyBitmap[oid >> 5] &= ~(1 << (oid & 31));
+  blackBitmap[oid >> 5] |= 1 << (oid & 31);
+  offs_t pos = getPos(oid);
+  if (pos == 0 || (pos & (dbFreeHandleFlag | dbPageObjectFlag))) { return; }
+  gcStats.marked += 1;
+  pos &= ~dbFlagsMask;
+  int       offs = (int)pos & (dbPageSize - 1);
+  byte *    pg   = pool.get(pos - offs);
+  dbObject *obj  = (dbObject *)(pg + offs);
+  if (obj->cid == dbBtreeId) {
+    if (!isWeakIndex(oid)) { ((dbBtree *)obj)->markTree(this); }
+  } else if (obj->cid >= dbFirstUserId) {
     dbGetTie tie;
-    markOid(rootOid);
-    do {
-      existsNotMarkedObjects = false;
-      for (i = 0; i < bitmapSize; i++) {
-        if (greyBitmap[i] != 0) {
-          existsNotMarkedObjects = true;
-          for (j = 0; j < 32; j++) {
-            if ((greyBitmap[i] & (1 << j)) != 0) {
-              pos = (((offs_t)i << 5) + j) << dbAllocationQuantumBits;
-              greyBitmap[i] &= ~(1 << j);
-              blackBitmap[i] |= 1 << j;
-              int       offs = (int)pos & (dbPageSize - 1);
-              byte *    pg   = pool.get(pos - offs);
-              dbObject *obj  = (dbObject *)(pg + offs);
-              if (obj->cid == dbBtreeId) {
-                ((dbBtree *)obj)->markTree(this);
-              } else if (obj->cid >= dbFirstUserId) {
-                markOid(obj->cid);
-                tie.set(pool, pos);
-                markObject((dbObject *)tie.get());
-              }
-              pool.unfix(pg);
-            }
-          }
-        }
-      }
-    } while (existsNotMarkedObjects);
+    markOid(obj->cid);
+    tie.set(pool, pos);
+    markObject((dbObject *)tie.get());
   }
+  pool.unfix(pg);
+}
 
-  // sweep
-  gcDone = true;
-  for (i = dbFirstUserId, j = committedIndexSize; i < j; i++) {
-    pos = getGCPos(i);
-    if (((int)pos & (dbPageObjectFlag | dbFreeHandleFlag)) == 0) {
-      unsigned bit = (unsigned)(pos >> dbAllocationQuantumBits);
-      if ((blackBitmap[bit >> 5] & (1 << (bit & 31))) == 0) {
-        // object is not accessible
-        assert(getPos(i) == pos);
-        int       offs = (int)pos & (dbPageSize - 1);
-        byte *    pg   = pool.get(pos - offs);
-        dbObject *obj  = (dbObject *)(pg + offs);
-        if (obj->cid == dbBtreeId) {
-          dbBtree::_drop(this, i);
-        } else if (obj->cid >= dbFirstUserId) {
-          freeId(i);
-          cloneBitmap(pos, obj->size);
+bool dbDatabase::markGC(int maxObjects) {
+  int   n   = 0;
+  oid_t end = (gcIndexSize + 31) >> 5;
+  while (true) {
+    for (oid_t i = gcScanPos >> 5; i < end; i++) {
+      while (greyBitmap[i] != 0) {
+        int j = 0;
+        while ((greyBitmap[i] & (1 << j)) == 0) {
+          j += 1;
         }
-        pool.unfix(pg);
+        oid_t oid = (i << 5) + j;
+        gcScanPos = oid + 1;
+        scanObject(oid);
+        if (maxObjects > 0 && ++n >= maxObjects) { return false; }
       }
+      gcScanPos = (i + 1) << 5;
     }
+    if (!gcRescan) { return true; }
+    // objects below scan position were marked by write barrier
+    gcRescan  = false;
+    gcScanPos = 0;
   }
+}
 
+void dbDatabase::sweepGC() {
+  // entries of weak indices referencing objects freed below are removed,
+  // removal may allocate pages so no GC is started meanwhile
+  bool done = gcDone;
+  gcDone    = true;
+  for (int i = 0; i < nWeakIndices; i++) {
+    oid_t treeId = weakIndices[i];
+    if (treeId >= gcIndexSize || isBlack(treeId)) {
+      dbBtree::removeGarbage(this, treeId);
+    }
+  }
+  gcDone = done;
+  for (oid_t i = dbFirstUserId; i < gcIndexSize; i++) {
+    if (isBlack(i)) { continue; }
+    offs_t pos = getPos(i);
+    // objects created or updated by the current transaction are not
+    // collected: they may be referenced by objects which are not stored yet
+    if (pos == 0 ||
+        (pos & (dbPageObjectFlag | dbFreeHandleFlag | dbModifiedFlag))) {
+      continue;
+    }
+    // object is not accessible
+    int       offs = (int)pos & (dbPageSize - 1);
+    byte *    pg   = pool.get(pos - offs);
+    dbObject *obj  = (dbObject *)(pg + offs);
+    if (obj->cid == dbBtreeId) {
+      gcStats.freed_objects += 1;
+      gcStats.freed_bytes += sizeof(dbBtree);
+      dbBtree::_drop(this, i);
+    } else if (obj->cid >= dbFirstUserId) {
+      gcStats.freed_objects += 1;
+      gcStats.freed_bytes += obj->size;
+      freeId(i);
+      cloneBitmap(pos, obj->size);
+    }
+    pool.unfix(pg);
+  }
   delete[] greyBitmap;
   delete[] blackBitmap;
+  gcActive = false;
+  gcStats.cycles += 1;
   allocatedDelta = 0;
 }
 
+int dbDatabase::compact(int maxObjects) {
+  int n = 0;
+  {
+    dbCriticalSection cs(mutex);
+    if (!opened || accessType == dbReadOnly) { return 0; }
+    truncate();
+    // size of the file if all allocated space was contiguous
+    offs_t used = 0;
+    for (oid_t i = dbBitmapId; i < header->root[1 - curr].bitmapEnd; i++) {
+      byte *p = get(i);
+      for (length_t j = 0; j < dbPageSize; j++) {
+        for (int b = p[j]; b != 0; b &= b - 1) {
+          used += 1;
+        }
+      }
+      pool.unfix(p);
+    }
+    offs_t boundary = used << dbAllocationQuantumBits;
+
+    // allocate from the beginning of the file
+    currRBitmapPage = currPBitmapPage = dbBitmapId;
+    currRBitmapOffs = currPBitmapOffs = 0;
+
+    oid_t size = oid_t(currIndexSize);
+    if (compactPos < dbFirstUserId || compactPos >= size) {
+      compactPos = dbFirstUserId;
+    }
+    for (oid_t k = dbFirstUserId; k < size; k++) {
+      oid_t  oid = compactPos;
+      offs_t pos = getPos(oid);
+      if (++compactPos == size) { compactPos = dbFirstUserId; }
+      if (pos == 0 || (pos & (dbFreeHandleFlag | dbModifiedFlag)) ||
+          (pos & ~dbFlagsMask) < boundary) {
+        continue;
+      }
+      if (pos & dbPageObjectFlag) {
+        dbPutTie tie;
+        put(tie, oid);
+      } else {
+        dbPutTie tie;
+        putObject(tie, oid);
+      }
+      n += 1;
+      if ((getPos(oid) & ~dbFlagsMask) >= (pos & ~dbFlagsMask) ||
+          (maxObjects > 0 && n >= maxObjects)) {
+        // no free space below the object
+        break;
+      }
+    }
+    gcStats.relocated += n;
+  }
+  if (n != 0) {
+    commit();
+    dbCriticalSection cs(mutex);
+    checkpoint();
+    truncate();
+  }
+  return n;
+}
+
+void dbDatabase::truncate() {
+  // space at the end of the file may be used by snapshots of previous commit
+  if (indexStale) { syncIndex(); }
+  if (modified || (log != NULL && log->size() != 0)) { return; }
+  offs_t end = 0;
+  for (oid_t i = header->root[curr].bitmapEnd; --i >= dbBitmapId;) {
+    byte *p = get(i);
+    int   j = dbPageSize;
+    while (--j >= 0 && p[j] == 0)
+      ;
+    if (j >= 0) {
+      int b = 7;
+      while ((p[j] & (1 << b)) == 0) {
+        b -= 1;
+      }
+      end = ((offs_t(i - dbBitmapId) * dbPageSize * 8) + j * 8 + b + 1)
+            << dbAllocationQuantumBits;
+    }
+    pool.unfix(p);
+    if (j >= 0) { break; }
+  }
+  offs_t size = DOALIGN(end, dbPageSize);
+  if (end == 0 || size >= header->root[curr].size) { return; }
+  gcStats.truncated += header->root[curr].size - size;
+  header->root[0].size = header->root[1].size = size;
+  if (file->write(0, header, dbPageSize) != dbFile::ok ||
+      file->flush() != dbFile::ok) {
+    throwException(dybase_file_error, "Failed to write header to the disk");
+  }
+  pool.truncate(size);
+  file->setSize(dbFileExtensionQuantum != 0
+                    ? DOALIGN(size, dbFileExtensionQuantum)
+                    : size);
+}
+
 void dbDatabase::markObject(dbObject *obj) {
   byte *p   = (byte *)(obj + 1);
   byte *end = (byte *)obj + obj->size;
@@ -1182,6 +1498,7 @@ oid_t dbDatabase::allocateId() {
     header->root[curr].indexUsed = ++currIndexSize;
   }
   setPos(oid, 0);
+  markAllocated(oid);
   return oid;
 }
 
@@ -1193,9 +1510,63 @@ void dbDatabase::freeId(oid_t oid) {
   header->root[1 - curr].freeList = oid;
 }
 
+static int __cdecl compareOffs(void const *a, void const *b) {
+  offs_t pa = *(offs_t *)a;
+  offs_t pb = *(offs_t *)b;
+  return pa < pb ? -1 : pa == pb ? 0 : 1;
+}
+
+void dbDatabase::prefetch(oid_t const *oids, int n) {
+  dbCriticalSection           cs(mutex);
+  dbSmallBuffer<offs_t, 256> pages;
+  for (int i = 0; i < n; i++) {
+    offs_t pos = getPos(oids[i]);
+    if (pos & dbFreeHandleFlag) { continue; }
+    pos &= ~((offs_t)dbPageSize - 1);
+    if (!pool.contains(pos)) { *pages.append(1) = pos; }
+  }
+  n = (int)pages.size();
+  if (n == 0) { return; }
+  offs_t *p = pages.base();
+  qsort(p, n, sizeof(offs_t), compareOffs);
+  // coalesce adjacent pages into one request
+  for (int i = 0, j; i < n; i = j) {
+    for (j = i + 1; j < n && p[j] <= p[j - 1] + dbPageSize; j++)
+      ;
+    pool.prefetch(p[i], length_t(p[j - 1] - p[i] + dbPageSize));
+  }
+}
+
 void dbDatabase::commit() {
-  dbCriticalSection cs(mutex);
-  commitTransaction();
+  offs_t lsn;
+  {
+    dbCriticalSection cs(mutex);
+    commitTransaction();
+    if (log == NULL) { return; }
+    lsn = logPosition;
+  }
+  // sync the log outside of the critical section, so concurrent commits
+  // are coalesced into one fsync
+  if (log->sync(lsn) != dbFile::ok) {
+    throwException(dybase_file_error, "Failed to flush log to the disk");
+  }
+  if (log->size() >= dbDefaultLogCheckpointSize) {
+    dbCriticalSection cs(mutex);
+    checkpoint();
+  }
+}
+
+void dbDatabase::checkpoint() {
+  if (log == NULL || modified || !opened) { return; }
+  // committed pages were already written to the database file by commit
+  pool.flush();
+  if (file->write(0, header, dbPageSize) != dbFile::ok ||
+      file->flush() != dbFile::ok) {
+    throwException(dybase_file_error, "Failed to flush changes to the disk");
+  }
+  if (log->reset() != dbFile::ok) {
+    throwException(dybase_file_error, "Failed to truncate log");
+  }
 }
 
 void dbDatabase::commitTransaction() {
@@ -1204,6 +1575,7 @@ void dbDatabase::commitTransaction() {
     return;
   }
   if (!modified) { return; }
+  if (indexStale) { syncIndex(); }
   //
   // Commit transaction
   //
@@ -1307,17 +1679,30 @@ void dbDatabase::commitTransaction() {
     }
   }
 
-  if ((rc = file->write(0, header, dbPageSize)) != dbFile::ok) {
-    throwException(dybase_file_error, "Failed to write header");
-  }
+  if (log != NULL) {
+    // pages and new header are appended to the log, database file is
+    // written without sync and its header is updated only by checkpoint
+    pool.flush(false);
 
-  pool.flush();
+    header->curr = curr ^= 1;
 
-  header->curr = curr ^= 1;
+    if ((rc = log->append(0, header)) != dbFile::ok ||
+        (rc = log->commit(logPosition)) != dbFile::ok) {
+      throwException(dybase_file_error, "Failed to write log");
+    }
+  } else {
+    if ((rc = file->write(0, header, dbPageSize)) != dbFile::ok) {
+      throwException(dybase_file_error, "Failed to write header");
+    }
 
-  if ((rc = file->write(0, header, dbPageSize)) != dbFile::ok ||
-      (rc = file->flush()) != dbFile::ok) {
-    throwException(dybase_file_error, "Failed to flush changes to the disk");
+    pool.flush();
+
+    header->curr = curr ^= 1;
+
+    if ((rc = file->write(0, header, dbPageSize)) != dbFile::ok ||
+        (rc = file->flush()) != dbFile::ok) {
+      throwException(dybase_file_error, "Failed to flush changes to the disk");
+    }
   }
 
   header->root[1 - curr].size          = header->root[curr].size;
@@ -1326,12 +1711,39 @@ void dbDatabase::commitTransaction() {
   header->root[1 - curr].bitmapEnd     = header->root[curr].bitmapEnd;
   header->root[1 - curr].rootObject    = header->root[curr].rootObject;
   header->root[1 - curr].classDescList = header->root[curr].classDescList;
+  header->catalog[1 - curr]            = header->catalog[curr];
 
   if (newIndexSize != oldIndexSize) {
     header->root[1 - curr].index           = header->root[curr].shadowIndex;
     header->root[1 - curr].indexSize       = header->root[curr].shadowIndexSize;
     header->root[1 - curr].shadowIndex     = header->root[curr].index;
     header->root[1 - curr].shadowIndexSize = header->root[curr].indexSize;
+  }
+  this->curr               = curr;
+  this->committedIndexSize = currIndexSize;
+  modified                 = false;
+  gcDone                   = false;
+
+  // working index is updated when it is modified first time: snapshots of
+  // the previous commit may still read it
+  indexStale    = true;
+  syncFullIndex = newIndexSize != oldIndexSize;
+  syncIndexSize = committedIndexSize;
+  if (shared == NULL || !shared->publish(header, staleGeneration)) {
+    syncIndex();
+  }
+}
+
+void dbDatabase::syncIndex() {
+  if (shared != NULL) { shared->waitSnapshots(staleGeneration); }
+  indexStale = false;
+
+  int      curr               = this->curr;
+  db_int4 *map                = dirtyPagesMap;
+  length_t committedIndexSize = syncIndexSize;
+  length_t nPages             = committedIndexSize / dbHandlesPerPage;
+  oid_t    i;
+  if (syncFullIndex) {
     pool.copy(header->root[1 - curr].index, header->root[curr].index,
               currIndexSize * sizeof(offs_t));
     memset(map, 0,
@@ -1358,10 +1770,6 @@ void dbDatabase::commitTransaction() {
                       4));
     }
   }
-  this->curr               = curr;
-  this->committedIndexSize = currIndexSize;
-  modified                 = false;
-  gcDone                   = false;
 }
 
 void dbDatabase::rollback() {
@@ -1371,6 +1779,7 @@ void dbDatabase::rollback() {
     return;
   }
   if (!modified) { return; }
+  if (indexStale) { syncIndex(); }
   int      curr = header->curr;
   length_t nPages =
       (committedIndexSize + dbHandlesPerPage - 1) / dbHandlesPerPage;
@@ -1398,6 +1807,7 @@ void dbDatabase::rollback() {
   header->root[1 - curr].size          = header->root[curr].size;
   header->root[1 - curr].rootObject    = header->root[curr].rootObject;
   header->root[1 - curr].classDescList = header->root[curr].classDescList;
+  header->catalog[1 - curr]            = header->catalog[curr];
 
   currRBitmapPage = currPBitmapPage = dbBitmapId;
   currRBitmapOffs = currPBitmapOffs = 0;
@@ -1415,6 +1825,13 @@ void dbDatabase::rollback() {
     desc = next;
   }
   classDescList = desc;
+
+  if (gcActive) {
+    // marking may have used content of the rolled back transaction
+    delete[] greyBitmap;
+    delete[] blackBitmap;
+    gcActive = false;
+  }
 }
 
 dbDatabase::dbDatabase(dbAccessType type, dbErrorHandler hnd, length_t poolSize,
@@ -1428,11 +1845,20 @@ dbDatabase::dbDatabase(dbAccessType type, dbErrorHandler hnd, length_t poolSize,
   header                   = (dbHeader *)dbFile::allocateBuffer(dbPageSize);
   dbFileExtensionQuantum   = 0;
   dbFileSizeLimit          = 0;
+  log                      = NULL;
+  logPosition              = 0;
+  shared                   = NULL;
+  indexStale               = false;
+  weakIndices              = NULL;
+  nWeakIndices             = 0;
+  weakIndicesSize          = 0;
 }
 
 dbDatabase::~dbDatabase() {
+  if (shared != NULL) { shared->detach(this); }
   delete[] dirtyPagesMap;
   delete[] bitmapPageAvailableSpace;
+  delete[] weakIndices;
   dbFile::deallocateBuffer(header);
 }
 
@@ -1442,3 +1868,163 @@ void dbTrace(char *message, ...) {
   vfprintf(stderr, message, args);
   va_end(args);
 }
+
+bool dbDatabase::pinSnapshot() {
+  snapshotGeneration = shared->generation;
+  snapshotThread     = dbCurrentThread();
+  if (!shared->published) { return false; }
+  *header       = shared->header;
+  header->dirty = false;
+  int curr                  = header->curr;
+  header->root[1 - curr]    = header->root[curr];
+  header->catalog[1 - curr] = header->catalog[curr];
+  return true;
+}
+
+bool dbDatabase::reloadSnapshot() {
+  if (!pinSnapshot()) {
+    // writer has closed the file, its last commit is in the file header
+    if (file->read(0, header, dbPageSize) != dbFile::ok ||
+        !header->isInitialized() || header->dirty) {
+      throwException(dybase_file_error, "Failed to read file header");
+    }
+    int curr = header->curr;
+    header->checkExtension();
+    header->root[1 - curr]    = header->root[curr];
+    header->catalog[1 - curr] = header->catalog[curr];
+  }
+  shared->released.signal();
+  // pages cached by the pool may be reused by the writer
+  freeScheme();
+  pool.close();
+  curr = header->curr;
+  pool.open(file, header->root[curr].size, mappedPool);
+  currIndexSize = committedIndexSize = header->root[curr].indexUsed;
+  loadScheme();
+  return true;
+}
+
+bool dbDatabase::refresh() {
+  dbCriticalSection cs(mutex);
+  if (!opened) {
+    handleError(dybase_not_opened, "Database not opened");
+    return false;
+  }
+  if (shared == NULL || accessType != dbReadOnly) { return false; }
+  dbCriticalSection cs2(dbSharedFile::mutex);
+  snapshotMoved = false;
+  return reloadSnapshot();
+}
+
+bool dbDatabase::isSnapshotMoved() {
+  dbCriticalSection cs(mutex);
+  bool moved    = snapshotMoved;
+  snapshotMoved = false;
+  return moved;
+}
+
+dbMutex       dbSharedFile::mutex;
+dbSharedFile *dbSharedFile::chain;
+
+dbSharedFile *dbSharedFile::attach(char const *name, dbDatabase *db,
+                                   bool &pinned) {
+  char path[4096];
+#if defined(_WIN32)
+  if (_fullpath(path, name, sizeof path) == NULL) {
+#else
+  if (realpath(name, path) == NULL) {
+#endif
+    strncpy(path, name, sizeof path - 1);
+    path[sizeof path - 1] = '\0';
+  }
+  dbCriticalSection cs(mutex);
+  dbSharedFile *    sf;
+  for (sf = chain; sf != NULL && strcmp(sf->name, path) != 0; sf = sf->next)
+    ;
+  if (sf == NULL) {
+    sf             = new dbSharedFile;
+    sf->name       = new char[strlen(path) + 1];
+    strcpy(sf->name, path);
+    sf->nUsers     = 0;
+    sf->writer     = NULL;
+    sf->readers    = NULL;
+    sf->published  = false;
+    sf->generation = 0;
+    sf->next       = chain;
+    chain          = sf;
+  }
+  pinned = false;
+  if (db->accessType == dbDatabase::dbReadOnly) {
+    db->shared     = sf;
+    db->nextReader = sf->readers;
+    sf->readers    = db;
+    pinned         = db->pinSnapshot();
+  } else if (sf->writer != NULL) {
+    if (sf->nUsers == 0) {
+      chain = sf->next;
+      delete[] sf->name;
+      delete sf;
+    }
+    return NULL;
+  } else {
+    sf->writer = db;
+  }
+  sf->nUsers += 1;
+  return sf;
+}
+
+void dbSharedFile::detach(dbDatabase *db) {
+  dbCriticalSection cs(mutex);
+  if (writer == db) {
+    // file header is updated by close
+    writer    = NULL;
+    published = false;
+  } else {
+    dbDatabase **rpp;
+    for (rpp = &readers; *rpp != db; rpp = &(*rpp)->nextReader)
+      ;
+    *rpp = db->nextReader;
+    released.signal();
+  }
+  if (--nUsers == 0) {
+    dbSharedFile **spp;
+    for (spp = &chain; *spp != this; spp = &(*spp)->next)
+      ;
+    *spp = next;
+    delete[] name;
+    delete this;
+  }
+}
+
+bool dbSharedFile::publish(dbHeader *hdr, db_nat8 &prev) {
+  dbCriticalSection cs(mutex);
+  header    = *hdr;
+  published = true;
+  prev      = generation++;
+  for (dbDatabase *db = readers; db != NULL; db = db->nextReader) {
+    if (db->snapshotGeneration == prev) { return true; }
+  }
+  return false;
+}
+
+void dbSharedFile::waitSnapshots(db_nat8 gen) {
+  dbCriticalSection cs(mutex);
+  while (true) {
+    bool busy = false;
+    for (dbDatabase *db = readers; db != NULL; db = db->nextReader) {
+      if (db->snapshotGeneration == gen) {
+        if (dbIsCurrentThread(db->snapshotThread)) {
+          // thread can not wait for itself: its snapshot is moved forward,
+          // owner of the snapshot has to drop objects loaded from it
+          dbCriticalSection cs2(db->mutex);
+          db->reloadSnapshot();
+          db->snapshotMoved = true;
+        } else {
+          busy = true;
+        }
+      }
+    }
+    if (!busy) { return; }
+    released.wait(mutex);
+  }
+}
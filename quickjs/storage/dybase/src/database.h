@@ -40,6 +40,7 @@ typedef db_nat4 length_t;
 
 #include "buffer.h"
 #include "pagepool.h"
+#include "wal.h"
 #include "hashtab.h"
 #include "sync.h"
 
@@ -59,6 +60,11 @@ const length_t dbDefaultExtensionQuantum = 512 * 1024; // alloc per half meg.
  */
 const length_t dbDefaultPagePoolSize = 8 * 1024 * 1024;
 
+/**
+ * Size of write-ahead log triggering checkpoint (in bytes)
+ */
+const length_t dbDefaultLogCheckpointSize = 16 * 1024 * 1024;
+
 /**
  * Object handler falgs
  */
@@ -173,6 +179,18 @@ public:
     oid_t  rootObject;      // storage root
     oid_t  classDescList;   // list of class descriptors
   } root[2];
+  db_nat4 extMagic;   // dbHeaderExtMagic if the fields below are valid
+  oid_t   catalog[2]; // storage catalog, per root
+
+  enum { dbHeaderExtMagic = 0x44425832 }; // "DBX2"
+
+  // files created before the catalog was added may have garbage there
+  void checkExtension() {
+    if (extMagic != dbHeaderExtMagic) {
+      extMagic   = dbHeaderExtMagic;
+      catalog[0] = catalog[1] = 0;
+    }
+  }
 
   bool isInitialized() {
     return initialized == 1 && (dirty == 1 || dirty == 0) &&
@@ -231,6 +249,7 @@ public:
   dbClass *          cls;
   char *             name;
   char **            field;
+  int                nFields;
   length_t           signatureSize;
   dbClassDescriptor *next;
 
@@ -246,7 +265,8 @@ public:
     for (p = start; p < end; p += strlen(p) + 1) {
       n += 1;
     }
-    field = new char *[n];
+    nFields = n;
+    field   = new char *[n];
     for (p = start, n = 0; p < end; p += strlen(p) + 1) {
       field[n++] = p;
     }
@@ -284,6 +304,13 @@ public:
 
   char *getFieldName() { return desc->field[fieldNo]; }
 
+  oid_t getClassOid() { return desc->oid; }
+
+  char **getClassFields(int &nFields) {
+    nFields = desc->nFields;
+    return desc->field;
+  }
+
   bool hasNextField() {
     bool success = hasNext();
     if (success) { fieldNo += 1; }
@@ -378,6 +405,7 @@ private:
   dbSmallBuffer<char, 256> signature;
   dbSmallBuffer<char, 128> body;
   oid_t                    oid;
+  oid_t                    cid; // class descriptor, 0 if defined by signature
 
 public:
   dbDatabase *db;
@@ -385,10 +413,18 @@ public:
   dbStoreHandle(dbDatabase *db, oid_t oid, char const *className) {
     this->db  = db;
     this->oid = oid;
+    this->cid = 0;
     body.append(sizeof(dbObject));
     strcpy(signature.append((int)strlen(className) + 1), className);
   }
 
+  dbStoreHandle(dbDatabase *db, oid_t oid, oid_t cid) {
+    this->db  = db;
+    this->oid = oid;
+    this->cid = cid;
+    body.append(sizeof(dbObject));
+  }
+
   void setFieldValue(char const *fieldName, int type, void *value, int length) {
     strcpy(signature.append((int)strlen(fieldName) + 1), fieldName);
     setElement(type, value, length);
@@ -459,7 +495,56 @@ public:
 /**
  * Database class
  */
+/**
+ * Database file opened by several storages of the process: at most one
+ * writer and any number of read only storages, which are snapshots of the
+ * last commit published by the writer. Snapshots read committed pages
+ * without locking the writer. Two roots of the shadow paging let snapshot
+ * lag one commit behind the writer: index and space of the previous commit
+ * are reused by the writer only when there are no snapshots of it.
+ */
+class dbSharedFile {
+public:
+  dbSharedFile *next;
+  char *        name;
+  int           nUsers;
+  dbDatabase *  writer;     // NULL if file is not opened for writing
+  dbDatabase *  readers;    // list of snapshots
+  bool          published;  // header was published by the writer
+  dbHeader      header;     // state of the last commit of the writer
+  db_nat8       generation; // number of commits published by the writer
+  dbEvent       released;   // snapshot was released or refreshed
+
+  static dbMutex       mutex;
+  static dbSharedFile *chain;
+
+  /**
+   * Register storage opening the file, read only storage is pinned to the
+   * last published commit
+   * @param pinned set to true if header of the read only storage is taken
+   * from the writer
+   * @return NULL if file is already opened for writing by another storage
+   */
+  static dbSharedFile *attach(char const *name, dbDatabase *db,
+                              bool &pinned);
+  void                 detach(dbDatabase *db);
+
+  /**
+   * Publish committed state of the writer
+   * @param prev generation of the previous commit
+   * @return true if there are snapshots of the previous commit
+   */
+  bool publish(dbHeader *hdr, db_nat8 &prev);
+
+  /**
+   * Wait until there are no snapshots of the specified commit, snapshots
+   * used by the current thread are moved to the last commit
+   */
+  void waitSnapshots(db_nat8 gen);
+};
+
 class dbDatabase {
+  friend class dbSharedFile;
   friend class dbBtree;
   friend class dbBtreePage;
   friend class dbBtreeIterator;
@@ -509,20 +594,108 @@ public:
     return new dbStoreHandle(this, oid, className);
   }
 
+  /**
+   * Get handle to store object of the registered class: only field values
+   * are stored, in order of the class fields
+   */
+  dbStoreHandle *getStoreHandle(oid_t oid, oid_t cid) {
+    return new dbStoreHandle(this, oid, cid);
+  }
+
   dbLoadHandle *getLoadHandle(oid_t oid);
 
   void storeObject(dbStoreHandle *handle);
 
+  /**
+   * Find or create descriptor of the class with specified fields
+   * @return OID of the class descriptor
+   */
+  oid_t registerClass(char const *className, char const *const *fieldNames,
+                      int nFields);
+
   oid_t getRoot();
 
   void setRoot(oid_t oid);
 
+  /**
+   * Catalog is the second root of the storage reserved for the metadata
+   * of the application (not reachable from the storage root)
+   */
+  oid_t getCatalog();
+
+  void setCatalog(oid_t oid);
+
   void setGcThreshold(long maxAllocatedDelta) {
     gcThreshold = maxAllocatedDelta;
   }
 
+  /**
+   * Stop-the-world garbage collection: completes the current incremental
+   * cycle or performs the whole cycle
+   */
   void gc();
 
+  /**
+   * Start incremental GC cycle if no cycle is in progress and more than
+   * <i>threshold</i> bytes were allocated since the previous cycle
+   * @return true if new cycle is started
+   */
+  bool startIncrementalGC(long threshold);
+
+  /**
+   * Mark object referenced outside of the database (by the application) as
+   * reachable in the current GC cycle
+   */
+  void markRoot(oid_t oid);
+
+  /**
+   * Mark at most <i>maxObjects</i> objects of the current GC cycle and sweep
+   * unreachable objects when marking is completed
+   * @return true if there is no GC cycle in progress
+   */
+  bool gcStep(int maxObjects);
+
+  void getGcStats(dybase_gc_stats_t *stats);
+
+  /**
+   * Index does not keep objects alive: GC frees objects referenced only by
+   * weak indices and removes their entries from these indices. The setting
+   * is not persistent, it should be repeated after the database is opened.
+   */
+  void setWeakIndex(oid_t treeId);
+
+  /**
+   * Move at most <i>maxObjects</i> objects from the end of the database file
+   * to free space below and commit the transaction, then truncate free tail
+   * of the file
+   * @return number of relocated objects
+   */
+  int compact(int maxObjects);
+
+  /**
+   * Move read only storage to the last commit of the writer, opened by
+   * another storage of this process. Objects loaded from the previous
+   * snapshot should not be used any more.
+   * @return false if storage is not a snapshot of shared file
+   */
+  bool refresh();
+
+  /**
+   * Check if read only storage was moved to the last commit by the writer
+   * running in the same thread (it can not wait for the snapshot to be
+   * released). Objects loaded from the previous snapshot should not be used
+   * any more. The flag is cleared by this call and by refresh().
+   * @return true if snapshot was moved since the last check
+   */
+  bool isSnapshotMoved();
+
+  /**
+   * Start asynchronous read of the pages containing specified objects
+   * @param oids object identifiers
+   * @param n number of objects
+   */
+  void prefetch(oid_t const *oids, int n);
+
   void handleError(int error, char const *msg = NULL);
   void throwException(int error, char const *msg = NULL);
 
@@ -571,9 +744,11 @@ protected:
 
   dbClassDescriptor *classDescList;
 
-  dbFile *   file;
-  dbMutex    mutex;
-  dbPagePool pool;
+  dbFile *         file;
+  dbWriteAheadLog *log; // NULL if write-ahead log is not used
+  offs_t           logPosition; // end of the last commit record in the log
+  dbMutex          mutex;
+  dbPagePool       pool;
 
   int *bitmapPageAvailableSpace;
   bool opened;
@@ -581,11 +756,33 @@ protected:
   dbHashtable classOidHash;
   dbHashtable classSignatureHash;
 
-  db_int4 *greyBitmap;  // bitmap of visited during GC but not yet marked object
-  db_int4 *blackBitmap; // bitmap of objects marked during GC
+  db_int4 *greyBitmap;  // bitmap of reachable but not yet scanned objects
+  db_int4 *blackBitmap; // bitmap of objects scanned during GC
+  oid_t    gcIndexSize; // objects allocated during the cycle are not collected
+  oid_t    gcScanPos;   // next object to check in the grey bitmap
+  bool     gcActive;    // GC cycle is in progress
+  bool     gcRescan;    // object below gcScanPos was marked
   long     gcThreshold;
   long     allocatedDelta;
   bool     gcDone;
+  oid_t    compactPos; // next object to check for relocation
+  oid_t *  weakIndices; // indices which do not keep their objects alive
+  int      nWeakIndices;
+  int      weakIndicesSize;
+
+  dybase_gc_stats_t gcStats;
+
+  dbSharedFile *shared;     // NULL if file is not shared
+  dbDatabase *  nextReader; // next snapshot of the shared file
+  db_nat8    snapshotGeneration; // commit pinned by read only storage
+  dbThreadId snapshotThread;     // thread using the snapshot
+  bool       snapshotMoved;      // snapshot was moved forward by the writer
+  bool       mappedPool;
+  bool       indexStale;      // working index is copied from committed one
+                              // when it is modified first time
+  bool       syncFullIndex;   // index was reallocated by the last commit
+  length_t   syncIndexSize;   // index size before the last commit
+  db_nat8    staleGeneration; // commit used by snapshots of stale index
 
   dbErrorHandler errorHandler;
 
@@ -595,34 +792,86 @@ protected:
    * @param offset of the object in database file
    */
   offs_t getPos(oid_t oid) {
-    byte * p   = pool.get(header->root[1 - curr].index +
+    byte * p   = pool.get(header->root[indexStale ? curr : 1 - curr].index +
                        oid / dbHandlesPerPage * dbPageSize);
     offs_t pos = *((offs_t *)p + oid % dbHandlesPerPage);
     pool.unfix(p);
     return pos;
   }
 
-  offs_t getGCPos(oid_t oid) {
-    byte * p   = pool.get(header->root[curr].index +
-                       oid / dbHandlesPerPage * dbPageSize);
-    offs_t pos = *((offs_t *)p + oid % dbHandlesPerPage);
-    pool.unfix(p);
-    return pos;
+  /*
+   * GC marks objects reachable from the working state of the database at the
+   * start of the cycle (snapshot at the beginning). Object which is updated
+   * or freed during the cycle is scanned before its old content is lost, so
+   * marking may be spread over many transactions. Bitmaps are indexed by oid.
+   */
+  bool isBlack(oid_t oid) {
+    return (blackBitmap[oid >> 5] & (1 << (oid & 31))) != 0;
   }
 
   void markOid(oid_t oid) {
-    if (oid != 0) {
-      offs_t   pos = getGCPos(oid);
-      unsigned bit = (unsigned)(pos >> dbAllocationQuantumBits);
-      if ((blackBitmap[bit >> 5] & (1 << (bit & 31))) == 0) {
-        greyBitmap[bit >> 5] |= 1 << (bit & 31);
-      }
+    if (oid != 0 && oid < gcIndexSize && !isBlack(oid)) {
+      greyBitmap[oid >> 5] |= 1 << (oid & 31);
+      if (oid < gcScanPos) { gcRescan = true; }
     }
   }
 
+  /**
+   * Object was not reached by the current cycle and is freed by the sweep
+   */
+  bool isGarbage(oid_t oid) {
+    if (oid == 0 || oid >= gcIndexSize || isBlack(oid)) { return false; }
+    offs_t pos = getPos(oid);
+    return pos != 0 &&
+           !(pos & (dbPageObjectFlag | dbFreeHandleFlag | dbModifiedFlag));
+  }
+
+  bool isWeakIndex(oid_t oid) {
+    for (int i = 0; i < nWeakIndices; i++) {
+      if (weakIndices[i] == oid) { return true; }
+    }
+    return false;
+  }
+
+  /**
+   * Write barrier: scan the object before it is modified or freed
+   */
+  void beforeUpdate(oid_t oid) {
+    if (gcActive && oid < gcIndexSize && !isBlack(oid)) { scanObject(oid); }
+  }
+
+  /**
+   * Object is removed from index or reused during GC cycle
+   */
+  void shadeOid(oid_t oid) {
+    if (gcActive) { markOid(oid); }
+  }
+
+  /**
+   * Object created during GC cycle is live: it is reachable only from
+   * objects stored after the cycle was started
+   */
+  void markAllocated(oid_t oid) {
+    if (gcActive && oid < gcIndexSize) {
+      blackBitmap[oid >> 5] |= 1 << (oid & 31);
+      greyBitmap[oid >> 5] &= ~(1 << (oid & 31));
+    }
+  }
+
+  void  scanObject(oid_t oid);
   void  markObject(dbObject *obj);
   byte *markField(byte *p);
   void  startGC();
+  bool  markGC(int maxObjects);
+  void  sweepGC();
+  void  fullGC();
+  void  truncate();
+
+  bool openFile(char const *name, int openAttr);
+  void syncIndex();
+  bool pinSnapshot();
+  bool reloadSnapshot();
+  void freeScheme();
 
   /**
    * Set position of the object
@@ -630,6 +879,7 @@ protected:
    * @param pos offset of the object in database file
    */
   void setPos(oid_t oid, offs_t pos) {
+    if (indexStale) { syncIndex(); }
     byte *p = pool.put(header->root[1 - curr].index +
                        oid / dbHandlesPerPage * dbPageSize);
     *((offs_t *)p + oid % dbHandlesPerPage) = pos;
@@ -764,6 +1014,12 @@ protected:
    */
   void loadScheme();
 
+  /**
+   * Find descriptor of the class with specified signature (class name
+   * followed by field names), new descriptor is created if not found
+   */
+  dbClassDescriptor *findClassDescriptor(char *signature, length_t size);
+
   /**
    * Check if location is reserved
    * @param pos start position of the location
@@ -789,6 +1045,7 @@ protected:
   void commitLocation();
 
   void commitTransaction();
+  void checkpoint();
   void setDirty();
 };
 
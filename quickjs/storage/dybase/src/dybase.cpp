@@ -7,17 +7,24 @@
 #include "btree.h"
 #include "dybase.h"
 
+typedef char dybase_max_key_length_check
+    [DYBASE_MAX_KEY_LENGTH == dbBtreePage::dbMaxKeyLen ? 1 : -1];
+
 dybase_storage_t dybase_open(const char *file_path, int page_pool_size,
                              dybase_error_handler_t hnd, int read_write) {
   try {
     if (page_pool_size == 0) { page_pool_size = dbDefaultPagePoolSize; }
 
     dbDatabase::dbAccessType at =
-        read_write ? dbDatabase::dbAllAccess : dbDatabase::dbReadOnly;
+        (read_write & dybase_open_read_write) ? dbDatabase::dbAllAccess
+                                               : dbDatabase::dbReadOnly;
+    int openAttr = dbFile::no_buffering;
+    if (read_write & dybase_open_mmap_read) { openAttr |= dbFile::mmap_read; }
+    if (read_write & dybase_open_wal) { openAttr |= dbFile::wal; }
 
     dbDatabase *db = new dbDatabase(at, (dbDatabase::dbErrorHandler)hnd,
                                     page_pool_size / dbPageSize);
-    if (db->open(file_path)) {
+    if (db->open(file_path, openAttr)) {
       return db;
     } else {
       delete db;
@@ -48,6 +55,16 @@ void dybase_rollback(dybase_storage_t storage) {
   } catch (dbException &) {}
 }
 
+int dybase_refresh(dybase_storage_t storage) {
+  try {
+    return ((dbDatabase *)storage)->refresh();
+  } catch (dbException &) { return 0; }
+}
+
+int dybase_snapshot_moved(dybase_storage_t storage) {
+  return ((dbDatabase *)storage)->isSnapshotMoved();
+}
+
 dybase_oid_t dybase_get_root_object(dybase_storage_t storage) {
   // try {
   return ((dbDatabase *)storage)->getRoot();
@@ -62,6 +79,16 @@ void dybase_set_root_object(dybase_storage_t storage, dybase_oid_t oid) {
   } catch (dbException &) {}
 }
 
+dybase_oid_t dybase_get_catalog_object(dybase_storage_t storage) {
+  return ((dbDatabase *)storage)->getCatalog();
+}
+
+void dybase_set_catalog_object(dybase_storage_t storage, dybase_oid_t oid) {
+  try {
+    ((dbDatabase *)storage)->setCatalog(oid);
+  } catch (dbException &) {}
+}
+
 dybase_oid_t dybase_allocate_object(dybase_storage_t storage) {
   try {
     return ((dbDatabase *)storage)->allocate();
@@ -82,6 +109,24 @@ dybase_handle_t dybase_begin_store_object(dybase_storage_t storage,
   } catch (dbException &) { return NULL; }
 }
 
+dybase_oid_t dybase_register_class(dybase_storage_t storage,
+                                   char const *     class_name,
+                                   char const *const *field_names,
+                                   int                n_fields) {
+  try {
+    return ((dbDatabase *)storage)
+        ->registerClass(class_name, field_names, n_fields);
+  } catch (dbException &) { return 0; }
+}
+
+dybase_handle_t dybase_begin_store_class_object(dybase_storage_t storage,
+                                                dybase_oid_t     oid,
+                                                dybase_oid_t     class_oid) {
+  try {
+    return ((dbDatabase *)storage)->getStoreHandle(oid, (oid_t)class_oid);
+  } catch (dbException &) { return NULL; }
+}
+
 void dybase_store_object_field(dybase_handle_t handle, char const *field_name,
                                int field_type, void *value_ptr,
                                int value_length) {
@@ -134,6 +179,14 @@ char *dybase_get_class_name(dybase_handle_t handle) {
   return ((dbLoadHandle *)handle)->getClassName();
 }
 
+dybase_oid_t dybase_get_class_oid(dybase_handle_t handle) {
+  return ((dbLoadHandle *)handle)->getClassOid();
+}
+
+char **dybase_get_class_fields(dybase_handle_t handle, int *n_fields) {
+  return ((dbLoadHandle *)handle)->getClassFields(*n_fields);
+}
+
 char *dybase_next_field(dybase_handle_t handle) {
   dbLoadHandle *hnd = (dbLoadHandle *)handle;
   if (!hnd->hasNextField()) {
@@ -174,6 +227,15 @@ int dybase_insert_in_index(dybase_storage_t storage, dybase_oid_t index,
   } catch (dbException &) { return 0; }
 }
 
+int dybase_bulk_insert_in_index(dybase_storage_t storage, dybase_oid_t index,
+                                int key_type, dybase_bulk_item_t *items,
+                                int n_items, int fill_factor) {
+  try {
+    return dbBtree::bulkInsert((dbDatabase *)storage, (oid_t)index, key_type,
+                               items, n_items, fill_factor);
+  } catch (dbException &) { return 0; }
+}
+
 int dybase_remove_from_index(dybase_storage_t storage, dybase_oid_t index,
                              void *key, int key_type, int key_size,
                              dybase_oid_t obj) {
@@ -253,6 +315,30 @@ dybase_oid_t dybase_index_iterator_next(dybase_iterator_t iterator) {
   } catch (dbException &) { return 0; }
 }
 
+int dybase_index_iterator_next_n(dybase_iterator_t iterator,
+                                 dybase_oid_t *oids, int n) {
+  try {
+    return ((dbBtreeIterator *)iterator)->next((oid_t *)oids, n);
+  } catch (dbException &) { return 0; }
+}
+
+dybase_oid_t dybase_index_iterator_next_key(dybase_iterator_t iterator,
+                                            void *key, int *key_length) {
+  try {
+    length_t     len = 0;
+    dybase_oid_t oid = ((dbBtreeIterator *)iterator)->next(key, len);
+    *key_length      = (int)len;
+    return oid;
+  } catch (dbException &) { return 0; }
+}
+
+void dybase_prefetch_objects(dybase_storage_t storage, dybase_oid_t *oids,
+                             int n) {
+  try {
+    ((dbDatabase *)storage)->prefetch((oid_t *)oids, n);
+  } catch (dbException &) {}
+}
+
 void dybase_free_index_iterator(dybase_iterator_t iterator) {
   delete (dbBtreeIterator *)iterator;
 }
@@ -263,6 +349,36 @@ void dybase_set_gc_threshold(dybase_storage_t storage, long allocated_delta) {
 
 void dybase_gc(dybase_storage_t storage) { ((dbDatabase *)storage)->gc(); }
 
+int dybase_gc_start(dybase_storage_t storage, long threshold) {
+  try {
+    return ((dbDatabase *)storage)->startIncrementalGC(threshold);
+  } catch (dbException &) { return 0; }
+}
+
+void dybase_gc_mark(dybase_storage_t storage, dybase_oid_t oid) {
+  ((dbDatabase *)storage)->markRoot(oid);
+}
+
+int dybase_gc_step(dybase_storage_t storage, int max_objects) {
+  try {
+    return ((dbDatabase *)storage)->gcStep(max_objects);
+  } catch (dbException &) { return 1; }
+}
+
+int dybase_compact(dybase_storage_t storage, int max_objects) {
+  try {
+    return ((dbDatabase *)storage)->compact(max_objects);
+  } catch (dbException &) { return 0; }
+}
+
+void dybase_get_gc_stats(dybase_storage_t storage, dybase_gc_stats_t *stats) {
+  ((dbDatabase *)storage)->getGcStats(stats);
+}
+
+void dybase_set_weak_index(dybase_storage_t storage, dybase_oid_t index) {
+  ((dbDatabase *)storage)->setWeakIndex((oid_t)index);
+}
+
 
 hashtable_t hashtable_create() {
   return new dbHashtable();
@@ -301,4 +417,28 @@ void hashtable_each(hashtable_t ht, each_cb_t* pcb, void* opaque)
   pht->each(pcb, opaque);
 }
 
+oidhashtable_t oidhashtable_create() {
+  return new dbOidHashtable();
+}
+void oidhashtable_put(oidhashtable_t ht, dybase_oid_t oid, void *value)
+{
+  ((dbOidHashtable*)ht)->put(oid, value);
+}
+void* oidhashtable_get(oidhashtable_t ht, dybase_oid_t oid)
+{
+  return ((dbOidHashtable*)ht)->get(oid);
+}
+void* oidhashtable_remove(oidhashtable_t ht, dybase_oid_t oid)
+{
+  return ((dbOidHashtable*)ht)->remove(oid);
+}
+void oidhashtable_each(oidhashtable_t ht, each_cb_t* pcb, void* opaque)
+{
+  ((dbOidHashtable*)ht)->each(pcb, opaque);
+}
+void oidhashtable_free(oidhashtable_t ht)
+{
+  delete (dbOidHashtable*)ht;
+}
+
 
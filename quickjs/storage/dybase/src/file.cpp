@@ -130,6 +130,22 @@ int dbFile::setSize(offs_t size) {
   return ok;
 }
 
+int dbFile::getSize(offs_t &size) {
+  DWORD high_pos;
+  DWORD low_pos = GetFileSize(fh, &high_pos);
+  if (low_pos == BAD_POS && GetLastError() != NO_ERROR) {
+    return GetLastError();
+  }
+  size = (offs_t)(((db_nat8)high_pos << 32) | low_pos);
+  return ok;
+}
+
+void *dbFile::map(offs_t) { return NULL; }
+
+void dbFile::unmap(void *, offs_t) {}
+
+void dbFile::prefetch(offs_t, length_t) {}
+
 int dbFile::write(void const *buf, length_t size) {
   DWORD writtenBytes;
   return !WriteFile(fh, buf, size, &writtenBytes, NULL)
@@ -213,6 +229,8 @@ char *dbFile::errorText(int code, char *buf, length_t bufSize) {
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #ifdef __linux__
 #define lseek(fd, offs, whence) lseek64(fd, offs, whence)
@@ -256,6 +274,28 @@ int dbFile::open(char const *fileName, int attr) {
 
 int dbFile::setSize(offs_t size) { return ftruncate(fd, size); }
 
+int dbFile::getSize(offs_t &size) {
+  struct stat st;
+  if (fstat(fd, &st) != 0) { return errno; }
+  size = st.st_size;
+  return ok;
+}
+
+void *dbFile::map(offs_t size) {
+  void *p = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  return p == MAP_FAILED ? NULL : p;
+}
+
+void dbFile::unmap(void *addr, offs_t size) {
+  if (addr != NULL) { munmap(addr, size); }
+}
+
+void dbFile::prefetch(offs_t pos, length_t size) {
+#ifdef POSIX_FADV_WILLNEED
+  posix_fadvise(fd, pos, size, POSIX_FADV_WILLNEED);
+#endif
+}
+
 int dbFile::read(offs_t pos, void *buf, length_t size) {
   ssize_t rc;
 #if defined(__sun) || defined(_AIX43)
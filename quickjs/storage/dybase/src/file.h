@@ -36,7 +36,9 @@ public:
     read_only    = 0x01,
     truncate     = 0x02,
     sequential   = 0x04,
-    no_buffering = 0x08
+    no_buffering = 0x08,
+    mmap_read    = 0x10, // serve clean pages from read-only file mapping
+    wal          = 0x20  // commit transactions through write-ahead log
   };
   int open(char const *fileName, int attr);
   int open(wchar_t const *fileName, int attr);
@@ -50,10 +52,25 @@ public:
   virtual int close();
 
   virtual int setSize(offs_t offs);
+  virtual int getSize(offs_t &size);
 
   virtual int write(offs_t pos, void const *ptr, length_t size);
   virtual int read(offs_t pos, void *ptr, length_t size);
 
+  /**
+   * Map first <i>size</i> bytes of the file in memory for reading.
+   * Mapped region can be larger than the file itself: accessing
+   * pages beyond end of file is not allowed.
+   * @return address of the mapping or NULL if mapping is not supported
+   */
+  virtual void *map(offs_t size);
+  static void   unmap(void *addr, offs_t size);
+
+  /**
+   * Advise OS to start asynchronous read of the file region
+   */
+  virtual void prefetch(offs_t pos, length_t size);
+
   static void *allocateBuffer(length_t bufferSize);
   static void  deallocateBuffer(void *buffer, length_t size = 0);
   static void  protectBuffer(void *buf, length_t bufSize, bool readonly);
@@ -77,6 +94,8 @@ public:
   int open(int nSegments, dbSegment *segments, int attr);
 
   virtual int setSize(offs_t offs);
+  virtual void *map(offs_t) { return NULL; }
+  virtual void  prefetch(offs_t, length_t) {}
 
   virtual int flush();
   virtual int close();
@@ -67,8 +67,10 @@ public:
     unsigned h        = hashCode % dbHashtableSize;
     for (epp = &table[h]; (ep = *epp) != NULL; epp = &ep->next) {
       if (ep->hashCode == hashCode && memcmp(ep->key, key, keySize) == 0) {
+        void *value = ep->value;
         *epp = ep->next;
-        return ep->value;
+        delete ep;
+        return value;
       }
     }
     return NULL;
@@ -103,4 +105,126 @@ public:
   }
 };
 
+// Identity map oid -> object: open addressing with linear probing,
+// Fibonacci hashing and backward shift deletion (no tombstones).
+// The table grows when it gets 3/4 full. Oid 0 marks free slots.
+class dbOidHashtable {
+private:
+  struct Entry {
+    oid_t  oid;
+    void * value;
+  };
+
+  Entry *  table;
+  length_t size;  // power of 2
+  length_t count;
+  int      shift; // 32 - log2(size)
+
+  static const length_t initSize = 256;
+
+  length_t slot(oid_t oid) const {
+    return (length_t)((db_nat4)(oid * 2654435769U) >> shift);
+  }
+
+  void allocate(length_t newSize) {
+    table = new Entry[newSize];
+    memset(table, 0, sizeof(Entry) * newSize);
+    size = newSize;
+    shift = 32;
+    while (newSize > 1) {
+      newSize >>= 1;
+      shift -= 1;
+    }
+  }
+
+  void grow() {
+    Entry *  oldTable = table;
+    length_t oldSize  = size;
+    allocate(size * 2);
+    for (length_t i = 0; i < oldSize; i++) {
+      if (oldTable[i].oid) {
+        length_t h = slot(oldTable[i].oid);
+        while (table[h].oid)
+          h = (h + 1) & (size - 1);
+        table[h] = oldTable[i];
+      }
+    }
+    delete[] oldTable;
+  }
+
+  dbOidHashtable(const dbOidHashtable &);
+  dbOidHashtable &operator=(const dbOidHashtable &);
+
+public:
+  dbOidHashtable() {
+    count = 0;
+    allocate(initSize);
+  }
+
+  void put(oid_t oid, void *value) {
+    assert(oid != 0);
+    if ((count + 1) * 4 > size * 3)
+      grow();
+    length_t h = slot(oid);
+    while (table[h].oid) {
+      if (table[h].oid == oid) {
+        table[h].value = value;
+        return;
+      }
+      h = (h + 1) & (size - 1);
+    }
+    table[h].oid   = oid;
+    table[h].value = value;
+    count += 1;
+  }
+
+  void *get(oid_t oid) const {
+    for (length_t h = slot(oid); table[h].oid; h = (h + 1) & (size - 1)) {
+      if (table[h].oid == oid)
+        return table[h].value;
+    }
+    return NULL;
+  }
+
+  void *remove(oid_t oid) {
+    length_t h = slot(oid);
+    while (table[h].oid != oid) {
+      if (!table[h].oid)
+        return NULL;
+      h = (h + 1) & (size - 1);
+    }
+    void *value = table[h].value;
+    // shift back the following entries of the cluster that do not sit
+    // at their home slot, so lookups never cross an empty slot
+    for (length_t j = (h + 1) & (size - 1); table[j].oid; j = (j + 1) & (size - 1)) {
+      length_t home = slot(table[j].oid);
+      if (((j - home) & (size - 1)) >= ((j - h) & (size - 1))) {
+        table[h] = table[j];
+        h = j;
+      }
+    }
+    table[h].oid   = 0;
+    table[h].value = NULL;
+    count -= 1;
+    return value;
+  }
+
+  length_t length() const { return count; }
+
+  void clear() {
+    memset(table, 0, sizeof(Entry) * size);
+    count = 0;
+  }
+
+  // the callback must not modify the table
+  void each(each_cb *pcb, void *opaque) {
+    for (length_t i = 0; i < size; i++) {
+      if (table[i].oid && pcb(&table[i].oid, sizeof(oid_t), table[i].value, opaque))
+        break;
+    }
+  }
+
+  ~dbOidHashtable() { delete[] table; }
+};
+
 #endif
@@ -42,6 +42,18 @@ byte *dbPagePool::find(offs_t addr, int state) {
       return buffer + (i - 1) * dbPageSize;
     }
   }
+  if (mapping != NULL && !(state & dbPageHeader::psDirty)) {
+    // clean page which is not cached in the pool: return pointer to the
+    // mapping, dirty pages are always copied to the pool buffer
+    if (addr + dbPageSize > mappingSize && fileLength > mappingSize &&
+        nMappedFixed == 0) {
+      remap(fileLength);
+    }
+    if (canMap(addr)) {
+      nMappedFixed += 1;
+      return mapping + addr;
+    }
+  }
   i = freePages;
   if (i == 0) {
     i = pages->prev;
@@ -50,6 +62,10 @@ byte *dbPagePool::find(offs_t addr, int state) {
     // printf("Throw page %p offs=%x\n", ph, ph->offs);
     if (ph->state & dbPageHeader::psDirty) {
       // printf("Write page " INT8_FORMAT "\n", ph->offs);
+      if (log != NULL &&
+          log->append(ph->offs, buffer + (i - 1) * dbPageSize) != dbFile::ok) {
+        db->throwException(dybase_file_error, "Failed to write log");
+      }
       rc = file->write(ph->offs, buffer + (i - 1) * dbPageSize, dbPageSize);
       if (rc != dbFile::ok) {
         db->throwException(dybase_file_error, "Failed to write page");
@@ -59,6 +75,7 @@ byte *dbPagePool::find(offs_t addr, int state) {
         dirtyPages[ph->writeQueueIndex]->writeQueueIndex = ph->writeQueueIndex;
       }
       if (ph->offs >= fileSize) { fileSize = ph->offs + dbPageSize; }
+      if (ph->offs >= fileLength) { fileLength = ph->offs + dbPageSize; }
     }
     unsigned h = (unsigned(ph->offs) >> dbPageBits) & hashBits;
     int *    np;
@@ -90,7 +107,9 @@ byte *dbPagePool::find(offs_t addr, int state) {
   dbFile::protectBuffer(p, dbPageSize, false);
 #endif
 
-  if (addr < fileSize) {
+  if (canMap(addr)) {
+    memcpy(p, mapping + addr, dbPageSize);
+  } else if (addr < fileSize) {
     ph->state |= dbPageHeader::psRaw;
     // printf("read addr=%x\n", addr);
     rc = file->read(addr, p, dbPageSize);
@@ -141,11 +160,44 @@ void dbPagePool::copy(offs_t dst, offs_t src, length_t size) {
   unfix(srcPage);
 }
 
-bool dbPagePool::open(dbFile *file, offs_t fileSize) {
+bool dbPagePool::canMap(offs_t addr) {
+  return mapping != NULL && addr < fileSize &&
+         addr + dbPageSize <= fileLength && addr + dbPageSize <= mappingSize;
+}
+
+bool dbPagePool::remap(offs_t size) {
+  offs_t newSize = mappingSize;
+  while (newSize < size) {
+    newSize *= 2;
+  }
+  void *p = file->map(newSize);
+  if (p == NULL) { return false; }
+  dbFile::unmap(mapping, mappingSize);
+  mapping     = (byte *)p;
+  mappingSize = newSize;
+  return true;
+}
+
+bool dbPagePool::open(dbFile *file, offs_t fileSize, bool mapped) {
   int i;
 
   this->file     = file;
   this->fileSize = fileSize;
+  this->log      = NULL;
+
+  mapping      = NULL;
+  mappingSize  = 0;
+  fileLength   = 0;
+  nMappedFixed = 0;
+  if (mapped && file->getSize(fileLength) == dbFile::ok) {
+    // reserve address space for file growth, pages beyond the end of file
+    // are never accessed through the mapping
+    for (mappingSize = minMappingSize; mappingSize < fileLength * 2;
+         mappingSize *= 2)
+      ;
+    mapping = (byte *)file->map(mappingSize);
+    if (mapping == NULL) { mappingSize = 0; }
+  }
 
   length_t hashSize;
   for (hashSize = minHashSize; hashSize < poolSize; hashSize *= 2)
@@ -183,10 +235,23 @@ void dbPagePool::close() {
   delete[] pages;
   delete[] dirtyPages;
   dbFile::deallocateBuffer(buffer, bufferSize);
-  pages = NULL;
+  dbFile::unmap(mapping, mappingSize);
+  mapping = NULL;
+  pages   = NULL;
+}
+
+void dbPagePool::truncate(offs_t size) {
+  // pages beyond the end of the file are not read from the file or mapping
+  if (fileSize > size) { fileSize = size; }
+  if (fileLength > size) { fileLength = size; }
 }
 
 void dbPagePool::unfix(void *ptr) {
+  if (isMapped(ptr)) {
+    assert(nMappedFixed > 0);
+    nMappedFixed -= 1;
+    return;
+  }
   int           i  = (length_t((byte *)ptr - buffer) >> dbPageBits) + 1;
   dbPageHeader *ph = &pages[i];
   assert(ph->accessCount > 0);
@@ -203,6 +268,11 @@ void dbPagePool::unfix(void *ptr) {
 }
 
 void dbPagePool::unfixLIFO(void *ptr) {
+  if (isMapped(ptr)) {
+    assert(nMappedFixed > 0);
+    nMappedFixed -= 1;
+    return;
+  }
   int           i  = (length_t((byte *)ptr - buffer) >> dbPageBits) + 1;
   dbPageHeader *ph = &pages[i];
   assert(ph->accessCount > 0);
@@ -214,6 +284,10 @@ void dbPagePool::unfixLIFO(void *ptr) {
 }
 
 void dbPagePool::fix(void *ptr) {
+  if (isMapped(ptr)) {
+    nMappedFixed += 1;
+    return;
+  }
   int           i  = (length_t((byte *)ptr - buffer) >> dbPageBits) + 1;
   dbPageHeader *ph = &pages[i];
   assert(ph->accessCount != 0);
@@ -221,6 +295,7 @@ void dbPagePool::fix(void *ptr) {
 }
 
 void dbPagePool::modify(void *ptr) {
+  assert(!isMapped(ptr)); // mapped pages are read-only, use put() instead
   int           i  = (length_t((byte *)ptr - buffer) >> dbPageBits) + 1;
   dbPageHeader *ph = &pages[i];
   assert(ph->accessCount != 0);
@@ -231,6 +306,18 @@ void dbPagePool::modify(void *ptr) {
   }
 }
 
+bool dbPagePool::contains(offs_t addr) {
+  int hashCode = (unsigned(addr) >> dbPageBits) & hashBits;
+  for (int i = hashTable[hashCode]; i != 0; i = pages[i].collisionChain) {
+    if (pages[i].offs == addr) { return true; }
+  }
+  return false;
+}
+
+void dbPagePool::prefetch(offs_t addr, length_t size) {
+  if (addr < fileSize) { file->prefetch(addr, size); }
+}
+
 void dbPagePool::put(offs_t pos, byte *obj, length_t size) {
   int   offs = (int)pos & (dbPageSize - 1);
   byte *pg   = find(pos - offs, dbPageHeader::psDirty);
@@ -253,7 +340,7 @@ static int __cdecl compareOffs(void const *a, void const *b) {
   return pa->offs < pb->offs ? -1 : pa->offs == pb->offs ? 0 : 1;
 }
 
-void dbPagePool::flush() {
+void dbPagePool::flush(bool sync) {
   int rc;
   if (nDirtyPages != 0) {
     flushing = true;
@@ -266,6 +353,11 @@ void dbPagePool::flush() {
       }
       if (ph->state & dbPageHeader::psDirty) {
         // printf("Flush page " INT8_FORMAT "\n", ph->offs);
+        if (log != NULL &&
+            log->append(ph->offs, buffer + (ph - pages - 1) * dbPageSize) !=
+                dbFile::ok) {
+          db->throwException(dybase_file_error, "Failed to write log");
+        }
         rc = file->write(ph->offs, buffer + (ph - pages - 1) * dbPageSize,
                          dbPageSize);
         if (rc != dbFile::ok) {
@@ -273,6 +365,7 @@ void dbPagePool::flush() {
         }
         ph->state &= ~dbPageHeader::psDirty;
         if (ph->offs >= fileSize) { fileSize = ph->offs + dbPageSize; }
+        if (ph->offs >= fileLength) { fileLength = ph->offs + dbPageSize; }
       }
       if (--ph->accessCount == 0) {
         ph->next    = pages->next;
@@ -283,6 +376,7 @@ void dbPagePool::flush() {
     flushing    = false;
     nDirtyPages = 0;
   }
+  if (!sync) { return; }
   rc = file->flush();
   if (rc != dbFile::ok) {
     db->throwException(dybase_file_error, "Failed to flush pages pool");
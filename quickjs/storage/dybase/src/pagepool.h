@@ -33,6 +33,7 @@ public:
 class dbGetTie;
 class dbPutTie;
 class dbDatabase;
+class dbWriteAheadLog;
 
 class dbPagePool {
   friend class dbGetTie;
@@ -45,27 +46,41 @@ protected:
   int           freePages;
   int           nPages;
 
-  dbFile *    file;
-  dbDatabase *db;
+  dbFile *         file;
+  dbWriteAheadLog *log; // pages are also appended to the log (WAL mode)
+  dbDatabase *     db;
   length_t    hashBits;
   length_t    poolSize;
   byte *      buffer;
   length_t    bufferSize;
   offs_t      fileSize;
 
+  byte * mapping;      // read-only mapping of the file (mmap_read mode)
+  offs_t mappingSize;  // size of address range reserved for the mapping
+  offs_t fileLength;   // number of bytes known to be present in the file
+  int    nMappedFixed; // number of fixed pages referenced by the mapping
+
   int flushing;
 
   enum {
     initialWobArraySize = 8,
     minPoolSize         = 256,
     minHashSize         = 16 * 1024,
-    maxUnusedMemory     = 64 * 1024 * 1024
+    maxUnusedMemory     = 64 * 1024 * 1024,
+    minMappingSize      = 64 * 1024 * 1024
   };
 
   length_t       nDirtyPages;
   dbPageHeader **dirtyPages;
 
   byte *find(offs_t addr, int state);
+  bool  remap(offs_t size);
+
+  bool isMapped(void *ptr) {
+    return mapping != NULL && (byte *)ptr >= mapping &&
+           (byte *)ptr < mapping + mappingSize;
+  }
+  bool canMap(offs_t addr);
 
 public:
   byte *get(offs_t addr) { return find(addr, 0); }
@@ -76,9 +91,12 @@ public:
   void  unfixLIFO(void *ptr);
   void  fix(void *ptr);
   void  modify(void *ptr);
-  bool  open(dbFile *file, offs_t fileSize);
+  bool  contains(offs_t addr);
+  void  prefetch(offs_t addr, length_t size);
+  bool  open(dbFile *file, offs_t fileSize, bool mapped = false);
   void  close();
-  void  flush();
+  void  flush(bool sync = true);
+  void  truncate(offs_t size);
 
   bool destructed() { return pages == NULL; }
 
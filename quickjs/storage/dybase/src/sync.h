@@ -13,6 +13,7 @@
 
 #if defined(_WIN32)
 class dbMutex {
+  friend class dbEvent;
   CRITICAL_SECTION cs;
 
 public:
@@ -22,6 +23,23 @@ public:
   void unlock() { LeaveCriticalSection(&cs); }
 };
 
+class dbEvent {
+  CONDITION_VARIABLE cv;
+
+public:
+  dbEvent() { InitializeConditionVariable(&cv); }
+  void wait(dbMutex &mutex) {
+    SleepConditionVariableCS(&cv, &mutex.cs, INFINITE);
+  }
+  void signal() { WakeAllConditionVariable(&cv); }
+};
+
+typedef DWORD dbThreadId;
+inline dbThreadId dbCurrentThread() { return GetCurrentThreadId(); }
+inline bool dbIsCurrentThread(dbThreadId id) {
+  return id == GetCurrentThreadId();
+}
+
 #else // Unix
 
 #ifndef NO_PTHREADS
@@ -42,6 +60,22 @@ public:
   void unlock() { pthread_mutex_unlock(&cs); }
 };
 
+class dbEvent {
+  pthread_cond_t cond;
+
+public:
+  dbEvent() { pthread_cond_init(&cond, NULL); }
+  ~dbEvent() { pthread_cond_destroy(&cond); }
+  void wait(dbMutex &mutex) { pthread_cond_wait(&cond, &mutex.cs); }
+  void signal() { pthread_cond_broadcast(&cond); }
+};
+
+typedef pthread_t dbThreadId;
+inline dbThreadId dbCurrentThread() { return pthread_self(); }
+inline bool dbIsCurrentThread(dbThreadId id) {
+  return pthread_equal(id, pthread_self()) != 0;
+}
+
 #else
 
 class dbMutex {
@@ -50,6 +84,16 @@ public:
   void unlock() {}
 };
 
+class dbEvent {
+public:
+  void wait(dbMutex &) {}
+  void signal() {}
+};
+
+typedef int dbThreadId;
+inline dbThreadId dbCurrentThread() { return 0; }
+inline bool dbIsCurrentThread(dbThreadId) { return true; }
+
 #endif
 
 #endif
@@ -0,0 +1,153 @@
+//-< WAL.CPP >-------------------------------------------------------*--------*
+// Write-ahead log implementation
+//-------------------------------------------------------------------*--------*
+
+#include "stdtp.h"
+#include "database.h"
+
+static const db_nat4 initChecksum = 2166136261U;
+
+static db_nat4 calculateChecksum(db_nat4 sum, void const *data,
+                                 length_t size) {
+  db_nat4 const *p = (db_nat4 const *)data;
+  for (size >>= 2; size != 0; size--) {
+    sum = (sum ^ *p++) * 16777619U;
+  }
+  return sum;
+}
+
+dbWriteAheadLog::dbWriteAheadLog() {
+  name   = NULL;
+  buffer = NULL;
+}
+
+dbWriteAheadLog::~dbWriteAheadLog() {
+  delete[] name;
+  delete[] buffer;
+}
+
+int dbWriteAheadLog::open(char const *dbName, int attr) {
+  name = new char[strlen(dbName) + 5];
+  strcat(strcpy(name, dbName), "-wal");
+  int rc = file.open(name, attr & (dbFile::read_only | dbFile::no_buffering));
+  if (rc != dbFile::ok) { return rc; }
+  buffer = new byte[bufferSize];
+  used   = 0;
+  rc     = file.getSize(written);
+  if (rc != dbFile::ok) { return rc; }
+  committed = synced = written;
+  checksum           = initChecksum;
+  return dbFile::ok;
+}
+
+int dbWriteAheadLog::close(bool remove) {
+  int rc = file.close();
+  if (rc == dbFile::ok && remove) { ::remove(name); }
+  return rc;
+}
+
+int dbWriteAheadLog::write(void const *data, length_t size) {
+  if (used + size > bufferSize) {
+    int rc = file.write(written, buffer, used);
+    if (rc != dbFile::ok) { return rc; }
+    written += used;
+    used = 0;
+  }
+  memcpy(buffer + used, data, size);
+  used += size;
+  checksum = calculateChecksum(checksum, data, size);
+  return dbFile::ok;
+}
+
+int dbWriteAheadLog::append(offs_t pos, void const *page) {
+  dbCriticalSection cs(mutex);
+  dbRecord          rec;
+  rec.pos      = pos;
+  rec.type     = recPage;
+  rec.checksum = 0;
+  int rc       = write(&rec, sizeof rec);
+  return rc == dbFile::ok ? write(page, dbPageSize) : rc;
+}
+
+int dbWriteAheadLog::commit(offs_t &lsn) {
+  dbCriticalSection cs(mutex);
+  dbRecord          rec;
+  rec.pos      = committed;
+  rec.type     = recCommit;
+  rec.checksum = checksum;
+  int rc       = write(&rec, sizeof rec);
+  if (rc == dbFile::ok) {
+    rc = file.write(written, buffer, used);
+  }
+  if (rc != dbFile::ok) { return rc; }
+  written += used;
+  used      = 0;
+  checksum  = initChecksum;
+  lsn       = committed = written;
+  return dbFile::ok;
+}
+
+int dbWriteAheadLog::sync(offs_t lsn) {
+  dbCriticalSection cs(syncMutex);
+  if (synced >= lsn) {
+    // commit record was synced by concurrent committer
+    return dbFile::ok;
+  }
+  offs_t pos;
+  {
+    dbCriticalSection cs(mutex);
+    pos = committed;
+  }
+  int rc = file.flush();
+  if (rc == dbFile::ok) { synced = pos; }
+  return rc;
+}
+
+int dbWriteAheadLog::replay(dbFile *db) {
+  dbRecord rec;
+  byte *   page = buffer;
+  offs_t   pos, end = 0;
+  db_nat4  sum = initChecksum;
+  int      rc;
+
+  // find end of the last complete transaction
+  for (pos = 0; file.read(pos, &rec, sizeof rec) == dbFile::ok;) {
+    pos += sizeof rec;
+    if (rec.type == recPage) {
+      if (file.read(pos, page, dbPageSize) != dbFile::ok) { break; }
+      pos += dbPageSize;
+      sum = calculateChecksum(sum, &rec, sizeof rec);
+      sum = calculateChecksum(sum, page, dbPageSize);
+    } else if (rec.type == recCommit && rec.checksum == sum) {
+      end = pos;
+      sum = initChecksum;
+    } else {
+      break;
+    }
+  }
+  for (pos = 0; pos < end;) {
+    if ((rc = file.read(pos, &rec, sizeof rec)) != dbFile::ok) { return rc; }
+    pos += sizeof rec;
+    if (rec.type == recPage) {
+      if ((rc = file.read(pos, page, dbPageSize)) != dbFile::ok ||
+          (rc = db->write((offs_t)rec.pos, page, dbPageSize)) != dbFile::ok) {
+        return rc;
+      }
+      pos += dbPageSize;
+    }
+  }
+  return end != 0 ? db->flush() : dbFile::ok;
+}
+
+int dbWriteAheadLog::reset() {
+  dbCriticalSection cs(syncMutex);
+  dbCriticalSection cs2(mutex);
+  int               rc = file.setSize(0);
+  if (rc == dbFile::ok) { rc = file.flush(); }
+  if (rc == dbFile::ok) {
+    used = 0;
+    written = committed = synced = 0;
+    checksum                     = initChecksum;
+  }
+  return rc;
+}
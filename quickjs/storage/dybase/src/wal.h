@@ -0,0 +1,92 @@
+//-< WAL.H >---------------------------------------------------------*--------*
+// Write-ahead log
+//-------------------------------------------------------------------*--------*
+
+#ifndef __WAL_H__
+#define __WAL_H__
+
+#include "file.h"
+
+/**
+ * Append-only log of database pages.
+ * Transaction is written to the log as sequence of page images terminated by
+ * commit record holding checksum of all transaction records. Transaction is
+ * durable as soon as its commit record is synced to the disk, so commit needs
+ * only one sequential write and one fsync. Pages are written to the database
+ * file without sync and the log is truncated at checkpoint, when database
+ * file is synced. Incomplete tail of the log (crash during commit) is ignored
+ * by recovery.
+ */
+class dbWriteAheadLog {
+public:
+  struct dbRecord {
+    db_nat8 pos;      // offset of the page in the database file
+    db_nat4 type;     // record type
+    db_nat4 checksum; // checksum of transaction records (commit record only)
+  };
+  enum RecordType { recPage = 1, recCommit = 2 };
+
+  /**
+   * Open log of the database, log file name is database name with "-wal"
+   * suffix. In read only mode only existed log can be opened.
+   */
+  int open(char const *dbName, int attr);
+
+  /**
+   * Close the log
+   * @param remove remove log file
+   */
+  int close(bool remove);
+
+  /**
+   * Append page image to the log (records are buffered)
+   */
+  int append(offs_t pos, void const *page);
+
+  /**
+   * Write buffered records and commit record of the transaction.
+   * Transaction is not durable until sync() is called.
+   * @return log position of the end of commit record
+   */
+  int commit(offs_t &lsn);
+
+  /**
+   * Make all transactions up to the specified log position durable.
+   * Concurrent callers are coalesced into single fsync: caller waiting for
+   * another sync will find its commit record already synced.
+   */
+  int sync(offs_t lsn);
+
+  /**
+   * Apply all committed transactions to the database file and sync it
+   */
+  int replay(dbFile *db);
+
+  /**
+   * Truncate the log, should be called after the database file is synced
+   */
+  int reset();
+
+  offs_t size() { return written + used; }
+
+  dbWriteAheadLog();
+  ~dbWriteAheadLog();
+
+protected:
+  enum { bufferSize = 64 * 1024 };
+
+  dbFile  file;
+  char *  name;
+  byte *  buffer;
+  length_t used;     // number of buffered bytes
+  offs_t  written;   // log position of the buffered data
+  offs_t  committed; // log position after the last commit record
+  offs_t  synced;    // log position synced to the disk
+  db_nat4 checksum;  // checksum of records of current transaction
+  dbMutex mutex;     // protects log positions
+  dbMutex syncMutex; // serializes fsyncs
+
+  int write(void const *data, length_t size);
+};
+
+#endif
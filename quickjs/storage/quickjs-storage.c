@@ -27,6 +27,7 @@
 
 #include <assert.h>
 #include "../cutils.h"
+#include "../list.h"
 #include "dybase/include/dybase.h"
 #include "quickjs-storage.h"
 
@@ -41,12 +42,59 @@ enum {
 JSValue JS_GetObjectClassName(JSContext *ctx, JSValueConst obj);
 JSValue JS_GetLocalValue(JSContext *ctx, JSAtom name);
 
+/* Plain objects sharing a shape are stored as objects of one dybase class:
+   property names are kept once in the class descriptor and the object body
+   holds only values. Objects with more properties are likely dictionaries and
+   are stored as maps. */
+#define DB_LAYOUT_MAX_FIELDS 32
+
+typedef struct db_layout {
+  struct list_head link;      /* in JSStorage.layouts */
+  void*            shape;     /* referenced, NULL until the class is seen on a JS object */
+  dybase_oid_t     class_oid;
+  uint32_t         count;
+  JSAtom           atoms[0];  /* property names in the shape order */
+} db_layout;
+
+/* Declarative index: keys are computed from object fields or by a key function
+   and are updated by commit. Its reverse index maps oid + key to the object and
+   is used to find the previous key of a modified object. Both are weak: objects
+   dropped from the storage are removed from them by GC. Key functions are not
+   stored, they are defined by name each time the storage is opened. */
+typedef struct db_autoindex {
+  dybase_oid_t index_oid;
+  dybase_oid_t reverse_oid;
+  JSAtom       class_name;  /* JS_ATOM_NULL - objects of any class */
+  uint32_t     field_count;
+  JSAtom*      fields;      /* NULL if keys are computed by key_func */
+  JSAtom       key_name;    /* name of the key function, see storage.defineKey() */
+  JSValue      key_func;    /* JS_UNDEFINED while the function is not defined */
+  JSValue      def;         /* catalog entry */
+  JS_BOOL      stale;       /* objects were stored without key_func, rebuilt when it is defined */
+} db_autoindex;
+
 typedef struct JSStorage {
   dybase_storage_t hs;
   JSContext*       ctx;
-  hashtable_t      oid2obj;
+  oidhashtable_t   oid2obj; /* oid -> JSObject*, not referenced */
+  struct list_head dirty_list; /* JSPersitentBlock.dirty_link, objects to store on commit */
   JSValue          classname2proto;
   JSValue          root;
+  struct list_head layouts;
+  hashtable_t      shape2layout; /* JSShape* -> db_layout */
+  oidhashtable_t   class2layout; /* class descriptor oid -> db_layout */
+  JSValue          catalog;     /* persistent { indexes: [...] } of declarative indexes */
+  JSValue          key_funcs;   /* key function name -> function of declarative indexes */
+  JS_BOOL          read_only;
+  uint32_t         snapshot_gen; /* incremented when objects of the snapshot are detached */
+  db_autoindex*    autoindexes;
+  int              autoindex_count;
+  dybase_oid_t*    unindexed;   /* objects stored outside of commit, indexed by the next commit */
+  int              unindexed_count;
+  int              unindexed_size;
+  dybase_oid_t     indexed_oid; /* object being stored by commit, its keys are up to date */
+  int              gc_increment; /* objects marked by each commit, 0 - GC on open only */
+  int64_t          gc_threshold; /* bytes allocated before the next GC cycle is started */
 } JSStorage;
 
 static JSClassID js_storage_class_id = 0;
@@ -71,11 +119,22 @@ JS_BOOL js_set_persistent_rt(JSRuntime* rt, JSValue val, struct JSStorage* pst,
 JS_BOOL js_set_persistent(JSContext* ctx, JSValue val, struct JSStorage* pst, uint32_t oid, JS_PERSISTENT_STATUS status);
 void js_set_persistent_status(JSValue val, JS_PERSISTENT_STATUS status);
 JS_PERSISTENT_STATUS js_is_persistent(JSValue val, JSStorage** pstor, uint32_t* poid);
-uint32_t* js_get_persistent_oid_ref(JSValue val);
+JSValue js_persistent_dirty_first(struct list_head* dirty_list);
+void* js_persistent_layout(JSContext *ctx, JSValueConst obj, uint32_t max_count, uint32_t *pcount);
+void* js_persistent_layout_dup(void* layout);
+void js_persistent_layout_free(JSRuntime *rt, void* layout);
+void js_persistent_layout_mark(JSRuntime *rt, void* layout, JS_MarkFunc *mark_func);
+JSAtom js_persistent_layout_atom(void* layout, uint32_t n);
+JSValue js_persistent_layout_take(JSValueConst obj, uint32_t n);
+JS_BOOL js_persistent_layout_fill(JSContext *ctx, JSValueConst obj, void* layout, JSValue *values);
 
 static JSStorage* storage_of(JSValue obj) { return JS_GetOpaque(obj, js_storage_class_id); }
 
+struct list_head* js_storage_dirty_list(struct JSStorage* pst) { return &pst->dirty_list; }
+
 static dybase_oid_t db_persist_entity(JSContext *ctx, JSStorage* pst, JSValue obj);
+static void db_defer_indexing(JSContext *ctx, JSStorage* pst, dybase_oid_t oid);
+static JS_BOOL db_check_snapshot(JSContext *ctx, JSStorage* pst);
 
 JS_BOOL db_is_index(JSValue val);
 
@@ -153,21 +212,25 @@ void db_transform(JSContext *ctx, JSStorage* pst, JSValueConst val, db_triplet *
       if (!js_is_persistent(val, &ipst, &pt->data.oid) || (ipst != pst))
         assert(0);
     }
-    else if (JS_GetArrayBuffer(ctx, &size, val)) {
-      uint8_t * ptr = JS_GetArrayBuffer(ctx, &size, val);
-      pt->len = size; // length in bytes + 1 byte for the type
-      pt->data.s = ptr;
-      pt->type = dybase_bytes_type;
-    }
     else if(JS_IsObjectPlain(ctx,val))
     {
       pt->type = dybase_object_ref_type;
       pt->data.oid = db_persist_entity(ctx, pst, val);
     } 
-    else if (JS_IsDate(ctx, val, &ms1970)) {
-      int64_t ft = (int64_t)(ms1970 * 10000) + 116444736000000LL /*SEC_TO_UNIX_EPOCH*/;
-      pt->type = dybase_date_type;
-      pt->data.i64 = ft;
+    else {
+      uint8_t * ptr = JS_GetArrayBuffer(ctx, &size, val);
+      if (ptr) {
+        pt->len = size; // length in bytes + 1 byte for the type
+        pt->data.s = ptr;
+        pt->type = dybase_bytes_type;
+      } else {
+        JS_FreeValue(ctx, JS_GetException(ctx)); // not an ArrayBuffer
+        if (JS_IsDate(ctx, val, &ms1970)) {
+          int64_t ft = (int64_t)(ms1970 * 10000) + 116444736000000LL /*SEC_TO_UNIX_EPOCH*/;
+          pt->type = dybase_date_type;
+          pt->data.i64 = ft;
+        }
+      }
     }
     break;
   }
@@ -204,7 +267,116 @@ void db_store_atom(JSContext *ctx, JSStorage* pst, dybase_handle_t h, JSAtom ato
   dybase_store_array_element(h, db_val.type, (void *)db_val.data.s, db_val.len);
 }
 
-void db_store_object_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue obj) {
+static db_layout* db_new_layout(JSContext *ctx, JSStorage* pst, dybase_oid_t class_oid, uint32_t count)
+{
+  db_layout* layout = js_malloc(ctx, sizeof(db_layout) + count * sizeof(JSAtom));
+  if (!layout)
+    return NULL;
+  layout->shape = NULL;
+  layout->class_oid = class_oid;
+  layout->count = count;
+  list_add_tail(&layout->link, &pst->layouts);
+  if (!oidhashtable_get(pst->class2layout, class_oid))
+    oidhashtable_put(pst->class2layout, class_oid, layout);
+  return layout;
+}
+
+static void db_bind_layout_shape(JSStorage* pst, db_layout* layout, void* shape)
+{
+  layout->shape = js_persistent_layout_dup(shape);
+  hashtable_put(pst->shape2layout, &layout->shape, sizeof(layout->shape), layout);
+}
+
+static void db_free_layouts(JSContext *ctx, JSStorage* pst)
+{
+  struct list_head *el, *el1;
+  list_for_each_safe(el, el1, &pst->layouts) {
+    db_layout* layout = list_entry(el, db_layout, link);
+    for (uint32_t i = 0; i < layout->count; i++)
+      JS_FreeAtom(ctx, layout->atoms[i]);
+    if (layout->shape)
+      js_persistent_layout_free(JS_GetRuntime(ctx), layout->shape);
+    js_free(ctx, layout);
+  }
+  init_list_head(&pst->layouts);
+  hashtable_free(pst->shape2layout);
+  oidhashtable_free(pst->class2layout);
+}
+
+// remembers prototype of the first stored object of a custom class: objects of
+// the class loaded later get it even where the class is not in scope
+static void db_remember_class_proto(JSContext *ctx, JSStorage* pst, JSValueConst obj, JSValueConst cname)
+{
+  JSAtom name = JS_ValueToAtom(ctx, cname);
+  if (name == JS_ATOM_NULL)
+    return;
+  if (pst->classname2proto == JS_UNINITIALIZED)
+    pst->classname2proto = JS_NewObject(ctx);
+  if (JS_GetOwnProperty(ctx, NULL, pst->classname2proto, name) == 0) {
+    JSValue proto = JS_GetPrototype(ctx, obj);
+    if (JS_IsObject(proto))
+      JS_SetProperty(ctx, pst->classname2proto, name, proto);
+    else
+      JS_FreeValue(ctx, proto);
+  }
+  JS_FreeAtom(ctx, name);
+}
+
+// registers dybase class for objects having the shape of obj
+static db_layout* db_layout_of_shape(JSContext *ctx, JSStorage* pst, JSValue obj, void* shape, uint32_t count)
+{
+  const char *names[DB_LAYOUT_MAX_FIELDS];
+  db_layout* layout = NULL;
+  uint32_t n;
+
+  JSValue cname = JS_GetObjectClassName(ctx, obj);
+  const char *cstr = JS_IsString(cname) ? JS_ToCString(ctx, cname) : NULL;
+  if (cstr && cstr[0])
+    db_remember_class_proto(ctx, pst, obj, cname);
+
+  for (n = 0; n < count; n++)
+    names[n] = JS_AtomToCString(ctx, js_persistent_layout_atom(shape, n));
+
+  // single "." field is the signature of objects stored as maps
+  if (count != 1 || strcmp(names[0], ".") != 0) {
+    dybase_oid_t class_oid = dybase_register_class(pst->hs, cstr ? cstr : "", names, count);
+    if (class_oid) {
+      layout = oidhashtable_get(pst->class2layout, class_oid);
+      if (!layout || layout->shape) {
+        layout = db_new_layout(ctx, pst, class_oid, count);
+        for (n = 0; layout && n < count; n++)
+          layout->atoms[n] = JS_DupAtom(ctx, js_persistent_layout_atom(shape, n));
+      }
+      if (layout)
+        db_bind_layout_shape(pst, layout, shape);
+    }
+  }
+
+  for (n = 0; n < count; n++)
+    JS_FreeCString(ctx, names[n]);
+  if (cstr)
+    JS_FreeCString(ctx, cstr);
+  JS_FreeValue(ctx, cname);
+  return layout;
+}
+
+// object of a known layout: class descriptor oid and values in the shape order
+static void db_store_layout_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue obj, db_layout* layout)
+{
+  dybase_handle_t h = dybase_begin_store_class_object(pst->hs, oid, layout->class_oid);
+  assert(h);
+
+  for (uint32_t n = 0; n < layout->count; ++n) {
+    JSValue val = js_persistent_layout_take(obj, n); // to free sub-items to make obj dormant
+    db_store_field(ctx, pst, h, val);
+    JS_FreeValue(ctx, val);
+  }
+
+  dybase_end_store_object(h);
+}
+
+// object of arbitrary shape: map of property names to values
+static void db_store_map_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue obj) {
 
   JSPropertyEnum* tab = NULL;
   uint32_t len = 0;
@@ -217,6 +389,8 @@ void db_store_object_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSVa
 
   if (JS_IsString(cname))
     class_name = JS_ToCString(ctx, cname);
+  if (class_name[0])
+    db_remember_class_proto(ctx, pst, obj, cname);
  
   dybase_handle_t h = dybase_begin_store_object(pst->hs, oid, class_name);
   assert(h);
@@ -241,6 +415,27 @@ void db_store_object_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSVa
   dybase_end_store_object(h);
 
   js_free_prop_enum(ctx, tab, len);
+}
+
+void db_store_object_data(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue obj) {
+
+  db_layout* layout = NULL;
+  uint32_t count;
+
+  void* shape = js_persistent_layout(ctx, obj, DB_LAYOUT_MAX_FIELDS, &count);
+  if (shape) {
+    layout = hashtable_get(pst->shape2layout, &shape, sizeof(shape));
+    if (!layout)
+      layout = db_layout_of_shape(ctx, pst, obj, shape, count);
+  }
+
+  if (layout)
+    db_store_layout_data(ctx, pst, oid, obj, layout);
+  else
+    db_store_map_data(ctx, pst, oid, obj);
+
+  if (pst->autoindex_count && oid != pst->indexed_oid)
+    db_defer_indexing(ctx, pst, oid);
 
   js_set_persistent_status(obj, JS_PERSISTENT_DORMANT);
 }
@@ -283,7 +478,7 @@ void db_store_entity(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue o
   else if (JS_IsObjectPlain(ctx, obj)) // pure Object
     db_store_object_data(ctx, pst, oid, obj);
   else if (db_is_index(obj))
-    ;
+    js_set_persistent_status(obj, JS_PERSISTENT_LOADED); // index data is stored by dybase itself
   else 
     assert(0);
 }
@@ -292,40 +487,70 @@ JSValue db_fetch_value(JSContext *ctx, JSStorage* pst, dybase_handle_t h);
 JSAtom  db_fetch_atom(JSContext *ctx, JSStorage* pst, dybase_handle_t h);
 
 
-int db_fetch_object_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid_t oid) {
+// sets prototype of the loaded object of custom class
+static void db_set_class_proto(JSContext *ctx, JSStorage* pst, JSValue obj, const char *class_name) {
+  JSValue proto = JS_UNDEFINED;
+  JSAtom  cname = JS_NewAtom(ctx, class_name);
+  if (pst->classname2proto == JS_UNINITIALIZED)
+    pst->classname2proto = JS_NewObject(ctx);
+  else
+    proto = JS_GetProperty(ctx, pst->classname2proto, cname);
+  if (proto == JS_UNDEFINED) {
+    JSValue cls = JS_GetLocalValue(ctx, cname);
+    if (JS_IsConstructor(ctx,cls))
+      proto = JS_GetProperty(ctx, cls, JS_ATOM_prototype);
+    JS_FreeValue(ctx, cls);
+  }
+  if (proto != JS_UNDEFINED) {
+    JS_SetPrototype(ctx, obj, proto);
+    JS_SetProperty(ctx, pst->classname2proto, cname,proto);
+  }
+  JS_FreeAtom(ctx, cname);
+}
 
-  int pf = js_is_persistent(obj, NULL, NULL);
+// layout of the loaded object class, NULL for objects stored as maps
+static db_layout* db_layout_of_class(JSContext *ctx, JSStorage* pst, dybase_handle_t h, dybase_oid_t class_oid)
+{
+  int n_fields;
+  char **names = dybase_get_class_fields(h, &n_fields);
+  if (n_fields > DB_LAYOUT_MAX_FIELDS || (n_fields == 1 && strcmp(names[0], ".") == 0))
+    return NULL;
+  db_layout* layout = db_new_layout(ctx, pst, class_oid, n_fields);
+  for (int n = 0; layout && n < n_fields; n++)
+    layout->atoms[n] = JS_NewAtom(ctx, names[n]);
+  return layout;
+}
 
-  if (pf >= JS_PERSISTENT_LOADED)
-    return 0; // already loaded, nothing to do.
+static void db_fetch_layout_data(JSContext *ctx, JSStorage* pst, dybase_handle_t h, JSValue obj, db_layout* layout)
+{
+  JSValue values[DB_LAYOUT_MAX_FIELDS];
+  uint32_t n, count;
 
-  dybase_handle_t h = dybase_begin_load_object(pst->hs, oid);
+  for (n = 0; n < layout->count; n++) {
+    dybase_next_element(h);
+    values[n] = db_fetch_value(ctx, pst, h);
+  }
 
-  char *class_name = dybase_get_class_name(h);
-  if (!class_name) {
-    assert(0);
-    return -1;
-  } 
-  if (class_name[0]) { /* custom */
-    JSValue proto = JS_UNDEFINED;
-    JSAtom  cname = JS_NewAtom(ctx, class_name);
-    if (pst->classname2proto == JS_UNINITIALIZED)
-      pst->classname2proto = JS_NewObject(ctx);
-    else
-      proto = JS_GetProperty(ctx, pst->classname2proto, cname);
-    if (proto == JS_UNDEFINED) {
-      JSValue cls = JS_GetLocalValue(ctx, cname);
-      if (JS_IsConstructor(ctx,cls))
-        proto = JS_GetProperty(ctx, cls, JS_ATOM_prototype);
-      JS_FreeValue(ctx, cls);
-    }
-    if (proto != JS_UNDEFINED) {
-      JS_SetPrototype(ctx, obj, proto);
-      JS_SetProperty(ctx, pst->classname2proto, cname,proto);
+  if (layout->shape && js_persistent_layout_fill(ctx, obj, layout->shape, values))
+    return;
+
+  for (n = 0; n < layout->count; n++)
+    JS_DefinePropertyValue(ctx, obj, layout->atoms[n], values[n], JS_PROP_C_W_E);
+
+  if (!layout->shape) {
+    // first object of the class: objects loaded next take its shape
+    void* shape = js_persistent_layout(ctx, obj, DB_LAYOUT_MAX_FIELDS, &count);
+    if (shape && count == layout->count && !hashtable_get(pst->shape2layout, &shape, sizeof(shape))) {
+      for (n = 0; n < count && js_persistent_layout_atom(shape, n) == layout->atoms[n]; n++);
+      if (n == count)
+        db_bind_layout_shape(pst, layout, shape);
     }
-    JS_FreeAtom(ctx, cname);
   }
+}
 
+// returns -1 if the object has no fields, the handle is destroyed then
+static int db_fetch_map_data(JSContext *ctx, JSStorage* pst, dybase_handle_t h, JSValue obj)
+{
   char *field_name = dybase_next_field(h);
   if (!field_name) {
     assert(0);
@@ -349,10 +574,46 @@ int db_fetch_object_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid
     JS_FreeAtom(ctx, key_atom);
     //??? JS_FreeValue(ctx, val);
   }
+  return 0;
+}
+
+int db_fetch_object_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid_t oid) {
+
+  int pf = js_is_persistent(obj, NULL, NULL);
+
+  if (pf >= JS_PERSISTENT_LOADED)
+    return 0; // already loaded, nothing to do.
+
+  // set before filling it so the stores below do not try to load it again
+  js_set_persistent_status(obj, JS_PERSISTENT_LOADED);
+
+  dybase_handle_t h = dybase_begin_load_object(pst->hs, oid);
+
+  char *class_name = dybase_get_class_name(h);
+  if (!class_name) {
+    assert(0);
+    return -1;
+  } 
+
+  dybase_oid_t class_oid = dybase_get_class_oid(h);
+  db_layout* layout = oidhashtable_get(pst->class2layout, class_oid);
+
+  // set before the layout is used: its cached shape is taken only by objects
+  // having the same prototype
+  if (class_name[0]) /* custom */
+    db_set_class_proto(ctx, pst, obj, class_name);
+
+  if (!layout)
+    layout = db_layout_of_class(ctx, pst, h, class_oid);
+
+  if (layout)
+    db_fetch_layout_data(ctx, pst, h, obj, layout);
+  else if (db_fetch_map_data(ctx, pst, h, obj) < 0)
+    return -1;
 
   dybase_end_load_object(h);
 
-  js_set_persistent_status(obj, JS_PERSISTENT_LOADED); // drop DORMANT flag
+  js_set_persistent_status(obj, JS_PERSISTENT_LOADED); // filling it has marked it as modified
 
   return 1;
 
@@ -365,6 +626,8 @@ int db_fetch_array_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid_
   if (pf >= JS_PERSISTENT_LOADED)
     return 0; // already loaded, nothing to do.
 
+  js_set_persistent_status(obj, JS_PERSISTENT_LOADED);
+
   dybase_handle_t h = dybase_begin_load_object(pst->hs, oid);
   assert(h);
 
@@ -397,7 +660,7 @@ int db_fetch_array_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid_
 
   dybase_end_load_object(h);
 
-  js_set_persistent_status(obj, JS_PERSISTENT_LOADED); // drop DORMANT flag
+  js_set_persistent_status(obj, JS_PERSISTENT_LOADED); // filling it has marked it as modified
 
   return 1;
 }
@@ -405,16 +668,14 @@ int db_fetch_array_data(JSContext *ctx, JSValue obj, JSStorage* pst, dybase_oid_
 JSValue db_fetch_object(JSContext *ctx, JSStorage* pst, dybase_oid_t oid)
 {
   JSValue rv = JS_NewObject(ctx);
-  if(js_set_persistent(ctx, rv, pst, oid, JS_PERSISTENT_DORMANT))
-    hashtable_put(pst->oid2obj, &oid, sizeof(oid), JS_VALUE_GET_PTR(rv));
+  js_set_persistent(ctx, rv, pst, oid, JS_PERSISTENT_DORMANT); // caller puts it in oid2obj
   return rv;
 }
 
 JSValue db_fetch_array(JSContext *ctx, JSStorage* pst, dybase_oid_t oid)
 {
   JSValue rv = JS_NewArray(ctx);
-  if(js_set_persistent(ctx, rv, pst, oid, JS_PERSISTENT_DORMANT))
-    hashtable_put(pst->oid2obj, &oid, sizeof(oid), JS_VALUE_GET_PTR(rv));
+  js_set_persistent(ctx, rv, pst, oid, JS_PERSISTENT_DORMANT); // caller puts it in oid2obj
   return rv;
 }
 
@@ -432,7 +693,7 @@ JSAtom db_fetch_atom(JSContext *ctx, JSStorage* pst, dybase_handle_t h) {
 
 JS_BOOL db_check_cache(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue* pval)
 {
-  struct JSObject* pobj = hashtable_get(pst->oid2obj, &oid, sizeof(oid));
+  struct JSObject* pobj = oidhashtable_get(pst->oid2obj, oid);
   if (!pobj)
     return 0;
   *pval = JS_MKPTR(JS_TAG_OBJECT, pobj);
@@ -443,10 +704,12 @@ JS_BOOL db_check_cache(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValue
 JSValue db_load_object(JSContext *ctx, JSStorage* pst, dybase_oid_t oid)
 {
   JSValue obj;
+  db_check_snapshot(ctx, pst);
   if (db_check_cache(ctx, pst, oid, &obj))
     return JS_DupValue(ctx,obj);
   obj = db_fetch_object(ctx, pst, oid);
-  hashtable_put(pst->oid2obj, js_get_persistent_oid_ref(obj), sizeof(oid), JS_VALUE_GET_PTR(obj));
+  if (!JS_IsException(obj))
+    oidhashtable_put(pst->oid2obj, oid, JS_VALUE_GET_PTR(obj));
   return obj;
 }
 
@@ -522,7 +785,7 @@ JSValue db_fetch_value(JSContext *ctx, JSStorage* pst, dybase_handle_t h) {
     return JS_EXCEPTION;
   }
 
-  hashtable_put(pst->oid2obj, js_get_persistent_oid_ref(obj), sizeof(oid), JS_VALUE_GET_PTR(obj));
+  oidhashtable_put(pst->oid2obj, oid, JS_VALUE_GET_PTR(obj));
 
   return obj;
 }
@@ -537,6 +800,9 @@ int db_fetch_entity(JSContext *ctx, JSValue obj)
 
   assert(js_is_persitable(obj));
 
+  if (db_check_snapshot(ctx, pst)) // obj is detached
+    return -1;
+
   int r = 0;
 
   if (JS_IsArray(ctx, obj))
@@ -568,7 +834,7 @@ dybase_oid_t db_persist_entity(JSContext *ctx, JSStorage* pst, JSValue obj) {
     // it is attached to another storage
     if (vps) {
       db_store_entity(ctx, vps, oid, obj);
-      hashtable_remove(vps->oid2obj, &oid, sizeof(oid));
+      oidhashtable_remove(vps->oid2obj, oid);
       js_set_persistent(ctx, obj, NULL, 0, JS_NOT_PERSISTENT);
     }
   }
@@ -581,12 +847,61 @@ dybase_oid_t db_persist_entity(JSContext *ctx, JSStorage* pst, JSValue obj) {
 
   if (js_set_persistent(ctx, obj, pst, oid, JS_PERSISTENT_MODIFIED /*to force its saving*/))
   {
-    hashtable_put(pst->oid2obj, js_get_persistent_oid_ref(obj), sizeof(oid), JS_VALUE_GET_PTR(obj));
+    oidhashtable_put(pst->oid2obj, oid, JS_VALUE_GET_PTR(obj));
     return oid;
   } else 
     return 0;
 }
 
+static JS_BOOL db_get_bool_option(JSContext *ctx, JSValueConst options, const char *name)
+{
+  JSValue val = JS_GetPropertyStr(ctx, options, name);
+  JS_BOOL r = JS_ToBool(ctx, val) > 0;
+  JS_FreeValue(ctx, val);
+  return r;
+}
+
+static int64_t db_get_int_option(JSContext *ctx, JSValueConst options, const char *name)
+{
+  JSValue val = JS_GetPropertyStr(ctx, options, name);
+  int64_t r = 0;
+  if (!JS_IsUndefined(val) && JS_ToInt64(ctx, &r, val))
+    r = 0;
+  JS_FreeValue(ctx, val);
+  return r;
+}
+
+static int mark_gc_root(void* key, unsigned int key_length, void* data, void* opaque) {
+  dybase_gc_mark((dybase_storage_t)opaque, *(dybase_oid_t*)key);
+  return 0;
+}
+
+// objects loaded in memory may be referenced only by JS values, they are
+// roots of the incremental GC cycle along with the storage root
+static void db_gc_start(JSStorage* pst, long threshold) {
+  if (dybase_gc_start(pst->hs, threshold))
+    oidhashtable_each(pst->oid2obj, &mark_gc_root, pst->hs);
+}
+
+static int db_load_catalog(JSContext *ctx, JSStorage* pst);
+static void db_free_autoindexes(JSContext *ctx, JSStorage* pst);
+static void db_index_object(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValueConst obj);
+static void db_index_deferred(JSContext *ctx, JSStorage* pst);
+
+static void db_load_root(JSContext *ctx, JSStorage* pst)
+{
+  dybase_oid_t root_oid = dybase_get_root_object(pst->hs);
+  if (root_oid) {
+    JSValue root = JS_NewObject(ctx);
+    if (js_set_persistent(ctx, root, pst, root_oid, JS_PERSISTENT_DORMANT))
+    {
+      oidhashtable_put(pst->oid2obj, root_oid, JS_VALUE_GET_PTR(root));
+      pst->root = root;
+    } else 
+      JS_FreeValue(ctx, root);
+  }
+}
+
 static JSValue db_storage_open(JSContext *ctx, JSValueConst this_val,  int argc, JSValueConst *argv)
 {
   const char *filename = NULL;
@@ -600,20 +915,39 @@ static JSValue db_storage_open(JSContext *ctx, JSValueConst this_val,  int argc,
   if (!mode < 0)
     goto fail;
   
-  dybase_storage_t hs = dybase_open(filename, 4 * 1024 * 1024, errHandler, mode != 0);
+  int open_mode = mode ? dybase_open_read_write : dybase_open_read_only;
+  int gc_increment = 0;
+  int64_t gc_threshold = 0;
+  if (argc > 2 && JS_IsObject(argv[2])) {
+    if (db_get_bool_option(ctx, argv[2], "mmap"))
+      open_mode |= dybase_open_mmap_read;
+    if (db_get_bool_option(ctx, argv[2], "wal"))
+      open_mode |= dybase_open_wal;
+    gc_increment = (int)db_get_int_option(ctx, argv[2], "gcIncrement");
+    gc_threshold = db_get_int_option(ctx, argv[2], "gcThreshold");
+  }
+
+  dybase_storage_t hs = dybase_open(filename, 4 * 1024 * 1024, errHandler, open_mode);
 
   if(!hs)
     goto fail;
 
-  if (mode) dybase_gc(hs);
-
   JSStorage* pst = js_mallocz(ctx, sizeof(JSStorage));
 
   pst->hs = hs;
-  pst->oid2obj = hashtable_create();
+  pst->oid2obj = oidhashtable_create();
+  init_list_head(&pst->dirty_list);
+  init_list_head(&pst->layouts);
+  pst->shape2layout = hashtable_create();
+  pst->class2layout = oidhashtable_create();
   pst->root = JS_NULL;
+  pst->catalog = JS_UNDEFINED;
+  pst->key_funcs = JS_NewObjectProto(ctx, JS_NULL);
+  pst->read_only = !mode;
   pst->classname2proto = JS_UNINITIALIZED;
   pst->ctx = JS_DupContext(ctx);
+  pst->gc_increment = gc_increment > 0 ? gc_increment : 0;
+  pst->gc_threshold = gc_threshold;
 
   JSValue obj = JS_NewObjectClass(ctx, js_storage_class_id);
 
@@ -621,16 +955,16 @@ static JSValue db_storage_open(JSContext *ctx, JSValueConst this_val,  int argc,
   
   JS_FreeCString(ctx, filename);
 
-  dybase_oid_t root_oid = dybase_get_root_object(hs);
-  if (root_oid) {
-    JSValue root = JS_NewObject(ctx);
-    if (js_set_persistent(ctx, root, pst, root_oid, JS_PERSISTENT_DORMANT))
-    {
-      hashtable_put(pst->oid2obj, js_get_persistent_oid_ref(root), sizeof(dybase_oid_t), JS_VALUE_GET_PTR(root));
-      pst->root = root;
-    } else 
-      JS_FreeValue(ctx, root);
+  db_load_root(ctx, pst);
+  if (db_load_catalog(ctx, pst)) {
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
   }
+  // after the catalog is loaded: its indexes are weak
+  if (mode && !pst->gc_increment)
+    dybase_gc(hs);
+  if (mode && pst->gc_increment)
+    db_gc_start(pst, -1);
   return obj;
 
 fail:
@@ -646,42 +980,46 @@ JSStorage* get_storage(JSValueConst obj) {
 typedef struct commit_ctx {
   JSContext *ctx;
   JSStorage *pst;
-  int        forget;
-  int        count;
 } commit_ctx;
 
-static int commit_value(void* key, unsigned int key_length, void* data, void* opaque) {
-  JSValue obj = JS_MKPTR(JS_TAG_OBJECT, data);
-  commit_ctx *cc = (commit_ctx *)opaque;
-  dybase_oid_t *poid = (dybase_oid_t *)key;
-  db_store_entity(cc->ctx, cc->pst, *poid, obj);
-  return 0;
+// stores only objects marked as modified since the last commit. Storing an object
+// may append newly persisted sub-objects to the list, those are stored in the same pass.
+// Keys of declarative indexes are updated before an object is stored, key functions
+// may modify other objects so the pass is repeated until nothing is left.
+static void commit_storage(JSContext *ctx, JSStorage* pst) {
+  JSValue obj;
+  do {
+    db_index_deferred(ctx, pst);
+    while ((obj = js_persistent_dirty_first(&pst->dirty_list)) != JS_UNDEFINED) {
+      dybase_oid_t oid;
+      js_is_persistent(obj, NULL, &oid);
+      if (pst->autoindex_count && JS_IsObjectPlain(ctx, obj)) {
+        JS_DupValue(ctx, obj); // key functions may run GC
+        db_index_object(ctx, pst, oid, obj);
+        pst->indexed_oid = oid;
+        db_store_entity(ctx, pst, oid, obj);
+        pst->indexed_oid = 0;
+        JS_FreeValue(ctx, obj);
+      } else
+        db_store_entity(ctx, pst, oid, obj);
+      if (js_persistent_dirty_first(&pst->dirty_list) == obj) // not stored, drop it to guarantee progress
+        js_set_persistent_status(obj, JS_PERSISTENT_LOADED);
+    }
+  } while (pst->unindexed_count);
 }
 
-static int final_commit_value(void* key, unsigned int key_length, void* data, void* opaque) {
+static int detach_value(void* key, unsigned int key_length, void* data, void* opaque) {
   JSValue obj = JS_MKPTR(JS_TAG_OBJECT, data);
   commit_ctx *cc = (commit_ctx *)opaque;
-  dybase_oid_t *poid = (dybase_oid_t *)key;
-  db_store_entity(cc->ctx, cc->pst, *poid, obj);
   js_set_persistent(cc->ctx, obj, NULL, 0, JS_NOT_PERSISTENT);
-  ++cc->count;
   return 0;
 }
 
-static void commit_storage(JSContext *ctx, JSStorage* pst) {
-  commit_ctx cc = { ctx,pst,1};
-  hashtable_each(pst->oid2obj, &commit_value, &cc);
-}
-
 static void final_commit_storage(JSContext *ctx, JSStorage* pst) {
-  commit_ctx cc = { ctx,pst,1, 0 };
-  do {
-    cc.count = 0;
-    hashtable_t ht = pst->oid2obj;
-    pst->oid2obj = hashtable_create();
-    hashtable_each(ht, &final_commit_value, &cc);
-    hashtable_free(ht);
-  } while (cc.count);
+  commit_ctx cc = { ctx, pst };
+  commit_storage(ctx, pst);
+  // nothing is freed while detaching so the table is stable during the walk
+  oidhashtable_each(pst->oid2obj, &detach_value, &cc);
 }
 
 void free_storage(JSValue st) 
@@ -689,14 +1027,17 @@ void free_storage(JSValue st)
   JSStorage* ps = storage_of(st);
   if (!ps) return;
   JSContext *ctx = ps->ctx;
-  js_set_persistent(ctx, ps->root, NULL, 0, JS_NOT_PERSISTENT);
+  final_commit_storage(ctx, ps);
   JS_FreeValue(ctx, ps->root);
+  JS_FreeValue(ctx, ps->catalog);
   JS_FreeValue(ctx, ps->classname2proto);
-  final_commit_storage(ctx, ps);
+  JS_FreeValue(ctx, ps->key_funcs);
   dybase_commit(ps->hs);
   dybase_close(ps->hs);
   ps->hs = 0;
-  hashtable_free(ps->oid2obj);
+  oidhashtable_free(ps->oid2obj);
+  db_free_layouts(ctx, ps);
+  db_free_autoindexes(ctx, ps);
   JS_FreeContext(ctx);
   js_free(ctx, ps);
   JS_SetOpaque(st, NULL);
@@ -707,10 +1048,103 @@ static JSValue db_storage_commit(JSContext *ctx, JSValueConst this_val, int argc
   if (!ps) return JS_EXCEPTION;
   commit_storage(ctx, ps);
   dybase_commit(ps->hs);
+  if (ps->gc_increment) {
+    db_gc_start(ps, (long)ps->gc_threshold);
+    dybase_gc_step(ps->hs, ps->gc_increment);
+  }
   return JS_UNDEFINED;
 }
 
+// drops objects loaded from the previous snapshot of read only storage and
+// loads root and catalog of the current one
+static int db_reload_snapshot(JSContext *ctx, JSStorage* ps) {
+  commit_ctx cc = { ctx, ps };
+  ps->snapshot_gen++;
+  oidhashtable_each(ps->oid2obj, &detach_value, &cc);
+  oidhashtable_free(ps->oid2obj);
+  ps->oid2obj = oidhashtable_create();
+  JS_FreeValue(ctx, ps->root);
+  JS_FreeValue(ctx, ps->catalog);
+  ps->root = JS_NULL;
+  ps->catalog = JS_UNDEFINED;
+  db_free_autoindexes(ctx, ps);
+  db_load_root(ctx, ps);
+  return db_load_catalog(ctx, ps);
+}
+
+// read only storage used by the thread of the writer is moved to the last commit
+// by the next transaction of the writer (the thread can not wait for itself).
+// Its objects are detached before anything is read from the new commit, so a view
+// never mixes objects of two commits. Returns TRUE if the snapshot was moved.
+static JS_BOOL db_check_snapshot(JSContext *ctx, JSStorage* ps) {
+  if (!ps->read_only || !dybase_snapshot_moved(ps->hs))
+    return FALSE;
+  db_reload_snapshot(ctx, ps);
+  return TRUE;
+}
+
+// storage.refresh() - moves read only storage to the last commit of the storage
+// opened for writing by this process, e.g. by the main thread of the worker.
+// Objects loaded from the previous snapshot are detached: they are not persistent
+// any more. Returns false if the file is not opened for writing by this process.
+static JSValue db_storage_refresh(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+  JSStorage* ps = storage_of(this_val);
+  if (!ps) return JS_EXCEPTION;
+  if (!dybase_refresh(ps->hs))
+    return JS_FALSE;
+  if (db_reload_snapshot(ctx, ps))
+    return JS_EXCEPTION;
+  return JS_TRUE;
+}
+
+// storage.gcStep([maxObjects]) - marks at most maxObjects objects of the current
+// GC cycle (starting new one if needed), sweeps when marking is completed.
+// Returns true when the cycle is completed.
+static JSValue db_storage_gc_step(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+  JSStorage* ps = storage_of(this_val);
+  if (!ps) return JS_EXCEPTION;
+  int max_objects = 0;
+  if (argc > 0 && !JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &max_objects, argv[0]))
+    return JS_EXCEPTION;
+  db_gc_start(ps, -1);
+  return JS_NewBool(ctx, dybase_gc_step(ps->hs, max_objects));
+}
+
+// storage.compact([maxObjects]) - commits and moves objects from the end of the
+// file to free space below it, truncates the file. Returns number of moved objects.
+static JSValue db_storage_compact(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+  JSStorage* ps = storage_of(this_val);
+  if (!ps) return JS_EXCEPTION;
+  int max_objects = 0;
+  if (argc > 0 && !JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &max_objects, argv[0]))
+    return JS_EXCEPTION;
+  commit_storage(ctx, ps);
+  dybase_commit(ps->hs);
+  return JS_NewInt32(ctx, dybase_compact(ps->hs, max_objects));
+}
+
+static JSValue db_storage_get_gc_stats(JSContext *ctx, JSValueConst this_val)
+{
+  JSStorage* ps = get_storage(this_val);
+  if (!ps)
+    return JS_NULL;
+  dybase_gc_stats_t st;
+  dybase_get_gc_stats(ps->hs, &st);
+  JSValue obj = JS_NewObject(ctx);
+  JS_SetPropertyStr(ctx, obj, "active", JS_NewBool(ctx, st.active));
+  JS_SetPropertyStr(ctx, obj, "cycles", JS_NewInt64(ctx, st.cycles));
+  JS_SetPropertyStr(ctx, obj, "marked", JS_NewInt64(ctx, st.marked));
+  JS_SetPropertyStr(ctx, obj, "freedObjects", JS_NewInt64(ctx, st.freed_objects));
+  JS_SetPropertyStr(ctx, obj, "freedBytes", JS_NewInt64(ctx, st.freed_bytes));
+  JS_SetPropertyStr(ctx, obj, "relocated", JS_NewInt64(ctx, st.relocated));
+  JS_SetPropertyStr(ctx, obj, "truncated", JS_NewInt64(ctx, st.truncated));
+  JS_SetPropertyStr(ctx, obj, "fileSize", JS_NewInt64(ctx, st.file_size));
+  return obj;
+}
+
 static JSValue db_storage_create_index(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+static JSValue db_storage_define_key(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+static JSValue db_storage_bulk_insert(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 
 static JSValue db_storage_close(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
 {
@@ -725,6 +1159,7 @@ static JSValue db_storage_get_root(JSContext *ctx, JSValueConst this_val)
   JSStorage* ps = get_storage(this_val);
   if (!ps)
     return JS_NULL;
+  db_check_snapshot(ctx, ps);
   return JS_DupValue(ctx, ps->root);
 }
 
@@ -752,7 +1187,7 @@ int js_free_persistent_object(JSRuntime *rt, JSValueConst obj) {
   if (pst) {
     if(status == JS_PERSISTENT_MODIFIED)
        db_store_entity(pst->ctx, pst, oid, obj);
-    hashtable_remove(pst->oid2obj, &oid, sizeof(oid));
+    oidhashtable_remove(pst->oid2obj, oid);
     js_set_persistent_rt(rt, obj, pst, 0, JS_NOT_PERSISTENT);
   }
   return 0;
@@ -770,6 +1205,18 @@ static void js_storage_mark(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_f
     JS_MarkValue(rt, pst->root, mark_func);
     //JS_MarkValue(rt, pst->oid2obj, mark_func);
     JS_MarkValue(rt, pst->classname2proto, mark_func);
+    JS_MarkValue(rt, pst->catalog, mark_func);
+    JS_MarkValue(rt, pst->key_funcs, mark_func);
+    for (int n = 0; n < pst->autoindex_count; n++) {
+      JS_MarkValue(rt, pst->autoindexes[n].key_func, mark_func);
+      JS_MarkValue(rt, pst->autoindexes[n].def, mark_func);
+    }
+    struct list_head *el;
+    list_for_each(el, &pst->layouts) {
+      db_layout* layout = list_entry(el, db_layout, link);
+      if (layout->shape)
+        js_persistent_layout_mark(rt, layout->shape, mark_func);
+    }
   }
 }
 
@@ -787,7 +1234,13 @@ static const JSCFunctionListEntry js_storage_proto_funcs[] = {
   JS_CFUNC_DEF("close", 0, db_storage_close),
   JS_CFUNC_DEF("commit", 0, db_storage_commit),
   JS_CFUNC_DEF("createIndex", 0, db_storage_create_index),
+  JS_CFUNC_DEF("defineKey", 2, db_storage_define_key),
+  JS_CFUNC_DEF("bulkInsert", 3, db_storage_bulk_insert),
+  JS_CFUNC_DEF("refresh", 0, db_storage_refresh),
+  JS_CFUNC_DEF("gcStep", 1, db_storage_gc_step),
+  JS_CFUNC_DEF("compact", 1, db_storage_compact),
   JS_CGETSET_DEF("root", db_storage_get_root, db_storage_set_root),
+  JS_CGETSET_DEF("gcStats", db_storage_get_gc_stats, NULL),
 };
 
 static JSClassDef js_storage_class = {
@@ -816,17 +1269,636 @@ static JSValue db_load_index(JSContext *ctx, JSStorage* pst, dybase_oid_t index_
 
   js_set_persistent(ctx, obj, pst, index_oid, JS_PERSISTENT_LOADED);
 
-  hashtable_put(pst->oid2obj, js_get_persistent_oid_ref(obj), sizeof(index_oid), JS_VALUE_GET_PTR(obj));
+  oidhashtable_put(pst->oid2obj, index_oid, JS_VALUE_GET_PTR(obj));
 
   return obj;
 }
 
+/* Keys of declarative indexes are byte strings compared as sequences of
+   components: null < booleans < numbers < bigints < dates < strings. Each
+   component is a tag byte followed by an order preserving encoding of the value. */
+enum {
+  DB_KEY_NULL   = 0x05,
+  DB_KEY_FALSE  = 0x10,
+  DB_KEY_TRUE   = 0x11,
+  DB_KEY_NUMBER = 0x20,
+  DB_KEY_BIGINT = 0x30,
+  DB_KEY_DATE   = 0x40,
+  DB_KEY_STRING = 0x50,
+  DB_KEY_HIGH   = 0xFF, /* greater than any component, closes a key prefix */
+};
+
+/* room for the oid prefix of reverse index keys */
+#define DB_KEY_MAX_LENGTH ((int)(DYBASE_MAX_KEY_LENGTH - sizeof(dybase_oid_t)))
+
+static int db_key_put_u64(byte *key, int len, uint64_t v)
+{
+  if (len + 8 > DB_KEY_MAX_LENGTH)
+    return -1;
+  for (int n = 7; n >= 0; n--, v >>= 8)
+    key[len + n] = (byte)v;
+  return len + 8;
+}
+
+// IEEE double as unsigned integer of the same order
+static uint64_t db_key_double(double d)
+{
+  uint64_t u;
+  if (d == 0)
+    d = 0; // -0
+  memcpy(&u, &d, sizeof(u));
+  return (u >> 63) ? ~u : u | ((uint64_t)1 << 63);
+}
+
+// BigInt of any size: number of magnitude bytes biased by 0x80 (subtracted for
+// negative values) followed by the magnitude, bytes of negative values are
+// inverted so longer or larger magnitudes sort first
+static int db_encode_bigint(JSContext *ctx, JSValueConst val, byte *key, int len)
+{
+  JSValue radix = JS_NewInt32(ctx, 16);
+  JSValue func = JS_GetPropertyStr(ctx, val, "toString");
+  JSValue str = JS_Call(ctx, func, val, 1, &radix);
+  JS_FreeValue(ctx, func);
+  size_t size;
+  const char *hex = JS_IsException(str) ? NULL : JS_ToCStringLen(ctx, &size, str);
+  JS_FreeValue(ctx, str);
+  if (!hex) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return -1;
+  }
+  const char *digits = hex;
+  int negative = *digits == '-';
+  if (negative) {
+    digits++;
+    size--;
+  }
+  if (size == 1 && digits[0] == '0')
+    size = 0;
+  int bytes = (int)(size + 1) / 2;
+  if (bytes > 0x7F || len + 2 + bytes > DB_KEY_MAX_LENGTH) {
+    JS_FreeCString(ctx, hex);
+    return -1;
+  }
+  key[len++] = DB_KEY_BIGINT;
+  key[len++] = (byte)(negative ? 0x80 - bytes : 0x80 + bytes);
+  for (size_t n = 0; n < size; ) {
+    int b = 0;
+    // odd number of digits: the first byte has one digit
+    for (size_t end = n + ((size - n) & 1 ? 1 : 2); n < end; n++)
+      b = b * 16 + (digits[n] <= '9' ? digits[n] - '0' : (digits[n] | 0x20) - 'a' + 10);
+    key[len++] = (byte)(negative ? ~b : b);
+  }
+  JS_FreeCString(ctx, hex);
+  return len;
+}
+
+// appends key component, returns new key length or -1 if the value can't be a key
+static int db_encode_key_part(JSContext *ctx, JSValueConst val, byte *key, int len)
+{
+  double  d;
+
+  if (len < 0 || len + 1 > DB_KEY_MAX_LENGTH)
+    return -1;
+
+  switch (JS_VALUE_GET_NORM_TAG(val)) {
+  case JS_TAG_NULL:
+    key[len++] = DB_KEY_NULL;
+    return len;
+  case JS_TAG_BOOL:
+    key[len++] = JS_VALUE_GET_BOOL(val) ? DB_KEY_TRUE : DB_KEY_FALSE;
+    return len;
+  case JS_TAG_INT:
+  case JS_TAG_FLOAT64:
+    JS_ToFloat64(ctx, &d, val);
+    if (isnan(d))
+      return -1;
+    key[len++] = DB_KEY_NUMBER;
+    return db_key_put_u64(key, len, db_key_double(d));
+  case JS_TAG_BIG_INT:
+    return db_encode_bigint(ctx, val, key, len);
+  case JS_TAG_STRING: {
+    size_t size;
+    const char *str = JS_ToCStringLen(ctx, &size, val);
+    if (!str)
+      break;
+    key[len++] = DB_KEY_STRING;
+    // zero bytes are escaped as 00 FF, the string is terminated by 00 00
+    for (size_t n = 0; n < size && len >= 0; n++) {
+      if (len + 4 > DB_KEY_MAX_LENGTH)
+        len = -1;
+      else if ((key[len++] = str[n]) == 0)
+        key[len++] = DB_KEY_HIGH;
+    }
+    JS_FreeCString(ctx, str);
+    if (len < 0 || len + 2 > DB_KEY_MAX_LENGTH)
+      return -1;
+    key[len++] = 0;
+    key[len++] = 0;
+    return len;
+  }
+  case JS_TAG_OBJECT:
+    if (JS_IsDate(ctx, val, &d) && !isnan(d)) {
+      key[len++] = DB_KEY_DATE;
+      return db_key_put_u64(key, len, db_key_double(d));
+    }
+    return -1;
+  case JS_TAG_EXCEPTION:
+    break;
+  default:
+    return -1;
+  }
+  JS_FreeValue(ctx, JS_GetException(ctx));
+  return -1;
+}
+
+// key of a value or of an array of values (composite key)
+static int db_encode_key(JSContext *ctx, JSValueConst val, byte *key)
+{
+  int len = 0;
+  if (JS_IsArray(ctx, val) > 0) {
+    int64_t length = 0;
+    if (JS_GetPropertyLength(ctx, &length, val)) {
+      JS_FreeValue(ctx, JS_GetException(ctx));
+      return -1;
+    }
+    for (int64_t n = 0; n < length && len >= 0; n++) {
+      JSValue el = JS_GetPropertyUint32(ctx, val, (uint32_t)n);
+      len = db_encode_key_part(ctx, el, key, len);
+      JS_FreeValue(ctx, el);
+    }
+    return len;
+  }
+  return db_encode_key_part(ctx, val, key, 0);
+}
+
+// key of the object in the declarative index, -1 if the object is not indexed
+static int db_autoindex_key(JSContext *ctx, db_autoindex* ai, JSValueConst obj, byte *key)
+{
+  int len = 0;
+  if (ai->fields) {
+    for (uint32_t n = 0; n < ai->field_count && len >= 0; n++) {
+      JSValue val = JS_GetProperty(ctx, obj, ai->fields[n]);
+      len = db_encode_key_part(ctx, val, key, len);
+      JS_FreeValue(ctx, val);
+    }
+  } else {
+    JSValue val = JS_Call(ctx, ai->key_func, JS_UNDEFINED, 1, &obj);
+    if (JS_IsException(val)) {
+      JS_FreeValue(ctx, JS_GetException(ctx)); // object is not indexed
+      return -1;
+    }
+    len = db_encode_key(ctx, val, key);
+    JS_FreeValue(ctx, val);
+  }
+  return len > 0 ? len : -1;
+}
+
+static void db_key_put_oid(byte *key, dybase_oid_t oid)
+{
+  for (int n = sizeof(oid) - 1; n >= 0; n--, oid >>= 8)
+    key[n] = (byte)oid;
+}
+
+static void db_autoindex_set_stale(JSContext *ctx, db_autoindex* ai, JS_BOOL stale)
+{
+  ai->stale = stale;
+  JS_SetPropertyStr(ctx, ai->def, "stale", JS_NewBool(ctx, stale));
+}
+
+// replaces the key of the object in the index if it has changed
+static void db_autoindex_update(JSContext *ctx, JSStorage* pst, db_autoindex* ai,
+                                dybase_oid_t oid, JSValueConst obj, JSAtom class_name)
+{
+  const int prefix = sizeof(dybase_oid_t);
+  byte key[DYBASE_MAX_KEY_LENGTH];
+  byte old[DYBASE_MAX_KEY_LENGTH];
+  byte range[sizeof(dybase_oid_t) + 1];
+  int  len = -1, old_len = -1;
+
+  if (ai->stale)
+    return;
+  if (ai->class_name == JS_ATOM_NULL || ai->class_name == class_name) {
+    if (ai->key_name != JS_ATOM_NULL && JS_IsUndefined(ai->key_func)) {
+      // the key is unknown, the whole index is rebuilt once the function is defined
+      db_autoindex_set_stale(ctx, ai, TRUE);
+      return;
+    }
+    len = db_autoindex_key(ctx, ai, obj, key + prefix);
+  }
+
+  // reverse index has at most one key with the oid prefix
+  db_key_put_oid(range, oid);
+  range[prefix] = DB_KEY_HIGH;
+  dybase_iterator_t it = dybase_create_index_iterator(pst->hs, ai->reverse_oid, dybase_bytes_type,
+    range, prefix, 1, range, prefix + 1, 1, 1);
+  if (it) {
+    if (dybase_index_iterator_next_key(it, old, &old_len))
+      old_len -= prefix;
+    else
+      old_len = -1;
+    dybase_free_index_iterator(it);
+  }
+
+  if (old_len == len && (len < 0 || memcmp(old + prefix, key + prefix, len) == 0))
+    return;
+
+  if (old_len >= 0) {
+    dybase_remove_from_index(pst->hs, ai->index_oid, old + prefix, dybase_bytes_type, old_len, oid);
+    dybase_remove_from_index(pst->hs, ai->reverse_oid, old, dybase_bytes_type, old_len + prefix, oid);
+  }
+  if (len >= 0) {
+    // duplicate key of unique index: object is not indexed
+    if (dybase_insert_in_index(pst->hs, ai->index_oid, key + prefix, dybase_bytes_type, len, oid, 0)) {
+      db_key_put_oid(key, oid);
+      dybase_insert_in_index(pst->hs, ai->reverse_oid, key, dybase_bytes_type, len + prefix, oid, 0);
+    }
+  }
+}
+
+// name of the custom class of the object, JS_ATOM_NULL if it has none
+static JSAtom db_class_atom(JSContext *ctx, JSValueConst obj)
+{
+  JSAtom class_name = JS_ATOM_NULL;
+  JSValue cname = JS_GetObjectClassName(ctx, obj);
+  if (JS_IsString(cname))
+    class_name = JS_ValueToAtom(ctx, cname);
+  JS_FreeValue(ctx, cname);
+  return class_name;
+}
+
+static void db_index_object(JSContext *ctx, JSStorage* pst, dybase_oid_t oid, JSValueConst obj)
+{
+  JSAtom class_name = JS_ATOM_NULL;
+  int n;
+
+  for (n = 0; n < pst->autoindex_count; n++) {
+    if (pst->autoindexes[n].class_name != JS_ATOM_NULL) {
+      class_name = db_class_atom(ctx, obj);
+      break;
+    }
+  }
+  for (n = 0; n < pst->autoindex_count; n++)
+    db_autoindex_update(ctx, pst, &pst->autoindexes[n], oid, obj, class_name);
+  JS_FreeAtom(ctx, class_name);
+}
+
+// objects stored outside of commit (e.g. freed by GC) are indexed on commit
+static void db_defer_indexing(JSContext *ctx, JSStorage* pst, dybase_oid_t oid)
+{
+  if (pst->unindexed_count == pst->unindexed_size) {
+    int size = pst->unindexed_size ? pst->unindexed_size * 2 : 64;
+    dybase_oid_t* unindexed = js_realloc(ctx, pst->unindexed, size * sizeof(dybase_oid_t));
+    if (!unindexed)
+      return;
+    pst->unindexed = unindexed;
+    pst->unindexed_size = size;
+  }
+  pst->unindexed[pst->unindexed_count++] = oid;
+}
+
+static void db_index_deferred(JSContext *ctx, JSStorage* pst)
+{
+  while (pst->unindexed_count) {
+    dybase_oid_t oid = pst->unindexed[--pst->unindexed_count];
+    JSValue obj = db_load_object(ctx, pst, oid);
+    db_index_object(ctx, pst, oid, obj);
+    JS_FreeValue(ctx, obj);
+  }
+}
+
+static db_autoindex* db_find_autoindex(JSStorage* pst, dybase_oid_t index_oid)
+{
+  for (int n = 0; n < pst->autoindex_count; n++)
+    if (pst->autoindexes[n].index_oid == index_oid)
+      return &pst->autoindexes[n];
+  return NULL;
+}
+
+// objects reachable from the storage root and from indexes maintained by the
+// application, each object is visited once
+typedef struct db_walk {
+  oidhashtable_t visited;
+  JSValue*       stack;
+  int            sp;
+  int            size;
+} db_walk;
+
+static void db_walk_push(JSContext *ctx, JSStorage* pst, db_walk* w, JSValueConst val)
+{
+  JSStorage*   vpst;
+  dybase_oid_t oid;
+  if (!JS_IsObject(val) || !js_is_persistent(val, &vpst, &oid) || vpst != pst ||
+      oidhashtable_get(w->visited, oid))
+    return;
+  if (w->sp == w->size) {
+    int size = w->size ? w->size * 2 : 64;
+    JSValue* stack = js_realloc(ctx, w->stack, size * sizeof(JSValue));
+    if (!stack)
+      return;
+    w->stack = stack;
+    w->size = size;
+  }
+  oidhashtable_put(w->visited, oid, JS_VALUE_GET_PTR(val));
+  w->stack[w->sp++] = JS_DupValue(ctx, val);
+}
+
+static void db_walk_index(JSContext *ctx, JSStorage* pst, db_walk* w, dybase_oid_t index_oid)
+{
+  dybase_oid_t oids[64];
+  int n;
+  dybase_iterator_t it = dybase_create_index_iterator(pst->hs, index_oid,
+    dybase_get_index_type(pst->hs, index_oid), NULL, 0, 1, NULL, 0, 1, 1);
+  if (!it)
+    return;
+  while ((n = dybase_index_iterator_next_n(it, oids, countof(oids))) > 0) {
+    for (int i = 0; i < n; i++) {
+      JSValue obj = db_load_object(ctx, pst, oids[i]);
+      db_walk_push(ctx, pst, w, obj);
+      JS_FreeValue(ctx, obj);
+    }
+  }
+  dybase_free_index_iterator(it);
+}
+
+// indexes objects stored before the n-th declarative index was created or
+// while its key function was not defined
+static void db_autoindex_fill(JSContext *ctx, JSStorage* pst, int n)
+{
+  db_walk w = { oidhashtable_create() };
+  db_walk_push(ctx, pst, &w, pst->root);
+  while (w.sp) {
+    JSValue obj = w.stack[--w.sp];
+    dybase_oid_t oid;
+    js_is_persistent(obj, NULL, &oid);
+    if (db_is_index(obj)) {
+      if (!db_find_autoindex(pst, oid))
+        db_walk_index(ctx, pst, &w, oid);
+    } else if (db_fetch_entity(ctx, obj) >= 0) {
+      if (JS_IsArray(ctx, obj)) {
+        int64_t length = 0;
+        JS_GetPropertyLength(ctx, &length, obj);
+        for (uint32_t i = 0; i < length; i++) {
+          JSValue el = JS_GetPropertyUint32(ctx, obj, i);
+          db_walk_push(ctx, pst, &w, el);
+          JS_FreeValue(ctx, el);
+        }
+      } else {
+        JSPropertyEnum* tab = NULL;
+        uint32_t len = 0;
+        db_autoindex* ai = &pst->autoindexes[n]; // key functions may add indexes
+        JSAtom class_name = ai->class_name != JS_ATOM_NULL ? db_class_atom(ctx, obj) : JS_ATOM_NULL;
+        db_autoindex_update(ctx, pst, ai, oid, obj, class_name);
+        JS_FreeAtom(ctx, class_name);
+        if (!JS_GetOwnPropertyNames(ctx, &tab, &len, obj, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+          for (uint32_t i = 0; i < len; i++) {
+            JSValue val = JS_GetProperty(ctx, obj, tab[i].atom);
+            db_walk_push(ctx, pst, &w, val);
+            JS_FreeValue(ctx, val);
+          }
+          js_free_prop_enum(ctx, tab, len);
+        }
+      }
+    }
+    JS_FreeValue(ctx, obj);
+  }
+  js_free(ctx, w.stack);
+  oidhashtable_free(w.visited);
+}
+
+// adds index described by catalog entry { index, reverse, fields | key, class, stale }
+static int db_add_autoindex(JSContext *ctx, JSStorage* pst, JSValueConst def)
+{
+  db_autoindex ai = { 0 };
+  JSStorage*   ipst;
+  int          r = -1;
+
+  JSValue index = JS_GetPropertyStr(ctx, def, "index");
+  JSValue reverse = JS_GetPropertyStr(ctx, def, "reverse");
+  JSValue fields = JS_GetPropertyStr(ctx, def, "fields");
+  JSValue key = JS_GetPropertyStr(ctx, def, "key");
+  JSValue cname = JS_GetPropertyStr(ctx, def, "class");
+  ai.key_func = JS_UNDEFINED;
+  ai.def = JS_UNDEFINED;
+
+  if (!db_is_index(index) || !js_is_persistent(index, &ipst, &ai.index_oid) ||
+      !db_is_index(reverse) || !js_is_persistent(reverse, &ipst, &ai.reverse_oid)) {
+    JS_ThrowTypeError(ctx, "invalid index catalog");
+    goto done;
+  }
+  if (JS_IsString(key)) {
+    ai.key_name = JS_ValueToAtom(ctx, key);
+    if (ai.key_name == JS_ATOM_NULL)
+      goto done;
+    ai.key_func = JS_GetProperty(ctx, pst->key_funcs, ai.key_name);
+    ai.stale = db_get_bool_option(ctx, def, "stale");
+  } else {
+    int64_t length = 0;
+    if (JS_GetPropertyLength(ctx, &length, fields))
+      goto done;
+    ai.fields = js_mallocz(ctx, sizeof(JSAtom) * (length + 1));
+    if (!ai.fields)
+      goto done;
+    for (ai.field_count = 0; ai.field_count < length; ai.field_count++) {
+      JSValue name = JS_GetPropertyUint32(ctx, fields, ai.field_count);
+      ai.fields[ai.field_count] = JS_ValueToAtom(ctx, name);
+      JS_FreeValue(ctx, name);
+      if (ai.fields[ai.field_count] == JS_ATOM_NULL)
+        goto done;
+    }
+  }
+  if (JS_IsString(cname))
+    ai.class_name = JS_ValueToAtom(ctx, cname);
+  ai.def = JS_DupValue(ctx, def);
+  dybase_set_weak_index(pst->hs, ai.index_oid);
+  dybase_set_weak_index(pst->hs, ai.reverse_oid);
+
+  db_autoindex* autoindexes = js_realloc(ctx, pst->autoindexes, (pst->autoindex_count + 1) * sizeof(db_autoindex));
+  if (autoindexes) {
+    pst->autoindexes = autoindexes;
+    pst->autoindexes[pst->autoindex_count++] = ai;
+    r = 0;
+  }
+done:
+  if (r) {
+    for (uint32_t n = 0; n < ai.field_count; n++)
+      JS_FreeAtom(ctx, ai.fields[n]);
+    js_free(ctx, ai.fields);
+    JS_FreeAtom(ctx, ai.class_name);
+    JS_FreeAtom(ctx, ai.key_name);
+    JS_FreeValue(ctx, ai.key_func);
+    JS_FreeValue(ctx, ai.def);
+  }
+  JS_FreeValue(ctx, index);
+  JS_FreeValue(ctx, reverse);
+  JS_FreeValue(ctx, fields);
+  JS_FreeValue(ctx, key);
+  JS_FreeValue(ctx, cname);
+  return r;
+}
+
+// loads declarative indexes registered in the storage catalog
+static int db_load_catalog(JSContext *ctx, JSStorage* pst)
+{
+  dybase_oid_t catalog_oid = dybase_get_catalog_object(pst->hs);
+  if (!catalog_oid)
+    return 0;
+  pst->catalog = db_load_object(ctx, pst, catalog_oid);
+
+  int64_t length = 0;
+  JSValue indexes = JS_GetPropertyStr(ctx, pst->catalog, "indexes");
+  int r = JS_GetPropertyLength(ctx, &length, indexes);
+  for (int64_t n = 0; r == 0 && n < length; n++) {
+    JSValue def = JS_GetPropertyUint32(ctx, indexes, (uint32_t)n);
+    r = db_add_autoindex(ctx, pst, def);
+    JS_FreeValue(ctx, def);
+  }
+  JS_FreeValue(ctx, indexes);
+  return r;
+}
+
+static void db_free_autoindexes(JSContext *ctx, JSStorage* pst)
+{
+  for (int n = 0; n < pst->autoindex_count; n++) {
+    db_autoindex* ai = &pst->autoindexes[n];
+    for (uint32_t i = 0; i < ai->field_count; i++)
+      JS_FreeAtom(ctx, ai->fields[i]);
+    js_free(ctx, ai->fields);
+    JS_FreeAtom(ctx, ai->class_name);
+    JS_FreeAtom(ctx, ai->key_name);
+    JS_FreeValue(ctx, ai->key_func);
+    JS_FreeValue(ctx, ai->def);
+  }
+  js_free(ctx, pst->autoindexes);
+  js_free(ctx, pst->unindexed);
+  pst->autoindexes = NULL;
+  pst->autoindex_count = 0;
+  pst->unindexed = NULL;
+  pst->unindexed_count = pst->unindexed_size = 0;
+}
+
+// storage.defineKey(name, func) - defines key function of declarative indexes.
+// Functions are not stored, they have to be defined each time the storage is
+// opened. Indexes which became stale while their function was not defined are
+// rebuilt.
+static JSValue db_storage_define_key(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+  JSStorage* pst = get_storage(this_val);
+  if (!pst)
+    return JS_EXCEPTION;
+  if (!JS_IsFunction(ctx, argv[1]))
+    return JS_ThrowTypeError(ctx, "key function expected");
+  JSAtom name = JS_ValueToAtom(ctx, argv[0]);
+  if (name == JS_ATOM_NULL)
+    return JS_EXCEPTION;
+  JS_SetProperty(ctx, pst->key_funcs, name, JS_DupValue(ctx, argv[1]));
+  for (int n = 0; n < pst->autoindex_count; n++) {
+    db_autoindex* ai = &pst->autoindexes[n];
+    if (ai->key_name != name)
+      continue;
+    JS_FreeValue(ctx, ai->key_func);
+    ai->key_func = JS_DupValue(ctx, argv[1]);
+    if (ai->stale && !pst->read_only) {
+      dybase_clear_index(pst->hs, ai->index_oid);
+      dybase_clear_index(pst->hs, ai->reverse_oid);
+      db_autoindex_set_stale(ctx, ai, FALSE);
+      db_autoindex_fill(ctx, pst, n);
+    }
+  }
+  JS_FreeAtom(ctx, name);
+  return JS_UNDEFINED;
+}
+
+// storage.createIndex({ fields | key, unique, class }) - index maintained by commit
+static JSValue db_storage_create_autoindex(JSContext *ctx, JSStorage* pst, JSValueConst options)
+{
+  JSValue fields = JS_GetPropertyStr(ctx, options, "fields");
+  JSValue key = JS_GetPropertyStr(ctx, options, "key");
+  JSValue cls = JS_GetPropertyStr(ctx, options, "class");
+  JSValue def = JS_UNDEFINED;
+  JSValue index = JS_UNDEFINED;
+  JSValue ret = JS_EXCEPTION;
+  int unique = db_get_bool_option(ctx, options, "unique");
+
+  if (JS_IsUndefined(fields) == JS_IsUndefined(key)) {
+    JS_ThrowTypeError(ctx, "either fields or key of the index expected");
+    goto done;
+  }
+  if (JS_IsString(fields)) {
+    JSValue list = JS_NewArray(ctx);
+    JS_SetPropertyUint32(ctx, list, 0, fields);
+    fields = list;
+  } else if (!JS_IsUndefined(fields) && JS_IsArray(ctx, fields) <= 0) {
+    JS_ThrowTypeError(ctx, "index fields should be a name or an array of names");
+    goto done;
+  }
+  if (!JS_IsUndefined(key)) {
+    JSAtom name = JS_IsString(key) ? JS_ValueToAtom(ctx, key) : JS_ATOM_NULL;
+    JSValue func = name != JS_ATOM_NULL ? JS_GetProperty(ctx, pst->key_funcs, name) : JS_UNDEFINED;
+    JS_BOOL defined = JS_IsFunction(ctx, func);
+    JS_FreeValue(ctx, func);
+    JS_FreeAtom(ctx, name);
+    if (!defined) {
+      JS_ThrowTypeError(ctx, "index key should be the name of a function defined by storage.defineKey()");
+      goto done;
+    }
+  }
+  if (JS_IsFunction(ctx, cls)) {
+    JSValue name = JS_GetPropertyStr(ctx, cls, "name");
+    JS_FreeValue(ctx, cls);
+    cls = name;
+  }
+  if (JS_IsException(key) || JS_IsException(cls))
+    goto done;
+
+  if (JS_IsUndefined(pst->catalog)) {
+    JSValue catalog = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, catalog, "indexes", JS_NewArray(ctx));
+    dybase_oid_t catalog_oid = db_persist_entity(ctx, pst, catalog);
+    dybase_set_catalog_object(pst->hs, catalog_oid);
+    pst->catalog = catalog;
+  }
+
+  index = db_load_index(ctx, pst, dybase_create_index(pst->hs, dybase_bytes_type, unique), TRUE);
+  def = JS_NewObject(ctx);
+  JS_SetPropertyStr(ctx, def, "index", JS_DupValue(ctx, index));
+  JS_SetPropertyStr(ctx, def, "reverse", db_load_index(ctx, pst, dybase_create_index(pst->hs, dybase_bytes_type, 1), TRUE));
+  if (JS_IsUndefined(key))
+    JS_SetPropertyStr(ctx, def, "fields", JS_DupValue(ctx, fields));
+  else
+    JS_SetPropertyStr(ctx, def, "key", JS_DupValue(ctx, key));
+  if (JS_IsString(cls))
+    JS_SetPropertyStr(ctx, def, "class", JS_DupValue(ctx, cls));
+
+  if (db_add_autoindex(ctx, pst, def))
+    goto done;
+
+  JSValue indexes = JS_GetPropertyStr(ctx, pst->catalog, "indexes");
+  int64_t length = 0;
+  JS_GetPropertyLength(ctx, &length, indexes);
+  JS_SetPropertyInt64(ctx, indexes, length, JS_DupValue(ctx, def));
+  JS_FreeValue(ctx, indexes);
+
+  db_autoindex_fill(ctx, pst, pst->autoindex_count - 1);
+
+  ret = JS_DupValue(ctx, index);
+done:
+  JS_FreeValue(ctx, index);
+  JS_FreeValue(ctx, def);
+  JS_FreeValue(ctx, fields);
+  JS_FreeValue(ctx, key);
+  JS_FreeValue(ctx, cls);
+  return ret;
+}
+
 static JSValue db_storage_create_index(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
 {
   JSStorage* pst = get_storage(this_val);
   if (!pst)
     return JS_EXCEPTION;
 
+  if (JS_IsObject(argv[0]))
+    return db_storage_create_autoindex(ctx, pst, argv[0]);
+
   dybase_oid_t oid_idx = 0;
 
   const char* type = JS_ToCString(ctx, argv[0]);
@@ -866,7 +1938,22 @@ static JSValue db_index_get(JSContext *ctx, JSValueConst this_val, int argc, JSV
     return JS_EXCEPTION;
 
   db_triplet db_key;
-  db_transform(ctx,pst,argv[0],&db_key);
+  int max_len;
+  byte key[DYBASE_MAX_KEY_LENGTH + 1];
+
+  if (db_find_autoindex(pst, index_oid)) {
+    // all keys starting with the given components
+    db_key.type = dybase_bytes_type;
+    db_key.data.s = key;
+    db_key.len = db_encode_key(ctx, argv[0], key);
+    if (db_key.len < 0)
+      db_key.len = 0; // matches nothing
+    key[db_key.len] = DB_KEY_HIGH;
+    max_len = db_key.len + 1;
+  } else {
+    db_transform(ctx,pst,argv[0],&db_key);
+    max_len = db_key.len;
+  }
 
   dybase_oid_t *selected_objects = NULL;
 
@@ -874,7 +1961,7 @@ static JSValue db_index_get(JSContext *ctx, JSValueConst this_val, int argc, JSV
     keyptr(&db_key),
     db_key.len, 1 /*min_key_inclusive*/,
     keyptr(&db_key),
-    db_key.len, 1 /*min_key_inclusive*/, &selected_objects);
+    max_len, 1 /*min_key_inclusive*/, &selected_objects);
   
   JSValue val;
   if (dybase_is_index_unique(pst->hs, index_oid))
@@ -900,13 +1987,16 @@ static JSValue db_index_set(JSContext *ctx, JSValueConst this_val, int argc, JSV
   if (!js_is_persistent(this_val, &pst, &index_oid))
     return JS_EXCEPTION;
 
+  if (db_find_autoindex(pst, index_oid))
+    return JS_ThrowTypeError(ctx, "index is maintained by commit");
+
   if (!JS_IsObjectPlain(ctx,argv[1]))
     return JS_ThrowTypeError(ctx,"index can contain only plain objects");
 
   dybase_oid_t oid = db_persist_entity(ctx, pst, argv[1]);
   db_store_entity(ctx, pst, oid, argv[1]);
 
-  int replace = JS_ToBool(ctx, argv[2]) > 0;
+  int replace = argc > 2 && JS_ToBool(ctx, argv[2]) > 0;
 
   // transform 'key' into triplet
   db_triplet db_key;
@@ -919,6 +2009,99 @@ static JSValue db_index_set(JSContext *ctx, JSValueConst this_val, int argc, JSV
   return JS_NewBool(ctx, ret);
 }
 
+// storage.bulkInsert(index, [[key, object], ...] [, fillFactor]) - inserts all pairs at once,
+// the index B-tree is rebuilt bottom-up from sorted keys instead of per key insertions.
+static JSValue db_storage_bulk_insert(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+  JSStorage*   pst = storage_of(this_val);
+  JSStorage*   ipst;
+  dybase_oid_t index_oid;
+  int64_t      length = 0;
+  int32_t      fill_factor = 0;
+  JSValue      ret = JS_EXCEPTION;
+
+  if (!pst)
+    return JS_EXCEPTION;
+
+  if (!db_is_index(argv[0]) || !js_is_persistent(argv[0], &ipst, &index_oid) || ipst != pst)
+    return JS_ThrowTypeError(ctx, "index of this storage expected");
+
+  if (db_find_autoindex(pst, index_oid))
+    return JS_ThrowTypeError(ctx, "index is maintained by commit");
+
+  if (JS_GetPropertyLength(ctx, &length, argv[1]))
+    return JS_EXCEPTION;
+  if (length > INT32_MAX)
+    return JS_ThrowRangeError(ctx, "too many entries");
+
+  if (argc > 2 && !JS_IsUndefined(argv[2]) && JS_ToInt32(ctx, &fill_factor, argv[2]))
+    return JS_EXCEPTION;
+
+  int key_type = dybase_get_index_type(pst->hs, index_oid);
+
+  db_triplet* keys = js_mallocz(ctx, sizeof(db_triplet) * (length + 1));
+  dybase_bulk_item_t* items = js_mallocz(ctx, sizeof(dybase_bulk_item_t) * (length + 1));
+  int n = 0;
+  if (!keys || !items)
+    goto done;
+
+  for (; n < length; ++n) {
+    JSValue pair = JS_GetPropertyUint32(ctx, argv[1], n);
+    if (JS_IsException(pair))
+      goto done;
+    JSValue key = JS_GetPropertyUint32(ctx, pair, 0);
+    JSValue obj = JS_GetPropertyUint32(ctx, pair, 1);
+    JS_FreeValue(ctx, pair);
+    if (!JS_IsObjectPlain(ctx, obj)) {
+      JS_FreeValue(ctx, key);
+      JS_FreeValue(ctx, obj);
+      JS_ThrowTypeError(ctx, "index can contain only plain objects");
+      goto done;
+    }
+    dybase_oid_t oid = db_persist_entity(ctx, pst, obj);
+    db_store_entity(ctx, pst, oid, obj);
+    db_transform(ctx, pst, key, &keys[n]);
+    JS_FreeValue(ctx, key);
+    JS_FreeValue(ctx, obj);
+    if (keys[n].type != key_type) {
+      ++n; // to free it
+      JS_ThrowTypeError(ctx, "key type does not match index type");
+      goto done;
+    }
+    items[n].key = keyptr(&keys[n]);
+    items[n].key_size = keys[n].len;
+    items[n].obj = oid;
+  }
+
+  ret = JS_NewInt32(ctx, dybase_bulk_insert_in_index(pst->hs, index_oid, key_type, items, n, fill_factor));
+
+done:
+  if (keys) {
+    for (int i = 0; i < n; ++i)
+      db_free_transform(ctx, &keys[i]);
+  }
+  js_free(ctx, keys);
+  js_free(ctx, items);
+  return ret;
+}
+
+// index.rebuild([fillFactor]) - rewrites the index B-tree with pages filled up to fillFactor percent
+static JSValue db_index_rebuild(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+  JSStorage*   pst;
+  dybase_oid_t index_oid;
+  int32_t      fill_factor = 0;
+
+  if (!js_is_persistent(this_val, &pst, &index_oid))
+    return JS_EXCEPTION;
+
+  if (argc > 0 && !JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &fill_factor, argv[0]))
+    return JS_EXCEPTION;
+
+  dybase_bulk_insert_in_index(pst->hs, index_oid, dybase_get_index_type(pst->hs, index_oid), NULL, 0, fill_factor);
+
+  return JS_UNDEFINED;
+}
+
 static JSValue db_index_delete(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
   return JS_UNDEFINED;
 }
@@ -972,6 +2155,7 @@ static JSValue db_index_get_type(JSContext *ctx, JSValueConst this_val) {
     case dybase_long_type: return JS_NewString(ctx, "long");
     case dybase_real_type: return JS_NewString(ctx, "float");
     case dybase_date_type: return JS_NewString(ctx, "date");
+    case dybase_bytes_type: return JS_NewString(ctx, "composite");
     default: break;
   }
   return JS_NULL;
@@ -999,6 +2183,7 @@ static const JSCFunctionListEntry js_index_proto_funcs[] = {
   JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Storage.Index", JS_PROP_CONFIGURABLE),
   JS_CFUNC_DEF("delete", 1, db_index_delete),
   JS_CFUNC_DEF("clear", 0, db_index_clear),
+  JS_CFUNC_DEF("rebuild", 1, db_index_rebuild),
   JS_CFUNC_DEF("get", 1, db_index_get),
   JS_CFUNC_DEF("set", 2, db_index_set),
   JS_CFUNC_DEF("select", 5, db_index_select),
@@ -1013,11 +2198,28 @@ static JSClassDef js_index_class = {
     //.finalizer = js_index_finalizer
 };
 
+#define INDEX_ITERATOR_BATCH 64
+
 typedef struct IndexIterator {
   JSStorage* pst;
   dybase_iterator_t iterator;
+  int pos;   // position of the next oid in batch
+  int count; // number of oids in batch
+  uint32_t snapshot_gen; // iteration ends when the snapshot is moved
+  dybase_oid_t batch[INDEX_ITERATOR_BATCH];
 } IndexIterator;
 
+// fetches next batch of oids and starts read-ahead of their objects
+static int db_index_iterator_fill(IndexIterator *it)
+{
+  it->pos = 0;
+  it->count = dybase_index_iterator_next_n(it->iterator, it->batch, INDEX_ITERATOR_BATCH);
+  if (it->count)
+    dybase_prefetch_objects(it->pst->hs, it->batch, it->count);
+  return it->count;
+}
+
+// next() returns next object, next(n) returns array of up to n objects
 static JSValue js_index_iterator_next(JSContext *ctx, JSValueConst this_val,
   int argc, JSValueConst *argv,
   BOOL *pdone, int magic) 
@@ -1026,15 +2228,51 @@ static JSValue js_index_iterator_next(JSContext *ctx, JSValueConst this_val,
   if (!it)
     return JS_EXCEPTION;
 
-  dybase_oid_t oid = dybase_index_iterator_next( it->iterator );
+  db_check_snapshot(ctx, it->pst);
+  if (it->snapshot_gen != it->pst->snapshot_gen) {
+    *pdone = TRUE;
+    return JS_UNDEFINED;
+  }
+
+  if (argc > 0 && !JS_IsUndefined(argv[0])) {
+    uint32_t n, i;
+    if (JS_ToUint32(ctx, &n, argv[0]))
+      return JS_EXCEPTION;
+    // an empty batch would never end a next(n) loop
+    if (n == 0)
+      return JS_ThrowRangeError(ctx, "batch size must be positive");
+    JSValue arr = JS_NewArray(ctx);
+    if (JS_IsException(arr))
+      return arr;
+    for (i = 0; i < n; i++) {
+      if (it->pos == it->count && !db_index_iterator_fill(it))
+        break;
+      JSValue item = db_load_object(ctx, it->pst, it->batch[it->pos++]);
+      if (JS_IsException(item)) {
+        JS_FreeValue(ctx, arr);
+        return JS_EXCEPTION;
+      }
+      if (JS_SetPropertyUint32(ctx, arr, i, item) < 0) {
+        JS_FreeValue(ctx, arr);
+        return JS_EXCEPTION;
+      }
+    }
+    if (i == 0) {
+      JS_FreeValue(ctx, arr);
+      *pdone = TRUE;
+      return JS_UNDEFINED;
+    }
+    *pdone = FALSE;
+    return arr;
+  }
 
-  if (!oid) {
+  if (it->pos == it->count && !db_index_iterator_fill(it)) {
     *pdone = TRUE;
     return JS_UNDEFINED;
   }
 
   *pdone = FALSE;
-  JSValue item = db_load_object(ctx, it->pst, oid);
+  JSValue item = db_load_object(ctx, it->pst, it->batch[it->pos++]);
   return item;
 }
 
@@ -1058,17 +2296,45 @@ static JSValue db_index_select(JSContext *ctx, JSValueConst this_val, int argc,
   JS_SetOpaque(enum_obj, it);
 
   it->pst = pst;
+  it->pos = it->count = 0;
+  it->snapshot_gen = pst->snapshot_gen;
 
   db_triplet start;
   db_triplet end;
 
-  db_transform(ctx, pst, argv[0], &start);
-  db_transform(ctx, pst, argv[1], &end);
-
   int ascending = 1; if (argc >= 3) ascending = JS_ToBool(ctx, argv[2]) > 0;
   int start_inclusive = 1; if (argc >= 4) start_inclusive = JS_ToBool(ctx, argv[3]) > 0;
   int end_inclusive = 1; if (argc >= 5) end_inclusive = JS_ToBool(ctx, argv[4]) > 0;
-  
+
+  byte start_key[DYBASE_MAX_KEY_LENGTH + 1];
+  byte end_key[DYBASE_MAX_KEY_LENGTH + 1];
+
+  if (db_find_autoindex(pst, index_oid)) {
+    // boundaries are key prefixes, prefix + DB_KEY_HIGH follows all keys with the prefix
+    start.type = end.type = dybase_bytes_type;
+    start.data.s = end.data.s = NULL;
+    start.len = end.len = 0;
+    if (!JS_IsUndefined(argv[0]) && !JS_IsNull(argv[0])) {
+      if ((start.len = db_encode_key(ctx, argv[0], start_key)) < 0)
+        goto invalid_key;
+      start.data.s = start_key;
+      if (!start_inclusive) {
+        start_key[start.len++] = DB_KEY_HIGH;
+        start_inclusive = 1;
+      }
+    }
+    if (!JS_IsUndefined(argv[1]) && !JS_IsNull(argv[1])) {
+      if ((end.len = db_encode_key(ctx, argv[1], end_key)) < 0)
+        goto invalid_key;
+      end.data.s = end_key;
+      if (end_inclusive)
+        end_key[end.len++] = DB_KEY_HIGH;
+    }
+  } else {
+    db_transform(ctx, pst, argv[0], &start);
+    db_transform(ctx, pst, argv[1], &end);
+  }
+
   it->iterator = dybase_create_index_iterator(
     pst->hs, index_oid, start.type,
     keyptr(&start), start.len, start_inclusive,
@@ -1080,6 +2346,9 @@ static JSValue db_index_select(JSContext *ctx, JSValueConst this_val, int argc,
 
   if(it->iterator)
     return enum_obj;
+  goto fail1;
+invalid_key:
+  JS_ThrowTypeError(ctx, "invalid key");
 fail1:
   JS_FreeValue(ctx, enum_obj);
 fail:
@@ -1106,6 +2375,8 @@ static JSValue db_create_index_iterator(JSContext *ctx, JSValueConst this_val, i
   JS_SetOpaque(enum_obj, it);
 
   it->pst = pst;
+  it->pos = it->count = 0;
+  it->snapshot_gen = pst->snapshot_gen;
 
   int index_type = dybase_get_index_type(pst->hs, index_oid);
 
@@ -139,9 +139,343 @@ function test()
   assert(deepEqual(r,[{a:1},{b:2}]));  
 
   storage.close();
+}
+
+// commit() stores only objects modified since the previous commit
+function testCommit()
+{
+  let storage = Storage.open(path);
+  let types = storage.root.types;
+  types.tinteger = 43;
+  storage.commit();
+  types.tobject.d = 4;
+  types.tnew = { list: [4,5,6] };
+  storage.commit();
+  storage.commit(); // nothing to store
+  storage.close();
+
+  storage = Storage.open(path);
+  types = storage.root.types;
+  assert(types.tinteger, 43);
+  assert(deepEqual(types.tobject, { a:1, b:2, c:3, d:4 }));
+  assert(deepEqual(types.tnew.list, [4,5,6]));
+  assert(types.tstring, "forty two");
+  storage.close();
+}
+
+// element writes on stored arrays are committed too
+function testArrayWrite()
+{
+  let storage = Storage.open(path);
+  storage.root.types.tarray[1] = 20;
+  storage.commit();
+  storage.root.types.tarray[2] = 30;
+  storage.root.types.tarray[3] = 40;
+  storage.close();
+
+  storage = Storage.open(path);
+  let arr = storage.root.types.tarray;
+  arr[0] = 10; // dormant array
+  storage.close();
+
+  storage = Storage.open(path);
+  assert(storage.root.types.tarray.join(), "10,20,30,40");
+  storage.close();
+}
+
+function testBulkInsert()
+{
+  let storage = Storage.open(path);
+  let istring = storage.root.indexes.istring;
+  let entries = [];
+  for (let i = 0; i < 5000; i++) {
+    let k = (i * 7919) % 5000;
+    entries.push(["k" + String(k).padStart(4, "0"), { k }]);
+  }
+  entries.push(["a", { k: -1 }]); // already present, skipped
+  assert(storage.bulkInsert(istring, entries), 5000);
+  assert(istring.length, 5003);
+  assert(istring.get("a").a, 1);
+  istring.rebuild(70);
+  storage.close();
+
+  storage = Storage.open(path);
+  istring = storage.root.indexes.istring;
+  assert(istring.length, 5003);
+  assert(istring.get("k1234").k, 1234);
+  let r = [];
+  for (let obj of istring.select("k0998", "k1001"))
+    r.push(obj.k);
+  assert(r.join(), "998,999,1000,1001");
+  storage.close();
+}
+
+function testMmapRead()
+{
+  let storage = Storage.open(path, true, { mmap: true });
+  let istring = storage.root.indexes.istring;
+  istring.set("mm", { k: "mm" });
+  storage.root.big = new Array(20000).fill(0).map((v, i) => ({ i }));
+  storage.close();
+
+  storage = Storage.open(path, false, { mmap: true });
+  istring = storage.root.indexes.istring;
+  assert(istring.get("mm").k, "mm");
+  assert(istring.get("k1234").k, 1234);
+  assert(storage.root.big.length, 20000);
+  assert(storage.root.big[19999].i, 19999);
+  storage.close();
+}
+
+function testWal()
+{
+  let storage = Storage.open(path, true, { wal: true });
+  let root = storage.root;
+  for (let i = 0; i < 10; i++) {
+    root.walCounter = i;
+    storage.commit();
+  }
+  assert(os.stat(path + "-wal")[1], 0, "log exists while storage is open");
+  storage.close();
+  assert(os.stat(path + "-wal")[1] != 0, true, "log is removed on close");
+
+  storage = Storage.open(path);
+  assert(storage.root.walCounter, 9);
+  storage.close();
+}
+
+function testSelectBatch()
+{
+  let storage = Storage.open(path);
+  let istring = storage.root.indexes.istring;
+  let it = istring.select("k0000", "k4999");
+  let total = 0, batches = 0;
+  for (let r = it.next(1000); !r.done; r = it.next(1000)) {
+    batches++;
+    for (let obj of r.value)
+      assert(obj.k, total++);
+  }
+  assert(total, 5000);
+  assert(batches, 5);
+  let error;
+  try { istring.select("k0000", "k0001").next(0); } catch (e) { error = e; }
+  assert(error instanceof RangeError, true, "next(0) throws");
+  let r = [];
+  for (let obj of istring.select("k0100", "k0299", false))
+    r.push(obj.k);
+  assert(r.length, 200);
+  assert(r[0], 299);
+  storage.close();
+}
+
+// objects sharing a shape are stored by layout, others as maps
+function testLayout()
+{
+  class Point { constructor(x, y) { this.x = x; this.y = y; } }
+  let storage = Storage.open(path);
+  let dict = {};
+  for (let i = 0; i < 40; i++)
+    dict["k" + i] = i;
+  let sparse = { a: 1, b: 2, c: 3 };
+  delete sparse.b;
+  storage.root.layout = {
+    points: [new Point(1, 2), new Point(3, 4)],
+    dict, sparse, dot: { ".": 1 }
+  };
+  storage.close();
+
+  storage = Storage.open(path);
+  let layout = storage.root.layout;
+  assert(layout.points[1].y, 4); // prototype is set when the object is loaded
+  assert(layout.points[1] instanceof Point, true);
+  assert(Object.keys(layout.points[0]).join(), "x,y");
+  assert(Object.keys(layout.dict).length, 40);
+  assert(Object.keys(layout.sparse).join(), "a,c");
+  assert(layout.dot["."], 1);
+
+  layout.plain = { x: 2 };
+  storage.close();
+
+  // same fields, different prototypes: the cached shape is not shared
+  storage = Storage.open(path);
+  let bare = Object.create(null);
+  bare.x = 1;
+  storage.root.layout.bare = bare;
+  storage.commit();
+  let plain = storage.root.layout.plain;
+  assert(plain.x, 2);
+  assert(Object.getPrototypeOf(plain), Object.prototype);
+  storage.close();
+}
+
+// indexes over fields and key functions are updated by commit
+function testAutoIndex()
+{
+  class Person { constructor(last, first, age) { this.last = last; this.first = first; this.age = age; } }
+  const ageDigit = p => p.age >= 0 ? p.age % 10 : undefined;
+  let storage = Storage.open(path);
+  let thrown = false;
+  try { storage.createIndex({ key: ageDigit }); } catch (e) { thrown = e instanceof TypeError; }
+  assert(thrown, true, "key functions are defined by name");
+  storage.defineKey("ageDigit", ageDigit);
+  storage.root.people = {
+    byName: storage.createIndex({ fields: ["last", "first"], class: Person }),
+    byAge: storage.createIndex({ key: "ageDigit" }),
+    list: []
+  };
+  storage.close();
+
+  storage = Storage.open(path);
+  storage.defineKey("ageDigit", ageDigit);
+  let people = storage.root.people;
+  people.list.push(new Person("Smith", "John", 30), new Person("Smith", "Anna", 41),
+                   new Person("Brown", "Bob", 22), { last: "Smith", first: "Zed" });
+  storage.commit();
+  let names = (it) => [...it].map(p => p.first).join();
+  assert(people.byName.type, "composite");
+  assert(names(people.byName), "Bob,Anna,John");
+  assert(people.byName.get("Smith").length, 2);
+  assert(people.byName.get(["Smith", "John"])[0].age, 30);
+  assert(names(people.byAge.select(1, null)), "Anna,Bob");
+  people.list[0].first = "Jim";
+  people.list[2].last = "Adams";
+  storage.close();
+
+  // key function is not defined: the index is rebuilt once it is
+  storage = Storage.open(path);
+  people = storage.root.people;
+  assert(names(people.byName), "Bob,Anna,Jim");
+  assert(names(people.byName.select(["Brown"], null, true, false)), "Anna,Jim");
+  assert(names(people.byName.select(null, ["Smith"], true, true, false)), "Bob");
+  thrown = false;
+  try { people.byName.set("x", {}); } catch (e) { thrown = true; }
+  assert(thrown, true);
+  people.list[1].age = 45;
+  storage.close();
+  storage = Storage.open(path);
+  people = storage.root.people;
+  storage.defineKey("ageDigit", ageDigit);
+  assert(names(people.byAge.select(1, null)), "Bob,Anna");
+
+  // objects stored before the index was created are indexed
+  people.byFirst = storage.createIndex({ fields: "first", unique: true });
+  assert(names(people.byFirst), "Anna,Bob,Jim,Zed");
+
+  // objects dropped from the storage are removed by GC
+  people.list.splice(1, 1);
+  storage.close();
+  storage = Storage.open(path);
+  people = storage.root.people;
+  assert(names(people.byFirst), "Bob,Jim,Zed");
+  assert(names(people.byName), "Bob,Jim");
+  assert(people.byName.get(["Smith", "Anna"]).length, 0);
+
+  // BigInt keys wider than 64 bits keep their order
+  let nums = [3, -1, 0, 1000, -70000, 2];
+  people.nums = nums.map(n => ({ n }));
+  storage.defineKey("wide", o => typeof o.n == "number" ? BigInt(o.n) << 64n : undefined);
+  people.byWide = storage.createIndex({ key: "wide" });
+  storage.commit();
+  assert([...people.byWide].map(o => o.n).join(), nums.sort((a, b) => a - b).join());
+  assert(people.byWide.get(1000n << 64n)[0].n, 1000);
+  assert(people.byWide.get(1000n).length, 0);
+  storage.close();
+}
 
-  print("PASSED");
+// unreachable objects are collected by commits, compact() shrinks the file
+function testIncrementalGC()
+{
+  let storage = Storage.open(path, true, { gcIncrement: 100 });
+  storage.root.garbage = new Array(2000).fill(0).map((v, i) => ({ i, s: "x".repeat(100) }));
+  storage.commit();
+  let kept = storage.root.garbage[7];
+  delete storage.root.garbage;
+  for (let i = 0; i < 10; i++) {
+    storage.root.gcCounter = i;
+    storage.commit();
+  }
+  while (!storage.gcStep(1000)); // cycle started by open
+  while (!storage.gcStep(1000)); // garbage is unreachable at start of this cycle
+  let stats = storage.gcStats;
+  assert(stats.active, false);
+  assert(stats.freedObjects >= 1999, true, "garbage is collected");
+  storage.root.kept = kept; // referenced only by JS value during the cycle
+  let size = stats.fileSize;
+  while (storage.compact(1000) > 0);
+  assert(storage.gcStats.fileSize < size, true, "file is truncated");
+  storage.close();
+
+  storage = Storage.open(path);
+  assert(storage.root.kept.i, 7);
+  assert(storage.root.indexes.istring.get("k1234").k, 1234);
+  assert(storage.root.people.byName.get(["Smith", "Jim"])[0].age, 30);
+  storage.close();
+}
+
+// read only storage is a snapshot of the last commit of the writer
+function testSnapshot()
+{
+  let storage = Storage.open(path);
+  storage.root.snap = { n: 0, list: [] };
+  storage.commit();
+  let view = Storage.open(path, false);
+  let snap = view.root.snap;
+  storage.root.snap.n = 1;
+  storage.root.snap.list.push(1);
+  storage.commit();
+  assert(snap.n, 0, "view reads commit made before it was opened");
+  assert(snap.list.length, 0);
+  storage.root.snap.n = 2;
+  storage.root.snap.list.push(2);
+  storage.commit();
+  assert(view.refresh(), true);
+  assert(view.root.snap.n, 2);
+  assert(view.root.snap.list.join(), "1,2");
+  storage.close();
+  assert(view.refresh(), true, "writer is closed, snapshot is read from file");
+  assert(view.root.snap.list.join(), "1,2");
+  view.close();
+}
+
+// snapshot used by the thread of the writer is moved by the writer's next
+// transaction, objects loaded from it are detached instead of reading the new commit
+function testSnapshotMoved()
+{
+  let storage = Storage.open(path);
+  storage.root.moved = { n: 0, list: [0], items: [{ v: 0 }] };
+  storage.commit();
+  let view = Storage.open(path, false);
+  let root = view.root;
+  let moved = root.moved;
+  assert(moved.n, 0);
+  storage.root.moved.n = 1;
+  storage.root.moved.list.push(1);
+  storage.root.moved.items[0].v = 1;
+  storage.commit();
+  storage.root.moved.n = 2;
+  storage.root.moved.list.push(2);
+  storage.commit(); // can not wait for the view of this thread, moves it to the first commit
+  assert(moved.list.length, 0, "dormant object of the moved snapshot is detached");
+  assert(moved.n, 0, "loaded object keeps its state");
+  assert(view.root !== root, true);
+  assert(view.root.moved.n, 1);
+  assert(view.root.moved.list.join(), "0,1");
+  assert(view.root.moved.items[0].v, 1);
+  storage.close();
+  view.close();
 }
 
 init();
-test();
\ No newline at end of file
+test();
+testCommit();
+testArrayWrite();
+testBulkInsert();
+testMmapRead();
+testWal();
+testSelectBatch();
+testLayout();
+testAutoIndex();
+testIncrementalGC();
+testSnapshot();
+testSnapshotMoved();
+print("PASSED");
@@ -102,6 +102,30 @@ function test_getline()
 
     f.close();
 }
+
+function test_read_chunks()
+{
+    var f, str, chunk, buffer, n;
+
+    str = "0123456789abcdef";
+    f = std.tmpfile();
+    f.puts(str);
+    f.seek(0, std.SEEK_SET);
+    n = 0;
+    for(chunk of f.readChunks(6)) {
+        /* the chunks share the same buffer */
+        if (n == 0)
+            buffer = chunk.buffer;
+        assert(chunk.buffer === buffer);
+        assert(String.fromCharCode.apply(null, chunk), str.substring(n, n + 6));
+        n += chunk.length;
+    }
+    assert(n, str.length);
+    f.seek(4, std.SEEK_SET);
+    assert(f.readAsString(3), "456");
+    assert(f.readAsString(), str.substring(7));
+    f.close();
+}
  
 function test_popen()
 {
@@ -270,12 +294,40 @@ function test_timer()
         os.clearTimeout(th[i]);
 }
 
+function test_async_io()
+{
+    var fname = "/tmp/qjs_async.txt";
+    var fd, wbuf, rbuf;
+
+    fd = os.open(fname, os.O_RDWR | os.O_CREAT | os.O_TRUNC);
+    assert(fd >= 0);
+    wbuf = new Uint8Array([ 0x61, 0x62, 0x63, 0x64 ]);
+    rbuf = new Uint8Array(4);
+    os.writeAsync(fd, wbuf.buffer, 0, 4, 0).then(function (ret) {
+        assert(ret, 4);
+        return Promise.all([ os.readAsync(fd, rbuf.buffer, 1, 3, 1),
+                             std.loadFileAsync(fname),
+                             std.loadFileAsync(fname + ".none"),
+                             os.readAsync(-1, rbuf.buffer, 0, 1) ]);
+    }).then(function (ret) {
+        assert(ret.join(), "3,abcd,," + -std.Error.EBADF);
+        assert(rbuf.join(), "0,98,99,100");
+        os.close(fd);
+        os.remove(fname);
+    }).catch(function (e) {
+        print(e, e.stack);
+        std.exit(1);
+    });
+}
+
 test_printf();
 test_file1();
 test_file2();
 test_getline();
+test_read_chunks();
 test_popen();
 test_os();
 test_os_exec();
 test_timer();
+test_async_io();
 test_ext_json();
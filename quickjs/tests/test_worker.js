@@ -21,12 +21,66 @@ function assert(actual, expected, message) {
 
 var worker;
 
+/* plain data cloned by postMessage() */
+function clone_data()
+{
+    var records = [], big = {}, sparse = [1, 2], cyc = { name: "cyc" }, i;
+    /* records sharing their shape, and others in between */
+    for(i = 0; i < 20; i++) {
+        if (i % 5 == 4)
+            records.push({ id: i, extra: true });
+        else
+            records.push({ id: i, name: "r" + i, tags: [i, i + 0.5] });
+    }
+    for(i = 0; i < 20; i++)
+        big["p" + i] = i;
+    sparse[5] = 6;
+    cyc.self = cyc;
+    return { records: records, big: big, sparse: sparse,
+             idx: { 1: "a", 0: "b", x: "c" },
+             proto: JSON.parse('{ "__proto__": 1 }'),
+             cyc: cyc, shared: [cyc, cyc] };
+}
+
+function check_clone(d)
+{
+    var r = d.records;
+    assert(JSON.stringify(r), JSON.stringify(clone_data().records));
+    assert(r[4].extra, true);
+    assert(r[5].name, "r5");
+    /* the shared shapes are not modified by the other objects */
+    r[0].added = 1;
+    assert(r[1].added, undefined);
+    delete r[2].name;
+    assert(r[3].name, "r3");
+    assert(Object.keys(d.big).length, 20);
+    assert(d.big.p19, 19);
+    assert(d.sparse.length, 6);
+    assert(d.sparse[5], 6);
+    assert(Object.keys(d.idx).join(), "0,1,x");
+    assert(Object.getPrototypeOf(d.proto), Object.prototype);
+    assert(d.proto.hasOwnProperty("__proto__"), true);
+    assert(d.cyc.self, d.cyc);
+    assert(d.shared[0], d.cyc);
+    assert(d.shared[1], d.cyc);
+}
+
 function test_worker()
 {
     var counter;
 
     worker = new os.Worker("./test_worker_module.js");
 
+    /* invalid transfer lists are rejected before anything is moved */
+    let ab = new ArrayBuffer(8), err = null;
+    try {
+        worker.postMessage({ a: 1 }, [ 1, ab ]);
+    } catch (e) {
+        err = e;
+    }
+    assert(err instanceof TypeError);
+    assert(ab.byteLength, 8);
+
     counter = 0;
     worker.onmessage = function (e) {
         var ev = e.data;
@@ -47,9 +101,24 @@ function test_worker()
                 let buf = ev.buf;
                 /* check that the SharedArrayBuffer was modified */
                 assert(buf[2], 10);
-                worker.postMessage({ type: "abort" });
+                /* test ArrayBuffer transfer */
+                let ab = new ArrayBuffer(16);
+                let buf1 = new Uint8Array(ab);
+                buf1[3] = 5;
+                worker.postMessage({ type: "transfer", buf: buf1 }, [ab]);
+                assert(ab.byteLength, 0);
+                assert(buf1.length, 0);
             }
             break;
+        case "transfer_done":
+            assert(ev.buf.length, 16);
+            assert(ev.buf[3], 6);
+            worker.postMessage({ type: "clone", data: clone_data() });
+            break;
+        case "clone_done":
+            check_clone(ev.data);
+            worker.postMessage({ type: "abort" });
+            break;
         case "done":
             /* terminate */
             worker.onmessage = null;
@@ -58,5 +127,27 @@ function test_worker()
     };
 }
 
+function test_worker_pool()
+{
+    var pool, count, sum;
+
+    pool = new os.WorkerPool("./test_worker_module.js", 2);
+    count = 0;
+    sum = 0;
+    pool.onmessage = function (e) {
+        var ev = e.data;
+        /* the "num" messages sent by each worker at startup are ignored */
+        if (ev.type != "square_done")
+            return;
+        sum += ev.num;
+        if (++count == 8) {
+            assert(sum, 140);
+            pool.onmessage = null;
+        }
+    };
+    for(var i = 0; i < 8; i++)
+        pool.postMessage({ type: "square", num: i });
+}
 
 test_worker();
+test_worker_pool();
@@ -16,6 +16,17 @@ function handle_msg(e) {
         ev.buf[2] = 10;
         parent.postMessage({ type: "sab_done", buf: ev.buf });
         break;
+    case "square":
+        parent.postMessage({ type: "square_done", num: ev.num * ev.num });
+        break;
+    case "clone":
+        parent.postMessage({ type: "clone_done", data: ev.data });
+        break;
+    case "transfer":
+        /* the buffer is moved back to the parent */
+        ev.buf[3]++;
+        parent.postMessage({ type: "transfer_done", buf: ev.buf }, [ev.buf.buffer]);
+        break;
     }
 }
 
@@ -16,6 +16,7 @@ static void JsClosure_Finalizer(JSRuntime* rt, JSValue val)
     JsClosure* obj = (JsClosure*)JS_GetOpaque(val, g_JsClosureClassId);
     if (obj)
     {
+        delete reinterpret_cast<Closure*>(obj->ptr);
         delete obj;
     }
 }
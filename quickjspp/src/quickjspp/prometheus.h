@@ -0,0 +1,103 @@
+#pragma once
+#include "quickjspp.h"
+#include <string>
+#include <string_view>
+namespace qjs
+{
+namespace detail
+{
+inline void AppendPrometheusHeader(std::string& out, std::string_view prefix, std::string_view name,
+                                   std::string_view type, std::string_view help)
+{
+    out.append("# HELP ").append(prefix).append(name).append(" ").append(help).append("\n");
+    out.append("# TYPE ").append(prefix).append(name).append(" ").append(type).append("\n");
+}
+inline void AppendPrometheusSample(std::string& out, std::string_view prefix, std::string_view name,
+                                   std::string_view labels, const std::string& value)
+{
+    out.append(prefix).append(name);
+    if (!labels.empty())
+        out.append("{").append(labels).append("}");
+    out.append(" ").append(value).append("\n");
+}
+inline std::string EscapePrometheusLabel(std::string_view s)
+{
+    std::string res;
+    for (char c : s)
+    {
+        if (c == '\\' || c == '"')
+            res.push_back('\\');
+        if (c == '\n')
+        {
+            res.append("\\n");
+            continue;
+        }
+        res.push_back(c);
+    }
+    return res;
+}
+} // namespace detail
+
+/**
+ * Format the runtime counters in the Prometheus text exposition format.
+ * Every metric name starts with prefix.
+ * The stats are taken on the runtime's thread, formatting may happen
+ * on the thread serving the scrape.
+ * usage:
+ *   std::string body = qjs::FormatPrometheus(runtime.GetStats());
+ */
+inline std::string FormatPrometheus(const RuntimeStats& stats, std::string_view prefix = "quickjs_")
+{
+    const JSRuntimeStats& s = stats.counters;
+    std::string out;
+    auto seconds = [](int64_t us) { return std::to_string(static_cast<double>(us) / 1e6); };
+
+    detail::AppendPrometheusHeader(out, prefix, "heap_bytes", "gauge", "Bytes currently allocated.");
+    detail::AppendPrometheusSample(out, prefix, "heap_bytes", "", std::to_string(s.malloc_size));
+    detail::AppendPrometheusHeader(out, prefix, "heap_blocks", "gauge", "Blocks currently allocated.");
+    detail::AppendPrometheusSample(out, prefix, "heap_blocks", "", std::to_string(s.malloc_count));
+
+    const struct
+    {
+        const char* type;
+        int64_t count, size;
+    } allocs[] = {
+        {"all", s.alloc_count, s.alloc_size},
+        {"object", s.obj_alloc_count, s.obj_alloc_size},
+        {"string", s.str_alloc_count, s.str_alloc_size},
+        {"shape", s.shape_alloc_count, s.shape_alloc_size},
+        {"function", s.js_func_alloc_count, s.js_func_alloc_size},
+        {"array_buffer", s.binary_alloc_count, s.binary_alloc_size},
+    };
+    detail::AppendPrometheusHeader(out, prefix, "allocations_total", "counter", "Allocations by type.");
+    for (const auto& a : allocs)
+        detail::AppendPrometheusSample(out, prefix, "allocations_total",
+                                       std::string("type=\"") + a.type + "\"", std::to_string(a.count));
+    detail::AppendPrometheusHeader(out, prefix, "allocated_bytes_total", "counter", "Allocated bytes by type.");
+    for (const auto& a : allocs)
+        detail::AppendPrometheusSample(out, prefix, "allocated_bytes_total",
+                                       std::string("type=\"") + a.type + "\"", std::to_string(a.size));
+
+    detail::AppendPrometheusHeader(out, prefix, "gc_runs_total", "counter", "Cycle collections.");
+    detail::AppendPrometheusSample(out, prefix, "gc_runs_total", "", std::to_string(s.gc_count));
+    detail::AppendPrometheusHeader(out, prefix, "gc_pause_seconds_total", "counter", "Time spent in cycle collections.");
+    detail::AppendPrometheusSample(out, prefix, "gc_pause_seconds_total", "", seconds(s.gc_time));
+    detail::AppendPrometheusHeader(out, prefix, "gc_pause_max_seconds", "gauge", "Longest cycle collection.");
+    detail::AppendPrometheusSample(out, prefix, "gc_pause_max_seconds", "", seconds(s.gc_max_time));
+
+    detail::AppendPrometheusHeader(out, prefix, "jobs_total", "counter", "Executed jobs.");
+    detail::AppendPrometheusSample(out, prefix, "jobs_total", "", std::to_string(s.job_count));
+    detail::AppendPrometheusHeader(out, prefix, "c_calls_total", "counter", "Calls of C functions.");
+    detail::AppendPrometheusSample(out, prefix, "c_calls_total", "", std::to_string(s.c_call_count));
+    detail::AppendPrometheusHeader(out, prefix, "exceptions_total", "counter", "Thrown exceptions.");
+    detail::AppendPrometheusSample(out, prefix, "exceptions_total", "", std::to_string(s.exception_count));
+
+    detail::AppendPrometheusHeader(out, prefix, "objects", "gauge", "Live objects by class.");
+    for (const auto& c : stats.classes)
+        detail::AppendPrometheusSample(out, prefix, "objects",
+                                       "class=\"" + detail::EscapePrometheusLabel(c.name) +
+                                           "\",id=\"" + std::to_string(c.id) + "\"",
+                                       std::to_string(c.objectCount));
+    return out;
+}
+} // namespace qjs
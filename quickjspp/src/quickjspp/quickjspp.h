@@ -187,6 +187,58 @@ private:
     detail::Class m_Class;
 };
 class Context;
+/**
+ * Interned property name. Create it once with Context::CreateAtom and
+ * reuse it with the atom based Value::GetProperty/SetProperty overloads
+ * to skip hashing the name on every access.
+ */
+class Atom
+{
+public:
+    Atom(JSAtom atom, JSContext* context) :
+        m_Atom(atom), m_Context(context)
+    {
+        assert(context != nullptr);
+    }
+    Atom(const Atom&) = delete;
+    Atom& operator=(const Atom&) = delete;
+    Atom(Atom&& other) noexcept :
+        m_Atom(other.m_Atom), m_Context(other.m_Context)
+    {
+        other.m_Atom = JS_ATOM_NULL;
+        other.m_Context = nullptr;
+    }
+    Atom& operator=(Atom&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_Context && m_Atom != JS_ATOM_NULL)
+                JS_FreeAtom(m_Context, m_Atom);
+            m_Atom = other.m_Atom;
+            m_Context = other.m_Context;
+            other.m_Atom = JS_ATOM_NULL;
+            other.m_Context = nullptr;
+        }
+        return *this;
+    }
+    ~Atom()
+    {
+        if (m_Context && m_Atom != JS_ATOM_NULL)
+            JS_FreeAtom(m_Context, m_Atom);
+    }
+    JSAtom GetRaw() const
+    {
+        return m_Atom;
+    }
+    bool IsNull() const
+    {
+        return m_Atom == JS_ATOM_NULL;
+    }
+
+private:
+    JSAtom m_Atom = JS_ATOM_NULL;
+    JSContext* m_Context = nullptr;
+};
 class Value
 {
 public:
@@ -230,6 +282,10 @@ public:
     {
         return m_Value;
     }
+    JSContext* GetContext() const
+    {
+        return m_Context;
+    }
     //@note value的所有权会被JS_SetPropertyStr接管
     void SetPropertyStr(const char* name, Value&& value)
     {
@@ -237,7 +293,12 @@ public:
     }
     void SetProperty(const char* name,Value&& value)
     {
-        JS_SetProperty(m_Context, m_Value, JS_NewString(m_Context, name), value.Unwrap());
+        JS_SetPropertyStr(m_Context, m_Value, name, value.Unwrap());
+    }
+    //@note value的所有权会被JS_SetProperty接管
+    void SetProperty(const Atom& name, Value&& value)
+    {
+        JS_SetProperty(m_Context, m_Value, name.GetRaw(), value.Unwrap());
     }
     Value GetProperty(const char* name)
     {
@@ -249,6 +310,16 @@ public:
         }
         return Value(prop, m_Context);
     }
+    Value GetProperty(const Atom& name)
+    {
+        JSValue prop = JS_GetProperty(m_Context, m_Value, name.GetRaw());
+        if (JS_IsException(prop))
+        {
+            JS_FreeValue(m_Context, prop);
+            return Value(JS_UNDEFINED, m_Context); // 返回一个未定义的值
+        }
+        return Value(prop, m_Context);
+    }
     bool IsUndefined()const 
     {
         return JS_IsUndefined(m_Value);
@@ -299,6 +370,23 @@ private:
     JSValue m_Value = JS_UNDEFINED;
     JSContext* m_Context = nullptr;
 };
+/**
+ * Counters of a runtime, see Runtime::GetStats. They are maintained
+ * incrementally by the runtime, so taking a snapshot does not walk the
+ * heap like JS_ComputeMemoryUsage. The snapshot is a copy which may be
+ * passed to another thread.
+ */
+struct RuntimeStats
+{
+    struct ClassStats
+    {
+        JSClassID id;
+        std::string name;
+        int64_t objectCount;
+    };
+    JSRuntimeStats counters;
+    std::vector<ClassStats> classes; // registered classes
+};
 class Runtime
 {
 public:
@@ -344,6 +432,21 @@ public:
     {
         return m_Runtime;
     }
+    /**
+     * Snapshot of the counters. The runtime updates them without
+     * synchronization, so call it on the thread running the runtime
+     * (e.g. post it to the event loop) and hand the result to the
+     * thread which exports it.
+     */
+    RuntimeStats GetStats() const
+    {
+        RuntimeStats stats;
+        JS_GetRuntimeStats(m_Runtime, &stats.counters);
+        JS_EnumClassStats(m_Runtime, [](void* opaque, JSClassID id, const char* name, int64_t count) {
+            static_cast<RuntimeStats*>(opaque)->classes.push_back({id, name, count});
+        }, &stats);
+        return stats;
+    }
 
 private:
     Runtime() = default;
@@ -407,6 +510,15 @@ public:
         JSValue global = JS_GetGlobalObject(m_Context);
         return Value(global, m_Context);
     }
+    /**
+     * Intern a property name. The atom stays valid as long as the
+     * returned handle is alive.
+    */
+    Atom CreateAtom(std::string_view name)
+    {
+        JSAtom atom = JS_NewAtomLen(m_Context, name.data(), name.length());
+        return Atom(atom, m_Context);
+    }
     Value CreateFunction(JSCFunction* func, const char* name, int length)
     {
         JSValue function = JS_NewCFunction(m_Context, func, name, length);
@@ -430,6 +542,16 @@ public:
         auto c = detail::WrapClosure(closure);
         return CreateClosureNoWrap(std::move(c));
     }
+    /**
+     * Expose a coroutine returning qjs::Task<R> as a JS function returning
+     * a Promise settled with its result. Defined in quickjspp/task.h.
+     * usage:
+     *      context.CreateAsyncClosure([&](std::string path) -> qjs::Task<std::string> {
+     *          co_return co_await host.ReadFile(path);
+     *      });
+    */
+    template <typename F>
+    Value CreateAsyncClosure(const F& func);
     template<typename T>
     Value Create(const T& value)
     {
@@ -535,4 +657,5 @@ inline std::string Value::Convert<std::string>() const
     return result;
 }
 
-} // namespace qjs
\ No newline at end of file
+} // namespace qjs
+#include "task.h"
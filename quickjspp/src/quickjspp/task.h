@@ -0,0 +1,520 @@
+#pragma once
+#include "quickjspp.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+namespace qjs
+{
+namespace detail
+{
+template <>
+struct ConvertToJsType<Value>
+{
+    static JSValue Convert(JSContext* ctx, const Value& value)
+    {
+        return JS_DupValue(ctx, value.GetRaw());
+    }
+};
+// Error objects are reported by their message, other values as strings
+inline std::string RejectionMessage(JSContext* ctx, JSValueConst reason)
+{
+    JSValue message = JS_IsError(ctx, reason) ? JS_GetPropertyStr(ctx, reason, "message") : JS_DupValue(ctx, reason);
+    auto res = ConvertToCppType<std::string>::Convert(ctx, message);
+    JS_FreeValue(ctx, message);
+    if (!res)
+    {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return "";
+    }
+    return *res;
+}
+struct TaskPromiseBase
+{
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept
+        {
+            return false;
+        }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+        {
+            auto next = h.promise().m_Continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    std::suspend_always initial_suspend() noexcept
+    {
+        return {};
+    }
+    FinalAwaiter final_suspend() noexcept
+    {
+        return {};
+    }
+    void unhandled_exception()
+    {
+        m_Error = std::current_exception();
+    }
+    std::coroutine_handle<> m_Continuation;
+    std::exception_ptr m_Error;
+};
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+    void return_value(T value)
+    {
+        m_Value.emplace(std::move(value));
+    }
+    T Result()
+    {
+        if (m_Error)
+            std::rethrow_exception(m_Error);
+        return std::move(*m_Value);
+    }
+    std::optional<T> m_Value;
+};
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+    void return_void() {}
+    void Result()
+    {
+        if (m_Error)
+            std::rethrow_exception(m_Error);
+    }
+};
+} // namespace detail
+
+/**
+ * Lazily started coroutine. It runs when it is awaited or passed to
+ * EventLoop::Run and resumes its awaiter when it finishes. A C++ exception
+ * escaping the coroutine (qjs::Exception for rejected JS promises) is
+ * rethrown to the awaiter.
+ */
+template <typename T = Value>
+class [[nodiscard]] Task
+{
+public:
+    using ValueType = T;
+    struct promise_type : detail::TaskPromise<T>
+    {
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept :
+        m_Handle(std::exchange(other.m_Handle, nullptr))
+    {
+    }
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+            m_Handle = std::exchange(other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task()
+    {
+        if (m_Handle)
+            m_Handle.destroy();
+    }
+    //@note must be called once, awaiting the task starts it too
+    void Start()
+    {
+        m_Handle.resume();
+    }
+    bool IsDone() const
+    {
+        return !m_Handle || m_Handle.done();
+    }
+    T Result()
+    {
+        return m_Handle.promise().Result();
+    }
+    auto operator co_await() noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+            bool await_ready() noexcept
+            {
+                return handle.done();
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().m_Continuation = awaiting;
+                return handle;
+            }
+            T await_resume()
+            {
+                return handle.promise().Result();
+            }
+        };
+        return Awaiter{m_Handle};
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) :
+        m_Handle(handle)
+    {
+    }
+    std::coroutine_handle<promise_type> m_Handle;
+};
+
+/**
+ * Awaiter of a JS value: promises and other thenables suspend the coroutine
+ * until they are settled, any other value is the result immediately.
+ * The coroutine is resumed by the promise reaction job, i.e. on the thread
+ * running the JS jobs. Rejection throws qjs::Exception.
+ * usage:
+ *      Value v = co_await fetch.Call(url);
+ */
+class PromiseAwaiter
+{
+public:
+    explicit PromiseAwaiter(Value&& value) :
+        m_Value(std::move(value)), m_State(std::make_shared<State>())
+    {
+        m_State->context = m_Value.GetContext();
+        m_State->runtime = JS_GetRuntime(m_State->context);
+    }
+    PromiseAwaiter(const PromiseAwaiter&) = delete;
+    PromiseAwaiter& operator=(const PromiseAwaiter&) = delete;
+    ~PromiseAwaiter()
+    {
+        // reaction of the promise may outlive the awaiting coroutine
+        m_State->handle = nullptr;
+        JS_FreeValueRT(m_State->runtime, m_Then);
+    }
+    bool await_ready()
+    {
+        JSContext* ctx = m_State->context;
+        JSValue value = m_Value.GetRaw();
+        if (JS_IsException(value))
+        {
+            m_State->Settle(JS_GetException(ctx), true);
+            return true;
+        }
+        if (!JS_IsObject(value))
+        {
+            m_State->Settle(JS_DupValue(ctx, value), false);
+            return true;
+        }
+        m_Then = JS_GetPropertyStr(ctx, value, "then");
+        if (JS_IsException(m_Then))
+        {
+            m_State->Settle(JS_GetException(ctx), true);
+            return true;
+        }
+        if (!JS_IsFunction(ctx, m_Then))
+        {
+            m_State->Settle(JS_DupValue(ctx, value), false);
+            return true;
+        }
+        return false;
+    }
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        JSContext* ctx = m_State->context;
+        JSValue funcs[2];
+        for (int i = 0; i < 2; i++)
+        {
+            bool rejected = i != 0;
+            auto* closure = new detail::Closure([state = m_State, rejected](JSContext* ctx, JSValueConst, int argc, JSValueConst* argv) -> JSValue {
+                if (state->settled)
+                    return JS_UNDEFINED;
+                state->Settle(JS_DupValue(ctx, argc > 0 ? argv[0] : JS_UNDEFINED), rejected);
+                if (auto h = std::exchange(state->handle, nullptr))
+                    h.resume();
+                return JS_UNDEFINED;
+            });
+            funcs[i] = detail::CreateClosure(ctx, closure);
+        }
+        JSValue res = JS_Call(ctx, m_Then, m_Value.GetRaw(), 2, funcs);
+        JS_FreeValue(ctx, funcs[0]);
+        JS_FreeValue(ctx, funcs[1]);
+        JS_FreeValue(ctx, std::exchange(m_Then, JS_UNDEFINED));
+        if (JS_IsException(res))
+        {
+            if (!m_State->settled)
+                m_State->Settle(JS_GetException(ctx), true);
+            return false;
+        }
+        JS_FreeValue(ctx, res);
+        // thenable may have settled synchronously, the coroutine goes on then
+        if (m_State->settled)
+            return false;
+        m_State->handle = handle;
+        return true;
+    }
+    Value await_resume()
+    {
+        JSContext* ctx = m_State->context;
+        JSValue result = std::exchange(m_State->result, JS_UNDEFINED);
+        if (m_State->rejected)
+        {
+            Exception e{detail::RejectionMessage(ctx, result)};
+            JS_FreeValue(ctx, result);
+            throw e;
+        }
+        return Value(result, ctx);
+    }
+
+private:
+    struct State
+    {
+        ~State()
+        {
+            JS_FreeValueRT(runtime, result);
+        }
+        void Settle(JSValue value, bool isRejected)
+        {
+            settled = true;
+            rejected = isRejected;
+            result = value;
+        }
+        JSContext* context = nullptr;
+        JSRuntime* runtime = nullptr;
+        JSValue result = JS_UNDEFINED;
+        bool settled = false;
+        bool rejected = false;
+        std::coroutine_handle<> handle;
+    };
+    Value m_Value;
+    JSValue m_Then = JS_UNDEFINED;
+    std::shared_ptr<State> m_State;
+};
+inline PromiseAwaiter operator co_await(Value&& value)
+{
+    return PromiseAwaiter(std::move(value));
+}
+
+/**
+ * Executor resuming coroutines on the thread running the JS runtime.
+ * Host I/O completes on its own threads and hands the continuation back
+ * with Post, implement it to plug quickjspp into the host event loop.
+ */
+class Executor
+{
+public:
+    virtual ~Executor() = default;
+    //@note may be called from any thread
+    virtual void Post(std::function<void()> func) = 0;
+    /**
+     * Awaitable moving the coroutine to the executor thread.
+     * usage:
+     *      co_await executor.Schedule();
+     */
+    auto Schedule()
+    {
+        struct Awaiter
+        {
+            Executor& executor;
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                executor.Post([handle]() { handle.resume(); });
+            }
+            void await_resume() noexcept {}
+        };
+        return Awaiter{*this};
+    }
+};
+
+/**
+ * Default executor: runs posted functions and drains pending JS jobs
+ * (promise reactions) in batches of up to batchSize jobs.
+ */
+class EventLoop : public Executor
+{
+public:
+    explicit EventLoop(Runtime& runtime, size_t batchSize = 64) :
+        m_Runtime(runtime.GetRaw()), m_BatchSize(batchSize)
+    {
+    }
+    void Post(std::function<void()> func) override
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Posted.push_back(std::move(func));
+        }
+        m_Cond.notify_one();
+    }
+    /**
+     * Run up to maxJobs pending JS jobs, stops when timeBudgetMs (if > 0)
+     * is elapsed. Errors of the jobs are dumped like in js_std_loop.
+     * @return number of executed jobs
+     */
+    size_t RunJobs(size_t maxJobs, int timeBudgetMs = 0)
+    {
+        size_t n = 0;
+        JSContext* ctx;
+        while (n < maxJobs)
+        {
+            int max = (int)std::min<size_t>(maxJobs - n, INT_MAX);
+            int done = JS_ExecutePendingJobs(m_Runtime, max, timeBudgetMs, &ctx);
+            n += done;
+            if (!ctx)
+                break;
+            js_std_dump_error(ctx);
+        }
+        return n;
+    }
+    /**
+     * Run posted functions and all pending JS jobs, waits up to timeout for
+     * posted functions when there is nothing to run.
+     * @return false if nothing was run
+     */
+    bool RunOnce(std::chrono::milliseconds timeout = std::chrono::milliseconds(0))
+    {
+        std::vector<std::function<void()>> posted;
+        {
+            std::unique_lock lock(m_Mutex);
+            if (m_Posted.empty() && !JS_IsJobPending(m_Runtime))
+                m_Cond.wait_for(lock, timeout, [this]() { return !m_Posted.empty(); });
+            posted.swap(m_Posted);
+        }
+        for (auto& func : posted)
+            func();
+        size_t total = 0;
+        for (size_t n = m_BatchSize; n == m_BatchSize; total += n)
+            n = RunJobs(m_BatchSize);
+        return !posted.empty() || total != 0;
+    }
+    /**
+     * Start the task and run the loop until it is done.
+     * usage:
+     *      Value v = loop.Run(main(context));
+     */
+    template <typename T>
+    T Run(Task<T> task)
+    {
+        task.Start();
+        while (!task.IsDone())
+            RunOnce(std::chrono::milliseconds(100));
+        return task.Result();
+    }
+
+private:
+    JSRuntime* m_Runtime;
+    size_t m_BatchSize;
+    std::mutex m_Mutex;
+    std::condition_variable m_Cond;
+    std::vector<std::function<void()>> m_Posted;
+};
+
+namespace detail
+{
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object()
+        {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+// func and args are kept in the frame: the JS function may be collected before the task is done
+template <typename F, typename Args>
+DetachedTask SettleAsyncClosure(JSContext* ctx, F func, Args args, JSValue resolve, JSValue reject)
+{
+    using R = typename decltype(WrapClosureUtils::apply_args(func, args))::ValueType;
+    JSValue result = JS_UNDEFINED;
+    std::optional<std::string> error;
+    try
+    {
+        if constexpr (std::is_same_v<R, void>)
+        {
+            co_await WrapClosureUtils::apply_args(func, args);
+        }
+        else
+        {
+            R res = co_await WrapClosureUtils::apply_args(func, args);
+            result = ConvertToJsType<R>::Convert(ctx, res);
+        }
+    }
+    catch (const Exception& e)
+    {
+        error = e.message;
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+    bool rejected = error.has_value() || JS_IsException(result);
+    if (error)
+    {
+        result = JS_NewError(ctx);
+        JS_SetPropertyStr(ctx, result, "message", JS_NewString(ctx, error->c_str()));
+    }
+    else if (JS_IsException(result))
+    {
+        result = JS_GetException(ctx);
+    }
+    JS_FreeValue(ctx, JS_Call(ctx, rejected ? reject : resolve, JS_UNDEFINED, 1, &result));
+    JS_FreeValue(ctx, result);
+    JS_FreeValue(ctx, resolve);
+    JS_FreeValue(ctx, reject);
+}
+} // namespace detail
+
+template <typename F>
+Value Context::CreateAsyncClosure(const F& func)
+{
+    using Traits = detail::LambdaTraits<decltype(&std::remove_reference_t<F>::operator())>;
+    using Args = typename detail::TupleDecay<typename Traits::ArgsTuple>::type;
+    return CreateClosureNoWrap([func](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) -> JSValue {
+        if (argc != std::tuple_size<Args>::value)
+        {
+            JS_ThrowTypeError(ctx, "Expected %d arguments, got %d", (int)std::tuple_size<Args>::value, argc);
+            return JS_EXCEPTION;
+        }
+        Args args;
+        if (!detail::ConvertArgs2<Args>{}(args, argv, ctx))
+        {
+            JS_ThrowTypeError(ctx, "Argument conversion failed");
+            return JS_EXCEPTION;
+        }
+        JSValue funcs[2];
+        JSValue promise = JS_NewPromiseCapability(ctx, funcs);
+        if (JS_IsException(promise))
+            return promise;
+        // runs until the first suspension, like a JS async function
+        detail::SettleAsyncClosure(ctx, func, std::move(args), funcs[0], funcs[1]);
+        return promise;
+    });
+}
+} // namespace qjs
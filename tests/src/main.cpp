@@ -1,4 +1,5 @@
 #include <quickjspp/quickjspp.h>
+#include <quickjspp/prometheus.h>
 #include <print>
 #include <quickjspp/detail/debugger/debugger_server.h>
 #include <thread>
@@ -6,6 +7,14 @@
 #include "net_context.h"
 #include "quickjs.h"
 #include "quickjs-libc.h"
+#ifdef __linux__
+#include <filesystem>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 // 1. C 函数实现，参数和返回值都是 JSValue
 static JSValue js_print(JSContext* ctx, JSValueConst this_val, int argc,
                         JSValueConst* argv)
@@ -41,6 +50,15 @@ static JSValue js_sleep(JSContext* ctx, JSValueConst this_val, int argc,
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
     return JS_UNDEFINED;
 }
+// 测试失败时退出, 不依赖 assert (Release 下也检查)
+static void check(bool ok, const char* what)
+{
+    if (!ok)
+    {
+        std::print("check failed: {}\n", what);
+        std::exit(1);
+    }
+}
 JS_BOOL debug_handler(JSContext* ctx, JSAtom file_name, uint32_t line_no, const uint8_t* pc)
 {
     std::print("lint: {}", line_no);
@@ -476,6 +494,403 @@ Object.create(Vec3f.prototype);
         )");
 
 }
+void test_atom_property()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    auto global_obj = context.GetGlobalObject();
+    // 预先创建 atom, 之后的属性访问不需要再次计算 hash
+    qjs::Atom counter = context.CreateAtom("counter");
+    global_obj.SetProperty(counter, qjs::Value(JS_NewInt32(context.GetRaw(), 0), context.GetRaw()));
+    for (int i = 0; i < 1000; ++i)
+    {
+        int32_t v = global_obj.GetProperty(counter).Convert<int32_t>();
+        global_obj.SetProperty(counter, qjs::Value(JS_NewInt32(context.GetRaw(), v + 1), context.GetRaw()));
+    }
+    auto res = context.Eval("counter");
+    check(res.Convert<int32_t>() == 1000, "counter updated through the atom");
+    std::println("counter: {}", res.Convert<int32_t>());
+}
+void test_async()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    qjs::EventLoop loop(runtime);
+    // 模拟宿主的异步 I/O: 在其他线程完成, 通过 executor 回到 JS 线程
+    struct AsyncRead
+    {
+        qjs::Executor& executor;
+        int32_t value;
+        bool await_ready() { return false; }
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            std::thread([this, h]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                executor.Post([h]() { h.resume(); });
+            }).detach();
+        }
+        int32_t await_resume() { return value; }
+    };
+    auto read = context.CreateAsyncClosure([&loop](int32_t v) -> qjs::Task<int32_t> {
+        int32_t res = co_await AsyncRead{loop, v};
+        co_return res * 2;
+    });
+    context.GetGlobalObject().SetPropertyStr("read", std::move(read));
+    context.Eval(R"(
+    async function sum(n)
+    {
+        let s = 0;
+        for (let i = 1; i <= n; i++)
+            s += await read(i);
+        return s;
+    }
+    async function fail() { throw new Error("failed in js"); }
+    )");
+    auto global_obj = context.GetGlobalObject();
+    auto main = [&]() -> qjs::Task<std::string> {
+        qjs::Value res = co_await global_obj.GetProperty("sum").Call(5);
+        std::string error;
+        try
+        {
+            co_await global_obj.GetProperty("fail").Call();
+        }
+        catch (const qjs::Exception& e)
+        {
+            error = e.message;
+        }
+        co_return std::to_string(res.Convert<int32_t>()) + " " + error;
+    };
+    // sum(5) = 2 * (1 + ... + 5), fail() 的异常传回 C++
+    std::string result = loop.Run(main());
+    check(result == "30 failed in js", "async result");
+    std::println("async result: {}", result);
+}
+void test_runtime_stats()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    // 计数器只能在 runtime 的线程上读取, 快照可以交给其他线程导出
+    qjs::RuntimeStats before = runtime.GetStats();
+    context.Eval(R"(
+    let a = [];
+    for (let i = 0; i < 1000; i++)
+        a.push({ i, s: "x" + i });
+    try { null.x; } catch (e) {}
+    Math.max(1, 2);
+    Promise.resolve(1).then(v => v + 1).then(v => v + 1);
+    )");
+    JSContext* job_ctx;
+    while (JS_ExecutePendingJobs(runtime.GetRaw(), -1, 0, &job_ctx) > 0)
+        ;
+    JS_RunGC(runtime.GetRaw());
+    qjs::RuntimeStats after = runtime.GetStats();
+    const JSRuntimeStats& s0 = before.counters;
+    const JSRuntimeStats& s1 = after.counters;
+    check(s1.job_count - s0.job_count == 2, "two promise jobs");
+    check(s1.gc_count - s0.gc_count >= 1, "JS_RunGC is counted");
+    check(s1.exception_count - s0.exception_count >= 1, "exception is counted");
+    check(s1.c_call_count - s0.c_call_count >= 1, "C function call is counted");
+    check(s1.obj_alloc_count - s0.obj_alloc_count >= 1000, "object allocations");
+    check(s1.obj_count - s0.obj_count >= 1000, "objects kept alive by a");
+    std::string text = qjs::FormatPrometheus(after);
+    check(text.find("quickjs_jobs_total " + std::to_string(s1.job_count) + "\n") != std::string::npos,
+          "prometheus export");
+    std::println("objects: {} exceptions: {} c calls: {} jobs: {}", s1.obj_count,
+                 s1.exception_count, s1.c_call_count, s1.job_count);
+}
+// 按 qjsc -s (JS_WRITE_OBJ_STRIP_DEBUG) 和 -z (JS_WRITE_OBJ_COMPRESS) 写出的字节码可以读回并执行
+void test_bytecode_flags()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    JSContext* ctx = context.GetRaw();
+    std::string code;
+    for (int i = 0; i < 20; i++)
+        code += "function f" + std::to_string(i) + "(n) { let s = 0; for (let i = 0; i < n; i++) s += i * " +
+                std::to_string(i) + "; return s; }\n";
+    code += "var r = 0; for (var i = 0; i < 20; i++) r += globalThis['f' + i](10); r;";
+    JSValue func = JS_Eval(ctx, code.c_str(), code.size(), "<bytecode>",
+                           JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    check(!JS_IsException(func), "compile");
+    size_t plain_len;
+    uint8_t* plain = JS_WriteObject(ctx, &plain_len, func, JS_WRITE_OBJ_BYTECODE);
+    check(plain != nullptr, "write plain bytecode");
+    const int flag_sets[] = { JS_WRITE_OBJ_STRIP_DEBUG, JS_WRITE_OBJ_COMPRESS,
+                              JS_WRITE_OBJ_STRIP_DEBUG | JS_WRITE_OBJ_COMPRESS };
+    for (int flags : flag_sets)
+    {
+        size_t len;
+        uint8_t* buf = JS_WriteObject(ctx, &len, func, JS_WRITE_OBJ_BYTECODE | flags);
+        check(buf != nullptr, "write bytecode");
+        check(len < plain_len, "stripped or compressed bytecode is smaller");
+        // 压缩数据的版本字节带 BC_COMPRESSED_VERSION (0x20)
+        check(((buf[0] & 0x20) != 0) == ((flags & JS_WRITE_OBJ_COMPRESS) != 0), "version byte");
+        JSValue obj = JS_ReadObject(ctx, buf, len, JS_READ_OBJ_BYTECODE);
+        check(!JS_IsException(obj), "read bytecode");
+        JSValue res = JS_EvalFunction(ctx, obj);
+        int32_t r = 0;
+        check(JS_ToInt32(ctx, &r, res) == 0 && r == 8550, "result of the read bytecode");
+        JS_FreeValue(ctx, res);
+        // 截断的数据抛出异常
+        obj = JS_ReadObject(ctx, buf, len / 2, JS_READ_OBJ_BYTECODE);
+        check(JS_IsException(obj), "truncated bytecode is rejected");
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        js_free(ctx, buf);
+    }
+    js_free(ctx, plain);
+    JS_FreeValue(ctx, func);
+    std::println("bytecode flags: ok");
+}
+// JS_ReadObjectROM 直接引用 buf 中的调试信息, 截断的数据不能越界读取
+void test_read_object_rom()
+{
+    std::vector<uint8_t> rom; // 比 runtime 存活更久
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    JSContext* ctx = context.GetRaw();
+    // 最后一个函数的行号表位于数据末尾
+    const char code[] = "add(20, 22);\n"
+                        "function add(a, b)\n"
+                        "{\n"
+                        "    let s = a;\n"
+                        "    s += b;\n"
+                        "    s *= 2;\n"
+                        "    return s / 2;\n"
+                        "}\n";
+    JSValue func = JS_Eval(ctx, code, sizeof(code) - 1, "<rom>",
+                           JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    check(!JS_IsException(func), "compile");
+    size_t len;
+    uint8_t* buf = JS_WriteObject(ctx, &len, func, JS_WRITE_OBJ_BYTECODE);
+    JS_FreeValue(ctx, func);
+    check(buf != nullptr, "write bytecode");
+    rom.assign(buf, buf + len);
+    js_free(ctx, buf);
+    // 每个截断长度单独分配, 越界读取可被 ASan 发现
+    for (size_t cut = 0; cut < len; cut++)
+    {
+        std::vector<uint8_t> part(rom.begin(), rom.begin() + cut);
+        JSValue obj = JS_ReadObjectROM(ctx, part.data(), cut, JS_READ_OBJ_BYTECODE, nullptr, nullptr);
+        check(JS_IsException(obj), "truncated bytecode is rejected");
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    // 完整的数据: 函数引用 rom, 直到 runtime 释放
+    JSValue obj = JS_ReadObjectROM(ctx, rom.data(), len, JS_READ_OBJ_BYTECODE, nullptr, nullptr);
+    check(!JS_IsException(obj), "read bytecode");
+    JSValue res = JS_EvalFunction(ctx, obj);
+    int32_t r = 0;
+    check(JS_ToInt32(ctx, &r, res) == 0 && r == 42, "result of the ROM bytecode");
+    JS_FreeValue(ctx, res);
+    std::println("read object rom: ok");
+}
+// 批量执行任务: 数量限制, 异常中止批次, 顺序与逐个执行一致
+void test_job_batching()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    JSRuntime* rt = runtime.GetRaw();
+    JSContext* ctx = context.GetRaw();
+    JSContext* job_ctx;
+    context.Eval("var log = [];\n"
+                 "for (let i = 0; i < 10; i++) Promise.resolve(i).then(v => log.push(v));\n");
+    check(JS_ExecutePendingJobs(rt, 3, 0, &job_ctx) == 3, "batch limited by max_jobs");
+    check(job_ctx == nullptr && JS_IsJobPending(rt), "jobs left after the batch");
+    check(context.Eval("log.length").Convert<int32_t>() == 3, "three jobs run");
+    check(JS_ExecutePendingJobs(rt, -1, 0, &job_ctx) == 7 && !JS_IsJobPending(rt), "remaining jobs run");
+    check(context.Eval("log.join()").Convert<std::string>() == "0,1,2,3,4,5,6,7,8,9", "jobs run in order");
+    // 抛出异常的任务中止批次, 后面的任务留在队列中
+    JSJobFunc* throwing_job = [](JSContext* ctx, int, JSValueConst*) -> JSValue {
+        return JS_ThrowTypeError(ctx, "job failed");
+    };
+    JSJobFunc* counting_job = [](JSContext* ctx, int, JSValueConst*) -> JSValue {
+        return JS_Eval(ctx, "log.push('c')", 13, "<job>", JS_EVAL_TYPE_GLOBAL);
+    };
+    JS_EnqueueJob(ctx, throwing_job, 0, nullptr);
+    JS_EnqueueJob(ctx, counting_job, 0, nullptr);
+    check(JS_ExecutePendingJobs(rt, -1, 0, &job_ctx) == 1 && job_ctx == ctx, "exception stops the batch");
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    check(JS_ExecutePendingJobs(rt, -1, 0, &job_ctx) == 1 && job_ctx == nullptr, "next batch runs the rest");
+    // await, then 和 thenable 的顺序 (与 node 相同)
+    context.Eval(R"(
+    var order = [];
+    async function f() { order.push('f1'); await null; order.push('f2'); await null; order.push('f3'); }
+    f();
+    Promise.resolve().then(() => Promise.resolve('x')).then(v => order.push(v));
+    Promise.resolve().then(() => order.push(1)).then(() => order.push(2)).then(() => order.push(3)).then(() => order.push(4));
+    )");
+    JS_ExecutePendingJobs(rt, -1, 0, &job_ctx);
+    check(context.Eval("order.join()").Convert<std::string>() == "f1,f2,1,f3,2,3,x,4", "job order");
+    // 修改 then 后, thenable 通过修改后的 then 解析
+    context.Eval(R"(
+    var thenCalls = 0, result;
+    const then = Promise.prototype.then;
+    Promise.prototype.then = function(a, b) { thenCalls++; return then.call(this, a, b); };
+    Promise.resolve().then(() => Promise.resolve(7)).then(v => result = v);
+    )");
+    JS_ExecutePendingJobs(rt, -1, 0, &job_ctx);
+    check(context.Eval("result").Convert<int32_t>() == 7, "thenable resolved");
+    check(context.Eval("thenCalls").Convert<int32_t>() == 3, "patched then called");
+    std::println("job batching: ok");
+}
+// RegExp 缓存: 命中/未命中计数, LRU 淘汰, 多个 context 共享
+void test_regexp_cache()
+{
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    JSRuntime* rt = runtime.GetRaw();
+    JS_SetRegExpCacheLimits(rt, 2, 1 << 20);
+    JS_ClearRegExpCache(rt);
+    JSRegExpCacheStats base, stats;
+    JS_GetRegExpCacheStats(rt, &base);
+    // 返回执行之后的命中数和未命中数 (相对于 base)
+    auto eval_counts = [&](const char* code) -> std::pair<int64_t, int64_t> {
+        context.Eval(code);
+        JS_GetRegExpCacheStats(rt, &stats);
+        return {stats.hits - base.hits, stats.misses - base.misses};
+    };
+    check(eval_counts("new RegExp('a+', 'g')") == std::pair<int64_t, int64_t>(0, 1), "first compile is a miss");
+    check(eval_counts("new RegExp('a+', 'g')") == std::pair<int64_t, int64_t>(1, 1), "same pattern and flags hit");
+    check(eval_counts("new RegExp('a+', 'i')") == std::pair<int64_t, int64_t>(1, 2), "other flags miss");
+    check(stats.count == 2, "two entries");
+    // a+/g 最近使用, 加入 b 时淘汰 a+/i
+    eval_counts("new RegExp('a+', 'g'); new RegExp('b')");
+    check(stats.count == 2, "count limited");
+    check(eval_counts("new RegExp('a+', 'g')") == std::pair<int64_t, int64_t>(3, 3), "recently used entry kept");
+    check(eval_counts("new RegExp('a+', 'i')") == std::pair<int64_t, int64_t>(3, 4), "least recently used entry evicted");
+    // 共享的字节码, 每个对象有自己的 lastIndex
+    check(context.Eval("let r1 = new RegExp('a+', 'g'), r2 = new RegExp('a+', 'g'); "
+                       "r1.exec('xaay'); r1.lastIndex * 10 + r2.lastIndex").Convert<int32_t>() == 30,
+          "cached regexps are independent");
+    // 同一 runtime 的其他 context 也命中
+    {
+        qjs::Context other = qjs::Context::Create(runtime).value();
+        JS_GetRegExpCacheStats(rt, &base);
+        other.Eval("/a+/g.test('aa')");
+        JS_GetRegExpCacheStats(rt, &stats);
+        check(stats.hits - base.hits == 1 && stats.misses == base.misses, "cache shared by the contexts");
+    }
+    JS_SetRegExpCacheLimits(rt, 0, 0);
+    JS_GetRegExpCacheStats(rt, &stats);
+    check(stats.count == 0 && stats.size == 0, "disabling the cache frees the entries");
+    std::println("regexp cache: ok");
+}
+#ifdef __linux__
+// 无法创建 epoll 实例时 (文件描述符用尽), 事件循环退回到 select()
+void test_poll_fallback()
+{
+    int fds[2];
+    check(pipe(fds) == 0, "pipe");
+    // 上限设为最小的空闲描述符, 之后不能再打开文件
+    int free_fd = dup(fds[0]);
+    close(free_fd);
+    struct rlimit old_limit;
+    getrlimit(RLIMIT_NOFILE, &old_limit);
+    struct rlimit limit = old_limit;
+    limit.rlim_cur = free_fd;
+    setrlimit(RLIMIT_NOFILE, &limit);
+    std::optional<qjs::Runtime> runtime = qjs::Runtime::Create();
+    setrlimit(RLIMIT_NOFILE, &old_limit);
+    check(runtime.has_value(), "runtime created without epoll");
+    qjs::Context context = qjs::Context::Create(*runtime).value();
+    std::string code = "import * as os from 'os';\n"
+                       "const R = " + std::to_string(fds[0]) + ", W = " + std::to_string(fds[1]) + ";\n"
+                       "os.setTimeout(() => os.write(W, new Uint8Array([42]).buffer, 0, 1), 10);\n"
+                       "os.setReadHandler(R, () => {\n"
+                       "    const b = new Uint8Array(1);\n"
+                       "    os.read(R, b.buffer, 0, 1);\n"
+                       "    globalThis.result = b[0];\n"
+                       "    os.setReadHandler(R, null);\n"
+                       "});\n";
+    context.Eval(code.c_str(), code.size(), "<poll>", JS_EVAL_TYPE_MODULE);
+    js_std_loop(context.GetRaw());
+    close(fds[0]);
+    close(fds[1]);
+    auto res = context.Eval("result");
+    check(res.Convert<int32_t>() == 42, "read handler called by the select() loop");
+    std::println("poll fallback: ok");
+}
+// 模块字节码缓存: 命中, 未命中和源文件修改后失效
+void test_module_cache()
+{
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / ("qjs_module_cache_" + std::to_string(getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    std::string source = (dir / "m.js").string();
+    fs::path cache = dir / "cache";
+    js_std_set_module_cache(cache.string().c_str());
+    auto write_source = [&](const char* text) { std::ofstream(source, std::ios::trunc) << text; };
+    // 每次在新的 runtime 中导入, 返回模块导出的 v
+    auto import_v = [&]() -> int32_t {
+        qjs::Runtime runtime = qjs::Runtime::Create().value();
+        qjs::Context context = qjs::Context::Create(runtime).value();
+        JS_SetModuleLoaderFunc(runtime.GetRaw(), nullptr, js_module_loader, nullptr);
+        std::string code = "import { v } from '" + source + "';\nglobalThis.v = v;\n";
+        context.Eval(code.c_str(), code.size(), "<main>", JS_EVAL_TYPE_MODULE);
+        js_std_loop(context.GetRaw());
+        return context.Eval("v").Convert<int32_t>();
+    };
+    // 缓存项通过 rename() 写入, 重新写入后 inode 改变
+    auto entry_ino = [&]() -> ino_t {
+        for (auto& entry : fs::directory_iterator(cache))
+        {
+            struct stat st;
+            if (entry.path().extension() == ".qbc" && stat(entry.path().c_str(), &st) == 0)
+                return st.st_ino;
+        }
+        return 0;
+    };
+    write_source("export const v = 1;\n");
+    check(import_v() == 1, "compiled from source");
+    ino_t ino = entry_ino();
+    check(ino != 0, "entry written on a miss");
+    check(import_v() == 1 && entry_ino() == ino, "entry kept on a hit");
+    // 大小和修改时间不变: 使用缓存的字节码而不是源文件
+    struct stat st;
+    stat(source.c_str(), &st);
+    write_source("export const v = 2;\n");
+    struct timespec times[2] = {st.st_atim, st.st_mtim};
+    utimensat(AT_FDCWD, source.c_str(), times, 0);
+    check(import_v() == 1, "bytecode read from the cache");
+    // 源文件改变后重新编译并替换缓存项
+    write_source("export const v = 33;\n");
+    check(import_v() == 33, "compiled again when the source changes");
+    check(entry_ino() != ino, "entry replaced when the source changes");
+    js_std_set_module_cache(nullptr);
+    fs::remove_all(dir);
+    std::println("module cache: ok");
+}
+// 并行预编译模块: 只编译静态导入的模块, 导入时使用预编译的字节码
+void test_module_preload()
+{
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / ("qjs_module_preload_" + std::to_string(getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto write_file = [&](const char* name, const char* text) { std::ofstream(dir / name, std::ios::trunc) << text; };
+    write_file("main.js", "import * as os from 'os';\n"
+                          "import { a } from './a.js';\n"
+                          "import { b } from './b.js';\n"
+                          "export const sum = a + b;\n");
+    write_file("a.js", "import { c } from './c.js';\nexport const a = c + 1;\n");
+    write_file("b.js", "import { c } from './c.js';\nexport const b = c + 10;\n");
+    write_file("c.js", "export const c = 100;\n");
+    qjs::Runtime runtime = qjs::Runtime::Create().value();
+    qjs::Context context = qjs::Context::Create(runtime).value();
+    JS_SetModuleLoaderFunc(runtime.GetRaw(), nullptr, js_module_loader, nullptr);
+    std::string main_path = (dir / "main.js").string();
+    // a.js, b.js 和 c.js (只编译一次); main.js 本身和 os 不编译
+    check(js_std_preload_modules(context.GetRaw(), main_path.c_str(), 4) == 3, "imported modules compiled");
+    // 预编译之后修改源文件: 仍使用预编译的字节码
+    write_file("c.js", "export const c = 200;\n");
+    std::string code = "import { sum } from '" + main_path + "';\nglobalThis.sum = sum;\n";
+    context.Eval(code.c_str(), code.size(), "<main>", JS_EVAL_TYPE_MODULE);
+    js_std_loop(context.GetRaw());
+    check(context.Eval("sum").Convert<int32_t>() == 211, "preloaded bytecode used");
+    fs::remove_all(dir);
+    std::println("module preload: ok");
+}
+#endif
 int main()
 {
     NetContext::Init();
@@ -489,6 +904,18 @@ int main()
     // benchmark_class();
     //test_closure2();
     test_js_function_call();
+    test_atom_property();
+    test_async();
+    test_runtime_stats();
+    test_bytecode_flags();
+    test_read_object_rom();
+    test_job_batching();
+    test_regexp_cache();
+#ifdef __linux__
+    test_poll_fallback();
+    test_module_cache();
+    test_module_preload();
+#endif
     NetContext::Cleanup();
     return 0;
 }